@@ -0,0 +1,1317 @@
+#include "gen_TEMPLATE_regalloc_if.h"
+#include "fourcc.h"
+#include "irgopt.h"
+
+ir_op *op_TEMPLATE_Add = NULL;
+ir_op *op_TEMPLATE_Address = NULL;
+ir_op *op_TEMPLATE_And = NULL;
+ir_op *op_TEMPLATE_Const = NULL;
+ir_op *op_TEMPLATE_Jmp = NULL;
+ir_op *op_TEMPLATE_Load = NULL;
+ir_op *op_TEMPLATE_Minus = NULL;
+ir_op *op_TEMPLATE_Mul = NULL;
+ir_op *op_TEMPLATE_Not = NULL;
+ir_op *op_TEMPLATE_Or = NULL;
+ir_op *op_TEMPLATE_Return = NULL;
+ir_op *op_TEMPLATE_Shl = NULL;
+ir_op *op_TEMPLATE_Shr = NULL;
+ir_op *op_TEMPLATE_Start = NULL;
+ir_op *op_TEMPLATE_Store = NULL;
+ir_op *op_TEMPLATE_Sub = NULL;
+ir_op *op_TEMPLATE_Xor = NULL;
+ir_op *op_TEMPLATE_fAdd = NULL;
+ir_op *op_TEMPLATE_fConst = NULL;
+ir_op *op_TEMPLATE_fDiv = NULL;
+ir_op *op_TEMPLATE_fLoad = NULL;
+ir_op *op_TEMPLATE_fMinus = NULL;
+ir_op *op_TEMPLATE_fMul = NULL;
+ir_op *op_TEMPLATE_fStore = NULL;
+ir_op *op_TEMPLATE_fSub = NULL;
+
+
+static int TEMPLATE_opcode_start = -1;
+
+
+/** A tag for the TEMPLATE opcodes. */
+#define TEMPLATE_op_tag FOURCC('T', 'E', 'M', 'P')
+
+/** Return 1 if the given opcode is a TEMPLATE machine op, 0 otherwise */
+int is_TEMPLATE_op(const ir_op *op)
+{
+	return get_op_tag(op) == TEMPLATE_op_tag;
+}
+
+/** Return 1 if the given node is a TEMPLATE machine node, 0 otherwise */
+int is_TEMPLATE_irn(const ir_node *node)
+{
+	return is_TEMPLATE_op(get_irn_op(node));
+}
+
+int get_TEMPLATE_irn_opcode(const ir_node *node)
+{
+	assert(is_TEMPLATE_irn(node));
+	return get_irn_opcode(node) - TEMPLATE_opcode_start;
+}
+
+#ifdef BIT
+#undef BIT
+#endif
+#define BIT(x)  (1 << (x))
+
+static const unsigned TEMPLATE_limit_gp_sp[] = { BIT(REG_GP_SP), 0 };
+static const unsigned TEMPLATE_limit_gp_r0[] = { BIT(REG_GP_R0), 0 };
+static const unsigned TEMPLATE_limit_gp_r1[] = { BIT(REG_GP_R1), 0 };
+static const unsigned TEMPLATE_limit_gp_r2[] = { BIT(REG_GP_R2), 0 };
+static const unsigned TEMPLATE_limit_gp_r3[] = { BIT(REG_GP_R3), 0 };
+
+static const arch_register_req_t TEMPLATE_requirements_gp_gp = {
+	.cls   = &TEMPLATE_reg_classes[CLASS_TEMPLATE_gp],
+	.width = 1,
+};
+
+
+static const arch_register_req_t TEMPLATE_requirements_gp_sp_I = {
+	.cls               = &TEMPLATE_reg_classes[CLASS_TEMPLATE_gp],
+	.limited           = TEMPLATE_limit_gp_sp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+	.ignore  = true,
+};
+
+
+static const arch_register_req_t TEMPLATE_requirements_gp_r0 = {
+	.cls               = &TEMPLATE_reg_classes[CLASS_TEMPLATE_gp],
+	.limited           = TEMPLATE_limit_gp_r0,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t TEMPLATE_requirements_gp_r1 = {
+	.cls               = &TEMPLATE_reg_classes[CLASS_TEMPLATE_gp],
+	.limited           = TEMPLATE_limit_gp_r1,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t TEMPLATE_requirements_gp_r2 = {
+	.cls               = &TEMPLATE_reg_classes[CLASS_TEMPLATE_gp],
+	.limited           = TEMPLATE_limit_gp_r2,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t TEMPLATE_requirements_gp_r3 = {
+	.cls               = &TEMPLATE_reg_classes[CLASS_TEMPLATE_gp],
+	.limited           = TEMPLATE_limit_gp_r3,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t TEMPLATE_requirements_fp_fp = {
+	.cls   = &TEMPLATE_reg_classes[CLASS_TEMPLATE_fp],
+	.width = 1,
+};
+
+
+
+/**
+ * construct Add node
+ */
+ir_node *new_bd_TEMPLATE_Add(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Add;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Address node
+ */
+ir_node *new_bd_TEMPLATE_Address(dbg_info *dbgi, ir_node *block, ir_entity *entity)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Address;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	set_TEMPLATE_entity(res, entity);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct And node
+ */
+ir_node *new_bd_TEMPLATE_And(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_And;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Const node
+ */
+ir_node *new_bd_TEMPLATE_Const(dbg_info *dbgi, ir_node *block, ir_tarval *value)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Const;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	set_TEMPLATE_value(res, value);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Jmp node
+ */
+ir_node *new_bd_TEMPLATE_Jmp(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_simple_jump;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Jmp;
+	ir_mode  *mode = mode_X;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Load node
+ */
+ir_node *new_bd_TEMPLATE_Load(dbg_info *dbgi, ir_node *block, ir_node *mem, ir_node *ptr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arch_no_requirement,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = mem;
+	in[1] = ptr;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Load;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Minus node
+ */
+ir_node *new_bd_TEMPLATE_Minus(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Minus;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mul node
+ */
+ir_node *new_bd_TEMPLATE_Mul(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Mul;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Not node
+ */
+ir_node *new_bd_TEMPLATE_Not(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Not;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Or node
+ */
+ir_node *new_bd_TEMPLATE_Or(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Or;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Return node
+ */
+ir_node *new_bd_TEMPLATE_Return(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[])
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Return;
+	ir_mode  *mode = mode_X;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Shl node
+ */
+ir_node *new_bd_TEMPLATE_Shl(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Shl;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Shr node
+ */
+ir_node *new_bd_TEMPLATE_Shr(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Shr;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Start node
+ */
+ir_node *new_bd_TEMPLATE_Start(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 6;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_schedule_first;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Start;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_sp_I;
+	out_infos[1].req = &TEMPLATE_requirements_gp_r0;
+	out_infos[2].req = &TEMPLATE_requirements_gp_r1;
+	out_infos[3].req = &TEMPLATE_requirements_gp_r2;
+	out_infos[4].req = &TEMPLATE_requirements_gp_r3;
+	out_infos[5].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Store node
+ */
+ir_node *new_bd_TEMPLATE_Store(dbg_info *dbgi, ir_node *block, ir_node *mem, ir_node *ptr, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arch_no_requirement,
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = mem;
+	in[1] = ptr;
+	in[2] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Store;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sub node
+ */
+ir_node *new_bd_TEMPLATE_Sub(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Sub;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Xor node
+ */
+ir_node *new_bd_TEMPLATE_Xor(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_Xor;
+	ir_mode  *mode = mode_Iu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fAdd node
+ */
+ir_node *new_bd_TEMPLATE_fAdd(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_fp_fp,
+		& TEMPLATE_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_fAdd;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_fp_fp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fConst node
+ */
+ir_node *new_bd_TEMPLATE_fConst(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_fConst;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_fp_fp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fDiv node
+ */
+ir_node *new_bd_TEMPLATE_fDiv(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_fp_fp,
+		& TEMPLATE_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_fDiv;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_fp_fp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fLoad node
+ */
+ir_node *new_bd_TEMPLATE_fLoad(dbg_info *dbgi, ir_node *block, ir_node *mem, ir_node *ptr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arch_no_requirement,
+		& TEMPLATE_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = mem;
+	in[1] = ptr;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_fLoad;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_fp_fp;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fMinus node
+ */
+ir_node *new_bd_TEMPLATE_fMinus(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_fMinus;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_fp_fp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fMul node
+ */
+ir_node *new_bd_TEMPLATE_fMul(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_fp_fp,
+		& TEMPLATE_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_fMul;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_fp_fp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fStore node
+ */
+ir_node *new_bd_TEMPLATE_fStore(dbg_info *dbgi, ir_node *block, ir_node *mem, ir_node *ptr, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arch_no_requirement,
+		& TEMPLATE_requirements_gp_gp,
+		& TEMPLATE_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = mem;
+	in[1] = ptr;
+	in[2] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_fStore;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fSub node
+ */
+ir_node *new_bd_TEMPLATE_fSub(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& TEMPLATE_requirements_fp_fp,
+		& TEMPLATE_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_TEMPLATE_fSub;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	TEMPLATE_attr_t *attr = (TEMPLATE_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &TEMPLATE_requirements_fp_fp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+
+
+/**
+ * Creates the TEMPLATE specific Firm machine operations
+ * needed for the assembler irgs.
+ */
+void TEMPLATE_create_opcodes(void)
+{
+	ir_op *op;
+	int    cur_opcode = get_next_ir_opcodes(iro_TEMPLATE_last);
+
+	TEMPLATE_opcode_start = cur_opcode;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Add, "TEMPLATE_Add", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Add = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Address, "TEMPLATE_Address", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Address = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_And, "TEMPLATE_And", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_And = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Const, "TEMPLATE_Const", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Const = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Jmp, "TEMPLATE_Jmp", op_pin_state_pinned, irop_flag_cfopcode, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Jmp = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Load, "TEMPLATE_Load", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Load = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Minus, "TEMPLATE_Minus", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Minus = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Mul, "TEMPLATE_Mul", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Mul = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Not, "TEMPLATE_Not", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Not = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Or, "TEMPLATE_Or", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Or = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Return, "TEMPLATE_Return", op_pin_state_pinned, irop_flag_cfopcode, oparity_variable, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Return = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Shl, "TEMPLATE_Shl", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Shl = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Shr, "TEMPLATE_Shr", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Shr = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Start, "TEMPLATE_Start", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Start = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Store, "TEMPLATE_Store", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Store = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Sub, "TEMPLATE_Sub", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Sub = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_Xor, "TEMPLATE_Xor", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_Xor = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_fAdd, "TEMPLATE_fAdd", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_fAdd = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_fConst, "TEMPLATE_fConst", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_fConst = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_fDiv, "TEMPLATE_fDiv", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_fDiv = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_fLoad, "TEMPLATE_fLoad", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_fLoad = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_fMinus, "TEMPLATE_fMinus", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_fMinus = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_fMul, "TEMPLATE_fMul", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_fMul = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_fStore, "TEMPLATE_fStore", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_fStore = op;
+	op = new_ir_op(cur_opcode + iro_TEMPLATE_fSub, "TEMPLATE_fSub", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(TEMPLATE_attr_t));
+	set_op_dump(op, TEMPLATE_dump_node);
+	set_op_attrs_equal(op, TEMPLATE_attrs_equal);
+	set_op_copy_attr(op, TEMPLATE_copy_attr);
+	set_op_tag(op, TEMPLATE_op_tag);
+	op_TEMPLATE_fSub = op;
+
+}
+
+void TEMPLATE_free_opcodes(void)
+{
+	free_ir_op(op_TEMPLATE_Add); op_TEMPLATE_Add = NULL;
+	free_ir_op(op_TEMPLATE_Address); op_TEMPLATE_Address = NULL;
+	free_ir_op(op_TEMPLATE_And); op_TEMPLATE_And = NULL;
+	free_ir_op(op_TEMPLATE_Const); op_TEMPLATE_Const = NULL;
+	free_ir_op(op_TEMPLATE_Jmp); op_TEMPLATE_Jmp = NULL;
+	free_ir_op(op_TEMPLATE_Load); op_TEMPLATE_Load = NULL;
+	free_ir_op(op_TEMPLATE_Minus); op_TEMPLATE_Minus = NULL;
+	free_ir_op(op_TEMPLATE_Mul); op_TEMPLATE_Mul = NULL;
+	free_ir_op(op_TEMPLATE_Not); op_TEMPLATE_Not = NULL;
+	free_ir_op(op_TEMPLATE_Or); op_TEMPLATE_Or = NULL;
+	free_ir_op(op_TEMPLATE_Return); op_TEMPLATE_Return = NULL;
+	free_ir_op(op_TEMPLATE_Shl); op_TEMPLATE_Shl = NULL;
+	free_ir_op(op_TEMPLATE_Shr); op_TEMPLATE_Shr = NULL;
+	free_ir_op(op_TEMPLATE_Start); op_TEMPLATE_Start = NULL;
+	free_ir_op(op_TEMPLATE_Store); op_TEMPLATE_Store = NULL;
+	free_ir_op(op_TEMPLATE_Sub); op_TEMPLATE_Sub = NULL;
+	free_ir_op(op_TEMPLATE_Xor); op_TEMPLATE_Xor = NULL;
+	free_ir_op(op_TEMPLATE_fAdd); op_TEMPLATE_fAdd = NULL;
+	free_ir_op(op_TEMPLATE_fConst); op_TEMPLATE_fConst = NULL;
+	free_ir_op(op_TEMPLATE_fDiv); op_TEMPLATE_fDiv = NULL;
+	free_ir_op(op_TEMPLATE_fLoad); op_TEMPLATE_fLoad = NULL;
+	free_ir_op(op_TEMPLATE_fMinus); op_TEMPLATE_fMinus = NULL;
+	free_ir_op(op_TEMPLATE_fMul); op_TEMPLATE_fMul = NULL;
+	free_ir_op(op_TEMPLATE_fStore); op_TEMPLATE_fStore = NULL;
+	free_ir_op(op_TEMPLATE_fSub); op_TEMPLATE_fSub = NULL;
+
+}
@@ -0,0 +1,482 @@
+/**
+ * @file
+ * @brief     Generated functions to emit code for assembler ir nodes.
+ * @note      DO NOT EDIT THIS FILE, your changes will be lost.
+ *            Edit ir/be/amd64/amd64_spec.pl instead.
+ *            created by: ./ir/be/scripts/generate_emitter.pl ir/be/amd64/amd64_spec.pl build/gen/ir/be/amd64
+ * @date      Fri Oct 16 18:53:31 2026
+ */
+#include "beemitter.h"
+#include "gen_amd64_emitter.h"
+#include "amd64_new_nodes.h"
+#include "amd64_emitter.h"
+
+static void emit_amd64_add(ir_node const *const node)
+{
+	amd64_emitf(node, "add%M %AM");
+}
+
+static void emit_amd64_addpd(ir_node const *const node)
+{
+	amd64_emitf(node, "addpd %AM");
+}
+
+static void emit_amd64_addps(ir_node const *const node)
+{
+	amd64_emitf(node, "addps %AM");
+}
+
+static void emit_amd64_adds(ir_node const *const node)
+{
+	amd64_emitf(node, "adds%MX %AM");
+}
+
+static void emit_amd64_and(ir_node const *const node)
+{
+	amd64_emitf(node, "and%M %AM");
+}
+
+static void emit_amd64_call(ir_node const *const node)
+{
+	amd64_emitf(node, "call %*AM");
+}
+
+static void emit_amd64_cmp(ir_node const *const node)
+{
+	amd64_emitf(node, "cmp%M %AM");
+}
+
+static void emit_amd64_cvtsd2ss(ir_node const *const node)
+{
+	amd64_emitf(node, "cvtsd2ss %AM, %^D0");
+}
+
+static void emit_amd64_cvtsi2sd(ir_node const *const node)
+{
+	amd64_emitf(node, "cvtsi2sd %AM, %^D0");
+}
+
+static void emit_amd64_cvtsi2ss(ir_node const *const node)
+{
+	amd64_emitf(node, "cvtsi2ss %AM, %^D0");
+}
+
+static void emit_amd64_cvtss2sd(ir_node const *const node)
+{
+	amd64_emitf(node, "cvtss2sd %AM, %^D0");
+}
+
+static void emit_amd64_cvttsd2si(ir_node const *const node)
+{
+	amd64_emitf(node, "cvttsd2si %AM, %D0");
+}
+
+static void emit_amd64_cvttss2si(ir_node const *const node)
+{
+	amd64_emitf(node, "cvttss2si %AM, %D0");
+}
+
+static void emit_amd64_div(ir_node const *const node)
+{
+	amd64_emitf(node, "div%M %AM");
+}
+
+static void emit_amd64_divs(ir_node const *const node)
+{
+	amd64_emitf(node, "divs%MX %AM");
+}
+
+static void emit_amd64_haddpd(ir_node const *const node)
+{
+	amd64_emitf(node, "haddpd %AM");
+}
+
+static void emit_amd64_idiv(ir_node const *const node)
+{
+	amd64_emitf(node, "idiv%M %AM");
+}
+
+static void emit_amd64_ijmp(ir_node const *const node)
+{
+	amd64_emitf(node, "jmp %*AM");
+}
+
+static void emit_amd64_imul(ir_node const *const node)
+{
+	amd64_emitf(node, "imul%M %AM");
+}
+
+static void emit_amd64_imul_1op(ir_node const *const node)
+{
+	amd64_emitf(node, "imul%M %AM");
+}
+
+static void emit_amd64_lea(ir_node const *const node)
+{
+	amd64_emitf(node, "lea%M %A, %D0");
+}
+
+static void emit_amd64_leave(ir_node const *const node)
+{
+	amd64_emitf(node, "leave");
+}
+
+static void emit_amd64_mov_imm(ir_node const *const node)
+{
+	amd64_emitf(node, "mov%MM $%C, %D0");
+}
+
+static void emit_amd64_mov_store(ir_node const *const node)
+{
+	amd64_emitf(node, "mov%M %S0, %A");
+}
+
+static void emit_amd64_movd_gp_xmm(ir_node const *const node)
+{
+	amd64_emitf(node, "movd %S0, %D0");
+}
+
+static void emit_amd64_movd_xmm_gp(ir_node const *const node)
+{
+	amd64_emitf(node, "movd %S0, %D0");
+}
+
+static void emit_amd64_movdqa(ir_node const *const node)
+{
+	amd64_emitf(node, "movdqa %AM, %D0");
+}
+
+static void emit_amd64_movdqu(ir_node const *const node)
+{
+	amd64_emitf(node, "movdqu %AM, %D0");
+}
+
+static void emit_amd64_movdqu_store(ir_node const *const node)
+{
+	amd64_emitf(node, "movdqu %^S0, %A");
+}
+
+static void emit_amd64_movq(ir_node const *const node)
+{
+	amd64_emitf(node, "movq %AM, %D0");
+}
+
+static void emit_amd64_movs(ir_node const *const node)
+{
+	amd64_emitf(node, "movs%Mq %AM, %^D0");
+}
+
+static void emit_amd64_movs_store_xmm(ir_node const *const node)
+{
+	amd64_emitf(node, "movs%MX %^S0, %A");
+}
+
+static void emit_amd64_movs_xmm(ir_node const *const node)
+{
+	amd64_emitf(node, "movs%MX %AM, %D0");
+}
+
+static void emit_amd64_mul(ir_node const *const node)
+{
+	amd64_emitf(node, "mul%M %AM");
+}
+
+static void emit_amd64_mulpd(ir_node const *const node)
+{
+	amd64_emitf(node, "mulpd %AM");
+}
+
+static void emit_amd64_mulps(ir_node const *const node)
+{
+	amd64_emitf(node, "mulps %AM");
+}
+
+static void emit_amd64_muls(ir_node const *const node)
+{
+	amd64_emitf(node, "muls%MX %AM");
+}
+
+static void emit_amd64_neg(ir_node const *const node)
+{
+	amd64_emitf(node, "neg%M %AM");
+}
+
+static void emit_amd64_not(ir_node const *const node)
+{
+	amd64_emitf(node, "not%M %AM");
+}
+
+static void emit_amd64_or(ir_node const *const node)
+{
+	amd64_emitf(node, "or%M %AM");
+}
+
+static void emit_amd64_paddb(ir_node const *const node)
+{
+	amd64_emitf(node, "paddb %AM");
+}
+
+static void emit_amd64_paddd(ir_node const *const node)
+{
+	amd64_emitf(node, "paddd %AM");
+}
+
+static void emit_amd64_paddq(ir_node const *const node)
+{
+	amd64_emitf(node, "paddq %AM");
+}
+
+static void emit_amd64_paddw(ir_node const *const node)
+{
+	amd64_emitf(node, "paddw %AM");
+}
+
+static void emit_amd64_pand(ir_node const *const node)
+{
+	amd64_emitf(node, "pand %AM");
+}
+
+static void emit_amd64_pop_am(ir_node const *const node)
+{
+	amd64_emitf(node, "pop%M %A");
+}
+
+static void emit_amd64_por(ir_node const *const node)
+{
+	amd64_emitf(node, "por %AM");
+}
+
+static void emit_amd64_pshufd_0(ir_node const *const node)
+{
+	amd64_emitf(node, "pshufd $0, %^S0, %^D0");
+}
+
+static void emit_amd64_psubb(ir_node const *const node)
+{
+	amd64_emitf(node, "psubb %AM");
+}
+
+static void emit_amd64_psubd(ir_node const *const node)
+{
+	amd64_emitf(node, "psubd %AM");
+}
+
+static void emit_amd64_psubq(ir_node const *const node)
+{
+	amd64_emitf(node, "psubq %AM");
+}
+
+static void emit_amd64_psubw(ir_node const *const node)
+{
+	amd64_emitf(node, "psubw %AM");
+}
+
+static void emit_amd64_punpcklbw(ir_node const *const node)
+{
+	amd64_emitf(node, "punpcklbw %AM");
+}
+
+static void emit_amd64_punpckldq(ir_node const *const node)
+{
+	amd64_emitf(node, "punpckldq %AM");
+}
+
+static void emit_amd64_punpcklqdq(ir_node const *const node)
+{
+	amd64_emitf(node, "punpcklqdq %AM");
+}
+
+static void emit_amd64_punpcklwd(ir_node const *const node)
+{
+	amd64_emitf(node, "punpcklwd %AM");
+}
+
+static void emit_amd64_push_am(ir_node const *const node)
+{
+	amd64_emitf(node, "push%M %A");
+}
+
+static void emit_amd64_push_reg(ir_node const *const node)
+{
+	amd64_emitf(node, "pushq %^S1");
+}
+
+static void emit_amd64_pxor(ir_node const *const node)
+{
+	amd64_emitf(node, "pxor %AM");
+}
+
+static void emit_amd64_ret(ir_node const *const node)
+{
+	amd64_emitf(node, "ret");
+}
+
+static void emit_amd64_sar(ir_node const *const node)
+{
+	amd64_emitf(node, "sar%MS %SO");
+}
+
+static void emit_amd64_sbb(ir_node const *const node)
+{
+	amd64_emitf(node, "sbb%M %AM");
+}
+
+static void emit_amd64_shl(ir_node const *const node)
+{
+	amd64_emitf(node, "shl%MS %SO");
+}
+
+static void emit_amd64_shr(ir_node const *const node)
+{
+	amd64_emitf(node, "shr%MS %SO");
+}
+
+static void emit_amd64_shufps_0(ir_node const *const node)
+{
+	amd64_emitf(node, "shufps $0, %AM");
+}
+
+static void emit_amd64_sub(ir_node const *const node)
+{
+	amd64_emitf(node, "sub%M %AM");
+}
+
+static void emit_amd64_sub_sp(ir_node const *const node)
+{
+	amd64_emitf(node, "subq %AM");
+	amd64_emitf(node, "movq %%rsp, %D1");
+}
+
+static void emit_amd64_subpd(ir_node const *const node)
+{
+	amd64_emitf(node, "subpd %AM");
+}
+
+static void emit_amd64_subps(ir_node const *const node)
+{
+	amd64_emitf(node, "subps %AM");
+}
+
+static void emit_amd64_subs(ir_node const *const node)
+{
+	amd64_emitf(node, "subs%MX %AM");
+}
+
+static void emit_amd64_ucomis(ir_node const *const node)
+{
+	amd64_emitf(node, "ucomis%MX %AM");
+}
+
+static void emit_amd64_unpcklpd(ir_node const *const node)
+{
+	amd64_emitf(node, "unpcklpd %AM");
+}
+
+static void emit_amd64_xor(ir_node const *const node)
+{
+	amd64_emitf(node, "xor%M %AM");
+}
+
+static void emit_amd64_xor_0(ir_node const *const node)
+{
+	amd64_emitf(node, "xorl %3D0, %3D0");
+}
+
+static void emit_amd64_xorp(ir_node const *const node)
+{
+	amd64_emitf(node, "xorp%MX %AM");
+}
+
+static void emit_amd64_xorpd_0(ir_node const *const node)
+{
+	amd64_emitf(node, "xorpd %^D0, %^D0");
+}
+
+
+
+/**
+ * Enters the emitter functions for handled nodes into the generic
+ * pointer of an opcode.
+ */
+void amd64_register_spec_emitters(void)
+{
+	be_set_emitter(op_amd64_add, emit_amd64_add);
+	be_set_emitter(op_amd64_addpd, emit_amd64_addpd);
+	be_set_emitter(op_amd64_addps, emit_amd64_addps);
+	be_set_emitter(op_amd64_adds, emit_amd64_adds);
+	be_set_emitter(op_amd64_and, emit_amd64_and);
+	be_set_emitter(op_amd64_call, emit_amd64_call);
+	be_set_emitter(op_amd64_cmp, emit_amd64_cmp);
+	be_set_emitter(op_amd64_cvtsd2ss, emit_amd64_cvtsd2ss);
+	be_set_emitter(op_amd64_cvtsi2sd, emit_amd64_cvtsi2sd);
+	be_set_emitter(op_amd64_cvtsi2ss, emit_amd64_cvtsi2ss);
+	be_set_emitter(op_amd64_cvtss2sd, emit_amd64_cvtss2sd);
+	be_set_emitter(op_amd64_cvttsd2si, emit_amd64_cvttsd2si);
+	be_set_emitter(op_amd64_cvttss2si, emit_amd64_cvttss2si);
+	be_set_emitter(op_amd64_div, emit_amd64_div);
+	be_set_emitter(op_amd64_divs, emit_amd64_divs);
+	be_set_emitter(op_amd64_haddpd, emit_amd64_haddpd);
+	be_set_emitter(op_amd64_idiv, emit_amd64_idiv);
+	be_set_emitter(op_amd64_ijmp, emit_amd64_ijmp);
+	be_set_emitter(op_amd64_imul, emit_amd64_imul);
+	be_set_emitter(op_amd64_imul_1op, emit_amd64_imul_1op);
+	be_set_emitter(op_amd64_lea, emit_amd64_lea);
+	be_set_emitter(op_amd64_leave, emit_amd64_leave);
+	be_set_emitter(op_amd64_mov_imm, emit_amd64_mov_imm);
+	be_set_emitter(op_amd64_mov_store, emit_amd64_mov_store);
+	be_set_emitter(op_amd64_movd_gp_xmm, emit_amd64_movd_gp_xmm);
+	be_set_emitter(op_amd64_movd_xmm_gp, emit_amd64_movd_xmm_gp);
+	be_set_emitter(op_amd64_movdqa, emit_amd64_movdqa);
+	be_set_emitter(op_amd64_movdqu, emit_amd64_movdqu);
+	be_set_emitter(op_amd64_movdqu_store, emit_amd64_movdqu_store);
+	be_set_emitter(op_amd64_movq, emit_amd64_movq);
+	be_set_emitter(op_amd64_movs, emit_amd64_movs);
+	be_set_emitter(op_amd64_movs_store_xmm, emit_amd64_movs_store_xmm);
+	be_set_emitter(op_amd64_movs_xmm, emit_amd64_movs_xmm);
+	be_set_emitter(op_amd64_mul, emit_amd64_mul);
+	be_set_emitter(op_amd64_mulpd, emit_amd64_mulpd);
+	be_set_emitter(op_amd64_mulps, emit_amd64_mulps);
+	be_set_emitter(op_amd64_muls, emit_amd64_muls);
+	be_set_emitter(op_amd64_neg, emit_amd64_neg);
+	be_set_emitter(op_amd64_not, emit_amd64_not);
+	be_set_emitter(op_amd64_or, emit_amd64_or);
+	be_set_emitter(op_amd64_paddb, emit_amd64_paddb);
+	be_set_emitter(op_amd64_paddd, emit_amd64_paddd);
+	be_set_emitter(op_amd64_paddq, emit_amd64_paddq);
+	be_set_emitter(op_amd64_paddw, emit_amd64_paddw);
+	be_set_emitter(op_amd64_pand, emit_amd64_pand);
+	be_set_emitter(op_amd64_pop_am, emit_amd64_pop_am);
+	be_set_emitter(op_amd64_por, emit_amd64_por);
+	be_set_emitter(op_amd64_pshufd_0, emit_amd64_pshufd_0);
+	be_set_emitter(op_amd64_psubb, emit_amd64_psubb);
+	be_set_emitter(op_amd64_psubd, emit_amd64_psubd);
+	be_set_emitter(op_amd64_psubq, emit_amd64_psubq);
+	be_set_emitter(op_amd64_psubw, emit_amd64_psubw);
+	be_set_emitter(op_amd64_punpcklbw, emit_amd64_punpcklbw);
+	be_set_emitter(op_amd64_punpckldq, emit_amd64_punpckldq);
+	be_set_emitter(op_amd64_punpcklqdq, emit_amd64_punpcklqdq);
+	be_set_emitter(op_amd64_punpcklwd, emit_amd64_punpcklwd);
+	be_set_emitter(op_amd64_push_am, emit_amd64_push_am);
+	be_set_emitter(op_amd64_push_reg, emit_amd64_push_reg);
+	be_set_emitter(op_amd64_pxor, emit_amd64_pxor);
+	be_set_emitter(op_amd64_ret, emit_amd64_ret);
+	be_set_emitter(op_amd64_sar, emit_amd64_sar);
+	be_set_emitter(op_amd64_sbb, emit_amd64_sbb);
+	be_set_emitter(op_amd64_shl, emit_amd64_shl);
+	be_set_emitter(op_amd64_shr, emit_amd64_shr);
+	be_set_emitter(op_amd64_shufps_0, emit_amd64_shufps_0);
+	be_set_emitter(op_amd64_start, be_emit_nothing);
+	be_set_emitter(op_amd64_sub, emit_amd64_sub);
+	be_set_emitter(op_amd64_sub_sp, emit_amd64_sub_sp);
+	be_set_emitter(op_amd64_subpd, emit_amd64_subpd);
+	be_set_emitter(op_amd64_subps, emit_amd64_subps);
+	be_set_emitter(op_amd64_subs, emit_amd64_subs);
+	be_set_emitter(op_amd64_ucomis, emit_amd64_ucomis);
+	be_set_emitter(op_amd64_unpcklpd, emit_amd64_unpcklpd);
+	be_set_emitter(op_amd64_xor, emit_amd64_xor);
+	be_set_emitter(op_amd64_xor_0, emit_amd64_xor_0);
+	be_set_emitter(op_amd64_xorp, emit_amd64_xorp);
+	be_set_emitter(op_amd64_xorpd_0, emit_amd64_xorpd_0);
+
+}
+
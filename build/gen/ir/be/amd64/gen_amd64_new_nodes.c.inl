@@ -0,0 +1,3812 @@
+#include "gen_amd64_regalloc_if.h"
+#include "fourcc.h"
+#include "irgopt.h"
+
+ir_op *op_amd64_add = NULL;
+ir_op *op_amd64_addpd = NULL;
+ir_op *op_amd64_addps = NULL;
+ir_op *op_amd64_adds = NULL;
+ir_op *op_amd64_and = NULL;
+ir_op *op_amd64_call = NULL;
+ir_op *op_amd64_cmp = NULL;
+ir_op *op_amd64_cvtsd2ss = NULL;
+ir_op *op_amd64_cvtsi2sd = NULL;
+ir_op *op_amd64_cvtsi2ss = NULL;
+ir_op *op_amd64_cvtss2sd = NULL;
+ir_op *op_amd64_cvttsd2si = NULL;
+ir_op *op_amd64_cvttss2si = NULL;
+ir_op *op_amd64_div = NULL;
+ir_op *op_amd64_divs = NULL;
+ir_op *op_amd64_haddpd = NULL;
+ir_op *op_amd64_idiv = NULL;
+ir_op *op_amd64_ijmp = NULL;
+ir_op *op_amd64_imul = NULL;
+ir_op *op_amd64_imul_1op = NULL;
+ir_op *op_amd64_jcc = NULL;
+ir_op *op_amd64_jmp = NULL;
+ir_op *op_amd64_jmp_switch = NULL;
+ir_op *op_amd64_l_haddpd = NULL;
+ir_op *op_amd64_l_punpckldq = NULL;
+ir_op *op_amd64_l_subpd = NULL;
+ir_op *op_amd64_lea = NULL;
+ir_op *op_amd64_leave = NULL;
+ir_op *op_amd64_mov_gp = NULL;
+ir_op *op_amd64_mov_imm = NULL;
+ir_op *op_amd64_mov_store = NULL;
+ir_op *op_amd64_movd_gp_xmm = NULL;
+ir_op *op_amd64_movd_xmm_gp = NULL;
+ir_op *op_amd64_movdqa = NULL;
+ir_op *op_amd64_movdqu = NULL;
+ir_op *op_amd64_movdqu_store = NULL;
+ir_op *op_amd64_movq = NULL;
+ir_op *op_amd64_movs = NULL;
+ir_op *op_amd64_movs_store_xmm = NULL;
+ir_op *op_amd64_movs_xmm = NULL;
+ir_op *op_amd64_mul = NULL;
+ir_op *op_amd64_mulpd = NULL;
+ir_op *op_amd64_mulps = NULL;
+ir_op *op_amd64_muls = NULL;
+ir_op *op_amd64_neg = NULL;
+ir_op *op_amd64_not = NULL;
+ir_op *op_amd64_or = NULL;
+ir_op *op_amd64_paddb = NULL;
+ir_op *op_amd64_paddd = NULL;
+ir_op *op_amd64_paddq = NULL;
+ir_op *op_amd64_paddw = NULL;
+ir_op *op_amd64_pand = NULL;
+ir_op *op_amd64_pop_am = NULL;
+ir_op *op_amd64_por = NULL;
+ir_op *op_amd64_pshufd_0 = NULL;
+ir_op *op_amd64_psubb = NULL;
+ir_op *op_amd64_psubd = NULL;
+ir_op *op_amd64_psubq = NULL;
+ir_op *op_amd64_psubw = NULL;
+ir_op *op_amd64_punpcklbw = NULL;
+ir_op *op_amd64_punpckldq = NULL;
+ir_op *op_amd64_punpcklqdq = NULL;
+ir_op *op_amd64_punpcklwd = NULL;
+ir_op *op_amd64_push_am = NULL;
+ir_op *op_amd64_push_reg = NULL;
+ir_op *op_amd64_pxor = NULL;
+ir_op *op_amd64_ret = NULL;
+ir_op *op_amd64_sar = NULL;
+ir_op *op_amd64_sbb = NULL;
+ir_op *op_amd64_shl = NULL;
+ir_op *op_amd64_shr = NULL;
+ir_op *op_amd64_shufps_0 = NULL;
+ir_op *op_amd64_start = NULL;
+ir_op *op_amd64_sub = NULL;
+ir_op *op_amd64_sub_sp = NULL;
+ir_op *op_amd64_subpd = NULL;
+ir_op *op_amd64_subps = NULL;
+ir_op *op_amd64_subs = NULL;
+ir_op *op_amd64_ucomis = NULL;
+ir_op *op_amd64_unpcklpd = NULL;
+ir_op *op_amd64_xor = NULL;
+ir_op *op_amd64_xor_0 = NULL;
+ir_op *op_amd64_xorp = NULL;
+ir_op *op_amd64_xorpd_0 = NULL;
+
+
+static int amd64_opcode_start = -1;
+
+
+/** A tag for the amd64 opcodes. */
+#define amd64_op_tag FOURCC('A', 'M', 'D', '6')
+
+/** Return 1 if the given opcode is a amd64 machine op, 0 otherwise */
+int is_amd64_op(const ir_op *op)
+{
+	return get_op_tag(op) == amd64_op_tag;
+}
+
+/** Return 1 if the given node is a amd64 machine node, 0 otherwise */
+int is_amd64_irn(const ir_node *node)
+{
+	return is_amd64_op(get_irn_op(node));
+}
+
+int get_amd64_irn_opcode(const ir_node *node)
+{
+	assert(is_amd64_irn(node));
+	return get_irn_opcode(node) - amd64_opcode_start;
+}
+
+#ifdef BIT
+#undef BIT
+#endif
+#define BIT(x)  (1 << (x))
+
+static const unsigned amd64_limit_gp_rax[] = { BIT(REG_GP_RAX), 0 };
+static const unsigned amd64_limit_gp_rdx[] = { BIT(REG_GP_RDX), 0 };
+static const unsigned amd64_limit_flags_eflags[] = { BIT(REG_FLAGS_EFLAGS) };
+static const unsigned amd64_limit_gp_rbp[] = { BIT(REG_GP_RBP), 0 };
+static const unsigned amd64_limit_gp_rsp[] = { BIT(REG_GP_RSP), 0 };
+
+static const arch_register_req_t amd64_requirements_gp_gp = {
+	.cls   = &amd64_reg_classes[CLASS_amd64_gp],
+	.width = 1,
+};
+
+
+static const arch_register_req_t amd64_requirements_flags_flags = {
+	.cls   = &amd64_reg_classes[CLASS_amd64_flags],
+	.width = 1,
+};
+
+
+static const arch_register_req_t amd64_requirements_xmm_xmm = {
+	.cls   = &amd64_reg_classes[CLASS_amd64_xmm],
+	.width = 1,
+};
+
+
+static const arch_register_req_t amd64_requirements_gp_rax = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_gp],
+	.limited           = amd64_limit_gp_rax,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t amd64_requirements_gp_rdx = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_gp],
+	.limited           = amd64_limit_gp_rdx,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t amd64_requirements_flags_eflags = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_flags],
+	.limited           = amd64_limit_flags_eflags,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t amd64_requirements_gp_rbp = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_gp],
+	.limited           = amd64_limit_gp_rbp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t amd64_requirements_gp_rbp_I = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_gp],
+	.limited           = amd64_limit_gp_rbp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+	.ignore  = true,
+};
+
+
+static const arch_register_req_t amd64_requirements_gp_rsp_I = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_gp],
+	.limited           = amd64_limit_gp_rsp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+	.ignore  = true,
+};
+
+
+static const arch_register_req_t amd64_requirements_gp_in_r1 = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_gp],
+	.limited           = NULL,
+	.should_be_same    = 1,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t amd64_requirements_gp_rsp = {
+	.cls               = &amd64_reg_classes[CLASS_amd64_gp],
+	.limited           = amd64_limit_gp_rsp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+
+/**
+ * construct add node
+ */
+ir_node *new_bd_amd64_add(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_add;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct addpd node
+ */
+ir_node *new_bd_amd64_addpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_addpd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct addps node
+ */
+ir_node *new_bd_amd64_addps(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_addps;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct adds node
+ */
+ir_node *new_bd_amd64_adds(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_adds;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct and node
+ */
+ir_node *new_bd_amd64_and(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_and;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct call node
+ */
+ir_node *new_bd_amd64_call(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], int n_res, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_call;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_insn_mode_t insn_mode = INSN_MODE_64;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct cmp node
+ */
+ir_node *new_bd_amd64_cmp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_cmp;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct cvtsd2ss node
+ */
+ir_node *new_bd_amd64_cvtsd2ss(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_cvtsd2ss;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_insn_mode_t insn_mode = INSN_MODE_64;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct cvtsi2sd node
+ */
+ir_node *new_bd_amd64_cvtsi2sd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_cvtsi2sd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct cvtsi2ss node
+ */
+ir_node *new_bd_amd64_cvtsi2ss(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_cvtsi2ss;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct cvtss2sd node
+ */
+ir_node *new_bd_amd64_cvtss2sd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_cvtss2sd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct cvttsd2si node
+ */
+ir_node *new_bd_amd64_cvttsd2si(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_cvttsd2si;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct cvttss2si node
+ */
+ir_node *new_bd_amd64_cvttss2si(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_cvttss2si;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct div node
+ */
+ir_node *new_bd_amd64_div(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 4;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_div;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_addr_t addr = { { NULL, 0 }, NO_INPUT, NO_INPUT, NO_INPUT, 0, AMD64_SEGMENT_DEFAULT };
+amd64_op_mode_t op_mode = AMD64_OP_RAX_REG;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_rax;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &amd64_requirements_gp_rdx;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct divs node
+ */
+ir_node *new_bd_amd64_divs(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_divs;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct haddpd node
+ */
+ir_node *new_bd_amd64_haddpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_haddpd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct idiv node
+ */
+ir_node *new_bd_amd64_idiv(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 4;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_idiv;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_addr_t addr = { { NULL, 0 }, NO_INPUT, NO_INPUT, NO_INPUT, 0, AMD64_SEGMENT_DEFAULT };
+amd64_op_mode_t op_mode = AMD64_OP_RAX_REG;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_rax;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &amd64_requirements_gp_rdx;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ijmp node
+ */
+ir_node *new_bd_amd64_ijmp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_ijmp;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct imul node
+ */
+ir_node *new_bd_amd64_imul(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_imul;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct imul_1op node
+ */
+ir_node *new_bd_amd64_imul_1op(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 4;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_imul_1op;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_rax;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &amd64_requirements_gp_rdx;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct jcc node
+ */
+ir_node *new_bd_amd64_jcc(dbg_info *dbgi, ir_node *block, ir_node *eflags, x86_condition_code_t cc)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& amd64_requirements_flags_eflags,
+	};
+
+	/* construct in array */
+	in[0] = eflags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_jcc;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_cc_attr_t *attr = (amd64_cc_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_NONE;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	init_amd64_cc_attributes(res, cc);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct jmp node
+ */
+ir_node *new_bd_amd64_jmp(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_jmp;
+	ir_mode  *mode = mode_X;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_attr_t *attr = (amd64_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_IMM32;
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct jmp_switch node
+ */
+ir_node *new_bd_amd64_jmp_switch(dbg_info *dbgi, ir_node *block, ir_node *op0, int n_res, const ir_switch_table *table, ir_entity *table_entity)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& amd64_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_jmp_switch;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_switch_jmp_attr_t *attr = (amd64_switch_jmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_NONE;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	init_amd64_switch_attributes(res, table, table_entity);
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_haddpd node
+ */
+ir_node *new_bd_amd64_l_haddpd(dbg_info *dbgi, ir_node *block, ir_node *arg0, ir_node *arg1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = arg0;
+	in[1] = arg1;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_l_haddpd;
+	ir_mode  *mode = amd64_mode_xmm;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_punpckldq node
+ */
+ir_node *new_bd_amd64_l_punpckldq(dbg_info *dbgi, ir_node *block, ir_node *arg0, ir_node *arg1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = arg0;
+	in[1] = arg1;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_l_punpckldq;
+	ir_mode  *mode = amd64_mode_xmm;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_subpd node
+ */
+ir_node *new_bd_amd64_l_subpd(dbg_info *dbgi, ir_node *block, ir_node *arg0, ir_node *arg1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = arg0;
+	in[1] = arg1;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_l_subpd;
+	ir_mode  *mode = amd64_mode_xmm;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct lea node
+ */
+ir_node *new_bd_amd64_lea(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_lea;
+	ir_mode  *mode = mode_Lu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_ADDR;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct leave node
+ */
+ir_node *new_bd_amd64_leave(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& amd64_requirements_gp_rbp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_leave;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_attr_t *attr = (amd64_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_NONE;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_rbp_I;
+	out_infos[1].req = &amd64_requirements_gp_rsp_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct mov_gp node
+ */
+ir_node *new_bd_amd64_mov_gp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_mov_gp;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct mov_imm node
+ */
+ir_node *new_bd_amd64_mov_imm(dbg_info *dbgi, ir_node *block, amd64_insn_mode_t insn_mode, int64_t offset, ir_entity *entity)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_mov_imm;
+	ir_mode  *mode = mode_Lu;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_movimm_attr_t *attr = (amd64_movimm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_IMM64;
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	init_amd64_movimm_attributes(res, insn_mode, entity, offset);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct mov_store node
+ */
+ir_node *new_bd_amd64_mov_store(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_mov_store;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct movd_gp_xmm node
+ */
+ir_node *new_bd_amd64_movd_gp_xmm(dbg_info *dbgi, ir_node *block, ir_node *operand, amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& amd64_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = operand;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_movd_gp_xmm;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct movd_xmm_gp node
+ */
+ir_node *new_bd_amd64_movd_xmm_gp(dbg_info *dbgi, ir_node *block, ir_node *operand, amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& amd64_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = operand;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_movd_xmm_gp;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct movdqa node
+ */
+ir_node *new_bd_amd64_movdqa(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_movdqa;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_insn_mode_t insn_mode = INSN_MODE_128;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct movdqu node
+ */
+ir_node *new_bd_amd64_movdqu(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_movdqu;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_insn_mode_t insn_mode = INSN_MODE_128;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct movdqu_store node
+ */
+ir_node *new_bd_amd64_movdqu_store(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_movdqu_store;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct movq node
+ */
+ir_node *new_bd_amd64_movq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_movq;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_insn_mode_t insn_mode = INSN_MODE_64;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct movs node
+ */
+ir_node *new_bd_amd64_movs(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_movs;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct movs_store_xmm node
+ */
+ir_node *new_bd_amd64_movs_store_xmm(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_movs_store_xmm;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct movs_xmm node
+ */
+ir_node *new_bd_amd64_movs_xmm(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_movs_xmm;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct mul node
+ */
+ir_node *new_bd_amd64_mul(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 4;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_mul;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_rax;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &amd64_requirements_gp_rdx;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct mulpd node
+ */
+ir_node *new_bd_amd64_mulpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_mulpd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct mulps node
+ */
+ir_node *new_bd_amd64_mulps(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_mulps;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct muls node
+ */
+ir_node *new_bd_amd64_muls(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_muls;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct neg node
+ */
+ir_node *new_bd_amd64_neg(dbg_info *dbgi, ir_node *block, ir_node *val, amd64_insn_mode_t insn_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& amd64_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_neg;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_UNOP_REG;
+amd64_addr_t addr = { { NULL, 0 }, NO_INPUT, NO_INPUT, NO_INPUT, 0, AMD64_SEGMENT_DEFAULT };
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_in_r1;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct not node
+ */
+ir_node *new_bd_amd64_not(dbg_info *dbgi, ir_node *block, ir_node *val, amd64_insn_mode_t insn_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& amd64_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_not;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_UNOP_REG;
+amd64_addr_t addr = { { NULL, 0 }, NO_INPUT, NO_INPUT, NO_INPUT, 0, AMD64_SEGMENT_DEFAULT };
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_in_r1;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct or node
+ */
+ir_node *new_bd_amd64_or(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_or;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct paddb node
+ */
+ir_node *new_bd_amd64_paddb(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_paddb;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct paddd node
+ */
+ir_node *new_bd_amd64_paddd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_paddd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct paddq node
+ */
+ir_node *new_bd_amd64_paddq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_paddq;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct paddw node
+ */
+ir_node *new_bd_amd64_paddw(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_paddw;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct pand node
+ */
+ir_node *new_bd_amd64_pand(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_pand;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct pop_am node
+ */
+ir_node *new_bd_amd64_pop_am(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_pop_am;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_ADDR;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_rsp_I;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct por node
+ */
+ir_node *new_bd_amd64_por(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_por;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct pshufd_0 node
+ */
+ir_node *new_bd_amd64_pshufd_0(dbg_info *dbgi, ir_node *block, ir_node *operand, amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& amd64_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = operand;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_pshufd_0;
+	ir_mode  *mode = amd64_mode_xmm;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct psubb node
+ */
+ir_node *new_bd_amd64_psubb(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_psubb;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct psubd node
+ */
+ir_node *new_bd_amd64_psubd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_psubd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct psubq node
+ */
+ir_node *new_bd_amd64_psubq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_psubq;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct psubw node
+ */
+ir_node *new_bd_amd64_psubw(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_psubw;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct punpcklbw node
+ */
+ir_node *new_bd_amd64_punpcklbw(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_punpcklbw;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct punpckldq node
+ */
+ir_node *new_bd_amd64_punpckldq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_punpckldq;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct punpcklqdq node
+ */
+ir_node *new_bd_amd64_punpcklqdq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_punpcklqdq;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct punpcklwd node
+ */
+ir_node *new_bd_amd64_punpcklwd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_punpcklwd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct push_am node
+ */
+ir_node *new_bd_amd64_push_am(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_addr_t addr)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_push_am;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_addr_attr_t *attr = (amd64_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_ADDR;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	attr->insn_mode = insn_mode;
+	attr->addr = addr;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_rsp_I;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct push_reg node
+ */
+ir_node *new_bd_amd64_push_reg(dbg_info *dbgi, ir_node *block, ir_node *stack, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& amd64_requirements_gp_rsp,
+		& amd64_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = stack;
+	in[1] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_push_reg;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_attr_t *attr = (amd64_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_NONE;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_rsp_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct pxor node
+ */
+ir_node *new_bd_amd64_pxor(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_pxor;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ret node
+ */
+ir_node *new_bd_amd64_ret(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[])
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_ret;
+	ir_mode  *mode = mode_X;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_attr_t *attr = (amd64_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_NONE;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct sar node
+ */
+ir_node *new_bd_amd64_sar(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_shift_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_sar;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_shift_attr_t *attr = (amd64_shift_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct sbb node
+ */
+ir_node *new_bd_amd64_sbb(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_sbb;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct shl node
+ */
+ir_node *new_bd_amd64_shl(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_shift_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_shl;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_shift_attr_t *attr = (amd64_shift_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct shr node
+ */
+ir_node *new_bd_amd64_shr(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_shift_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_shr;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_shift_attr_t *attr = (amd64_shift_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct shufps_0 node
+ */
+ir_node *new_bd_amd64_shufps_0(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_shufps_0;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct start node
+ */
+ir_node *new_bd_amd64_start(dbg_info *dbgi, ir_node *block, int n_res)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_schedule_first;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_start;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_attr_t *attr = (amd64_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_NONE;
+
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct sub node
+ */
+ir_node *new_bd_amd64_sub(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_sub;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct sub_sp node
+ */
+ir_node *new_bd_amd64_sub_sp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_sub_sp;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_rsp_I;
+	out_infos[1].req = &amd64_requirements_gp_gp;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct subpd node
+ */
+ir_node *new_bd_amd64_subpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_subpd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct subps node
+ */
+ir_node *new_bd_amd64_subps(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_subps;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct subs node
+ */
+ir_node *new_bd_amd64_subs(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_subs;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ucomis node
+ */
+ir_node *new_bd_amd64_ucomis(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_ucomis;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct unpcklpd node
+ */
+ir_node *new_bd_amd64_unpcklpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_unpcklpd;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xor node
+ */
+ir_node *new_bd_amd64_xor(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_xor;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xor_0 node
+ */
+ir_node *new_bd_amd64_xor_0(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_xor_0;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_attr_t *attr = (amd64_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_REG_REG;
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_gp_gp;
+	out_infos[1].req = &amd64_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xorp node
+ */
+ir_node *new_bd_amd64_xorp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 3;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= (arch_irn_flags_t)amd64_arch_irn_flag_commutative_binop;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_xorp;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_binop_addr_attr_t *attr = (amd64_binop_addr_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	be_info_init_irn(res, irn_flags_, in_reqs, n_res);
+	*attr = *attr_init;
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xorpd_0 node
+ */
+ir_node *new_bd_amd64_xorpd_0(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_amd64_xorpd_0;
+	ir_mode  *mode = amd64_mode_xmm;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	amd64_attr_t *attr = (amd64_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	amd64_op_mode_t op_mode = AMD64_OP_REG_REG;
+	init_amd64_attributes(res, irn_flags_, in_reqs, n_res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &amd64_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+
+
+/**
+ * Creates the amd64 specific Firm machine operations
+ * needed for the assembler irgs.
+ */
+void amd64_create_opcodes(void)
+{
+	ir_op *op;
+	int    cur_opcode = get_next_ir_opcodes(iro_amd64_last);
+
+	amd64_opcode_start = cur_opcode;
+	op = new_ir_op(cur_opcode + iro_amd64_add, "amd64_add", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_add = op;
+	op = new_ir_op(cur_opcode + iro_amd64_addpd, "amd64_addpd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_addpd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_addps, "amd64_addps", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_addps = op;
+	op = new_ir_op(cur_opcode + iro_amd64_adds, "amd64_adds", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_adds = op;
+	op = new_ir_op(cur_opcode + iro_amd64_and, "amd64_and", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_and = op;
+	op = new_ir_op(cur_opcode + iro_amd64_call, "amd64_call", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_call = op;
+	op = new_ir_op(cur_opcode + iro_amd64_cmp, "amd64_cmp", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_cmp = op;
+	op = new_ir_op(cur_opcode + iro_amd64_cvtsd2ss, "amd64_cvtsd2ss", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_cvtsd2ss = op;
+	op = new_ir_op(cur_opcode + iro_amd64_cvtsi2sd, "amd64_cvtsi2sd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_cvtsi2sd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_cvtsi2ss, "amd64_cvtsi2ss", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_cvtsi2ss = op;
+	op = new_ir_op(cur_opcode + iro_amd64_cvtss2sd, "amd64_cvtss2sd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_cvtss2sd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_cvttsd2si, "amd64_cvttsd2si", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_cvttsd2si = op;
+	op = new_ir_op(cur_opcode + iro_amd64_cvttss2si, "amd64_cvttss2si", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_cvttss2si = op;
+	op = new_ir_op(cur_opcode + iro_amd64_div, "amd64_div", op_pin_state_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_div = op;
+	op = new_ir_op(cur_opcode + iro_amd64_divs, "amd64_divs", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_divs = op;
+	op = new_ir_op(cur_opcode + iro_amd64_haddpd, "amd64_haddpd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_haddpd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_idiv, "amd64_idiv", op_pin_state_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_idiv = op;
+	op = new_ir_op(cur_opcode + iro_amd64_ijmp, "amd64_ijmp", op_pin_state_pinned, irop_flag_cfopcode|irop_flag_unknown_jump, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_ijmp = op;
+	op = new_ir_op(cur_opcode + iro_amd64_imul, "amd64_imul", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_imul = op;
+	op = new_ir_op(cur_opcode + iro_amd64_imul_1op, "amd64_imul_1op", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_imul_1op = op;
+	op = new_ir_op(cur_opcode + iro_amd64_jcc, "amd64_jcc", op_pin_state_pinned, irop_flag_cfopcode|irop_flag_forking, oparity_any, -1, sizeof(amd64_cc_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_cc_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_jcc = op;
+	op = new_ir_op(cur_opcode + iro_amd64_jmp, "amd64_jmp", op_pin_state_pinned, irop_flag_cfopcode, oparity_any, -1, sizeof(amd64_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_jmp = op;
+	op = new_ir_op(cur_opcode + iro_amd64_jmp_switch, "amd64_jmp_switch", op_pin_state_pinned, irop_flag_cfopcode|irop_flag_forking, oparity_any, -1, sizeof(amd64_switch_jmp_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_switch_jmp_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_jmp_switch = op;
+	op = new_ir_op(cur_opcode + iro_amd64_l_haddpd, "amd64_l_haddpd", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_l_haddpd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_l_punpckldq, "amd64_l_punpckldq", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_l_punpckldq = op;
+	op = new_ir_op(cur_opcode + iro_amd64_l_subpd, "amd64_l_subpd", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_l_subpd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_lea, "amd64_lea", op_pin_state_floats, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_lea = op;
+	op = new_ir_op(cur_opcode + iro_amd64_leave, "amd64_leave", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(amd64_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_leave = op;
+	op = new_ir_op(cur_opcode + iro_amd64_mov_gp, "amd64_mov_gp", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_mov_gp = op;
+	op = new_ir_op(cur_opcode + iro_amd64_mov_imm, "amd64_mov_imm", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(amd64_movimm_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_movimm_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_mov_imm = op;
+	op = new_ir_op(cur_opcode + iro_amd64_mov_store, "amd64_mov_store", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_mov_store = op;
+	op = new_ir_op(cur_opcode + iro_amd64_movd_gp_xmm, "amd64_movd_gp_xmm", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_movd_gp_xmm = op;
+	op = new_ir_op(cur_opcode + iro_amd64_movd_xmm_gp, "amd64_movd_xmm_gp", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_movd_xmm_gp = op;
+	op = new_ir_op(cur_opcode + iro_amd64_movdqa, "amd64_movdqa", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_movdqa = op;
+	op = new_ir_op(cur_opcode + iro_amd64_movdqu, "amd64_movdqu", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_movdqu = op;
+	op = new_ir_op(cur_opcode + iro_amd64_movdqu_store, "amd64_movdqu_store", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_movdqu_store = op;
+	op = new_ir_op(cur_opcode + iro_amd64_movq, "amd64_movq", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_movq = op;
+	op = new_ir_op(cur_opcode + iro_amd64_movs, "amd64_movs", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_movs = op;
+	op = new_ir_op(cur_opcode + iro_amd64_movs_store_xmm, "amd64_movs_store_xmm", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_movs_store_xmm = op;
+	op = new_ir_op(cur_opcode + iro_amd64_movs_xmm, "amd64_movs_xmm", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_movs_xmm = op;
+	op = new_ir_op(cur_opcode + iro_amd64_mul, "amd64_mul", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_mul = op;
+	op = new_ir_op(cur_opcode + iro_amd64_mulpd, "amd64_mulpd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_mulpd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_mulps, "amd64_mulps", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_mulps = op;
+	op = new_ir_op(cur_opcode + iro_amd64_muls, "amd64_muls", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_muls = op;
+	op = new_ir_op(cur_opcode + iro_amd64_neg, "amd64_neg", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_neg = op;
+	op = new_ir_op(cur_opcode + iro_amd64_not, "amd64_not", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_not = op;
+	op = new_ir_op(cur_opcode + iro_amd64_or, "amd64_or", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_or = op;
+	op = new_ir_op(cur_opcode + iro_amd64_paddb, "amd64_paddb", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_paddb = op;
+	op = new_ir_op(cur_opcode + iro_amd64_paddd, "amd64_paddd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_paddd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_paddq, "amd64_paddq", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_paddq = op;
+	op = new_ir_op(cur_opcode + iro_amd64_paddw, "amd64_paddw", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_paddw = op;
+	op = new_ir_op(cur_opcode + iro_amd64_pand, "amd64_pand", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_pand = op;
+	op = new_ir_op(cur_opcode + iro_amd64_pop_am, "amd64_pop_am", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_pop_am = op;
+	op = new_ir_op(cur_opcode + iro_amd64_por, "amd64_por", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_por = op;
+	op = new_ir_op(cur_opcode + iro_amd64_pshufd_0, "amd64_pshufd_0", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_pshufd_0 = op;
+	op = new_ir_op(cur_opcode + iro_amd64_psubb, "amd64_psubb", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_psubb = op;
+	op = new_ir_op(cur_opcode + iro_amd64_psubd, "amd64_psubd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_psubd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_psubq, "amd64_psubq", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_psubq = op;
+	op = new_ir_op(cur_opcode + iro_amd64_psubw, "amd64_psubw", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_psubw = op;
+	op = new_ir_op(cur_opcode + iro_amd64_punpcklbw, "amd64_punpcklbw", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_punpcklbw = op;
+	op = new_ir_op(cur_opcode + iro_amd64_punpckldq, "amd64_punpckldq", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_punpckldq = op;
+	op = new_ir_op(cur_opcode + iro_amd64_punpcklqdq, "amd64_punpcklqdq", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_punpcklqdq = op;
+	op = new_ir_op(cur_opcode + iro_amd64_punpcklwd, "amd64_punpcklwd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_punpcklwd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_push_am, "amd64_push_am", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_variable, -1, sizeof(amd64_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_push_am = op;
+	op = new_ir_op(cur_opcode + iro_amd64_push_reg, "amd64_push_reg", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(amd64_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_push_reg = op;
+	op = new_ir_op(cur_opcode + iro_amd64_pxor, "amd64_pxor", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_pxor = op;
+	op = new_ir_op(cur_opcode + iro_amd64_ret, "amd64_ret", op_pin_state_pinned, irop_flag_cfopcode, oparity_variable, -1, sizeof(amd64_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_ret = op;
+	op = new_ir_op(cur_opcode + iro_amd64_sar, "amd64_sar", op_pin_state_floats, irop_flag_none, oparity_variable, -1, sizeof(amd64_shift_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_shift_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_sar = op;
+	op = new_ir_op(cur_opcode + iro_amd64_sbb, "amd64_sbb", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_sbb = op;
+	op = new_ir_op(cur_opcode + iro_amd64_shl, "amd64_shl", op_pin_state_floats, irop_flag_none, oparity_variable, -1, sizeof(amd64_shift_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_shift_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_shl = op;
+	op = new_ir_op(cur_opcode + iro_amd64_shr, "amd64_shr", op_pin_state_floats, irop_flag_none, oparity_variable, -1, sizeof(amd64_shift_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_shift_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_shr = op;
+	op = new_ir_op(cur_opcode + iro_amd64_shufps_0, "amd64_shufps_0", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_shufps_0 = op;
+	op = new_ir_op(cur_opcode + iro_amd64_start, "amd64_start", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(amd64_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_start = op;
+	op = new_ir_op(cur_opcode + iro_amd64_sub, "amd64_sub", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_sub = op;
+	op = new_ir_op(cur_opcode + iro_amd64_sub_sp, "amd64_sub_sp", op_pin_state_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_sub_sp = op;
+	op = new_ir_op(cur_opcode + iro_amd64_subpd, "amd64_subpd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_subpd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_subps, "amd64_subps", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_subps = op;
+	op = new_ir_op(cur_opcode + iro_amd64_subs, "amd64_subs", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_subs = op;
+	op = new_ir_op(cur_opcode + iro_amd64_ucomis, "amd64_ucomis", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_ucomis = op;
+	op = new_ir_op(cur_opcode + iro_amd64_unpcklpd, "amd64_unpcklpd", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_unpcklpd = op;
+	op = new_ir_op(cur_opcode + iro_amd64_xor, "amd64_xor", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_xor = op;
+	op = new_ir_op(cur_opcode + iro_amd64_xor_0, "amd64_xor_0", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(amd64_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_xor_0 = op;
+	op = new_ir_op(cur_opcode + iro_amd64_xorp, "amd64_xorp", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(amd64_binop_addr_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_binop_addr_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_xorp = op;
+	op = new_ir_op(cur_opcode + iro_amd64_xorpd_0, "amd64_xorpd_0", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(amd64_attr_t));
+	set_op_dump(op, amd64_dump_node);
+	set_op_attrs_equal(op, amd64_attrs_equal);
+	set_op_copy_attr(op, amd64_copy_attr);
+	set_op_tag(op, amd64_op_tag);
+	op_amd64_xorpd_0 = op;
+
+}
+
+void amd64_free_opcodes(void)
+{
+	free_ir_op(op_amd64_add); op_amd64_add = NULL;
+	free_ir_op(op_amd64_addpd); op_amd64_addpd = NULL;
+	free_ir_op(op_amd64_addps); op_amd64_addps = NULL;
+	free_ir_op(op_amd64_adds); op_amd64_adds = NULL;
+	free_ir_op(op_amd64_and); op_amd64_and = NULL;
+	free_ir_op(op_amd64_call); op_amd64_call = NULL;
+	free_ir_op(op_amd64_cmp); op_amd64_cmp = NULL;
+	free_ir_op(op_amd64_cvtsd2ss); op_amd64_cvtsd2ss = NULL;
+	free_ir_op(op_amd64_cvtsi2sd); op_amd64_cvtsi2sd = NULL;
+	free_ir_op(op_amd64_cvtsi2ss); op_amd64_cvtsi2ss = NULL;
+	free_ir_op(op_amd64_cvtss2sd); op_amd64_cvtss2sd = NULL;
+	free_ir_op(op_amd64_cvttsd2si); op_amd64_cvttsd2si = NULL;
+	free_ir_op(op_amd64_cvttss2si); op_amd64_cvttss2si = NULL;
+	free_ir_op(op_amd64_div); op_amd64_div = NULL;
+	free_ir_op(op_amd64_divs); op_amd64_divs = NULL;
+	free_ir_op(op_amd64_haddpd); op_amd64_haddpd = NULL;
+	free_ir_op(op_amd64_idiv); op_amd64_idiv = NULL;
+	free_ir_op(op_amd64_ijmp); op_amd64_ijmp = NULL;
+	free_ir_op(op_amd64_imul); op_amd64_imul = NULL;
+	free_ir_op(op_amd64_imul_1op); op_amd64_imul_1op = NULL;
+	free_ir_op(op_amd64_jcc); op_amd64_jcc = NULL;
+	free_ir_op(op_amd64_jmp); op_amd64_jmp = NULL;
+	free_ir_op(op_amd64_jmp_switch); op_amd64_jmp_switch = NULL;
+	free_ir_op(op_amd64_l_haddpd); op_amd64_l_haddpd = NULL;
+	free_ir_op(op_amd64_l_punpckldq); op_amd64_l_punpckldq = NULL;
+	free_ir_op(op_amd64_l_subpd); op_amd64_l_subpd = NULL;
+	free_ir_op(op_amd64_lea); op_amd64_lea = NULL;
+	free_ir_op(op_amd64_leave); op_amd64_leave = NULL;
+	free_ir_op(op_amd64_mov_gp); op_amd64_mov_gp = NULL;
+	free_ir_op(op_amd64_mov_imm); op_amd64_mov_imm = NULL;
+	free_ir_op(op_amd64_mov_store); op_amd64_mov_store = NULL;
+	free_ir_op(op_amd64_movd_gp_xmm); op_amd64_movd_gp_xmm = NULL;
+	free_ir_op(op_amd64_movd_xmm_gp); op_amd64_movd_xmm_gp = NULL;
+	free_ir_op(op_amd64_movdqa); op_amd64_movdqa = NULL;
+	free_ir_op(op_amd64_movdqu); op_amd64_movdqu = NULL;
+	free_ir_op(op_amd64_movdqu_store); op_amd64_movdqu_store = NULL;
+	free_ir_op(op_amd64_movq); op_amd64_movq = NULL;
+	free_ir_op(op_amd64_movs); op_amd64_movs = NULL;
+	free_ir_op(op_amd64_movs_store_xmm); op_amd64_movs_store_xmm = NULL;
+	free_ir_op(op_amd64_movs_xmm); op_amd64_movs_xmm = NULL;
+	free_ir_op(op_amd64_mul); op_amd64_mul = NULL;
+	free_ir_op(op_amd64_mulpd); op_amd64_mulpd = NULL;
+	free_ir_op(op_amd64_mulps); op_amd64_mulps = NULL;
+	free_ir_op(op_amd64_muls); op_amd64_muls = NULL;
+	free_ir_op(op_amd64_neg); op_amd64_neg = NULL;
+	free_ir_op(op_amd64_not); op_amd64_not = NULL;
+	free_ir_op(op_amd64_or); op_amd64_or = NULL;
+	free_ir_op(op_amd64_paddb); op_amd64_paddb = NULL;
+	free_ir_op(op_amd64_paddd); op_amd64_paddd = NULL;
+	free_ir_op(op_amd64_paddq); op_amd64_paddq = NULL;
+	free_ir_op(op_amd64_paddw); op_amd64_paddw = NULL;
+	free_ir_op(op_amd64_pand); op_amd64_pand = NULL;
+	free_ir_op(op_amd64_pop_am); op_amd64_pop_am = NULL;
+	free_ir_op(op_amd64_por); op_amd64_por = NULL;
+	free_ir_op(op_amd64_pshufd_0); op_amd64_pshufd_0 = NULL;
+	free_ir_op(op_amd64_psubb); op_amd64_psubb = NULL;
+	free_ir_op(op_amd64_psubd); op_amd64_psubd = NULL;
+	free_ir_op(op_amd64_psubq); op_amd64_psubq = NULL;
+	free_ir_op(op_amd64_psubw); op_amd64_psubw = NULL;
+	free_ir_op(op_amd64_punpcklbw); op_amd64_punpcklbw = NULL;
+	free_ir_op(op_amd64_punpckldq); op_amd64_punpckldq = NULL;
+	free_ir_op(op_amd64_punpcklqdq); op_amd64_punpcklqdq = NULL;
+	free_ir_op(op_amd64_punpcklwd); op_amd64_punpcklwd = NULL;
+	free_ir_op(op_amd64_push_am); op_amd64_push_am = NULL;
+	free_ir_op(op_amd64_push_reg); op_amd64_push_reg = NULL;
+	free_ir_op(op_amd64_pxor); op_amd64_pxor = NULL;
+	free_ir_op(op_amd64_ret); op_amd64_ret = NULL;
+	free_ir_op(op_amd64_sar); op_amd64_sar = NULL;
+	free_ir_op(op_amd64_sbb); op_amd64_sbb = NULL;
+	free_ir_op(op_amd64_shl); op_amd64_shl = NULL;
+	free_ir_op(op_amd64_shr); op_amd64_shr = NULL;
+	free_ir_op(op_amd64_shufps_0); op_amd64_shufps_0 = NULL;
+	free_ir_op(op_amd64_start); op_amd64_start = NULL;
+	free_ir_op(op_amd64_sub); op_amd64_sub = NULL;
+	free_ir_op(op_amd64_sub_sp); op_amd64_sub_sp = NULL;
+	free_ir_op(op_amd64_subpd); op_amd64_subpd = NULL;
+	free_ir_op(op_amd64_subps); op_amd64_subps = NULL;
+	free_ir_op(op_amd64_subs); op_amd64_subs = NULL;
+	free_ir_op(op_amd64_ucomis); op_amd64_ucomis = NULL;
+	free_ir_op(op_amd64_unpcklpd); op_amd64_unpcklpd = NULL;
+	free_ir_op(op_amd64_xor); op_amd64_xor = NULL;
+	free_ir_op(op_amd64_xor_0); op_amd64_xor_0 = NULL;
+	free_ir_op(op_amd64_xorp); op_amd64_xorp = NULL;
+	free_ir_op(op_amd64_xorpd_0); op_amd64_xorpd_0 = NULL;
+
+}
@@ -0,0 +1,1613 @@
+/**
+ * @file
+ * @brief Function prototypes for the new opcode functions.
+ * @note  DO NOT EDIT THIS FILE, your changes will be lost.
+ *        Edit ir/be/amd64/amd64_spec.pl instead.
+ *        created by: ./ir/be/scripts/generate_new_opcodes.pl ir/be/amd64/amd64_spec.pl build/gen/ir/be/amd64
+ * @date  Fri Oct 16 18:53:31 2026
+ */
+#ifndef FIRM_BE_AMD64_GEN_AMD64_NEW_NODES_H
+#define FIRM_BE_AMD64_GEN_AMD64_NEW_NODES_H
+
+typedef enum amd64_opcodes {
+	iro_amd64_add,
+	iro_amd64_addpd,
+	iro_amd64_addps,
+	iro_amd64_adds,
+	iro_amd64_and,
+	iro_amd64_call,
+	iro_amd64_cmp,
+	iro_amd64_cvtsd2ss,
+	iro_amd64_cvtsi2sd,
+	iro_amd64_cvtsi2ss,
+	iro_amd64_cvtss2sd,
+	iro_amd64_cvttsd2si,
+	iro_amd64_cvttss2si,
+	iro_amd64_div,
+	iro_amd64_divs,
+	iro_amd64_haddpd,
+	iro_amd64_idiv,
+	iro_amd64_ijmp,
+	iro_amd64_imul,
+	iro_amd64_imul_1op,
+	iro_amd64_jcc,
+	iro_amd64_jmp,
+	iro_amd64_jmp_switch,
+	iro_amd64_l_haddpd,
+	iro_amd64_l_punpckldq,
+	iro_amd64_l_subpd,
+	iro_amd64_lea,
+	iro_amd64_leave,
+	iro_amd64_mov_gp,
+	iro_amd64_mov_imm,
+	iro_amd64_mov_store,
+	iro_amd64_movd_gp_xmm,
+	iro_amd64_movd_xmm_gp,
+	iro_amd64_movdqa,
+	iro_amd64_movdqu,
+	iro_amd64_movdqu_store,
+	iro_amd64_movq,
+	iro_amd64_movs,
+	iro_amd64_movs_store_xmm,
+	iro_amd64_movs_xmm,
+	iro_amd64_mul,
+	iro_amd64_mulpd,
+	iro_amd64_mulps,
+	iro_amd64_muls,
+	iro_amd64_neg,
+	iro_amd64_not,
+	iro_amd64_or,
+	iro_amd64_paddb,
+	iro_amd64_paddd,
+	iro_amd64_paddq,
+	iro_amd64_paddw,
+	iro_amd64_pand,
+	iro_amd64_pop_am,
+	iro_amd64_por,
+	iro_amd64_pshufd_0,
+	iro_amd64_psubb,
+	iro_amd64_psubd,
+	iro_amd64_psubq,
+	iro_amd64_psubw,
+	iro_amd64_punpcklbw,
+	iro_amd64_punpckldq,
+	iro_amd64_punpcklqdq,
+	iro_amd64_punpcklwd,
+	iro_amd64_push_am,
+	iro_amd64_push_reg,
+	iro_amd64_pxor,
+	iro_amd64_ret,
+	iro_amd64_sar,
+	iro_amd64_sbb,
+	iro_amd64_shl,
+	iro_amd64_shr,
+	iro_amd64_shufps_0,
+	iro_amd64_start,
+	iro_amd64_sub,
+	iro_amd64_sub_sp,
+	iro_amd64_subpd,
+	iro_amd64_subps,
+	iro_amd64_subs,
+	iro_amd64_ucomis,
+	iro_amd64_unpcklpd,
+	iro_amd64_xor,
+	iro_amd64_xor_0,
+	iro_amd64_xorp,
+	iro_amd64_xorpd_0,
+	iro_amd64_last
+} amd64_opcodes;
+
+
+int is_amd64_irn(const ir_node *node);
+int is_amd64_op(const ir_op *op);
+
+int get_amd64_irn_opcode(const ir_node *node);
+void amd64_create_opcodes(void);
+void amd64_free_opcodes(void);
+extern ir_op *op_amd64_add;
+
+static inline bool is_amd64_add(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_add;
+}
+
+/**
+ * construct add node
+ */
+ir_node *new_bd_amd64_add(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_addpd;
+
+static inline bool is_amd64_addpd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_addpd;
+}
+
+/**
+ * construct addpd node
+ */
+ir_node *new_bd_amd64_addpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_addps;
+
+static inline bool is_amd64_addps(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_addps;
+}
+
+/**
+ * construct addps node
+ */
+ir_node *new_bd_amd64_addps(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_adds;
+
+static inline bool is_amd64_adds(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_adds;
+}
+
+/**
+ * construct adds node
+ */
+ir_node *new_bd_amd64_adds(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_and;
+
+static inline bool is_amd64_and(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_and;
+}
+
+/**
+ * construct and node
+ */
+ir_node *new_bd_amd64_and(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_call;
+
+static inline bool is_amd64_call(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_call;
+}
+
+/**
+ * construct call node
+ */
+ir_node *new_bd_amd64_call(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], int n_res, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_cmp;
+
+static inline bool is_amd64_cmp(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_cmp;
+}
+
+/**
+ * construct cmp node
+ */
+ir_node *new_bd_amd64_cmp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_cvtsd2ss;
+
+static inline bool is_amd64_cvtsd2ss(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_cvtsd2ss;
+}
+
+/**
+ * construct cvtsd2ss node
+ */
+ir_node *new_bd_amd64_cvtsd2ss(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_cvtsi2sd;
+
+static inline bool is_amd64_cvtsi2sd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_cvtsi2sd;
+}
+
+/**
+ * construct cvtsi2sd node
+ */
+ir_node *new_bd_amd64_cvtsi2sd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_cvtsi2ss;
+
+static inline bool is_amd64_cvtsi2ss(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_cvtsi2ss;
+}
+
+/**
+ * construct cvtsi2ss node
+ */
+ir_node *new_bd_amd64_cvtsi2ss(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_cvtss2sd;
+
+static inline bool is_amd64_cvtss2sd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_cvtss2sd;
+}
+
+/**
+ * construct cvtss2sd node
+ */
+ir_node *new_bd_amd64_cvtss2sd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_cvttsd2si;
+
+static inline bool is_amd64_cvttsd2si(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_cvttsd2si;
+}
+
+/**
+ * construct cvttsd2si node
+ */
+ir_node *new_bd_amd64_cvttsd2si(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_cvttss2si;
+
+static inline bool is_amd64_cvttss2si(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_cvttss2si;
+}
+
+/**
+ * construct cvttss2si node
+ */
+ir_node *new_bd_amd64_cvttss2si(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_div;
+
+static inline bool is_amd64_div(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_div;
+}
+
+/**
+ * construct div node
+ */
+ir_node *new_bd_amd64_div(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode);
+
+extern ir_op *op_amd64_divs;
+
+static inline bool is_amd64_divs(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_divs;
+}
+
+/**
+ * construct divs node
+ */
+ir_node *new_bd_amd64_divs(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_haddpd;
+
+static inline bool is_amd64_haddpd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_haddpd;
+}
+
+/**
+ * construct haddpd node
+ */
+ir_node *new_bd_amd64_haddpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_idiv;
+
+static inline bool is_amd64_idiv(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_idiv;
+}
+
+/**
+ * construct idiv node
+ */
+ir_node *new_bd_amd64_idiv(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode);
+
+extern ir_op *op_amd64_ijmp;
+
+static inline bool is_amd64_ijmp(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_ijmp;
+}
+
+/**
+ * construct ijmp node
+ */
+ir_node *new_bd_amd64_ijmp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_imul;
+
+static inline bool is_amd64_imul(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_imul;
+}
+
+/**
+ * construct imul node
+ */
+ir_node *new_bd_amd64_imul(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_imul_1op;
+
+static inline bool is_amd64_imul_1op(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_imul_1op;
+}
+
+/**
+ * construct imul_1op node
+ */
+ir_node *new_bd_amd64_imul_1op(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_jcc;
+
+static inline bool is_amd64_jcc(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_jcc;
+}
+
+/**
+ * construct jcc node
+ */
+ir_node *new_bd_amd64_jcc(dbg_info *dbgi, ir_node *block, ir_node *eflags, x86_condition_code_t cc);
+
+extern ir_op *op_amd64_jmp;
+
+static inline bool is_amd64_jmp(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_jmp;
+}
+
+/**
+ * construct jmp node
+ */
+ir_node *new_bd_amd64_jmp(dbg_info *dbgi, ir_node *block);
+
+extern ir_op *op_amd64_jmp_switch;
+
+static inline bool is_amd64_jmp_switch(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_jmp_switch;
+}
+
+/**
+ * construct jmp_switch node
+ */
+ir_node *new_bd_amd64_jmp_switch(dbg_info *dbgi, ir_node *block, ir_node *op0, int n_res, const ir_switch_table *table, ir_entity *table_entity);
+
+extern ir_op *op_amd64_l_haddpd;
+
+static inline bool is_amd64_l_haddpd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_l_haddpd;
+}
+
+/**
+ * construct l_haddpd node
+ */
+ir_node *new_bd_amd64_l_haddpd(dbg_info *dbgi, ir_node *block, ir_node *arg0, ir_node *arg1);
+
+extern ir_op *op_amd64_l_punpckldq;
+
+static inline bool is_amd64_l_punpckldq(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_l_punpckldq;
+}
+
+/**
+ * construct l_punpckldq node
+ */
+ir_node *new_bd_amd64_l_punpckldq(dbg_info *dbgi, ir_node *block, ir_node *arg0, ir_node *arg1);
+
+extern ir_op *op_amd64_l_subpd;
+
+static inline bool is_amd64_l_subpd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_l_subpd;
+}
+
+/**
+ * construct l_subpd node
+ */
+ir_node *new_bd_amd64_l_subpd(dbg_info *dbgi, ir_node *block, ir_node *arg0, ir_node *arg1);
+
+extern ir_op *op_amd64_lea;
+
+static inline bool is_amd64_lea(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_lea;
+}
+
+/**
+ * construct lea node
+ */
+ir_node *new_bd_amd64_lea(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_leave;
+
+static inline bool is_amd64_leave(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_leave;
+}
+
+/**
+ * construct leave node
+ */
+ir_node *new_bd_amd64_leave(dbg_info *dbgi, ir_node *block, ir_node *op0);
+
+extern ir_op *op_amd64_mov_gp;
+
+static inline bool is_amd64_mov_gp(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_mov_gp;
+}
+
+/**
+ * construct mov_gp node
+ */
+ir_node *new_bd_amd64_mov_gp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_mov_imm;
+
+static inline bool is_amd64_mov_imm(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_mov_imm;
+}
+
+/**
+ * construct mov_imm node
+ */
+ir_node *new_bd_amd64_mov_imm(dbg_info *dbgi, ir_node *block, amd64_insn_mode_t insn_mode, int64_t offset, ir_entity *entity);
+
+extern ir_op *op_amd64_mov_store;
+
+static inline bool is_amd64_mov_store(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_mov_store;
+}
+
+/**
+ * construct mov_store node
+ */
+ir_node *new_bd_amd64_mov_store(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_movd_gp_xmm;
+
+static inline bool is_amd64_movd_gp_xmm(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_movd_gp_xmm;
+}
+
+/**
+ * construct movd_gp_xmm node
+ */
+ir_node *new_bd_amd64_movd_gp_xmm(dbg_info *dbgi, ir_node *block, ir_node *operand, amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_movd_xmm_gp;
+
+static inline bool is_amd64_movd_xmm_gp(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_movd_xmm_gp;
+}
+
+/**
+ * construct movd_xmm_gp node
+ */
+ir_node *new_bd_amd64_movd_xmm_gp(dbg_info *dbgi, ir_node *block, ir_node *operand, amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_movdqa;
+
+static inline bool is_amd64_movdqa(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_movdqa;
+}
+
+/**
+ * construct movdqa node
+ */
+ir_node *new_bd_amd64_movdqa(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_movdqu;
+
+static inline bool is_amd64_movdqu(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_movdqu;
+}
+
+/**
+ * construct movdqu node
+ */
+ir_node *new_bd_amd64_movdqu(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_movdqu_store;
+
+static inline bool is_amd64_movdqu_store(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_movdqu_store;
+}
+
+/**
+ * construct movdqu_store node
+ */
+ir_node *new_bd_amd64_movdqu_store(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_movq;
+
+static inline bool is_amd64_movq(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_movq;
+}
+
+/**
+ * construct movq node
+ */
+ir_node *new_bd_amd64_movq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_movs;
+
+static inline bool is_amd64_movs(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_movs;
+}
+
+/**
+ * construct movs node
+ */
+ir_node *new_bd_amd64_movs(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_movs_store_xmm;
+
+static inline bool is_amd64_movs_store_xmm(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_movs_store_xmm;
+}
+
+/**
+ * construct movs_store_xmm node
+ */
+ir_node *new_bd_amd64_movs_store_xmm(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_movs_xmm;
+
+static inline bool is_amd64_movs_xmm(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_movs_xmm;
+}
+
+/**
+ * construct movs_xmm node
+ */
+ir_node *new_bd_amd64_movs_xmm(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_mul;
+
+static inline bool is_amd64_mul(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_mul;
+}
+
+/**
+ * construct mul node
+ */
+ir_node *new_bd_amd64_mul(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_mulpd;
+
+static inline bool is_amd64_mulpd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_mulpd;
+}
+
+/**
+ * construct mulpd node
+ */
+ir_node *new_bd_amd64_mulpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_mulps;
+
+static inline bool is_amd64_mulps(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_mulps;
+}
+
+/**
+ * construct mulps node
+ */
+ir_node *new_bd_amd64_mulps(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_muls;
+
+static inline bool is_amd64_muls(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_muls;
+}
+
+/**
+ * construct muls node
+ */
+ir_node *new_bd_amd64_muls(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_neg;
+
+static inline bool is_amd64_neg(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_neg;
+}
+
+/**
+ * construct neg node
+ */
+ir_node *new_bd_amd64_neg(dbg_info *dbgi, ir_node *block, ir_node *val, amd64_insn_mode_t insn_mode);
+
+extern ir_op *op_amd64_not;
+
+static inline bool is_amd64_not(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_not;
+}
+
+/**
+ * construct not node
+ */
+ir_node *new_bd_amd64_not(dbg_info *dbgi, ir_node *block, ir_node *val, amd64_insn_mode_t insn_mode);
+
+extern ir_op *op_amd64_or;
+
+static inline bool is_amd64_or(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_or;
+}
+
+/**
+ * construct or node
+ */
+ir_node *new_bd_amd64_or(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_paddb;
+
+static inline bool is_amd64_paddb(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_paddb;
+}
+
+/**
+ * construct paddb node
+ */
+ir_node *new_bd_amd64_paddb(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_paddd;
+
+static inline bool is_amd64_paddd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_paddd;
+}
+
+/**
+ * construct paddd node
+ */
+ir_node *new_bd_amd64_paddd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_paddq;
+
+static inline bool is_amd64_paddq(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_paddq;
+}
+
+/**
+ * construct paddq node
+ */
+ir_node *new_bd_amd64_paddq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_paddw;
+
+static inline bool is_amd64_paddw(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_paddw;
+}
+
+/**
+ * construct paddw node
+ */
+ir_node *new_bd_amd64_paddw(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_pand;
+
+static inline bool is_amd64_pand(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_pand;
+}
+
+/**
+ * construct pand node
+ */
+ir_node *new_bd_amd64_pand(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_pop_am;
+
+static inline bool is_amd64_pop_am(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_pop_am;
+}
+
+/**
+ * construct pop_am node
+ */
+ir_node *new_bd_amd64_pop_am(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_por;
+
+static inline bool is_amd64_por(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_por;
+}
+
+/**
+ * construct por node
+ */
+ir_node *new_bd_amd64_por(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_pshufd_0;
+
+static inline bool is_amd64_pshufd_0(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_pshufd_0;
+}
+
+/**
+ * construct pshufd_0 node
+ */
+ir_node *new_bd_amd64_pshufd_0(dbg_info *dbgi, ir_node *block, ir_node *operand, amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_psubb;
+
+static inline bool is_amd64_psubb(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_psubb;
+}
+
+/**
+ * construct psubb node
+ */
+ir_node *new_bd_amd64_psubb(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_psubd;
+
+static inline bool is_amd64_psubd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_psubd;
+}
+
+/**
+ * construct psubd node
+ */
+ir_node *new_bd_amd64_psubd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_psubq;
+
+static inline bool is_amd64_psubq(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_psubq;
+}
+
+/**
+ * construct psubq node
+ */
+ir_node *new_bd_amd64_psubq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_psubw;
+
+static inline bool is_amd64_psubw(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_psubw;
+}
+
+/**
+ * construct psubw node
+ */
+ir_node *new_bd_amd64_psubw(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_punpcklbw;
+
+static inline bool is_amd64_punpcklbw(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_punpcklbw;
+}
+
+/**
+ * construct punpcklbw node
+ */
+ir_node *new_bd_amd64_punpcklbw(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_punpckldq;
+
+static inline bool is_amd64_punpckldq(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_punpckldq;
+}
+
+/**
+ * construct punpckldq node
+ */
+ir_node *new_bd_amd64_punpckldq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_punpcklqdq;
+
+static inline bool is_amd64_punpcklqdq(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_punpcklqdq;
+}
+
+/**
+ * construct punpcklqdq node
+ */
+ir_node *new_bd_amd64_punpcklqdq(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_punpcklwd;
+
+static inline bool is_amd64_punpcklwd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_punpcklwd;
+}
+
+/**
+ * construct punpcklwd node
+ */
+ir_node *new_bd_amd64_punpcklwd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_push_am;
+
+static inline bool is_amd64_push_am(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_push_am;
+}
+
+/**
+ * construct push_am node
+ */
+ir_node *new_bd_amd64_push_am(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], amd64_insn_mode_t insn_mode, amd64_addr_t addr);
+
+extern ir_op *op_amd64_push_reg;
+
+static inline bool is_amd64_push_reg(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_push_reg;
+}
+
+/**
+ * construct push_reg node
+ */
+ir_node *new_bd_amd64_push_reg(dbg_info *dbgi, ir_node *block, ir_node *stack, ir_node *val);
+
+extern ir_op *op_amd64_pxor;
+
+static inline bool is_amd64_pxor(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_pxor;
+}
+
+/**
+ * construct pxor node
+ */
+ir_node *new_bd_amd64_pxor(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_ret;
+
+static inline bool is_amd64_ret(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_ret;
+}
+
+/**
+ * construct ret node
+ */
+ir_node *new_bd_amd64_ret(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[]);
+
+extern ir_op *op_amd64_sar;
+
+static inline bool is_amd64_sar(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_sar;
+}
+
+/**
+ * construct sar node
+ */
+ir_node *new_bd_amd64_sar(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_shift_attr_t *attr_init);
+
+extern ir_op *op_amd64_sbb;
+
+static inline bool is_amd64_sbb(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_sbb;
+}
+
+/**
+ * construct sbb node
+ */
+ir_node *new_bd_amd64_sbb(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_shl;
+
+static inline bool is_amd64_shl(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_shl;
+}
+
+/**
+ * construct shl node
+ */
+ir_node *new_bd_amd64_shl(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_shift_attr_t *attr_init);
+
+extern ir_op *op_amd64_shr;
+
+static inline bool is_amd64_shr(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_shr;
+}
+
+/**
+ * construct shr node
+ */
+ir_node *new_bd_amd64_shr(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_shift_attr_t *attr_init);
+
+extern ir_op *op_amd64_shufps_0;
+
+static inline bool is_amd64_shufps_0(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_shufps_0;
+}
+
+/**
+ * construct shufps_0 node
+ */
+ir_node *new_bd_amd64_shufps_0(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_start;
+
+static inline bool is_amd64_start(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_start;
+}
+
+/**
+ * construct start node
+ */
+ir_node *new_bd_amd64_start(dbg_info *dbgi, ir_node *block, int n_res);
+
+extern ir_op *op_amd64_sub;
+
+static inline bool is_amd64_sub(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_sub;
+}
+
+/**
+ * construct sub node
+ */
+ir_node *new_bd_amd64_sub(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_sub_sp;
+
+static inline bool is_amd64_sub_sp(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_sub_sp;
+}
+
+/**
+ * construct sub_sp node
+ */
+ir_node *new_bd_amd64_sub_sp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_subpd;
+
+static inline bool is_amd64_subpd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_subpd;
+}
+
+/**
+ * construct subpd node
+ */
+ir_node *new_bd_amd64_subpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_subps;
+
+static inline bool is_amd64_subps(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_subps;
+}
+
+/**
+ * construct subps node
+ */
+ir_node *new_bd_amd64_subps(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_subs;
+
+static inline bool is_amd64_subs(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_subs;
+}
+
+/**
+ * construct subs node
+ */
+ir_node *new_bd_amd64_subs(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_ucomis;
+
+static inline bool is_amd64_ucomis(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_ucomis;
+}
+
+/**
+ * construct ucomis node
+ */
+ir_node *new_bd_amd64_ucomis(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_unpcklpd;
+
+static inline bool is_amd64_unpcklpd(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_unpcklpd;
+}
+
+/**
+ * construct unpcklpd node
+ */
+ir_node *new_bd_amd64_unpcklpd(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_xor;
+
+static inline bool is_amd64_xor(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_xor;
+}
+
+/**
+ * construct xor node
+ */
+ir_node *new_bd_amd64_xor(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_xor_0;
+
+static inline bool is_amd64_xor_0(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_xor_0;
+}
+
+/**
+ * construct xor_0 node
+ */
+ir_node *new_bd_amd64_xor_0(dbg_info *dbgi, ir_node *block);
+
+extern ir_op *op_amd64_xorp;
+
+static inline bool is_amd64_xorp(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_xorp;
+}
+
+/**
+ * construct xorp node
+ */
+ir_node *new_bd_amd64_xorp(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], const amd64_binop_addr_attr_t *attr_init);
+
+extern ir_op *op_amd64_xorpd_0;
+
+static inline bool is_amd64_xorpd_0(ir_node const *const n)
+{
+	return get_irn_op(n) == op_amd64_xorpd_0;
+}
+
+/**
+ * construct xorpd_0 node
+ */
+ir_node *new_bd_amd64_xorpd_0(dbg_info *dbgi, ir_node *block);
+
+
+
+typedef enum pn_amd64_add {
+	pn_amd64_add_res = 0,
+	pn_amd64_add_flags = 1,
+	pn_amd64_add_M = 2,
+} pn_amd64_add;
+
+typedef enum pn_amd64_addpd {
+	pn_amd64_addpd_res = 0,
+	pn_amd64_addpd_none = 1,
+	pn_amd64_addpd_M = 2,
+} pn_amd64_addpd;
+
+typedef enum pn_amd64_addps {
+	pn_amd64_addps_res = 0,
+	pn_amd64_addps_none = 1,
+	pn_amd64_addps_M = 2,
+} pn_amd64_addps;
+
+typedef enum pn_amd64_adds {
+	pn_amd64_adds_res = 0,
+	pn_amd64_adds_none = 1,
+	pn_amd64_adds_M = 2,
+} pn_amd64_adds;
+
+typedef enum pn_amd64_and {
+	pn_amd64_and_res = 0,
+	pn_amd64_and_flags = 1,
+	pn_amd64_and_M = 2,
+} pn_amd64_and;
+
+typedef enum pn_amd64_call {
+	pn_amd64_call_M = 0,
+	pn_amd64_call_stack = 1,
+	pn_amd64_call_flags = 2,
+	pn_amd64_call_first_result = 3,
+} pn_amd64_call;
+
+typedef enum pn_amd64_cmp {
+	pn_amd64_cmp_dummy = 0,
+	pn_amd64_cmp_flags = 1,
+	pn_amd64_cmp_M = 2,
+} pn_amd64_cmp;
+
+typedef enum pn_amd64_cvtsd2ss {
+	pn_amd64_cvtsd2ss_res = 0,
+	pn_amd64_cvtsd2ss_none = 1,
+	pn_amd64_cvtsd2ss_M = 2,
+} pn_amd64_cvtsd2ss;
+
+typedef enum pn_amd64_cvtsi2sd {
+	pn_amd64_cvtsi2sd_res = 0,
+	pn_amd64_cvtsi2sd_none = 1,
+	pn_amd64_cvtsi2sd_M = 2,
+} pn_amd64_cvtsi2sd;
+
+typedef enum pn_amd64_cvtsi2ss {
+	pn_amd64_cvtsi2ss_res = 0,
+	pn_amd64_cvtsi2ss_none = 1,
+	pn_amd64_cvtsi2ss_M = 2,
+} pn_amd64_cvtsi2ss;
+
+typedef enum pn_amd64_cvtss2sd {
+	pn_amd64_cvtss2sd_res = 0,
+	pn_amd64_cvtss2sd_none = 1,
+	pn_amd64_cvtss2sd_M = 2,
+} pn_amd64_cvtss2sd;
+
+typedef enum pn_amd64_cvttsd2si {
+	pn_amd64_cvttsd2si_res = 0,
+	pn_amd64_cvttsd2si_none = 1,
+	pn_amd64_cvttsd2si_M = 2,
+} pn_amd64_cvttsd2si;
+
+typedef enum pn_amd64_cvttss2si {
+	pn_amd64_cvttss2si_res = 0,
+	pn_amd64_cvttss2si_none = 1,
+	pn_amd64_cvttss2si_M = 2,
+} pn_amd64_cvttss2si;
+
+typedef enum pn_amd64_div {
+	pn_amd64_div_res_div = 0,
+	pn_amd64_div_flags = 1,
+	pn_amd64_div_M = 2,
+	pn_amd64_div_res_mod = 3,
+} pn_amd64_div;
+
+typedef enum pn_amd64_divs {
+	pn_amd64_divs_res = 0,
+	pn_amd64_divs_none = 1,
+	pn_amd64_divs_M = 2,
+} pn_amd64_divs;
+
+typedef enum pn_amd64_haddpd {
+	pn_amd64_haddpd_res = 0,
+	pn_amd64_haddpd_none = 1,
+	pn_amd64_haddpd_M = 2,
+} pn_amd64_haddpd;
+
+typedef enum pn_amd64_idiv {
+	pn_amd64_idiv_res_div = 0,
+	pn_amd64_idiv_flags = 1,
+	pn_amd64_idiv_M = 2,
+	pn_amd64_idiv_res_mod = 3,
+} pn_amd64_idiv;
+
+typedef enum pn_amd64_ijmp {
+	pn_amd64_ijmp_X = 0,
+	pn_amd64_ijmp_unused = 1,
+	pn_amd64_ijmp_M = 2,
+} pn_amd64_ijmp;
+
+typedef enum pn_amd64_imul {
+	pn_amd64_imul_res = 0,
+	pn_amd64_imul_flags = 1,
+	pn_amd64_imul_M = 2,
+} pn_amd64_imul;
+
+typedef enum pn_amd64_imul_1op {
+	pn_amd64_imul_1op_res_low = 0,
+	pn_amd64_imul_1op_flags = 1,
+	pn_amd64_imul_1op_M = 2,
+	pn_amd64_imul_1op_res_high = 3,
+} pn_amd64_imul_1op;
+
+typedef enum pn_amd64_jcc {
+	pn_amd64_jcc_false = 0,
+	pn_amd64_jcc_true = 1,
+} pn_amd64_jcc;
+
+typedef enum n_amd64_jcc {
+	n_amd64_jcc_eflags = 0,
+} n_amd64_jcc;
+
+typedef enum pn_amd64_l_haddpd {
+	pn_amd64_l_haddpd_res = 0,
+} pn_amd64_l_haddpd;
+
+typedef enum n_amd64_l_haddpd {
+	n_amd64_l_haddpd_arg0 = 0,
+	n_amd64_l_haddpd_arg1 = 1,
+} n_amd64_l_haddpd;
+
+typedef enum pn_amd64_l_punpckldq {
+	pn_amd64_l_punpckldq_res = 0,
+} pn_amd64_l_punpckldq;
+
+typedef enum n_amd64_l_punpckldq {
+	n_amd64_l_punpckldq_arg0 = 0,
+	n_amd64_l_punpckldq_arg1 = 1,
+} n_amd64_l_punpckldq;
+
+typedef enum pn_amd64_l_subpd {
+	pn_amd64_l_subpd_res = 0,
+} pn_amd64_l_subpd;
+
+typedef enum n_amd64_l_subpd {
+	n_amd64_l_subpd_arg0 = 0,
+	n_amd64_l_subpd_arg1 = 1,
+} n_amd64_l_subpd;
+
+typedef enum pn_amd64_lea {
+	pn_amd64_lea_res = 0,
+} pn_amd64_lea;
+
+typedef enum pn_amd64_leave {
+	pn_amd64_leave_frame = 0,
+	pn_amd64_leave_stack = 1,
+} pn_amd64_leave;
+
+typedef enum pn_amd64_mov_gp {
+	pn_amd64_mov_gp_res = 0,
+	pn_amd64_mov_gp_unused = 1,
+	pn_amd64_mov_gp_M = 2,
+} pn_amd64_mov_gp;
+
+typedef enum pn_amd64_mov_store {
+	pn_amd64_mov_store_M = 0,
+} pn_amd64_mov_store;
+
+typedef enum pn_amd64_movd_gp_xmm {
+	pn_amd64_movd_gp_xmm_res = 0,
+} pn_amd64_movd_gp_xmm;
+
+typedef enum n_amd64_movd_gp_xmm {
+	n_amd64_movd_gp_xmm_operand = 0,
+} n_amd64_movd_gp_xmm;
+
+typedef enum pn_amd64_movd_xmm_gp {
+	pn_amd64_movd_xmm_gp_res = 0,
+} pn_amd64_movd_xmm_gp;
+
+typedef enum n_amd64_movd_xmm_gp {
+	n_amd64_movd_xmm_gp_operand = 0,
+} n_amd64_movd_xmm_gp;
+
+typedef enum pn_amd64_movdqa {
+	pn_amd64_movdqa_res = 0,
+	pn_amd64_movdqa_none = 1,
+	pn_amd64_movdqa_M = 2,
+} pn_amd64_movdqa;
+
+typedef enum pn_amd64_movdqu {
+	pn_amd64_movdqu_res = 0,
+	pn_amd64_movdqu_none = 1,
+	pn_amd64_movdqu_M = 2,
+} pn_amd64_movdqu;
+
+typedef enum pn_amd64_movdqu_store {
+	pn_amd64_movdqu_store_M = 0,
+} pn_amd64_movdqu_store;
+
+typedef enum pn_amd64_movq {
+	pn_amd64_movq_res = 0,
+	pn_amd64_movq_none = 1,
+	pn_amd64_movq_M = 2,
+} pn_amd64_movq;
+
+typedef enum pn_amd64_movs {
+	pn_amd64_movs_res = 0,
+	pn_amd64_movs_unused = 1,
+	pn_amd64_movs_M = 2,
+} pn_amd64_movs;
+
+typedef enum pn_amd64_movs_store_xmm {
+	pn_amd64_movs_store_xmm_M = 0,
+} pn_amd64_movs_store_xmm;
+
+typedef enum pn_amd64_movs_xmm {
+	pn_amd64_movs_xmm_res = 0,
+	pn_amd64_movs_xmm_none = 1,
+	pn_amd64_movs_xmm_M = 2,
+} pn_amd64_movs_xmm;
+
+typedef enum pn_amd64_mul {
+	pn_amd64_mul_res_low = 0,
+	pn_amd64_mul_flags = 1,
+	pn_amd64_mul_M = 2,
+	pn_amd64_mul_res_high = 3,
+} pn_amd64_mul;
+
+typedef enum pn_amd64_mulpd {
+	pn_amd64_mulpd_res = 0,
+	pn_amd64_mulpd_none = 1,
+	pn_amd64_mulpd_M = 2,
+} pn_amd64_mulpd;
+
+typedef enum pn_amd64_mulps {
+	pn_amd64_mulps_res = 0,
+	pn_amd64_mulps_none = 1,
+	pn_amd64_mulps_M = 2,
+} pn_amd64_mulps;
+
+typedef enum pn_amd64_muls {
+	pn_amd64_muls_res = 0,
+	pn_amd64_muls_none = 1,
+	pn_amd64_muls_M = 2,
+} pn_amd64_muls;
+
+typedef enum pn_amd64_neg {
+	pn_amd64_neg_res = 0,
+	pn_amd64_neg_flags = 1,
+} pn_amd64_neg;
+
+typedef enum n_amd64_neg {
+	n_amd64_neg_val = 0,
+} n_amd64_neg;
+
+typedef enum pn_amd64_not {
+	pn_amd64_not_res = 0,
+	pn_amd64_not_flags = 1,
+} pn_amd64_not;
+
+typedef enum n_amd64_not {
+	n_amd64_not_val = 0,
+} n_amd64_not;
+
+typedef enum pn_amd64_or {
+	pn_amd64_or_res = 0,
+	pn_amd64_or_flags = 1,
+	pn_amd64_or_M = 2,
+} pn_amd64_or;
+
+typedef enum pn_amd64_paddb {
+	pn_amd64_paddb_res = 0,
+	pn_amd64_paddb_none = 1,
+	pn_amd64_paddb_M = 2,
+} pn_amd64_paddb;
+
+typedef enum pn_amd64_paddd {
+	pn_amd64_paddd_res = 0,
+	pn_amd64_paddd_none = 1,
+	pn_amd64_paddd_M = 2,
+} pn_amd64_paddd;
+
+typedef enum pn_amd64_paddq {
+	pn_amd64_paddq_res = 0,
+	pn_amd64_paddq_none = 1,
+	pn_amd64_paddq_M = 2,
+} pn_amd64_paddq;
+
+typedef enum pn_amd64_paddw {
+	pn_amd64_paddw_res = 0,
+	pn_amd64_paddw_none = 1,
+	pn_amd64_paddw_M = 2,
+} pn_amd64_paddw;
+
+typedef enum pn_amd64_pand {
+	pn_amd64_pand_res = 0,
+	pn_amd64_pand_none = 1,
+	pn_amd64_pand_M = 2,
+} pn_amd64_pand;
+
+typedef enum pn_amd64_pop_am {
+	pn_amd64_pop_am_stack = 0,
+	pn_amd64_pop_am_M = 1,
+} pn_amd64_pop_am;
+
+typedef enum pn_amd64_por {
+	pn_amd64_por_res = 0,
+	pn_amd64_por_none = 1,
+	pn_amd64_por_M = 2,
+} pn_amd64_por;
+
+typedef enum pn_amd64_pshufd_0 {
+	pn_amd64_pshufd_0_res = 0,
+} pn_amd64_pshufd_0;
+
+typedef enum n_amd64_pshufd_0 {
+	n_amd64_pshufd_0_operand = 0,
+} n_amd64_pshufd_0;
+
+typedef enum pn_amd64_psubb {
+	pn_amd64_psubb_res = 0,
+	pn_amd64_psubb_none = 1,
+	pn_amd64_psubb_M = 2,
+} pn_amd64_psubb;
+
+typedef enum pn_amd64_psubd {
+	pn_amd64_psubd_res = 0,
+	pn_amd64_psubd_none = 1,
+	pn_amd64_psubd_M = 2,
+} pn_amd64_psubd;
+
+typedef enum pn_amd64_psubq {
+	pn_amd64_psubq_res = 0,
+	pn_amd64_psubq_none = 1,
+	pn_amd64_psubq_M = 2,
+} pn_amd64_psubq;
+
+typedef enum pn_amd64_psubw {
+	pn_amd64_psubw_res = 0,
+	pn_amd64_psubw_none = 1,
+	pn_amd64_psubw_M = 2,
+} pn_amd64_psubw;
+
+typedef enum pn_amd64_punpcklbw {
+	pn_amd64_punpcklbw_res = 0,
+	pn_amd64_punpcklbw_none = 1,
+	pn_amd64_punpcklbw_M = 2,
+} pn_amd64_punpcklbw;
+
+typedef enum pn_amd64_punpckldq {
+	pn_amd64_punpckldq_res = 0,
+	pn_amd64_punpckldq_none = 1,
+	pn_amd64_punpckldq_M = 2,
+} pn_amd64_punpckldq;
+
+typedef enum pn_amd64_punpcklqdq {
+	pn_amd64_punpcklqdq_res = 0,
+	pn_amd64_punpcklqdq_none = 1,
+	pn_amd64_punpcklqdq_M = 2,
+} pn_amd64_punpcklqdq;
+
+typedef enum pn_amd64_punpcklwd {
+	pn_amd64_punpcklwd_res = 0,
+	pn_amd64_punpcklwd_none = 1,
+	pn_amd64_punpcklwd_M = 2,
+} pn_amd64_punpcklwd;
+
+typedef enum pn_amd64_push_am {
+	pn_amd64_push_am_stack = 0,
+	pn_amd64_push_am_M = 1,
+} pn_amd64_push_am;
+
+typedef enum pn_amd64_push_reg {
+	pn_amd64_push_reg_stack = 0,
+} pn_amd64_push_reg;
+
+typedef enum n_amd64_push_reg {
+	n_amd64_push_reg_stack = 0,
+	n_amd64_push_reg_val = 1,
+} n_amd64_push_reg;
+
+typedef enum pn_amd64_pxor {
+	pn_amd64_pxor_res = 0,
+	pn_amd64_pxor_none = 1,
+	pn_amd64_pxor_M = 2,
+} pn_amd64_pxor;
+
+typedef enum n_amd64_ret {
+	n_amd64_ret_mem = 0,
+	n_amd64_ret_stack = 1,
+	n_amd64_ret_first_result = 2,
+} n_amd64_ret;
+
+typedef enum pn_amd64_sar {
+	pn_amd64_sar_res = 0,
+	pn_amd64_sar_flags = 1,
+} pn_amd64_sar;
+
+typedef enum pn_amd64_sbb {
+	pn_amd64_sbb_res = 0,
+	pn_amd64_sbb_flags = 1,
+	pn_amd64_sbb_M = 2,
+} pn_amd64_sbb;
+
+typedef enum pn_amd64_shl {
+	pn_amd64_shl_res = 0,
+	pn_amd64_shl_flags = 1,
+} pn_amd64_shl;
+
+typedef enum pn_amd64_shr {
+	pn_amd64_shr_res = 0,
+	pn_amd64_shr_flags = 1,
+} pn_amd64_shr;
+
+typedef enum pn_amd64_shufps_0 {
+	pn_amd64_shufps_0_res = 0,
+	pn_amd64_shufps_0_none = 1,
+	pn_amd64_shufps_0_M = 2,
+} pn_amd64_shufps_0;
+
+typedef enum pn_amd64_sub {
+	pn_amd64_sub_res = 0,
+	pn_amd64_sub_flags = 1,
+	pn_amd64_sub_M = 2,
+} pn_amd64_sub;
+
+typedef enum pn_amd64_sub_sp {
+	pn_amd64_sub_sp_stack = 0,
+	pn_amd64_sub_sp_addr = 1,
+	pn_amd64_sub_sp_M = 2,
+} pn_amd64_sub_sp;
+
+typedef enum pn_amd64_subpd {
+	pn_amd64_subpd_res = 0,
+	pn_amd64_subpd_none = 1,
+	pn_amd64_subpd_M = 2,
+} pn_amd64_subpd;
+
+typedef enum pn_amd64_subps {
+	pn_amd64_subps_res = 0,
+	pn_amd64_subps_none = 1,
+	pn_amd64_subps_M = 2,
+} pn_amd64_subps;
+
+typedef enum pn_amd64_subs {
+	pn_amd64_subs_res = 0,
+	pn_amd64_subs_none = 1,
+	pn_amd64_subs_M = 2,
+} pn_amd64_subs;
+
+typedef enum pn_amd64_ucomis {
+	pn_amd64_ucomis_dummy = 0,
+	pn_amd64_ucomis_flags = 1,
+	pn_amd64_ucomis_M = 2,
+} pn_amd64_ucomis;
+
+typedef enum pn_amd64_unpcklpd {
+	pn_amd64_unpcklpd_res = 0,
+	pn_amd64_unpcklpd_none = 1,
+	pn_amd64_unpcklpd_M = 2,
+} pn_amd64_unpcklpd;
+
+typedef enum pn_amd64_xor {
+	pn_amd64_xor_res = 0,
+	pn_amd64_xor_flags = 1,
+	pn_amd64_xor_M = 2,
+} pn_amd64_xor;
+
+typedef enum pn_amd64_xor_0 {
+	pn_amd64_xor_0_res = 0,
+	pn_amd64_xor_0_flags = 1,
+} pn_amd64_xor_0;
+
+typedef enum pn_amd64_xorp {
+	pn_amd64_xorp_res = 0,
+	pn_amd64_xorp_none = 1,
+	pn_amd64_xorp_M = 2,
+} pn_amd64_xorp;
+
+typedef enum pn_amd64_xorpd_0 {
+	pn_amd64_xorpd_0_res = 0,
+} pn_amd64_xorpd_0;
+
+
+#endif
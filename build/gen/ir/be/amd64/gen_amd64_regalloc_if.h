@@ -0,0 +1,150 @@
+/**
+ * @file
+ * @brief Contains additional external requirements defs for external includes.
+ * @note   DO NOT EDIT THIS FILE, your changes will be lost.
+ *         Edit ir/be/amd64/amd64_spec.pl instead.
+ *         created by: ./ir/be/scripts/generate_regalloc_if.pl ir/be/amd64/amd64_spec.pl build/gen/ir/be/amd64
+ * @date   Fri Oct 16 18:53:31 2026
+ */
+#ifndef FIRM_BE_AMD64_GEN_AMD64_REGALLOC_IF_H
+#define FIRM_BE_AMD64_GEN_AMD64_REGALLOC_IF_H
+
+#include "amd64_nodes_attr.h"
+
+/** global register indices for amd64 registers */
+enum reg_indices {
+	REG_EFLAGS,
+	REG_RAX,
+	REG_RCX,
+	REG_RDX,
+	REG_RSI,
+	REG_RDI,
+	REG_RBX,
+	REG_RBP,
+	REG_RSP,
+	REG_R8,
+	REG_R9,
+	REG_R10,
+	REG_R11,
+	REG_R12,
+	REG_R13,
+	REG_R14,
+	REG_R15,
+	REG_XMM0,
+	REG_XMM1,
+	REG_XMM2,
+	REG_XMM3,
+	REG_XMM4,
+	REG_XMM5,
+	REG_XMM6,
+	REG_XMM7,
+	REG_XMM8,
+	REG_XMM9,
+	REG_XMM10,
+	REG_XMM11,
+	REG_XMM12,
+	REG_XMM13,
+	REG_XMM14,
+	REG_XMM15,
+
+	N_AMD64_REGISTERS
+};
+/** local register indices for amd64 registers */
+enum {
+	REG_FLAGS_EFLAGS = 0,
+	REG_GP_RAX = 0,
+	REG_GP_RCX = 1,
+	REG_GP_RDX = 2,
+	REG_GP_RSI = 3,
+	REG_GP_RDI = 4,
+	REG_GP_RBX = 5,
+	REG_GP_RBP = 6,
+	REG_GP_RSP = 7,
+	REG_GP_R8 = 8,
+	REG_GP_R9 = 9,
+	REG_GP_R10 = 10,
+	REG_GP_R11 = 11,
+	REG_GP_R12 = 12,
+	REG_GP_R13 = 13,
+	REG_GP_R14 = 14,
+	REG_GP_R15 = 15,
+	REG_XMM_XMM0 = 0,
+	REG_XMM_XMM1 = 1,
+	REG_XMM_XMM2 = 2,
+	REG_XMM_XMM3 = 3,
+	REG_XMM_XMM4 = 4,
+	REG_XMM_XMM5 = 5,
+	REG_XMM_XMM6 = 6,
+	REG_XMM_XMM7 = 7,
+	REG_XMM_XMM8 = 8,
+	REG_XMM_XMM9 = 9,
+	REG_XMM_XMM10 = 10,
+	REG_XMM_XMM11 = 11,
+	REG_XMM_XMM12 = 12,
+	REG_XMM_XMM13 = 13,
+	REG_XMM_XMM14 = 14,
+	REG_XMM_XMM15 = 15,
+
+};
+
+/** number of registers in amd64 register classes. */
+enum {
+	N_amd64_flags_REGS = 1,
+	N_amd64_gp_REGS = 16,
+	N_amd64_xmm_REGS = 16,
+
+};
+enum reg_classes {
+	CLASS_amd64_flags = 0,
+	CLASS_amd64_gp = 1,
+	CLASS_amd64_xmm = 2,
+	N_AMD64_CLASSES = 3
+};
+
+
+
+extern const arch_register_req_t amd64_class_reg_req_flags;
+extern const arch_register_req_t amd64_single_reg_req_flags_eflags;
+extern const arch_register_req_t amd64_class_reg_req_gp;
+extern const arch_register_req_t amd64_single_reg_req_gp_rax;
+extern const arch_register_req_t amd64_single_reg_req_gp_rcx;
+extern const arch_register_req_t amd64_single_reg_req_gp_rdx;
+extern const arch_register_req_t amd64_single_reg_req_gp_rsi;
+extern const arch_register_req_t amd64_single_reg_req_gp_rdi;
+extern const arch_register_req_t amd64_single_reg_req_gp_rbx;
+extern const arch_register_req_t amd64_single_reg_req_gp_rbp;
+extern const arch_register_req_t amd64_single_reg_req_gp_rsp;
+extern const arch_register_req_t amd64_single_reg_req_gp_r8;
+extern const arch_register_req_t amd64_single_reg_req_gp_r9;
+extern const arch_register_req_t amd64_single_reg_req_gp_r10;
+extern const arch_register_req_t amd64_single_reg_req_gp_r11;
+extern const arch_register_req_t amd64_single_reg_req_gp_r12;
+extern const arch_register_req_t amd64_single_reg_req_gp_r13;
+extern const arch_register_req_t amd64_single_reg_req_gp_r14;
+extern const arch_register_req_t amd64_single_reg_req_gp_r15;
+extern const arch_register_req_t amd64_class_reg_req_xmm;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm0;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm1;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm2;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm3;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm4;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm5;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm6;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm7;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm8;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm9;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm10;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm11;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm12;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm13;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm14;
+extern const arch_register_req_t amd64_single_reg_req_xmm_xmm15;
+
+
+extern const arch_register_t amd64_registers[N_AMD64_REGISTERS];
+
+extern arch_register_class_t amd64_reg_classes[N_AMD64_CLASSES];
+
+void amd64_register_init(void);
+
+#endif
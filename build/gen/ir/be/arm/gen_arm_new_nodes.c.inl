@@ -0,0 +1,5363 @@
+#include "gen_arm_regalloc_if.h"
+#include "fourcc.h"
+#include "irgopt.h"
+
+ir_op *op_arm_AdC = NULL;
+ir_op *op_arm_AdC_t = NULL;
+ir_op *op_arm_Add = NULL;
+ir_op *op_arm_AddS = NULL;
+ir_op *op_arm_AddS_t = NULL;
+ir_op *op_arm_Address = NULL;
+ir_op *op_arm_Adf = NULL;
+ir_op *op_arm_And = NULL;
+ir_op *op_arm_B = NULL;
+ir_op *op_arm_Bic = NULL;
+ir_op *op_arm_Bl = NULL;
+ir_op *op_arm_Clz = NULL;
+ir_op *op_arm_Cmfe = NULL;
+ir_op *op_arm_Cmp = NULL;
+ir_op *op_arm_CopyB = NULL;
+ir_op *op_arm_Dvf = NULL;
+ir_op *op_arm_Eor = NULL;
+ir_op *op_arm_FltX = NULL;
+ir_op *op_arm_FrameAddr = NULL;
+ir_op *op_arm_Jmp = NULL;
+ir_op *op_arm_Ldf = NULL;
+ir_op *op_arm_Ldr = NULL;
+ir_op *op_arm_LinkLdrPC = NULL;
+ir_op *op_arm_LinkMovPC = NULL;
+ir_op *op_arm_Mla = NULL;
+ir_op *op_arm_Mls = NULL;
+ir_op *op_arm_Mov = NULL;
+ir_op *op_arm_Muf = NULL;
+ir_op *op_arm_Mul = NULL;
+ir_op *op_arm_Mvf = NULL;
+ir_op *op_arm_Mvn = NULL;
+ir_op *op_arm_Or = NULL;
+ir_op *op_arm_OrPl = NULL;
+ir_op *op_arm_OrPl_t = NULL;
+ir_op *op_arm_Pkhbt = NULL;
+ir_op *op_arm_Pkhtb = NULL;
+ir_op *op_arm_Return = NULL;
+ir_op *op_arm_RsC = NULL;
+ir_op *op_arm_Rsb = NULL;
+ir_op *op_arm_RsbS = NULL;
+ir_op *op_arm_SMulL = NULL;
+ir_op *op_arm_SMulL_t = NULL;
+ir_op *op_arm_SbC = NULL;
+ir_op *op_arm_SbC_t = NULL;
+ir_op *op_arm_Start = NULL;
+ir_op *op_arm_Stf = NULL;
+ir_op *op_arm_Str = NULL;
+ir_op *op_arm_Sub = NULL;
+ir_op *op_arm_SubS = NULL;
+ir_op *op_arm_SubS_t = NULL;
+ir_op *op_arm_Suf = NULL;
+ir_op *op_arm_SwitchJmp = NULL;
+ir_op *op_arm_Tst = NULL;
+ir_op *op_arm_UMulL = NULL;
+ir_op *op_arm_UMulL_t = NULL;
+ir_op *op_arm_fConst = NULL;
+
+
+static int arm_opcode_start = -1;
+
+
+/** A tag for the arm opcodes. */
+#define arm_op_tag FOURCC('A', 'R', 'M', '\0')
+
+/** Return 1 if the given opcode is a arm machine op, 0 otherwise */
+int is_arm_op(const ir_op *op)
+{
+	return get_op_tag(op) == arm_op_tag;
+}
+
+/** Return 1 if the given node is a arm machine node, 0 otherwise */
+int is_arm_irn(const ir_node *node)
+{
+	return is_arm_op(get_irn_op(node));
+}
+
+int get_arm_irn_opcode(const ir_node *node)
+{
+	assert(is_arm_irn(node));
+	return get_irn_opcode(node) - arm_opcode_start;
+}
+
+#ifdef BIT
+#undef BIT
+#endif
+#define BIT(x)  (1 << (x))
+
+static const unsigned arm_limit_gp_sp[] = { 0xFFFFFFFF & ~BIT(REG_GP_SP), 0xFFFFFFFF };
+
+static const arch_register_req_t arm_requirements_gp_gp = {
+	.cls   = &arm_reg_classes[CLASS_arm_gp],
+	.width = 1,
+};
+
+
+static const arch_register_req_t arm_requirements_flags_flags = {
+	.cls   = &arm_reg_classes[CLASS_arm_flags],
+	.width = 1,
+};
+
+
+static const arch_register_req_t arm_requirements_fpa_fpa = {
+	.cls   = &arm_reg_classes[CLASS_arm_fpa],
+	.width = 1,
+};
+
+
+static const arch_register_req_t arm_requirements_gp_not_sp = {
+	.cls               = &arm_reg_classes[CLASS_arm_gp],
+	.limited           = arm_limit_gp_sp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t arm_requirements_gp_not_in_r1 = {
+	.cls               = &arm_reg_classes[CLASS_arm_gp],
+	.limited           = NULL,
+	.should_be_same    = 0,
+	.must_be_different = 1,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t arm_requirements_gp_in_r3 = {
+	.cls               = &arm_reg_classes[CLASS_arm_gp],
+	.limited           = NULL,
+	.should_be_same    = 4,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+
+/**
+ * construct AdC node
+ */
+ir_node *new_bd_arm_AdC_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *flags, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AdC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AdC node
+ */
+ir_node *new_bd_arm_AdC_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *flags)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AdC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AdC node
+ */
+ir_node *new_bd_arm_AdC_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *flags, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AdC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AdC node
+ */
+ir_node *new_bd_arm_AdC_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, ir_node *flags, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+	in[3] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AdC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AdC_t node
+ */
+ir_node *new_bd_arm_AdC_t(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *flags, ir_mode *mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 0;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AdC_t;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Add node
+ */
+ir_node *new_bd_arm_Add_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Add;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Add node
+ */
+ir_node *new_bd_arm_Add_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Add;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Add node
+ */
+ir_node *new_bd_arm_Add_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Add;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Add node
+ */
+ir_node *new_bd_arm_Add_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Add;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AddS node
+ */
+ir_node *new_bd_arm_AddS_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AddS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AddS node
+ */
+ir_node *new_bd_arm_AddS_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AddS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AddS node
+ */
+ir_node *new_bd_arm_AddS_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AddS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AddS node
+ */
+ir_node *new_bd_arm_AddS_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AddS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AddS_t node
+ */
+ir_node *new_bd_arm_AddS_t(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_AddS_t;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Address node
+ */
+ir_node *new_bd_arm_Address(dbg_info *dbgi, ir_node *block, ir_entity *entity, int offset)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Address;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_Address_attr_t *attr = (arm_Address_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_Address_attributes(res, entity, offset);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Adf node
+ */
+ir_node *new_bd_arm_Adf(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1, ir_mode *op_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_fpa_fpa,
+		& arm_requirements_fpa_fpa,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Adf;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_farith_attr_t *attr = (arm_farith_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_farith_attributes(res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_fpa_fpa;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct And node
+ */
+ir_node *new_bd_arm_And_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_And;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct And node
+ */
+ir_node *new_bd_arm_And_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_And;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct And node
+ */
+ir_node *new_bd_arm_And_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_And;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct And node
+ */
+ir_node *new_bd_arm_And_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_And;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct B node
+ */
+ir_node *new_bd_arm_B(dbg_info *dbgi, ir_node *block, ir_node *flags, ir_relation relation)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_B;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_CondJmp_attr_t *attr = (arm_CondJmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+
+		set_arm_CondJmp_relation(res, relation);
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bic node
+ */
+ir_node *new_bd_arm_Bic_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Bic;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bic node
+ */
+ir_node *new_bd_arm_Bic_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Bic;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bic node
+ */
+ir_node *new_bd_arm_Bic_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Bic;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bic node
+ */
+ir_node *new_bd_arm_Bic_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Bic;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bl node
+ */
+ir_node *new_bd_arm_Bl(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], int n_res, ir_entity *entity, int offset)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Bl;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_Address_attr_t *attr = (arm_Address_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_Address_attributes(res, entity, offset);
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Clz node
+ */
+ir_node *new_bd_arm_Clz(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Clz;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cmfe node
+ */
+ir_node *new_bd_arm_Cmfe(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_fpa_fpa,
+		& arm_requirements_fpa_fpa,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Cmfe;
+	ir_mode  *mode = arm_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_cmp_attr_t *attr = (arm_cmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_flags_flags;
+
+	init_arm_cmp_attr(res, ins_permuted, false);
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cmp node
+ */
+ir_node *new_bd_arm_Cmp_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot, bool ins_permuted, bool is_unsigned)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Cmp;
+	ir_mode  *mode = arm_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_cmp_attr_t *attr = (arm_cmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	init_arm_cmp_attr(res, ins_permuted, is_unsigned);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cmp node
+ */
+ir_node *new_bd_arm_Cmp_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, bool ins_permuted, bool is_unsigned)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Cmp;
+	ir_mode  *mode = arm_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_cmp_attr_t *attr = (arm_cmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	init_arm_cmp_attr(res, ins_permuted, is_unsigned);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cmp node
+ */
+ir_node *new_bd_arm_Cmp_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate, bool ins_permuted, bool is_unsigned)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Cmp;
+	ir_mode  *mode = arm_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_cmp_attr_t *attr = (arm_cmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	init_arm_cmp_attr(res, ins_permuted, is_unsigned);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cmp node
+ */
+ir_node *new_bd_arm_Cmp_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier, bool ins_permuted, bool is_unsigned)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Cmp;
+	ir_mode  *mode = arm_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_cmp_attr_t *attr = (arm_cmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	init_arm_cmp_attr(res, ins_permuted, is_unsigned);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct CopyB node
+ */
+ir_node *new_bd_arm_CopyB(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1, ir_node *op2, ir_node *op3, ir_node *op4, ir_node *op5, unsigned size)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_not_sp,
+		& arm_requirements_gp_not_sp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+	in[2] = op2;
+	in[3] = op3;
+	in[4] = op4;
+	in[5] = op5;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_CopyB;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_CopyB_attr_t *attr = (arm_CopyB_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_CopyB_attributes(res, size);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Dvf node
+ */
+ir_node *new_bd_arm_Dvf(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1, ir_mode *op_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_fpa_fpa,
+		& arm_requirements_fpa_fpa,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Dvf;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_farith_attr_t *attr = (arm_farith_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_farith_attributes(res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_fpa_fpa;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Eor node
+ */
+ir_node *new_bd_arm_Eor_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Eor;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Eor node
+ */
+ir_node *new_bd_arm_Eor_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Eor;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Eor node
+ */
+ir_node *new_bd_arm_Eor_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Eor;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Eor node
+ */
+ir_node *new_bd_arm_Eor_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Eor;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct FltX node
+ */
+ir_node *new_bd_arm_FltX(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_mode *op_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_FltX;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_farith_attr_t *attr = (arm_farith_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_farith_attributes(res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_fpa_fpa;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct FrameAddr node
+ */
+ir_node *new_bd_arm_FrameAddr(dbg_info *dbgi, ir_node *block, ir_node *base, ir_entity *entity, int offset)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_FrameAddr;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_Address_attr_t *attr = (arm_Address_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_Address_attributes(res, entity, offset);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Jmp node
+ */
+ir_node *new_bd_arm_Jmp(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_simple_jump;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Jmp;
+	ir_mode  *mode = mode_X;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Ldf node
+ */
+ir_node *new_bd_arm_Ldf(dbg_info *dbgi, ir_node *block, ir_node *ptr, ir_node *mem, ir_mode *ls_mode, ir_entity *entity, int entity_sign, long offset, bool is_frame_entity)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = ptr;
+	in[1] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Ldf;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_load_store_attr_t *attr = (arm_load_store_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_load_store_attributes(res, ls_mode, entity, entity_sign, offset, is_frame_entity);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_fpa_fpa;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Ldr node
+ */
+ir_node *new_bd_arm_Ldr(dbg_info *dbgi, ir_node *block, ir_node *ptr, ir_node *mem, ir_mode *ls_mode, ir_entity *entity, int entity_sign, long offset, bool is_frame_entity)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = ptr;
+	in[1] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Ldr;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_load_store_attr_t *attr = (arm_load_store_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_load_store_attributes(res, ls_mode, entity, entity_sign, offset, is_frame_entity);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct LinkLdrPC node
+ */
+ir_node *new_bd_arm_LinkLdrPC(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], int n_res, ir_mode *ls_mode, ir_entity *entity, int entity_sign, long offset, bool is_frame_entity)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_LinkLdrPC;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_load_store_attr_t *attr = (arm_load_store_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_load_store_attributes(res, ls_mode, entity, entity_sign, offset, is_frame_entity);
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct LinkMovPC node
+ */
+ir_node *new_bd_arm_LinkMovPC(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], int n_res, unsigned shiftop_input, arm_shift_modifier_t shift_modifier, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_LinkMovPC;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, shiftop_input, immediate_value, shift_modifier, immediate_rot);
+
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mla node
+ */
+ir_node *new_bd_arm_Mla(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *add)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = add;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mla;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mla node
+ */
+ir_node *new_bd_arm_Mla_v5(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *add)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = add;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mla;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_not_in_r1;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mls node
+ */
+ir_node *new_bd_arm_Mls(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *sub)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = sub;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mls;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mov node
+ */
+ir_node *new_bd_arm_Mov_imm(dbg_info *dbgi, ir_node *block, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+	};
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mov;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 0, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mov node
+ */
+ir_node *new_bd_arm_Mov_reg(dbg_info *dbgi, ir_node *block, ir_node *Rm)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = Rm;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mov;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 0, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mov node
+ */
+ir_node *new_bd_arm_Mov_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *Rm, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = Rm;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mov;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 0, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mov node
+ */
+ir_node *new_bd_arm_Mov_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *Rm, ir_node *Rs, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = Rm;
+	in[1] = Rs;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mov;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 0, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Muf node
+ */
+ir_node *new_bd_arm_Muf(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1, ir_mode *op_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_fpa_fpa,
+		& arm_requirements_fpa_fpa,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Muf;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_farith_attr_t *attr = (arm_farith_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_farith_attributes(res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_fpa_fpa;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mul node
+ */
+ir_node *new_bd_arm_Mul(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mul;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mul node
+ */
+ir_node *new_bd_arm_Mul_v5(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mul;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_not_in_r1;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mvf node
+ */
+ir_node *new_bd_arm_Mvf(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_mode *op_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_fpa_fpa,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mvf;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_farith_attr_t *attr = (arm_farith_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_farith_attributes(res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_fpa_fpa;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mvn node
+ */
+ir_node *new_bd_arm_Mvn_imm(dbg_info *dbgi, ir_node *block, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+	};
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mvn;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 0, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mvn node
+ */
+ir_node *new_bd_arm_Mvn_reg(dbg_info *dbgi, ir_node *block, ir_node *Rm)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = Rm;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mvn;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 0, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mvn node
+ */
+ir_node *new_bd_arm_Mvn_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *Rm, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = Rm;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mvn;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 0, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mvn node
+ */
+ir_node *new_bd_arm_Mvn_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *Rm, ir_node *Rs, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = Rm;
+	in[1] = Rs;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Mvn;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 0, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Or node
+ */
+ir_node *new_bd_arm_Or_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Or;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Or node
+ */
+ir_node *new_bd_arm_Or_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Or;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Or node
+ */
+ir_node *new_bd_arm_Or_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Or;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Or node
+ */
+ir_node *new_bd_arm_Or_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Or;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct OrPl node
+ */
+ir_node *new_bd_arm_OrPl(dbg_info *dbgi, ir_node *block, ir_node *falseval, ir_node *flags, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = falseval;
+	in[1] = flags;
+	in[2] = left;
+	in[3] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_OrPl;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 3, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_in_r3;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct OrPl_t node
+ */
+ir_node *new_bd_arm_OrPl_t(dbg_info *dbgi, ir_node *block, ir_node *falseval, ir_node *flags, ir_node *left, ir_node *right, ir_mode *mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 0;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = falseval;
+	in[1] = flags;
+	in[2] = left;
+	in[3] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_OrPl_t;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pkhbt node
+ */
+ir_node *new_bd_arm_Pkhbt_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Pkhbt;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pkhbt node
+ */
+ir_node *new_bd_arm_Pkhbt_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Pkhbt;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pkhbt node
+ */
+ir_node *new_bd_arm_Pkhbt_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Pkhbt;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pkhbt node
+ */
+ir_node *new_bd_arm_Pkhbt_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Pkhbt;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pkhtb node
+ */
+ir_node *new_bd_arm_Pkhtb_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Pkhtb;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pkhtb node
+ */
+ir_node *new_bd_arm_Pkhtb_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Pkhtb;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pkhtb node
+ */
+ir_node *new_bd_arm_Pkhtb_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Pkhtb;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pkhtb node
+ */
+ir_node *new_bd_arm_Pkhtb_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Pkhtb;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Return node
+ */
+ir_node *new_bd_arm_Return(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[])
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Return;
+	ir_mode  *mode = mode_X;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RsC node
+ */
+ir_node *new_bd_arm_RsC_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *flags, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_RsC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RsC node
+ */
+ir_node *new_bd_arm_RsC_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *flags)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_RsC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RsC node
+ */
+ir_node *new_bd_arm_RsC_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *flags, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_RsC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RsC node
+ */
+ir_node *new_bd_arm_RsC_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, ir_node *flags, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+	in[3] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_RsC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Rsb node
+ */
+ir_node *new_bd_arm_Rsb_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Rsb;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Rsb node
+ */
+ir_node *new_bd_arm_Rsb_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Rsb;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Rsb node
+ */
+ir_node *new_bd_arm_Rsb_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Rsb;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Rsb node
+ */
+ir_node *new_bd_arm_Rsb_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Rsb;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RsbS node
+ */
+ir_node *new_bd_arm_RsbS_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_RsbS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RsbS node
+ */
+ir_node *new_bd_arm_RsbS_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_RsbS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RsbS node
+ */
+ir_node *new_bd_arm_RsbS_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_RsbS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RsbS node
+ */
+ir_node *new_bd_arm_RsbS_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_RsbS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SMulL node
+ */
+ir_node *new_bd_arm_SMulL(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SMulL;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SMulL_t node
+ */
+ir_node *new_bd_arm_SMulL_t(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SMulL_t;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SbC node
+ */
+ir_node *new_bd_arm_SbC_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *flags, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SbC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SbC node
+ */
+ir_node *new_bd_arm_SbC_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *flags)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SbC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SbC node
+ */
+ir_node *new_bd_arm_SbC_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *flags, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SbC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SbC node
+ */
+ir_node *new_bd_arm_SbC_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, ir_node *flags, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+	in[3] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SbC;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SbC_t node
+ */
+ir_node *new_bd_arm_SbC_t(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *flags, ir_mode *mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 0;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SbC_t;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Start node
+ */
+ir_node *new_bd_arm_Start(dbg_info *dbgi, ir_node *block, int n_res)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_schedule_first;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Start;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Stf node
+ */
+ir_node *new_bd_arm_Stf(dbg_info *dbgi, ir_node *block, ir_node *ptr, ir_node *val, ir_node *mem, ir_mode *ls_mode, ir_entity *entity, int entity_sign, long offset, bool is_frame_entity)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_fpa_fpa,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = ptr;
+	in[1] = val;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Stf;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_load_store_attr_t *attr = (arm_load_store_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_load_store_attributes(res, ls_mode, entity, entity_sign, offset, is_frame_entity);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Str node
+ */
+ir_node *new_bd_arm_Str(dbg_info *dbgi, ir_node *block, ir_node *ptr, ir_node *val, ir_node *mem, ir_mode *ls_mode, ir_entity *entity, int entity_sign, long offset, bool is_frame_entity)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = ptr;
+	in[1] = val;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Str;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_load_store_attr_t *attr = (arm_load_store_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_load_store_attributes(res, ls_mode, entity, entity_sign, offset, is_frame_entity);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sub node
+ */
+ir_node *new_bd_arm_Sub_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Sub;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sub node
+ */
+ir_node *new_bd_arm_Sub_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Sub;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sub node
+ */
+ir_node *new_bd_arm_Sub_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Sub;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sub node
+ */
+ir_node *new_bd_arm_Sub_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Sub;
+	ir_mode  *mode = arm_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SubS node
+ */
+ir_node *new_bd_arm_SubS_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SubS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SubS node
+ */
+ir_node *new_bd_arm_SubS_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SubS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SubS node
+ */
+ir_node *new_bd_arm_SubS_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SubS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SubS node
+ */
+ir_node *new_bd_arm_SubS_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SubS;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_shifter_operand_t *attr = (arm_shifter_operand_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SubS_t node
+ */
+ir_node *new_bd_arm_SubS_t(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SubS_t;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Suf node
+ */
+ir_node *new_bd_arm_Suf(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1, ir_mode *op_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_fpa_fpa,
+		& arm_requirements_fpa_fpa,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Suf;
+	ir_mode  *mode = mode_F;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_farith_attr_t *attr = (arm_farith_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	init_arm_farith_attributes(res, op_mode);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_fpa_fpa;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SwitchJmp node
+ */
+ir_node *new_bd_arm_SwitchJmp(dbg_info *dbgi, ir_node *block, ir_node *op0, int n_res, const ir_switch_table *table)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_SwitchJmp;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_SwitchJmp_attr_t *attr = (arm_SwitchJmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_SwitchJmp_attributes(res, table);
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Tst node
+ */
+ir_node *new_bd_arm_Tst_imm(dbg_info *dbgi, ir_node *block, ir_node *left, unsigned char immediate_value, unsigned char immediate_rot, bool ins_permuted, bool is_unsigned)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Tst;
+	ir_mode  *mode = arm_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_cmp_attr_t *attr = (arm_cmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, immediate_value, ARM_SHF_IMM, immediate_rot);
+	init_arm_cmp_attr(res, ins_permuted, is_unsigned);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Tst node
+ */
+ir_node *new_bd_arm_Tst_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, bool ins_permuted, bool is_unsigned)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Tst;
+	ir_mode  *mode = arm_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_cmp_attr_t *attr = (arm_cmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, ARM_SHF_REG, 0);
+	init_arm_cmp_attr(res, ins_permuted, is_unsigned);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Tst node
+ */
+ir_node *new_bd_arm_Tst_reg_shift_imm(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, arm_shift_modifier_t shift_modifier, unsigned shift_immediate, bool ins_permuted, bool is_unsigned)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Tst;
+	ir_mode  *mode = arm_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_cmp_attr_t *attr = (arm_cmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, shift_immediate);
+	init_arm_cmp_attr(res, ins_permuted, is_unsigned);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Tst node
+ */
+ir_node *new_bd_arm_Tst_reg_shift_reg(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *shift, arm_shift_modifier_t shift_modifier, bool ins_permuted, bool is_unsigned)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = shift;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_Tst;
+	ir_mode  *mode = arm_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_cmp_attr_t *attr = (arm_cmp_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+
+	init_arm_shifter_operand(res, 1, 0, shift_modifier, 0);
+	init_arm_cmp_attr(res, ins_permuted, is_unsigned);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct UMulL node
+ */
+ir_node *new_bd_arm_UMulL(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arm_requirements_gp_gp,
+		& arm_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_UMulL;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_attr_t *attr = (arm_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_gp_gp;
+	out_infos[1].req = &arm_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct UMulL_t node
+ */
+ir_node *new_bd_arm_UMulL_t(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_UMulL_t;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fConst node
+ */
+ir_node *new_bd_arm_fConst(dbg_info *dbgi, ir_node *block, ir_tarval *tv)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_arm_fConst;
+	ir_mode  *mode = get_tarval_mode(tv);
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	arm_fConst_attr_t *attr = (arm_fConst_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_arm_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arm_requirements_fpa_fpa;
+
+	attr->tv = tv;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+
+
+/**
+ * Creates the arm specific Firm machine operations
+ * needed for the assembler irgs.
+ */
+void arm_create_opcodes(void)
+{
+	ir_op *op;
+	int    cur_opcode = get_next_ir_opcodes(iro_arm_last);
+
+	arm_opcode_start = cur_opcode;
+	op = new_ir_op(cur_opcode + iro_arm_AdC, "arm_AdC", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_AdC = op;
+	op = new_ir_op(cur_opcode + iro_arm_AdC_t, "arm_AdC_t", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, arm_op_tag);
+	op_arm_AdC_t = op;
+	op = new_ir_op(cur_opcode + iro_arm_Add, "arm_Add", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Add = op;
+	op = new_ir_op(cur_opcode + iro_arm_AddS, "arm_AddS", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_AddS = op;
+	op = new_ir_op(cur_opcode + iro_arm_AddS_t, "arm_AddS_t", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, arm_op_tag);
+	op_arm_AddS_t = op;
+	op = new_ir_op(cur_opcode + iro_arm_Address, "arm_Address", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(arm_Address_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_Address_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Address = op;
+	op = new_ir_op(cur_opcode + iro_arm_Adf, "arm_Adf", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_farith_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_farith_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Adf = op;
+	op = new_ir_op(cur_opcode + iro_arm_And, "arm_And", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_And = op;
+	op = new_ir_op(cur_opcode + iro_arm_B, "arm_B", op_pin_state_pinned, irop_flag_cfopcode|irop_flag_forking, oparity_any, -1, sizeof(arm_CondJmp_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_CondJmp_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_B = op;
+	op = new_ir_op(cur_opcode + iro_arm_Bic, "arm_Bic", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Bic = op;
+	op = new_ir_op(cur_opcode + iro_arm_Bl, "arm_Bl", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(arm_Address_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_Address_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Bl = op;
+	op = new_ir_op(cur_opcode + iro_arm_Clz, "arm_Clz", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Clz = op;
+	op = new_ir_op(cur_opcode + iro_arm_Cmfe, "arm_Cmfe", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_cmp_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_cmp_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Cmfe = op;
+	op = new_ir_op(cur_opcode + iro_arm_Cmp, "arm_Cmp", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_cmp_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_cmp_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Cmp = op;
+	op = new_ir_op(cur_opcode + iro_arm_CopyB, "arm_CopyB", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(arm_CopyB_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_CopyB_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_CopyB = op;
+	op = new_ir_op(cur_opcode + iro_arm_Dvf, "arm_Dvf", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_farith_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_farith_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Dvf = op;
+	op = new_ir_op(cur_opcode + iro_arm_Eor, "arm_Eor", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Eor = op;
+	op = new_ir_op(cur_opcode + iro_arm_FltX, "arm_FltX", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_farith_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_farith_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_FltX = op;
+	op = new_ir_op(cur_opcode + iro_arm_FrameAddr, "arm_FrameAddr", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(arm_Address_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_Address_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_FrameAddr = op;
+	op = new_ir_op(cur_opcode + iro_arm_Jmp, "arm_Jmp", op_pin_state_pinned, irop_flag_cfopcode, oparity_any, -1, sizeof(arm_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Jmp = op;
+	op = new_ir_op(cur_opcode + iro_arm_Ldf, "arm_Ldf", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(arm_load_store_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_load_store_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Ldf = op;
+	op = new_ir_op(cur_opcode + iro_arm_Ldr, "arm_Ldr", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(arm_load_store_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_load_store_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Ldr = op;
+	op = new_ir_op(cur_opcode + iro_arm_LinkLdrPC, "arm_LinkLdrPC", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(arm_load_store_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_load_store_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_LinkLdrPC = op;
+	op = new_ir_op(cur_opcode + iro_arm_LinkMovPC, "arm_LinkMovPC", op_pin_state_exc_pinned, irop_flag_none, oparity_variable, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_LinkMovPC = op;
+	op = new_ir_op(cur_opcode + iro_arm_Mla, "arm_Mla", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Mla = op;
+	op = new_ir_op(cur_opcode + iro_arm_Mls, "arm_Mls", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Mls = op;
+	op = new_ir_op(cur_opcode + iro_arm_Mov, "arm_Mov", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Mov = op;
+	op = new_ir_op(cur_opcode + iro_arm_Muf, "arm_Muf", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_farith_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_farith_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Muf = op;
+	op = new_ir_op(cur_opcode + iro_arm_Mul, "arm_Mul", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Mul = op;
+	op = new_ir_op(cur_opcode + iro_arm_Mvf, "arm_Mvf", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_farith_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_farith_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Mvf = op;
+	op = new_ir_op(cur_opcode + iro_arm_Mvn, "arm_Mvn", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Mvn = op;
+	op = new_ir_op(cur_opcode + iro_arm_Or, "arm_Or", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Or = op;
+	op = new_ir_op(cur_opcode + iro_arm_OrPl, "arm_OrPl", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_OrPl = op;
+	op = new_ir_op(cur_opcode + iro_arm_OrPl_t, "arm_OrPl_t", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, arm_op_tag);
+	op_arm_OrPl_t = op;
+	op = new_ir_op(cur_opcode + iro_arm_Pkhbt, "arm_Pkhbt", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Pkhbt = op;
+	op = new_ir_op(cur_opcode + iro_arm_Pkhtb, "arm_Pkhtb", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Pkhtb = op;
+	op = new_ir_op(cur_opcode + iro_arm_Return, "arm_Return", op_pin_state_pinned, irop_flag_cfopcode, oparity_variable, -1, sizeof(arm_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Return = op;
+	op = new_ir_op(cur_opcode + iro_arm_RsC, "arm_RsC", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_RsC = op;
+	op = new_ir_op(cur_opcode + iro_arm_Rsb, "arm_Rsb", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Rsb = op;
+	op = new_ir_op(cur_opcode + iro_arm_RsbS, "arm_RsbS", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_RsbS = op;
+	op = new_ir_op(cur_opcode + iro_arm_SMulL, "arm_SMulL", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_SMulL = op;
+	op = new_ir_op(cur_opcode + iro_arm_SMulL_t, "arm_SMulL_t", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, arm_op_tag);
+	op_arm_SMulL_t = op;
+	op = new_ir_op(cur_opcode + iro_arm_SbC, "arm_SbC", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_SbC = op;
+	op = new_ir_op(cur_opcode + iro_arm_SbC_t, "arm_SbC_t", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, arm_op_tag);
+	op_arm_SbC_t = op;
+	op = new_ir_op(cur_opcode + iro_arm_Start, "arm_Start", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(arm_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Start = op;
+	op = new_ir_op(cur_opcode + iro_arm_Stf, "arm_Stf", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(arm_load_store_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_load_store_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Stf = op;
+	op = new_ir_op(cur_opcode + iro_arm_Str, "arm_Str", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(arm_load_store_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_load_store_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Str = op;
+	op = new_ir_op(cur_opcode + iro_arm_Sub, "arm_Sub", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Sub = op;
+	op = new_ir_op(cur_opcode + iro_arm_SubS, "arm_SubS", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_shifter_operand_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_shifter_operands_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_SubS = op;
+	op = new_ir_op(cur_opcode + iro_arm_SubS_t, "arm_SubS_t", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, arm_op_tag);
+	op_arm_SubS_t = op;
+	op = new_ir_op(cur_opcode + iro_arm_Suf, "arm_Suf", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_farith_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_farith_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Suf = op;
+	op = new_ir_op(cur_opcode + iro_arm_SwitchJmp, "arm_SwitchJmp", op_pin_state_pinned, irop_flag_cfopcode|irop_flag_forking, oparity_any, -1, sizeof(arm_SwitchJmp_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_SwitchJmp_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_SwitchJmp = op;
+	op = new_ir_op(cur_opcode + iro_arm_Tst, "arm_Tst", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_cmp_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_cmp_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_Tst = op;
+	op = new_ir_op(cur_opcode + iro_arm_UMulL, "arm_UMulL", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(arm_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_UMulL = op;
+	op = new_ir_op(cur_opcode + iro_arm_UMulL_t, "arm_UMulL_t", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, arm_op_tag);
+	op_arm_UMulL_t = op;
+	op = new_ir_op(cur_opcode + iro_arm_fConst, "arm_fConst", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(arm_fConst_attr_t));
+	set_op_dump(op, arm_dump_node);
+	set_op_attrs_equal(op, arm_fConst_attrs_equal);
+	set_op_copy_attr(op, arm_copy_attr);
+	set_op_tag(op, arm_op_tag);
+	op_arm_fConst = op;
+
+}
+
+void arm_free_opcodes(void)
+{
+	free_ir_op(op_arm_AdC); op_arm_AdC = NULL;
+	free_ir_op(op_arm_AdC_t); op_arm_AdC_t = NULL;
+	free_ir_op(op_arm_Add); op_arm_Add = NULL;
+	free_ir_op(op_arm_AddS); op_arm_AddS = NULL;
+	free_ir_op(op_arm_AddS_t); op_arm_AddS_t = NULL;
+	free_ir_op(op_arm_Address); op_arm_Address = NULL;
+	free_ir_op(op_arm_Adf); op_arm_Adf = NULL;
+	free_ir_op(op_arm_And); op_arm_And = NULL;
+	free_ir_op(op_arm_B); op_arm_B = NULL;
+	free_ir_op(op_arm_Bic); op_arm_Bic = NULL;
+	free_ir_op(op_arm_Bl); op_arm_Bl = NULL;
+	free_ir_op(op_arm_Clz); op_arm_Clz = NULL;
+	free_ir_op(op_arm_Cmfe); op_arm_Cmfe = NULL;
+	free_ir_op(op_arm_Cmp); op_arm_Cmp = NULL;
+	free_ir_op(op_arm_CopyB); op_arm_CopyB = NULL;
+	free_ir_op(op_arm_Dvf); op_arm_Dvf = NULL;
+	free_ir_op(op_arm_Eor); op_arm_Eor = NULL;
+	free_ir_op(op_arm_FltX); op_arm_FltX = NULL;
+	free_ir_op(op_arm_FrameAddr); op_arm_FrameAddr = NULL;
+	free_ir_op(op_arm_Jmp); op_arm_Jmp = NULL;
+	free_ir_op(op_arm_Ldf); op_arm_Ldf = NULL;
+	free_ir_op(op_arm_Ldr); op_arm_Ldr = NULL;
+	free_ir_op(op_arm_LinkLdrPC); op_arm_LinkLdrPC = NULL;
+	free_ir_op(op_arm_LinkMovPC); op_arm_LinkMovPC = NULL;
+	free_ir_op(op_arm_Mla); op_arm_Mla = NULL;
+	free_ir_op(op_arm_Mls); op_arm_Mls = NULL;
+	free_ir_op(op_arm_Mov); op_arm_Mov = NULL;
+	free_ir_op(op_arm_Muf); op_arm_Muf = NULL;
+	free_ir_op(op_arm_Mul); op_arm_Mul = NULL;
+	free_ir_op(op_arm_Mvf); op_arm_Mvf = NULL;
+	free_ir_op(op_arm_Mvn); op_arm_Mvn = NULL;
+	free_ir_op(op_arm_Or); op_arm_Or = NULL;
+	free_ir_op(op_arm_OrPl); op_arm_OrPl = NULL;
+	free_ir_op(op_arm_OrPl_t); op_arm_OrPl_t = NULL;
+	free_ir_op(op_arm_Pkhbt); op_arm_Pkhbt = NULL;
+	free_ir_op(op_arm_Pkhtb); op_arm_Pkhtb = NULL;
+	free_ir_op(op_arm_Return); op_arm_Return = NULL;
+	free_ir_op(op_arm_RsC); op_arm_RsC = NULL;
+	free_ir_op(op_arm_Rsb); op_arm_Rsb = NULL;
+	free_ir_op(op_arm_RsbS); op_arm_RsbS = NULL;
+	free_ir_op(op_arm_SMulL); op_arm_SMulL = NULL;
+	free_ir_op(op_arm_SMulL_t); op_arm_SMulL_t = NULL;
+	free_ir_op(op_arm_SbC); op_arm_SbC = NULL;
+	free_ir_op(op_arm_SbC_t); op_arm_SbC_t = NULL;
+	free_ir_op(op_arm_Start); op_arm_Start = NULL;
+	free_ir_op(op_arm_Stf); op_arm_Stf = NULL;
+	free_ir_op(op_arm_Str); op_arm_Str = NULL;
+	free_ir_op(op_arm_Sub); op_arm_Sub = NULL;
+	free_ir_op(op_arm_SubS); op_arm_SubS = NULL;
+	free_ir_op(op_arm_SubS_t); op_arm_SubS_t = NULL;
+	free_ir_op(op_arm_Suf); op_arm_Suf = NULL;
+	free_ir_op(op_arm_SwitchJmp); op_arm_SwitchJmp = NULL;
+	free_ir_op(op_arm_Tst); op_arm_Tst = NULL;
+	free_ir_op(op_arm_UMulL); op_arm_UMulL = NULL;
+	free_ir_op(op_arm_UMulL_t); op_arm_UMulL_t = NULL;
+	free_ir_op(op_arm_fConst); op_arm_fConst = NULL;
+
+}
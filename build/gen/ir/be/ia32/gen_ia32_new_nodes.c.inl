@@ -0,0 +1,10838 @@
+#include "gen_ia32_regalloc_if.h"
+#include "fourcc.h"
+#include "irgopt.h"
+
+ir_op *op_ia32_Adc = NULL;
+ir_op *op_ia32_Add = NULL;
+ir_op *op_ia32_AddMem = NULL;
+ir_op *op_ia32_AddSP = NULL;
+ir_op *op_ia32_And = NULL;
+ir_op *op_ia32_AndMem = NULL;
+ir_op *op_ia32_Breakpoint = NULL;
+ir_op *op_ia32_Bsf = NULL;
+ir_op *op_ia32_Bsr = NULL;
+ir_op *op_ia32_Bswap = NULL;
+ir_op *op_ia32_Bswap16 = NULL;
+ir_op *op_ia32_Bt = NULL;
+ir_op *op_ia32_CMovcc = NULL;
+ir_op *op_ia32_Call = NULL;
+ir_op *op_ia32_ChangeCW = NULL;
+ir_op *op_ia32_ClimbFrame = NULL;
+ir_op *op_ia32_Cltd = NULL;
+ir_op *op_ia32_Cmc = NULL;
+ir_op *op_ia32_Cmp = NULL;
+ir_op *op_ia32_CmpXChgMem = NULL;
+ir_op *op_ia32_Const = NULL;
+ir_op *op_ia32_Conv_FP2FP = NULL;
+ir_op *op_ia32_Conv_FP2I = NULL;
+ir_op *op_ia32_Conv_I2FP = NULL;
+ir_op *op_ia32_Conv_I2I = NULL;
+ir_op *op_ia32_CopyB = NULL;
+ir_op *op_ia32_CopyB_i = NULL;
+ir_op *op_ia32_CopyEbpEsp = NULL;
+ir_op *op_ia32_CvtSI2SD = NULL;
+ir_op *op_ia32_CvtSI2SS = NULL;
+ir_op *op_ia32_Cwtl = NULL;
+ir_op *op_ia32_Dec = NULL;
+ir_op *op_ia32_DecMem = NULL;
+ir_op *op_ia32_Div = NULL;
+ir_op *op_ia32_Enter = NULL;
+ir_op *op_ia32_FldCW = NULL;
+ir_op *op_ia32_FnstCW = NULL;
+ir_op *op_ia32_FnstCWNOP = NULL;
+ir_op *op_ia32_FtstFnstsw = NULL;
+ir_op *op_ia32_FucomFnstsw = NULL;
+ir_op *op_ia32_Fucomi = NULL;
+ir_op *op_ia32_FucomppFnstsw = NULL;
+ir_op *op_ia32_GetEIP = NULL;
+ir_op *op_ia32_IDiv = NULL;
+ir_op *op_ia32_IJmp = NULL;
+ir_op *op_ia32_IMul = NULL;
+ir_op *op_ia32_IMul1OP = NULL;
+ir_op *op_ia32_IMulImm = NULL;
+ir_op *op_ia32_Immediate = NULL;
+ir_op *op_ia32_Inc = NULL;
+ir_op *op_ia32_IncMem = NULL;
+ir_op *op_ia32_Inport = NULL;
+ir_op *op_ia32_Jcc = NULL;
+ir_op *op_ia32_Jmp = NULL;
+ir_op *op_ia32_LdTls = NULL;
+ir_op *op_ia32_Lea = NULL;
+ir_op *op_ia32_Leave = NULL;
+ir_op *op_ia32_Load = NULL;
+ir_op *op_ia32_Minus64 = NULL;
+ir_op *op_ia32_Mul = NULL;
+ir_op *op_ia32_Neg = NULL;
+ir_op *op_ia32_NegMem = NULL;
+ir_op *op_ia32_NoReg_FP = NULL;
+ir_op *op_ia32_NoReg_GP = NULL;
+ir_op *op_ia32_NoReg_XMM = NULL;
+ir_op *op_ia32_Not = NULL;
+ir_op *op_ia32_NotMem = NULL;
+ir_op *op_ia32_Or = NULL;
+ir_op *op_ia32_OrMem = NULL;
+ir_op *op_ia32_Outport = NULL;
+ir_op *op_ia32_Pop = NULL;
+ir_op *op_ia32_PopMem = NULL;
+ir_op *op_ia32_Popcnt = NULL;
+ir_op *op_ia32_Prefetch = NULL;
+ir_op *op_ia32_Prefetch0 = NULL;
+ir_op *op_ia32_Prefetch1 = NULL;
+ir_op *op_ia32_Prefetch2 = NULL;
+ir_op *op_ia32_PrefetchNTA = NULL;
+ir_op *op_ia32_PrefetchW = NULL;
+ir_op *op_ia32_Push = NULL;
+ir_op *op_ia32_PushEax = NULL;
+ir_op *op_ia32_Return = NULL;
+ir_op *op_ia32_Rol = NULL;
+ir_op *op_ia32_RolMem = NULL;
+ir_op *op_ia32_Ror = NULL;
+ir_op *op_ia32_RorMem = NULL;
+ir_op *op_ia32_Sahf = NULL;
+ir_op *op_ia32_Sar = NULL;
+ir_op *op_ia32_SarMem = NULL;
+ir_op *op_ia32_Sbb = NULL;
+ir_op *op_ia32_Sbb0 = NULL;
+ir_op *op_ia32_Setcc = NULL;
+ir_op *op_ia32_SetccMem = NULL;
+ir_op *op_ia32_Shl = NULL;
+ir_op *op_ia32_ShlD = NULL;
+ir_op *op_ia32_ShlMem = NULL;
+ir_op *op_ia32_Shr = NULL;
+ir_op *op_ia32_ShrD = NULL;
+ir_op *op_ia32_ShrMem = NULL;
+ir_op *op_ia32_Start = NULL;
+ir_op *op_ia32_Stc = NULL;
+ir_op *op_ia32_Store = NULL;
+ir_op *op_ia32_Sub = NULL;
+ir_op *op_ia32_SubMem = NULL;
+ir_op *op_ia32_SubSP = NULL;
+ir_op *op_ia32_SwitchJmp = NULL;
+ir_op *op_ia32_Test = NULL;
+ir_op *op_ia32_UD2 = NULL;
+ir_op *op_ia32_Ucomi = NULL;
+ir_op *op_ia32_Unknown = NULL;
+ir_op *op_ia32_Xor = NULL;
+ir_op *op_ia32_Xor0 = NULL;
+ir_op *op_ia32_XorHighLow = NULL;
+ir_op *op_ia32_XorMem = NULL;
+ir_op *op_ia32_emms = NULL;
+ir_op *op_ia32_fabs = NULL;
+ir_op *op_ia32_fadd = NULL;
+ir_op *op_ia32_fchs = NULL;
+ir_op *op_ia32_fdiv = NULL;
+ir_op *op_ia32_fdup = NULL;
+ir_op *op_ia32_femms = NULL;
+ir_op *op_ia32_ffreep = NULL;
+ir_op *op_ia32_fild = NULL;
+ir_op *op_ia32_fist = NULL;
+ir_op *op_ia32_fisttp = NULL;
+ir_op *op_ia32_fld = NULL;
+ir_op *op_ia32_fld1 = NULL;
+ir_op *op_ia32_fldl2e = NULL;
+ir_op *op_ia32_fldl2t = NULL;
+ir_op *op_ia32_fldlg2 = NULL;
+ir_op *op_ia32_fldln2 = NULL;
+ir_op *op_ia32_fldpi = NULL;
+ir_op *op_ia32_fldz = NULL;
+ir_op *op_ia32_fmul = NULL;
+ir_op *op_ia32_fpop = NULL;
+ir_op *op_ia32_fst = NULL;
+ir_op *op_ia32_fsub = NULL;
+ir_op *op_ia32_fxch = NULL;
+ir_op *op_ia32_l_Adc = NULL;
+ir_op *op_ia32_l_Add = NULL;
+ir_op *op_ia32_l_FloattoLL = NULL;
+ir_op *op_ia32_l_IMul = NULL;
+ir_op *op_ia32_l_LLtoFloat = NULL;
+ir_op *op_ia32_l_Minus64 = NULL;
+ir_op *op_ia32_l_Mul = NULL;
+ir_op *op_ia32_l_Sbb = NULL;
+ir_op *op_ia32_l_Sub = NULL;
+ir_op *op_ia32_xAdd = NULL;
+ir_op *op_ia32_xAllOnes = NULL;
+ir_op *op_ia32_xAnd = NULL;
+ir_op *op_ia32_xAndNot = NULL;
+ir_op *op_ia32_xDiv = NULL;
+ir_op *op_ia32_xLoad = NULL;
+ir_op *op_ia32_xMax = NULL;
+ir_op *op_ia32_xMin = NULL;
+ir_op *op_ia32_xMovd = NULL;
+ir_op *op_ia32_xMul = NULL;
+ir_op *op_ia32_xOr = NULL;
+ir_op *op_ia32_xPslld = NULL;
+ir_op *op_ia32_xPsllq = NULL;
+ir_op *op_ia32_xPsrld = NULL;
+ir_op *op_ia32_xPzero = NULL;
+ir_op *op_ia32_xStore = NULL;
+ir_op *op_ia32_xSub = NULL;
+ir_op *op_ia32_xUnknown = NULL;
+ir_op *op_ia32_xXor = NULL;
+ir_op *op_ia32_xZero = NULL;
+ir_op *op_ia32_xxAddpd = NULL;
+ir_op *op_ia32_xxAddps = NULL;
+ir_op *op_ia32_xxBroadcast16 = NULL;
+ir_op *op_ia32_xxBroadcast32 = NULL;
+ir_op *op_ia32_xxBroadcast8 = NULL;
+ir_op *op_ia32_xxBroadcastpd = NULL;
+ir_op *op_ia32_xxBroadcastps = NULL;
+ir_op *op_ia32_xxLoad = NULL;
+ir_op *op_ia32_xxMulpd = NULL;
+ir_op *op_ia32_xxMulps = NULL;
+ir_op *op_ia32_xxPaddb = NULL;
+ir_op *op_ia32_xxPaddd = NULL;
+ir_op *op_ia32_xxPaddq = NULL;
+ir_op *op_ia32_xxPaddw = NULL;
+ir_op *op_ia32_xxPand = NULL;
+ir_op *op_ia32_xxPor = NULL;
+ir_op *op_ia32_xxPsubb = NULL;
+ir_op *op_ia32_xxPsubd = NULL;
+ir_op *op_ia32_xxPsubq = NULL;
+ir_op *op_ia32_xxPsubw = NULL;
+ir_op *op_ia32_xxPxor = NULL;
+ir_op *op_ia32_xxStore = NULL;
+ir_op *op_ia32_xxSubpd = NULL;
+ir_op *op_ia32_xxSubps = NULL;
+
+
+static int ia32_opcode_start = -1;
+
+
+/** A tag for the ia32 opcodes. */
+#define ia32_op_tag FOURCC('I', 'A', '3', '2')
+
+/** Return 1 if the given opcode is a ia32 machine op, 0 otherwise */
+int is_ia32_op(const ir_op *op)
+{
+	return get_op_tag(op) == ia32_op_tag;
+}
+
+/** Return 1 if the given node is a ia32 machine node, 0 otherwise */
+int is_ia32_irn(const ir_node *node)
+{
+	return is_ia32_op(get_irn_op(node));
+}
+
+int get_ia32_irn_opcode(const ir_node *node)
+{
+	assert(is_ia32_irn(node));
+	return get_irn_opcode(node) - ia32_opcode_start;
+}
+
+#ifdef BIT
+#undef BIT
+#endif
+#define BIT(x)  (1 << (x))
+
+static const unsigned ia32_limit_gp_eax_ebx_ecx_edx[] = { BIT(REG_GP_EAX) | BIT(REG_GP_EBX) | BIT(REG_GP_ECX) | BIT(REG_GP_EDX), 0 };
+static const unsigned ia32_limit_gp_esp[] = { BIT(REG_GP_ESP), 0 };
+static const unsigned ia32_limit_flags_eflags[] = { BIT(REG_FLAGS_EFLAGS) };
+static const unsigned ia32_limit_fp_cw_fpcw[] = { BIT(REG_FP_CW_FPCW) };
+static const unsigned ia32_limit_gp_eax[] = { BIT(REG_GP_EAX), 0 };
+static const unsigned ia32_limit_gp_edx[] = { BIT(REG_GP_EDX), 0 };
+static const unsigned ia32_limit_gp_edi[] = { BIT(REG_GP_EDI), 0 };
+static const unsigned ia32_limit_gp_esi[] = { BIT(REG_GP_ESI), 0 };
+static const unsigned ia32_limit_gp_ecx[] = { BIT(REG_GP_ECX), 0 };
+static const unsigned ia32_limit_gp_ebp[] = { BIT(REG_GP_EBP), 0 };
+static const unsigned ia32_limit_gp_gp_NOREG[] = { BIT(REG_GP_GP_NOREG), 0 };
+static const unsigned ia32_limit_fp_fp_NOREG[] = { BIT(REG_FP_FP_NOREG), 0 };
+static const unsigned ia32_limit_xmm_xmm_NOREG[] = { BIT(REG_XMM_XMM_NOREG), 0 };
+
+static const arch_register_req_t ia32_requirements_gp_gp = {
+	.cls   = &ia32_reg_classes[CLASS_ia32_gp],
+	.width = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_flags_flags = {
+	.cls   = &ia32_reg_classes[CLASS_ia32_flags],
+	.width = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_in_r4_in_r5 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = NULL,
+	.should_be_same    = 24,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_eax_ebx_ecx_edx = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_eax_ebx_ecx_edx,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_esp = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_esp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_esp_I = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_esp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+	.ignore  = true,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_in_r1 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = NULL,
+	.should_be_same    = 1,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_flags_eflags = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_flags],
+	.limited           = ia32_limit_flags_eflags,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_fp_cw_fpcw = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_fp_cw],
+	.limited           = ia32_limit_fp_cw_fpcw,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_not_in_r1 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = NULL,
+	.should_be_same    = 0,
+	.must_be_different = 1,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_eax = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_eax,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_edx = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_edx,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_xmm_xmm = {
+	.cls   = &ia32_reg_classes[CLASS_ia32_xmm],
+	.width = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_edi = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_edi,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_esi = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_esi,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_ecx = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_ecx,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_ebp = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_ebp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_fp_cw_fp_cw = {
+	.cls   = &ia32_reg_classes[CLASS_ia32_fp_cw],
+	.width = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_fp_fp = {
+	.cls   = &ia32_reg_classes[CLASS_ia32_fp],
+	.width = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_gp_NOREG_I = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_gp_NOREG,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+	.ignore  = true,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_ebp_I = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = ia32_limit_gp_ebp,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+	.ignore  = true,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_in_r2 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = NULL,
+	.should_be_same    = 2,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_fp_fp_NOREG_I = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_fp],
+	.limited           = ia32_limit_fp_fp_NOREG,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+	.ignore  = true,
+};
+
+
+static const arch_register_req_t ia32_requirements_xmm_xmm_NOREG_I = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_xmm],
+	.limited           = ia32_limit_xmm_xmm_NOREG,
+	.should_be_same    = 0,
+	.must_be_different = 0,
+	.width             = 1,
+	.ignore  = true,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_in_r1_not_in_r2 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = NULL,
+	.should_be_same    = 1,
+	.must_be_different = 2,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_in_r4 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = NULL,
+	.should_be_same    = 8,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_in_r1_not_in_r2_not_in_r3 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = NULL,
+	.should_be_same    = 1,
+	.must_be_different = 6,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_gp_in_r1_in_r2 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_gp],
+	.limited           = NULL,
+	.should_be_same    = 3,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_fp_in_r4 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_fp],
+	.limited           = NULL,
+	.should_be_same    = 8,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_xmm_in_r4_in_r5 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_xmm],
+	.limited           = NULL,
+	.should_be_same    = 24,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_xmm_in_r4_not_in_r5 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_xmm],
+	.limited           = NULL,
+	.should_be_same    = 8,
+	.must_be_different = 16,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_xmm_in_r1_not_in_r2 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_xmm],
+	.limited           = NULL,
+	.should_be_same    = 1,
+	.must_be_different = 2,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_xmm_in_r4 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_xmm],
+	.limited           = NULL,
+	.should_be_same    = 8,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+static const arch_register_req_t ia32_requirements_xmm_in_r1 = {
+	.cls               = &ia32_reg_classes[CLASS_ia32_xmm],
+	.limited           = NULL,
+	.should_be_same    = 1,
+	.must_be_different = 0,
+	.width             = 1,
+};
+
+
+
+/**
+ * construct Adc node
+ */
+ir_node *new_bd_ia32_Adc(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, ir_node *eflags)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+	in[5] = eflags;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Adc;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_condcode_attr_t *attr = (ia32_condcode_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	x86_condition_code_t condition_code = x86_cc_carry;
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_condcode_attributes(res, condition_code);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Add node
+ */
+ir_node *new_bd_ia32_Add(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Add;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AddMem node
+ */
+ir_node *new_bd_ia32_AddMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_AddMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AddMem node
+ */
+ir_node *new_bd_ia32_AddMem_8bit(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_AddMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AddSP node
+ */
+ir_node *new_bd_ia32_AddSP(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *stack, ir_node *size)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_esp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = stack;
+	in[4] = size;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_AddSP;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_esp_I;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct And node
+ */
+ir_node *new_bd_ia32_And(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_And;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AndMem node
+ */
+ir_node *new_bd_ia32_AndMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_AndMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct AndMem node
+ */
+ir_node *new_bd_ia32_AndMem_8bit(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_AndMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Breakpoint node
+ */
+ir_node *new_bd_ia32_Breakpoint(dbg_info *dbgi, ir_node *block, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Breakpoint;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bsf node
+ */
+ir_node *new_bd_ia32_Bsf(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *operand)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = operand;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Bsf;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bsr node
+ */
+ir_node *new_bd_ia32_Bsr(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *operand)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = operand;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Bsr;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bswap node
+ */
+ir_node *new_bd_ia32_Bswap(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Bswap;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bswap16 node
+ */
+ir_node *new_bd_ia32_Bswap16(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Bswap16;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Bt node
+ */
+ir_node *new_bd_ia32_Bt(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Bt;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct CMovcc node
+ */
+ir_node *new_bd_ia32_CMovcc(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val_false, ir_node *val_true, ir_node *eflags, x86_condition_code_t condition_code)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_flags_eflags,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val_false;
+	in[4] = val_true;
+	in[5] = eflags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_CMovcc;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_condcode_attr_t *attr = (ia32_condcode_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_condcode_attributes(res, condition_code);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r4_in_r5;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Call node
+ */
+ir_node *new_bd_ia32_Call(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], int n_res, unsigned pop, ir_type *call_tp)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Call;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_call_attr_t *attr = (ia32_call_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_call_attributes(res, pop, call_tp);
+		set_ia32_am_support(res, ia32_am_unary);
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ChangeCW node
+ */
+ir_node *new_bd_ia32_ChangeCW(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_not_scheduled;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_ChangeCW;
+	ir_mode  *mode = ia32_mode_fpcw;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_cw_fpcw;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ClimbFrame node
+ */
+ir_node *new_bd_ia32_ClimbFrame(dbg_info *dbgi, ir_node *block, ir_node *frame, unsigned count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = frame;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_ClimbFrame;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_climbframe_attr_t *attr = (ia32_climbframe_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_climbframe_attributes(res, count);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1;
+	out_infos[1].req = &ia32_requirements_gp_not_in_r1;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cltd node
+ */
+ir_node *new_bd_ia32_Cltd(dbg_info *dbgi, ir_node *block, ir_node *val, ir_node *clobbered)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_eax,
+		& ia32_requirements_gp_edx,
+	};
+
+	/* construct in array */
+	in[0] = val;
+	in[1] = clobbered;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Cltd;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_edx;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cmc node
+ */
+ir_node *new_bd_ia32_Cmc(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Cmc;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_condcode_attr_t *attr = (ia32_condcode_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	x86_condition_code_t condition_code = x86_cc_carry;
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_condcode_attributes(res, condition_code);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cmp node
+ */
+ir_node *new_bd_ia32_Cmp(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Cmp;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_flags;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	attr->ins_permuted = ins_permuted;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cmp node
+ */
+ir_node *new_bd_ia32_Cmp_8bit(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Cmp;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_flags;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	attr->ins_permuted = ins_permuted;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct CmpXChgMem node
+ */
+ir_node *new_bd_ia32_CmpXChgMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *old, ir_node *new)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = old;
+	in[4] = new;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_CmpXChgMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Const node
+ */
+ir_node *new_bd_ia32_Const(dbg_info *dbgi, ir_node *block, ir_entity *entity, bool no_pic_adjust, int32_t offset)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Const;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_immediate_attr_t *attr = (ia32_immediate_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_immediate_attributes(res, entity, no_pic_adjust, offset);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Conv_FP2FP node
+ */
+ir_node *new_bd_ia32_Conv_FP2FP(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val, ir_mode *tgt_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Conv_FP2FP;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+
+	attr->ls_mode = tgt_mode;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Conv_FP2I node
+ */
+ir_node *new_bd_ia32_Conv_FP2I(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val, ir_mode *src_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Conv_FP2I;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+
+	attr->ls_mode = src_mode;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Conv_I2FP node
+ */
+ir_node *new_bd_ia32_Conv_I2FP(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val, ir_mode *tgt_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Conv_I2FP;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+
+	attr->ls_mode = tgt_mode;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Conv_I2I node
+ */
+ir_node *new_bd_ia32_Conv_I2I(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val, ir_mode *smaller_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 5;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Conv_I2I;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &arch_no_requirement;
+	out_infos[4].req = &arch_no_requirement;
+
+	attr->ls_mode = smaller_mode;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Conv_I2I node
+ */
+ir_node *new_bd_ia32_Conv_I2I_8bit(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val, ir_mode *smaller_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 5;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Conv_I2I;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &arch_no_requirement;
+	out_infos[4].req = &arch_no_requirement;
+
+	attr->ls_mode = smaller_mode;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct CopyB node
+ */
+ir_node *new_bd_ia32_CopyB(dbg_info *dbgi, ir_node *block, ir_node *dest, ir_node *source, ir_node *count, ir_node *mem, unsigned size)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 4;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_edi,
+		& ia32_requirements_gp_esi,
+		& ia32_requirements_gp_ecx,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = dest;
+	in[1] = source;
+	in[2] = count;
+	in[3] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_CopyB;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_copyb_attr_t *attr = (ia32_copyb_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_copyb_attributes(res, size);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_edi;
+	out_infos[1].req = &ia32_requirements_gp_esi;
+	out_infos[2].req = &ia32_requirements_gp_ecx;
+	out_infos[3].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct CopyB_i node
+ */
+ir_node *new_bd_ia32_CopyB_i(dbg_info *dbgi, ir_node *block, ir_node *dest, ir_node *source, ir_node *mem, unsigned size)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_edi,
+		& ia32_requirements_gp_esi,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = dest;
+	in[1] = source;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_CopyB_i;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_copyb_attr_t *attr = (ia32_copyb_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_copyb_attributes(res, size);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_edi;
+	out_infos[1].req = &ia32_requirements_gp_esi;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct CopyEbpEsp node
+ */
+ir_node *new_bd_ia32_CopyEbpEsp(dbg_info *dbgi, ir_node *block, ir_node *ebp)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_ebp,
+	};
+
+	/* construct in array */
+	in[0] = ebp;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_CopyEbpEsp;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_esp_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct CvtSI2SD node
+ */
+ir_node *new_bd_ia32_CvtSI2SD(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_CvtSI2SD;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct CvtSI2SS node
+ */
+ir_node *new_bd_ia32_CvtSI2SS(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_CvtSI2SS;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Cwtl node
+ */
+ir_node *new_bd_ia32_Cwtl(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_eax,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Cwtl;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Dec node
+ */
+ir_node *new_bd_ia32_Dec(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Dec;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct DecMem node
+ */
+ir_node *new_bd_ia32_DecMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_DecMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Div node
+ */
+ir_node *new_bd_ia32_Div(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *divisor, ir_node *dividend_low, ir_node *dividend_high)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 6;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_eax,
+		& ia32_requirements_gp_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = divisor;
+	in[4] = dividend_low;
+	in[5] = dividend_high;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Div;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &ia32_requirements_gp_edx;
+	out_infos[4].req = &arch_no_requirement;
+	out_infos[5].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Enter node
+ */
+ir_node *new_bd_ia32_Enter(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_esp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Enter;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_ebp;
+	out_infos[1].req = &ia32_requirements_gp_esp_I;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct FldCW node
+ */
+ir_node *new_bd_ia32_FldCW(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_FldCW;
+	ir_mode  *mode = ia32_mode_fpcw;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_cw_fpcw;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct FnstCW node
+ */
+ir_node *new_bd_ia32_FnstCW(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *fpcw)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_fp_cw_fp_cw,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = fpcw;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_FnstCW;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct FnstCWNOP node
+ */
+ir_node *new_bd_ia32_FnstCWNOP(dbg_info *dbgi, ir_node *block, ir_node *fpcw)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_fp_cw_fp_cw,
+	};
+
+	/* construct in array */
+	in[0] = fpcw;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_FnstCWNOP;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct FtstFnstsw node
+ */
+ir_node *new_bd_ia32_FtstFnstsw(dbg_info *dbgi, ir_node *block, ir_node *left, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_FtstFnstsw;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+
+	attr->ins_permuted = ins_permuted;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct FucomFnstsw node
+ */
+ir_node *new_bd_ia32_FucomFnstsw(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_FucomFnstsw;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+
+	attr->attr.ins_permuted = ins_permuted;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Fucomi node
+ */
+ir_node *new_bd_ia32_Fucomi(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Fucomi;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_eflags;
+
+	attr->attr.ins_permuted = ins_permuted;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct FucomppFnstsw node
+ */
+ir_node *new_bd_ia32_FucomppFnstsw(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_FucomppFnstsw;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+
+	attr->attr.ins_permuted = ins_permuted;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct GetEIP node
+ */
+ir_node *new_bd_ia32_GetEIP(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_GetEIP;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct IDiv node
+ */
+ir_node *new_bd_ia32_IDiv(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *divisor, ir_node *dividend_low, ir_node *dividend_high)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 6;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_eax,
+		& ia32_requirements_gp_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = divisor;
+	in[4] = dividend_low;
+	in[5] = dividend_high;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_IDiv;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &ia32_requirements_gp_edx;
+	out_infos[4].req = &arch_no_requirement;
+	out_infos[5].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct IJmp node
+ */
+ir_node *new_bd_ia32_IJmp(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *target)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = target;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_IJmp;
+	ir_mode  *mode = mode_X;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct IMul node
+ */
+ir_node *new_bd_ia32_IMul(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_IMul;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct IMul1OP node
+ */
+ir_node *new_bd_ia32_IMul1OP(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 4;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_IMul1OP;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &ia32_requirements_gp_edx;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct IMulImm node
+ */
+ir_node *new_bd_ia32_IMulImm(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_IMulImm;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Immediate node
+ */
+ir_node *new_bd_ia32_Immediate(dbg_info *dbgi, ir_node *block, ir_entity *entity, bool no_pic_adjust, int32_t offset)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_not_scheduled;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Immediate;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_immediate_attr_t *attr = (ia32_immediate_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_immediate_attributes(res, entity, no_pic_adjust, offset);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp_NOREG_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Inc node
+ */
+ir_node *new_bd_ia32_Inc(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Inc;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct IncMem node
+ */
+ir_node *new_bd_ia32_IncMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_IncMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Inport node
+ */
+ir_node *new_bd_ia32_Inport(dbg_info *dbgi, ir_node *block, ir_node *port, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_edx,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = port;
+	in[1] = mem;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Inport;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Jcc node
+ */
+ir_node *new_bd_ia32_Jcc(dbg_info *dbgi, ir_node *block, ir_node *eflags, x86_condition_code_t condition_code)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_flags_eflags,
+	};
+
+	/* construct in array */
+	in[0] = eflags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Jcc;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_condcode_attr_t *attr = (ia32_condcode_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_condcode_attributes(res, condition_code);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Jmp node
+ */
+ir_node *new_bd_ia32_Jmp(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_simple_jump;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Jmp;
+	ir_mode  *mode = mode_X;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct LdTls node
+ */
+ir_node *new_bd_ia32_LdTls(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_LdTls;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Lea node
+ */
+ir_node *new_bd_ia32_Lea(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Lea;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Leave node
+ */
+ir_node *new_bd_ia32_Leave(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arch_no_requirement,
+		& ia32_requirements_gp_ebp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Leave;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_ebp_I;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &ia32_requirements_gp_esp_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Load node
+ */
+ir_node *new_bd_ia32_Load(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 5;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Load;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &arch_no_requirement;
+	out_infos[4].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Minus64 node
+ */
+ir_node *new_bd_ia32_Minus64(dbg_info *dbgi, ir_node *block, ir_node *low, ir_node *high)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = low;
+	in[1] = high;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Minus64;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1;
+	out_infos[1].req = &ia32_requirements_gp_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Mul node
+ */
+ir_node *new_bd_ia32_Mul(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 4;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Mul;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &ia32_requirements_gp_edx;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Neg node
+ */
+ir_node *new_bd_ia32_Neg(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Neg;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct NegMem node
+ */
+ir_node *new_bd_ia32_NegMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_NegMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct NoReg_FP node
+ */
+ir_node *new_bd_ia32_NoReg_FP(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_not_scheduled;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_NoReg_FP;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp_NOREG_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct NoReg_GP node
+ */
+ir_node *new_bd_ia32_NoReg_GP(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_not_scheduled;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_NoReg_GP;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp_NOREG_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct NoReg_XMM node
+ */
+ir_node *new_bd_ia32_NoReg_XMM(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_not_scheduled;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_NoReg_XMM;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm_NOREG_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Not node
+ */
+ir_node *new_bd_ia32_Not(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Not;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct NotMem node
+ */
+ir_node *new_bd_ia32_NotMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_NotMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Or node
+ */
+ir_node *new_bd_ia32_Or(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Or;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct OrMem node
+ */
+ir_node *new_bd_ia32_OrMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_OrMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct OrMem node
+ */
+ir_node *new_bd_ia32_OrMem_8bit(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_OrMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Outport node
+ */
+ir_node *new_bd_ia32_Outport(dbg_info *dbgi, ir_node *block, ir_node *port, ir_node *value, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_edx,
+		& ia32_requirements_gp_eax,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = port;
+	in[1] = value;
+	in[2] = mem;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Outport;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pop node
+ */
+ir_node *new_bd_ia32_Pop(dbg_info *dbgi, ir_node *block, ir_node *mem, ir_node *stack)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 4;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arch_no_requirement,
+		& ia32_requirements_gp_esp,
+	};
+
+	/* construct in array */
+	in[0] = mem;
+	in[1] = stack;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Pop;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &ia32_requirements_gp_esp_I;
+
+	attr->ls_mode = ia32_mode_gp;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Pop node
+ */
+ir_node *new_bd_ia32_Pop_ebp(dbg_info *dbgi, ir_node *block, ir_node *mem, ir_node *stack)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 4;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arch_no_requirement,
+		& ia32_requirements_gp_esp,
+	};
+
+	/* construct in array */
+	in[0] = mem;
+	in[1] = stack;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Pop;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_ebp_I;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &ia32_requirements_gp_esp_I;
+
+	attr->ls_mode = ia32_mode_gp;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct PopMem node
+ */
+ir_node *new_bd_ia32_PopMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *stack)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 4;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_esp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = stack;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_PopMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &ia32_requirements_gp_esp_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Popcnt node
+ */
+ir_node *new_bd_ia32_Popcnt(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *operand)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = operand;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Popcnt;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Prefetch node
+ */
+ir_node *new_bd_ia32_Prefetch(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Prefetch;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Prefetch0 node
+ */
+ir_node *new_bd_ia32_Prefetch0(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Prefetch0;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Prefetch1 node
+ */
+ir_node *new_bd_ia32_Prefetch1(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Prefetch1;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Prefetch2 node
+ */
+ir_node *new_bd_ia32_Prefetch2(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Prefetch2;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct PrefetchNTA node
+ */
+ir_node *new_bd_ia32_PrefetchNTA(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_PrefetchNTA;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct PrefetchW node
+ */
+ir_node *new_bd_ia32_PrefetchW(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_PrefetchW;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Push node
+ */
+ir_node *new_bd_ia32_Push(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val, ir_node *stack, ir_mode *store_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_esp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+	in[4] = stack;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Push;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_unary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_gp_esp_I;
+
+	attr->ls_mode = store_mode;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct PushEax node
+ */
+ir_node *new_bd_ia32_PushEax(dbg_info *dbgi, ir_node *block, ir_node *stack)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_esp,
+	};
+
+	/* construct in array */
+	in[0] = stack;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_PushEax;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_esp_I;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Return node
+ */
+ir_node *new_bd_ia32_Return(dbg_info *dbgi, ir_node *block, int arity, ir_node *in[], uint16_t pop)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Return;
+	ir_mode  *mode = mode_X;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_return_attr_t *attr = (ia32_return_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_return_attributes(res, pop);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Rol node
+ */
+ir_node *new_bd_ia32_Rol(dbg_info *dbgi, ir_node *block, ir_node *val, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = val;
+	in[1] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Rol;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1_not_in_r2;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RolMem node
+ */
+ir_node *new_bd_ia32_RolMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_RolMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Ror node
+ */
+ir_node *new_bd_ia32_Ror(dbg_info *dbgi, ir_node *block, ir_node *val, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = val;
+	in[1] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Ror;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1_not_in_r2;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct RorMem node
+ */
+ir_node *new_bd_ia32_RorMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_RorMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sahf node
+ */
+ir_node *new_bd_ia32_Sahf(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_eax,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Sahf;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_eflags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sar node
+ */
+ir_node *new_bd_ia32_Sar(dbg_info *dbgi, ir_node *block, ir_node *val, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = val;
+	in[1] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Sar;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1_not_in_r2;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SarMem node
+ */
+ir_node *new_bd_ia32_SarMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_SarMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sbb node
+ */
+ir_node *new_bd_ia32_Sbb(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *minuend, ir_node *subtrahend, ir_node *eflags)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = minuend;
+	in[4] = subtrahend;
+	in[5] = eflags;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Sbb;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_condcode_attr_t *attr = (ia32_condcode_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	x86_condition_code_t condition_code = x86_cc_carry;
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_condcode_attributes(res, condition_code);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r4;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sbb0 node
+ */
+ir_node *new_bd_ia32_Sbb0(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_flags_flags,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Sbb0;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_condcode_attr_t *attr = (ia32_condcode_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	x86_condition_code_t condition_code = x86_cc_carry;
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_condcode_attributes(res, condition_code);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Setcc node
+ */
+ir_node *new_bd_ia32_Setcc(dbg_info *dbgi, ir_node *block, ir_node *eflags, x86_condition_code_t condition_code)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_flags_eflags,
+	};
+
+	/* construct in array */
+	in[0] = eflags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Setcc;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_condcode_attr_t *attr = (ia32_condcode_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_condcode_attributes(res, condition_code);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_eax_ebx_ecx_edx;
+
+	set_ia32_ls_mode(res, mode_Bu);
+	if (condition_code & x86_cc_additional_float_cases) {
+		arch_add_irn_flags(res, arch_irn_flag_modify_flags);
+		/* attr->latency = 3; */
+	}
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SetccMem node
+ */
+ir_node *new_bd_ia32_SetccMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *eflags, x86_condition_code_t condition_code)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_flags_eflags,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = eflags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_SetccMem;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_condcode_attr_t *attr = (ia32_condcode_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_condcode_attributes(res, condition_code);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	set_ia32_ls_mode(res, mode_Bu);
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Shl node
+ */
+ir_node *new_bd_ia32_Shl(dbg_info *dbgi, ir_node *block, ir_node *val, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = val;
+	in[1] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Shl;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1_not_in_r2;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ShlD node
+ */
+ir_node *new_bd_ia32_ShlD(dbg_info *dbgi, ir_node *block, ir_node *val_high, ir_node *val_low, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = val_high;
+	in[1] = val_low;
+	in[2] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_ShlD;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1_not_in_r2_not_in_r3;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ShlD node
+ */
+ir_node *new_bd_ia32_ShlD_imm(dbg_info *dbgi, ir_node *block, ir_node *val_high, ir_node *val_low, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = val_high;
+	in[1] = val_low;
+	in[2] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_ShlD;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1_in_r2;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ShlMem node
+ */
+ir_node *new_bd_ia32_ShlMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_ShlMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Shr node
+ */
+ir_node *new_bd_ia32_Shr(dbg_info *dbgi, ir_node *block, ir_node *val, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = val;
+	in[1] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Shr;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1_not_in_r2;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ShrD node
+ */
+ir_node *new_bd_ia32_ShrD(dbg_info *dbgi, ir_node *block, ir_node *val_high, ir_node *val_low, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = val_high;
+	in[1] = val_low;
+	in[2] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_ShrD;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1_not_in_r2_not_in_r3;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ShrD node
+ */
+ir_node *new_bd_ia32_ShrD_imm(dbg_info *dbgi, ir_node *block, ir_node *val_high, ir_node *val_low, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = val_high;
+	in[1] = val_low;
+	in[2] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_ShrD;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1_in_r2;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ShrMem node
+ */
+ir_node *new_bd_ia32_ShrMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *count)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_ecx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = count;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_ShrMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Start node
+ */
+ir_node *new_bd_ia32_Start(dbg_info *dbgi, ir_node *block, int n_res)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_schedule_first;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Start;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Stc node
+ */
+ir_node *new_bd_ia32_Stc(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Stc;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Store node
+ */
+ir_node *new_bd_ia32_Store(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Store;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Store node
+ */
+ir_node *new_bd_ia32_Store_8bit(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Store;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Sub node
+ */
+ir_node *new_bd_ia32_Sub(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *minuend, ir_node *subtrahend)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = minuend;
+	in[4] = subtrahend;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Sub;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r4;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SubMem node
+ */
+ir_node *new_bd_ia32_SubMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_SubMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SubMem node
+ */
+ir_node *new_bd_ia32_SubMem_8bit(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_SubMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SubSP node
+ */
+ir_node *new_bd_ia32_SubSP(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *stack, ir_node *size)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_esp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = stack;
+	in[4] = size;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_SubSP;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_esp_I;
+	out_infos[1].req = &ia32_requirements_gp_gp;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct SwitchJmp node
+ */
+ir_node *new_bd_ia32_SwitchJmp(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, int n_res, const ir_switch_table *switch_table)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_SwitchJmp;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_switch_attr_t *attr = (ia32_switch_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_switch_attributes(res, switch_table);
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Test node
+ */
+ir_node *new_bd_ia32_Test(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Test;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_flags;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	attr->ins_permuted = ins_permuted;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Test node
+ */
+ir_node *new_bd_ia32_Test_8bit(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Test;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_flags;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	attr->ins_permuted = ins_permuted;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct UD2 node
+ */
+ir_node *new_bd_ia32_UD2(dbg_info *dbgi, ir_node *block, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_UD2;
+	ir_mode  *mode = mode_M;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Ucomi node
+ */
+ir_node *new_bd_ia32_Ucomi(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, bool ins_permuted)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Ucomi;
+	ir_mode  *mode = ia32_mode_flags;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_flags_eflags;
+
+	attr->ins_permuted = ins_permuted;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Unknown node
+ */
+ir_node *new_bd_ia32_Unknown(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Unknown;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Xor node
+ */
+ir_node *new_bd_ia32_Xor(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Xor;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct Xor0 node
+ */
+ir_node *new_bd_ia32_Xor0(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_Xor0;
+	ir_mode  *mode = ia32_mode_gp;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_gp;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct XorHighLow node
+ */
+ir_node *new_bd_ia32_XorHighLow(dbg_info *dbgi, ir_node *block, ir_node *value)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = value;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_XorHighLow;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_gp_in_r1;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct XorMem node
+ */
+ir_node *new_bd_ia32_XorMem(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_XorMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct XorMem node
+ */
+ir_node *new_bd_ia32_XorMem_8bit(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_gp_eax_ebx_ecx_edx,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_modify_flags;
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_XorMem;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct emms node
+ */
+ir_node *new_bd_ia32_emms(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_emms;
+	ir_mode  *mode = mode_ANY;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fabs node
+ */
+ir_node *new_bd_ia32_fabs(dbg_info *dbgi, ir_node *block, ir_node *value)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = value;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fabs;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	attr->ls_mode = ia32_mode_E;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fadd node
+ */
+ir_node *new_bd_ia32_fadd(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, ir_node *fpcw)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_cw_fpcw,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+	in[5] = fpcw;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fadd;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fchs node
+ */
+ir_node *new_bd_ia32_fchs(dbg_info *dbgi, ir_node *block, ir_node *value)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = value;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fchs;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	attr->ls_mode = ia32_mode_E;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fdiv node
+ */
+ir_node *new_bd_ia32_fdiv(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, ir_node *fpcw)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_cw_fpcw,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+	in[5] = fpcw;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fdiv;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fdup node
+ */
+ir_node *new_bd_ia32_fdup(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fdup;
+	ir_mode  *mode = get_irn_mode(val);
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct femms node
+ */
+ir_node *new_bd_ia32_femms(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_femms;
+	ir_mode  *mode = mode_ANY;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct ffreep node
+ */
+ir_node *new_bd_ia32_ffreep(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_ffreep;
+	ir_mode  *mode = mode_ANY;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fild node
+ */
+ir_node *new_bd_ia32_fild(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fild;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fist node
+ */
+ir_node *new_bd_ia32_fist(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val, ir_node *fpcw)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_cw_fpcw,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+	in[4] = fpcw;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fist;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fisttp node
+ */
+ir_node *new_bd_ia32_fisttp(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 4;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fisttp;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &ia32_requirements_fp_in_r4;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fld node
+ */
+ir_node *new_bd_ia32_fld(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_mode *load_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 5;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fld;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &arch_no_requirement;
+	out_infos[4].req = &arch_no_requirement;
+
+	attr->ls_mode = load_mode;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fld1 node
+ */
+ir_node *new_bd_ia32_fld1(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fld1;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	attr->ls_mode = ia32_mode_E;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fldl2e node
+ */
+ir_node *new_bd_ia32_fldl2e(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fldl2e;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	attr->ls_mode = ia32_mode_E;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fldl2t node
+ */
+ir_node *new_bd_ia32_fldl2t(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fldl2t;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	attr->ls_mode = ia32_mode_E;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fldlg2 node
+ */
+ir_node *new_bd_ia32_fldlg2(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fldlg2;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	attr->ls_mode = ia32_mode_E;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fldln2 node
+ */
+ir_node *new_bd_ia32_fldln2(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fldln2;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	attr->ls_mode = ia32_mode_E;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fldpi node
+ */
+ir_node *new_bd_ia32_fldpi(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fldpi;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	attr->ls_mode = ia32_mode_E;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fldz node
+ */
+ir_node *new_bd_ia32_fldz(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fldz;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+	ia32_request_x87_sim(irg);
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+
+	attr->ls_mode = ia32_mode_E;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fmul node
+ */
+ir_node *new_bd_ia32_fmul(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, ir_node *fpcw)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_cw_fpcw,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+	in[5] = fpcw;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fmul;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fpop node
+ */
+ir_node *new_bd_ia32_fpop(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fpop;
+	ir_mode  *mode = mode_ANY;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fst node
+ */
+ir_node *new_bd_ia32_fst(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val, ir_mode *store_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_fp_fp,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fst;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	attr->attr.ls_mode = store_mode;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fsub node
+ */
+ir_node *new_bd_ia32_fsub(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right, ir_node *fpcw)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 6;
+	ir_node         *in[6];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_fp,
+		& ia32_requirements_fp_cw_fpcw,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+	in[5] = fpcw;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fsub;
+	ir_mode  *mode = ia32_mode_E;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_fp_fp;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct fxch node
+ */
+ir_node *new_bd_ia32_fxch(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_fxch;
+	ir_mode  *mode = mode_ANY;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_x87_attr_t *attr = (ia32_x87_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	init_ia32_x87_attributes(res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_Adc node
+ */
+ir_node *new_bd_ia32_l_Adc(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right, ir_node *eflags, ir_mode *mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 0;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+	in[2] = eflags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_l_Adc;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_Add node
+ */
+ir_node *new_bd_ia32_l_Add(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_l_Add;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_FloattoLL node
+ */
+ir_node *new_bd_ia32_l_FloattoLL(dbg_info *dbgi, ir_node *block, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_l_FloattoLL;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_IMul node
+ */
+ir_node *new_bd_ia32_l_IMul(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 4;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_l_IMul;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_LLtoFloat node
+ */
+ir_node *new_bd_ia32_l_LLtoFloat(dbg_info *dbgi, ir_node *block, ir_node *val_high, ir_node *val_low, ir_mode *mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 0;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = val_high;
+	in[1] = val_low;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_l_LLtoFloat;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_Minus64 node
+ */
+ir_node *new_bd_ia32_l_Minus64(dbg_info *dbgi, ir_node *block, ir_node *low, ir_node *high)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = low;
+	in[1] = high;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_l_Minus64;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_Mul node
+ */
+ir_node *new_bd_ia32_l_Mul(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 4;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_l_Mul;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_Sbb node
+ */
+ir_node *new_bd_ia32_l_Sbb(dbg_info *dbgi, ir_node *block, ir_node *minuend, ir_node *subtrahend, ir_node *eflags, ir_mode *mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 0;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = minuend;
+	in[1] = subtrahend;
+	in[2] = eflags;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_l_Sbb;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct l_Sub node
+ */
+ir_node *new_bd_ia32_l_Sub(dbg_info *dbgi, ir_node *block, ir_node *minuend, ir_node *subtrahend)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 2;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* construct in array */
+	in[0] = minuend;
+	in[1] = subtrahend;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_l_Sub;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	(void)in;(void)irn_flags_;(void)in_reqs;(void)n_res;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xAdd node
+ */
+ir_node *new_bd_ia32_xAdd(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xAdd;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xAllOnes node
+ */
+ir_node *new_bd_ia32_xAllOnes(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xAllOnes;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xAnd node
+ */
+ir_node *new_bd_ia32_xAnd(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xAnd;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xAndNot node
+ */
+ir_node *new_bd_ia32_xAndNot(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xAndNot;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4_not_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xDiv node
+ */
+ir_node *new_bd_ia32_xDiv(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xDiv;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4_not_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xLoad node
+ */
+ir_node *new_bd_ia32_xLoad(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_mode *load_mode)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 5;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xLoad;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &arch_no_requirement;
+	out_infos[4].req = &arch_no_requirement;
+
+	attr->ls_mode = load_mode;
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xMax node
+ */
+ir_node *new_bd_ia32_xMax(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xMax;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xMin node
+ */
+ir_node *new_bd_ia32_xMin(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xMin;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xMovd node
+ */
+ir_node *new_bd_ia32_xMovd(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xMovd;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xMul node
+ */
+ir_node *new_bd_ia32_xMul(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xMul;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xOr node
+ */
+ir_node *new_bd_ia32_xOr(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xOr;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xPslld node
+ */
+ir_node *new_bd_ia32_xPslld(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xPslld;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xPsllq node
+ */
+ir_node *new_bd_ia32_xPsllq(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xPsllq;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xPsrld node
+ */
+ir_node *new_bd_ia32_xPsrld(dbg_info *dbgi, ir_node *block, ir_node *op0, ir_node *op1)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+	in[1] = op1;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xPsrld;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xPzero node
+ */
+ir_node *new_bd_ia32_xPzero(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xPzero;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xStore node
+ */
+ir_node *new_bd_ia32_xStore(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xStore;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xSub node
+ */
+ir_node *new_bd_ia32_xSub(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *minuend, ir_node *subtrahend)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = minuend;
+	in[4] = subtrahend;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xSub;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xUnknown node
+ */
+ir_node *new_bd_ia32_xUnknown(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xUnknown;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xXor node
+ */
+ir_node *new_bd_ia32_xXor(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 5;
+	ir_node         *in[5];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = left;
+	in[4] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xXor;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+		set_ia32_am_support(res, ia32_am_binary);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r4_in_r5;
+	out_infos[1].req = &ia32_requirements_flags_flags;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xZero node
+ */
+ir_node *new_bd_ia32_xZero(dbg_info *dbgi, ir_node *block)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 0;
+	ir_node        **in         = NULL;
+	int      const   n_res      = 1;
+	static const arch_register_req_t **in_reqs = NULL;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xZero;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxAddpd node
+ */
+ir_node *new_bd_ia32_xxAddpd(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxAddpd;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxAddps node
+ */
+ir_node *new_bd_ia32_xxAddps(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxAddps;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxBroadcast16 node
+ */
+ir_node *new_bd_ia32_xxBroadcast16(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxBroadcast16;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxBroadcast32 node
+ */
+ir_node *new_bd_ia32_xxBroadcast32(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxBroadcast32;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxBroadcast8 node
+ */
+ir_node *new_bd_ia32_xxBroadcast8(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxBroadcast8;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxBroadcastpd node
+ */
+ir_node *new_bd_ia32_xxBroadcastpd(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxBroadcastpd;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxBroadcastps node
+ */
+ir_node *new_bd_ia32_xxBroadcastps(dbg_info *dbgi, ir_node *block, ir_node *op0)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 1;
+	ir_node         *in[1];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = op0;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxBroadcastps;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxLoad node
+ */
+ir_node *new_bd_ia32_xxLoad(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 3;
+	ir_node         *in[3];
+	int      const   n_res      = 5;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxLoad;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_xmm;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+	out_infos[3].req = &arch_no_requirement;
+	out_infos[4].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxMulpd node
+ */
+ir_node *new_bd_ia32_xxMulpd(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxMulpd;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxMulps node
+ */
+ir_node *new_bd_ia32_xxMulps(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxMulps;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPaddb node
+ */
+ir_node *new_bd_ia32_xxPaddb(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPaddb;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPaddd node
+ */
+ir_node *new_bd_ia32_xxPaddd(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPaddd;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPaddq node
+ */
+ir_node *new_bd_ia32_xxPaddq(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPaddq;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPaddw node
+ */
+ir_node *new_bd_ia32_xxPaddw(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPaddw;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPand node
+ */
+ir_node *new_bd_ia32_xxPand(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPand;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPor node
+ */
+ir_node *new_bd_ia32_xxPor(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPor;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPsubb node
+ */
+ir_node *new_bd_ia32_xxPsubb(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPsubb;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPsubd node
+ */
+ir_node *new_bd_ia32_xxPsubd(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPsubd;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPsubq node
+ */
+ir_node *new_bd_ia32_xxPsubq(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPsubq;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPsubw node
+ */
+ir_node *new_bd_ia32_xxPsubw(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPsubw;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxPxor node
+ */
+ir_node *new_bd_ia32_xxPxor(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxPxor;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxStore node
+ */
+ir_node *new_bd_ia32_xxStore(dbg_info *dbgi, ir_node *block, ir_node *base, ir_node *index, ir_node *mem, ir_node *val)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 4;
+	ir_node         *in[4];
+	int      const   n_res      = 3;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_gp_gp,
+		& ia32_requirements_gp_gp,
+		& arch_no_requirement,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = base;
+	in[1] = index;
+	in[2] = mem;
+	in[3] = val;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxStore;
+	ir_mode  *mode = mode_T;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &arch_no_requirement;
+	out_infos[1].req = &arch_no_requirement;
+	out_infos[2].req = &arch_no_requirement;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxSubpd node
+ */
+ir_node *new_bd_ia32_xxSubpd(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxSubpd;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+/**
+ * construct xxSubps node
+ */
+ir_node *new_bd_ia32_xxSubps(dbg_info *dbgi, ir_node *block, ir_node *left, ir_node *right)
+{
+	arch_irn_flags_t irn_flags_ = arch_irn_flags_none;
+	int      const   arity      = 2;
+	ir_node         *in[2];
+	int      const   n_res      = 1;
+	static const arch_register_req_t *in_reqs[] =
+	{
+		& ia32_requirements_xmm_xmm,
+		& ia32_requirements_xmm_xmm,
+	};
+
+	/* construct in array */
+	in[0] = left;
+	in[1] = right;
+
+	/* flags */
+	irn_flags_ |= arch_irn_flag_rematerializable;
+
+	/* create node */
+	ir_graph *irg  = get_irn_irg(block);
+	ir_op    *op   = op_ia32_xxSubps;
+	ir_mode  *mode = ia32_mode_float64;
+	ir_node  *res  = new_ir_node(dbgi, irg, block, op, mode, arity, in);
+
+	/* init node attributes */
+	ia32_attr_t *attr = (ia32_attr_t*)get_irn_generic_attr(res);
+	(void) attr; /* avoid potential warning */
+		init_ia32_attributes(res, irn_flags_, in_reqs, n_res);
+	reg_out_info_t *const out_infos = be_get_info(res)->out_infos;
+	out_infos[0].req = &ia32_requirements_xmm_in_r1_not_in_r2;
+
+	/* optimize node */
+	res = optimize_node(res);
+	verify_new_node(irg, res);
+
+	return res;
+}
+
+
+
+/**
+ * Creates the ia32 specific Firm machine operations
+ * needed for the assembler irgs.
+ */
+void ia32_create_opcodes(void)
+{
+	ir_op *op;
+	int    cur_opcode = get_next_ir_opcodes(iro_ia32_last);
+
+	ia32_opcode_start = cur_opcode;
+	op = new_ir_op(cur_opcode + iro_ia32_Adc, "ia32_Adc", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_condcode_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_condcode_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Adc = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Add, "ia32_Add", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Add = op;
+	op = new_ir_op(cur_opcode + iro_ia32_AddMem, "ia32_AddMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_AddMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_AddSP, "ia32_AddSP", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_AddSP = op;
+	op = new_ir_op(cur_opcode + iro_ia32_And, "ia32_And", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_And = op;
+	op = new_ir_op(cur_opcode + iro_ia32_AndMem, "ia32_AndMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_AndMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Breakpoint, "ia32_Breakpoint", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Breakpoint = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Bsf, "ia32_Bsf", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Bsf = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Bsr, "ia32_Bsr", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Bsr = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Bswap, "ia32_Bswap", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Bswap = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Bswap16, "ia32_Bswap16", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Bswap16 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Bt, "ia32_Bt", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Bt = op;
+	op = new_ir_op(cur_opcode + iro_ia32_CMovcc, "ia32_CMovcc", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_condcode_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_condcode_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_CMovcc = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Call, "ia32_Call", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_variable, -1, sizeof(ia32_call_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_call_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_Call = op;
+	op = new_ir_op(cur_opcode + iro_ia32_ChangeCW, "ia32_ChangeCW", op_pin_state_pinned, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_ChangeCW = op;
+	op = new_ir_op(cur_opcode + iro_ia32_ClimbFrame, "ia32_ClimbFrame", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_climbframe_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_climbframe_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_ClimbFrame = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Cltd, "ia32_Cltd", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Cltd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Cmc, "ia32_Cmc", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_condcode_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_condcode_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Cmc = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Cmp, "ia32_Cmp", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Cmp = op;
+	op = new_ir_op(cur_opcode + iro_ia32_CmpXChgMem, "ia32_CmpXChgMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_CmpXChgMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Const, "ia32_Const", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_immediate_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_immediate_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Const = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Conv_FP2FP, "ia32_Conv_FP2FP", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 8);
+	op_ia32_Conv_FP2FP = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Conv_FP2I, "ia32_Conv_FP2I", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 10);
+	op_ia32_Conv_FP2I = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Conv_I2FP, "ia32_Conv_I2FP", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 10);
+	op_ia32_Conv_I2FP = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Conv_I2I, "ia32_Conv_I2I", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_Conv_I2I_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_Conv_I2I_X_regular, pn_ia32_Conv_I2I_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Conv_I2I = op;
+	op = new_ir_op(cur_opcode + iro_ia32_CopyB, "ia32_CopyB", op_pin_state_floats, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_copyb_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_copyb_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 250);
+	op_ia32_CopyB = op;
+	op = new_ir_op(cur_opcode + iro_ia32_CopyB_i, "ia32_CopyB_i", op_pin_state_floats, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_copyb_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_copyb_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_CopyB_i = op;
+	op = new_ir_op(cur_opcode + iro_ia32_CopyEbpEsp, "ia32_CopyEbpEsp", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_CopyEbpEsp = op;
+	op = new_ir_op(cur_opcode + iro_ia32_CvtSI2SD, "ia32_CvtSI2SD", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_CvtSI2SD = op;
+	op = new_ir_op(cur_opcode + iro_ia32_CvtSI2SS, "ia32_CvtSI2SS", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_CvtSI2SS = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Cwtl, "ia32_Cwtl", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Cwtl = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Dec, "ia32_Dec", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Dec = op;
+	op = new_ir_op(cur_opcode + iro_ia32_DecMem, "ia32_DecMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_DecMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Div, "ia32_Div", op_pin_state_exc_pinned, irop_flag_fragile|irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_Div_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_Div_X_regular, pn_ia32_Div_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 25);
+	op_ia32_Div = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Enter, "ia32_Enter", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 15);
+	op_ia32_Enter = op;
+	op = new_ir_op(cur_opcode + iro_ia32_FldCW, "ia32_FldCW", op_pin_state_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 5);
+	op_ia32_FldCW = op;
+	op = new_ir_op(cur_opcode + iro_ia32_FnstCW, "ia32_FnstCW", op_pin_state_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 5);
+	op_ia32_FnstCW = op;
+	op = new_ir_op(cur_opcode + iro_ia32_FnstCWNOP, "ia32_FnstCWNOP", op_pin_state_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_FnstCWNOP = op;
+	op = new_ir_op(cur_opcode + iro_ia32_FtstFnstsw, "ia32_FtstFnstsw", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_FtstFnstsw = op;
+	op = new_ir_op(cur_opcode + iro_ia32_FucomFnstsw, "ia32_FucomFnstsw", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_FucomFnstsw = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Fucomi, "ia32_Fucomi", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_Fucomi = op;
+	op = new_ir_op(cur_opcode + iro_ia32_FucomppFnstsw, "ia32_FucomppFnstsw", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_FucomppFnstsw = op;
+	op = new_ir_op(cur_opcode + iro_ia32_GetEIP, "ia32_GetEIP", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 5);
+	op_ia32_GetEIP = op;
+	op = new_ir_op(cur_opcode + iro_ia32_IDiv, "ia32_IDiv", op_pin_state_exc_pinned, irop_flag_fragile|irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_IDiv_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_IDiv_X_regular, pn_ia32_IDiv_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 25);
+	op_ia32_IDiv = op;
+	op = new_ir_op(cur_opcode + iro_ia32_IJmp, "ia32_IJmp", op_pin_state_pinned, irop_flag_cfopcode|irop_flag_unknown_jump, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_IJmp = op;
+	op = new_ir_op(cur_opcode + iro_ia32_IMul, "ia32_IMul", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 5);
+	op_ia32_IMul = op;
+	op = new_ir_op(cur_opcode + iro_ia32_IMul1OP, "ia32_IMul1OP", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 5);
+	op_ia32_IMul1OP = op;
+	op = new_ir_op(cur_opcode + iro_ia32_IMulImm, "ia32_IMulImm", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 5);
+	op_ia32_IMulImm = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Immediate, "ia32_Immediate", op_pin_state_pinned, irop_flag_constlike, oparity_any, -1, sizeof(ia32_immediate_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_immediate_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_hash(op, ia32_hash_Immediate);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Immediate = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Inc, "ia32_Inc", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Inc = op;
+	op = new_ir_op(cur_opcode + iro_ia32_IncMem, "ia32_IncMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_IncMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Inport, "ia32_Inport", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Inport = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Jcc, "ia32_Jcc", op_pin_state_pinned, irop_flag_cfopcode|irop_flag_forking, oparity_any, -1, sizeof(ia32_condcode_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_condcode_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_Jcc = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Jmp, "ia32_Jmp", op_pin_state_pinned, irop_flag_cfopcode, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Jmp = op;
+	op = new_ir_op(cur_opcode + iro_ia32_LdTls, "ia32_LdTls", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_LdTls = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Lea, "ia32_Lea", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_Lea = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Leave, "ia32_Leave", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_Leave = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Load, "ia32_Load", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_Load_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_Load_X_regular, pn_ia32_Load_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Load = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Minus64, "ia32_Minus64", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_Minus64 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Mul, "ia32_Mul", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 10);
+	op_ia32_Mul = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Neg, "ia32_Neg", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Neg = op;
+	op = new_ir_op(cur_opcode + iro_ia32_NegMem, "ia32_NegMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_NegMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_NoReg_FP, "ia32_NoReg_FP", op_pin_state_pinned, irop_flag_constlike|irop_flag_dump_noblock, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_NoReg_FP = op;
+	op = new_ir_op(cur_opcode + iro_ia32_NoReg_GP, "ia32_NoReg_GP", op_pin_state_pinned, irop_flag_constlike|irop_flag_dump_noblock, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_NoReg_GP = op;
+	op = new_ir_op(cur_opcode + iro_ia32_NoReg_XMM, "ia32_NoReg_XMM", op_pin_state_pinned, irop_flag_constlike|irop_flag_dump_noblock, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_NoReg_XMM = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Not, "ia32_Not", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Not = op;
+	op = new_ir_op(cur_opcode + iro_ia32_NotMem, "ia32_NotMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_NotMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Or, "ia32_Or", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Or = op;
+	op = new_ir_op(cur_opcode + iro_ia32_OrMem, "ia32_OrMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_OrMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Outport, "ia32_Outport", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Outport = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Pop, "ia32_Pop", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_Pop = op;
+	op = new_ir_op(cur_opcode + iro_ia32_PopMem, "ia32_PopMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_PopMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Popcnt, "ia32_Popcnt", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Popcnt = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Prefetch, "ia32_Prefetch", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Prefetch = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Prefetch0, "ia32_Prefetch0", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Prefetch0 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Prefetch1, "ia32_Prefetch1", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Prefetch1 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Prefetch2, "ia32_Prefetch2", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Prefetch2 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_PrefetchNTA, "ia32_PrefetchNTA", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_PrefetchNTA = op;
+	op = new_ir_op(cur_opcode + iro_ia32_PrefetchW, "ia32_PrefetchW", op_pin_state_exc_pinned, irop_flag_uses_memory, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_PrefetchW = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Push, "ia32_Push", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_Push = op;
+	op = new_ir_op(cur_opcode + iro_ia32_PushEax, "ia32_PushEax", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_PushEax = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Return, "ia32_Return", op_pin_state_pinned, irop_flag_cfopcode, oparity_variable, -1, sizeof(ia32_return_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_return_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Return = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Rol, "ia32_Rol", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Rol = op;
+	op = new_ir_op(cur_opcode + iro_ia32_RolMem, "ia32_RolMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_RolMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Ror, "ia32_Ror", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Ror = op;
+	op = new_ir_op(cur_opcode + iro_ia32_RorMem, "ia32_RorMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_RorMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Sahf, "ia32_Sahf", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Sahf = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Sar, "ia32_Sar", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Sar = op;
+	op = new_ir_op(cur_opcode + iro_ia32_SarMem, "ia32_SarMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_SarMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Sbb, "ia32_Sbb", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_condcode_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_condcode_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Sbb = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Sbb0, "ia32_Sbb0", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_condcode_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_condcode_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Sbb0 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Setcc, "ia32_Setcc", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_condcode_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_condcode_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Setcc = op;
+	op = new_ir_op(cur_opcode + iro_ia32_SetccMem, "ia32_SetccMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_condcode_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_condcode_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_SetccMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Shl, "ia32_Shl", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Shl = op;
+	op = new_ir_op(cur_opcode + iro_ia32_ShlD, "ia32_ShlD", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 6);
+	op_ia32_ShlD = op;
+	op = new_ir_op(cur_opcode + iro_ia32_ShlMem, "ia32_ShlMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_ShlMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Shr, "ia32_Shr", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Shr = op;
+	op = new_ir_op(cur_opcode + iro_ia32_ShrD, "ia32_ShrD", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 6);
+	op_ia32_ShrD = op;
+	op = new_ir_op(cur_opcode + iro_ia32_ShrMem, "ia32_ShrMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_ShrMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Start, "ia32_Start", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Start = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Stc, "ia32_Stc", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Stc = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Store, "ia32_Store", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_Store_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_Store_X_regular, pn_ia32_Store_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_Store = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Sub, "ia32_Sub", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Sub = op;
+	op = new_ir_op(cur_opcode + iro_ia32_SubMem, "ia32_SubMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_SubMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_SubSP, "ia32_SubSP", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_SubSP = op;
+	op = new_ir_op(cur_opcode + iro_ia32_SwitchJmp, "ia32_SwitchJmp", op_pin_state_pinned, irop_flag_cfopcode|irop_flag_forking, oparity_any, -1, sizeof(ia32_switch_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_switch_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_SwitchJmp = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Test, "ia32_Test", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Test = op;
+	op = new_ir_op(cur_opcode + iro_ia32_UD2, "ia32_UD2", op_pin_state_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_UD2 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Ucomi, "ia32_Ucomi", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_Ucomi = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Unknown, "ia32_Unknown", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_Unknown = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Xor, "ia32_Xor", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Xor = op;
+	op = new_ir_op(cur_opcode + iro_ia32_Xor0, "ia32_Xor0", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_Xor0 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_XorHighLow, "ia32_XorHighLow", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_XorHighLow = op;
+	op = new_ir_op(cur_opcode + iro_ia32_XorMem, "ia32_XorMem", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_XorMem = op;
+	op = new_ir_op(cur_opcode + iro_ia32_emms, "ia32_emms", op_pin_state_floats, irop_flag_keep, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, attrs_equal_false);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_emms = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fabs, "ia32_fabs", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_fabs = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fadd, "ia32_fadd", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fadd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fchs, "ia32_fchs", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_fchs = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fdiv, "ia32_fdiv", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 20);
+	op_ia32_fdiv = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fdup, "ia32_fdup", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, attrs_equal_false);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_fdup = op;
+	op = new_ir_op(cur_opcode + iro_ia32_femms, "ia32_femms", op_pin_state_floats, irop_flag_keep, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, attrs_equal_false);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_femms = op;
+	op = new_ir_op(cur_opcode + iro_ia32_ffreep, "ia32_ffreep", op_pin_state_floats, irop_flag_keep, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, attrs_equal_false);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_ffreep = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fild, "ia32_fild", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fild = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fist, "ia32_fist", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_fist_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_fist_X_regular, pn_ia32_fist_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fist = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fisttp, "ia32_fisttp", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_fisttp_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_fisttp_X_regular, pn_ia32_fisttp_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fisttp = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fld, "ia32_fld", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_fld_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_fld_X_regular, pn_ia32_fld_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_fld = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fld1, "ia32_fld1", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fld1 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fldl2e, "ia32_fldl2e", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fldl2e = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fldl2t, "ia32_fldl2t", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fldl2t = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fldlg2, "ia32_fldlg2", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fldlg2 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fldln2, "ia32_fldln2", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fldln2 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fldpi, "ia32_fldpi", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fldpi = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fldz, "ia32_fldz", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fldz = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fmul, "ia32_fmul", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fmul = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fpop, "ia32_fpop", op_pin_state_floats, irop_flag_keep, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, attrs_equal_false);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_fpop = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fst, "ia32_fst", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_fst_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_fst_X_regular, pn_ia32_fst_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_fst = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fsub, "ia32_fsub", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_x87_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_fsub = op;
+	op = new_ir_op(cur_opcode + iro_ia32_fxch, "ia32_fxch", op_pin_state_floats, irop_flag_keep, oparity_any, -1, sizeof(ia32_x87_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, attrs_equal_false);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_fxch = op;
+	op = new_ir_op(cur_opcode + iro_ia32_l_Adc, "ia32_l_Adc", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_l_Adc = op;
+	op = new_ir_op(cur_opcode + iro_ia32_l_Add, "ia32_l_Add", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_l_Add = op;
+	op = new_ir_op(cur_opcode + iro_ia32_l_FloattoLL, "ia32_l_FloattoLL", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_l_FloattoLL = op;
+	op = new_ir_op(cur_opcode + iro_ia32_l_IMul, "ia32_l_IMul", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_l_IMul = op;
+	op = new_ir_op(cur_opcode + iro_ia32_l_LLtoFloat, "ia32_l_LLtoFloat", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_l_LLtoFloat = op;
+	op = new_ir_op(cur_opcode + iro_ia32_l_Minus64, "ia32_l_Minus64", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_l_Minus64 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_l_Mul, "ia32_l_Mul", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_l_Mul = op;
+	op = new_ir_op(cur_opcode + iro_ia32_l_Sbb, "ia32_l_Sbb", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_l_Sbb = op;
+	op = new_ir_op(cur_opcode + iro_ia32_l_Sub, "ia32_l_Sub", op_pin_state_floats, irop_flag_none, oparity_any, -1, 0);
+	set_op_dump(op, NULL);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_l_Sub = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xAdd, "ia32_xAdd", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xAdd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xAllOnes, "ia32_xAllOnes", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xAllOnes = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xAnd, "ia32_xAnd", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xAnd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xAndNot, "ia32_xAndNot", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xAndNot = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xDiv, "ia32_xDiv", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 16);
+	op_ia32_xDiv = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xLoad, "ia32_xLoad", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_xLoad_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_xLoad_X_regular, pn_ia32_xLoad_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_xLoad = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xMax, "ia32_xMax", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_xMax = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xMin, "ia32_xMin", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_xMin = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xMovd, "ia32_xMovd", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xMovd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xMul, "ia32_xMul", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xMul = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xOr, "ia32_xOr", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xOr = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xPslld, "ia32_xPslld", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xPslld = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xPsllq, "ia32_xPsllq", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xPsllq = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xPsrld, "ia32_xPsrld", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xPsrld = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xPzero, "ia32_xPzero", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xPzero = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xStore, "ia32_xStore", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_xStore_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_xStore_X_regular, pn_ia32_xStore_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_xStore = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xSub, "ia32_xSub", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xSub = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xUnknown, "ia32_xUnknown", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 0);
+	op_ia32_xUnknown = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xXor, "ia32_xXor", op_pin_state_exc_pinned, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xXor = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xZero, "ia32_xZero", op_pin_state_floats, irop_flag_constlike, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xZero = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxAddpd, "ia32_xxAddpd", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xxAddpd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxAddps, "ia32_xxAddps", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xxAddps = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxBroadcast16, "ia32_xxBroadcast16", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 3);
+	op_ia32_xxBroadcast16 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxBroadcast32, "ia32_xxBroadcast32", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 2);
+	op_ia32_xxBroadcast32 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxBroadcast8, "ia32_xxBroadcast8", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xxBroadcast8 = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxBroadcastpd, "ia32_xxBroadcastpd", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxBroadcastpd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxBroadcastps, "ia32_xxBroadcastps", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxBroadcastps = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxLoad, "ia32_xxLoad", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_xxLoad_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_xxLoad_X_regular, pn_ia32_xxLoad_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxLoad = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxMulpd, "ia32_xxMulpd", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xxMulpd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxMulps, "ia32_xxMulps", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xxMulps = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPaddb, "ia32_xxPaddb", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPaddb = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPaddd, "ia32_xxPaddd", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPaddd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPaddq, "ia32_xxPaddq", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPaddq = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPaddw, "ia32_xxPaddw", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPaddw = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPand, "ia32_xxPand", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPand = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPor, "ia32_xxPor", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPor = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPsubb, "ia32_xxPsubb", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPsubb = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPsubd, "ia32_xxPsubd", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPsubd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPsubq, "ia32_xxPsubq", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPsubq = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPsubw, "ia32_xxPsubw", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPsubw = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxPxor, "ia32_xxPxor", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxPxor = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxStore, "ia32_xxStore", op_pin_state_exc_pinned, irop_flag_uses_memory|irop_flag_fragile, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	ir_op_set_memory_index(op, n_ia32_xxStore_mem);
+	ir_op_set_fragile_indices(op, pn_ia32_xxStore_X_regular, pn_ia32_xxStore_X_except);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 1);
+	op_ia32_xxStore = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxSubpd, "ia32_xxSubpd", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xxSubpd = op;
+	op = new_ir_op(cur_opcode + iro_ia32_xxSubps, "ia32_xxSubps", op_pin_state_floats, irop_flag_none, oparity_any, -1, sizeof(ia32_attr_t));
+	set_op_dump(op, ia32_dump_node);
+	set_op_attrs_equal(op, ia32_attrs_equal);
+	set_op_copy_attr(op, ia32_copy_attr);
+	set_op_tag(op, ia32_op_tag);
+	ia32_init_op(op, 4);
+	op_ia32_xxSubps = op;
+
+}
+
+void ia32_free_opcodes(void)
+{
+	free_ir_op(op_ia32_Adc); op_ia32_Adc = NULL;
+	free_ir_op(op_ia32_Add); op_ia32_Add = NULL;
+	free_ir_op(op_ia32_AddMem); op_ia32_AddMem = NULL;
+	free_ir_op(op_ia32_AddSP); op_ia32_AddSP = NULL;
+	free_ir_op(op_ia32_And); op_ia32_And = NULL;
+	free_ir_op(op_ia32_AndMem); op_ia32_AndMem = NULL;
+	free_ir_op(op_ia32_Breakpoint); op_ia32_Breakpoint = NULL;
+	free_ir_op(op_ia32_Bsf); op_ia32_Bsf = NULL;
+	free_ir_op(op_ia32_Bsr); op_ia32_Bsr = NULL;
+	free_ir_op(op_ia32_Bswap); op_ia32_Bswap = NULL;
+	free_ir_op(op_ia32_Bswap16); op_ia32_Bswap16 = NULL;
+	free_ir_op(op_ia32_Bt); op_ia32_Bt = NULL;
+	free_ir_op(op_ia32_CMovcc); op_ia32_CMovcc = NULL;
+	free_ir_op(op_ia32_Call); op_ia32_Call = NULL;
+	free_ir_op(op_ia32_ChangeCW); op_ia32_ChangeCW = NULL;
+	free_ir_op(op_ia32_ClimbFrame); op_ia32_ClimbFrame = NULL;
+	free_ir_op(op_ia32_Cltd); op_ia32_Cltd = NULL;
+	free_ir_op(op_ia32_Cmc); op_ia32_Cmc = NULL;
+	free_ir_op(op_ia32_Cmp); op_ia32_Cmp = NULL;
+	free_ir_op(op_ia32_CmpXChgMem); op_ia32_CmpXChgMem = NULL;
+	free_ir_op(op_ia32_Const); op_ia32_Const = NULL;
+	free_ir_op(op_ia32_Conv_FP2FP); op_ia32_Conv_FP2FP = NULL;
+	free_ir_op(op_ia32_Conv_FP2I); op_ia32_Conv_FP2I = NULL;
+	free_ir_op(op_ia32_Conv_I2FP); op_ia32_Conv_I2FP = NULL;
+	free_ir_op(op_ia32_Conv_I2I); op_ia32_Conv_I2I = NULL;
+	free_ir_op(op_ia32_CopyB); op_ia32_CopyB = NULL;
+	free_ir_op(op_ia32_CopyB_i); op_ia32_CopyB_i = NULL;
+	free_ir_op(op_ia32_CopyEbpEsp); op_ia32_CopyEbpEsp = NULL;
+	free_ir_op(op_ia32_CvtSI2SD); op_ia32_CvtSI2SD = NULL;
+	free_ir_op(op_ia32_CvtSI2SS); op_ia32_CvtSI2SS = NULL;
+	free_ir_op(op_ia32_Cwtl); op_ia32_Cwtl = NULL;
+	free_ir_op(op_ia32_Dec); op_ia32_Dec = NULL;
+	free_ir_op(op_ia32_DecMem); op_ia32_DecMem = NULL;
+	free_ir_op(op_ia32_Div); op_ia32_Div = NULL;
+	free_ir_op(op_ia32_Enter); op_ia32_Enter = NULL;
+	free_ir_op(op_ia32_FldCW); op_ia32_FldCW = NULL;
+	free_ir_op(op_ia32_FnstCW); op_ia32_FnstCW = NULL;
+	free_ir_op(op_ia32_FnstCWNOP); op_ia32_FnstCWNOP = NULL;
+	free_ir_op(op_ia32_FtstFnstsw); op_ia32_FtstFnstsw = NULL;
+	free_ir_op(op_ia32_FucomFnstsw); op_ia32_FucomFnstsw = NULL;
+	free_ir_op(op_ia32_Fucomi); op_ia32_Fucomi = NULL;
+	free_ir_op(op_ia32_FucomppFnstsw); op_ia32_FucomppFnstsw = NULL;
+	free_ir_op(op_ia32_GetEIP); op_ia32_GetEIP = NULL;
+	free_ir_op(op_ia32_IDiv); op_ia32_IDiv = NULL;
+	free_ir_op(op_ia32_IJmp); op_ia32_IJmp = NULL;
+	free_ir_op(op_ia32_IMul); op_ia32_IMul = NULL;
+	free_ir_op(op_ia32_IMul1OP); op_ia32_IMul1OP = NULL;
+	free_ir_op(op_ia32_IMulImm); op_ia32_IMulImm = NULL;
+	free_ir_op(op_ia32_Immediate); op_ia32_Immediate = NULL;
+	free_ir_op(op_ia32_Inc); op_ia32_Inc = NULL;
+	free_ir_op(op_ia32_IncMem); op_ia32_IncMem = NULL;
+	free_ir_op(op_ia32_Inport); op_ia32_Inport = NULL;
+	free_ir_op(op_ia32_Jcc); op_ia32_Jcc = NULL;
+	free_ir_op(op_ia32_Jmp); op_ia32_Jmp = NULL;
+	free_ir_op(op_ia32_LdTls); op_ia32_LdTls = NULL;
+	free_ir_op(op_ia32_Lea); op_ia32_Lea = NULL;
+	free_ir_op(op_ia32_Leave); op_ia32_Leave = NULL;
+	free_ir_op(op_ia32_Load); op_ia32_Load = NULL;
+	free_ir_op(op_ia32_Minus64); op_ia32_Minus64 = NULL;
+	free_ir_op(op_ia32_Mul); op_ia32_Mul = NULL;
+	free_ir_op(op_ia32_Neg); op_ia32_Neg = NULL;
+	free_ir_op(op_ia32_NegMem); op_ia32_NegMem = NULL;
+	free_ir_op(op_ia32_NoReg_FP); op_ia32_NoReg_FP = NULL;
+	free_ir_op(op_ia32_NoReg_GP); op_ia32_NoReg_GP = NULL;
+	free_ir_op(op_ia32_NoReg_XMM); op_ia32_NoReg_XMM = NULL;
+	free_ir_op(op_ia32_Not); op_ia32_Not = NULL;
+	free_ir_op(op_ia32_NotMem); op_ia32_NotMem = NULL;
+	free_ir_op(op_ia32_Or); op_ia32_Or = NULL;
+	free_ir_op(op_ia32_OrMem); op_ia32_OrMem = NULL;
+	free_ir_op(op_ia32_Outport); op_ia32_Outport = NULL;
+	free_ir_op(op_ia32_Pop); op_ia32_Pop = NULL;
+	free_ir_op(op_ia32_PopMem); op_ia32_PopMem = NULL;
+	free_ir_op(op_ia32_Popcnt); op_ia32_Popcnt = NULL;
+	free_ir_op(op_ia32_Prefetch); op_ia32_Prefetch = NULL;
+	free_ir_op(op_ia32_Prefetch0); op_ia32_Prefetch0 = NULL;
+	free_ir_op(op_ia32_Prefetch1); op_ia32_Prefetch1 = NULL;
+	free_ir_op(op_ia32_Prefetch2); op_ia32_Prefetch2 = NULL;
+	free_ir_op(op_ia32_PrefetchNTA); op_ia32_PrefetchNTA = NULL;
+	free_ir_op(op_ia32_PrefetchW); op_ia32_PrefetchW = NULL;
+	free_ir_op(op_ia32_Push); op_ia32_Push = NULL;
+	free_ir_op(op_ia32_PushEax); op_ia32_PushEax = NULL;
+	free_ir_op(op_ia32_Return); op_ia32_Return = NULL;
+	free_ir_op(op_ia32_Rol); op_ia32_Rol = NULL;
+	free_ir_op(op_ia32_RolMem); op_ia32_RolMem = NULL;
+	free_ir_op(op_ia32_Ror); op_ia32_Ror = NULL;
+	free_ir_op(op_ia32_RorMem); op_ia32_RorMem = NULL;
+	free_ir_op(op_ia32_Sahf); op_ia32_Sahf = NULL;
+	free_ir_op(op_ia32_Sar); op_ia32_Sar = NULL;
+	free_ir_op(op_ia32_SarMem); op_ia32_SarMem = NULL;
+	free_ir_op(op_ia32_Sbb); op_ia32_Sbb = NULL;
+	free_ir_op(op_ia32_Sbb0); op_ia32_Sbb0 = NULL;
+	free_ir_op(op_ia32_Setcc); op_ia32_Setcc = NULL;
+	free_ir_op(op_ia32_SetccMem); op_ia32_SetccMem = NULL;
+	free_ir_op(op_ia32_Shl); op_ia32_Shl = NULL;
+	free_ir_op(op_ia32_ShlD); op_ia32_ShlD = NULL;
+	free_ir_op(op_ia32_ShlMem); op_ia32_ShlMem = NULL;
+	free_ir_op(op_ia32_Shr); op_ia32_Shr = NULL;
+	free_ir_op(op_ia32_ShrD); op_ia32_ShrD = NULL;
+	free_ir_op(op_ia32_ShrMem); op_ia32_ShrMem = NULL;
+	free_ir_op(op_ia32_Start); op_ia32_Start = NULL;
+	free_ir_op(op_ia32_Stc); op_ia32_Stc = NULL;
+	free_ir_op(op_ia32_Store); op_ia32_Store = NULL;
+	free_ir_op(op_ia32_Sub); op_ia32_Sub = NULL;
+	free_ir_op(op_ia32_SubMem); op_ia32_SubMem = NULL;
+	free_ir_op(op_ia32_SubSP); op_ia32_SubSP = NULL;
+	free_ir_op(op_ia32_SwitchJmp); op_ia32_SwitchJmp = NULL;
+	free_ir_op(op_ia32_Test); op_ia32_Test = NULL;
+	free_ir_op(op_ia32_UD2); op_ia32_UD2 = NULL;
+	free_ir_op(op_ia32_Ucomi); op_ia32_Ucomi = NULL;
+	free_ir_op(op_ia32_Unknown); op_ia32_Unknown = NULL;
+	free_ir_op(op_ia32_Xor); op_ia32_Xor = NULL;
+	free_ir_op(op_ia32_Xor0); op_ia32_Xor0 = NULL;
+	free_ir_op(op_ia32_XorHighLow); op_ia32_XorHighLow = NULL;
+	free_ir_op(op_ia32_XorMem); op_ia32_XorMem = NULL;
+	free_ir_op(op_ia32_emms); op_ia32_emms = NULL;
+	free_ir_op(op_ia32_fabs); op_ia32_fabs = NULL;
+	free_ir_op(op_ia32_fadd); op_ia32_fadd = NULL;
+	free_ir_op(op_ia32_fchs); op_ia32_fchs = NULL;
+	free_ir_op(op_ia32_fdiv); op_ia32_fdiv = NULL;
+	free_ir_op(op_ia32_fdup); op_ia32_fdup = NULL;
+	free_ir_op(op_ia32_femms); op_ia32_femms = NULL;
+	free_ir_op(op_ia32_ffreep); op_ia32_ffreep = NULL;
+	free_ir_op(op_ia32_fild); op_ia32_fild = NULL;
+	free_ir_op(op_ia32_fist); op_ia32_fist = NULL;
+	free_ir_op(op_ia32_fisttp); op_ia32_fisttp = NULL;
+	free_ir_op(op_ia32_fld); op_ia32_fld = NULL;
+	free_ir_op(op_ia32_fld1); op_ia32_fld1 = NULL;
+	free_ir_op(op_ia32_fldl2e); op_ia32_fldl2e = NULL;
+	free_ir_op(op_ia32_fldl2t); op_ia32_fldl2t = NULL;
+	free_ir_op(op_ia32_fldlg2); op_ia32_fldlg2 = NULL;
+	free_ir_op(op_ia32_fldln2); op_ia32_fldln2 = NULL;
+	free_ir_op(op_ia32_fldpi); op_ia32_fldpi = NULL;
+	free_ir_op(op_ia32_fldz); op_ia32_fldz = NULL;
+	free_ir_op(op_ia32_fmul); op_ia32_fmul = NULL;
+	free_ir_op(op_ia32_fpop); op_ia32_fpop = NULL;
+	free_ir_op(op_ia32_fst); op_ia32_fst = NULL;
+	free_ir_op(op_ia32_fsub); op_ia32_fsub = NULL;
+	free_ir_op(op_ia32_fxch); op_ia32_fxch = NULL;
+	free_ir_op(op_ia32_l_Adc); op_ia32_l_Adc = NULL;
+	free_ir_op(op_ia32_l_Add); op_ia32_l_Add = NULL;
+	free_ir_op(op_ia32_l_FloattoLL); op_ia32_l_FloattoLL = NULL;
+	free_ir_op(op_ia32_l_IMul); op_ia32_l_IMul = NULL;
+	free_ir_op(op_ia32_l_LLtoFloat); op_ia32_l_LLtoFloat = NULL;
+	free_ir_op(op_ia32_l_Minus64); op_ia32_l_Minus64 = NULL;
+	free_ir_op(op_ia32_l_Mul); op_ia32_l_Mul = NULL;
+	free_ir_op(op_ia32_l_Sbb); op_ia32_l_Sbb = NULL;
+	free_ir_op(op_ia32_l_Sub); op_ia32_l_Sub = NULL;
+	free_ir_op(op_ia32_xAdd); op_ia32_xAdd = NULL;
+	free_ir_op(op_ia32_xAllOnes); op_ia32_xAllOnes = NULL;
+	free_ir_op(op_ia32_xAnd); op_ia32_xAnd = NULL;
+	free_ir_op(op_ia32_xAndNot); op_ia32_xAndNot = NULL;
+	free_ir_op(op_ia32_xDiv); op_ia32_xDiv = NULL;
+	free_ir_op(op_ia32_xLoad); op_ia32_xLoad = NULL;
+	free_ir_op(op_ia32_xMax); op_ia32_xMax = NULL;
+	free_ir_op(op_ia32_xMin); op_ia32_xMin = NULL;
+	free_ir_op(op_ia32_xMovd); op_ia32_xMovd = NULL;
+	free_ir_op(op_ia32_xMul); op_ia32_xMul = NULL;
+	free_ir_op(op_ia32_xOr); op_ia32_xOr = NULL;
+	free_ir_op(op_ia32_xPslld); op_ia32_xPslld = NULL;
+	free_ir_op(op_ia32_xPsllq); op_ia32_xPsllq = NULL;
+	free_ir_op(op_ia32_xPsrld); op_ia32_xPsrld = NULL;
+	free_ir_op(op_ia32_xPzero); op_ia32_xPzero = NULL;
+	free_ir_op(op_ia32_xStore); op_ia32_xStore = NULL;
+	free_ir_op(op_ia32_xSub); op_ia32_xSub = NULL;
+	free_ir_op(op_ia32_xUnknown); op_ia32_xUnknown = NULL;
+	free_ir_op(op_ia32_xXor); op_ia32_xXor = NULL;
+	free_ir_op(op_ia32_xZero); op_ia32_xZero = NULL;
+	free_ir_op(op_ia32_xxAddpd); op_ia32_xxAddpd = NULL;
+	free_ir_op(op_ia32_xxAddps); op_ia32_xxAddps = NULL;
+	free_ir_op(op_ia32_xxBroadcast16); op_ia32_xxBroadcast16 = NULL;
+	free_ir_op(op_ia32_xxBroadcast32); op_ia32_xxBroadcast32 = NULL;
+	free_ir_op(op_ia32_xxBroadcast8); op_ia32_xxBroadcast8 = NULL;
+	free_ir_op(op_ia32_xxBroadcastpd); op_ia32_xxBroadcastpd = NULL;
+	free_ir_op(op_ia32_xxBroadcastps); op_ia32_xxBroadcastps = NULL;
+	free_ir_op(op_ia32_xxLoad); op_ia32_xxLoad = NULL;
+	free_ir_op(op_ia32_xxMulpd); op_ia32_xxMulpd = NULL;
+	free_ir_op(op_ia32_xxMulps); op_ia32_xxMulps = NULL;
+	free_ir_op(op_ia32_xxPaddb); op_ia32_xxPaddb = NULL;
+	free_ir_op(op_ia32_xxPaddd); op_ia32_xxPaddd = NULL;
+	free_ir_op(op_ia32_xxPaddq); op_ia32_xxPaddq = NULL;
+	free_ir_op(op_ia32_xxPaddw); op_ia32_xxPaddw = NULL;
+	free_ir_op(op_ia32_xxPand); op_ia32_xxPand = NULL;
+	free_ir_op(op_ia32_xxPor); op_ia32_xxPor = NULL;
+	free_ir_op(op_ia32_xxPsubb); op_ia32_xxPsubb = NULL;
+	free_ir_op(op_ia32_xxPsubd); op_ia32_xxPsubd = NULL;
+	free_ir_op(op_ia32_xxPsubq); op_ia32_xxPsubq = NULL;
+	free_ir_op(op_ia32_xxPsubw); op_ia32_xxPsubw = NULL;
+	free_ir_op(op_ia32_xxPxor); op_ia32_xxPxor = NULL;
+	free_ir_op(op_ia32_xxStore); op_ia32_xxStore = NULL;
+	free_ir_op(op_ia32_xxSubpd); op_ia32_xxSubpd = NULL;
+	free_ir_op(op_ia32_xxSubps); op_ia32_xxSubps = NULL;
+
+}
@@ -0,0 +1,15 @@
+/**
+ * @file
+ * @brief Function prototypes for the emitter functions.
+ * @note  DO NOT EDIT THIS FILE, your changes will be lost.
+ *        Edit ir/be/sparc/sparc_spec.pl instead.
+ *        created by: ./ir/be/scripts/generate_emitter.pl ir/be/sparc/sparc_spec.pl build/gen/ir/be/sparc
+ * @date  Fri Oct 16 17:10:41 2026
+ */
+#ifndef FIRM_BE_SPARC_GEN_SPARC_EMITTER_H
+#define FIRM_BE_SPARC_GEN_SPARC_EMITTER_H
+
+void sparc_register_spec_emitters(void);
+
+#endif
+
@@ -91,6 +91,29 @@
 #define NEW_ARR_DZ(type, obstack, nelts) \
 	((type*)memset(NEW_ARR_D(type, (obstack), (nelts)), 0, sizeof(type) * (nelts)))
 
+/**
+ * Returns the number of bytes needed for a dynamic array placed into memory
+ * provided by the caller with INIT_ARR_D().
+ *
+ * @param type     The element type of the array.
+ * @param nelts    A size_t expression evaluating to the number of elements
+ */
+#define ARR_D_SIZE(type, nelts) (ARR_ELTS_OFFS + sizeof(type) * (nelts))
+
+/**
+ * Creates a dynamic array in memory provided by the caller, for example as
+ * part of a larger object on an obstack.
+ *
+ * @param type     The element type of the new array.
+ * @param mem      Memory of at least ARR_D_SIZE() bytes, aligned for
+ *                 ir_arr_descr
+ * @param nelts    A size_t expression evaluating to the number of elements
+ *
+ * @return A pointer to the dynamic array (can be used as a pointer to the
+ *         first element of this array).
+ */
+#define INIT_ARR_D(type, mem, nelts) ((type*)ir_init_arr_d((mem), (nelts)))
+
 /**
  * Duplicates an array and returns the new dynamic one.
  *
@@ -211,6 +234,7 @@ extern ir_arr_descr arr_mt_descr;
 FIRM_API void *ir_new_arr_f(size_t nelts, size_t elts_size);
 FIRM_API void ir_del_arr_f(void *elts);
 FIRM_API void *ir_new_arr_d(struct obstack *obstack, size_t nelts, size_t elts_size);
+FIRM_API void *ir_init_arr_d(void *mem, size_t nelts);
 FIRM_API void *ir_arr_resize(void *elts, size_t nelts, size_t elts_size);
 FIRM_API void *ir_arr_setlen(void *elts, size_t nelts, size_t elts_size);
 FIRM_API void ir_verify_arr(const void *elts);
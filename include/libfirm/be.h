@@ -135,6 +135,10 @@ typedef struct backend_params {
 
 	/** Semantic on float->int conversion overflow. */
 	float_int_conversion_overflow_style_t float_int_overflow;
+
+	/** Size of the vector registers in bytes. Values of vector modes of this
+	 * size are supported by the backend. 0 if there is no vector support. */
+	unsigned vector_size;
 } backend_params;
 
 /**
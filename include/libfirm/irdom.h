@@ -168,6 +168,24 @@ FIRM_API void postdom_tree_walk_irg(ir_graph *irg, irg_walk_func *pre,
  */
 FIRM_API void compute_doms(ir_graph *irg);
 
+/**
+ * Updates the dominance information after the control flow edge from block
+ * @p from to block @p to has been inserted.
+ *
+ * The update needs consistent out edges. If the dominance information cannot
+ * be updated, for example because one of the blocks has been created after
+ * it was computed, it is invalidated instead.
+ */
+FIRM_API void dom_insert_edge(ir_node *from, ir_node *to);
+
+/**
+ * Updates the dominance information after the control flow edge from block
+ * @p from to block @p to has been removed.
+ *
+ * The same restrictions as for dom_insert_edge() apply.
+ */
+FIRM_API void dom_delete_edge(ir_node *from, ir_node *to);
+
 /** Computes the post dominance relation for all basic blocks of a given graph.
  *
  * Sets a flag in irg to "dom_consistent".
@@ -67,6 +67,7 @@ FIRM_API void collect_new_phi_node(ir_node *node);
  * the nodes producing the Tuple. This can be established by collect_phiprojs().
  * part_block() conserves this property.
  * Adds a Jmp node to new_block that jumps to old_block.
+ * Consistent dominance information is updated.
  *
  * @param node   The node were to break the block
  */
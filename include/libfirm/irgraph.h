@@ -397,6 +397,8 @@ typedef enum ir_graph_properties_t {
 	IR_GRAPH_PROPERTY_CONSISTENT_ENTITY_USAGE        = 1U << 11,
 	/** graph contains as many returns as possible */
 	IR_GRAPH_PROPERTY_MANY_RETURNS                   = 1U << 12,
+	/** cached alias queries (see get_alias_relation()) are up to date */
+	IR_GRAPH_PROPERTY_CONSISTENT_ALIAS_CACHE         = 1U << 13,
 
 	/**
 	 * List of all graph properties that are only affected by control flow
@@ -421,7 +423,8 @@ typedef enum ir_graph_properties_t {
 		| IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
 		| IR_GRAPH_PROPERTY_CONSISTENT_OUTS
 		| IR_GRAPH_PROPERTY_CONSISTENT_ENTITY_USAGE
-		| IR_GRAPH_PROPERTY_MANY_RETURNS,
+		| IR_GRAPH_PROPERTY_MANY_RETURNS
+		| IR_GRAPH_PROPERTY_CONSISTENT_ALIAS_CACHE,
 
 } ir_graph_properties_t;
 ENUM_BITSET(ir_graph_properties_t)
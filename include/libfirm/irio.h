@@ -5,7 +5,7 @@
 
 /**
  * @file
- * @brief   Input/Output textual representation of firm.
+ * @brief   Input/Output textual and binary representation of firm.
  * @author  Moritz Kroll
  */
 #ifndef FIRM_IR_IRIO_H
@@ -52,6 +52,56 @@ FIRM_API int ir_import(const char *filename);
  */
 FIRM_API int ir_import_file(FILE *input, const char *inputname);
 
+/**
+ * Exports the whole irp to the given file in a compact binary form.
+ * The file contains the same information as the textual form plus an index
+ * of the ir graphs, which allows to read them individually on demand.
+ *
+ * @param filename  the name of the resulting file
+ * @return  0 if no errors occured, other values in case of errors
+ */
+FIRM_API int ir_export_binary(const char *filename);
+
+/**
+ * same as ir_export_binary but writes to a FILE*, which must be seekable and
+ * opened in binary mode
+ * @note As with any FILE* errors are indicated by ferror(output)
+ */
+FIRM_API void ir_export_binary_file(FILE *output);
+
+/**
+ * Imports the data stored in the given file in binary form.
+ *
+ * @param filename  the name of the file
+ * @returns 0 if no errors occured, other values in case of errors
+ */
+FIRM_API int ir_import_binary(const char *filename);
+
+/** A binary file from which ir graphs are read on demand. */
+typedef struct ir_binary_import_t ir_binary_import_t;
+
+/**
+ * Maps the given file in binary form into memory and imports everything
+ * except the ir graphs, which are read by ir_binary_import_get_irg().
+ *
+ * @param filename  the name of the file
+ * @returns the import handle or NULL in case of errors
+ */
+FIRM_API ir_binary_import_t *ir_import_binary_lazy(const char *filename);
+
+/**
+ * Returns the ir graph of @p entity, reading it from the file of @p import
+ * when it is requested for the first time.
+ */
+FIRM_API ir_graph *ir_binary_import_get_irg(ir_binary_import_t *import,
+                                            ir_entity *entity);
+
+/**
+ * Unmaps the file of @p import. Graphs which have not been requested until
+ * then are not imported.
+ */
+FIRM_API void ir_binary_import_free(ir_binary_import_t *import);
+
 /** @} */
 
 #include "end.h"
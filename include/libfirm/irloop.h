@@ -52,7 +52,8 @@ FIRM_API void set_irg_loop(ir_graph *irg, ir_loop *l);
 /** Returns the root loop info (if exists) for an irg. */
 FIRM_API ir_loop *get_irg_loop(const ir_graph *irg);
 
-/** Returns the loop n is contained in.  NULL if node is in no loop. */
+/** Returns the loop block n is contained in.  NULL if n is in no loop or no
+ *  block. */
 FIRM_API ir_loop *get_irn_loop(const ir_node *n);
 
 /** Returns outer loop, itself if outermost. */
@@ -51,6 +51,14 @@ typedef enum ir_disambiguator_options {
 } ir_disambiguator_options;
 ENUM_BITSET(ir_disambiguator_options)
 
+/** Solvers for the points-to analysis. */
+typedef enum ir_points_to_kind {
+	/** unify the targets of both sides of an assignment (Steensgaard) */
+	ir_points_to_unification,
+	/** field sensitive subset constraints (Andersen), slower but precise */
+	ir_points_to_inclusion,
+} ir_points_to_kind;
+
 /**
  * Returns a human readable name for an alias relation.
  */
@@ -59,7 +67,8 @@ FIRM_API const char *get_ir_alias_relation_name(ir_alias_relation rel);
 /**
  * Determine if two memory addresses may point to the same memory location.
  * This is determined by looking at the structure of the values or language
- * rules determined by looking at the object types accessed.
+ * rules determined by looking at the object types accessed. If the points-to
+ * analysis was computed, addresses pointing to disjoint objects don't alias.
  *
  * @param addr1   The first address.
  * @param type1   The type of the object found at @p addr1 ("object type").
@@ -139,6 +148,24 @@ FIRM_API void set_irp_memory_disambiguator_options(ir_disambiguator_options opti
  */
 FIRM_API void mark_private_methods(void);
 
+/**
+ * Computes an interprocedural points-to analysis for all graphs of the
+ * program, which is used by get_alias_relation(). Uses the callee
+ * information if it is available (see cgana()).
+ *
+ * Nodes created afterwards are not analysed, and nodes whose inputs are
+ * changed or which are exchanged lose their results. The results stay valid
+ * as long as transformations preserve the values of the unchanged nodes.
+ *
+ * @param kind  the solver to use
+ */
+FIRM_API void compute_irp_points_to(ir_points_to_kind kind);
+
+/**
+ * Frees the points-to information of all graphs.
+ */
+FIRM_API void free_irp_points_to(void);
+
 /** @} */
 
 #include "end.h"
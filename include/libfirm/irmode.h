@@ -113,6 +113,20 @@ FIRM_API ir_mode *new_float_mode(const char *name,
  */
 FIRM_API ir_mode *new_non_arithmetic_mode(const char *name, unsigned bit_size);
 
+/**
+ * Creates a new vector mode.
+ *
+ * Values of vector modes consist of @p n_elements values of
+ * @p element_mode. Arithmetic on vector modes is performed element-wise.
+ * There are no constants of vector modes, use a Broadcast node instead.
+ *
+ * @param name          the name of the mode to be created
+ * @param element_mode  the mode of the elements, an int or float mode
+ * @param n_elements    the number of elements
+ */
+FIRM_API ir_mode *new_vector_mode(const char *name, ir_mode *element_mode,
+                                  unsigned n_elements);
+
 /** Returns the ident* of the mode */
 FIRM_API ident *get_mode_ident(const ir_mode *mode);
 
@@ -290,6 +304,15 @@ FIRM_API int mode_is_num(const ir_mode *mode);
  */
 FIRM_API int mode_is_data(const ir_mode *mode);
 
+/** Returns 1 if @p mode is a vector mode, 0 otherwise */
+FIRM_API int mode_is_vector(const ir_mode *mode);
+
+/** Returns the mode of the elements of the vector mode @p mode. */
+FIRM_API ir_mode *get_mode_vector_element(const ir_mode *mode);
+
+/** Returns the number of elements of the vector mode @p mode. */
+FIRM_API unsigned get_mode_vector_n_elements(const ir_mode *mode);
+
 /**
  * Returns true if a value of mode @p sm can be converted to mode @p lm without
  * loss.
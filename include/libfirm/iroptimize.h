@@ -414,6 +414,28 @@ typedef void (*opt_ptr)(ir_graph *irg);
 FIRM_API void inline_functions(unsigned maxsize, int inline_threshold,
                                opt_ptr after_inline_opt);
 
+/**
+ * Profile guided inliner. Inlines the calls executed most often relative to
+ * the size of the callee first, across all levels of the callgraph, until
+ * the code grew by @p growth_percent.
+ *
+ * The execution counts are taken from the profile if profile data has been
+ * loaded, otherwise they are estimated. Every decision is reported as
+ * statistics event.
+ *
+ * @param maxsize             Do not let a method grow beyond maxsize firm
+ *                            nodes by inlining.
+ * @param growth_percent      allowed growth of the whole program in percent
+ * @param cold_fraction       calls executed less often than this fraction of
+ *                            the most frequent call are not inlined
+ * @param after_inline_opt    optimizations performed immediately after inlining
+ *                            some calls
+ */
+FIRM_API void inline_functions_profiled(unsigned maxsize,
+                                        unsigned growth_percent,
+                                        double cold_fraction,
+                                        opt_ptr after_inline_opt);
+
 /**
  * Combines congruent blocks into one.
  *
@@ -440,6 +462,15 @@ FIRM_API void do_loop_unrolling(ir_graph *irg);
  */
 FIRM_API void do_loop_peeling(ir_graph *irg);
 
+/**
+ * Vectorizes innermost counting loops.
+ * A loop like for (i = i0; i < n; ++i) a[i] = b[i] + c[i]; is preceded by a
+ * loop handling backend_params.vector_size bytes of each array per
+ * iteration. The original loop executes the remaining iterations. Does
+ * nothing if the backend does not support vector modes.
+ */
+FIRM_API void vectorize_loops(ir_graph *irg);
+
 /**
  * Removes all entities which are unused.
  *
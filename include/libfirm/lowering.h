@@ -80,7 +80,10 @@ FIRM_API void lower_CopyB(ir_graph *irg, unsigned max_small_size,
 
 /**
  * Lowers all Switches (Cond nodes with non-boolean mode) depending on spare_size.
- * They will either remain the same or be converted into if-cascades.
+ * The cases are partitioned into clusters of dense cases, which become jump
+ * tables, clusters with few targets within a machine word, which become bit
+ * tests, and single cases. The clusters are selected by a compare tree which
+ * is balanced by the execution frequencies of the case blocks, if present.
  *
  * @param irg        The ir graph to be lowered.
  * @param small_switch  If switch has <= cases then change it to an if-cascade.
@@ -10,6 +10,9 @@
 #ifndef FIRM_TIMING_H
 #define FIRM_TIMING_H
 
+#include <stdio.h>
+
+#include "firm_types.h"
 #include "begin.h"
 
 /**
@@ -114,6 +117,76 @@ FIRM_API unsigned long ir_timer_elapsed_usec(const ir_timer_t *timer);
  */
 FIRM_API double ir_timer_elapsed_sec(const ir_timer_t *timer);
 
+/**
+ * Enables or disables the pass profile.
+ *
+ * While enabled, the optimization and lowering passes record the time they
+ * took and the obstack memory allocated while they ran. Each pass is recorded
+ * per graph and below the pass that invoked it, so the profile is a tree of
+ * call paths like "inline_functions;foo;optimize_graph_df".
+ * While the profile is disabled recording a pass costs a single test.
+ * If statistic events are enabled, the time and memory of each invocation
+ * are also emitted as pass_time (in microseconds) and pass_obstack_bytes
+ * events inside pass_irg and pass contexts.
+ *
+ * @note Must not be called while a pass is running.
+ */
+FIRM_API void ir_pass_timing_enable(int enable);
+
+/**
+ * Begins recording the pass @p name. Drivers may use this to add their own
+ * phases to the profile.
+ *
+ * @param name  the name of the pass, must live until the profile is reset
+ * @param irg   the graph the pass works on or NULL for the graph of the
+ *              invoking pass
+ */
+FIRM_API void ir_pass_timing_push(const char *name, ir_graph *irg);
+
+/**
+ * Ends recording the innermost pass begun with ir_pass_timing_push().
+ */
+FIRM_API void ir_pass_timing_pop(void);
+
+/**
+ * Discards everything recorded in the pass profile.
+ */
+FIRM_API void ir_pass_timing_reset(void);
+
+/**
+ * Writes the pass profile in the collapsed stack format understood by
+ * flamegraph.pl and similar tools: One line per call path consisting of the
+ * semicolon separated names of the graphs and passes followed by the value
+ * spent in the innermost pass itself.
+ *
+ * @param out     the file to write to
+ * @param memory  if non-zero the values are the obstack bytes allocated,
+ *                otherwise they are microseconds
+ */
+FIRM_API void ir_pass_timing_dump(FILE *out, int memory);
+
+/**
+ * Returns the size of all chunks allocated by obstacks so far. The difference
+ * of two calls is the obstack memory requested in between.
+ */
+FIRM_API unsigned long long ir_obstack_bytes_total(void);
+
+/**
+ * Returns the size of all chunks currently held by obstacks.
+ */
+FIRM_API unsigned long long ir_obstack_bytes_live(void);
+
+/**
+ * Returns the maximum of ir_obstack_bytes_live() since the last call of
+ * ir_obstack_reset_peak().
+ */
+FIRM_API unsigned long long ir_obstack_bytes_peak(void);
+
+/**
+ * Resets the peak of the obstack memory to the memory currently held.
+ */
+FIRM_API void ir_obstack_reset_peak(void);
+
 #include "end.h"
 
 #endif
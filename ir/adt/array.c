@@ -66,6 +66,26 @@ void *ir_new_arr_d(struct obstack *obstack, size_t nelts, size_t elts_size)
 	return dp->elts;
 }
 
+/**
+ * Creates a dynamic array in memory provided by the caller.
+ *
+ * @param mem        The memory for the array descriptor and the elements.
+ * @param nelts      The number of elements
+ *
+ * @return A pointer to the dynamic array (can be used as a pointer to the
+ *         first element of this array).
+ *
+ * @remark Helper function, use INIT_ARR_D() instead.
+ */
+void *ir_init_arr_d(void *mem, size_t nelts)
+{
+	ir_arr_descr *dp = (ir_arr_descr*)mem;
+
+	ARR_SET_DBGINF(dp, ARR_D_MAGIC);
+	dp->allocated = dp->nelts = nelts;
+	return dp->elts;
+}
+
 /**
  * Creates a flexible array.
  *
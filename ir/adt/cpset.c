@@ -18,11 +18,9 @@
 #define HashSetEntry              cpset_hashset_entry_t
 #define ValueType                 void*
 #define NullValue                 NULL
-#define DeletedValue              ((void*)-1)
 #define Hash(this,key)            this->hash_function(key)
 #define KeysEqual(this,key1,key2) this->cmp_function(key1, key2)
 #define SCALAR_RETURN
-#define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof(cpset_hashset_entry_t))
 
 void cpset_init_(cpset_t *self);
 #define hashset_init            cpset_init_
@@ -37,7 +35,7 @@ void cpset_init_size_(cpset_t *self, size_t expected_elems);
 #define hashset_iterator_next   cpset_iterator_next
 #define hashset_remove_iterator cpset_remove_iterator
 
-#include "hashset.c.inl"
+#include "swisstable.c.inl"
 
 void cpset_init(cpset_t *this_, cpset_hash_function hash_function,
                 cpset_cmp_function cmp_function)
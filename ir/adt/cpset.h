@@ -15,7 +15,8 @@
 /**
  * @ingroup adt
  * @defgroup Pointer Set (custom Compare)
- * A pointer set with user-definable compare function
+ * A pointer set with user-definable compare function. It is implemented as
+ * an open addressing table with control bytes (see swisstable.c.inl).
  * @{
  */
 
@@ -41,7 +42,7 @@ typedef unsigned (*cpset_hash_function) (const void *obj);
 #define HashSetEntry     cpset_hashset_entry_t
 #define ValueType        void*
 #define ADDITIONAL_DATA  cpset_cmp_function cmp_function; cpset_hash_function hash_function;
-#include "hashset.h"
+#include "swisstable.h"
 #undef ADDITIONAL_DATA
 #undef ValueType
 #undef HashSetEntry
@@ -149,6 +150,12 @@ void *cpset_iterator_next(cpset_iterator_t *iterator);
  */
 void cpset_remove_iterator(cpset_t *cpset, const cpset_iterator_t *iterator);
 
+/**
+ * Convenience macro for iterating over a cpset.
+ */
+#define foreach_cpset(cpset, type, ptr, iter) \
+	for (cpset_iterator_init(&iter, cpset); (ptr = (type)cpset_iterator_next(&iter));)
+
 /** @} */
 
 #endif
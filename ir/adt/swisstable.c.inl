@@ -0,0 +1,550 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Generic open addressing hashset with control bytes
+ *
+ * This is a drop-in replacement for hashset.c.inl following the design of
+ * Google's SwissTable: Next to the bucket array we keep one control byte per
+ * bucket. A control byte is either EMPTY, DELETED or holds 7 bits of the
+ * hash value of the element stored in the bucket. Probing looks at a group
+ * of consecutive control bytes at once (16 with SSE2, 8 otherwise) and only
+ * inspects buckets whose control byte matches, so most unsuccessful compares
+ * never touch the bucket array.
+ *
+ * You have to specialize this file by defining:
+ *
+ * <ul>
+ *  <li><b>HashSet</b>         The name of the hashset type</li>
+ *  <li><b>HashSetIterator</b> The name of the hashset iterator type</li>
+ *  <li><b>ValueType</b>       The type of the stored data values</li>
+ *  <li><b>NullValue</b>       A special value representing no values</li>
+ *  <li><b>Hash(hashset,key)</b> calculates the hash value for a given key</li>
+ * </ul>
+ *
+ * The optional defines KeyType, GetKey, KeysEqual, InitData, ConstKeyType,
+ * SCALAR_RETURN, ADDITIONAL_DATA, ADDITIONAL_INIT, ADDITIONAL_TERM and
+ * HT_MIN_BUCKETS have the same meaning as in hashset.c.inl. DeletedValue and
+ * SetRangeEmpty are not needed as the control bytes mark free buckets.
+ * Define <b>HashSetScope</b> as static to keep the functions local to the
+ * including file.
+ */
+#ifdef HashSet
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "bitfiddle.h"
+#include "xmalloc.h"
+
+#ifndef FIRM_ADT_SWISSTABLE_GROUP
+#define FIRM_ADT_SWISSTABLE_GROUP
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/** control byte of a bucket that was never used */
+#define CTRL_EMPTY   ((signed char)-128)
+/** control byte of a bucket whose element was removed */
+#define CTRL_DELETED ((signed char)-2)
+
+/** A bit for each bucket of a group, bit i represents the i-th bucket. */
+typedef uint32_t group_mask_t;
+
+#if defined(__SSE2__)
+
+#define GROUP_WIDTH 16
+
+static inline group_mask_t group_match(const signed char *ctrl, signed char h2)
+{
+	__m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(h2)));
+}
+
+static inline group_mask_t group_match_empty(const signed char *ctrl)
+{
+	return group_match(ctrl, CTRL_EMPTY);
+}
+
+static inline group_mask_t group_match_free(const signed char *ctrl)
+{
+	/* EMPTY and DELETED are the only control bytes with the sign bit set */
+	__m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+	return _mm_movemask_epi8(group);
+}
+
+#else
+
+#define GROUP_WIDTH 8
+
+static inline group_mask_t group_match(const signed char *ctrl, signed char h2)
+{
+	group_mask_t mask = 0;
+	for (unsigned i = 0; i < GROUP_WIDTH; ++i)
+		mask |= (group_mask_t)(ctrl[i] == h2) << i;
+	return mask;
+}
+
+static inline group_mask_t group_match_empty(const signed char *ctrl)
+{
+	return group_match(ctrl, CTRL_EMPTY);
+}
+
+static inline group_mask_t group_match_free(const signed char *ctrl)
+{
+	group_mask_t mask = 0;
+	for (unsigned i = 0; i < GROUP_WIDTH; ++i)
+		mask |= (group_mask_t)(ctrl[i] < 0) << i;
+	return mask;
+}
+
+#endif
+
+/** Number of leading buckets without a set bit in a group mask. */
+static inline unsigned group_leading(group_mask_t mask)
+{
+	return nlz(mask) - (32 - GROUP_WIDTH);
+}
+
+/** The 7 hash bits stored in the control byte. The low bits select the
+ * first bucket, so take the high bits of a scrambled hash. */
+static inline signed char hash_h2(unsigned hash)
+{
+	return (signed char)((hash * 0x9E3779B1u) >> 25);
+}
+
+#endif
+
+#ifndef Hash
+#define ID_HASH
+#define Hash(self,key)        ((unsigned)(((char *)key) - (char *)0))
+#endif /* Hash */
+
+#ifdef ID_HASH
+#define FindReturnValue                 bool
+#define GetFindReturnValue(entry,found) (found)
+#define NullReturnValue                 false
+#define InsertReturnValue(findreturn)   !(findreturn)
+#else /* ! ID_HASH */
+#ifdef SCALAR_RETURN
+#define FindReturnValue                 ValueType
+#define GetFindReturnValue(entry,found) (entry).data
+#define NullReturnValue                 NullValue
+#else
+#define FindReturnValue                 ValueType*
+#define GetFindReturnValue(entry,found) & (entry).data
+#define NullReturnValue                 & NullValue
+#endif
+#endif /* ID_HASH */
+
+#ifndef InsertReturnValue
+#define InsertReturnValue(findreturn)   findreturn
+#endif
+
+#ifndef KeyType
+#define KeyType                  ValueType
+#define GetKey(value)            (value)
+#define InitData(self,value,key) (value) = (key)
+#endif /* KeyType */
+
+#ifndef ConstKeyType
+#define ConstKeyType             const KeyType
+#endif /* ConstKeyType */
+
+#ifndef HashSetScope
+#define HashSetScope
+#endif
+
+#ifndef HT_MIN_BUCKETS
+/** default smallest bucket size */
+#define HT_MIN_BUCKETS    32
+#endif /* HT_MIN_BUCKETS */
+
+/** how full before we grow: 7/8 */
+#define HT_MAX_LOAD(x)    ((x) - (x) / 8)
+
+/**
+ * Sets the control byte of a bucket. The first GROUP_WIDTH control bytes are
+ * mirrored behind the end so a group can be loaded at every position.
+ * @internal
+ */
+static inline void set_ctrl(HashSet *self, size_t pos, signed char c)
+{
+	self->ctrl[pos] = c;
+	if (pos < GROUP_WIDTH)
+		self->ctrl[self->num_buckets + pos] = c;
+}
+
+/**
+ * Allocates empty control bytes and buckets.
+ * @internal
+ */
+static void alloc_buckets(HashSet *self, size_t num_buckets)
+{
+	assert(is_po2(num_buckets) && num_buckets >= GROUP_WIDTH);
+	self->ctrl        = XMALLOCN(signed char, num_buckets + GROUP_WIDTH);
+	self->entries     = XMALLOCN(HashSetEntry, num_buckets);
+	self->num_buckets = num_buckets;
+	self->growth_left = HT_MAX_LOAD(num_buckets) - self->num_elements;
+	memset(self->ctrl, CTRL_EMPTY, num_buckets + GROUP_WIDTH);
+}
+
+#ifdef hashset_size
+/**
+ * Returns the number of elements in the hashset
+ */
+HashSetScope size_t hashset_size(const HashSet *self)
+{
+	return self->num_elements;
+}
+#else
+static inline size_t hashset_size(const HashSet *self)
+{
+	return self->num_elements;
+}
+#endif
+
+/**
+ * Returns the bucket of the element with key @p key or (size_t)-1.
+ * @internal
+ */
+static inline size_t find_pos(const HashSet *self, ConstKeyType key,
+                              unsigned hash)
+{
+	size_t      hashmask = self->num_buckets - 1;
+	size_t      pos      = hash & hashmask;
+	size_t      stride   = 0;
+	signed char h2       = hash_h2(hash);
+
+	for (;;) {
+		const signed char *group = &self->ctrl[pos];
+		for (group_mask_t m = group_match(group, h2); m != 0; m &= m - 1) {
+			size_t        i     = (pos + ntz(m)) & hashmask;
+			HashSetEntry *entry = &self->entries[i];
+			if (entry->hash == hash
+			    && KeysEqual(self, GetKey(entry->data), key))
+				return i;
+		}
+		if (group_match_empty(group) != 0)
+			return (size_t)-1;
+
+		/* triangular probing visits every group once */
+		stride += GROUP_WIDTH;
+		pos     = (pos + stride) & hashmask;
+		assert(stride <= self->num_buckets);
+	}
+}
+
+/**
+ * Returns the first empty or deleted bucket on the probe sequence of @p hash.
+ * @internal
+ */
+static inline size_t find_free_pos(const HashSet *self, unsigned hash)
+{
+	size_t hashmask = self->num_buckets - 1;
+	size_t pos      = hash & hashmask;
+	size_t stride   = 0;
+
+	for (;;) {
+		group_mask_t m = group_match_free(&self->ctrl[pos]);
+		if (m != 0)
+			return (pos + ntz(m)) & hashmask;
+		stride += GROUP_WIDTH;
+		pos     = (pos + stride) & hashmask;
+		assert(stride <= self->num_buckets);
+	}
+}
+
+/**
+ * Resize the hashset, this also drops all deleted markers.
+ * @internal
+ */
+static void resize(HashSet *self, size_t new_size)
+{
+	signed char  *old_ctrl    = self->ctrl;
+	HashSetEntry *old_entries = self->entries;
+	size_t        num_buckets = self->num_buckets;
+
+	alloc_buckets(self, new_size);
+#ifndef NDEBUG
+	self->entries_version++;
+#endif
+
+	for (size_t i = 0; i < num_buckets; ++i) {
+		if (old_ctrl[i] < 0)
+			continue;
+		HashSetEntry *entry = &old_entries[i];
+		size_t        pos   = find_free_pos(self, entry->hash);
+		set_ctrl(self, pos, old_ctrl[i]);
+		self->entries[pos] = *entry;
+	}
+
+	free(old_ctrl);
+	free(old_entries);
+}
+
+/**
+ * Makes sure there is room for one more element in an empty bucket.
+ * @internal
+ */
+static inline void maybe_resize(HashSet *self)
+{
+	size_t size = self->num_elements;
+	if (UNLIKELY(self->consider_shrink)) {
+		self->consider_shrink = 0;
+		if (self->num_buckets > HT_MIN_BUCKETS && size < self->num_buckets / 8) {
+			size_t resize_to = ceil_po2(size * 2);
+			if (resize_to < HT_MIN_BUCKETS)
+				resize_to = HT_MIN_BUCKETS;
+			resize(self, resize_to);
+			return;
+		}
+	}
+
+	if (LIKELY(self->growth_left > 0))
+		return;
+
+	/* mostly deleted buckets: clean them up, otherwise double the size */
+	size_t resize_to = self->num_buckets;
+	if (size + 1 > HT_MAX_LOAD(self->num_buckets) / 2) {
+		resize_to *= 2;
+		if (resize_to <= self->num_buckets)
+			abort();
+	}
+	resize(self, resize_to);
+}
+
+#ifdef hashset_insert
+/**
+ * Insert an element into the hashset. If no element with the given key exists yet,
+ * then a new one is created and initialized with the InitData function.
+ * Otherwise the existing element is returned (for hashs where key is equal to
+ * value, nothing is returned.)
+ *
+ * @param self   the hashset
+ * @param key    the key that identifies the data
+ * @returns      the existing or newly created data element (or nothing in case of hashs where keys are the while value)
+ */
+HashSetScope FindReturnValue hashset_insert(HashSet *self, KeyType key)
+{
+	unsigned hash = Hash(self, key);
+	size_t   pos  = find_pos(self, key, hash);
+	if (pos != (size_t)-1)
+		return InsertReturnValue(GetFindReturnValue(self->entries[pos], true));
+
+#ifndef NDEBUG
+	self->entries_version++;
+#endif
+	maybe_resize(self);
+
+	pos = find_free_pos(self, hash);
+	if (self->ctrl[pos] == CTRL_EMPTY)
+		self->growth_left--;
+	set_ctrl(self, pos, hash_h2(hash));
+	self->num_elements++;
+
+	HashSetEntry *entry = &self->entries[pos];
+	InitData(self, entry->data, key);
+	entry->hash = hash;
+	return InsertReturnValue(GetFindReturnValue(*entry, false));
+}
+#endif
+
+#ifdef hashset_find
+/**
+ * Searches for an element with key @p key.
+ *
+ * @param self      the hashset
+ * @param key       the key to search for
+ * @returns         the found value or NullValue if nothing was found
+ */
+HashSetScope FindReturnValue hashset_find(const HashSet *self, ConstKeyType key)
+{
+	size_t pos = find_pos(self, key, Hash(self, key));
+	if (pos == (size_t)-1)
+		return NullReturnValue;
+	return GetFindReturnValue(self->entries[pos], true);
+}
+#endif
+
+/**
+ * Frees the bucket at @p pos. If the bucket was never part of a full group
+ * no probe sequence has walked past it and it can become empty again.
+ * @internal
+ */
+static inline void erase_pos(HashSet *self, size_t pos)
+{
+	size_t       hashmask = self->num_buckets - 1;
+	size_t       before   = (pos - GROUP_WIDTH) & hashmask;
+	group_mask_t empty_before = group_match_empty(&self->ctrl[before]);
+	group_mask_t empty_after  = group_match_empty(&self->ctrl[pos]);
+
+	if (empty_before != 0 && empty_after != 0
+	    && group_leading(empty_before) + ntz(empty_after) < GROUP_WIDTH) {
+		set_ctrl(self, pos, CTRL_EMPTY);
+		self->growth_left++;
+	} else {
+		set_ctrl(self, pos, CTRL_DELETED);
+	}
+	self->num_elements--;
+	self->consider_shrink = 1;
+}
+
+#ifdef hashset_remove
+/**
+ * Removes an element from a hashset. Does nothing if the set doesn't contain
+ * the element.
+ *
+ * @param self    the hashset
+ * @param key     key that identifies the data to remove
+ */
+HashSetScope void hashset_remove(HashSet *self, ConstKeyType key)
+{
+#ifndef NDEBUG
+	self->entries_version++;
+#endif
+	size_t pos = find_pos(self, key, Hash(self, key));
+	if (pos != (size_t)-1)
+		erase_pos(self, pos);
+}
+#endif
+
+/**
+ * Initializes hashset with a specific size
+ * @internal
+ */
+static inline void init_size(HashSet *self, size_t initial_size)
+{
+	if (initial_size < HT_MIN_BUCKETS)
+		initial_size = HT_MIN_BUCKETS;
+
+	self->num_elements    = 0;
+	self->consider_shrink = 0;
+	alloc_buckets(self, initial_size);
+#ifndef NDEBUG
+	self->entries_version = 0;
+#endif
+#ifdef ADDITIONAL_INIT
+	ADDITIONAL_INIT
+#endif
+}
+
+#ifdef hashset_init
+/**
+ * Initializes a hashset with the default size. The memory for the set has to
+ * already allocated.
+ */
+HashSetScope void hashset_init(HashSet *self)
+{
+	init_size(self, HT_MIN_BUCKETS);
+}
+#endif
+
+#ifdef hashset_destroy
+/**
+ * Destroys a hashset, freeing all used memory (except the memory for the
+ * HashSet struct itself).
+ */
+HashSetScope void hashset_destroy(HashSet *self)
+{
+#ifdef ADDITIONAL_TERM
+	ADDITIONAL_TERM
+#endif
+	free(self->ctrl);
+	free(self->entries);
+#ifndef NDEBUG
+	self->ctrl    = NULL;
+	self->entries = NULL;
+#endif
+}
+#endif
+
+#ifdef hashset_init_size
+/**
+ * Initializes a hashset expecting expected_element size.
+ */
+HashSetScope void hashset_init_size(HashSet *self, size_t expected_elements)
+{
+	if (expected_elements >= UINT_MAX/2)
+		abort();
+
+	size_t needed_size = expected_elements + expected_elements / 7 + 1;
+	init_size(self, ceil_po2(needed_size));
+}
+#endif
+
+#ifdef hashset_iterator_init
+/**
+ * Initializes a hashset iterator. The memory for the allocator has to be
+ * already allocated.
+ * @note it is not allowed to remove or insert elements while iterating
+ */
+HashSetScope void hashset_iterator_init(HashSetIterator *self,
+                                        const HashSet *hashset)
+{
+	self->ctrl        = hashset->ctrl;
+	self->entries     = hashset->entries;
+	self->pos         = (size_t)-1;
+	self->num_buckets = hashset->num_buckets;
+#ifndef NDEBUG
+	self->set             = hashset;
+	self->entries_version = hashset->entries_version;
+#endif
+}
+#endif
+
+#ifdef hashset_iterator_next
+/**
+ * Returns the next value in the iterator or NULL if no value is left
+ * in the hashset.
+ * @note it is not allowed to remove or insert elements while iterating
+ */
+HashSetScope ValueType hashset_iterator_next(HashSetIterator *self)
+{
+	/* using hashset_insert or hashset_remove is not allowed while iterating */
+	assert(self->entries_version == self->set->entries_version);
+
+	size_t pos = self->pos;
+	do {
+		++pos;
+		if (pos >= self->num_buckets) {
+			self->pos = self->num_buckets;
+			return NullValue;
+		}
+	} while (self->ctrl[pos] < 0);
+
+	self->pos = pos;
+	return self->entries[pos].data;
+}
+#endif
+
+#ifdef hashset_remove_iterator
+/**
+ * Removes the element the iterator points to. Removing an element a second time
+ * has no result.
+ */
+HashSetScope void hashset_remove_iterator(HashSet *self,
+                                          const HashSetIterator *iter)
+{
+	size_t pos = iter->pos;
+
+	/* iterator_next needs to have been called at least once and has to be
+	 * on a valid element */
+	assert(pos < self->num_buckets);
+
+	if (self->ctrl[pos] < 0)
+		return;
+
+	erase_pos(self, pos);
+}
+#endif
+
+#endif
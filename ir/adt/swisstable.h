@@ -0,0 +1,52 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Generic open addressing hashset with control bytes
+ *
+ * Structure definitions for swisstable.c.inl. You have to specialize this
+ * header by defining HashSet, HashSetIterator and ValueType, just like
+ * hashset.h.
+ */
+#ifdef HashSet
+
+#include <stdlib.h>
+
+typedef struct HashSetEntry {
+	ValueType data;
+	unsigned hash;
+} HashSetEntry;
+
+struct HashSet {
+	signed char  *ctrl;        /**< control bytes, see swisstable.c.inl */
+	HashSetEntry *entries;
+	size_t        num_buckets;
+	size_t        num_elements;
+	size_t        growth_left; /**< insertions into empty buckets before
+	                                we have to resize */
+	int           consider_shrink;
+#ifndef NDEBUG
+	unsigned entries_version;
+#endif
+#ifdef ADDITIONAL_DATA
+	ADDITIONAL_DATA
+#endif
+};
+
+#ifdef HashSetIterator
+struct HashSetIterator {
+	const signed char *ctrl;
+	HashSetEntry      *entries;
+	size_t             pos;
+	size_t             num_buckets;
+#ifndef NDEBUG
+	const struct HashSet *set;
+	unsigned entries_version;
+#endif
+};
+#endif
+
+#endif
@@ -20,6 +20,12 @@
  * We then assign equally distributed probablilities for normal controlflow
  * splits, and higher probabilities for backedges.
  *
+ * Small graphs are solved with a dense QR decomposition. Larger graphs are
+ * assembled into a sparse system which is decomposed into its outermost loop
+ * nests: Blocks outside of loops are computed by simple substitution in
+ * topological order. Loop nests are solved by sparse elimination, or with
+ * Gauss-Seidel iteration if too many loops are entered at the same time.
+ *
  * Special case: In case of endless loops or "noreturn" calls some blocks have
  * no path to the end node, which produces undesired results (0, infinite
  * execution frequencies). We alleviate that by adding artificial edges from
@@ -33,8 +39,10 @@
 
 #include "set.h"
 #include "hashptr.h"
+#include "pmap.h"
 #include "debug.h"
 #include "dfs_t.h"
+#include "obst.h"
 #include "panic.h"
 #include "xmalloc.h"
 
@@ -57,7 +65,17 @@
 
 #define MAX_INT_FREQ 1000000
 
+/** Graphs with fewer blocks are solved with the dense QR decomposition. */
+#define SPARSE_MIN_BLOCKS 64
+/** Maximum number of open variables when eliminating a loop nest. */
+#define ELIM_MAX_TERMS    256
+/** Relative precision of the Gauss-Seidel iteration. */
+#define GS_EPSILON        1e-10
+/** Maximum number of Gauss-Seidel sweeps over a single loop nest. */
+#define GS_MAX_SWEEPS     10000
+
 static hook_entry_t hook;
+static execfreq_solver_t solver = EXECFREQ_SOLVER_AUTO;
 
 typedef struct {
 	unsigned size;
@@ -245,6 +263,21 @@ static double get_sum_succ_factors(const ir_node *block, double inv_loop_weight)
 	return sum;
 }
 
+void set_block_cf_probability(ir_node *block, int pos, double probability)
+{
+	int const arity = get_Block_n_cfgpreds(block);
+	assert(0 <= pos && pos < arity);
+	block_attr *const attr = &block->attr.block;
+	if (attr->cf_probabilities == NULL || attr->n_cf_probabilities != arity) {
+		ir_graph *const irg = get_irn_irg(block);
+		attr->cf_probabilities   = OALLOCN(get_irg_obstack(irg), double, arity);
+		attr->n_cf_probabilities = arity;
+		for (int i = 0; i < arity; ++i)
+			attr->cf_probabilities[i] = -1.0;
+	}
+	attr->cf_probabilities[pos] = probability;
+}
+
 /*
  * Determine probability that predecessor pos takes this cf edge.
  */
@@ -255,6 +288,13 @@ static double get_cf_probability(const ir_node *bb, int pos,
 	if (pred == NULL)
 		return 0;
 
+	/* prefer profiled probabilities if the block was not changed since */
+	const block_attr *const attr = &bb->attr.block;
+	if (attr->cf_probabilities != NULL
+	    && attr->n_cf_probabilities == get_Block_n_cfgpreds(bb)
+	    && attr->cf_probabilities[pos] >= 0.0)
+		return attr->cf_probabilities[pos];
+
 	const ir_loop *loop       = get_irn_loop(bb);
 	const int      depth      = get_loop_depth(loop);
 	const ir_loop *pred_loop  = get_irn_loop(pred);
@@ -394,22 +434,19 @@ static double mat_dot_vec_entry(square_matrix *mat, double *vec, int row)
 	return acc;
 }
 
-void ir_estimate_execfreq(ir_graph *irg)
+static bool is_valid_freq(double const freq)
 {
-	double loop_weight = 10.0;
-
-	assure_irg_properties(irg,
-		IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
-		| IR_GRAPH_PROPERTY_NO_BADS
-		| IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
-		| IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE);
-
-	/* compute a DFS.
-	 * using a toposort on the CFG (without back edges) will propagate
-	 * the values better for the gauss/seidel iteration.
-	 * => they can "flow" from start to end. */
-	dfs_t *const dfs = dfs_new(irg);
+	/* Check for inf, nan and negative values. */
+	return !isinf(freq) && freq >= 0;
+}
 
+/**
+ * Solves the system of equations with a dense QR decomposition after
+ * eliminating all blocks which can be computed by simple substitution.
+ */
+static bool solve_dense(ir_graph *const irg, dfs_t *const dfs,
+                        double const inv_loop_weight)
+{
 	unsigned       size   = dfs_get_n_nodes(dfs);
 	square_matrix *in_fac = mat_create(size);
 	for (unsigned r = 0; r < size; r++) {
@@ -418,32 +455,10 @@ void ir_estimate_execfreq(ir_graph *irg)
 		}
 	}
 
-
 	ir_node *const start_block = get_irg_start_block(irg);
 	ir_node *const end_block   = get_irg_end_block(irg);
 	const int      end_idx     = size - dfs_get_post_num(dfs, end_block) - 1;
 
-	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED
-	                          | IR_RESOURCE_IRN_VISITED
-	                          | IR_RESOURCE_IRN_LINK);
-	inc_irg_block_visited(irg);
-
-	/* mark all blocks reachable from end_block as (block)visited
-	 * (so we can detect places like endless-loops/noreturn calls which
-	 *  do not reach the End block) */
-	block_walk_no_keeps(end_block);
-	/* mark all kept blocks as (node)visited */
-	inc_irg_visited(irg);
-	const ir_node *end          = get_irg_end(irg);
-	int const      n_keepalives = get_End_n_keepalives(end);
-	for (int k = n_keepalives - 1; k >= 0; --k) {
-		ir_node *keep = get_End_keepalive(end, k);
-		if (is_Block(keep)) {
-			mark_irn_visited(keep);
-		}
-	}
-
-	double const inv_loop_weight = 1.0 / loop_weight;
 	/* lgs_to_mat[i] is the index of the block represented by the
 	 * i-th row/column in the LGS matrix. */
 	int *lgs_to_mat = NEW_ARR_F(int, 0);
@@ -484,6 +499,8 @@ void ir_estimate_execfreq(ir_graph *irg)
 
 	/* add artifical edges from "kept blocks without a path to end"
 	 * to end */
+	const ir_node *end          = get_irg_end(irg);
+	int const      n_keepalives = get_End_n_keepalives(end);
 	for (unsigned k = n_keepalives; k-- > 0; ) {
 		ir_node *keep = get_End_keepalive(end, k);
 		if (!is_Block(keep) || has_path_to_end(keep))
@@ -556,8 +573,7 @@ void ir_estimate_execfreq(ir_graph *irg)
 
 		if (mat_to_lgs[idx] != -1) {
 			double freq = lgs_x[mat_to_lgs[idx]] * norm;
-			/* Check for inf, nan and negative values. */
-			if (isinf(freq) || !(freq >= 0)) {
+			if (!is_valid_freq(freq)) {
 				valid_freq = false;
 				break;
 			}
@@ -575,8 +591,7 @@ void ir_estimate_execfreq(ir_graph *irg)
 
 			if (mat_to_lgs[idx] == -1) {
 				double freq = mat_dot_vec_entry(in_fac, freqs, idx);
-				/* Check for inf, nan and negative values. */
-				if (isinf(freq) || !(freq >= 0)) {
+				if (!is_valid_freq(freq)) {
 					valid_freq = false;
 					break;
 				}
@@ -586,6 +601,614 @@ void ir_estimate_execfreq(ir_graph *irg)
 	}
 
 	DEL_ARR_F(freqs);
+	DEL_ARR_F(lgs_to_mat);
+	DEL_ARR_F(mat_to_lgs);
+	free(in_fac);
+	free(lgs_matrix);
+	DEL_ARR_F(lgs_x);
+	return valid_freq;
+}
+
+/** An edge of the control flow graph with its probability. */
+typedef struct freq_edge {
+	unsigned other; /**< index of the block at the other end of the edge */
+	double   prob;  /**< probability that the source takes this edge */
+} freq_edge;
+
+/**
+ * The sparse system of equations: The frequency of each block is the sum of
+ * the frequencies of its predecessors weighted by the edge probabilities.
+ * Blocks are indexed in reverse postorder, all arrays are in CSR form.
+ */
+typedef struct freq_system {
+	unsigned   size;
+	unsigned  *in_begin;   /**< in_edges[in_begin[i]..in_begin[i+1]] */
+	freq_edge *in_edges;   /**< incoming edges, other is the source */
+	unsigned  *out_begin;  /**< out_dst[out_begin[i]..out_begin[i+1]] */
+	unsigned  *out_dst;    /**< destinations of outgoing edges */
+	unsigned  *unit_of;    /**< loop nest (unit) each block belongs to */
+	unsigned  *unit_begin; /**< members[unit_begin[u]..unit_begin[u+1]] */
+	unsigned  *members;    /**< blocks of each unit in reverse postorder */
+	unsigned  *local;      /**< index of a block inside its unit */
+	double    *x;          /**< block frequencies */
+	unsigned   start_idx;
+} freq_system;
+
+static unsigned get_block_idx(dfs_t const *const dfs, unsigned const size,
+                              ir_node *const block)
+{
+	return size - dfs_get_post_num(dfs, block) - 1;
+}
+
+static void add_in_edge(freq_edge **const in_edges, unsigned const src,
+                        double const prob)
+{
+	freq_edge const edge = { src, prob };
+	ARR_APP1(freq_edge, *in_edges, edge);
+}
+
+/**
+ * Assembles the sparse system and decomposes it into units: All blocks of an
+ * outermost loop form one unit, each other block is a unit of its own.
+ */
+static unsigned build_freq_system(freq_system *const sys, ir_graph *const irg,
+                                  dfs_t *const dfs,
+                                  double const inv_loop_weight)
+{
+	unsigned const size      = dfs_get_n_nodes(dfs);
+	ir_node *const end_block = get_irg_end_block(irg);
+
+	sys->size      = size;
+	sys->start_idx = get_block_idx(dfs, size, get_irg_start_block(irg));
+	sys->in_begin  = XMALLOCN(unsigned, size + 1);
+	sys->unit_of   = XMALLOCN(unsigned, size);
+
+	freq_edge *in_edges   = NEW_ARR_F(freq_edge, 0);
+	pmap      *loop_units = pmap_create();
+	unsigned   n_units    = 0;
+	for (unsigned idx = 0; idx < size; ++idx) {
+		ir_node *const bb = dfs_get_post_num_node(dfs, size - idx - 1);
+
+		sys->in_begin[idx] = ARR_LEN(in_edges);
+		for (int i = 0, n = get_Block_n_cfgpreds(bb); i < n; ++i) {
+			ir_node *const pred = get_Block_cfgpred_block(bb, i);
+			if (pred == NULL)
+				continue;
+			add_in_edge(&in_edges, get_block_idx(dfs, size, pred),
+			            get_cf_probability(bb, i, inv_loop_weight));
+		}
+
+		/* add artifical edges from "kept blocks without a path to end"
+		 * to end */
+		if (bb == end_block) {
+			ir_node const *const end = get_irg_end(irg);
+			for (int k = 0, n = get_End_n_keepalives(end); k < n; ++k) {
+				ir_node *const keep = get_End_keepalive(end, k);
+				if (!is_Block(keep) || has_path_to_end(keep))
+					continue;
+				double const sum = get_sum_succ_factors(keep, inv_loop_weight);
+				add_in_edge(&in_edges, get_block_idx(dfs, size, keep),
+				            KEEP_FAC / sum);
+			}
+		}
+
+		ir_loop *loop = get_irn_loop(bb);
+		if (loop == NULL || get_loop_depth(loop) == 0) {
+			sys->unit_of[idx] = n_units++;
+			continue;
+		}
+		while (get_loop_depth(loop) > 1)
+			loop = get_loop_outer_loop(loop);
+		void *const unit = pmap_get(void, loop_units, loop);
+		if (unit != NULL) {
+			sys->unit_of[idx] = PTR_TO_INT(unit) - 1;
+		} else {
+			sys->unit_of[idx] = n_units++;
+			pmap_insert(loop_units, loop, INT_TO_PTR(n_units));
+		}
+	}
+	unsigned const n_edges = ARR_LEN(in_edges);
+	sys->in_begin[size] = n_edges;
+	sys->in_edges       = in_edges;
+	pmap_destroy(loop_units);
+
+	/* outgoing edges */
+	unsigned *const out_begin = XMALLOCNZ(unsigned, size + 1);
+	for (unsigned e = 0; e < n_edges; ++e) {
+		++out_begin[in_edges[e].other + 1];
+	}
+	for (unsigned idx = 0; idx < size; ++idx) {
+		out_begin[idx + 1] += out_begin[idx];
+	}
+	unsigned *const out_dst  = XMALLOCN(unsigned, n_edges);
+	unsigned *const out_fill = XMALLOCN(unsigned, size);
+	memcpy(out_fill, out_begin, size * sizeof(*out_fill));
+	for (unsigned idx = 0; idx < size; ++idx) {
+		for (unsigned e = sys->in_begin[idx]; e < sys->in_begin[idx + 1]; ++e) {
+			out_dst[out_fill[in_edges[e].other]++] = idx;
+		}
+	}
+	free(out_fill);
+	sys->out_begin = out_begin;
+	sys->out_dst   = out_dst;
+
+	/* members of the units */
+	unsigned *const unit_begin = XMALLOCNZ(unsigned, n_units + 1);
+	for (unsigned idx = 0; idx < size; ++idx) {
+		++unit_begin[sys->unit_of[idx] + 1];
+	}
+	for (unsigned u = 0; u < n_units; ++u) {
+		unit_begin[u + 1] += unit_begin[u];
+	}
+	unsigned *const members   = XMALLOCN(unsigned, size);
+	unsigned *const unit_fill = XMALLOCN(unsigned, n_units);
+	memcpy(unit_fill, unit_begin, n_units * sizeof(*unit_fill));
+	for (unsigned idx = 0; idx < size; ++idx) {
+		members[unit_fill[sys->unit_of[idx]]++] = idx;
+	}
+	free(unit_fill);
+	sys->unit_begin = unit_begin;
+	sys->members    = members;
+	sys->local      = XMALLOCN(unsigned, size);
+	sys->x          = XMALLOCNZ(double, size);
+	return n_units;
+}
+
+static void free_freq_system(freq_system *const sys)
+{
+	free(sys->in_begin);
+	DEL_ARR_F(sys->in_edges);
+	free(sys->out_begin);
+	free(sys->out_dst);
+	free(sys->unit_of);
+	free(sys->unit_begin);
+	free(sys->members);
+	free(sys->local);
+	free(sys->x);
+}
+
+/**
+ * Returns the inflow into block @p idx from outside of its unit.
+ */
+static double get_external_inflow(freq_system const *const sys,
+                                  unsigned const idx)
+{
+	unsigned const unit = sys->unit_of[idx];
+	double         sum  = idx == sys->start_idx ? 1.0 : 0.0;
+	for (unsigned e = sys->in_begin[idx]; e < sys->in_begin[idx + 1]; ++e) {
+		freq_edge const *const edge = &sys->in_edges[e];
+		if (sys->unit_of[edge->other] != unit)
+			sum += edge->prob * sys->x[edge->other];
+	}
+	return sum;
+}
+
+/** A linear expression c + sum(coef * x_var) over the blocks of a unit. */
+typedef struct freq_expr {
+	double     c;
+	unsigned   n_terms;
+	freq_edge *terms;   /**< other is the local index of the variable */
+} freq_expr;
+
+/**
+ * Environment for the elimination of a loop nest. Blocks entered by a
+ * backedge get a variable, which stays open until the equation of the block
+ * is complete, i.e. its last backedge predecessor has been processed.
+ */
+typedef struct elim_env {
+	freq_system    *sys;
+	unsigned        unit;
+	struct obstack  obst;
+	freq_expr      *exprs;      /**< frequency of each block */
+	freq_expr      *pending;    /**< forward inflow into blocks with variable */
+	freq_expr      *closed;     /**< solution of each closed variable */
+	unsigned       *close_time; /**< 0 while the variable is open */
+	double         *acc;        /**< coefficients of the accumulator */
+	bool           *in_acc;
+	unsigned       *acc_vars;   /**< variables used in the accumulator */
+	double          acc_c;
+} elim_env;
+
+static void acc_add_expr(elim_env *const env, double const fac,
+                         freq_expr const *const expr)
+{
+	env->acc_c += fac * expr->c;
+	for (unsigned i = 0; i < expr->n_terms; ++i) {
+		unsigned const var = expr->terms[i].other;
+		if (!env->in_acc[var]) {
+			env->in_acc[var] = true;
+			ARR_APP1(unsigned, env->acc_vars, var);
+		}
+		env->acc[var] += fac * expr->terms[i].prob;
+	}
+}
+
+static void acc_remove(elim_env *const env, size_t const i)
+{
+	unsigned const var = env->acc_vars[i];
+	env->acc[var]    = 0.0;
+	env->in_acc[var] = false;
+	size_t const last = ARR_LEN(env->acc_vars) - 1;
+	env->acc_vars[i] = env->acc_vars[last];
+	ARR_SHRINKLEN(env->acc_vars, last);
+}
+
+/**
+ * Substitutes the solutions of all closed variables in the accumulator.
+ * Variables are substituted in the order they were closed, as a solution
+ * only refers to variables which were still open at that time.
+ */
+static bool acc_resolve(elim_env *const env)
+{
+	for (;;) {
+		size_t   best      = ARR_LEN(env->acc_vars);
+		unsigned best_time = 0;
+		for (size_t i = 0, n = ARR_LEN(env->acc_vars); i < n; ++i) {
+			unsigned const time = env->close_time[env->acc_vars[i]];
+			if (time != 0 && (best_time == 0 || time < best_time)) {
+				best      = i;
+				best_time = time;
+			}
+		}
+		if (best_time == 0)
+			return ARR_LEN(env->acc_vars) <= ELIM_MAX_TERMS;
+
+		unsigned const var = env->acc_vars[best];
+		double   const fac = env->acc[var];
+		acc_remove(env, best);
+		acc_add_expr(env, fac, &env->closed[var]);
+	}
+}
+
+static freq_expr acc_take(elim_env *const env, double const fac)
+{
+	freq_expr expr = { env->acc_c * fac, 0, NULL };
+	env->acc_c = 0.0;
+
+	size_t const n_vars = ARR_LEN(env->acc_vars);
+	expr.terms = OALLOCN(&env->obst, freq_edge, n_vars);
+	for (size_t i = 0; i < n_vars; ++i) {
+		unsigned const var  = env->acc_vars[i];
+		double   const coef = env->acc[var];
+		if (coef != 0.0) {
+			expr.terms[expr.n_terms].other = var;
+			expr.terms[expr.n_terms].prob  = coef * fac;
+			++expr.n_terms;
+		}
+		env->acc[var]    = 0.0;
+		env->in_acc[var] = false;
+	}
+	ARR_SHRINKLEN(env->acc_vars, 0);
+	return expr;
+}
+
+static double eval_expr(freq_expr const *const expr, double const *const val)
+{
+	double res = expr->c;
+	for (unsigned i = 0; i < expr->n_terms; ++i) {
+		res += expr->terms[i].prob * val[expr->terms[i].other];
+	}
+	return res;
+}
+
+/**
+ * Solves the equations of a loop nest exactly by eliminating the blocks in
+ * reverse postorder. Fails if too many variables are open at the same time.
+ */
+static bool solve_unit_eliminate(freq_system *const sys, unsigned const unit,
+                                 double const *const rhs)
+{
+	unsigned const *const members = &sys->members[sys->unit_begin[unit]];
+	unsigned        const n       = sys->unit_begin[unit + 1] - sys->unit_begin[unit];
+
+	/* last_back[r] is the last backedge predecessor of block r + 1, or 0 if
+	 * there is none; closers[r] lists the blocks completed by block r. */
+	unsigned *const last_back   = XMALLOCNZ(unsigned, n);
+	unsigned *const first_close = XMALLOCN(unsigned, n);
+	unsigned *const next_close  = XMALLOCN(unsigned, n);
+	for (unsigned r = 0; r < n; ++r) {
+		unsigned const idx = members[r];
+		for (unsigned e = sys->in_begin[idx]; e < sys->in_begin[idx + 1]; ++e) {
+			unsigned const src = sys->in_edges[e].other;
+			if (sys->unit_of[src] == unit && sys->local[src] >= r)
+				last_back[r] = MAX(last_back[r], sys->local[src] + 1);
+		}
+		first_close[r] = n;
+	}
+	for (unsigned r = n; r-- > 0; ) {
+		if (last_back[r] == 0)
+			continue;
+		unsigned const closer = last_back[r] - 1;
+		next_close[r]       = first_close[closer];
+		first_close[closer] = r;
+	}
+
+	elim_env env;
+	env.sys        = sys;
+	env.unit       = unit;
+	obstack_init(&env.obst);
+	env.exprs      = XMALLOCNZ(freq_expr, n);
+	env.pending    = XMALLOCNZ(freq_expr, n);
+	env.closed     = XMALLOCNZ(freq_expr, n);
+	env.close_time = XMALLOCNZ(unsigned, n);
+	env.acc        = XMALLOCNZ(double, n);
+	env.in_acc     = XMALLOCNZ(bool, n);
+	env.acc_vars   = NEW_ARR_F(unsigned, 0);
+	env.acc_c      = 0.0;
+
+	unsigned *const close_order = XMALLOCN(unsigned, n);
+	unsigned        n_closed    = 0;
+	bool            solved      = true;
+	for (unsigned r = 0; r < n && solved; ++r) {
+		unsigned const idx = members[r];
+		env.acc_c = rhs[r];
+		for (unsigned e = sys->in_begin[idx]; e < sys->in_begin[idx + 1]; ++e) {
+			freq_edge const *const edge = &sys->in_edges[e];
+			if (sys->unit_of[edge->other] != unit)
+				continue;
+			unsigned const pred = sys->local[edge->other];
+			if (pred < r)
+				acc_add_expr(&env, edge->prob, &env.exprs[pred]);
+		}
+		if (!acc_resolve(&env)) {
+			solved = false;
+			break;
+		}
+
+		if (last_back[r] != 0) {
+			env.pending[r] = acc_take(&env, 1.0);
+			freq_edge *const var = OALLOC(&env.obst, freq_edge);
+			var->other = r;
+			var->prob  = 1.0;
+			env.exprs[r] = (freq_expr){ 0.0, 1, var };
+		} else {
+			env.exprs[r] = acc_take(&env, 1.0);
+		}
+
+		/* complete the equations whose last backedge comes from block r */
+		for (unsigned h = first_close[r]; h != n; h = next_close[h]) {
+			unsigned const head = members[h];
+			acc_add_expr(&env, 1.0, &env.pending[h]);
+			for (unsigned e = sys->in_begin[head]; e < sys->in_begin[head + 1]; ++e) {
+				freq_edge const *const edge = &sys->in_edges[e];
+				if (sys->unit_of[edge->other] != unit)
+					continue;
+				unsigned const pred = sys->local[edge->other];
+				if (pred >= h)
+					acc_add_expr(&env, edge->prob, &env.exprs[pred]);
+			}
+			if (!acc_resolve(&env)) {
+				solved = false;
+				break;
+			}
+
+			/* x_h = c + a * x_h + ...  =>  x_h = (c + ...) / (1 - a) */
+			double cyclic = 0.0;
+			for (size_t i = 0, n_vars = ARR_LEN(env.acc_vars); i < n_vars; ++i) {
+				if (env.acc_vars[i] == h) {
+					cyclic = env.acc[h];
+					acc_remove(&env, i);
+					break;
+				}
+			}
+			if (!(cyclic < 1.0)) {
+				solved = false;
+				break;
+			}
+			env.closed[h]         = acc_take(&env, 1.0 / (1.0 - cyclic));
+			env.close_time[h]     = ++n_closed;
+			close_order[n_closed - 1] = h;
+		}
+	}
+
+	if (solved) {
+		/* a solution only refers to variables closed later */
+		double *const val = XMALLOCNZ(double, n);
+		for (unsigned i = n_closed; i-- > 0; ) {
+			unsigned const h = close_order[i];
+			val[h] = eval_expr(&env.closed[h], val);
+		}
+		for (unsigned r = 0; r < n; ++r) {
+			sys->x[members[r]] = last_back[r] != 0 ? val[r]
+			                                       : eval_expr(&env.exprs[r], val);
+		}
+		free(val);
+	} else {
+		/* reset the accumulator for the next unit */
+		ARR_SHRINKLEN(env.acc_vars, 0);
+	}
+
+	free(close_order);
+	DEL_ARR_F(env.acc_vars);
+	free(env.in_acc);
+	free(env.acc);
+	free(env.close_time);
+	free(env.closed);
+	free(env.pending);
+	free(env.exprs);
+	obstack_free(&env.obst, NULL);
+	free(next_close);
+	free(first_close);
+	free(last_back);
+	return solved;
+}
+
+/**
+ * Solves the equations of a loop nest with Gauss-Seidel iteration.
+ */
+static bool solve_unit_iterative(freq_system *const sys, unsigned const unit,
+                                 double const *const rhs)
+{
+	unsigned const *const members = &sys->members[sys->unit_begin[unit]];
+	unsigned        const n       = sys->unit_begin[unit + 1] - sys->unit_begin[unit];
+	double         *const x       = sys->x;
+
+	for (unsigned r = 0; r < n; ++r) {
+		x[members[r]] = rhs[r];
+	}
+	for (unsigned sweep = 0; sweep < GS_MAX_SWEEPS; ++sweep) {
+		double max_diff = 0.0;
+		double max_freq = 0.0;
+		for (unsigned r = 0; r < n; ++r) {
+			unsigned const idx  = members[r];
+			double         freq = rhs[r];
+			for (unsigned e = sys->in_begin[idx]; e < sys->in_begin[idx + 1]; ++e) {
+				freq_edge const *const edge = &sys->in_edges[e];
+				if (sys->unit_of[edge->other] == unit)
+					freq += edge->prob * x[edge->other];
+			}
+			max_diff = MAX(max_diff, fabs(freq - x[idx]));
+			max_freq = MAX(max_freq, freq);
+			x[idx]   = freq;
+		}
+		if (!is_valid_freq(max_freq))
+			return false;
+		if (max_diff <= GS_EPSILON * max_freq)
+			return true;
+	}
+	return false;
+}
+
+static bool solve_unit(freq_system *const sys, unsigned const unit)
+{
+	unsigned const *const members = &sys->members[sys->unit_begin[unit]];
+	unsigned        const n       = sys->unit_begin[unit + 1] - sys->unit_begin[unit];
+
+	double *const rhs = XMALLOCN(double, n);
+	for (unsigned r = 0; r < n; ++r) {
+		sys->local[members[r]] = r;
+		rhs[r] = get_external_inflow(sys, members[r]);
+	}
+
+	bool solved = solve_unit_eliminate(sys, unit, rhs);
+	if (!solved)
+		solved = solve_unit_iterative(sys, unit, rhs);
+	free(rhs);
+	return solved;
+}
+
+/**
+ * Solves the sparse system unit by unit in topological order of the
+ * condensed control flow graph. The start block is fixed to frequency 1.
+ */
+static bool solve_sparse(ir_graph *const irg, dfs_t *const dfs,
+                         double const inv_loop_weight)
+{
+	freq_system    sys;
+	unsigned const n_units = build_freq_system(&sys, irg, dfs, inv_loop_weight);
+	unsigned const size    = sys.size;
+
+	/* count edges entering each unit from other units */
+	unsigned *const n_unit_preds = XMALLOCNZ(unsigned, n_units);
+	for (unsigned idx = 0; idx < size; ++idx) {
+		unsigned const unit = sys.unit_of[idx];
+		for (unsigned e = sys.in_begin[idx]; e < sys.in_begin[idx + 1]; ++e) {
+			if (sys.unit_of[sys.in_edges[e].other] != unit)
+				++n_unit_preds[unit];
+		}
+	}
+
+	unsigned *const ready   = XMALLOCN(unsigned, n_units);
+	unsigned        n_ready = 0;
+	for (unsigned u = 0; u < n_units; ++u) {
+		if (n_unit_preds[u] == 0)
+			ready[n_ready++] = u;
+	}
+
+	bool     valid_freq = true;
+	unsigned n_solved   = 0;
+	while (n_solved < n_ready) {
+		unsigned const unit = ready[n_solved++];
+		if (!solve_unit(&sys, unit)) {
+			valid_freq = false;
+			break;
+		}
+
+		for (unsigned m = sys.unit_begin[unit]; m < sys.unit_begin[unit + 1]; ++m) {
+			unsigned const idx = sys.members[m];
+			for (unsigned e = sys.out_begin[idx]; e < sys.out_begin[idx + 1]; ++e) {
+				unsigned const dst_unit = sys.unit_of[sys.out_dst[e]];
+				if (dst_unit != unit && --n_unit_preds[dst_unit] == 0)
+					ready[n_ready++] = dst_unit;
+			}
+		}
+	}
+	/* units left over would mean that the loop nests were no strongly
+	 * connected components */
+	if (n_solved < n_units)
+		valid_freq = false;
+
+	if (valid_freq) {
+		/* normalize to an execution frequency of 1 for the end block */
+		ir_node *const end_block = get_irg_end_block(irg);
+		double   const end_freq  = sys.x[get_block_idx(dfs, size, end_block)];
+		double   const norm      = end_freq != 0.0 ? 1.0 / end_freq : 1.0;
+		for (unsigned idx = 0; idx < size; ++idx) {
+			double const freq = sys.x[idx] * norm;
+			if (!is_valid_freq(freq)) {
+				valid_freq = false;
+				break;
+			}
+			set_block_execfreq(dfs_get_post_num_node(dfs, size - idx - 1), freq);
+		}
+	}
+
+	free(ready);
+	free(n_unit_preds);
+	free_freq_system(&sys);
+	return valid_freq;
+}
+
+void ir_set_execfreq_solver(execfreq_solver_t const new_solver)
+{
+	solver = new_solver;
+}
+
+void ir_estimate_execfreq(ir_graph *irg)
+{
+	double loop_weight = 10.0;
+
+	assure_irg_properties(irg,
+		IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+		| IR_GRAPH_PROPERTY_NO_BADS
+		| IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
+		| IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE);
+
+	/* compute a DFS.
+	 * using a toposort on the CFG (without back edges) will propagate
+	 * the values better for the gauss/seidel iteration.
+	 * => they can "flow" from start to end. */
+	dfs_t *const dfs = dfs_new(irg);
+
+	unsigned       size      = dfs_get_n_nodes(dfs);
+	ir_node *const end_block = get_irg_end_block(irg);
+
+	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED
+	                          | IR_RESOURCE_IRN_VISITED
+	                          | IR_RESOURCE_IRN_LINK);
+	inc_irg_block_visited(irg);
+
+	/* mark all blocks reachable from end_block as (block)visited
+	 * (so we can detect places like endless-loops/noreturn calls which
+	 *  do not reach the End block) */
+	block_walk_no_keeps(end_block);
+	/* mark all kept blocks as (node)visited */
+	inc_irg_visited(irg);
+	const ir_node *end          = get_irg_end(irg);
+	int const      n_keepalives = get_End_n_keepalives(end);
+	for (int k = n_keepalives - 1; k >= 0; --k) {
+		ir_node *keep = get_End_keepalive(end, k);
+		if (is_Block(keep)) {
+			mark_irn_visited(keep);
+		}
+	}
+
+	double const inv_loop_weight = 1.0 / loop_weight;
+	bool const   use_dense       = solver == EXECFREQ_SOLVER_AUTO
+		? size < SPARSE_MIN_BLOCKS : solver == EXECFREQ_SOLVER_DENSE;
+	bool         valid_freq      = use_dense
+		? solve_dense(irg, dfs, inv_loop_weight)
+		: solve_sparse(irg, dfs, inv_loop_weight);
 
 	/* Fallback solution: Use loop weight. */
 	if (!valid_freq) {
@@ -601,8 +1224,7 @@ void ir_estimate_execfreq(ir_graph *irg)
 				freq *= loop_weight;
 			}
 
-			/* Check for inf, nan and negative values. */
-			if (isinf(freq) || !(freq >= 0)) {
+			if (!is_valid_freq(freq)) {
 				valid_freq = false;
 				break;
 			}
@@ -623,9 +1245,4 @@ void ir_estimate_execfreq(ir_graph *irg)
 	                       | IR_RESOURCE_IRN_LINK);
 
 	dfs_free(dfs);
-	DEL_ARR_F(lgs_to_mat);
-	DEL_ARR_F(mat_to_lgs);
-	free(in_fac);
-	free(lgs_matrix);
-	DEL_ARR_F(lgs_x);
 }
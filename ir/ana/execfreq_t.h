@@ -20,6 +20,27 @@ void exit_execfreq(void);
 
 void set_block_execfreq(ir_node *block, double freq);
 
+/**
+ * Sets the probability that control flow leaving predecessor @p pos of
+ * @p block takes the edge to @p block, for example from profile data. A
+ * negative probability marks the edge as unknown. Known probabilities are
+ * used by ir_estimate_execfreq() instead of the static estimate.
+ */
+void set_block_cf_probability(ir_node *block, int pos, double probability);
+
+/** The solvers for the execution frequency equations. */
+typedef enum execfreq_solver_t {
+	EXECFREQ_SOLVER_AUTO,   /**< dense for small graphs, sparse otherwise */
+	EXECFREQ_SOLVER_DENSE,  /**< QR decomposition of the dense matrix */
+	EXECFREQ_SOLVER_SPARSE, /**< elimination along the loop nests */
+} execfreq_solver_t;
+
+/**
+ * Selects the solver used by ir_estimate_execfreq(). Only meant for comparing
+ * the solvers, the default picks the faster one.
+ */
+void ir_set_execfreq_solver(execfreq_solver_t solver);
+
 typedef struct ir_execfreq_int_factors {
 	double min_non_zero;
 	double m;
@@ -10,6 +10,7 @@
  * @date     6.2005
  */
 #include "irconsconfirm.h"
+#include "timing_t.h"
 
 #include "irgraph_t.h"
 #include "irnode_t.h"
@@ -518,6 +519,8 @@ static void insert_Confirm(ir_node *node, void *data)
 
 void construct_confirms(ir_graph *irg)
 {
+	IR_PASS_TIMING("construct_confirms", irg);
+
 	FIRM_DBG_REGISTER(dbg, "firm.ana.confirm");
 
 	assure_irg_properties(irg,
@@ -562,6 +565,7 @@ static void remove_confirm(ir_node *n, void *env)
 
 void remove_confirms(ir_graph *irg)
 {
+	IR_PASS_TIMING("remove_confirms", irg);
 	irg_walk_graph(irg, NULL, remove_confirm, NULL);
 	confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_CONTROL_FLOW);
 }
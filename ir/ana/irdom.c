@@ -22,6 +22,8 @@
 #include "ircons_t.h"
 #include "array.h"
 #include "iredges.h"
+#include "irhooks.h"
+#include "pqueue.h"
 
 static inline ir_dom_info *get_dom_info(ir_node *block)
 {
@@ -135,13 +137,27 @@ void set_Block_postdom_depth(ir_node *block, int depth)
 	get_pdom_info(block)->dom_depth = depth;
 }
 
+static void assign_dom_tree_pre_orders(ir_graph *irg);
+
+/**
+ * Renumbers the dominator tree if an incremental update changed it since the
+ * last numbering.
+ */
+static inline void assure_dom_tree_pre_orders(ir_graph *irg)
+{
+	if (irg->dom_tree_nums_outdated)
+		assign_dom_tree_pre_orders(irg);
+}
+
 unsigned get_Block_dom_tree_pre_num(const ir_node *block)
 {
+	assure_dom_tree_pre_orders(get_irn_irg(block));
 	return get_dom_info_const(block)->tree_pre_num;
 }
 
 unsigned get_Block_dom_max_subtree_pre_num(const ir_node *block)
 {
+	assure_dom_tree_pre_orders(get_irn_irg(block));
 	return get_dom_info_const(block)->max_subtree_pre_num;
 }
 
@@ -157,6 +173,7 @@ unsigned get_Block_pdom_max_subtree_pre_num(const ir_node *block)
 
 int block_dominates(const ir_node *a, const ir_node *b)
 {
+	assure_dom_tree_pre_orders(get_irn_irg(a));
 	const ir_dom_info *ai = get_dom_info_const(a);
 	const ir_dom_info *bi = get_dom_info_const(b);
 	return bi->tree_pre_num - ai->tree_pre_num
@@ -483,33 +500,14 @@ static void count_and_init_blocks_dom(ir_node *block, void *env)
 	set_Block_dom_depth(block, -1);
 }
 
-void compute_doms(ir_graph *irg)
+/**
+ * Computes the immediate dominators of the blocks in @p tdi_list with the
+ * Lengauer-Tarjan algorithm. The blocks are numbered in depth first order
+ * starting with the root, whose dominator depth must be set, and are marked
+ * block visited. Predecessors which are not marked are ignored.
+ */
+static void compute_idoms(ir_graph *irg, tmp_dom_info *tdi_list, int n_blocks)
 {
-	assert(!irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_CONSTRUCTION));
-
-	/* We need the out data structure. */
-	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS
-	                         | IR_GRAPH_PROPERTY_NO_TUPLES);
-
-	/* Count the number of blocks in the graph. */
-	int n_blocks = 0;
-	irg_block_walk_graph(irg, count_and_init_blocks_dom, NULL, &n_blocks);
-
-	/* Memory for temporary information. */
-	tmp_dom_info *tdi_list = XMALLOCN(tmp_dom_info, n_blocks);
-
-	/* this with a standard walker as passing the parent to the sons isn't
-	   simple. */
-	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
-	inc_irg_block_visited(irg);
-	int used = 0;
-	init_tmp_dom_info(get_irg_start_block(irg), NULL, tdi_list, &used, n_blocks);
-	ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
-	/* If not all blocks are reachable from Start by out edges this assertion
-	   fails. */
-	assert(used <= n_blocks);
-	n_blocks = used;
-
 	for (int i = n_blocks; i-- > 1; ) {  /* Don't iterate the root, it's done. */
 		tmp_dom_info  *w     = &tdi_list[i];
 		const ir_node *block = w->block;
@@ -519,7 +517,7 @@ void compute_doms(ir_graph *irg)
 			const ir_node *pred       = get_Block_cfgpred(block, j);
 			const ir_node *pred_block = get_nodes_block(pred);
 
-			if (is_Bad(pred) || get_Block_dom_pre_num(pred_block) == -1)
+			if (is_Bad(pred) || !Block_block_visited(pred_block))
 				continue;    /* unreachable */
 
 			const tmp_dom_info *u = dom_eval(&tdi_list[get_Block_dom_pre_num(pred_block)]);
@@ -530,7 +528,7 @@ void compute_doms(ir_graph *irg)
 		/* handle keep-alives if we are at the end block */
 		if (block == get_irg_end_block(irg)) {
 			foreach_irn_in(get_irg_end(irg), j, pred) {
-				if (!is_Block(pred) || get_Block_dom_pre_num(pred) == -1)
+				if (!is_Block(pred) || !Block_block_visited(pred))
 					continue;   /* unreachable */
 
 				const tmp_dom_info *u = dom_eval(&tdi_list[get_Block_dom_pre_num(pred)]);
@@ -562,8 +560,6 @@ void compute_doms(ir_graph *irg)
 	}
 	/* Step 4 */
 	tdi_list[0].dom = NULL;
-	set_Block_idom(tdi_list[0].block, NULL);
-	set_Block_dom_depth(tdi_list[0].block, 1);
 	for (int i = 1; i < n_blocks; i++) {
 		tmp_dom_info *w = &tdi_list[i];
 		if (w->dom == NULL)
@@ -579,14 +575,67 @@ void compute_doms(ir_graph *irg)
 			++depth;
 		set_Block_dom_depth(w->block, depth);
 	}
+}
 
-	/* clean up */
-	free(tdi_list);
+static void set_dom_unreachable(ir_node *block)
+{
+	memset(get_dom_info(block), 0, sizeof(ir_dom_info));
+	set_Block_dom_pre_num(block, -1);
+	set_Block_dom_depth(block, -1);
+}
 
-	/* Do a walk over the tree and assign the tree pre orders. */
+/**
+ * Number of blocks visited by the incremental updates and the renumberings
+ * since the tracking started or recomputed the dominance information.
+ */
+static size_t dom_update_work;
+
+/** Assigns the tree pre orders used by block_dominates(). */
+static void assign_dom_tree_pre_orders(ir_graph *irg)
+{
 	unsigned tree_pre_order = 0;
 	dom_tree_walk(get_irg_start_block(irg), assign_tree_dom_pre_order,
 	              assign_tree_dom_pre_order_max, &tree_pre_order);
+	irg->dom_tree_nums_outdated = false;
+	dom_update_work += tree_pre_order;
+}
+
+void compute_doms(ir_graph *irg)
+{
+	assert(!irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_CONSTRUCTION));
+
+	/* We need the out data structure. */
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS
+	                         | IR_GRAPH_PROPERTY_NO_TUPLES);
+
+	/* Count the number of blocks in the graph. */
+	int n_blocks = 0;
+	irg_block_walk_graph(irg, count_and_init_blocks_dom, NULL, &n_blocks);
+
+	/* Memory for temporary information. */
+	tmp_dom_info *tdi_list = XMALLOCN(tmp_dom_info, n_blocks);
+
+	/* this with a standard walker as passing the parent to the sons isn't
+	   simple. */
+	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	inc_irg_block_visited(irg);
+	int used = 0;
+	init_tmp_dom_info(get_irg_start_block(irg), NULL, tdi_list, &used, n_blocks);
+	/* If not all blocks are reachable from Start by out edges this assertion
+	   fails. */
+	assert(used <= n_blocks);
+	n_blocks = used;
+
+	set_Block_idom(tdi_list[0].block, NULL);
+	set_Block_dom_depth(tdi_list[0].block, 1);
+	compute_idoms(irg, tdi_list, n_blocks);
+	ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+
+	/* clean up */
+	free(tdi_list);
+
+	/* Do a walk over the tree and assign the tree pre orders. */
+	assign_dom_tree_pre_orders(irg);
 
 	add_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 }
@@ -694,3 +743,817 @@ void compute_postdoms(ir_graph *irg)
 
 	add_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_POSTDOMINANCE);
 }
+
+/*
+ * Incremental updates of the dominator tree.
+ *
+ * Inserting an edge (from, to) uses the depth based search of dynamic
+ * dominator algorithms: With nca being the deepest common dominator of from
+ * and to, a block v becomes immediately dominated by nca iff
+ * depth(v) > depth(nca) + 1 and v is reachable from to on a path whose blocks
+ * are not shallower than v. If to was unreachable before, the dominators of
+ * the newly reachable blocks are computed first and their edges to the old
+ * blocks are inserted afterwards.
+ *
+ * Deleting an edge only changes the dominators inside the dominator subtree
+ * of idom(to), or of a block above if to becomes unreachable. As no control
+ * flow edge enters a dominator subtree except at its root, the subtree is
+ * rebuilt with the Lengauer-Tarjan algorithm restricted to its blocks.
+ *
+ * The End block is left out as the blocks kept alive are predecessors of it,
+ * too. It never dominates another block, so its immediate dominator is the
+ * deepest common dominator of its reachable predecessors.
+ *
+ * The updates only use the dominator depths, the tree pre orders are
+ * renumbered on the next query.
+ */
+
+/**
+ * Returns the deepest common dominator of two reachable blocks, using only
+ * the dominator depths.
+ */
+static ir_node *dom_nca(ir_node *a, ir_node *b)
+{
+	int depth_a = get_Block_dom_depth(a);
+	int depth_b = get_Block_dom_depth(b);
+	for (; depth_a > depth_b; --depth_a)
+		a = get_dom_info(a)->idom;
+	for (; depth_b > depth_a; --depth_b)
+		b = get_dom_info(b)->idom;
+	while (a != b) {
+		a = get_dom_info(a)->idom;
+		b = get_dom_info(b)->idom;
+	}
+	return a;
+}
+
+/**
+ * Returns true if the reachable block @p a dominates the reachable block
+ * @p b, using only the dominator depths.
+ */
+static bool dom_dominates(const ir_node *a, ir_node *b)
+{
+	int const depth_a = get_Block_dom_depth(a);
+	for (int depth = get_Block_dom_depth(b); depth > depth_a; --depth)
+		b = get_dom_info(b)->idom;
+	return a == b;
+}
+
+/** Removes @p block from the blocks dominated by its immediate dominator. */
+static void unlink_dom_child(ir_node *block)
+{
+	ir_dom_info *info = get_dom_info(block);
+	ir_node    **link = &get_dom_info(info->idom)->first;
+	while (*link != block)
+		link = &get_dom_info(*link)->next;
+	*link      = info->next;
+	info->idom = NULL;
+	info->next = NULL;
+}
+
+/** Collects the blocks strictly dominated by @p root. */
+static ir_node **collect_dom_subtree(ir_node *root)
+{
+	ir_node **blocks = NEW_ARR_F(ir_node*, 0);
+	dominates_for_each(root, child) {
+		ARR_APP1(ir_node*, blocks, child);
+	}
+	for (size_t i = 0; i < ARR_LEN(blocks); ++i) {
+		ir_node *block = blocks[i];
+		dominates_for_each(block, child) {
+			ARR_APP1(ir_node*, blocks, child);
+		}
+	}
+	dom_update_work += ARR_LEN(blocks);
+	return blocks;
+}
+
+/**
+ * Sets the dominator depth of @p block to @p depth and updates the depths of
+ * the blocks it dominates.
+ */
+static void set_dom_subtree_depth(ir_node *block, int depth)
+{
+	set_Block_dom_depth(block, depth);
+	ir_node **blocks = collect_dom_subtree(block);
+	for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i) {
+		ir_node *sub = blocks[i];
+		set_Block_dom_depth(sub, get_Block_dom_depth(get_Block_idom(sub)) + 1);
+	}
+	DEL_ARR_F(blocks);
+}
+
+/** Blocks made unreachable by the updates, collected while tracking. */
+static ir_node **removed_blocks;
+/** Blocks whose predecessors or dominators changed, collected while
+ * tracking. */
+static ir_node **changed_blocks;
+
+/** Notes that the predecessors or the dominator of @p block changed. */
+static void note_dom_changed(ir_node *block)
+{
+	if (changed_blocks != NULL)
+		ARR_APP1(ir_node*, changed_blocks, block);
+}
+
+/** Makes @p block unreachable. */
+static void remove_dom_block(ir_node *block)
+{
+	if (removed_blocks != NULL && get_Block_dom_depth(block) > 0)
+		ARR_APP1(ir_node*, removed_blocks, block);
+	set_dom_unreachable(block);
+}
+
+/** Makes @p block and all blocks dominated by it unreachable. */
+static void set_dom_subtree_unreachable(ir_node *block)
+{
+	ir_node **blocks = collect_dom_subtree(block);
+	unlink_dom_child(block);
+	remove_dom_block(block);
+	for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i)
+		remove_dom_block(blocks[i]);
+	DEL_ARR_F(blocks);
+}
+
+/** Notes that the dominator tree of @p irg was changed by an update. */
+static void dom_tree_changed(ir_graph *irg)
+{
+	irg->dom_tree_nums_outdated = true;
+	if (irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE_FRONTIERS))
+		ir_free_dominance_frontiers(irg);
+}
+
+/** The blocks whose dominators are recomputed. */
+typedef struct dom_region_t {
+	tmp_dom_info *tdi_list;
+	int           n_blocks;
+	ir_visited_t  candidate; /**< block visited mark of the region blocks */
+	ir_node      *end_block;
+} dom_region_t;
+
+/**
+ * Numbers the blocks of a region reachable from @p block in depth first order
+ * along the out edges.
+ */
+static void init_tmp_dom_info_region(ir_node *block, tmp_dom_info *parent,
+                                     dom_region_t *region)
+{
+	mark_Block_block_visited(block);
+	set_Block_dom_pre_num(block, region->n_blocks);
+
+	tmp_dom_info *tdi = &region->tdi_list[region->n_blocks++];
+	tdi->block       = block;
+	tdi->semi        = tdi;
+	tdi->parent      = parent;
+	tdi->label       = tdi;
+	tdi->ancestor    = NULL;
+	tdi->dom         = NULL;
+	tdi->bucket      = NULL;
+	tdi->unreachable = 0;
+
+	foreach_block_succ(block, edge) {
+		ir_node *succ = get_edge_src_irn(edge);
+		if (succ != region->end_block
+		    && get_Block_block_visited(succ) == region->candidate)
+			init_tmp_dom_info_region(succ, tdi, region);
+	}
+}
+
+/**
+ * Recomputes the dominators of @p blocks below @p root. The blocks must
+ * contain all blocks dominated by @p root and be marked block visited. Blocks
+ * which are not reachable from @p root anymore become unreachable.
+ */
+static void recompute_dom_region(ir_node *root, ir_node **blocks)
+{
+	ir_graph    *irg      = get_irn_irg(root);
+	size_t const n_blocks = ARR_LEN(blocks);
+	dom_region_t region   = {
+		.tdi_list  = XMALLOCN(tmp_dom_info, n_blocks + 1),
+		.n_blocks  = 0,
+		.candidate = get_irg_block_visited(irg),
+		.end_block = get_irg_end_block(irg),
+	};
+
+	get_dom_info(root)->first = NULL;
+	for (size_t i = 0; i < n_blocks; ++i)
+		get_dom_info(blocks[i])->first = NULL;
+
+	inc_irg_block_visited(irg);
+	init_tmp_dom_info_region(root, NULL, &region);
+	dom_update_work += region.n_blocks;
+
+	/* only the blocks whose immediate dominator changes are reported */
+	ir_node **idoms = XMALLOCN(ir_node*, region.n_blocks);
+	for (int i = 0; i < region.n_blocks; ++i)
+		idoms[i] = get_dom_info(region.tdi_list[i].block)->idom;
+	compute_idoms(irg, region.tdi_list, region.n_blocks);
+	for (int i = 1; i < region.n_blocks; ++i) {
+		ir_node *block = region.tdi_list[i].block;
+		if (get_dom_info(block)->idom != idoms[i])
+			note_dom_changed(block);
+	}
+	free(idoms);
+	free(region.tdi_list);
+
+	for (size_t i = 0; i < n_blocks; ++i) {
+		if (!Block_block_visited(blocks[i]))
+			remove_dom_block(blocks[i]);
+	}
+}
+
+/** Rebuilds the dominator subtree of @p root. */
+static void rebuild_dom_subtree(ir_node *root)
+{
+	ir_graph *irg = get_irn_irg(root);
+	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	inc_irg_block_visited(irg);
+	ir_node **blocks = collect_dom_subtree(root);
+	for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i)
+		mark_Block_block_visited(blocks[i]);
+	recompute_dom_region(root, blocks);
+	ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	DEL_ARR_F(blocks);
+}
+
+/**
+ * Returns the deepest common dominator of @p idom and the reachable block
+ * @p block. All blocks marked block visited must be dominated by @p idom, the
+ * blocks walked are marked, so the dominators of many blocks are found in
+ * linear time.
+ */
+static ir_node *dom_nca_marked(ir_node *idom, ir_node *block)
+{
+	if (idom == NULL) {
+		mark_Block_block_visited(block);
+		return block;
+	}
+	int const idom_depth = get_Block_dom_depth(idom);
+	int       depth      = get_Block_dom_depth(block);
+	for (; depth > idom_depth; --depth) {
+		if (Block_block_visited(block))
+			return idom;
+		mark_Block_block_visited(block);
+		block = get_dom_info(block)->idom;
+	}
+	if (Block_block_visited(block))
+		return idom;
+
+	for (int d = idom_depth; d > depth; --d) {
+		idom = get_dom_info(idom)->idom;
+		mark_Block_block_visited(idom);
+	}
+	while (block != idom) {
+		mark_Block_block_visited(block);
+		block = get_dom_info(block)->idom;
+		idom  = get_dom_info(idom)->idom;
+		mark_Block_block_visited(idom);
+	}
+	return idom;
+}
+
+/**
+ * Recomputes the immediate dominator of the End block from its reachable
+ * predecessors and the blocks kept alive.
+ */
+static void update_end_block_idom(ir_graph *irg)
+{
+	ir_node *end_block = get_irg_end_block(irg);
+	ir_node *idom      = NULL;
+	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	inc_irg_block_visited(irg);
+	for (int i = get_Block_n_cfgpreds(end_block); i-- > 0; ) {
+		ir_node *pred = get_Block_cfgpred_block(end_block, i);
+		if (pred == NULL || is_Bad(pred) || get_Block_dom_depth(pred) <= 0)
+			continue;
+		idom = dom_nca_marked(idom, pred);
+	}
+	foreach_irn_in(get_irg_end(irg), i, kept) {
+		if (!is_Block(kept) || kept == end_block
+		    || get_Block_dom_depth(kept) <= 0)
+			continue;
+		idom = dom_nca_marked(idom, kept);
+	}
+	ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+
+	ir_dom_info *info = get_dom_info(end_block);
+	if (idom == info->idom)
+		return;
+	if (info->idom != NULL)
+		unlink_dom_child(end_block);
+	if (idom == NULL) {
+		remove_dom_block(end_block);
+	} else {
+		set_Block_idom(end_block, idom);
+		set_Block_dom_depth(end_block, get_Block_dom_depth(idom) + 1);
+	}
+}
+
+/** Inserts the edge from @p from to @p to, both blocks are reachable. */
+static void insert_reachable_edge(ir_node *from, ir_node *to)
+{
+	ir_node  *nca       = dom_nca(from, to);
+	int const nca_depth = get_Block_dom_depth(nca);
+	if (get_Block_dom_depth(to) <= nca_depth + 1)
+		return;
+
+	ir_graph  *irg       = get_irn_irg(to);
+	ir_node   *end_block = get_irg_end_block(irg);
+	pqueue_t  *bucket    = new_pqueue();
+	ir_node  **affected  = NEW_ARR_F(ir_node*, 0);
+	ir_node  **deeper    = NEW_ARR_F(ir_node*, 0);
+
+	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	inc_irg_block_visited(irg);
+	mark_Block_block_visited(to);
+	pqueue_put(bucket, to, get_Block_dom_depth(to));
+	while (!pqueue_empty(bucket)) {
+		ir_node  *block = (ir_node*)pqueue_pop_front(bucket);
+		int const depth = get_Block_dom_depth(block);
+		ARR_APP1(ir_node*, affected, block);
+
+		/* Blocks deeper than the affected block are not affected themselves
+		 * but paths through them may lead to further affected blocks. */
+		for (;;) {
+			foreach_block_succ(block, edge) {
+				ir_node  *succ       = get_edge_src_irn(edge);
+				int const succ_depth = get_Block_dom_depth(succ);
+				if (succ == end_block || succ_depth <= nca_depth + 1
+				    || Block_block_visited(succ))
+					continue;
+				mark_Block_block_visited(succ);
+				if (succ_depth > depth)
+					ARR_APP1(ir_node*, deeper, succ);
+				else
+					pqueue_put(bucket, succ, succ_depth);
+			}
+			size_t const n_deeper = ARR_LEN(deeper);
+			if (n_deeper == 0)
+				break;
+			block = deeper[n_deeper - 1];
+			ARR_SHRINKLEN(deeper, n_deeper - 1);
+		}
+	}
+	ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	del_pqueue(bucket);
+	DEL_ARR_F(deeper);
+
+	size_t const n_affected = ARR_LEN(affected);
+	for (size_t i = 0; i < n_affected; ++i) {
+		unlink_dom_child(affected[i]);
+		set_Block_idom(affected[i], nca);
+		note_dom_changed(affected[i]);
+	}
+	for (size_t i = 0; i < n_affected; ++i)
+		set_dom_subtree_depth(affected[i], nca_depth + 1);
+	DEL_ARR_F(affected);
+}
+
+/**
+ * Inserts the edge from the reachable block @p from to the unreachable block
+ * @p to.
+ */
+static void insert_unreachable_edge(ir_node *from, ir_node *to)
+{
+	ir_graph *irg       = get_irn_irg(to);
+	ir_node  *end_block = get_irg_end_block(irg);
+
+	/* collect the blocks becoming reachable and the edges from them to the
+	 * blocks reachable before */
+	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	inc_irg_block_visited(irg);
+	ir_node **blocks = NEW_ARR_F(ir_node*, 0);
+	ir_node **exits  = NEW_ARR_F(ir_node*, 0);
+	mark_Block_block_visited(to);
+	ARR_APP1(ir_node*, blocks, to);
+	for (size_t i = 0; i < ARR_LEN(blocks); ++i) {
+		ir_node *block = blocks[i];
+		foreach_block_succ(block, edge) {
+			ir_node *succ = get_edge_src_irn(edge);
+			if (succ == end_block || Block_block_visited(succ))
+				continue;
+			if (get_Block_dom_depth(succ) < 0) {
+				mark_Block_block_visited(succ);
+				ARR_APP1(ir_node*, blocks, succ);
+			} else {
+				ARR_APP1(ir_node*, exits, block);
+				ARR_APP1(ir_node*, exits, succ);
+			}
+		}
+	}
+
+	set_Block_idom(to, from);
+	set_Block_dom_depth(to, get_Block_dom_depth(from) + 1);
+	note_dom_changed(to);
+	recompute_dom_region(to, blocks);
+	ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	DEL_ARR_F(blocks);
+
+	for (size_t i = 0, n = ARR_LEN(exits); i < n; i += 2)
+		insert_reachable_edge(exits[i], exits[i + 1]);
+	DEL_ARR_F(exits);
+}
+
+/**
+ * Checks whether the dominance information of @p irg can be updated after a
+ * change of the edge from @p from to @p to. The information is invalidated if
+ * it cannot.
+ */
+static bool can_update_doms(ir_graph *irg, const ir_node *from,
+                            const ir_node *to)
+{
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return false;
+	/* blocks created after the dominance computation have depth 0 */
+	if (!edges_activated(irg) || get_Block_dom_depth(from) == 0
+	    || get_Block_dom_depth(to) == 0) {
+		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+		return false;
+	}
+	return true;
+}
+
+void dom_insert_edge(ir_node *from, ir_node *to)
+{
+	ir_graph *irg = get_irn_irg(to);
+	if (!can_update_doms(irg, from, to) || get_Block_dom_depth(from) < 0)
+		return;
+
+	if (to != get_irg_end_block(irg)) {
+		if (get_Block_dom_depth(to) < 0)
+			insert_unreachable_edge(from, to);
+		else
+			insert_reachable_edge(from, to);
+	}
+	update_end_block_idom(irg);
+	dom_tree_changed(irg);
+}
+
+void dom_delete_edge(ir_node *from, ir_node *to)
+{
+	ir_graph *irg = get_irn_irg(to);
+	if (!can_update_doms(irg, from, to) || get_Block_dom_depth(from) < 0
+	    || get_Block_dom_depth(to) < 0)
+		return;
+
+	if (to == get_irg_end_block(irg)) {
+		update_end_block_idom(irg);
+		dom_tree_changed(irg);
+		return;
+	}
+
+	/* nothing changes if another edge from the same block remains or the
+	 * edge leads back to a dominator */
+	bool has_support = false;
+	for (int i = get_Block_n_cfgpreds(to); i-- > 0; ) {
+		ir_node *pred = get_Block_cfgpred_block(to, i);
+		if (pred == from)
+			return;
+		if (pred != NULL && !is_Bad(pred) && get_Block_dom_depth(pred) > 0
+		    && !dom_dominates(to, pred))
+			has_support = true;
+	}
+	if (dom_dominates(to, from))
+		return;
+
+	if (has_support) {
+		rebuild_dom_subtree(get_Block_idom(to));
+	} else {
+		/* to becomes unreachable with all blocks it dominates. Blocks
+		 * entered from them may change their dominators up to the deepest
+		 * common dominator with to. */
+		ir_node  *root   = to;
+		ir_node **blocks = collect_dom_subtree(to);
+		ARR_APP1(ir_node*, blocks, to);
+		ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+		inc_irg_block_visited(irg);
+		for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i)
+			mark_Block_block_visited(blocks[i]);
+		for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i) {
+			foreach_block_succ(blocks[i], edge) {
+				ir_node *succ = get_edge_src_irn(edge);
+				if (get_Block_dom_depth(succ) <= 0 || Block_block_visited(succ))
+					continue;
+				ir_node *nca = dom_nca(succ, root);
+				if (nca != succ)
+					root = nca;
+			}
+		}
+		ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+		DEL_ARR_F(blocks);
+		if (root == to)
+			set_dom_subtree_unreachable(to);
+		else
+			rebuild_dom_subtree(root);
+	}
+	update_end_block_idom(irg);
+	dom_tree_changed(irg);
+}
+
+void dom_split_block(ir_node *upper, ir_node *lower)
+{
+	ir_graph *irg = get_irn_irg(lower);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return;
+
+	int const depth = get_Block_dom_depth(lower);
+	if (depth < 0) {
+		set_dom_unreachable(upper);
+		return;
+	} else if (depth == 0) {
+		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+		return;
+	}
+
+	memset(get_dom_info(upper), 0, sizeof(ir_dom_info));
+	ir_node *idom = get_dom_info(lower)->idom;
+	if (idom != NULL) {
+		unlink_dom_child(lower);
+		set_Block_idom(upper, idom);
+	}
+	set_Block_idom(lower, upper);
+	set_Block_dom_pre_num(upper, -1);
+	set_dom_subtree_depth(upper, depth);
+	dom_tree_changed(irg);
+}
+
+/** A control flow edge change recorded by the tracking. */
+typedef struct dom_edge_change_t {
+	ir_node *from;
+	ir_node *to;
+	bool     insert;
+} dom_edge_change_t;
+
+static ir_graph          *tracked_irg;
+static dom_edge_change_t *tracked_changes;
+static bool               tracked_end_changed; /**< keep-alive edges changed */
+static bool               tracked_recompute;   /**< changes not expressible
+                                                    as edge updates */
+static bool               tracked_outdated;    /**< the dominance information
+                                                    must be recomputed */
+static size_t             tracked_n_blocks;    /**< blocks in the dominator
+                                                    tree when it was computed */
+static irg_walk_func     *tracked_unreachable; /**< called for blocks which
+                                                    became unreachable */
+static irg_walk_func     *tracked_changed;     /**< called for blocks whose
+                                                    predecessors or dominators
+                                                    changed */
+static void              *tracked_env;
+static hook_entry_t       tracking_hooks[3];
+
+static void track_edge_change(ir_node *from, ir_node *to, bool insert)
+{
+	int const depth = get_Block_dom_depth(from);
+	/* edges from unreachable blocks do not influence the dominators */
+	if (depth < 0)
+		return;
+	if (depth == 0 || get_Block_dom_depth(to) == 0) {
+		tracked_recompute = true;
+	} else if (to == get_irg_end_block(tracked_irg)) {
+		tracked_end_changed = true;
+	} else {
+		dom_edge_change_t const change = { from, to, insert };
+		ARR_APP1(dom_edge_change_t, tracked_changes, change);
+	}
+}
+
+static ir_node *get_cf_pred_block(ir_node *pred)
+{
+	if (pred == NULL || is_Bad(pred))
+		return NULL;
+	ir_node *block = get_nodes_block(pred);
+	return is_Bad(block) ? NULL : block;
+}
+
+static void track_set_irn_n(void *ctx, ir_node *src, int pos, ir_node *tgt,
+                            ir_node *old_tgt)
+{
+	(void)ctx;
+	if (get_irn_irg(src) != tracked_irg || tgt == old_tgt)
+		return;
+
+	if (is_Block(src)) {
+		ir_node *old_block = get_cf_pred_block(old_tgt);
+		ir_node *new_block = get_cf_pred_block(tgt);
+		if (old_block == new_block)
+			return;
+		note_dom_changed(src);
+		if (tracked_outdated)
+			return;
+		if (old_block != NULL)
+			track_edge_change(old_block, src, false);
+		if (new_block != NULL)
+			track_edge_change(new_block, src, true);
+	} else if (tracked_outdated) {
+		return;
+	} else if (is_End(src)) {
+		if ((tgt != NULL && is_Block(tgt))
+		    || (old_tgt != NULL && is_Block(old_tgt)))
+			tracked_end_changed = true;
+	} else if (pos == -1 && get_irn_mode(src) == mode_X) {
+		/* a control flow node moves to another block */
+		tracked_recompute = true;
+	}
+}
+
+static void track_replace(void *ctx, ir_node *old_node, ir_node *new_node)
+{
+	(void)ctx;
+	(void)new_node;
+	if (is_Block(old_node) && get_irn_irg(old_node) == tracked_irg
+	    && !tracked_outdated && get_Block_dom_depth(old_node) > 0)
+		tracked_recompute = true;
+}
+
+static void track_new_node(void *ctx, ir_node *node)
+{
+	(void)ctx;
+	if (is_Block(node) && get_irn_irg(node) == tracked_irg)
+		tracked_recompute = true;
+}
+
+static void count_block(ir_node *block, void *env)
+{
+	(void)block;
+	++*(size_t*)env;
+}
+
+/** Starts counting the work of the updates against a recomputation. */
+static void reset_dom_update_work(ir_graph *irg)
+{
+	tracked_n_blocks = 0;
+	irg_block_walk_graph(irg, count_block, NULL, &tracked_n_blocks);
+	dom_update_work = 0;
+}
+
+static void collect_block(ir_node *block, void *env)
+{
+	ir_node ***blocks = (ir_node***)env;
+	ARR_APP1(ir_node*, *blocks, block);
+}
+
+/**
+ * Marks the blocks which are reachable from Start but cannot reach End as
+ * unreachable. compute_doms() does not see these blocks, so they keep outdated
+ * information, which the updates along the block out edges could pick up.
+ */
+static void clear_dead_end_blocks(ir_graph *irg)
+{
+	if (!edges_activated_kind(irg, EDGE_KIND_BLOCK))
+		return;
+
+	ir_node **worklist = NEW_ARR_F(ir_node*, 0);
+	irg_block_walk_graph(irg, collect_block, NULL, &worklist);
+	/* the walk left the blocks which can reach End marked */
+	ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	for (size_t n = ARR_LEN(worklist); n > 0; n = ARR_LEN(worklist)) {
+		ir_node *block = worklist[n - 1];
+		ARR_SHRINKLEN(worklist, n - 1);
+		foreach_block_succ(block, edge) {
+			ir_node *succ = get_edge_src_irn(edge);
+			if (Block_block_visited(succ))
+				continue;
+			mark_Block_block_visited(succ);
+			set_dom_unreachable(succ);
+			ARR_APP1(ir_node*, worklist, succ);
+		}
+	}
+	ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+	DEL_ARR_F(worklist);
+}
+
+void dom_begin_tracking(ir_graph *irg, irg_walk_func *unreachable,
+                        irg_walk_func *changed, void *env)
+{
+	assert(tracked_irg == NULL);
+	assert(irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
+	                             | IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES));
+	clear_dead_end_blocks(irg);
+	reset_dom_update_work(irg);
+	tracked_irg         = irg;
+	tracked_changes     = NEW_ARR_F(dom_edge_change_t, 0);
+	tracked_end_changed = false;
+	tracked_recompute   = false;
+	tracked_outdated    = false;
+	tracked_unreachable = unreachable;
+	tracked_changed     = changed;
+	tracked_env         = env;
+	removed_blocks      = NEW_ARR_F(ir_node*, 0);
+	changed_blocks      = NEW_ARR_F(ir_node*, 0);
+
+	tracking_hooks[0].hook._hook_set_irn_n = track_set_irn_n;
+	register_hook(hook_set_irn_n, &tracking_hooks[0]);
+	tracking_hooks[1].hook._hook_replace = track_replace;
+	register_hook(hook_replace, &tracking_hooks[1]);
+	tracking_hooks[2].hook._hook_new_node = track_new_node;
+	register_hook(hook_new_node, &tracking_hooks[2]);
+}
+
+/** The dominator of a block before the dominance is recomputed. */
+typedef struct dom_before_t {
+	ir_node *block;
+	ir_node *idom;
+	int      depth;
+} dom_before_t;
+
+static void collect_dom_before(ir_node *block, void *env)
+{
+	dom_before_t **before = (dom_before_t**)env;
+	dom_before_t   entry  = {
+		.block = block,
+		.idom  = get_dom_info(block)->idom,
+		.depth = get_Block_dom_depth(block),
+	};
+	ARR_APP1(dom_before_t, *before, entry);
+}
+
+/**
+ * Recomputes the dominance information of the tracked graph and reports the
+ * blocks which lost their reachability or whose dominator changed.
+ */
+static void recompute_tracked_doms(ir_graph *irg)
+{
+	dom_before_t *before = NEW_ARR_F(dom_before_t, 0);
+	irg_block_walk_graph(irg, collect_dom_before, NULL, &before);
+	compute_doms(irg);
+	clear_dead_end_blocks(irg);
+	reset_dom_update_work(irg);
+	tracked_outdated = false;
+	for (size_t i = 0, n = ARR_LEN(before); i < n; ++i) {
+		dom_before_t const *entry = &before[i];
+		int const depth = get_Block_dom_depth(entry->block);
+		if (depth < 0) {
+			if (entry->depth >= 0)
+				tracked_unreachable(entry->block, tracked_env);
+		} else if (entry->depth <= 0
+		           || get_dom_info(entry->block)->idom != entry->idom) {
+			note_dom_changed(entry->block);
+		}
+	}
+	DEL_ARR_F(before);
+}
+
+void dom_apply_tracked_changes(bool recompute)
+{
+	ir_graph    *irg       = tracked_irg;
+	size_t const n_changes = ARR_LEN(tracked_changes);
+	if (tracked_outdated) {
+		/* nothing has been recorded */
+	} else if (tracked_recompute || n_changes > 1
+	           || dom_update_work > tracked_n_blocks) {
+		/* the updates expect the graph to differ from the dominator tree by
+		 * a single edge. Once they visited as many blocks as a recomputation
+		 * does, the remaining changes are left to the recomputation, too, so
+		 * many changes in large subtrees do not take quadratic time. */
+		tracked_outdated = true;
+	} else {
+		if (n_changes == 1) {
+			dom_edge_change_t const *change = &tracked_changes[0];
+			if (change->insert)
+				dom_insert_edge(change->from, change->to);
+			else
+				dom_delete_edge(change->from, change->to);
+		}
+		if (tracked_end_changed) {
+			update_end_block_idom(irg);
+			dom_tree_changed(irg);
+		}
+	}
+	ARR_SHRINKLEN(tracked_changes, 0);
+	tracked_end_changed = false;
+	tracked_recompute   = false;
+
+	/* report the blocks the updates made unreachable */
+	for (size_t i = 0, n = ARR_LEN(removed_blocks); i < n; ++i) {
+		ir_node *block = removed_blocks[i];
+		if (get_Block_dom_depth(block) < 0)
+			tracked_unreachable(block, tracked_env);
+	}
+	ARR_SHRINKLEN(removed_blocks, 0);
+
+	if (recompute && (tracked_outdated
+	    || !irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE)))
+		recompute_tracked_doms(irg);
+
+	/* report the changed blocks which are still reachable */
+	for (size_t i = 0, n = ARR_LEN(changed_blocks); i < n; ++i) {
+		ir_node *block = changed_blocks[i];
+		if (get_Block_dom_depth(block) >= 0)
+			tracked_changed(block, tracked_env);
+	}
+	ARR_SHRINKLEN(changed_blocks, 0);
+}
+
+void dom_end_tracking(void)
+{
+	dom_apply_tracked_changes(true);
+	unregister_hook(hook_new_node, &tracking_hooks[2]);
+	unregister_hook(hook_replace, &tracking_hooks[1]);
+	unregister_hook(hook_set_irn_n, &tracking_hooks[0]);
+	DEL_ARR_F(changed_blocks);
+	DEL_ARR_F(removed_blocks);
+	DEL_ARR_F(tracked_changes);
+	changed_blocks = NULL;
+	removed_blocks = NULL;
+	tracked_irg    = NULL;
+}
@@ -12,6 +12,8 @@
 #ifndef FIRM_ANA_IRDOM_T_H
 #define FIRM_ANA_IRDOM_T_H
 
+#include <stdbool.h>
+
 #include "irdom.h"
 #include "pmap.h"
 #include "obst.h"
@@ -59,6 +61,39 @@ unsigned get_Block_pdom_max_subtree_pre_num(const ir_node *bl);
 
 void ir_free_dominance_frontiers(ir_graph *irg);
 
+/**
+ * Updates the dominance information after the block @p lower has been split
+ * and its upper part moved to the new block @p upper, which jumps to @p lower.
+ */
+void dom_split_block(ir_node *upper, ir_node *lower);
+
+/**
+ * Starts recording the control flow changes of @p irg, which must have
+ * consistent dominance information and out edges. When applying the changes
+ * makes a block unreachable, @p unreachable is called for it with @p env.
+ * @p changed is called for the reachable blocks whose predecessors or
+ * immediate dominator changed.
+ */
+void dom_begin_tracking(ir_graph *irg, irg_walk_func *unreachable,
+                        irg_walk_func *changed, void *env);
+
+/**
+ * Updates the dominance information with the control flow changes recorded
+ * since the last call. If the changes cannot be applied as a single edge
+ * update, the information is outdated until it is recomputed, which happens
+ * if @p recompute is set. Recomputing needs the out data structure, so it must
+ * not happen during a graph walk. Either way the unreachable callback is
+ * invoked once for each block that lost its reachability, and the changed
+ * callback for each block whose predecessors or dominator changed.
+ */
+void dom_apply_tracked_changes(bool recompute);
+
+/**
+ * Applies the remaining changes, recomputing the dominance information if
+ * necessary, and stops recording.
+ */
+void dom_end_tracking(void);
+
 /**
  * Iterate over all nodes which are immediately dominated by a given
  * node.
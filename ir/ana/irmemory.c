@@ -23,6 +23,10 @@
 #include "irflag.h"
 #include "irouts_t.h"
 #include "irgwalk.h"
+#include "irnodemap.h"
+#include "set.h"
+#include "statev_t.h"
+#include "xmalloc.h"
 #include "irprintf.h"
 #include "debug.h"
 #include "panic.h"
@@ -37,6 +41,36 @@ DEBUG_ONLY(static firm_dbg_module_t *dbgcall = NULL;)
 /** The global memory disambiguator options. */
 static unsigned global_mem_disamgig_opt = aa_opt_none;
 
+/** An address split into a base address and offsets. */
+typedef struct addr_decomposition_t {
+	const ir_node *addr;          /**< address without Add offsets */
+	const ir_node *sym_offset;    /**< symbolic offset, NULL if none */
+	long           offset;        /**< sum of the constant offsets */
+	bool           const_offsets; /**< at most one symbolic offset */
+	const ir_node *base;          /**< base address without Sels/Members */
+	ir_entity     *ent;           /**< outermost Member entity or NULL */
+} addr_decomposition_t;
+
+/** A cached alias query. */
+typedef struct alias_query_t {
+	const ir_node     *addr1;
+	const ir_type     *type1;
+	unsigned           size1;
+	const ir_node     *addr2;
+	const ir_type     *type2;
+	unsigned           size2;
+	ir_alias_relation  rel;
+} alias_query_t;
+
+/** The alias queries and address decompositions of a graph. */
+struct ir_alias_cache {
+	struct obstack obst;      /**< holds the decompositions */
+	ir_nodemap     addrs;     /**< address node -> addr_decomposition_t */
+	set           *queries;   /**< set of alias_query_t */
+	unsigned       n_queries; /**< number of queries */
+	unsigned       n_hits;    /**< number of queries answered by the cache */
+};
+
 const char *get_ir_alias_relation_name(ir_alias_relation rel)
 {
 #define X(a) case a: return #a
@@ -60,11 +94,24 @@ unsigned get_irg_memory_disambiguator_options(const ir_graph *irg)
 void set_irg_memory_disambiguator_options(ir_graph *irg, unsigned options)
 {
 	irg->mem_disambig_opt = options & ~aa_opt_inherited;
+	free_irg_alias_cache(irg);
+}
+
+/**
+ * Drops the alias caches of all graphs, for changes of information which
+ * the cached relations of every graph may depend on.
+ */
+static void free_irp_alias_caches(void)
+{
+	foreach_irp_irg(i, irg) {
+		free_irg_alias_cache(irg);
+	}
 }
 
 void set_irp_memory_disambiguator_options(unsigned options)
 {
 	global_mem_disamgig_opt = options;
+	free_irp_alias_caches();
 }
 
 ir_storage_class_class_t get_base_sc(ir_storage_class_class_t x)
@@ -104,6 +151,123 @@ static const ir_node *find_base_addr(const ir_node *node, ir_entity **pEnt)
 	return node;
 }
 
+/**
+ * Decomposes @p addr into a base address and constant and symbolic offsets.
+ * Note: sub X, C is normalized to add X, -C
+ */
+static void decompose_addr(const ir_node *addr, addr_decomposition_t *dec)
+{
+	dec->offset        = 0;
+	dec->sym_offset    = NULL;
+	dec->const_offsets = true;
+
+	/*
+	 * Currently, only expressions with at most one symbolic
+	 * offset can be handled.  To extend this, change
+	 * sym_offset to be a set, and compare the sets.
+	 */
+	while (dec->const_offsets && is_Add(addr)) {
+		ir_mode *mode_left = get_irn_mode(get_Add_left(addr));
+
+		ir_node *ptr_node;
+		ir_node *int_node;
+		if (mode_is_reference(mode_left)) {
+			ptr_node = get_Add_left(addr);
+			int_node = get_Add_right(addr);
+		} else {
+			ptr_node = get_Add_right(addr);
+			int_node = get_Add_left(addr);
+		}
+
+		if (is_Const(int_node)) {
+			ir_tarval *tv = get_Const_tarval(int_node);
+			if (tarval_is_long(tv)) {
+				/* TODO: check for overflow */
+				dec->offset += get_tarval_long(tv);
+				goto follow_ptr;
+			}
+		}
+		if (dec->sym_offset == NULL) {
+			dec->sym_offset = int_node;
+		} else {
+			// addr has more than one symbolic offset.
+			// Give up
+			dec->const_offsets = false;
+		}
+
+follow_ptr:
+		addr = ptr_node;
+	}
+	dec->addr = addr;
+
+	/* skip Sels/Members */
+	dec->ent  = NULL;
+	dec->base = find_base_addr(addr, &dec->ent);
+}
+
+static int cmp_alias_query(const void *elt, const void *key, size_t size)
+{
+	(void)size;
+	const alias_query_t *q1 = (const alias_query_t*)elt;
+	const alias_query_t *q2 = (const alias_query_t*)key;
+	return q1->addr1 != q2->addr1 || q1->type1 != q2->type1
+	    || q1->size1 != q2->size1 || q1->addr2 != q2->addr2
+	    || q1->type2 != q2->type2 || q1->size2 != q2->size2;
+}
+
+/**
+ * Returns the alias cache of @p irg, the cache is dropped when a
+ * transformation did not confirm IR_GRAPH_PROPERTY_CONSISTENT_ALIAS_CACHE.
+ */
+static ir_alias_cache *get_alias_cache(ir_graph *irg)
+{
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_ALIAS_CACHE))
+		free_irg_alias_cache(irg);
+
+	ir_alias_cache *cache = irg->alias_cache;
+	if (cache == NULL) {
+		cache = XMALLOCZ(ir_alias_cache);
+		obstack_init(&cache->obst);
+		ir_nodemap_init(&cache->addrs, irg);
+		cache->queries   = new_set(cmp_alias_query, 32);
+		irg->alias_cache = cache;
+		add_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_ALIAS_CACHE);
+	}
+	return cache;
+}
+
+static const addr_decomposition_t *get_addr_decomposition(
+		ir_alias_cache *cache, const ir_node *addr)
+{
+	addr_decomposition_t *dec
+		= ir_nodemap_get(addr_decomposition_t, &cache->addrs, addr);
+	if (dec == NULL) {
+		dec = OALLOC(&cache->obst, addr_decomposition_t);
+		decompose_addr(addr, dec);
+		ir_nodemap_insert(&cache->addrs, addr, dec);
+	}
+	return dec;
+}
+
+void free_irg_alias_cache(ir_graph *irg)
+{
+	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_ALIAS_CACHE);
+	ir_alias_cache *const cache = irg->alias_cache;
+	if (cache == NULL)
+		return;
+
+	DB((dbg, LEVEL_1, "alias cache of %+F: %u of %u queries cached\n", irg,
+	    cache->n_hits, cache->n_queries));
+	stat_ev_int("alias_cache_queries", cache->n_queries);
+	stat_ev_int("alias_cache_hits", cache->n_hits);
+
+	del_set(cache->queries);
+	ir_nodemap_destroy(&cache->addrs);
+	obstack_free(&cache->obst, NULL);
+	free(cache);
+	irg->alias_cache = NULL;
+}
+
 /**
  * Returns true if @c compound is a compound type that contains a
  * member with type @c member, including recursively, or if @c
@@ -236,7 +400,7 @@ analyze_entity:
 	return res;
 }
 
-static ir_alias_relation _get_alias_relation(
+static ir_alias_relation _get_alias_relation(ir_alias_cache *const cache,
 	const ir_node *addr1, const ir_type *const objt1, unsigned size1,
 	const ir_node *addr2, const ir_type *const objt2, unsigned size2)
 {
@@ -250,85 +414,19 @@ static ir_alias_relation _get_alias_relation(
 	if (options & aa_opt_no_alias)
 		return ir_no_alias;
 
-	/* do the addresses have constants offsets from the same base?
-	 *  Note: sub X, C is normalized to add X, -C */
-	long           offset1            = 0;
-	long           offset2            = 0;
-	const ir_node *sym_offset1        = NULL;
-	const ir_node *sym_offset2        = NULL;
-	bool           have_const_offsets = true;
-
-	/*
-	 * Currently, only expressions with at most one symbolic
-	 * offset can be handled.  To extend this, change
-	 * sym_offset{1,2} to be sets, and compare the sets.
-	 */
-
-	while (have_const_offsets && is_Add(addr1)) {
-		ir_mode *mode_left = get_irn_mode(get_Add_left(addr1));
-
-		ir_node *ptr_node;
-		ir_node *int_node;
-		if (mode_is_reference(mode_left)) {
-			ptr_node = get_Add_left(addr1);
-			int_node = get_Add_right(addr1);
-		} else {
-			ptr_node = get_Add_right(addr1);
-			int_node = get_Add_left(addr1);
-		}
+	const ir_node *const orig_addr1 = addr1;
+	const ir_node *const orig_addr2 = addr2;
 
-		if (is_Const(int_node)) {
-			ir_tarval *tv = get_Const_tarval(int_node);
-			if (tarval_is_long(tv)) {
-				/* TODO: check for overflow */
-				offset1 += get_tarval_long(tv);
-				goto follow_ptr1;
-			}
-		}
-		if (sym_offset1 == NULL) {
-			sym_offset1 = int_node;
-		} else {
-			// addr1 has more than one symbolic offset.
-			// Give up
-			have_const_offsets = false;
-		}
-
-follow_ptr1:
-		addr1 = ptr_node;
-	}
-
-	while (have_const_offsets && is_Add(addr2)) {
-		ir_mode *mode_left = get_irn_mode(get_Add_left(addr2));
-
-		ir_node *ptr_node;
-		ir_node *int_node;
-		if (mode_is_reference(mode_left)) {
-			ptr_node = get_Add_left(addr2);
-			int_node = get_Add_right(addr2);
-		} else {
-			ptr_node = get_Add_right(addr2);
-			int_node = get_Add_left(addr2);
-		}
-
-		if (is_Const(int_node)) {
-			ir_tarval *tv = get_Const_tarval(int_node);
-			if (tarval_is_long(tv)) {
-				/* TODO: check for overflow */
-				offset2 += get_tarval_long(tv);
-				goto follow_ptr2;
-			}
-		}
-		if (sym_offset2 == NULL) {
-			sym_offset2 = int_node;
-		} else {
-			// addr2 has more than one symbolic offset.
-			// Give up
-			have_const_offsets = false;
-		}
-
-follow_ptr2:
-		addr2 = ptr_node;
-	}
+	/* do the addresses have constants offsets from the same base? */
+	const addr_decomposition_t *const dec1 = get_addr_decomposition(cache, addr1);
+	const addr_decomposition_t *const dec2 = get_addr_decomposition(cache, addr2);
+	long           offset1            = dec1->offset;
+	long           offset2            = dec2->offset;
+	const ir_node *sym_offset1        = dec1->sym_offset;
+	const ir_node *sym_offset2        = dec2->sym_offset;
+	bool const     have_const_offsets = dec1->const_offsets && dec2->const_offsets;
+	addr1 = dec1->addr;
+	addr2 = dec2->addr;
 
 	/* same base address -> compare offsets if possible.
 	 * FIXME: type long is not sufficient for this task ... */
@@ -352,10 +450,10 @@ follow_ptr2:
 	}
 
 	/* skip Sels/Members */
-	ir_entity     *ent1  = NULL;
-	ir_entity     *ent2  = NULL;
-	const ir_node *base1 = find_base_addr(addr1, &ent1);
-	const ir_node *base2 = find_base_addr(addr2, &ent2);
+	ir_entity     *const ent1  = dec1->ent;
+	ir_entity     *const ent2  = dec2->ent;
+	const ir_node *const base1 = dec1->base;
+	const ir_node *const base2 = dec2->base;
 
 	/* two struct accesses -> compare entities */
 	if (ent1 != NULL && ent2 != NULL) {
@@ -441,6 +539,10 @@ check_classes:;
 		}
 	}
 
+	/* pointers to disjoint objects */
+	if (get_points_to_relation(orig_addr1, orig_addr2) == ir_no_alias)
+		return ir_no_alias;
+
 	/* Type based alias analysis */
 	if (options & aa_opt_type_based) {
 		ir_alias_relation rel;
@@ -488,10 +590,28 @@ ir_alias_relation get_alias_relation(
 	const ir_node *const addr1, const ir_type *const type1, unsigned size1,
 	const ir_node *const addr2, const ir_type *const type2, unsigned size2)
 {
-	ir_alias_relation rel = _get_alias_relation(addr1, type1, size1, addr2, type2, size2);
+	ir_alias_cache *const cache = get_alias_cache(get_irn_irg(addr1));
+	alias_query_t         query = {
+		.addr1 = addr1, .type1 = type1, .size1 = size1,
+		.addr2 = addr2, .type2 = type2, .size2 = size2,
+	};
+	unsigned const hash = hash_combine(
+		hash_combine(hash_ptr(addr1), hash_ptr(addr2)),
+		hash_combine(hash_ptr(type1) ^ size1, hash_ptr(type2) ^ size2));
+
+	++cache->n_queries;
+	alias_query_t const *const cached
+		= set_find(alias_query_t, cache->queries, &query, sizeof(query), hash);
+	if (cached != NULL) {
+		++cache->n_hits;
+		return cached->rel;
+	}
+
+	query.rel = _get_alias_relation(cache, addr1, type1, size1, addr2, type2, size2);
 	DB((dbg, LEVEL_1, "alias(%+F, %+F) = %s\n", addr1, addr2,
-	    get_ir_alias_relation_name(rel)));
-	return rel;
+	    get_ir_alias_relation_name(query.rel)));
+	(void)set_insert(alias_query_t, cache->queries, &query, sizeof(query), hash);
+	return query.rel;
 }
 
 /**
@@ -684,6 +804,8 @@ static void analyse_irg_entity_usage(ir_graph *irg)
 	}
 
 	/* now computed */
+	/* cached relations of frame entities may change */
+	free_irg_alias_cache(irg);
 	add_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_ENTITY_USAGE);
 }
 
@@ -868,6 +990,7 @@ static void analyse_irp_globals_entity_usage(void)
 
 	/* now computed */
 	irp->globals_entity_usage_state = ir_entity_usage_computed;
+	free_irp_alias_caches();
 }
 
 ir_entity_usage_computed_state get_irp_globals_entity_usage_state(void)
@@ -878,6 +1001,7 @@ ir_entity_usage_computed_state get_irp_globals_entity_usage_state(void)
 void set_irp_globals_entity_usage_state(ir_entity_usage_computed_state state)
 {
 	irp->globals_entity_usage_state = state;
+	free_irp_alias_caches();
 }
 
 void assure_irp_globals_entity_usage_computed(void)
@@ -12,6 +12,8 @@
 #ifndef FIRM_ANA_IRMEMORY_T_H
 #define FIRM_ANA_IRMEMORY_T_H
 
+#include "irmemory.h"
+
 /**
  * One-time inititialization of the memory< disambiguator.
  */
@@ -57,4 +59,25 @@ ir_storage_class_class_t get_base_sc(ir_storage_class_class_t x);
 ir_storage_class_class_t classify_pointer(const ir_node *addr,
                                           const ir_node *base);
 
+/**
+ * Returns ir_no_alias if the points-to analysis proves that @p addr1 and
+ * @p addr2 point to disjoint objects, ir_may_alias otherwise.
+ */
+ir_alias_relation get_points_to_relation(const ir_node *addr1,
+                                         const ir_node *addr2);
+
+/**
+ * Frees the points-to information of @p irg, for transformations which
+ * renumber the nodes.
+ */
+void free_irg_points_to(ir_graph *irg);
+
+typedef struct ir_alias_cache ir_alias_cache;
+
+/**
+ * Frees the cached alias queries of @p irg and clears
+ * IR_GRAPH_PROPERTY_CONSISTENT_ALIAS_CACHE.
+ */
+void free_irg_alias_cache(ir_graph *irg);
+
 #endif
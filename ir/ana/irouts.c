@@ -19,20 +19,21 @@
 
 unsigned get_irn_n_outs(const ir_node *node)
 {
-	return node->o.out->n_edges;
+	return get_irn_out_edges(node)->n_edges;
 }
 
 ir_node *get_irn_out(const ir_node *def, unsigned pos)
 {
 	assert(pos < get_irn_n_outs(def));
-	return def->o.out->edges[pos].use;
+	return get_irn_out_edges(def)->edges[pos].use;
 }
 
 ir_node *get_irn_out_ex(const ir_node *def, unsigned pos, int *in_pos)
 {
 	assert(pos < get_irn_n_outs(def));
-	*in_pos = def->o.out->edges[pos].pos;
-	return def->o.out->edges[pos].use;
+	ir_def_use_edge const *const edge = &get_irn_out_edges(def)->edges[pos];
+	*in_pos = edge->pos;
+	return edge->use;
 }
 
 unsigned get_Block_n_cfg_outs(const ir_node *bl)
@@ -218,54 +219,45 @@ void irg_out_block_walk(ir_node *node, irg_walk_func *pre, irg_walk_func *post,
 /** array in irgraph.  The 0 field of each out array contains the    **/
 /** size of this array.  This saves memory in the irnodes themselves.**/
 /** The construction does two passes over the graph.  The first pass **/
-/** counts the overall number of outs and the outs of each node.  It **/
-/** stores the outs of each node in the out reference of the node.   **/
-/** Then the large array is allocated.  The second iteration chops   **/
-/** the large array into smaller parts, sets the out edges and       **/
-/** recounts the out edges.                                          **/
+/** counts the outs of each node in a table indexed by the node      **/
+/** index.  The second iteration allocates the arrays of the nodes,  **/
+/** sets the out edges and recounts the out edges.                   **/
 /*--------------------------------------------------------------------*/
 
 
-/** Returns the amount of out edges for not yet visited successors. */
-static void count_outs_node(ir_node *n)
+/** Counts the out edges of not yet visited successors. */
+static void count_outs_node(ir_node *n, unsigned *n_outs)
 {
 	if (irn_visited_else_mark(n))
 		return;
 
-	/* initialize our counter */
-	n->o.n_outs = 0;
-
 	int start = is_Block(n) ? 0 : -1;
 	for (int i = start, irn_arity = get_irn_arity(n); i < irn_arity; ++i) {
 		ir_node *def = get_irn_n(n, i);
-		count_outs_node(def);
-		++def->o.n_outs;
+		count_outs_node(def, n_outs);
+		++n_outs[get_irn_idx(def)];
 	}
 }
 
 
-/** Returns the amount of out edges for not yet visited successors.
- *  This version handles some special nodes like irg_frame, irg_args etc. */
-static void count_outs(ir_graph *irg)
+/** Counts the out edges of all nodes of @p irg. */
+static void count_outs(ir_graph *irg, unsigned *n_outs)
 {
 	inc_irg_visited(irg);
-	count_outs_node(get_irg_end(irg));
-	foreach_irn_in(get_irg_anchor(irg), i, n) {
-		if (irn_visited_else_mark(n))
-			continue;
-		n->o.n_outs = 0;
-	}
+	count_outs_node(get_irg_end(irg), n_outs);
 }
 
-static void set_out_edges_node(ir_node *node, struct obstack *obst)
+static void set_out_edges_node(ir_node *node, struct obstack *obst,
+                               unsigned const *n_outs)
 {
 	if (irn_visited_else_mark(node))
 		return;
 
 	/* Allocate my array */
-	unsigned n_outs = node->o.n_outs;
-	node->o.out          = OALLOCF(obst, ir_def_use_edges, edges, n_outs);
-	node->o.out->n_edges = 0;
+	ir_def_use_edges *const outs
+		= OALLOCF(obst, ir_def_use_edges, edges, n_outs[get_irn_idx(node)]);
+	outs->n_edges = 0;
+	set_irn_out_edges(node, outs);
 
 	/* add def->use edges from my predecessors to me */
 	int start = is_Block(node) ? 0 : -1;
@@ -273,28 +265,32 @@ static void set_out_edges_node(ir_node *node, struct obstack *obst)
 		ir_node *def = get_irn_n(node, i);
 
 		/* recurse, ensures that out array of pred is already allocated */
-		set_out_edges_node(def, obst);
+		set_out_edges_node(def, obst, n_outs);
 
 		/* Remember this Def-Use edge */
-		unsigned pos = def->o.out->n_edges++;
-		def->o.out->edges[pos].use = node;
-		def->o.out->edges[pos].pos = i;
+		ir_def_use_edges *const def_outs = get_irn_out_edges(def);
+		unsigned          const pos      = def_outs->n_edges++;
+		def_outs->edges[pos].use = node;
+		def_outs->edges[pos].pos = i;
 	}
 }
 
-static void set_out_edges(ir_graph *irg)
+static void set_out_edges(ir_graph *irg, unsigned const *n_outs)
 {
 	struct obstack *obst = &irg->out_obst;
 	obstack_init(obst);
 	irg->out_obst_allocated = true;
+	irg->outs = NEW_ARR_FZ(ir_def_use_edges*, get_irg_last_idx(irg));
 
 	inc_irg_visited(irg);
-	set_out_edges_node(get_irg_end(irg), obst);
+	set_out_edges_node(get_irg_end(irg), obst, n_outs);
+	/* the anchors like irg_frame or irg_args may be unused */
 	foreach_irn_in(get_irg_anchor(irg), i, n) {
 		if (irn_visited_else_mark(n))
 			continue;
-		n->o.out          = OALLOCF(obst, ir_def_use_edges, edges, 0);
-		n->o.out->n_edges = 0;
+		ir_def_use_edges *const outs = OALLOCF(obst, ir_def_use_edges, edges, 0);
+		outs->n_edges = 0;
+		set_irn_out_edges(n, outs);
 	}
 }
 
@@ -302,13 +298,14 @@ void compute_irg_outs(ir_graph *irg)
 {
 	free_irg_outs(irg);
 
-	/* This first iteration counts the overall number of out edges and the
-	   number of out edges for each node. */
-	count_outs(irg);
+	/* This first iteration counts the number of out edges for each node. */
+	unsigned *const n_outs = XMALLOCNZ(unsigned, get_irg_last_idx(irg));
+	count_outs(irg, n_outs);
 
-	/* The second iteration splits the irg->outs array into smaller arrays
-	   for each node and writes the back edges into this array. */
-	set_out_edges(irg);
+	/* The second iteration allocates the out arrays of the nodes and writes
+	   the back edges into them. */
+	set_out_edges(irg, n_outs);
+	free(n_outs);
 
 	add_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS);
 }
@@ -319,25 +316,14 @@ void assure_irg_outs(ir_graph *irg)
 		compute_irg_outs(irg);
 }
 
-#ifdef DEBUG_libfirm
-/** Clear the outs of a node */
-static void reset_outs(ir_node *node, void *unused)
-{
-	(void)unused;
-	node->o.out = NULL;
-}
-#endif
-
 void free_irg_outs(ir_graph *irg)
 {
 	if (irg->out_obst_allocated) {
 		obstack_free(&irg->out_obst, NULL);
 		irg->out_obst_allocated = false;
 	}
-
-#ifdef DEBUG_libfirm
-	/* when debugging, *always* reset all nodes' outs!  irg->outs might
-	   have been lying to us */
-	irg_walk_graph(irg, reset_outs, NULL, NULL);
-#endif
+	if (irg->outs != NULL) {
+		DEL_ARR_F(irg->outs);
+		irg->outs = NULL;
+	}
 }
@@ -6,7 +6,38 @@
 #ifndef FIRM_ANA_IROUTS_T_H
 #define FIRM_ANA_IROUTS_T_H
 
+#include <string.h>
+
 #include "irouts.h"
+#include "irgraph_t.h"
+#include "irnode_t.h"
+
+/**
+ * Returns the Def-Use array of @p node.
+ */
+static inline ir_def_use_edges *get_irn_out_edges(const ir_node *node)
+{
+	ir_graph *const irg = get_irn_irg(node);
+	unsigned  const idx = get_irn_idx(node);
+	assert(irg->outs != NULL && idx < ARR_LEN(irg->outs));
+	return irg->outs[idx];
+}
+
+/**
+ * Sets the Def-Use array of @p node, which may have been created after the
+ * out edges were computed.
+ */
+static inline void set_irn_out_edges(ir_node *node, ir_def_use_edges *edges)
+{
+	ir_graph *const irg = get_irn_irg(node);
+	unsigned  const idx = get_irn_idx(node);
+	size_t    const len = ARR_LEN(irg->outs);
+	if (idx >= len) {
+		ARR_RESIZE(ir_def_use_edges*, irg->outs, idx + 1);
+		memset(&irg->outs[len], 0, (idx + 1 - len) * sizeof(*irg->outs));
+	}
+	irg->outs[idx] = edges;
+}
 
 #define foreach_irn_out(irn, idx, succ) \
 	for (bool succ##__b = true; succ##__b;) \
@@ -0,0 +1,1132 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief    Interprocedural points-to analysis.
+ *
+ * The analysis computes for every value of the program the set of abstract
+ * objects it may point to. Abstract objects are entities (global variables,
+ * local variables, functions), allocation sites (Alloc nodes and calls to
+ * malloc-like functions), stack frames and one object representing all
+ * memory outside of the program. Pointers passed to or received from unknown
+ * code make the pointed-to objects escape: unknown code may access them and
+ * everything reachable from them.
+ *
+ * Two solvers are available:
+ * - unification (Steensgaard): every assignment unifies the points-to sets
+ *   of both sides, which is solved in near-linear time with union-find.
+ *   Fields of an object are not distinguished.
+ * - inclusion (Andersen): assignments are subset constraints, solved by
+ *   propagation over a constraint graph. Member accesses create field
+ *   objects, so pointers to different fields of an object are disjoint.
+ *
+ * Integer values are tracked through memory and Phis as well, because C
+ * allows copying pointers as integers (bytes). Integers converted to
+ * pointers point to any escaped object.
+ *
+ * Nodes created after the analysis ran are unknown to it. Hooks on
+ * set_irn_n(), set_irn_in() and exchange() forget the results of nodes whose
+ * inputs change, so these become unknown as well. The results stay sound
+ * under transformations that do not change the values of the users of
+ * modified nodes.
+ */
+#include <stdbool.h>
+#include <string.h>
+
+#include "array.h"
+#include "cgana.h"
+#include "debug.h"
+#include "hashptr.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irhooks.h"
+#include "irmemory.h"
+#include "irmemory_t.h"
+#include "irnode_t.h"
+#include "irprog_t.h"
+#include "obst.h"
+#include "panic.h"
+#include "pmap.h"
+#include "set.h"
+#include "statev_t.h"
+#include "type_t.h"
+#include "typerep.h"
+#include "unionfind.h"
+#include "util.h"
+#include "xmalloc.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
+
+#define NO_VAR    0
+#define NO_OBJECT ((unsigned)-1)
+
+typedef enum constraint_kind_t {
+	C_ADDR,    /**< dst contains object src */
+	C_COPY,    /**< dst contains src */
+	C_LOAD,    /**< dst contains the contents of the objects in src */
+	C_STORE,   /**< the contents of the objects in dst contain src */
+	C_FIELD,   /**< dst contains the field objects of the objects in src */
+	C_ARITH,   /**< dst contains the whole objects of the objects in src */
+	C_ESCAPED, /**< the objects in src escaped (only for unknown memory) */
+} constraint_kind_t;
+
+typedef struct constraint_t {
+	constraint_kind_t kind;
+	unsigned          dst;
+	unsigned          src;
+	ir_entity        *field; /**< the member entity of C_FIELD */
+} constraint_t;
+
+typedef struct pts_object_t {
+	unsigned   parent;      /**< enclosing object or NO_OBJECT */
+	unsigned   root;        /**< outermost enclosing object */
+	ir_entity *field;       /**< member entity of field objects */
+	unsigned   first_field; /**< first field object */
+	unsigned   next_field;  /**< next field object of the parent */
+	unsigned   loc;         /**< location variable (unification) */
+	unsigned   own;         /**< contents stored into the object itself */
+	unsigned   all;         /**< contents of the object and its fields */
+} pts_object_t;
+
+typedef struct pts_var_t {
+	unsigned  pointee;  /**< pointee variable (unification) */
+	unsigned *pts;      /**< sorted points-to set (inclusion) */
+	unsigned *succs;    /**< copy successors (inclusion) */
+	unsigned *complex;  /**< indices of complex constraints (inclusion) */
+	bool      queued;   /**< variable is in the worklist (inclusion) */
+} pts_var_t;
+
+/** Variables for the parameters and results of a function. */
+typedef struct function_vars_t {
+	unsigned *params;
+	size_t    n_params;
+	unsigned *results;
+	size_t    n_results;
+} function_vars_t;
+
+typedef struct pts_edge_t {
+	unsigned src;
+	unsigned dst;
+} pts_edge_t;
+
+/** The state of the analysis. */
+static struct {
+	bool               computed;
+	ir_points_to_kind  kind;
+	struct obstack     obst;
+	pts_var_t         *vars;           /**< all variables */
+	int               *uf;             /**< union-find over the variables */
+	pts_object_t      *objects;        /**< all objects */
+	constraint_t      *constraints;    /**< constraints to solve */
+	pmap              *entity_objects; /**< entity -> object number + 1 */
+	pmap              *site_objects;   /**< node -> object number + 1 */
+	pmap              *functions;      /**< entity -> function_vars_t */
+	set               *edges;          /**< copy edges (inclusion) */
+	unsigned          *worklist;       /**< queued variables (inclusion) */
+	unsigned           unknown;        /**< the object for unknown memory */
+	unsigned           unknown_ptr;    /**< points to unknown memory */
+	unsigned           unknown_val;    /**< any value from unknown code */
+	ir_graph          *copied_irg;     /**< graph in dead node elimination */
+	hook_entry_t       hooks[4];       /**< hooks forgetting changed nodes */
+} pts;
+
+static unsigned new_var(void)
+{
+	unsigned const   var = ARR_LEN(pts.vars);
+	pts_var_t const  v   = { .pointee = NO_VAR };
+	ARR_APP1(pts_var_t, pts.vars, v);
+	ARR_APP1(int, pts.uf, -1);
+	return var;
+}
+
+static unsigned new_object(unsigned parent, ir_entity *field)
+{
+	unsigned const     obj = ARR_LEN(pts.objects);
+	pts_object_t const o   = {
+		.parent      = parent,
+		.root        = parent != NO_OBJECT ? pts.objects[parent].root : obj,
+		.field       = field,
+		.first_field = NO_OBJECT,
+		.next_field  = NO_OBJECT,
+		.loc         = new_var(),
+		.own         = new_var(),
+		.all         = new_var(),
+	};
+	ARR_APP1(pts_object_t, pts.objects, o);
+	return obj;
+}
+
+static unsigned get_entity_object(ir_entity *entity)
+{
+	while (is_alias_entity(entity))
+		entity = get_entity_alias(entity);
+	void *const res = pmap_get(void, pts.entity_objects, entity);
+	if (res != NULL)
+		return PTR_TO_INT(res) - 1;
+	unsigned const obj = new_object(NO_OBJECT, NULL);
+	pmap_insert(pts.entity_objects, entity, INT_TO_PTR(obj + 1));
+	return obj;
+}
+
+/** Returns the object for memory allocated by @p node. */
+static unsigned get_site_object(const ir_node *node)
+{
+	void *const res = pmap_get(void, pts.site_objects, node);
+	if (res != NULL)
+		return PTR_TO_INT(res) - 1;
+	unsigned const obj = new_object(NO_OBJECT, NULL);
+	pmap_insert(pts.site_objects, node, INT_TO_PTR(obj + 1));
+	return obj;
+}
+
+static bool is_tracked_mode(const ir_mode *mode)
+{
+	return mode_is_reference(mode) || mode_is_int(mode);
+}
+
+/**
+ * Returns the variable of @p node, NO_VAR if the node cannot carry a
+ * pointer.
+ */
+static unsigned get_node_var(const ir_node *node)
+{
+	if (!is_tracked_mode(get_irn_mode(node)))
+		return NO_VAR;
+	ir_graph *const irg = get_irn_irg(node);
+	unsigned  const idx = get_irn_idx(node);
+	assert(idx < irg->n_points_to);
+	if (irg->points_to[idx] == NO_VAR)
+		irg->points_to[idx] = new_var();
+	return irg->points_to[idx];
+}
+
+static void add_constraint(constraint_kind_t kind, unsigned dst, unsigned src)
+{
+	if (dst == NO_VAR || src == NO_VAR)
+		return;
+	constraint_t const c = { .kind = kind, .dst = dst, .src = src };
+	ARR_APP1(constraint_t, pts.constraints, c);
+}
+
+static void add_addr(unsigned dst, unsigned obj)
+{
+	if (dst == NO_VAR)
+		return;
+	constraint_t const c = { .kind = C_ADDR, .dst = dst, .src = obj };
+	ARR_APP1(constraint_t, pts.constraints, c);
+}
+
+static void add_field(unsigned dst, unsigned src, ir_entity *field)
+{
+	if (dst == NO_VAR || src == NO_VAR)
+		return;
+	constraint_t const c = {
+		.kind = C_FIELD, .dst = dst, .src = src, .field = field
+	};
+	ARR_APP1(constraint_t, pts.constraints, c);
+}
+
+/** @p var may contain anything unknown code can produce. */
+static void add_unknown(unsigned var)
+{
+	add_constraint(C_COPY, var, pts.unknown_val);
+}
+
+/** The value of @p var is visible to unknown code. */
+static void add_escape(unsigned var)
+{
+	add_constraint(C_STORE, pts.unknown_ptr, var);
+}
+
+static function_vars_t *get_function_vars(ir_entity *entity)
+{
+	return pmap_get(function_vars_t, pts.functions, entity);
+}
+
+static void create_function_vars(ir_graph *irg)
+{
+	ir_entity       *const entity = get_irg_entity(irg);
+	ir_type         *const mtp    = get_entity_type(entity);
+	function_vars_t *const fun    = OALLOCZ(&pts.obst, function_vars_t);
+	fun->n_params  = get_method_n_params(mtp);
+	fun->params    = OALLOCN(&pts.obst, unsigned, fun->n_params);
+	fun->n_results = get_method_n_ress(mtp);
+	fun->results   = OALLOCN(&pts.obst, unsigned, fun->n_results);
+	for (size_t i = 0; i < fun->n_params; ++i)
+		fun->params[i] = new_var();
+	for (size_t i = 0; i < fun->n_results; ++i)
+		fun->results[i] = new_var();
+	pmap_insert(pts.functions, entity, fun);
+}
+
+/**
+ * Collects the possible callees of @p call with a known graph into
+ * @p callees. Returns true if unknown code may be called.
+ */
+static bool get_callees(const ir_node *call, ir_entity ***callees)
+{
+	ir_entity *const direct = get_Call_callee(call);
+	bool             unknown = false;
+	if (direct != NULL) {
+		ARR_APP1(ir_entity*, *callees, direct);
+	} else if (cg_call_has_callees(call)) {
+		for (size_t i = 0, n = cg_get_call_n_callees(call); i < n; ++i) {
+			ARR_APP1(ir_entity*, *callees, cg_get_call_callee(call, i));
+		}
+	} else {
+		return true;
+	}
+
+	for (size_t i = ARR_LEN(*callees); i-- > 0;) {
+		ir_entity *const callee = (*callees)[i];
+		if (callee == get_unknown_entity() || get_function_vars(callee) == NULL) {
+			unknown = true;
+			(*callees)[i] = (*callees)[ARR_LEN(*callees) - 1];
+			ARR_SHRINKLEN(*callees, ARR_LEN(*callees) - 1);
+		}
+	}
+	return unknown;
+}
+
+static void generate_call(ir_node *call)
+{
+	ir_entity **callees = NEW_ARR_F(ir_entity*, 0);
+	bool const  unknown = get_callees(call, &callees);
+	for (size_t a = 0, n_args = get_Call_n_params(call); a < n_args; ++a) {
+		unsigned const arg = get_node_var(get_Call_param(call, a));
+		bool           passed = !unknown;
+		for (size_t i = 0, n = ARR_LEN(callees); i < n; ++i) {
+			function_vars_t *const fun = get_function_vars(callees[i]);
+			if (a < fun->n_params)
+				add_constraint(C_COPY, fun->params[a], arg);
+			else
+				passed = false;
+		}
+		/* passed to unknown code or as a variadic argument */
+		if (!passed)
+			add_escape(arg);
+	}
+	DEL_ARR_F(callees);
+}
+
+static void generate_call_result(ir_node *proj, ir_node *call)
+{
+	unsigned const var = get_node_var(proj);
+	unsigned const pn  = get_Proj_num(proj);
+
+	ir_entity **callees = NEW_ARR_F(ir_entity*, 0);
+	bool const  unknown = get_callees(call, &callees);
+	for (size_t i = 0, n = ARR_LEN(callees); i < n; ++i) {
+		function_vars_t *const fun = get_function_vars(callees[i]);
+		if (pn < fun->n_results)
+			add_constraint(C_COPY, var, fun->results[pn]);
+	}
+	if (unknown) {
+		ir_entity *const callee = get_Call_callee(call);
+		if (callee != NULL
+		    && (get_entity_additional_properties(callee) & mtp_property_malloc))
+			add_addr(var, get_site_object(call));
+		else
+			add_unknown(var);
+	}
+	DEL_ARR_F(callees);
+}
+
+static void generate_proj(ir_node *proj)
+{
+	unsigned const var  = get_node_var(proj);
+	ir_node *const pred = get_Proj_pred(proj);
+	unsigned const pn   = get_Proj_num(proj);
+	if (var == NO_VAR)
+		return;
+
+	switch (get_irn_opcode(pred)) {
+	case iro_Load:
+		if (pn == pn_Load_res)
+			add_constraint(C_LOAD, var, get_node_var(get_Load_ptr(pred)));
+		return;
+	case iro_Start:
+		if (pn == pn_Start_P_frame_base) {
+			ir_graph *const irg = get_irn_irg(proj);
+			add_addr(var, get_site_object(get_irg_start(irg)));
+			return;
+		}
+		break;
+	case iro_Alloc:
+		if (pn == pn_Alloc_res) {
+			add_addr(var, get_site_object(pred));
+			return;
+		}
+		break;
+	case iro_Proj: {
+		ir_node *const pred_pred = get_Proj_pred(pred);
+		if (is_Start(pred_pred) && get_Proj_num(pred) == pn_Start_T_args) {
+			ir_entity       *const entity = get_irg_entity(get_irn_irg(proj));
+			function_vars_t *const fun    = get_function_vars(entity);
+			if (pn < fun->n_params) {
+				add_constraint(C_COPY, var, fun->params[pn]);
+				return;
+			}
+		} else if (is_Call(pred_pred) && get_Proj_num(pred) == pn_Call_T_result) {
+			generate_call_result(proj, pred_pred);
+			return;
+		}
+		break;
+	}
+	default:
+		break;
+	}
+	/* results of Builtins, ASM and the like */
+	if (mode_is_reference(get_irn_mode(proj)))
+		add_unknown(var);
+}
+
+static void generate_conv(ir_node *node, ir_node *op)
+{
+	unsigned const var      = get_node_var(node);
+	ir_mode *const mode     = get_irn_mode(node);
+	ir_mode *const op_mode  = get_irn_mode(op);
+	unsigned const op_var   = get_node_var(op);
+	if (mode_is_reference(op_mode) && !mode_is_reference(mode)) {
+		/* the integer may be turned back into a pointer after arbitrary
+		 * arithmetic */
+		add_escape(op_var);
+		add_unknown(var);
+	} else if (mode_is_reference(mode) && !mode_is_reference(op_mode)) {
+		add_unknown(var);
+	} else {
+		add_constraint(C_COPY, var, op_var);
+	}
+}
+
+static void generate_member(ir_node *node)
+{
+	unsigned   const var    = get_node_var(node);
+	ir_node   *const ptr    = get_Member_ptr(node);
+	ir_entity *const entity = get_Member_entity(node);
+	ir_graph  *const irg    = get_irn_irg(node);
+	if (ptr == get_irg_frame(irg)) {
+		add_addr(var, get_entity_object(entity));
+	} else if (is_Union_type(get_entity_owner(entity))
+	           || get_entity_bitfield_size(entity) != 0) {
+		/* overlapping members */
+		add_constraint(C_COPY, var, get_node_var(ptr));
+	} else {
+		add_field(var, get_node_var(ptr), entity);
+	}
+}
+
+/**
+ * Pointer arithmetic stays within the object (or C would be undefined), but
+ * integers may be reassembled from pointer bytes.
+ */
+static void generate_arith(ir_node *node)
+{
+	ir_mode *const mode = get_irn_mode(node);
+	unsigned const var  = get_node_var(node);
+	if (var == NO_VAR)
+		return;
+	if (mode_is_reference(mode) && !is_Add(node) && !is_Sub(node)) {
+		/* unexpected pointer producing nodes */
+		add_unknown(var);
+		return;
+	}
+	foreach_irn_in(node, i, pred) {
+		add_constraint(C_ARITH, var, get_node_var(pred));
+	}
+}
+
+static void generate_node(ir_node *node, void *env)
+{
+	(void)env;
+	switch (get_irn_opcode(node)) {
+	case iro_Address: {
+		ir_entity *const entity = get_Address_entity(node);
+		add_addr(get_node_var(node), get_entity_object(entity));
+		return;
+	}
+	case iro_Member:
+		generate_member(node);
+		return;
+	case iro_Sel:
+		add_constraint(C_COPY, get_node_var(node), get_node_var(get_Sel_ptr(node)));
+		return;
+	case iro_Phi: {
+		unsigned const var = get_node_var(node);
+		foreach_irn_in(node, i, pred) {
+			add_constraint(C_COPY, var, get_node_var(pred));
+		}
+		return;
+	}
+	case iro_Mux: {
+		unsigned const var = get_node_var(node);
+		add_constraint(C_COPY, var, get_node_var(get_Mux_true(node)));
+		add_constraint(C_COPY, var, get_node_var(get_Mux_false(node)));
+		return;
+	}
+	case iro_Confirm:
+		add_constraint(C_COPY, get_node_var(node), get_node_var(get_Confirm_value(node)));
+		return;
+	case iro_Conv:
+		generate_conv(node, get_Conv_op(node));
+		return;
+	case iro_Bitcast:
+		generate_conv(node, get_Bitcast_op(node));
+		return;
+	case iro_Const:
+		if (mode_is_reference(get_irn_mode(node))
+		    && !tarval_is_null(get_Const_tarval(node)))
+			add_unknown(get_node_var(node));
+		return;
+	case iro_Proj:
+		generate_proj(node);
+		return;
+	case iro_Store:
+		add_constraint(C_STORE, get_node_var(get_Store_ptr(node)),
+		               get_node_var(get_Store_value(node)));
+		return;
+	case iro_CopyB: {
+		unsigned const tmp = new_var();
+		add_constraint(C_LOAD, tmp, get_node_var(get_CopyB_src(node)));
+		add_constraint(C_STORE, get_node_var(get_CopyB_dst(node)), tmp);
+		return;
+	}
+	case iro_Call:
+		generate_call(node);
+		return;
+	case iro_Return: {
+		ir_entity       *const entity = get_irg_entity(get_irn_irg(node));
+		function_vars_t *const fun    = get_function_vars(entity);
+		for (size_t i = 0, n = get_Return_n_ress(node); i < n && i < fun->n_results; ++i) {
+			add_constraint(C_COPY, fun->results[i], get_node_var(get_Return_res(node, i)));
+		}
+		return;
+	}
+	case iro_ASM:
+	case iro_Builtin:
+	case iro_Raise:
+		/* pointers passed to unknown code */
+		foreach_irn_in(node, i, pred) {
+			if (mode_is_reference(get_irn_mode(pred)))
+				add_escape(get_node_var(pred));
+		}
+		return;
+	case iro_Load:
+	case iro_Alloc:
+	case iro_Start:
+	case iro_Unknown:
+	case iro_Dummy:
+	case iro_Bad:
+		return;
+	default:
+		generate_arith(node);
+		return;
+	}
+}
+
+/** Adds the objects referenced by the constant @p value to @p var. */
+static void generate_const_value(unsigned var, ir_node *value)
+{
+	if (is_Address(value)) {
+		add_addr(var, get_entity_object(get_Address_entity(value)));
+		return;
+	}
+	foreach_irn_in(value, i, pred) {
+		generate_const_value(var, pred);
+	}
+}
+
+static void generate_initializer(unsigned var, const ir_initializer_t *init)
+{
+	switch (get_initializer_kind(init)) {
+	case IR_INITIALIZER_CONST:
+		generate_const_value(var, get_initializer_const_value(init));
+		return;
+	case IR_INITIALIZER_COMPOUND:
+		for (size_t i = 0, n = get_initializer_compound_n_entries(init); i < n; ++i) {
+			generate_initializer(var, get_initializer_compound_value(init, i));
+		}
+		return;
+	case IR_INITIALIZER_TARVAL:
+	case IR_INITIALIZER_NULL:
+		return;
+	}
+	panic("invalid initializer");
+}
+
+/** Generates the constraints for global and thread local entities. */
+static void generate_globals(void)
+{
+	for (ir_segment_t s = IR_SEGMENT_FIRST; s <= IR_SEGMENT_LAST; ++s) {
+		ir_type *const type = get_segment_type(s);
+		for (size_t i = 0, n = get_compound_n_members(type); i < n; ++i) {
+			ir_entity *const entity = get_compound_member(type, i);
+			if (is_method_entity(entity))
+				continue;
+
+			unsigned const addr = new_var();
+			add_addr(addr, get_entity_object(entity));
+			if (entity_is_externally_visible(entity))
+				add_escape(addr);
+
+			unsigned const contents = new_var();
+			add_constraint(C_STORE, addr, contents);
+			if (get_entity_kind(entity) != IR_ENTITY_NORMAL)
+				continue;
+			ir_initializer_t const *const init = get_entity_initializer(entity);
+			if (init != NULL)
+				generate_initializer(contents, init);
+		}
+	}
+}
+
+static void generate_irg(ir_graph *irg)
+{
+	irg->n_points_to = get_irg_last_idx(irg);
+	irg->points_to   = XMALLOCNZ(unsigned, irg->n_points_to);
+
+	irg_walk_graph(irg, NULL, generate_node, NULL);
+
+	ir_entity       *const entity = get_irg_entity(irg);
+	function_vars_t *const fun    = get_function_vars(entity);
+
+	/* parameters in the frame start with the passed values */
+	ir_type *const frame = get_irg_frame_type(irg);
+	for (size_t i = 0, n = get_compound_n_members(frame); i < n; ++i) {
+		ir_entity *const member = get_compound_member(frame, i);
+		if (!is_parameter_entity(member))
+			continue;
+		unsigned const addr = new_var();
+		size_t   const num  = get_entity_parameter_number(member);
+		add_addr(addr, get_entity_object(member));
+		add_constraint(C_STORE, addr, num < fun->n_params ? fun->params[num]
+		                                                  : pts.unknown_val);
+	}
+
+	/* functions called from unknown code */
+	if (entity_is_externally_visible(entity)
+	    || (get_entity_usage(entity) & ir_usage_address_taken)) {
+		for (size_t i = 0; i < fun->n_params; ++i)
+			add_unknown(fun->params[i]);
+		for (size_t i = 0; i < fun->n_results; ++i)
+			add_escape(fun->results[i]);
+	}
+}
+
+/*
+ * Unification solver.
+ */
+
+static unsigned uni_find(unsigned var)
+{
+	return uf_find(pts.uf, var);
+}
+
+static void uni_join(unsigned a, unsigned b)
+{
+	unsigned *stack = NEW_ARR_F(unsigned, 0);
+	for (;;) {
+		a = uni_find(a);
+		b = uni_find(b);
+		if (a != b) {
+			unsigned const pa = pts.vars[a].pointee;
+			unsigned const pb = pts.vars[b].pointee;
+			unsigned const r  = uf_union(pts.uf, a, b);
+			pts.vars[r].pointee = pa != NO_VAR ? pa : pb;
+			if (pa != NO_VAR && pb != NO_VAR) {
+				ARR_APP1(unsigned, stack, pa);
+				ARR_APP1(unsigned, stack, pb);
+			}
+		}
+		size_t const len = ARR_LEN(stack);
+		if (len == 0)
+			break;
+		a = stack[len - 2];
+		b = stack[len - 1];
+		ARR_SHRINKLEN(stack, len - 2);
+	}
+	DEL_ARR_F(stack);
+}
+
+/** Returns the pointee of @p var, creating it if necessary. */
+static unsigned uni_pointee(unsigned var)
+{
+	unsigned const r = uni_find(var);
+	if (pts.vars[r].pointee == NO_VAR) {
+		unsigned const pointee = new_var();
+		pts.vars[uni_find(var)].pointee = pointee;
+	}
+	return uni_find(pts.vars[uni_find(var)].pointee);
+}
+
+static void solve_unification(void)
+{
+	for (size_t i = 0, n = ARR_LEN(pts.constraints); i < n; ++i) {
+		constraint_t const *const c = &pts.constraints[i];
+		switch (c->kind) {
+		case C_ADDR:
+			uni_join(uni_pointee(c->dst), pts.objects[c->src].loc);
+			break;
+		case C_COPY:
+		case C_FIELD:
+		case C_ARITH:
+			uni_join(uni_pointee(c->dst), uni_pointee(c->src));
+			break;
+		case C_LOAD:
+			uni_join(uni_pointee(c->dst), uni_pointee(uni_pointee(c->src)));
+			break;
+		case C_STORE:
+			uni_join(uni_pointee(uni_pointee(c->dst)), uni_pointee(c->src));
+			break;
+		case C_ESCAPED:
+			/* implicit: unknown memory is unified with its contents */
+			break;
+		}
+	}
+}
+
+/*
+ * Inclusion solver.
+ */
+
+static void incl_queue(unsigned var)
+{
+	if (!pts.vars[var].queued) {
+		pts.vars[var].queued = true;
+		ARR_APP1(unsigned, pts.worklist, var);
+	}
+}
+
+static bool incl_insert(unsigned var, unsigned obj)
+{
+	pts_var_t *const v = &pts.vars[var];
+	if (v->pts == NULL)
+		v->pts = NEW_ARR_F(unsigned, 0);
+	size_t lo = 0;
+	size_t hi = ARR_LEN(v->pts);
+	while (lo < hi) {
+		size_t const mid = (lo + hi) / 2;
+		if (v->pts[mid] < obj)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < ARR_LEN(v->pts) && v->pts[lo] == obj)
+		return false;
+	ARR_APP1(unsigned, v->pts, obj);
+	memmove(&v->pts[lo + 1], &v->pts[lo], (ARR_LEN(v->pts) - lo - 1) * sizeof(*v->pts));
+	v->pts[lo] = obj;
+	incl_queue(var);
+	return true;
+}
+
+/** Adds the points-to set of @p src to @p dst. */
+static void incl_union(unsigned dst, unsigned src)
+{
+	unsigned const *const src_pts = pts.vars[src].pts;
+	if (src_pts == NULL || dst == src)
+		return;
+	unsigned const *const dst_pts = pts.vars[dst].pts;
+	size_t const n_src = ARR_LEN(src_pts);
+	size_t const n_dst = dst_pts != NULL ? ARR_LEN(dst_pts) : 0;
+
+	/* merge both sorted sets */
+	unsigned *const merged  = NEW_ARR_F(unsigned, n_src + n_dst);
+	size_t          n       = 0;
+	size_t          i       = 0;
+	size_t          j       = 0;
+	while (i < n_src || j < n_dst) {
+		if (j == n_dst || (i < n_src && src_pts[i] < dst_pts[j])) {
+			merged[n++] = src_pts[i++];
+		} else {
+			if (i < n_src && src_pts[i] == dst_pts[j])
+				++i;
+			merged[n++] = dst_pts[j++];
+		}
+	}
+	if (n == n_dst) {
+		DEL_ARR_F(merged);
+		return;
+	}
+	ARR_SHRINKLEN(merged, n);
+	if (dst_pts != NULL)
+		DEL_ARR_F(pts.vars[dst].pts);
+	pts.vars[dst].pts = merged;
+	incl_queue(dst);
+}
+
+static int cmp_edge(const void *a, const void *b, size_t size)
+{
+	(void)size;
+	const pts_edge_t *ea = (const pts_edge_t*)a;
+	const pts_edge_t *eb = (const pts_edge_t*)b;
+	return ea->src != eb->src || ea->dst != eb->dst;
+}
+
+static void incl_add_edge(unsigned src, unsigned dst)
+{
+	if (src == dst)
+		return;
+	pts_edge_t const edge = { .src = src, .dst = dst };
+	unsigned   const hash = hash_combine(src, dst);
+	if (set_find(pts_edge_t, pts.edges, &edge, sizeof(edge), hash) != NULL)
+		return;
+	(void)set_insert(pts_edge_t, pts.edges, &edge, sizeof(edge), hash);
+
+	pts_var_t *const v = &pts.vars[src];
+	if (v->succs == NULL)
+		v->succs = NEW_ARR_F(unsigned, 0);
+	ARR_APP1(unsigned, v->succs, dst);
+	incl_union(dst, src);
+}
+
+static unsigned incl_field_object(unsigned obj, ir_entity *field)
+{
+	if (obj == pts.unknown)
+		return obj;
+	for (unsigned f = pts.objects[obj].first_field; f != NO_OBJECT;
+	     f = pts.objects[f].next_field) {
+		if (pts.objects[f].field == field)
+			return f;
+	}
+
+	unsigned const f = new_object(obj, field);
+	pts.objects[f].next_field   = pts.objects[obj].first_field;
+	pts.objects[obj].first_field = f;
+	incl_add_edge(pts.objects[f].own, pts.objects[f].all);
+	incl_add_edge(pts.objects[f].all, pts.objects[obj].all);
+	return f;
+}
+
+static void incl_apply(const constraint_t *c, unsigned obj)
+{
+	pts_object_t const *const o = &pts.objects[obj];
+	switch (c->kind) {
+	case C_LOAD:
+		/* a field contains what was stored into its enclosing objects */
+		incl_add_edge(o->all, c->dst);
+		for (unsigned p = o->parent; p != NO_OBJECT; p = pts.objects[p].parent)
+			incl_add_edge(pts.objects[p].own, c->dst);
+		return;
+	case C_STORE:
+		incl_add_edge(c->src, o->own);
+		return;
+	case C_FIELD:
+		incl_insert(c->dst, incl_field_object(obj, c->field));
+		return;
+	case C_ARITH:
+		incl_insert(c->dst, o->root);
+		return;
+	case C_ESCAPED:
+		/* unknown code may access the whole object and everything reachable
+		 * from it */
+		incl_insert(pts.unknown_ptr, o->root);
+		return;
+	case C_ADDR:
+	case C_COPY:
+		break;
+	}
+	panic("invalid complex constraint");
+}
+
+static void solve_inclusion(void)
+{
+	pts.edges    = new_set(cmp_edge, 64);
+	pts.worklist = NEW_ARR_F(unsigned, 0);
+
+	for (size_t i = 0, n = ARR_LEN(pts.objects); i < n; ++i)
+		incl_add_edge(pts.objects[i].own, pts.objects[i].all);
+
+	constraint_t const escaped = {
+		.kind = C_ESCAPED, .src = pts.objects[pts.unknown].own
+	};
+	ARR_APP1(constraint_t, pts.constraints, escaped);
+
+	for (size_t i = 0, n = ARR_LEN(pts.constraints); i < n; ++i) {
+		constraint_t const *const c = &pts.constraints[i];
+		switch (c->kind) {
+		case C_ADDR:
+			incl_insert(c->dst, c->src);
+			break;
+		case C_COPY:
+			incl_add_edge(c->src, c->dst);
+			break;
+		case C_STORE: {
+			pts_var_t *const v = &pts.vars[c->dst];
+			if (v->complex == NULL)
+				v->complex = NEW_ARR_F(unsigned, 0);
+			ARR_APP1(unsigned, v->complex, i);
+			incl_queue(c->dst);
+			break;
+		}
+		case C_LOAD:
+		case C_FIELD:
+		case C_ARITH:
+		case C_ESCAPED: {
+			pts_var_t *const v = &pts.vars[c->src];
+			if (v->complex == NULL)
+				v->complex = NEW_ARR_F(unsigned, 0);
+			ARR_APP1(unsigned, v->complex, i);
+			incl_queue(c->src);
+			break;
+		}
+		}
+	}
+
+	while (ARR_LEN(pts.worklist) > 0) {
+		size_t   const last = ARR_LEN(pts.worklist) - 1;
+		unsigned const var  = pts.worklist[last];
+		ARR_SHRINKLEN(pts.worklist, last);
+		pts.vars[var].queued = false;
+
+		/* complex constraints may add objects to the set of var, so always
+		 * access it through pts.vars */
+		if (pts.vars[var].complex != NULL && pts.vars[var].pts != NULL) {
+			for (size_t c = 0; c < ARR_LEN(pts.vars[var].complex); ++c) {
+				constraint_t const *const constraint
+					= &pts.constraints[pts.vars[var].complex[c]];
+				for (size_t o = 0; o < ARR_LEN(pts.vars[var].pts); ++o)
+					incl_apply(constraint, pts.vars[var].pts[o]);
+			}
+		}
+		if (pts.vars[var].succs != NULL) {
+			for (size_t s = 0; s < ARR_LEN(pts.vars[var].succs); ++s)
+				incl_union(pts.vars[var].succs[s], var);
+		}
+	}
+
+	DEL_ARR_F(pts.worklist);
+	del_set(pts.edges);
+	for (size_t i = 0, n = ARR_LEN(pts.vars); i < n; ++i) {
+		pts_var_t *const v = &pts.vars[i];
+		if (v->succs != NULL)
+			DEL_ARR_F(v->succs);
+		if (v->complex != NULL)
+			DEL_ARR_F(v->complex);
+		v->succs   = NULL;
+		v->complex = NULL;
+	}
+}
+
+/**
+ * Forgets the points-to variable of @p node, because its value may
+ * change. Cached alias relations may depend on it, so they are dropped too.
+ */
+static void forget_node(ir_node *node)
+{
+	ir_graph *const irg = get_irn_irg(node);
+	unsigned  const idx = get_irn_idx(node);
+	if (irg == pts.copied_irg || idx >= irg->n_points_to
+	    || irg->points_to[idx] == NO_VAR)
+		return;
+	DB((dbg, LEVEL_2, "forget points-to variable of %+F\n", node));
+	irg->points_to[idx] = NO_VAR;
+	free_irg_alias_cache(irg);
+}
+
+static void forget_set_irn_n(void *ctx, ir_node *src, int pos, ir_node *tgt,
+                             ir_node *old_tgt)
+{
+	(void)ctx;
+	/* moving a node into another block does not change its value */
+	if (pos != -1 && tgt != old_tgt)
+		forget_node(src);
+}
+
+static void forget_set_irn_in(void *ctx, ir_node *node)
+{
+	(void)ctx;
+	forget_node(node);
+}
+
+static void forget_replaced(void *ctx, ir_node *old_node, ir_node *new_node)
+{
+	(void)ctx;
+	(void)new_node;
+	forget_node(old_node);
+}
+
+/** Dead node elimination carries the variables over to the copied nodes. */
+static void track_dead_node_elim(void *ctx, ir_graph *irg, int start)
+{
+	(void)ctx;
+	pts.copied_irg = start ? irg : NULL;
+}
+
+static void register_forget_hooks(void)
+{
+	pts.hooks[0].hook._hook_set_irn_n = forget_set_irn_n;
+	register_hook(hook_set_irn_n, &pts.hooks[0]);
+	pts.hooks[1].hook._hook_set_irn_in = forget_set_irn_in;
+	register_hook(hook_set_irn_in, &pts.hooks[1]);
+	pts.hooks[2].hook._hook_replace = forget_replaced;
+	register_hook(hook_replace, &pts.hooks[2]);
+	pts.hooks[3].hook._hook_dead_node_elim = track_dead_node_elim;
+	register_hook(hook_dead_node_elim, &pts.hooks[3]);
+}
+
+static void unregister_forget_hooks(void)
+{
+	unregister_hook(hook_dead_node_elim, &pts.hooks[3]);
+	unregister_hook(hook_replace, &pts.hooks[2]);
+	unregister_hook(hook_set_irn_in, &pts.hooks[1]);
+	unregister_hook(hook_set_irn_n, &pts.hooks[0]);
+}
+
+void compute_irp_points_to(ir_points_to_kind kind)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.ana.pointsto");
+	free_irp_points_to();
+	assure_irp_globals_entity_usage_computed();
+	foreach_irp_irg(i, irg) {
+		free_irg_alias_cache(irg);
+	}
+
+	stat_ev_ctx_push_str("points_to", kind == ir_points_to_inclusion
+	                                  ? "inclusion" : "unification");
+	stat_ev_tim_push();
+
+	pts.kind           = kind;
+	pts.vars           = NEW_ARR_F(pts_var_t, 0);
+	pts.uf             = NEW_ARR_F(int, 0);
+	pts.objects        = NEW_ARR_F(pts_object_t, 0);
+	pts.constraints    = NEW_ARR_F(constraint_t, 0);
+	pts.entity_objects = pmap_create();
+	pts.site_objects   = pmap_create();
+	pts.functions      = pmap_create();
+	obstack_init(&pts.obst);
+
+	/* variable numbers start at 1, NO_VAR is 0 */
+	(void)new_var();
+
+	/* unknown memory contains pointers to itself */
+	pts.unknown     = new_object(NO_OBJECT, NULL);
+	pts.unknown_ptr = new_var();
+	pts.unknown_val = new_var();
+	add_addr(pts.unknown_ptr, pts.unknown);
+	add_constraint(C_STORE, pts.unknown_ptr, pts.unknown_ptr);
+	add_constraint(C_COPY, pts.unknown_val, pts.unknown_ptr);
+	add_constraint(C_LOAD, pts.unknown_val, pts.unknown_ptr);
+
+	foreach_irp_irg(i, irg) {
+		create_function_vars(irg);
+	}
+	generate_globals();
+	foreach_irp_irg(i, irg) {
+		generate_irg(irg);
+	}
+	size_t const n_constraints = ARR_LEN(pts.constraints);
+
+	if (kind == ir_points_to_inclusion)
+		solve_inclusion();
+	else
+		solve_unification();
+
+	DB((dbg, LEVEL_1, "points-to: %zu variables, %zu objects, %zu constraints\n",
+	    ARR_LEN(pts.vars), ARR_LEN(pts.objects), n_constraints));
+
+	DEL_ARR_F(pts.constraints);
+	pts.constraints = NULL;
+	pmap_destroy(pts.functions);
+	pmap_destroy(pts.site_objects);
+	pmap_destroy(pts.entity_objects);
+	obstack_free(&pts.obst, NULL);
+	pts.computed = true;
+	register_forget_hooks();
+
+	stat_ev_tim_pop("points_to_time");
+	stat_ev_int("points_to_vars", ARR_LEN(pts.vars));
+	stat_ev_int("points_to_objects", ARR_LEN(pts.objects));
+	stat_ev_int("points_to_constraints", n_constraints);
+	stat_ev_ctx_pop("points_to");
+}
+
+void free_irg_points_to(ir_graph *irg)
+{
+	free(irg->points_to);
+	irg->points_to   = NULL;
+	irg->n_points_to = 0;
+}
+
+void free_irp_points_to(void)
+{
+	if (!pts.computed)
+		return;
+
+	unregister_forget_hooks();
+	foreach_irp_irg(i, irg) {
+		free_irg_points_to(irg);
+		free_irg_alias_cache(irg);
+	}
+	for (size_t i = 0, n = ARR_LEN(pts.vars); i < n; ++i) {
+		if (pts.vars[i].pts != NULL)
+			DEL_ARR_F(pts.vars[i].pts);
+	}
+	DEL_ARR_F(pts.objects);
+	DEL_ARR_F(pts.uf);
+	DEL_ARR_F(pts.vars);
+	pts.computed = false;
+}
+
+/** Returns true if @p a is @p b or one of its enclosing objects. */
+static bool is_ancestor_or_self(unsigned a, unsigned b)
+{
+	for (; b != NO_OBJECT; b = pts.objects[b].parent) {
+		if (a == b)
+			return true;
+	}
+	return false;
+}
+
+static bool incl_overlap(const unsigned *pts1, const unsigned *pts2)
+{
+	if (pts1 == NULL || pts2 == NULL)
+		return false;
+	for (size_t i = 0, n1 = ARR_LEN(pts1); i < n1; ++i) {
+		unsigned const a = pts1[i];
+		for (size_t j = 0, n2 = ARR_LEN(pts2); j < n2; ++j) {
+			unsigned const b = pts2[j];
+			if (pts.objects[a].root == pts.objects[b].root
+			    && (is_ancestor_or_self(a, b) || is_ancestor_or_self(b, a)))
+				return true;
+		}
+	}
+	return false;
+}
+
+static unsigned get_analysed_var(const ir_node *node)
+{
+	ir_graph *const irg = get_irn_irg(node);
+	unsigned  const idx = get_irn_idx(node);
+	if (idx >= irg->n_points_to)
+		return NO_VAR;
+	return irg->points_to[idx];
+}
+
+ir_alias_relation get_points_to_relation(const ir_node *addr1,
+                                         const ir_node *addr2)
+{
+	if (!pts.computed)
+		return ir_may_alias;
+	unsigned const var1 = get_analysed_var(addr1);
+	unsigned const var2 = get_analysed_var(addr2);
+	if (var1 == NO_VAR || var2 == NO_VAR)
+		return ir_may_alias;
+
+	bool overlap;
+	if (pts.kind == ir_points_to_inclusion) {
+		overlap = incl_overlap(pts.vars[var1].pts, pts.vars[var2].pts);
+	} else {
+		/* pointers without pointee are null or uninitialized */
+		unsigned const pointee1 = pts.vars[uni_find(var1)].pointee;
+		unsigned const pointee2 = pts.vars[uni_find(var2)].pointee;
+		overlap = pointee1 != NO_VAR && pointee2 != NO_VAR
+		       && uni_find(pointee1) == uni_find(pointee2);
+	}
+	DB((dbg, LEVEL_2, "points-to(%+F, %+F) = %s\n", addr1, addr2,
+	    overlap ? "overlap" : "disjoint"));
+	return overlap ? ir_may_alias : ir_no_alias;
+}
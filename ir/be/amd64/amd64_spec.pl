@@ -691,4 +691,123 @@ haddpd => {
 	emit     => "haddpd %AM",
 },
 
+# Packed operations on vector modes
+
+pshufd_0 => {
+	irn_flags => [ "rematerializable" ],
+	in_reqs   => [ "xmm" ],
+	out_reqs  => [ "xmm" ],
+	ins       => [ "operand" ],
+	outs      => [ "res" ],
+	attr_type => "amd64_addr_attr_t",
+	attr      => "amd64_insn_mode_t insn_mode, amd64_op_mode_t op_mode, amd64_addr_t addr",
+	emit      => "pshufd \$0, %^S0, %^D0",
+	mode      => $mode_xmm,
+},
+
+shufps_0 => {
+	template => $binopx,
+	emit     => "shufps \$0, %AM",
+},
+
+punpcklbw => {
+	template => $binopx,
+	emit     => "punpcklbw %AM",
+},
+
+punpcklwd => {
+	template => $binopx,
+	emit     => "punpcklwd %AM",
+},
+
+punpcklqdq => {
+	template => $binopx,
+	emit     => "punpcklqdq %AM",
+},
+
+unpcklpd => {
+	template => $binopx,
+	emit     => "unpcklpd %AM",
+},
+
+paddb => {
+	template => $binopx_commutative,
+	emit     => "paddb %AM",
+},
+
+paddw => {
+	template => $binopx_commutative,
+	emit     => "paddw %AM",
+},
+
+paddd => {
+	template => $binopx_commutative,
+	emit     => "paddd %AM",
+},
+
+paddq => {
+	template => $binopx_commutative,
+	emit     => "paddq %AM",
+},
+
+psubb => {
+	template => $binopx,
+	emit     => "psubb %AM",
+},
+
+psubw => {
+	template => $binopx,
+	emit     => "psubw %AM",
+},
+
+psubd => {
+	template => $binopx,
+	emit     => "psubd %AM",
+},
+
+psubq => {
+	template => $binopx,
+	emit     => "psubq %AM",
+},
+
+pand => {
+	template => $binopx_commutative,
+	emit     => "pand %AM",
+},
+
+por => {
+	template => $binopx_commutative,
+	emit     => "por %AM",
+},
+
+pxor => {
+	template => $binopx_commutative,
+	emit     => "pxor %AM",
+},
+
+addps => {
+	template => $binopx_commutative,
+	emit     => "addps %AM",
+},
+
+addpd => {
+	template => $binopx_commutative,
+	emit     => "addpd %AM",
+},
+
+subps => {
+	template => $binopx,
+	emit     => "subps %AM",
+},
+
+mulps => {
+	template => $binopx_commutative,
+	emit     => "mulps %AM",
+},
+
+mulpd => {
+	template => $binopx_commutative,
+	emit     => "mulpd %AM",
+},
+
 );
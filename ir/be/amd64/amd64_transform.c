@@ -440,6 +440,7 @@ typedef ir_node *(*construct_rax_binop_func)(dbg_info *dbgi, ir_node *block,
 	amd64_op_mode_t op_mode, amd64_addr_t addr);
 
 typedef enum match_flags_t {
+	match_none         = 0,
 	match_am           = 1 << 0,
 	match_mode_neutral = 1 << 1,
 	match_immediate    = 1 << 2,
@@ -855,6 +856,48 @@ static ir_node *gen_binop_xmm(ir_node *node, ir_node *op0, ir_node *op1,
 	return new_r_Proj(new_node, amd64_mode_xmm, pn_amd64_subs_res);
 }
 
+/**
+ * Creates a packed SSE operation for a binop of a vector mode. The operands
+ * are always in registers as packed memory operands must be aligned.
+ */
+static ir_node *gen_vector_binop(ir_node *node)
+{
+	ir_mode *mode    = get_irn_mode(node);
+	ir_mode *element = get_mode_vector_element(mode);
+	unsigned bits    = get_mode_size_bits(element);
+	bool     is_int  = mode_is_int(element);
+
+	construct_binop_func func;
+	switch (get_irn_opcode(node)) {
+	case iro_Add:
+		func = !is_int   ? (bits == 32 ? new_bd_amd64_addps : new_bd_amd64_addpd)
+		     : bits ==  8 ? new_bd_amd64_paddb
+		     : bits == 16 ? new_bd_amd64_paddw
+		     : bits == 32 ? new_bd_amd64_paddd
+		     :              new_bd_amd64_paddq;
+		break;
+	case iro_Sub:
+		func = !is_int   ? (bits == 32 ? new_bd_amd64_subps : new_bd_amd64_subpd)
+		     : bits ==  8 ? new_bd_amd64_psubb
+		     : bits == 16 ? new_bd_amd64_psubw
+		     : bits == 32 ? new_bd_amd64_psubd
+		     :              new_bd_amd64_psubq;
+		break;
+	case iro_Mul:
+		if (is_int)
+			panic("packed integer multiplication not supported");
+		func = bits == 32 ? new_bd_amd64_mulps : new_bd_amd64_mulpd;
+		break;
+	case iro_And: func = new_bd_amd64_pand; break;
+	case iro_Or:  func = new_bd_amd64_por;  break;
+	case iro_Eor: func = new_bd_amd64_pxor; break;
+	default:
+		panic("unexpected vector operation %+F", node);
+	}
+	return gen_binop_xmm(node, get_binop_left(node), get_binop_right(node),
+	                     func, match_none);
+}
+
 typedef ir_node *(*construct_shift_func)(dbg_info *dbgi, ir_node *block,
 	int arity, ir_node *in[], const amd64_shift_attr_t *attr_init);
 
@@ -963,6 +1006,8 @@ static ir_node *gen_Add(ir_node *const node)
 	ir_node *block = get_nodes_block(node);
 	ir_node *load, *op;
 
+	if (mode_is_vector(mode))
+		return gen_vector_binop(node);
 	if (mode_is_float(mode)) {
 		return gen_binop_am(node, op1, op2, new_bd_amd64_adds,
 							pn_amd64_adds_res, match_commutative | match_am);
@@ -987,6 +1032,8 @@ static ir_node *gen_Sub(ir_node *const node)
 	ir_node  *const op2     = get_Sub_right(node);
 	ir_mode  *const mode    = get_irn_mode(node);
 
+	if (mode_is_vector(mode))
+		return gen_vector_binop(node);
 	if (mode_is_float(mode)) {
 		return gen_binop_am(node, op1, op2, new_bd_amd64_subs,
 		                    pn_amd64_subs_res, match_am);
@@ -1002,6 +1049,8 @@ static ir_node *gen_And(ir_node *const node)
 {
 	ir_node *op1 = get_And_left(node);
 	ir_node *op2 = get_And_right(node);
+	if (mode_is_vector(get_irn_mode(node)))
+		return gen_vector_binop(node);
 	return gen_binop_am(node, op1, op2, new_bd_amd64_and, pn_amd64_and_res,
 	                    match_immediate | match_am | match_mode_neutral
 	                    | match_commutative);
@@ -1011,6 +1060,8 @@ static ir_node *gen_Eor(ir_node *const node)
 {
 	ir_node *op1 = get_Eor_left(node);
 	ir_node *op2 = get_Eor_right(node);
+	if (mode_is_vector(get_irn_mode(node)))
+		return gen_vector_binop(node);
 	return gen_binop_am(node, op1, op2, new_bd_amd64_xor, pn_amd64_xor_res,
 	                    match_immediate | match_am | match_mode_neutral
 	                    | match_commutative);
@@ -1020,6 +1071,8 @@ static ir_node *gen_Or(ir_node *const node)
 {
 	ir_node *op1 = get_Or_left(node);
 	ir_node *op2 = get_Or_right(node);
+	if (mode_is_vector(get_irn_mode(node)))
+		return gen_vector_binop(node);
 	return gen_binop_am(node, op1, op2, new_bd_amd64_or, pn_amd64_or_res,
 	                    match_immediate | match_am | match_mode_neutral
 	                    | match_commutative);
@@ -1031,6 +1084,8 @@ static ir_node *gen_Mul(ir_node *const node)
 	ir_node *op2  = get_Mul_right(node);
 	ir_mode *mode = get_irn_mode(node);
 
+	if (mode_is_vector(mode))
+		return gen_vector_binop(node);
 	if (get_mode_size_bits(mode) < 16) {
 		/* imulb only supports rax - reg form */
 		ir_node *new_node =
@@ -1960,7 +2015,7 @@ static ir_node *gen_Phi(ir_node *node)
 	if (mode_needs_gp_reg(mode)) {
 		/* all integer operations are on 64bit registers now */
 		req = amd64_reg_classes[CLASS_amd64_gp].class_req;
-	} else if (mode_is_float(mode)) {
+	} else if (mode_is_float(mode) || mode_is_vector(mode)) {
 		req = amd64_reg_classes[CLASS_amd64_xmm].class_req;
 	} else {
 		req = arch_no_register_req;
@@ -2227,7 +2282,7 @@ static ir_node *gen_Store(ir_node *node)
 	ir_node *ptr     = get_Store_ptr(node);
 	perform_address_matching(ptr, &arity, in, addr);
 
-	bool const need_xmm = mode_is_float(mode);
+	bool const need_xmm = mode_is_float(mode) || mode_is_vector(mode);
 
 	arch_register_req_t const **const reqs = (need_xmm ? xmm_am_reqs : gp_am_reqs)[arity];
 
@@ -2238,7 +2293,9 @@ static ir_node *gen_Store(ir_node *node)
 	attr.base.insn_mode = get_insn_mode_from_mode(mode);
 
 	ir_node *new_store;
-	if (need_xmm) {
+	if (mode_is_vector(mode)) {
+		new_store = new_bd_amd64_movdqu_store(dbgi, block, arity, in, &attr);
+	} else if (need_xmm) {
 		new_store = new_bd_amd64_movs_store_xmm(dbgi, block, arity, in, &attr);
 	} else {
 		new_store = new_bd_amd64_mov_store(dbgi, block, arity, in, &attr);
@@ -2348,7 +2405,10 @@ static ir_node *gen_Load(ir_node *node)
 	amd64_insn_mode_t insn_mode = get_insn_mode_from_mode(mode);
 	ir_node  *new_load;
 
-	if (mode_is_float(mode)) {
+	if (mode_is_vector(mode)) {
+		new_load = new_bd_amd64_movdqu(dbgi, block, arity, in,
+		                               AMD64_OP_ADDR, addr);
+	} else if (mode_is_float(mode)) {
 		new_load = new_bd_amd64_movs_xmm(dbgi, block, arity, in,
 		                                 insn_mode, AMD64_OP_ADDR, addr);
 	} else if (get_mode_size_bits(mode) < 64 && mode_is_signed(mode)) {
@@ -2402,6 +2462,14 @@ static ir_node *gen_Proj_Load(ir_node *node)
 
 	/* renumber the proj */
 	switch (get_amd64_irn_opcode(new_load)) {
+	case iro_amd64_movdqu:
+		if (pn == pn_Load_res) {
+			return new_rd_Proj(dbgi, new_load, amd64_mode_xmm,
+			                   pn_amd64_movdqu_res);
+		} else if (pn == pn_Load_M) {
+			return new_rd_Proj(dbgi, new_load, mode_M, pn_amd64_movdqu_M);
+		}
+		break;
 	case iro_amd64_movs_xmm:
 		if (pn == pn_Load_res) {
 			return new_rd_Proj(dbgi, new_load, amd64_mode_xmm,
@@ -2610,6 +2678,71 @@ static ir_node *gen_Bitcast(ir_node *node)
 	}
 }
 
+/** Creates a shuffle combining the lower parts of @p value with itself. */
+static ir_node *new_vector_unpack(dbg_info *dbgi, ir_node *block,
+                                  construct_binop_func make_node,
+                                  ir_node *value)
+{
+	amd64_binop_addr_attr_t attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.base.base.op_mode = AMD64_OP_REG_REG;
+
+	ir_node *in[] = { value, value };
+	ir_node *new_node = make_node(dbgi, block, ARRAY_SIZE(in), in, &attr);
+	arch_set_irn_register_reqs_in(new_node, xmm_xmm_reqs);
+	arch_set_irn_register_req_out(new_node, 0, &amd64_requirement_xmm_same_0);
+	return new_r_Proj(new_node, amd64_mode_xmm, pn_amd64_subs_res);
+}
+
+static ir_node *gen_Broadcast(ir_node *node)
+{
+	ir_node  *op      = get_Broadcast_op(node);
+	dbg_info *dbgi    = get_irn_dbg_info(node);
+	ir_node  *block   = be_transform_nodes_block(node);
+	ir_mode  *element = get_mode_vector_element(get_irn_mode(node));
+	unsigned  bits    = get_mode_size_bits(element);
+
+	if (mode_is_float(element)) {
+		ir_node *new_op = be_transform_node(op);
+		return new_vector_unpack(dbgi, block, bits == 32
+		                         ? new_bd_amd64_shufps_0
+		                         : new_bd_amd64_unpcklpd, new_op);
+	}
+
+	/* the upper bits are shuffled away */
+	op = be_skip_downconv(op, false);
+	amd64_addr_t no_addr = {
+		.immediate = {
+			.entity = NULL,
+			.offset = 0,
+		},
+		.base_input  = NO_INPUT,
+		.index_input = NO_INPUT,
+		.mem_input   = NO_INPUT,
+		.log_scale   = AMD64_SEGMENT_DEFAULT
+	};
+	amd64_insn_mode_t insn_mode = bits == 64 ? INSN_MODE_64 : INSN_MODE_32;
+	ir_node *new_op = be_transform_node(op);
+	ir_node *movd   = new_bd_amd64_movd_gp_xmm(dbgi, block, new_op, insn_mode,
+	                                           AMD64_OP_REG, no_addr);
+	ir_node *res    = new_r_Proj(movd, amd64_mode_xmm,
+	                             pn_amd64_movd_gp_xmm_res);
+	switch (bits) {
+	case 8:
+		res = new_vector_unpack(dbgi, block, new_bd_amd64_punpcklbw, res);
+		/* fallthrough */
+	case 16:
+		res = new_vector_unpack(dbgi, block, new_bd_amd64_punpcklwd, res);
+		/* fallthrough */
+	case 32:
+		return new_bd_amd64_pshufd_0(dbgi, block, res, INSN_MODE_128,
+		                             AMD64_OP_REG, no_addr);
+	case 64:
+		return new_vector_unpack(dbgi, block, new_bd_amd64_punpcklqdq, res);
+	}
+	panic("unexpected vector element mode %+F", element);
+}
+
 static ir_node *gen_amd64_l_punpckldq(ir_node *node)
 {
 	ir_node *op0 = get_irn_n(node, n_amd64_l_punpckldq_arg0);
@@ -2643,6 +2776,7 @@ static void amd64_register_transformers(void)
 	be_set_transform_function(op_And,               gen_And);
 	be_set_transform_function(op_ASM,               gen_ASM);
 	be_set_transform_function(op_Bitcast,           gen_Bitcast);
+	be_set_transform_function(op_Broadcast,         gen_Broadcast);
 	be_set_transform_function(op_Builtin,           gen_Builtin);
 	be_set_transform_function(op_Call,              gen_Call);
 	be_set_transform_function(op_Cmp,               gen_Cmp);
@@ -18,7 +18,7 @@
 #include "be_types.h"
 #include "firm_types.h"
 #include "pmap.h"
-#include "timing.h"
+#include "timing_t.h"
 #include "irdump.h"
 
 extern arch_isa_if_t const *isa_if;
@@ -39,6 +39,7 @@ struct be_options_t {
 	bool timing;               /**< time the backend phases */
 	bool opt_profile_generate; /**< instrument code for profiling */
 	bool opt_profile_use;      /**< use existing profile data */
+	bool opt_profile_edges;    /**< profile edges instead of blocks */
 	bool omit_fp;              /**< try to omit the frame pointer */
 	bool pic;                  /**< create position independent code */
 	bool do_verify;            /**< backend verify option */
@@ -107,9 +108,17 @@ typedef enum {
 ENUM_COUNTABLE(be_timer_id_t)
 extern ir_timer_t *be_timers[T_LAST+1];
 
+const char *be_get_timer_name(be_timer_id_t id);
+
+/**
+ * Starts the backend timer @p id. The phase is also recorded in the pass
+ * profile, see ir_pass_timing_enable().
+ */
 static inline void be_timer_push(be_timer_id_t id)
 {
 	assert(id <= T_LAST);
+	if (pass_timing_enabled)
+		ir_pass_timing_push(be_get_timer_name(id), NULL);
 	if (!be_timing)
 		return;
 	ir_timer_push(be_timers[id]);
@@ -118,6 +127,8 @@ static inline void be_timer_push(be_timer_id_t id)
 static inline void be_timer_pop(be_timer_id_t id)
 {
 	assert(id <= T_LAST);
+	if (pass_timing_enabled)
+		ir_pass_timing_pop();
 	if (!be_timing)
 		return;
 	ir_timer_pop(be_timers[id]);
@@ -19,6 +19,7 @@ typedef struct arch_register_class_t     arch_register_class_t;
 typedef struct arch_register_req_t       arch_register_req_t;
 typedef struct arch_register_t           arch_register_t;
 typedef struct arch_isa_if_t             arch_isa_if_t;
+typedef struct be_machine_t              be_machine_t;
 
 /**
  * Some flags describing a node in more detail.
@@ -239,6 +239,26 @@ static inline bool reg_req_has_constraint(const arch_register_req_t *req)
 	return req->limited || req->must_be_different != 0 || req->ignore || req->aligned;
 }
 
+/**
+ * Machine model used by schedulers which consider the timing of instructions.
+ */
+struct be_machine_t {
+	unsigned issue_width; /**< instructions issued per cycle */
+	unsigned n_ports;     /**< number of execution ports */
+
+	/**
+	 * Returns the number of cycles until the results of @p node are
+	 * available.
+	 */
+	unsigned (*get_latency)(const ir_node *node);
+
+	/**
+	 * Returns the bitset of ports able to execute @p node. Nodes which do
+	 * not occupy an issue slot return 0.
+	 */
+	unsigned (*get_ports)(const ir_node *node);
+};
+
 /**
  * Architecture interface.
  */
@@ -292,6 +312,12 @@ struct arch_isa_if_t {
 	 * number of cycles necessary to execute the instruction.
 	 */
 	unsigned (*get_op_estimated_cost)(const ir_node *irn);
+
+	/**
+	 * Returns the machine model of the selected target cpu. May be NULL if
+	 * the backend has no machine model.
+	 */
+	const be_machine_t *(*get_machine)(void);
 };
 
 static inline bool arch_irn_is_ignore(const ir_node *irn)
@@ -276,6 +276,13 @@ static void constraints(ir_node *const bl, void *const data)
 	}
 }
 
+void be_chordal_handle_constraints(be_chordal_env_t *const env)
+{
+	be_timer_push(T_CONSTR);
+	dom_tree_walk_irg(env->irg, constraints, NULL, env);
+	be_timer_pop(T_CONSTR);
+}
+
 static void assign(ir_node *const block, void *const env_ptr)
 {
 	be_chordal_env_t *const env  = (be_chordal_env_t*)env_ptr;
@@ -333,10 +340,8 @@ static void be_ra_chordal_color(be_chordal_env_t *const chordal_env)
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 	be_assure_live_sets(irg);
 
-	be_timer_push(T_CONSTR);
-
 	/* Handle register targeting constraints */
-	dom_tree_walk_irg(irg, constraints, NULL, chordal_env);
+	be_chordal_handle_constraints(chordal_env);
 
 	if (chordal_env->opts->dump_flags & BE_CH_DUMP_CONSTR) {
 		char buf[256];
@@ -344,8 +349,6 @@ static void be_ra_chordal_color(be_chordal_env_t *const chordal_env)
 		dump_ir_graph(irg, buf);
 	}
 
-	be_timer_pop(T_CONSTR);
-
 	/* First, determine the pressure */
 	dom_tree_walk_irg(irg, create_borders, NULL, chordal_env);
 
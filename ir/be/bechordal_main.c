@@ -65,6 +65,7 @@
 static be_ra_chordal_opts_t options = {
 	BE_CH_DUMP_NONE,
 	BE_CH_LOWER_PERM_SWAP,
+	BE_CH_IFG_EXPLICIT,
 };
 
 static const lc_opt_enum_int_items_t lower_perm_items[] = {
@@ -73,6 +74,13 @@ static const lc_opt_enum_int_items_t lower_perm_items[] = {
 	{ NULL, 0 }
 };
 
+static const lc_opt_enum_int_items_t ifg_flavor_items[] = {
+	{ "implicit", BE_CH_IFG_IMPLICIT },
+	{ "explicit", BE_CH_IFG_EXPLICIT },
+	{ "check",    BE_CH_IFG_CHECK    },
+	{ NULL, 0 }
+};
+
 static const lc_opt_enum_mask_items_t dump_items[] = {
 	{ "none",       BE_CH_DUMP_NONE       },
 	{ "spill",      BE_CH_DUMP_SPILL      },
@@ -93,6 +101,10 @@ static lc_opt_enum_int_var_t lower_perm_var = {
 	&options.lower_perm_opt, lower_perm_items
 };
 
+static lc_opt_enum_int_var_t ifg_flavor_var = {
+	&options.ifg_flavor, ifg_flavor_items
+};
+
 static lc_opt_enum_mask_var_t dump_var = {
 	&options.dump_flags, dump_items
 };
@@ -100,6 +112,7 @@ static lc_opt_enum_mask_var_t dump_var = {
 static const lc_opt_table_entry_t be_chordal_options[] = {
 	LC_OPT_ENT_ENUM_INT ("perm",          "perm lowering options", &lower_perm_var),
 	LC_OPT_ENT_ENUM_MASK("dump",          "select dump phases", &dump_var),
+	LC_OPT_ENT_ENUM_INT ("ifg",           "interference graph flavor", &ifg_flavor_var),
 	LC_OPT_LAST
 };
 
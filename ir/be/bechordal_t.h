@@ -74,13 +74,26 @@ enum {
 	/* lower perm options */
 	BE_CH_LOWER_PERM_SWAP   = 1,
 	BE_CH_LOWER_PERM_COPY   = 2,
+
+	/* interference graph flavors */
+	BE_CH_IFG_IMPLICIT = 1,
+	BE_CH_IFG_EXPLICIT = 2,
+	BE_CH_IFG_CHECK    = 3, /**< explicit, checked against implicit */
 };
 
 struct be_ra_chordal_opts_t {
 	unsigned dump_flags;
 	int      lower_perm_opt;
+	int      ifg_flavor;
 };
 
 void check_for_memory_operands(ir_graph *irg, const regalloc_if_t *regif);
 
+/**
+ * Inserts Perms in front of constrained nodes and assigns registers to the
+ * operands of these nodes. Afterwards all remaining values can be colored
+ * greedily in dominance order.
+ */
+void be_chordal_handle_constraints(be_chordal_env_t *env);
+
 #endif
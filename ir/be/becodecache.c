@@ -0,0 +1,388 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Persistent cache for the assembler code of functions.
+ *
+ * Each cache entry is a file in the cache directory named after the hash of
+ * its key. The file contains the complete key, which is compared on lookup,
+ * followed by the assembler text of the function. The block names in the text
+ * are moved to the block numbers of the current compilation unit on reuse.
+ *
+ * Entries are written to a temporary file first which is then renamed to the
+ * final name, so concurrent compiler processes never see partial entries.
+ */
+#include "becodecache.h"
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <direct.h>
+#include <process.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "be_t.h"
+#include "bedwarf.h"
+#include "beelf.h"
+#include "beemitter.h"
+#include "begnuas.h"
+#include "bemodule.h"
+#include "entity_t.h"
+#include "hashptr.h"
+#include "irflag.h"
+#include "irio_t.h"
+#include "irprog_t.h"
+#include "irtools.h"
+#include "lc_opts.h"
+#include "obst.h"
+#include "pmap.h"
+#include "pset_new.h"
+#include "statev_t.h"
+#include "util.h"
+
+/** the first bytes of every cache entry */
+static const char cache_magic[8] = { 'F', 'I', 'R', 'M', 'C', 'C', '0', '1' };
+
+/** the types whose members are checked for entities created by the backend */
+enum {
+	N_CHECKED_TYPES = IR_SEGMENT_LAST + 1 + 2,
+};
+
+static char cache_dir[1024];
+
+static struct obstack       obst;
+static bool                 enabled;
+static char                *key_prefix;      /**< options part of the keys */
+static size_t               key_prefix_len;
+static ir_type             *checked_types[N_CHECKED_TYPES];
+static size_t               n_begin_members[N_CHECKED_TYPES];
+static pmap                *private_names;   /**< ld_ident of private entities
+                                                  existing at the begin */
+static unsigned             n_hits;
+static unsigned             n_misses;
+static unsigned             n_stores;
+
+/* the function whose code is recorded */
+static ir_graph            *capture_irg;
+static char                *capture_key;
+static size_t               capture_key_len;
+static char const          *capture_name;
+static unsigned             capture_block_nr;
+static ir_label_t           capture_label_nr;
+
+static void add_option(const char *name, const char *value, void *env)
+{
+	(void)env;
+	/* the location of the cache does not change the code */
+	if (strcmp(name, "codecache") == 0)
+		return;
+	obstack_printf(&obst, "%s=%s\n", name, value);
+}
+
+void be_codecache_begin(be_main_env_t const *env)
+{
+	n_hits   = 0;
+	n_misses = 0;
+	n_stores = 0;
+	/* debug info and object files are produced for the whole unit and do not
+	 * pass through the assembler text */
+	enabled = cache_dir[0] != '\0' && !be_elf_output_selected()
+	       && !be_dwarf_enabled();
+	if (!enabled)
+		return;
+
+	obstack_init(&obst);
+	obstack_grow(&obst, cache_magic, sizeof(cache_magic));
+	lc_opt_entry_t *be_grp = lc_opt_get_grp(firm_opt_get_root(), "be");
+	lc_opt_visit_values(be_grp, add_option, NULL);
+	/* the code generated for the same input changes between versions */
+	obstack_printf(&obst, "firm=%u.%u.%s\n", ir_get_version_major(),
+	               ir_get_version_minor(), ir_get_version_revision());
+	obstack_printf(&obst, "optimize=%d cse=%d\n", get_optimize(),
+	               get_opt_cse());
+	key_prefix_len = obstack_object_size(&obst);
+	key_prefix     = (char*)obstack_finish(&obst);
+
+	for (ir_segment_t s = IR_SEGMENT_FIRST; s <= IR_SEGMENT_LAST; ++s)
+		checked_types[s] = get_segment_type(s);
+	checked_types[IR_SEGMENT_LAST + 1] = env->pic_trampolines_type;
+	checked_types[IR_SEGMENT_LAST + 2] = env->pic_symbols_type;
+	private_names = pmap_create();
+	for (size_t t = 0; t < N_CHECKED_TYPES; ++t) {
+		ir_type *type = checked_types[t];
+		n_begin_members[t] = get_compound_n_members(type);
+		for (size_t i = 0; i < n_begin_members[t]; ++i) {
+			ir_entity *member = get_compound_member(type, i);
+			if (get_entity_visibility(member) == ir_visibility_private)
+				pmap_insert(private_names, get_entity_ld_ident(member), member);
+		}
+	}
+}
+
+static char const *finish_string(void)
+{
+	obstack_1grow(&obst, '\0');
+	return (char const*)obstack_finish(&obst);
+}
+
+static char const *get_entry_name(char const *key, size_t key_len)
+{
+	unsigned const hash = hash_data((unsigned char const*)key, key_len);
+	obstack_printf(&obst, "%s/%08x-%zx.s", cache_dir, hash, key_len);
+	return finish_string();
+}
+
+static bool read_value(FILE *file, void *value, size_t size)
+{
+	return fread(value, 1, size, file) == size;
+}
+
+/**
+ * Reads the entry @p name and emits its text if its key is @p key.
+ */
+static bool replay_entry(char const *name, char const *key, size_t key_len)
+{
+	FILE *file = fopen(name, "rb");
+	if (file == NULL)
+		return false;
+
+	bool     res = false;
+	char     magic[sizeof(cache_magic)];
+	uint64_t entry_key_len;
+	if (!read_value(file, magic, sizeof(magic))
+	    || memcmp(magic, cache_magic, sizeof(magic)) != 0
+	    || !read_value(file, &entry_key_len, sizeof(entry_key_len))
+	    || entry_key_len != key_len)
+		goto end;
+
+	char *entry_key = (char*)obstack_alloc(&obst, key_len);
+	if (!read_value(file, entry_key, key_len)
+	    || memcmp(entry_key, key, key_len) != 0)
+		goto end;
+
+	uint32_t block_nr;
+	uint32_t n_block_nrs;
+	uint64_t text_len;
+	if (!read_value(file, &block_nr, sizeof(block_nr))
+	    || !read_value(file, &n_block_nrs, sizeof(n_block_nrs))
+	    || !read_value(file, &text_len, sizeof(text_len))
+	    || text_len > SIZE_MAX / 2)
+		goto end;
+	char *text = (char*)obstack_alloc(&obst, text_len);
+	if (!read_value(file, text, text_len))
+		goto end;
+
+	/* the next function must not rely on our section */
+	be_gas_forget_section();
+	unsigned const base = be_gas_reserve_block_nrs(n_block_nrs);
+	be_gas_emit_moved_block_names(text, text_len, block_nr, n_block_nrs, base);
+	be_gas_forget_section();
+	res = true;
+
+end:
+	fclose(file);
+	return res;
+}
+
+bool be_codecache_lookup(ir_graph *irg)
+{
+	if (!enabled)
+		return false;
+
+	assert(capture_irg == NULL);
+	obstack_grow(&obst, key_prefix, key_prefix_len);
+	bool const complete = ir_write_canonical_irg(&obst, irg);
+	size_t const key_len = obstack_object_size(&obst);
+	char  *const key     = (char*)obstack_finish(&obst);
+	++n_misses;
+	if (!complete) {
+		obstack_free(&obst, key);
+		return false;
+	}
+
+	char const *const name = get_entry_name(key, key_len);
+	if (replay_entry(name, key, key_len)) {
+		obstack_free(&obst, key);
+		--n_misses;
+		++n_hits;
+		return true;
+	}
+
+	capture_irg        = irg;
+	capture_key        = key;
+	capture_key_len    = key_len;
+	capture_name       = name;
+	capture_label_nr   = irp->last_label_nr;
+	capture_block_nr   = be_gas_get_next_block_nr();
+	be_gas_forget_section();
+	be_emit_begin_capture(&obst);
+	return false;
+}
+
+static bool is_name_char(char const c)
+{
+	/* bytes >= 128 only appear in quoted names */
+	return isalnum((unsigned char)c) || c == '_' || c == '.' || c == '$'
+	    || (unsigned char)c >= 128;
+}
+
+/**
+ * Returns true if @p text only references objects which exist independently
+ * of the code generated for the other functions.
+ */
+static bool is_reusable(char const *text, size_t len)
+{
+	/* labels created while generating the code */
+	if (irp->last_label_nr != capture_label_nr)
+		return false;
+
+	/* collect the referenced names in a single pass over the text, private
+	 * names must be private entities existing before */
+	char const *const prefix     = be_gas_get_private_prefix();
+	size_t      const prefix_len = strlen(prefix);
+	char const *const end        = text + len;
+	bool              reusable   = true;
+	pset_new_t        names;
+	pset_new_init(&names);
+	for (char const *c = text; c < end && reusable;) {
+		if (!is_name_char(*c)) {
+			++c;
+			continue;
+		}
+		char const *name = c;
+		while (c < end && is_name_char(*c))
+			++c;
+		if ((size_t)(c - name) > prefix_len
+		    && memcmp(name, prefix, prefix_len) == 0) {
+			/* block names are the only private names starting with a digit */
+			if (isdigit((unsigned char)name[prefix_len]))
+				continue;
+			name += prefix_len;
+			ident *id = new_id_from_chars(name, c - name);
+			if (!pmap_contains(private_names, id))
+				reusable = false;
+			continue;
+		}
+		pset_new_insert(&names, (void*)new_id_from_chars(name, c - name));
+	}
+
+	/* entities created by the backend are not created when the code is reused */
+	for (size_t t = 0; t < N_CHECKED_TYPES && reusable; ++t) {
+		ir_type *type = checked_types[t];
+		for (size_t i = n_begin_members[t], n = get_compound_n_members(type);
+		     i < n; ++i) {
+			ir_entity *member = get_compound_member(type, i);
+			if (pset_new_contains(&names, get_entity_ld_ident(member))) {
+				reusable = false;
+				break;
+			}
+		}
+	}
+	pset_new_destroy(&names);
+	return reusable;
+}
+
+static bool write_value(FILE *file, void const *value, size_t size)
+{
+	return fwrite(value, 1, size, file) == size;
+}
+
+static void make_dir(char const *name)
+{
+#ifdef _WIN32
+	_mkdir(name);
+#else
+	mkdir(name, 0777);
+#endif
+}
+
+static void write_entry(char const *text, size_t len)
+{
+	static unsigned n_tmp_files;
+#ifdef _WIN32
+	int const pid = _getpid();
+#else
+	int const pid = getpid();
+#endif
+	make_dir(cache_dir);
+	obstack_printf(&obst, "%s.%d.%u.tmp", capture_name, pid, n_tmp_files++);
+	char const *const tmp_name = finish_string();
+	FILE *file = fopen(tmp_name, "wb");
+	if (file == NULL)
+		return;
+
+	uint64_t const key_len     = capture_key_len;
+	uint32_t const block_nr    = capture_block_nr;
+	uint32_t const n_block_nrs = be_gas_get_next_block_nr() - capture_block_nr;
+	uint64_t const text_len    = len;
+	bool ok = write_value(file, cache_magic, sizeof(cache_magic))
+	       && write_value(file, &key_len, sizeof(key_len))
+	       && write_value(file, capture_key, capture_key_len)
+	       && write_value(file, &block_nr, sizeof(block_nr))
+	       && write_value(file, &n_block_nrs, sizeof(n_block_nrs))
+	       && write_value(file, &text_len, sizeof(text_len))
+	       && write_value(file, text, len);
+	ok = fclose(file) == 0 && ok;
+#ifdef _WIN32
+	/* rename does not replace existing files on windows */
+	if (ok)
+		remove(capture_name);
+#endif
+	if (ok && rename(tmp_name, capture_name) == 0) {
+		++n_stores;
+	} else {
+		remove(tmp_name);
+	}
+}
+
+void be_codecache_store(ir_graph *irg)
+{
+	if (capture_irg != irg)
+		return;
+
+	be_emit_end_capture();
+	size_t const len  = obstack_object_size(&obst);
+	char  *const text = (char*)obstack_finish(&obst);
+	be_gas_forget_section();
+
+	if (is_reusable(text, len))
+		write_entry(text, len);
+
+	obstack_free(&obst, capture_key);
+	capture_irg = NULL;
+}
+
+void be_codecache_finish(void)
+{
+	if (stat_ev_enabled) {
+		stat_ev_ull("bemain_codecache_hits", n_hits);
+		stat_ev_ull("bemain_codecache_misses", n_misses);
+		stat_ev_ull("bemain_codecache_stores", n_stores);
+	}
+	if (!enabled)
+		return;
+
+	assert(capture_irg == NULL);
+	pmap_destroy(private_names);
+	obstack_free(&obst, NULL);
+	enabled = false;
+}
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_codecache)
+void be_init_codecache(void)
+{
+	static const lc_opt_table_entry_t codecache_options[] = {
+		LC_OPT_ENT_STR("codecache", "directory of the function code cache (empty: disabled)", &cache_dir),
+		LC_OPT_LAST
+	};
+	lc_opt_entry_t *be_grp = lc_opt_get_grp(firm_opt_get_root(), "be");
+	lc_opt_add_table(be_grp, codecache_options);
+}
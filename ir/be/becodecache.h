@@ -0,0 +1,46 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Persistent cache for the assembler code of functions.
+ *
+ * The cache is keyed on a canonical description of the graph as it enters the
+ * backend together with the backend options. On a hit the assembler text
+ * emitted for an identical function before is reused instead of running
+ * instruction selection, scheduling and register allocation.
+ */
+#ifndef FIRM_BE_BECODECACHE_H
+#define FIRM_BE_BECODECACHE_H
+
+#include <stdbool.h>
+
+#include "be_types.h"
+#include "firm_types.h"
+
+/**
+ * Starts a compilation unit, must be called after everything needed for code
+ * generation of all graphs has been prepared.
+ */
+void be_codecache_begin(be_main_env_t const *env);
+
+/**
+ * Looks up the code of @p irg. On a hit the code has been emitted and true is
+ * returned. Otherwise the emitted code is recorded until be_codecache_store().
+ */
+bool be_codecache_lookup(ir_graph *irg);
+
+/**
+ * Stores the code emitted for @p irg since be_codecache_lookup() if it does not
+ * depend on the rest of the compilation unit.
+ */
+void be_codecache_store(ir_graph *irg);
+
+/**
+ * Ends a compilation unit.
+ */
+void be_codecache_finish(void);
+
+#endif
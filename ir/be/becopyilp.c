@@ -89,7 +89,7 @@ static inline bool sr_is_simplicial(ilp_env_t *const ienv, ir_node const *const
 
 		/* Check whether the current node forms a clique with all previous nodes. */
 		for (size_t i = ARR_LEN(all); i-- != 0;) {
-			if (!be_values_interfere(curr, all[i])) {
+			if (!be_ifg_connected(ienv->co->cenv->ifg, curr, all[i])) {
 				res = false;
 				goto end;
 			}
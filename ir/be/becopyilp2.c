@@ -360,7 +360,7 @@ static void build_clique_star_cstr(ilp_env_t *ienv)
 		n_edges = 0;
 		for (i=0; i<n_nodes; ++i) {
 			for (o=0; o<i; ++o) {
-				if (be_values_interfere(nodes[i], nodes[o]))
+				if (be_ifg_connected(ienv->co->cenv->ifg, nodes[i], nodes[o]))
 					add_edge(edges, nodes[i], nodes[o], &n_edges);
 			}
 		}
@@ -463,12 +463,12 @@ static void extend_path(ilp_env_t *ienv, pdeq *path, const ir_node *irn)
 	pdeq_copyl(path, (const void **)curr_path);
 
 	for (i=1; i<len; ++i) {
-		if (be_values_interfere(irn, curr_path[i]))
+		if (be_ifg_connected(ienv->co->cenv->ifg, irn, curr_path[i]))
 			goto end;
 	}
 
 	/* check for terminating interference */
-	if (be_values_interfere(irn, curr_path[0])) {
+	if (be_ifg_connected(ienv->co->cenv->ifg, irn, curr_path[0])) {
 		/* One node is not a path. */
 		/* And a path of length 2 is covered by a clique star constraint. */
 		if (len > 2) {
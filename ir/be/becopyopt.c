@@ -377,7 +377,7 @@ static void co_collect_units(ir_node *irn, void *env)
 			assert(arch_get_irn_register_req(arg)->cls == co->cls && "Argument not in same register class.");
 			if (arg == irn)
 				continue;
-			if (be_values_interfere(irn, arg)) {
+			if (be_ifg_connected(co->cenv->ifg, irn, arg)) {
 				unit->inevitable_costs += co->get_costs(irn, i);
 				continue;
 			}
@@ -428,7 +428,7 @@ static void co_collect_units(ir_node *irn, void *env)
 				ir_node *o = get_irn_n(skip_Proj(irn), i);
 				if (arch_irn_is_ignore(o))
 					continue;
-				if (be_values_interfere(irn, o))
+				if (be_ifg_connected(co->cenv->ifg, irn, o))
 					continue;
 				++count;
 			}
@@ -446,7 +446,7 @@ static void co_collect_units(ir_node *irn, void *env)
 				if (other & (1U << i)) {
 					ir_node *o = get_irn_n(skip_Proj(irn), i);
 					if (!arch_irn_is_ignore(o) &&
-							!be_values_interfere(irn, o)) {
+							!be_ifg_connected(co->cenv->ifg, irn, o)) {
 						unit->nodes[k] = o;
 						unit->costs[k] = co->get_costs(irn, -1);
 						++k;
@@ -538,7 +538,7 @@ static void co_complete_stats(const copy_opt_t *co, co_complete_stats_t *stat)
 					stat->unsatisfied_edges += 1;
 				}
 
-				if (be_values_interfere(an->irn, neigh->irn)) {
+				if (be_ifg_connected(co->cenv->ifg, an->irn, neigh->irn)) {
 					stat->aff_int += 1;
 					stat->inevit_costs += neigh->costs;
 				}
@@ -590,7 +590,7 @@ static void add_edge(copy_opt_t *co, ir_node *n1, ir_node *n2, int costs)
 
 static inline void add_edges(copy_opt_t *co, ir_node *n1, ir_node *n2, int costs)
 {
-	if (n1 != n2 && !be_values_interfere(n1, n2)) {
+	if (n1 != n2 && !be_ifg_connected(co->cenv->ifg, n1, n2)) {
 		add_edge(co, n1, n2, costs);
 		add_edge(co, n2, n1, costs);
 	}
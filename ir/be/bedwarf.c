@@ -935,6 +935,18 @@ void be_dwarf_open(void)
 	pset_new_init(&env.emitted_types);
 }
 
+bool be_dwarf_disable(void)
+{
+	bool const was_enabled = debug_level > LEVEL_NONE;
+	debug_level = LEVEL_NONE;
+	return was_enabled;
+}
+
+bool be_dwarf_enabled(void)
+{
+	return debug_level > LEVEL_NONE;
+}
+
 void be_dwarf_set_source_language(dwarf_source_language new_language)
 {
 	language = new_language;
@@ -24,6 +24,15 @@ void be_dwarf_open(void);
 /** close a debug handler. */
 void be_dwarf_close(void);
 
+/**
+ * Switch off debug output, used when the output does not go through an
+ * assembler. Returns true if debug output was requested.
+ */
+bool be_dwarf_disable(void);
+
+/** Returns true if any debug output is produced. */
+bool be_dwarf_enabled(void);
+
 /** start a compilation unit */
 void be_dwarf_unit_begin(const char *filename);
 
@@ -0,0 +1,1075 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Writes relocatable ELF object files directly.
+ *
+ * Only 32bit little endian ELF files using REL relocations (as used on i386)
+ * are supported. Comdat entities are approximated by weak symbols.
+ */
+#include "beelf.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include "array.h"
+#include "bitfiddle.h"
+#include "be_t.h"
+#include "bediagnostic.h"
+#include "bedwarf.h"
+#include "beemitter.h"
+#include "entity_t.h"
+#include "irnode_t.h"
+#include "irprog.h"
+#include "obst.h"
+#include "panic.h"
+#include "pmap.h"
+#include "tv.h"
+#include "util.h"
+
+/* ELF constants, see the System V ABI */
+enum {
+	ELFCLASS32    = 1,
+	ELFDATA2LSB   = 1,
+	EV_CURRENT    = 1,
+	ET_REL        = 1,
+
+	SHT_NULL      = 0,
+	SHT_PROGBITS  = 1,
+	SHT_SYMTAB    = 2,
+	SHT_STRTAB    = 3,
+	SHT_NOBITS    = 8,
+	SHT_REL       = 9,
+
+	SHF_WRITE     = 0x1,
+	SHF_ALLOC     = 0x2,
+	SHF_EXECINSTR = 0x4,
+	SHF_INFO_LINK = 0x40,
+	SHF_TLS       = 0x400,
+
+	SHN_UNDEF     = 0,
+	SHN_COMMON    = 0xfff2,
+
+	STB_LOCAL     = 0,
+	STB_GLOBAL    = 1,
+	STB_WEAK      = 2,
+
+	STT_NOTYPE    = 0,
+	STT_OBJECT    = 1,
+	STT_FUNC      = 2,
+	STT_SECTION   = 3,
+	STT_TLS       = 6,
+
+	STV_DEFAULT   = 0,
+	STV_HIDDEN    = 2,
+
+	ELF32_EHDR_SIZE = 52,
+	ELF32_SHDR_SIZE = 40,
+	ELF32_SYM_SIZE  = 16,
+	ELF32_REL_SIZE  = 8,
+};
+
+typedef struct elf_symbol_t  elf_symbol_t;
+typedef struct elf_section_t elf_section_t;
+
+typedef struct elf_reloc_t {
+	uint32_t      offset; /**< offset of the field inside the section */
+	uint32_t      type;   /**< machine specific relocation type */
+	elf_symbol_t *symbol; /**< the referenced symbol */
+} elf_reloc_t;
+
+struct elf_section_t {
+	char const    *name;
+	uint32_t       type;
+	uint32_t       flags;
+	uint32_t       alignment;
+	uint32_t       size;
+	unsigned char *data;     /**< contents, NULL for SHT_NOBITS sections */
+	elf_reloc_t   *relocs;
+	elf_symbol_t  *symbol;   /**< the section symbol */
+	unsigned       index;    /**< section header index */
+	unsigned       rel_index;
+};
+
+struct elf_symbol_t {
+	const ir_entity *entity;   /**< NULL for section symbols */
+	elf_section_t   *section;  /**< defining section, NULL if undefined */
+	const ir_entity *alias;    /**< aliased entity for alias entities */
+	uint32_t         value;
+	uint32_t         size;
+	uint8_t          type;
+	bool             common;
+	bool             weak;
+	unsigned         index;    /**< index in the symbol table */
+};
+
+typedef struct block_fixup_t {
+	uint32_t       offset;
+	const ir_node *block;
+} block_fixup_t;
+
+typedef struct jump_table_t {
+	ir_entity      *entity;
+	const ir_node **targets;
+	unsigned long   length;
+} jump_table_t;
+
+typedef struct init_value_t {
+	const ir_entity *entity;
+	long             value;
+} init_value_t;
+
+static bool            elf_output_selected;
+static uint16_t        elf_machine;
+static uint32_t        elf_reloc_abs32;
+static FILE           *elf_output;
+static struct obstack  obst;
+static elf_section_t **sections;
+static elf_symbol_t  **symbols;
+static pmap           *entity_symbols;
+static elf_section_t  *text;
+static elf_symbol_t   *current_function;
+static pmap           *block_offsets;
+static block_fixup_t  *block_fixups;
+static jump_table_t   *jump_tables;
+
+void be_elf_select_output(uint16_t const machine, uint32_t const reloc_abs32)
+{
+	elf_output_selected = true;
+	elf_machine         = machine;
+	elf_reloc_abs32     = reloc_abs32;
+}
+
+bool be_elf_output_selected(void)
+{
+	return elf_output_selected;
+}
+
+static elf_section_t *get_section(char const *const name, uint32_t const type,
+                                  uint32_t const flags)
+{
+	for (size_t i = 0, n = ARR_LEN(sections); i < n; ++i) {
+		elf_section_t *const section = sections[i];
+		if (strcmp(section->name, name) == 0)
+			return section;
+	}
+
+	elf_section_t *const section = OALLOCZ(&obst, elf_section_t);
+	section->name      = name;
+	section->type      = type;
+	section->flags     = flags;
+	section->alignment = 1;
+	section->data      = type == SHT_NOBITS ? NULL : NEW_ARR_F(unsigned char, 0);
+	section->relocs    = NEW_ARR_F(elf_reloc_t, 0);
+
+	elf_symbol_t *const symbol = OALLOCZ(&obst, elf_symbol_t);
+	symbol->section = section;
+	symbol->type    = STT_SECTION;
+	section->symbol = symbol;
+
+	ARR_APP1(elf_section_t*, sections, section);
+	return section;
+}
+
+static elf_section_t *get_entity_section(be_gas_section_t const section)
+{
+	be_gas_section_t const base = section & GAS_SECTION_TYPE_MASK;
+	bool             const tls  = section & GAS_SECTION_FLAG_TLS;
+	switch (base) {
+	case GAS_SECTION_TEXT:
+		return text;
+	case GAS_SECTION_DATA:
+	case GAS_SECTION_RODATA:
+	case GAS_SECTION_CSTRING:
+		if (tls)
+			return get_section(".tdata", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE | SHF_TLS);
+		if (base == GAS_SECTION_DATA)
+			return get_section(".data", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE);
+		return get_section(".rodata", SHT_PROGBITS, SHF_ALLOC);
+	case GAS_SECTION_BSS:
+		if (tls)
+			return get_section(".tbss", SHT_NOBITS, SHF_ALLOC | SHF_WRITE | SHF_TLS);
+		return get_section(".bss", SHT_NOBITS, SHF_ALLOC | SHF_WRITE);
+	case GAS_SECTION_CONSTRUCTORS:
+		return get_section(".ctors", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE);
+	case GAS_SECTION_DESTRUCTORS:
+		return get_section(".dtors", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE);
+	case GAS_SECTION_JCR:
+		return get_section(".jcr", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE);
+	default:
+		break;
+	}
+	panic("section %d not supported in ELF object output", (int)base);
+}
+
+static elf_symbol_t *get_entity_symbol(const ir_entity *const entity)
+{
+	elf_symbol_t *symbol = pmap_get(elf_symbol_t, entity_symbols, entity);
+	if (symbol == NULL) {
+		if (get_entity_kind(entity) == IR_ENTITY_GOTENTRY)
+			panic("GOT entries not supported in ELF object output");
+
+		symbol         = OALLOCZ(&obst, elf_symbol_t);
+		symbol->entity = entity;
+		symbol->type   = STT_NOTYPE;
+		pmap_insert(entity_symbols, entity, symbol);
+		ARR_APP1(elf_symbol_t*, symbols, symbol);
+	}
+	return symbol;
+}
+
+static void define_symbol(const ir_entity *const entity,
+                          elf_section_t *const section, uint8_t const type)
+{
+	elf_symbol_t *const symbol = get_entity_symbol(entity);
+	if (symbol->section != NULL || symbol->common)
+		panic("entity %+F defined twice", entity);
+	symbol->section = section;
+	symbol->value   = section->size;
+	symbol->type    = type;
+}
+
+static void section_align(elf_section_t *const section,
+                          unsigned const alignment, uint8_t const fill)
+{
+	assert(is_po2(alignment));
+	if (alignment > section->alignment)
+		section->alignment = alignment;
+
+	uint32_t const misalign = section->size & (alignment - 1);
+	if (misalign == 0)
+		return;
+	uint32_t const skip = alignment - misalign;
+	if (section->data != NULL) {
+		ARR_RESIZE(unsigned char, section->data, section->size + skip);
+		memset(&section->data[section->size], fill, skip);
+	}
+	section->size += skip;
+}
+
+/** reserves @p size zero bytes at the end of the section */
+static uint32_t section_reserve(elf_section_t *const section,
+                                uint32_t const size)
+{
+	uint32_t const offset = section->size;
+	if (section->data != NULL) {
+		ARR_RESIZE(unsigned char, section->data, offset + size);
+		memset(&section->data[offset], 0, size);
+	}
+	section->size += size;
+	return offset;
+}
+
+static void section_add_reloc(elf_section_t *const section,
+                              uint32_t const offset, uint32_t const type,
+                              elf_symbol_t *const symbol)
+{
+	elf_reloc_t const reloc = { offset, type, symbol };
+	ARR_APP1(elf_reloc_t, section->relocs, reloc);
+}
+
+/** stores @p size bytes of @p value in target byte order */
+static void section_put_value(elf_section_t *const section,
+                              uint32_t const offset, uint64_t const value,
+                              unsigned const size)
+{
+	bool const big_endian = be_get_backend_param()->byte_order_big_endian;
+	for (unsigned i = 0; i < size; ++i) {
+		unsigned const pos = big_endian ? size - 1 - i : i;
+		section->data[offset + pos] = (unsigned char)(value >> (8 * i));
+	}
+}
+
+static void text_append(const void *const bytes, size_t const size)
+{
+	uint32_t const offset = section_reserve(text, size);
+	memcpy(&text->data[offset], bytes, size);
+}
+
+void be_elf_emit8(uint8_t const byte)
+{
+	text_append(&byte, 1);
+}
+
+void be_elf_emit16(uint16_t const u16)
+{
+	uint32_t const offset = section_reserve(text, 2);
+	section_put_value(text, offset, u16, 2);
+}
+
+void be_elf_emit32(uint32_t const u32)
+{
+	uint32_t const offset = section_reserve(text, 4);
+	section_put_value(text, offset, u32, 4);
+}
+
+void be_elf_emit_reloc32(const ir_entity *const entity, int32_t const addend,
+                         uint32_t const type)
+{
+	section_add_reloc(text, text->size, type, get_entity_symbol(entity));
+	be_elf_emit32((uint32_t)addend);
+}
+
+void be_elf_emit_block_ref32(const ir_node *const block)
+{
+	block_fixup_t const fixup = { text->size, block };
+	ARR_APP1(block_fixup_t, block_fixups, fixup);
+	be_elf_emit32(0);
+}
+
+void be_elf_align_code(unsigned const po2alignment, unsigned const max_skip,
+                       uint8_t const fill)
+{
+	unsigned const alignment = 1u << po2alignment;
+	unsigned const misalign  = text->size & (alignment - 1);
+	if (misalign == 0 || alignment - misalign > max_skip)
+		return;
+	section_align(text, alignment, fill);
+}
+
+void be_elf_begin_block(const ir_node *const block)
+{
+	pmap_insert(block_offsets, block, INT_TO_PTR(text->size + 1));
+
+	ir_entity *const entity = get_Block_entity(block);
+	if (entity != NULL)
+		define_symbol(entity, text, STT_NOTYPE);
+}
+
+static uint32_t get_block_offset(const ir_node *const block)
+{
+	void *const offset = pmap_get(void, block_offsets, block);
+	if (offset == NULL)
+		panic("jump to block %+F which was not emitted", block);
+	return PTR_TO_INT(offset) - 1;
+}
+
+void be_elf_emit_jump_table(const ir_node *const node,
+                            const ir_switch_table *const table,
+                            ir_entity *const entity,
+                            get_cfop_target_func const get_cfop_target)
+{
+	if (entity == NULL)
+		panic("inline jump tables not supported in ELF object output");
+
+	jump_table_t jump_table;
+	jump_table.entity  = entity;
+	jump_table.targets = be_get_jump_table_targets(node, table, get_cfop_target,
+	                                               &jump_table.length);
+	ARR_APP1(jump_table_t, jump_tables, jump_table);
+}
+
+void be_elf_begin_function(const ir_entity *const entity,
+                           unsigned const po2alignment)
+{
+	if (po2alignment > 0) {
+		/* gcc fills space between function with 0x90... */
+		section_align(text, 1u << po2alignment, 0x90);
+	}
+	define_symbol(entity, text, STT_FUNC);
+	current_function = get_entity_symbol(entity);
+	pmap_destroy(block_offsets);
+	block_offsets = pmap_create();
+}
+
+static void emit_jump_tables(void)
+{
+	/* only create the read-only data section if there is something in it */
+	if (ARR_LEN(jump_tables) == 0)
+		return;
+
+	unsigned const pointer_size = get_mode_size_bytes(mode_P);
+	if (pointer_size != 4)
+		panic("ELF object output only supports 32bit pointers");
+
+	elf_section_t *const rodata = get_entity_section(GAS_SECTION_RODATA);
+	for (size_t i = 0, n = ARR_LEN(jump_tables); i < n; ++i) {
+		jump_table_t const *const jump_table = &jump_tables[i];
+		section_align(rodata, pointer_size, 0);
+		define_symbol(jump_table->entity, rodata, STT_OBJECT);
+		get_entity_symbol(jump_table->entity)->size
+			= jump_table->length * pointer_size;
+		for (unsigned long e = 0; e < jump_table->length; ++e) {
+			uint32_t const offset = section_reserve(rodata, pointer_size);
+			uint32_t const target = get_block_offset(jump_table->targets[e]);
+			section_put_value(rodata, offset, target, pointer_size);
+			section_add_reloc(rodata, offset, elf_reloc_abs32, text->symbol);
+		}
+		free(jump_table->targets);
+	}
+	ARR_SHRINKLEN(jump_tables, 0);
+}
+
+void be_elf_end_function(const ir_entity *const entity)
+{
+	elf_symbol_t *const symbol = get_entity_symbol(entity);
+	assert(symbol == current_function);
+	symbol->size = text->size - symbol->value;
+
+	/* resolve pc relative jumps to blocks */
+	for (size_t i = 0, n = ARR_LEN(block_fixups); i < n; ++i) {
+		block_fixup_t const *const fixup  = &block_fixups[i];
+		uint32_t             const target = get_block_offset(fixup->block);
+		section_put_value(text, fixup->offset, target - (fixup->offset + 4), 4);
+	}
+	ARR_SHRINKLEN(block_fixups, 0);
+
+	emit_jump_tables();
+	current_function = NULL;
+}
+
+static void write_tarval(elf_section_t *const section, uint32_t const offset,
+                         ir_tarval *const tv, unsigned const size)
+{
+	bool const big_endian = be_get_backend_param()->byte_order_big_endian;
+	for (unsigned i = 0; i < size; ++i) {
+		unsigned const pos = big_endian ? size - 1 - i : i;
+		section->data[offset + pos] = get_tarval_sub_bits(tv, i);
+	}
+}
+
+static init_value_t eval_init_expression(ir_node *const init)
+{
+	init_value_t res = { NULL, 0 };
+	switch (get_irn_opcode(init)) {
+	case iro_Id:
+		return eval_init_expression(get_Id_pred(init));
+
+	case iro_Conv:
+		return eval_init_expression(get_Conv_op(init));
+
+	case iro_Const: {
+		ir_tarval *const tv = get_Const_tarval(init);
+		if (!tarval_is_long(tv))
+			panic("constant %+F in initializer expression too large", init);
+		res.value = get_tarval_long(tv);
+		return res;
+	}
+
+	case iro_Address:
+		res.entity = get_Address_entity(init);
+		return res;
+
+	case iro_Offset:
+		res.value = get_entity_offset(get_Offset_entity(init));
+		return res;
+
+	case iro_Align:
+		res.value = get_type_alignment_bytes(get_Align_type(init));
+		return res;
+
+	case iro_Size:
+		res.value = get_type_size_bytes(get_Size_type(init));
+		return res;
+
+	case iro_Add: {
+		init_value_t const left  = eval_init_expression(get_Add_left(init));
+		init_value_t const right = eval_init_expression(get_Add_right(init));
+		if (left.entity != NULL && right.entity != NULL)
+			panic("cannot add two addresses in initializer %+F", init);
+		res.entity = left.entity != NULL ? left.entity : right.entity;
+		res.value  = left.value + right.value;
+		return res;
+	}
+
+	case iro_Sub: {
+		init_value_t const left  = eval_init_expression(get_Sub_left(init));
+		init_value_t const right = eval_init_expression(get_Sub_right(init));
+		if (right.entity != NULL)
+			panic("address differences not supported in ELF object output (%+F)", init);
+		res.entity = left.entity;
+		res.value  = left.value - right.value;
+		return res;
+	}
+
+	case iro_Mul: {
+		init_value_t const left  = eval_init_expression(get_Mul_left(init));
+		init_value_t const right = eval_init_expression(get_Mul_right(init));
+		if (left.entity != NULL || right.entity != NULL)
+			panic("cannot multiply addresses in initializer %+F", init);
+		res.value = left.value * right.value;
+		return res;
+	}
+
+	case iro_Unknown:
+		return res;
+
+	default:
+		panic("unsupported IR-node %+F", init);
+	}
+}
+
+static void write_node_data(elf_section_t *const section, uint32_t const offset,
+                            ir_node *const init, ir_type *const type)
+{
+	unsigned const size = get_type_size_bytes(type);
+	ir_node *const value = skip_Id(init);
+	if (is_Const(value)) {
+		write_tarval(section, offset, get_Const_tarval(value), size);
+		return;
+	}
+
+	init_value_t const res = eval_init_expression(value);
+	if (size > 8)
+		panic("initializer %+F too large", init);
+	section_put_value(section, offset, (uint64_t)res.value, size);
+	if (res.entity != NULL) {
+		if (size != 4)
+			panic("address in initializer %+F must be 32bit", init);
+		section_add_reloc(section, offset, elf_reloc_abs32,
+		                  get_entity_symbol(res.entity));
+	}
+}
+
+static void write_bitfield(elf_section_t *const section, uint32_t const offset,
+                           unsigned const offset_bits,
+                           unsigned const bitfield_size,
+                           const ir_initializer_t *const initializer,
+                           ir_type *const type)
+{
+	static const size_t BITS_PER_BYTE = 8;
+
+	ir_tarval *tv = NULL;
+	switch (get_initializer_kind(initializer)) {
+	case IR_INITIALIZER_NULL:
+		return;
+	case IR_INITIALIZER_TARVAL:
+		tv = get_initializer_tarval_value(initializer);
+		break;
+	case IR_INITIALIZER_CONST: {
+		ir_node *node = get_initializer_const_value(initializer);
+		if (!is_Const(node)) {
+			panic("bitfield initializer not a Const node");
+		}
+		tv = get_Const_tarval(node);
+		break;
+	}
+	case IR_INITIALIZER_COMPOUND:
+		panic("bitfield initializer is compound");
+	}
+	if (tv == NULL || tv == tarval_bad) {
+		panic("couldn't get numeric value for bitfield initializer");
+	}
+
+	size_t const value_len  = get_type_size_bytes(type);
+	bool   const big_endian = be_get_backend_param()->byte_order_big_endian;
+	for (size_t bit_offset = 0; bit_offset < bitfield_size;) {
+		size_t src_offset      = bit_offset / BITS_PER_BYTE;
+		size_t src_offset_bits = bit_offset % BITS_PER_BYTE;
+		size_t dst_offset      = (bit_offset+offset_bits) / BITS_PER_BYTE;
+		size_t dst_offset_bits = (bit_offset+offset_bits) % BITS_PER_BYTE;
+		size_t src_bits_len    = bitfield_size-bit_offset;
+		size_t dst_bits_len    = BITS_PER_BYTE-dst_offset_bits;
+		if (src_bits_len > dst_bits_len)
+			src_bits_len = dst_bits_len;
+
+		size_t const pos = big_endian ? value_len - dst_offset - 1 : dst_offset;
+		unsigned char curr_bits = get_tarval_sub_bits(tv, src_offset);
+		curr_bits = curr_bits >> src_offset_bits;
+		if (src_offset_bits + src_bits_len > 8) {
+			unsigned next_bits = get_tarval_sub_bits(tv, src_offset+1);
+			curr_bits |= next_bits << (8 - src_offset_bits);
+		}
+		curr_bits &= (1 << src_bits_len) - 1;
+		section->data[offset + pos] |= curr_bits << dst_offset_bits;
+
+		bit_offset += dst_bits_len;
+	}
+}
+
+static void write_initializer(elf_section_t *const section,
+                              uint32_t const offset,
+                              const ir_initializer_t *const initializer,
+                              ir_type *const type)
+{
+	switch (get_initializer_kind(initializer)) {
+	case IR_INITIALIZER_NULL:
+		return;
+
+	case IR_INITIALIZER_TARVAL:
+		write_tarval(section, offset, get_initializer_tarval_value(initializer),
+		             get_type_size_bytes(type));
+		return;
+
+	case IR_INITIALIZER_CONST:
+		write_node_data(section, offset,
+		                get_initializer_const_value(initializer), type);
+		return;
+
+	case IR_INITIALIZER_COMPOUND:
+		if (is_Array_type(type)) {
+			ir_type *element_type = get_array_element_type(type);
+			size_t   skip         = get_type_size_bytes(element_type);
+			size_t   alignment    = get_type_alignment_bytes(element_type);
+			size_t   misalign     = skip % alignment;
+			if (misalign != 0) {
+				skip += alignment - misalign;
+			}
+
+			for (size_t i = 0,
+			     n = get_initializer_compound_n_entries(initializer);
+			     i < n; ++i) {
+				ir_initializer_t *sub_initializer
+					= get_initializer_compound_value(initializer, i);
+				write_initializer(section, offset + i * skip, sub_initializer,
+				                  element_type);
+			}
+		} else {
+			assert(is_compound_type(type));
+			for (size_t i = 0, n_members = get_compound_n_members(type);
+			     i < n_members; ++i) {
+				ir_entity *member        = get_compound_member(type, i);
+				uint32_t   member_offset = offset + get_entity_offset(member);
+
+				assert(i < get_initializer_compound_n_entries(initializer));
+				ir_initializer_t *sub_initializer
+					= get_initializer_compound_value(initializer, i);
+
+				ir_type *subtype       = get_entity_type(member);
+				unsigned bitfield_size = get_entity_bitfield_size(member);
+				if (bitfield_size > 0) {
+					unsigned offset_bits = get_entity_bitfield_offset(member);
+					write_bitfield(section, member_offset, offset_bits,
+					               bitfield_size, sub_initializer, subtype);
+					continue;
+				}
+
+				write_initializer(section, member_offset, sub_initializer,
+				                  subtype);
+			}
+		}
+		return;
+	}
+	panic("invalid ir_initializer kind found");
+}
+
+static bool is_local_entity(const ir_entity *const entity)
+{
+	ir_visibility const visibility = get_entity_visibility(entity);
+	return visibility == ir_visibility_local
+	    || visibility == ir_visibility_private;
+}
+
+static void emit_global(be_main_env_t const *const main_env,
+                        ir_entity const *const entity)
+{
+	ir_entity_kind const kind = get_entity_kind(entity);
+	/* Block labels are defined with their blocks, functions with their code */
+	if (kind == IR_ENTITY_LABEL || kind == IR_ENTITY_GOTENTRY
+	 || kind == IR_ENTITY_METHOD)
+		return;
+
+	if (kind == IR_ENTITY_ALIAS) {
+		get_entity_symbol(entity)->alias = get_entity_alias(entity);
+		return;
+	}
+
+	/* nothing left to do without an initializer */
+	if (!entity_has_definition(entity))
+		return;
+
+	be_gas_section_t const section  = be_gas_determine_section(main_env, entity);
+	ir_linkage       const linkage  = get_entity_linkage(entity);
+	bool             const is_local = is_local_entity(entity);
+	ir_initializer_t const *const initializer = get_entity_initializer(entity);
+	ir_type         *const type      = get_entity_type(entity);
+	uint32_t         const size      = initializer != NULL
+		? be_gas_get_initializer_size(initializer, type)
+		: get_type_size_bytes(type);
+	unsigned         const alignment = be_gas_get_entity_alignment(entity);
+	if (!is_po2(alignment))
+		panic("alignment not a power of 2");
+
+	elf_symbol_t *const symbol = get_entity_symbol(entity);
+	if (section == GAS_SECTION_BSS && !is_local
+	 && (linkage & IR_LINKAGE_MERGE)) {
+		/* common symbol, the linker allocates it */
+		symbol->common = true;
+		symbol->type   = STT_OBJECT;
+		symbol->value  = alignment;
+		symbol->size   = size;
+		return;
+	}
+
+	elf_section_t *const elf_section = get_entity_section(section);
+	if (section & GAS_SECTION_FLAG_COMDAT)
+		symbol->weak = true;
+	section_align(elf_section, alignment, 0);
+	define_symbol(entity, elf_section,
+	              section & GAS_SECTION_FLAG_TLS ? STT_TLS : STT_OBJECT);
+	symbol->size = size;
+
+	uint32_t const offset = section_reserve(elf_section, size);
+	if (!be_gas_entity_is_null(entity)) {
+		if (elf_section->data == NULL)
+			panic("initialized entity %+F in section %s", entity,
+			      elf_section->name);
+		write_initializer(elf_section, offset, initializer, type);
+	}
+}
+
+static void emit_globals(ir_type *const gt, be_main_env_t const *const main_env)
+{
+	for (size_t i = 0, n = get_compound_n_members(gt); i < n; i++) {
+		ir_entity *ent = get_compound_member(gt, i);
+		emit_global(main_env, ent);
+	}
+}
+
+static void resolve_aliases(void)
+{
+	for (size_t i = 0, n = ARR_LEN(symbols); i < n; ++i) {
+		elf_symbol_t *const symbol = symbols[i];
+		if (symbol->alias == NULL)
+			continue;
+		elf_symbol_t const *const target = get_entity_symbol(symbol->alias);
+		if (target->section == NULL)
+			panic("alias %+F refers to undefined entity", symbol->entity);
+		symbol->section = target->section;
+		symbol->value   = target->value;
+		symbol->size    = target->size;
+		symbol->type    = target->type;
+	}
+}
+
+static uint8_t get_symbol_binding(elf_symbol_t const *const symbol)
+{
+	const ir_entity *const entity = symbol->entity;
+	if (entity == NULL)
+		return STB_LOCAL;
+	if (get_entity_kind(entity) == IR_ENTITY_LABEL)
+		return STB_LOCAL;
+	if (symbol->section != NULL && is_local_entity(entity))
+		return STB_LOCAL;
+	if (symbol->weak || (get_entity_linkage(entity) & IR_LINKAGE_WEAK))
+		return STB_WEAK;
+	return STB_GLOBAL;
+}
+
+/** appends the symbol name of @p symbol to the string table */
+static uint32_t add_symbol_name(struct obstack *const strtab,
+                                elf_symbol_t const *const symbol)
+{
+	const ir_entity *const entity = symbol->entity;
+	if (entity == NULL)
+		return 0;
+
+	uint32_t const offset = obstack_object_size(strtab);
+	if (get_entity_kind(entity) == IR_ENTITY_LABEL) {
+		obstack_printf(strtab, "%s_%lu", be_gas_get_private_prefix(),
+		               get_entity_label(entity));
+	} else {
+		if (get_entity_visibility(entity) == ir_visibility_private)
+			obstack_printf(strtab, "%s", be_gas_get_private_prefix());
+		obstack_printf(strtab, "%s", get_entity_ld_name(entity));
+	}
+	obstack_1grow(strtab, '\0');
+	return offset;
+}
+
+static uint32_t add_string(struct obstack *const strtab, char const *const s)
+{
+	uint32_t const offset = obstack_object_size(strtab);
+	obstack_grow0(strtab, s, strlen(s));
+	return offset;
+}
+
+static void write_u8(uint8_t const value)
+{
+	fputc(value, elf_output);
+}
+
+static void write_u16(uint16_t const value)
+{
+	write_u8(value & 0xFF);
+	write_u8(value >> 8);
+}
+
+static void write_u32(uint32_t const value)
+{
+	write_u16(value & 0xFFFF);
+	write_u16(value >> 16);
+}
+
+static void write_padding(uint32_t const from, uint32_t const to)
+{
+	for (uint32_t i = from; i < to; ++i)
+		write_u8(0);
+}
+
+static void write_section_header(uint32_t const name, uint32_t const type,
+                                 uint32_t const flags, uint32_t const offset,
+                                 uint32_t const size, uint32_t const link,
+                                 uint32_t const info, uint32_t const alignment,
+                                 uint32_t const entsize)
+{
+	write_u32(name);
+	write_u32(type);
+	write_u32(flags);
+	write_u32(0); /* address */
+	write_u32(offset);
+	write_u32(size);
+	write_u32(link);
+	write_u32(info);
+	write_u32(alignment);
+	write_u32(entsize);
+}
+
+static uint32_t align_offset(uint32_t const offset, uint32_t const alignment)
+{
+	return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+static void write_object_file(void)
+{
+	/* symbol table: null symbol, section symbols, local and then global
+	 * symbols */
+	size_t const   n_sections     = ARR_LEN(sections);
+	elf_symbol_t **symtab         = NEW_ARR_F(elf_symbol_t*, 0);
+	unsigned       n_relsections  = 0;
+	for (size_t i = 0; i < n_sections; ++i) {
+		elf_section_t *const section = sections[i];
+		section->index = i + 1;
+		ARR_APP1(elf_symbol_t*, symtab, section->symbol);
+		if (ARR_LEN(section->relocs) > 0)
+			section->rel_index = n_sections + 1 + n_relsections++;
+	}
+	for (size_t i = 0, n = ARR_LEN(symbols); i < n; ++i) {
+		if (get_symbol_binding(symbols[i]) == STB_LOCAL)
+			ARR_APP1(elf_symbol_t*, symtab, symbols[i]);
+	}
+	uint32_t const first_global = ARR_LEN(symtab) + 1;
+	for (size_t i = 0, n = ARR_LEN(symbols); i < n; ++i) {
+		if (get_symbol_binding(symbols[i]) != STB_LOCAL)
+			ARR_APP1(elf_symbol_t*, symtab, symbols[i]);
+	}
+	size_t const n_symbols = ARR_LEN(symtab);
+	for (size_t i = 0; i < n_symbols; ++i) {
+		symtab[i]->index = i + 1;
+	}
+
+	struct obstack strtab;
+	obstack_init(&strtab);
+	obstack_1grow(&strtab, '\0');
+	uint32_t *const symbol_names = NEW_ARR_F(uint32_t, n_symbols);
+	for (size_t i = 0; i < n_symbols; ++i) {
+		symbol_names[i] = add_symbol_name(&strtab, symtab[i]);
+	}
+	uint32_t const strtab_size = obstack_object_size(&strtab);
+	char    *const strtab_data = (char*)obstack_finish(&strtab);
+
+	/* section header string table */
+	struct obstack shstrtab;
+	obstack_init(&shstrtab);
+	obstack_1grow(&shstrtab, '\0');
+	uint32_t *const section_names = NEW_ARR_F(uint32_t, n_sections);
+	uint32_t *const rel_names     = NEW_ARR_F(uint32_t, n_sections);
+	for (size_t i = 0; i < n_sections; ++i) {
+		elf_section_t const *const section = sections[i];
+		section_names[i] = add_string(&shstrtab, section->name);
+		if (section->rel_index != 0) {
+			uint32_t const offset = obstack_object_size(&shstrtab);
+			obstack_printf(&shstrtab, ".rel%s", section->name);
+			obstack_1grow(&shstrtab, '\0');
+			rel_names[i] = offset;
+		}
+	}
+	uint32_t const symtab_name    = add_string(&shstrtab, ".symtab");
+	uint32_t const strtab_name    = add_string(&shstrtab, ".strtab");
+	uint32_t const shstrtab_name  = add_string(&shstrtab, ".shstrtab");
+	uint32_t const gnustack_name  = add_string(&shstrtab, ".note.GNU-stack");
+	uint32_t const shstrtab_size  = obstack_object_size(&shstrtab);
+	char    *const shstrtab_data  = (char*)obstack_finish(&shstrtab);
+
+	/* layout */
+	uint32_t  offset          = ELF32_EHDR_SIZE;
+	uint32_t *section_offsets = NEW_ARR_F(uint32_t, n_sections);
+	uint32_t *rel_offsets     = NEW_ARR_F(uint32_t, n_sections);
+	for (size_t i = 0; i < n_sections; ++i) {
+		elf_section_t const *const section = sections[i];
+		offset             = align_offset(offset, section->alignment);
+		section_offsets[i] = offset;
+		if (section->data != NULL)
+			offset += section->size;
+	}
+	for (size_t i = 0; i < n_sections; ++i) {
+		if (sections[i]->rel_index == 0)
+			continue;
+		offset         = align_offset(offset, 4);
+		rel_offsets[i] = offset;
+		offset        += ARR_LEN(sections[i]->relocs) * ELF32_REL_SIZE;
+	}
+	uint32_t const symtab_offset   = offset = align_offset(offset, 4);
+	offset += (n_symbols + 1) * ELF32_SYM_SIZE;
+	uint32_t const strtab_offset   = offset;
+	offset += strtab_size;
+	uint32_t const shstrtab_offset = offset;
+	offset += shstrtab_size;
+	uint32_t const shdr_offset     = align_offset(offset, 4);
+
+	unsigned const symtab_index   = n_sections + 1 + n_relsections;
+	unsigned const strtab_index   = symtab_index + 1;
+	unsigned const shstrtab_index = symtab_index + 2;
+	unsigned const n_headers      = symtab_index + 4;
+
+	/* ELF header */
+	static const unsigned char ident[16] = {
+		0x7f, 'E', 'L', 'F', ELFCLASS32, ELFDATA2LSB, EV_CURRENT
+	};
+	fwrite(ident, 1, sizeof(ident), elf_output);
+	write_u16(ET_REL);
+	write_u16(elf_machine);
+	write_u32(EV_CURRENT);
+	write_u32(0); /* entry */
+	write_u32(0); /* program headers */
+	write_u32(shdr_offset);
+	write_u32(0); /* flags */
+	write_u16(ELF32_EHDR_SIZE);
+	write_u16(0); /* program header entry size */
+	write_u16(0); /* number of program headers */
+	write_u16(ELF32_SHDR_SIZE);
+	write_u16(n_headers);
+	write_u16(shstrtab_index);
+
+	/* section contents */
+	offset = ELF32_EHDR_SIZE;
+	for (size_t i = 0; i < n_sections; ++i) {
+		elf_section_t const *const section = sections[i];
+		if (section->data == NULL)
+			continue;
+		write_padding(offset, section_offsets[i]);
+		fwrite(section->data, 1, section->size, elf_output);
+		offset = section_offsets[i] + section->size;
+	}
+	for (size_t i = 0; i < n_sections; ++i) {
+		elf_section_t const *const section = sections[i];
+		if (section->rel_index == 0)
+			continue;
+		write_padding(offset, rel_offsets[i]);
+		for (size_t r = 0, n = ARR_LEN(section->relocs); r < n; ++r) {
+			elf_reloc_t const *const reloc = &section->relocs[r];
+			write_u32(reloc->offset);
+			write_u32(reloc->symbol->index << 8 | (reloc->type & 0xFF));
+		}
+		offset = rel_offsets[i] + ARR_LEN(section->relocs) * ELF32_REL_SIZE;
+	}
+
+	write_padding(offset, symtab_offset);
+	for (unsigned i = 0; i < ELF32_SYM_SIZE; ++i)
+		write_u8(0);
+	for (size_t i = 0; i < n_symbols; ++i) {
+		elf_symbol_t const *const symbol = symtab[i];
+		uint16_t shndx = SHN_UNDEF;
+		if (symbol->common) {
+			shndx = SHN_COMMON;
+		} else if (symbol->section != NULL) {
+			shndx = symbol->section->index;
+		}
+		uint8_t other = STV_DEFAULT;
+		if (symbol->entity != NULL
+		 && get_entity_visibility(symbol->entity) == ir_visibility_external_private)
+			other = STV_HIDDEN;
+		write_u32(symbol_names[i]);
+		write_u32(symbol->value);
+		write_u32(symbol->size);
+		write_u8(get_symbol_binding(symbol) << 4 | symbol->type);
+		write_u8(other);
+		write_u16(shndx);
+	}
+	fwrite(strtab_data, 1, strtab_size, elf_output);
+	fwrite(shstrtab_data, 1, shstrtab_size, elf_output);
+	write_padding(shstrtab_offset + shstrtab_size, shdr_offset);
+
+	/* section headers */
+	write_section_header(0, SHT_NULL, 0, 0, 0, 0, 0, 0, 0);
+	for (size_t i = 0; i < n_sections; ++i) {
+		elf_section_t const *const section = sections[i];
+		write_section_header(section_names[i], section->type, section->flags,
+		                     section_offsets[i], section->size, 0, 0,
+		                     section->alignment, 0);
+	}
+	for (size_t i = 0; i < n_sections; ++i) {
+		elf_section_t const *const section = sections[i];
+		if (section->rel_index == 0)
+			continue;
+		write_section_header(rel_names[i], SHT_REL, SHF_INFO_LINK,
+		                     rel_offsets[i],
+		                     ARR_LEN(section->relocs) * ELF32_REL_SIZE,
+		                     symtab_index, section->index, 4, ELF32_REL_SIZE);
+	}
+	write_section_header(symtab_name, SHT_SYMTAB, 0, symtab_offset,
+	                     (n_symbols + 1) * ELF32_SYM_SIZE, strtab_index,
+	                     first_global, 4, ELF32_SYM_SIZE);
+	write_section_header(strtab_name, SHT_STRTAB, 0, strtab_offset,
+	                     strtab_size, 0, 0, 1, 0);
+	write_section_header(shstrtab_name, SHT_STRTAB, 0, shstrtab_offset,
+	                     shstrtab_size, 0, 0, 1, 0);
+	/* marks the stack as non-executable */
+	write_section_header(gnustack_name, SHT_PROGBITS, 0, shdr_offset, 0, 0, 0,
+	                     1, 0);
+
+	DEL_ARR_F(rel_offsets);
+	DEL_ARR_F(section_offsets);
+	DEL_ARR_F(rel_names);
+	DEL_ARR_F(section_names);
+	DEL_ARR_F(symbol_names);
+	DEL_ARR_F(symtab);
+	obstack_free(&shstrtab, NULL);
+	obstack_free(&strtab, NULL);
+}
+
+void be_elf_begin_compilation_unit(FILE *const output,
+                                   const be_main_env_t *const env)
+{
+	(void)env;
+	assert(elf_output_selected);
+
+	if (be_options.pic)
+		panic("PIC code not supported in ELF object output");
+	if (get_irp_n_asms() > 0)
+		panic("global assembler not supported in ELF object output");
+	if (be_dwarf_disable())
+		be_warningf(NULL, "debug info not supported in ELF object output");
+
+	elf_output     = output;
+	obstack_init(&obst);
+	sections       = NEW_ARR_F(elf_section_t*, 0);
+	symbols        = NEW_ARR_F(elf_symbol_t*, 0);
+	entity_symbols = pmap_create();
+	block_offsets  = pmap_create();
+	block_fixups   = NEW_ARR_F(block_fixup_t, 0);
+	jump_tables    = NEW_ARR_F(jump_table_t, 0);
+	text           = get_section(".text", SHT_PROGBITS,
+	                             SHF_ALLOC | SHF_EXECINSTR);
+}
+
+void be_elf_end_compilation_unit(const be_main_env_t *const env)
+{
+	emit_globals(get_glob_type(), env);
+	emit_globals(get_tls_type(), env);
+	emit_globals(get_segment_type(IR_SEGMENT_CONSTRUCTORS), env);
+	emit_globals(get_segment_type(IR_SEGMENT_DESTRUCTORS), env);
+	emit_globals(get_segment_type(IR_SEGMENT_JCR), env);
+	resolve_aliases();
+
+	write_object_file();
+
+	for (size_t i = 0, n = ARR_LEN(sections); i < n; ++i) {
+		elf_section_t *const section = sections[i];
+		if (section->data != NULL)
+			DEL_ARR_F(section->data);
+		DEL_ARR_F(section->relocs);
+	}
+	DEL_ARR_F(jump_tables);
+	DEL_ARR_F(block_fixups);
+	pmap_destroy(block_offsets);
+	pmap_destroy(entity_symbols);
+	DEL_ARR_F(symbols);
+	DEL_ARR_F(sections);
+	obstack_free(&obst, NULL);
+	elf_output          = NULL;
+	elf_output_selected = false;
+}
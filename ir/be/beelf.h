@@ -0,0 +1,118 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Writes relocatable ELF object files directly.
+ *
+ * This is the counterpart of begnuas for backends with a binary emitter:
+ * Instead of producing assembler text, machine code bytes are collected in
+ * sections and written out together with a symbol table and relocations
+ * when the compilation unit ends.
+ */
+#ifndef FIRM_BE_BEELF_H
+#define FIRM_BE_BEELF_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "be_types.h"
+#include "begnuas.h"
+#include "firm_types.h"
+
+/** ELF machine numbers (e_machine) */
+enum {
+	BE_ELF_EM_386 = 3,
+};
+
+/** i386 relocation types */
+enum {
+	BE_ELF_R_386_32     = 1,  /**< S + A */
+	BE_ELF_R_386_PC32   = 2,  /**< S + A - P */
+	BE_ELF_R_386_TLS_IE = 15, /**< address of GOT entry for negative TLS offset */
+	BE_ELF_R_386_TLS_LE = 17, /**< negative offset relative to static TLS */
+};
+
+/**
+ * Selects direct ELF object file output for the next compilation unit.
+ *
+ * @param machine      the ELF machine number
+ * @param reloc_abs32  relocation type for absolute 32bit addresses
+ */
+void be_elf_select_output(uint16_t machine, uint32_t reloc_abs32);
+
+/**
+ * Returns true if the current compilation unit is written as an ELF object
+ * file instead of assembler text.
+ */
+bool be_elf_output_selected(void);
+
+/**
+ * Starts a compilation unit. The object file is written to @p output at the
+ * end of the unit.
+ */
+void be_elf_begin_compilation_unit(FILE *output, const be_main_env_t *env);
+
+/**
+ * Ends a compilation unit: emits all global entities and writes the object
+ * file.
+ */
+void be_elf_end_compilation_unit(const be_main_env_t *env);
+
+/**
+ * Starts the code of a function in the text section.
+ */
+void be_elf_begin_function(const ir_entity *entity, unsigned po2alignment);
+
+/**
+ * Ends the code of a function: resolves jumps to blocks and emits the jump
+ * tables of the function.
+ */
+void be_elf_end_function(const ir_entity *entity);
+
+/**
+ * Marks the current code position as start of @p block.
+ */
+void be_elf_begin_block(const ir_node *block);
+
+/**
+ * Pads the code with @p fill bytes to a multiple of 2^po2alignment if this
+ * takes at most @p max_skip bytes.
+ */
+void be_elf_align_code(unsigned po2alignment, unsigned max_skip,
+                       uint8_t fill);
+
+/** appends a byte to the code */
+void be_elf_emit8(uint8_t byte);
+
+/** appends a word (16bits) to the code */
+void be_elf_emit16(uint16_t u16);
+
+/** appends a dword (32bits) to the code */
+void be_elf_emit32(uint32_t u32);
+
+/**
+ * Appends a 32bit field referencing @p entity which is resolved by the linker
+ * according to relocation type @p type. @p addend is stored in the field.
+ */
+void be_elf_emit_reloc32(const ir_entity *entity, int32_t addend,
+                         uint32_t type);
+
+/**
+ * Appends a 32bit displacement from the end of the field to the start of
+ * @p block. The displacement is resolved at the end of the function.
+ */
+void be_elf_emit_block_ref32(const ir_node *block);
+
+/**
+ * Records a jump table for switch operations, which is emitted into the
+ * read-only data section at the end of the function.
+ */
+void be_elf_emit_jump_table(const ir_node *node, const ir_switch_table *table,
+                            ir_entity *entity,
+                            get_cfop_target_func get_cfop_target);
+
+#endif
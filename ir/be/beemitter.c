@@ -23,6 +23,8 @@
 FILE           *emit_file;
 struct obstack  emit_obst;
 
+static struct obstack *capture_obst;
+
 void be_emit_init(FILE *file)
 {
 	emit_file = file;
@@ -52,9 +54,22 @@ void be_emit_write_line(void)
 	size_t const len  = obstack_object_size(&emit_obst);
 	char  *const line = (char*)obstack_finish(&emit_obst);
 	fwrite(line, 1, len, emit_file);
+	if (capture_obst != NULL)
+		obstack_grow(capture_obst, line, len);
 	obstack_free(&emit_obst, line);
 }
 
+void be_emit_begin_capture(struct obstack *obst)
+{
+	assert(capture_obst == NULL);
+	capture_obst = obst;
+}
+
+void be_emit_end_capture(void)
+{
+	capture_obst = NULL;
+}
+
 void be_emit_pad_comment(void)
 {
 	size_t len = obstack_object_size(&emit_obst);
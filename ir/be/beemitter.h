@@ -93,6 +93,17 @@ void be_emit_irvprintf(const char *fmt, va_list args);
  */
 void be_emit_write_line(void);
 
+/**
+ * Additionally append the flushed lines to @p obst until be_emit_end_capture()
+ * is called.
+ */
+void be_emit_begin_capture(struct obstack *obst);
+
+/**
+ * Stop capturing, flushed lines are written to the emitter file again.
+ */
+void be_emit_end_capture(void);
+
 /**
  * Flush the line in the current line buffer to the emitter file and
  * appends a gas-style comment with the node number and writes the line
@@ -379,7 +379,7 @@ static bool entity_is_string_const(const ir_entity *ent, bool only_suffix_null)
 	return initializer_is_string_const(init, only_suffix_null);
 }
 
-static bool entity_is_null(const ir_entity *entity)
+bool be_gas_entity_is_null(const ir_entity *entity)
 {
 	ir_initializer_t *initializer = get_entity_initializer(entity);
 	return initializer == NULL || initializer_is_null(initializer);
@@ -406,13 +406,13 @@ static be_gas_section_t determine_basic_section(const ir_entity *entity)
 
 		return GAS_SECTION_RODATA;
 	}
-	if (entity_is_null(entity) && !is_alias_entity(entity))
+	if (be_gas_entity_is_null(entity) && !is_alias_entity(entity))
 		return GAS_SECTION_BSS;
 
 	return GAS_SECTION_DATA;
 }
 
-static be_gas_section_t determine_section(be_main_env_t const *const main_env, ir_entity const *const entity)
+be_gas_section_t be_gas_determine_section(be_main_env_t const *const main_env, ir_entity const *const entity)
 {
 	ir_type *owner = get_entity_owner(entity);
 
@@ -524,7 +524,7 @@ void be_gas_emit_function_prolog(const ir_entity *entity, unsigned po2alignment,
 {
 	be_dwarf_method_before(entity, parameter_infos);
 
-	be_gas_section_t section = determine_section(NULL, entity);
+	be_gas_section_t section = be_gas_determine_section(NULL, entity);
 	emit_section(section, entity);
 
 	/* write the begin line (makes the life easier for scripts parsing the
@@ -799,7 +799,7 @@ typedef struct {
 	} v;
 } normal_or_bitfield;
 
-static size_t get_initializer_size(const ir_initializer_t *initializer,
+size_t be_gas_get_initializer_size(const ir_initializer_t *initializer,
                                    ir_type *type)
 {
 	switch (get_initializer_kind(initializer)) {
@@ -835,7 +835,7 @@ static size_t get_initializer_size(const ir_initializer_t *initializer,
 				const ir_entity *last_ent  = get_compound_member(type, l);
 				ir_type         *last_type = get_entity_type(last_ent);
 				assert(is_array_variable_size(last_type));
-				size += get_initializer_size(last, last_type);
+				size += be_gas_get_initializer_size(last, last_type);
 			}
 			return size;
 		}
@@ -1066,7 +1066,7 @@ static void emit_initializer(ir_entity const *const entity)
 	}
 
 	ir_type *type = get_entity_type(entity);
-	size_t   size = get_initializer_size(initializer, type);
+	size_t   size = be_gas_get_initializer_size(initializer, type);
 	if (size == 0)
 		return;
 
@@ -1134,7 +1134,7 @@ static void emit_align(unsigned p2alignment)
 	be_emit_write_line();
 }
 
-static unsigned get_effective_entity_alignment(const ir_entity *entity)
+unsigned be_gas_get_entity_alignment(const ir_entity *entity)
 {
 	unsigned alignment = get_entity_alignment(entity);
 	if (alignment == 0) {
@@ -1147,7 +1147,7 @@ static unsigned get_effective_entity_alignment(const ir_entity *entity)
 static void emit_common(const ir_entity *entity, bool is_local)
 {
 	unsigned const size      = get_type_size_bytes(get_entity_type(entity));
-	unsigned const alignment = get_effective_entity_alignment(entity);
+	unsigned const alignment = be_gas_get_entity_alignment(entity);
 
 	switch (be_gas_object_file_format) {
 	case OBJECT_FILE_FORMAT_MACH_O:
@@ -1267,6 +1267,52 @@ void be_gas_emit_block_name(const ir_node *block)
 	}
 }
 
+void be_gas_forget_section(void)
+{
+	current_section = (be_gas_section_t)-1;
+}
+
+unsigned be_gas_get_next_block_nr(void)
+{
+	return next_block_nr;
+}
+
+unsigned be_gas_reserve_block_nrs(unsigned n)
+{
+	unsigned const base = next_block_nr;
+	next_block_nr += n;
+	return base;
+}
+
+void be_gas_emit_moved_block_names(char const *const text, size_t const len,
+                                   unsigned const old_base, unsigned const n,
+                                   unsigned const new_base)
+{
+	/* block names are the only private names starting with a digit */
+	char const *const prefix     = be_gas_get_private_prefix();
+	size_t      const prefix_len = strlen(prefix);
+	char const *const end        = text + len;
+	char const       *flushed    = text;
+	for (char const *c = text; c + prefix_len < end; ++c) {
+		if (memcmp(c, prefix, prefix_len) != 0
+		    || !isdigit((unsigned char)c[prefix_len]))
+			continue;
+		char const   *digits = c + prefix_len;
+		char const   *e      = digits;
+		unsigned long nr     = 0;
+		while (e < end && isdigit((unsigned char)*e))
+			nr = nr * 10 + (unsigned long)(*e++ - '0');
+		if (nr < old_base || nr - old_base >= n)
+			continue;
+		be_emit_string_len(flushed, digits - flushed);
+		be_emit_irprintf("%lu", nr - old_base + new_base);
+		flushed = e;
+		c       = e - 1;
+	}
+	be_emit_string_len(flushed, end - flushed);
+	be_emit_write_line();
+}
+
 void be_gas_begin_block(const ir_node *block, bool needs_label)
 {
 	if (needs_label) {
@@ -1319,7 +1365,7 @@ static void emit_global(be_main_env_t const *const main_env,
 
 	/* we already emitted all methods with graphs in other functions like
 	 * be_gas_emit_function_prolog(). All others don't need to be emitted. */
-	be_gas_section_t const section = determine_section(main_env, entity);
+	be_gas_section_t const section = be_gas_determine_section(main_env, entity);
 	if (kind == IR_ENTITY_METHOD && section != GAS_SECTION_PIC_TRAMPOLINES)
 		return;
 
@@ -1354,7 +1400,7 @@ static void emit_global(be_main_env_t const *const main_env,
 			return;
 
 		/* alignment */
-		unsigned alignment = get_effective_entity_alignment(entity);
+		unsigned alignment = be_gas_get_entity_alignment(entity);
 		if (!is_po2(alignment))
 			panic("alignment not a power of 2");
 		if (alignment > 1) {
@@ -1379,7 +1425,7 @@ static void emit_global(be_main_env_t const *const main_env,
 			be_emit_write_line();
 		}
 
-		if (entity_is_null(entity)) {
+		if (be_gas_entity_is_null(entity)) {
 			/* we should use .space for stuff in the bss segment */
 			ir_type *const type = get_entity_type(entity);
 			unsigned const size = get_type_size_bytes(type);
@@ -1430,8 +1476,10 @@ static void emit_global_decls(const be_main_env_t *main_env)
 	}
 }
 
-void be_emit_jump_table(const ir_node *node, const ir_switch_table *table,
-                        ir_entity *entity, get_cfop_target_func get_cfop_target)
+const ir_node **be_get_jump_table_targets(const ir_node *node,
+                                          const ir_switch_table *table,
+                                          get_cfop_target_func get_cfop_target,
+                                          unsigned long *length_out)
 {
 	/* go over all proj's and collect their jump targets */
 	unsigned        n_outs  = arch_get_irn_n_outs(node);
@@ -1497,6 +1545,24 @@ void be_emit_jump_table(const ir_node *node, const ir_switch_table *table,
 		}
 	}
 
+	/* unused entries jump to the default target */
+	for (unsigned long i = 0; i < length; ++i) {
+		if (labels[i] == NULL)
+			labels[i] = targets[0];
+	}
+	free(targets);
+
+	*length_out = length;
+	return labels;
+}
+
+void be_emit_jump_table(const ir_node *node, const ir_switch_table *table,
+                        ir_entity *entity, get_cfop_target_func get_cfop_target)
+{
+	unsigned long   length;
+	const ir_node **labels
+		= be_get_jump_table_targets(node, table, get_cfop_target, &length);
+
 	/* emit table */
 	unsigned pointer_size = get_mode_size_bytes(mode_P);
 	if (entity != NULL) {
@@ -1507,11 +1573,8 @@ void be_emit_jump_table(const ir_node *node, const ir_switch_table *table,
 	}
 
 	for (unsigned long i = 0; i < length; ++i) {
-		const ir_node *block = labels[i];
-		if (block == NULL)
-			block = targets[0];
 		emit_size_type(pointer_size);
-		be_gas_emit_block_name(block);
+		be_gas_emit_block_name(labels[i]);
 		be_emit_char('\n');
 		be_emit_write_line();
 	}
@@ -1520,7 +1583,6 @@ void be_emit_jump_table(const ir_node *node, const ir_switch_table *table,
 		be_gas_emit_switch_section(GAS_SECTION_TEXT);
 
 	free(labels);
-	free(targets);
 }
 
 static void emit_global_asms(void)
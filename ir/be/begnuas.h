@@ -91,6 +91,31 @@ void be_gas_emit_block_name(const ir_node *block);
  */
 void be_gas_begin_block(const ir_node *block, bool needs_label);
 
+/**
+ * Forget the current section, so the next section switch is emitted even if
+ * it does not change the section.
+ */
+void be_gas_forget_section(void);
+
+/**
+ * Returns the number of the next block name.
+ */
+unsigned be_gas_get_next_block_nr(void);
+
+/**
+ * Advance the block numbers by @p n as if a function using them was emitted.
+ * Returns the first reserved block number.
+ */
+unsigned be_gas_reserve_block_nrs(unsigned n);
+
+/**
+ * Emit @p text and move the block names with numbers from @p old_base to
+ * @p old_base + @p n to the numbers starting at @p new_base.
+ */
+void be_gas_emit_moved_block_names(char const *text, size_t len,
+                                   unsigned old_base, unsigned n,
+                                   unsigned new_base);
+
 /**
  * emit a string (takes care of escaping special chars)
  */
@@ -129,6 +154,42 @@ void be_emit_jump_table(const ir_node *node, const ir_switch_table *table,
                         ir_entity *entity,
                         get_cfop_target_func get_cfop_target);
 
+/**
+ * Computes the target blocks of a jump table for switch operations.
+ * Entries not covered by the switch table point to the default target.
+ *
+ * @param length  receives the number of table entries
+ * @return        an xmalloc()ed array of target blocks, free it after use
+ */
+const ir_node **be_get_jump_table_targets(const ir_node *node,
+                                          const ir_switch_table *table,
+                                          get_cfop_target_func get_cfop_target,
+                                          unsigned long *length);
+
+/**
+ * Determines the section an entity is placed in.
+ */
+be_gas_section_t be_gas_determine_section(be_main_env_t const *main_env,
+                                          ir_entity const *entity);
+
+/**
+ * Returns true if the entity has no initializer or a zero initializer.
+ */
+bool be_gas_entity_is_null(const ir_entity *entity);
+
+/**
+ * Returns the alignment of an entity, falling back to the alignment of its
+ * type if the entity does not specify one.
+ */
+unsigned be_gas_get_entity_alignment(const ir_entity *entity);
+
+/**
+ * Returns the number of bytes occupied by an initializer for the given type.
+ * This differs from the type size for variable sized compounds.
+ */
+size_t be_gas_get_initializer_size(const ir_initializer_t *initializer,
+                                   ir_type *type);
+
 bool be_gas_produces_dwarf_line_info(void);
 
 #endif
@@ -10,15 +10,20 @@
  * @date        18.11.2005
  */
 #include <stdlib.h>
+#include <string.h>
 
+#include "array.h"
+#include "raw_bitset.h"
 #include "lc_opts.h"
 #include "lc_opts_enum.h"
+#include "panic.h"
 
 #include "timing.h"
 #include "bitset.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
 #include "beifg.h"
+#include "util.h"
 #include "xmalloc.h"
 
 #include "becopystat.h"
@@ -26,11 +31,39 @@
 #include "bemodule.h"
 #include "belive.h"
 
+/** Explicit graphs with at most this many nodes get a bit matrix. */
+#define IFG_MATRIX_MAX_NODES 2048
+
 void be_ifg_free(be_ifg_t *self)
 {
+	free(self->nodes);
+	free(self->node_nums);
+	free(self->adj_begin);
+	free(self->adj);
+	free(self->matrix);
 	free(self);
 }
 
+/**
+ * Returns the number + 1 of a node in an explicit graph, 0 if the node is
+ * not part of the graph.
+ */
+static unsigned get_node_num(const be_ifg_t *ifg, const ir_node *irn)
+{
+	unsigned const idx = get_irn_idx(irn);
+	return idx < ifg->n_idx ? ifg->node_nums[idx] : 0;
+}
+
+static size_t matrix_bit(unsigned a, unsigned b)
+{
+	if (a > b) {
+		unsigned const t = a;
+		a = b;
+		b = t;
+	}
+	return (size_t)b * (b - 1) / 2 + a;
+}
+
 static void nodes_walker(ir_node *bl, void *data)
 {
 	nodes_iter_t     *it   = (nodes_iter_t*)data;
@@ -52,6 +85,12 @@ nodes_iter_t be_ifg_nodes_begin(be_ifg_t const *const ifg)
 	iter.curr = 0;
 	iter.env  = ifg->env;
 
+	if (ifg->is_explicit) {
+		iter.n     = ifg->n_defs;
+		iter.nodes = ifg->nodes;
+		return iter;
+	}
+
 	irg_block_walk_graph(ifg->env->irg, nodes_walker, NULL, &iter);
 	obstack_ptr_grow(&iter.obst, NULL);
 	iter.nodes = (ir_node**)obstack_finish(&iter.obst);
@@ -103,6 +142,7 @@ static void find_neighbours(const be_ifg_t *ifg, neighbours_iter_t *it, const ir
 	it->env         = ifg->env;
 	it->irn         = irn;
 	it->valid       = 1;
+	it->ifg         = NULL;
 	ir_nodeset_init(&it->neighbours);
 
 	dom_tree_walk(get_nodes_block(irn), find_neighbour_walker, NULL, it);
@@ -131,17 +171,39 @@ static ir_node *get_next_neighbour(neighbours_iter_t *it)
 ir_node *be_ifg_neighbours_begin(const be_ifg_t *ifg, neighbours_iter_t *iter,
                                  const ir_node *irn)
 {
+	unsigned const num = get_node_num(ifg, irn);
+	if (num != 0) {
+		iter->env   = ifg->env;
+		iter->irn   = irn;
+		iter->valid = 1;
+		iter->ifg   = ifg;
+		iter->pos   = ifg->adj_begin[num - 1];
+		iter->end   = ifg->adj_begin[num];
+		return be_ifg_neighbours_next(iter);
+	}
+
 	find_neighbours(ifg, iter, irn);
 	return get_next_neighbour(iter);
 }
 
 ir_node *be_ifg_neighbours_next(neighbours_iter_t *iter)
 {
+	const be_ifg_t *ifg = iter->ifg;
+	if (ifg != NULL) {
+		if (iter->pos < iter->end)
+			return ifg->nodes[ifg->adj[iter->pos++]];
+		iter->valid = 0;
+		return NULL;
+	}
 	return get_next_neighbour(iter);
 }
 
 void be_ifg_neighbours_break(neighbours_iter_t *iter)
 {
+	if (iter->ifg != NULL) {
+		iter->valid = 0;
+		return;
+	}
 	neighbours_break(iter, 1);
 }
 
@@ -244,6 +306,10 @@ void be_ifg_cliques_break(cliques_iter_t *iter)
 
 int be_ifg_degree(const be_ifg_t *ifg, const ir_node *irn)
 {
+	unsigned const num = get_node_num(ifg, irn);
+	if (num != 0)
+		return ifg->adj_begin[num] - ifg->adj_begin[num - 1];
+
 	neighbours_iter_t it;
 	int degree;
 	find_neighbours(ifg, &it, irn);
@@ -252,11 +318,267 @@ int be_ifg_degree(const be_ifg_t *ifg, const ir_node *irn)
 	return degree;
 }
 
+/**
+ * Binary search for @p num in the neighbours of node @p node.
+ */
+static bool adj_contains(const be_ifg_t *ifg, unsigned node, unsigned num)
+{
+	unsigned lo = ifg->adj_begin[node];
+	unsigned hi = ifg->adj_begin[node + 1];
+	while (lo < hi) {
+		unsigned const mid = lo + (hi - lo) / 2;
+		unsigned const val = ifg->adj[mid];
+		if (val == num)
+			return true;
+		if (val < num)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return false;
+}
+
+bool be_ifg_connected(const be_ifg_t *ifg, const ir_node *a, const ir_node *b)
+{
+	assert(a != b);
+	unsigned const num_a = get_node_num(ifg, a);
+	unsigned const num_b = get_node_num(ifg, b);
+	if (num_a == 0 || num_b == 0)
+		return be_values_interfere(a, b);
+
+	if (ifg->matrix != NULL)
+		return rbitset_is_set(ifg->matrix, matrix_bit(num_a - 1, num_b - 1));
+
+	/* search in the shorter neighbour vector */
+	unsigned const deg_a = ifg->adj_begin[num_a] - ifg->adj_begin[num_a - 1];
+	unsigned const deg_b = ifg->adj_begin[num_b] - ifg->adj_begin[num_b - 1];
+	if (deg_a <= deg_b)
+		return adj_contains(ifg, num_a - 1, num_b - 1);
+	else
+		return adj_contains(ifg, num_b - 1, num_a - 1);
+}
+
+typedef struct ifg_edge_t {
+	unsigned a;
+	unsigned b;
+} ifg_edge_t;
+
+typedef struct build_env_t {
+	be_ifg_t   *ifg;
+	ir_node   **nodes;  /**< nodes by number */
+	ifg_edge_t *edges;  /**< interference edges, may contain duplicates
+	                         if there is no bit matrix */
+	unsigned   *living; /**< numbers of the currently living nodes */
+} build_env_t;
+
+static void number_node(build_env_t *env, ir_node *irn)
+{
+	unsigned *const num = &env->ifg->node_nums[get_irn_idx(irn)];
+	if (*num == 0) {
+		ARR_APP1(ir_node*, env->nodes, irn);
+		*num = ARR_LEN(env->nodes);
+	}
+}
+
+/**
+ * Numbers the nodes with a real definition in the order be_ifg_nodes_begin()
+ * of the implicit graph would return them.
+ */
+static void number_defs_walker(ir_node *block, void *data)
+{
+	build_env_t      *env  = (build_env_t*)data;
+	struct list_head *head = get_block_border_head(env->ifg->env, block);
+	foreach_border_head(head, b) {
+		if (b->is_def && b->is_real)
+			number_node(env, b->irn);
+	}
+}
+
+/**
+ * Numbers the remaining nodes which only occur as live-in values.
+ */
+static void number_live_ins_walker(ir_node *block, void *data)
+{
+	build_env_t      *env  = (build_env_t*)data;
+	struct list_head *head = get_block_border_head(env->ifg->env, block);
+	foreach_border_head(head, b) {
+		if (b->is_def)
+			number_node(env, b->irn);
+	}
+}
+
+static void add_edge(build_env_t *env, unsigned a, unsigned b)
+{
+	unsigned *const matrix = env->ifg->matrix;
+	if (matrix != NULL) {
+		size_t const bit = matrix_bit(a, b);
+		if (rbitset_is_set(matrix, bit))
+			return;
+		rbitset_set(matrix, bit);
+	}
+	ifg_edge_t const edge = { a, b };
+	ARR_APP1(ifg_edge_t, env->edges, edge);
+}
+
+/**
+ * Collects the interference edges of a block: Every value interferes with
+ * the values living at its definition.
+ */
+static void edges_walker(ir_node *block, void *data)
+{
+	build_env_t      *env  = (build_env_t*)data;
+	be_ifg_t         *ifg  = env->ifg;
+	struct list_head *head = get_block_border_head(ifg->env, block);
+
+	ARR_SHRINKLEN(env->living, 0);
+	foreach_border_head(head, b) {
+		unsigned const num = ifg->node_nums[get_irn_idx(b->irn)] - 1;
+		if (b->is_def) {
+			for (size_t i = 0, n = ARR_LEN(env->living); i < n; ++i)
+				add_edge(env, env->living[i], num);
+			ARR_APP1(unsigned, env->living, num);
+		} else {
+			size_t const n = ARR_LEN(env->living);
+			for (size_t i = 0; i < n; ++i) {
+				if (env->living[i] == num) {
+					env->living[i] = env->living[n - 1];
+					ARR_SHRINKLEN(env->living, n - 1);
+					break;
+				}
+			}
+		}
+	}
+}
+
+static int cmp_unsigned(const void *a, const void *b)
+{
+	unsigned const ua = *(const unsigned*)a;
+	unsigned const ub = *(const unsigned*)b;
+	return (ua > ub) - (ua < ub);
+}
+
+/**
+ * Builds the explicit representation of the interference graph.
+ */
+static void build_explicit_ifg(be_ifg_t *ifg)
+{
+	ir_graph   *irg = ifg->env->irg;
+	build_env_t env;
+	env.ifg    = ifg;
+	env.nodes  = NEW_ARR_F(ir_node*, 0);
+	env.edges  = NEW_ARR_F(ifg_edge_t, 0);
+	env.living = NEW_ARR_F(unsigned, 0);
+
+	ifg->n_idx     = get_irg_last_idx(irg);
+	ifg->node_nums = XMALLOCNZ(unsigned, ifg->n_idx);
+	irg_block_walk_graph(irg, number_defs_walker, NULL, &env);
+	ifg->n_defs = ARR_LEN(env.nodes);
+	irg_block_walk_graph(irg, number_live_ins_walker, NULL, &env);
+
+	unsigned const n_nodes = ARR_LEN(env.nodes);
+	ifg->n_nodes = n_nodes;
+	ifg->nodes   = XMALLOCN(ir_node*, n_nodes);
+	MEMCPY(ifg->nodes, env.nodes, n_nodes);
+	if (n_nodes <= IFG_MATRIX_MAX_NODES)
+		ifg->matrix = rbitset_malloc(matrix_bit(0, n_nodes));
+
+	irg_block_walk_graph(irg, edges_walker, NULL, &env);
+
+	/* distribute the edges into neighbour vectors */
+	unsigned *const adj_begin = XMALLOCNZ(unsigned, n_nodes + 1);
+	for (size_t i = 0, n = ARR_LEN(env.edges); i < n; ++i) {
+		++adj_begin[env.edges[i].a + 1];
+		++adj_begin[env.edges[i].b + 1];
+	}
+	for (unsigned i = 0; i < n_nodes; ++i)
+		adj_begin[i + 1] += adj_begin[i];
+
+	unsigned *const adj  = XMALLOCN(unsigned, adj_begin[n_nodes]);
+	unsigned *const fill = XMALLOCN(unsigned, n_nodes);
+	MEMCPY(fill, adj_begin, n_nodes);
+	for (size_t i = 0, n = ARR_LEN(env.edges); i < n; ++i) {
+		ifg_edge_t const *const edge = &env.edges[i];
+		adj[fill[edge->a]++] = edge->b;
+		adj[fill[edge->b]++] = edge->a;
+	}
+	free(fill);
+
+	/* sort the neighbours and remove duplicate edges */
+	unsigned out = 0;
+	for (unsigned i = 0; i < n_nodes; ++i) {
+		unsigned const begin = adj_begin[i];
+		unsigned const end   = adj_begin[i + 1];
+		qsort(&adj[begin], end - begin, sizeof(*adj), cmp_unsigned);
+		adj_begin[i] = out;
+		for (unsigned j = begin; j < end; ++j) {
+			if (j == begin || adj[j] != adj[j - 1])
+				adj[out++] = adj[j];
+		}
+	}
+	adj_begin[n_nodes] = out;
+
+	ifg->adj_begin   = adj_begin;
+	ifg->adj         = adj;
+	ifg->is_explicit = true;
+
+	DEL_ARR_F(env.living);
+	DEL_ARR_F(env.edges);
+	DEL_ARR_F(env.nodes);
+}
+
+/**
+ * Checks that the explicit graph has the same nodes as the implicit one and
+ * that every node has the neighbours the dominance tree walk finds.
+ */
+static void check_explicit_ifg(const be_ifg_t *ifg)
+{
+	be_ifg_t implicit;
+	memset(&implicit, 0, sizeof(implicit));
+	implicit.env = ifg->env;
+
+	nodes_iter_t explicit_nodes = be_ifg_nodes_begin(ifg);
+	be_ifg_foreach_node(&implicit, irn) {
+		ir_node *const expected = be_ifg_nodes_next(&explicit_nodes);
+		if (irn != expected)
+			panic("explicit ifg has node %+F instead of %+F", expected, irn);
+	}
+	if (be_ifg_nodes_next(&explicit_nodes) != NULL)
+		panic("explicit ifg has more nodes than the implicit one");
+
+	for (unsigned i = 0; i < ifg->n_nodes; ++i) {
+		ir_node *const irn = ifg->nodes[i];
+		ir_nodeset_t   neighbours;
+		ir_nodeset_init(&neighbours);
+		neighbours_iter_t it;
+		be_ifg_foreach_neighbour(&implicit, &it, irn, other) {
+			ir_nodeset_insert(&neighbours, other);
+		}
+
+		int const degree = be_ifg_degree(ifg, irn);
+		if ((size_t)degree != ir_nodeset_size(&neighbours))
+			panic("%+F has %d neighbours in the explicit ifg instead of %zu",
+			      irn, degree, ir_nodeset_size(&neighbours));
+		be_ifg_foreach_neighbour(ifg, &it, irn, other) {
+			if (!ir_nodeset_contains(&neighbours, other))
+				panic("%+F and %+F do not interfere", irn, other);
+			if (!be_ifg_connected(ifg, irn, other))
+				panic("%+F and %+F are not connected", irn, other);
+		}
+		ir_nodeset_destroy(&neighbours);
+	}
+}
+
 be_ifg_t *be_create_ifg(const be_chordal_env_t *env)
 {
-	be_ifg_t *ifg = XMALLOC(be_ifg_t);
+	be_ifg_t *ifg = XMALLOCZ(be_ifg_t);
 	ifg->env = env;
 
+	int const flavor = env->opts->ifg_flavor;
+	if (flavor == BE_CH_IFG_EXPLICIT || flavor == BE_CH_IFG_CHECK)
+		build_explicit_ifg(ifg);
+	if (flavor == BE_CH_IFG_CHECK)
+		check_explicit_ifg(ifg);
+
 	return ifg;
 }
 
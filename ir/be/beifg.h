@@ -17,8 +17,30 @@
 #include "irnodeset.h"
 #include "pset.h"
 
+/**
+ * The interference graph of a register class.
+ *
+ * The implicit flavor answers all queries by walking the border lists and
+ * the liveness information. The explicit flavor builds the graph once:
+ * nodes are numbered densely, each node has a sorted vector of neighbour
+ * numbers and small graphs additionally get a triangular bit matrix for
+ * constant time interference tests.
+ */
 struct be_ifg_t {
 	const be_chordal_env_t *env;
+	bool                    is_explicit; /**< true if the graph below was
+	                                          built */
+	unsigned                n_nodes;   /**< number of numbered nodes */
+	unsigned                n_defs;    /**< nodes with a real definition,
+	                                        they are numbered first */
+	ir_node               **nodes;     /**< nodes by number */
+	unsigned                n_idx;     /**< size of node_nums */
+	unsigned               *node_nums; /**< node number + 1 by node index,
+	                                        0 if the node is not numbered */
+	unsigned               *adj_begin; /**< start of the neighbours of each
+	                                        node in adj (n_nodes+1 entries) */
+	unsigned               *adj;       /**< sorted neighbour numbers */
+	unsigned               *matrix;    /**< triangular bit matrix or NULL */
 };
 
 typedef struct nodes_iter_t {
@@ -35,6 +57,9 @@ typedef struct neighbours_iter_t {
 	int                   valid;
 	ir_nodeset_t          neighbours;
 	ir_nodeset_iterator_t iter;
+	const be_ifg_t       *ifg;    /**< set when iterating an explicit graph */
+	unsigned              pos;    /**< current position in ifg->adj */
+	unsigned              end;    /**< end of the neighbours in ifg->adj */
 } neighbours_iter_t;
 
 typedef struct cliques_iter_t {
@@ -60,6 +85,12 @@ int      be_ifg_cliques_next(cliques_iter_t *iter);
 void     be_ifg_cliques_break(cliques_iter_t *iter);
 int      be_ifg_degree(const be_ifg_t *ifg, const ir_node *irn);
 
+/**
+ * Returns true if the values @p a and @p b interfere.
+ */
+bool     be_ifg_connected(const be_ifg_t *ifg, const ir_node *a,
+                          const ir_node *b);
+
 #define be_ifg_foreach_neighbour(ifg, iter, irn, pos) \
 	for (ir_node *pos = be_ifg_neighbours_begin(ifg, iter, irn); pos; pos = be_ifg_neighbours_next(iter))
 
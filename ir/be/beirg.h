@@ -79,6 +79,8 @@ typedef struct be_irg_t {
 	struct obstack    obst;
 	/** Architecture specific per-graph data */
 	void             *isa_link;
+	/** CSE setting before the backend disabled CSE for this graph */
+	int               cse_setting;
 } be_irg_t;
 
 static inline be_irg_t *be_birg_from_irg(const ir_graph *irg)
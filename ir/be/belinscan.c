@@ -0,0 +1,619 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief       Linear scan register allocator for fast compilation.
+ *
+ * The allocator trades code quality for compile time and works in two linear
+ * passes over the blocks per register class:
+ *
+ * 1. Spilling: Blocks are visited in reverse postorder. The live intervals of
+ *    a block are derived from its schedule and the live-out set. Values are
+ *    held in a set of at most k registers; when a value needs a register and
+ *    none is free, the value whose interval ends last is evicted
+ *    (second-chance binpacking: an evicted value gets a new chance at a
+ *    register when it is reloaded before its next use). Spills, reloads and
+ *    the reconstruction of SSA form are left to bespillutil.
+ *
+ * 2. Assignment: After spilling the register pressure never exceeds k, so
+ *    visiting the blocks in dominance order and handing out free registers at
+ *    each interval start succeeds without any further splitting. Constrained
+ *    nodes are handled as in the chordal allocator, Phis are resolved by SSA
+ *    destruction. Instead of an interference graph and copy coalescing, cheap
+ *    local hints (should_be_same, Copies, Phi operands and users) are used to
+ *    avoid copies.
+ */
+#include <stdbool.h>
+#include <limits.h>
+
+#include "obst.h"
+#include "irgwalk.h"
+#include "irtools.h"
+#include "irdom.h"
+#include "iredges_t.h"
+#include "irnode_t.h"
+#include "statev_t.h"
+#include "util.h"
+#include "xmalloc.h"
+
+#include "be_t.h"
+#include "bearch.h"
+#include "bechordal_common.h"
+#include "bechordal_t.h"
+#include "beirg.h"
+#include "belive.h"
+#include "belower.h"
+#include "bemodule.h"
+#include "benode.h"
+#include "bera.h"
+#include "besched.h"
+#include "bespill.h"
+#include "bespillutil.h"
+#include "bessadestr.h"
+#include "beutil.h"
+#include "beverify.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
+
+/** interval end of values which are live at the end of a block */
+#define END_INFINITY UINT_MAX
+
+/** the live interval of a value in the block currently processed */
+typedef struct interval_t {
+	unsigned         block_nr;  /**< block the interval belongs to */
+	sched_timestep_t first_use; /**< first use in the block */
+	sched_timestep_t end;       /**< last use in the block */
+} interval_t;
+
+typedef struct workset_t {
+	unsigned  len;
+	ir_node  *vals[];
+} workset_t;
+
+typedef struct block_info_t {
+	workset_t *start_workset;
+	workset_t *end_workset;
+} block_info_t;
+
+static struct obstack               obst;
+static const arch_register_class_t *cls;
+static const be_lv_t               *lv;
+static unsigned                     n_regs;
+static spill_env_t                 *senv;
+static interval_t                  *intervals;
+static unsigned                     block_nr;
+static workset_t                   *ws;
+
+static workset_t *new_workset(void)
+{
+	return OALLOCFZ(&obst, workset_t, vals, n_regs);
+}
+
+static workset_t *workset_clone(const workset_t *workset)
+{
+	workset_t *res = new_workset();
+	res->len = workset->len;
+	MEMCPY(res->vals, workset->vals, workset->len);
+	return res;
+}
+
+static bool workset_contains(const workset_t *workset, const ir_node *val)
+{
+	for (unsigned i = 0; i < workset->len; ++i) {
+		if (workset->vals[i] == val)
+			return true;
+	}
+	return false;
+}
+
+static bool workset_remove(workset_t *workset, const ir_node *val)
+{
+	for (unsigned i = 0; i < workset->len; ++i) {
+		if (workset->vals[i] == val) {
+			workset->vals[i] = workset->vals[--workset->len];
+			return true;
+		}
+	}
+	return false;
+}
+
+static void workset_insert(workset_t *workset, ir_node *val)
+{
+	if (workset_contains(workset, val))
+		return;
+	assert(workset->len < n_regs && "workset already full");
+	workset->vals[workset->len++] = val;
+}
+
+static inline block_info_t *get_block_info(const ir_node *block)
+{
+	return (block_info_t*)get_irn_link(block);
+}
+
+static inline interval_t *get_interval(const ir_node *node)
+{
+	return &intervals[get_irn_idx(node)];
+}
+
+static bool is_dont_spill(const ir_node *node)
+{
+	return arch_get_irn_flags(skip_Proj_const(node)) & arch_irn_flag_dont_spill;
+}
+
+/**
+ * Computes the block local live intervals: The interval of a value ends at
+ * its last use or at the end of the block if it is live-out.
+ */
+static void compute_intervals(ir_node *block)
+{
+	unsigned const nr = ++block_nr;
+
+	be_lv_foreach_cls(lv, block, be_lv_state_end, cls, node) {
+		interval_t *const interval = get_interval(node);
+		interval->block_nr  = nr;
+		interval->first_use = END_INFINITY;
+		interval->end       = END_INFINITY;
+	}
+
+	sched_foreach_non_phi_reverse(block, irn) {
+		sched_timestep_t const step = sched_get_time_step(irn);
+		be_foreach_use(irn, cls, in_req_, value, value_req_,
+			interval_t *const interval = get_interval(value);
+			if (interval->block_nr != nr) {
+				interval->block_nr = nr;
+				interval->end      = step;
+			}
+			interval->first_use = step;
+		);
+	}
+}
+
+/**
+ * Returns true if @p value is not needed in a register after time @p step.
+ * A use at @p step itself still keeps the value alive unless @p after is set.
+ */
+static bool is_dead(const ir_node *value, sched_timestep_t step, bool after)
+{
+	interval_t const *const interval = get_interval(value);
+	return interval->block_nr != block_nr || interval->end < step
+	    || (after && interval->end == step);
+}
+
+/**
+ * Evicts values from the workset until @p demand registers are free in front
+ * of @p instr. Dead values go first, otherwise the value whose interval ends
+ * last is evicted and spilled.
+ */
+static void make_room(ir_node *instr, unsigned demand, bool after)
+{
+	sched_timestep_t const step = sched_get_time_step(instr);
+	while (ws->len + demand > n_regs) {
+		unsigned         victim  = ws->len;
+		sched_timestep_t max_end = 0;
+		for (unsigned i = 0; i < ws->len; ++i) {
+			ir_node *const val = ws->vals[i];
+			if (is_dead(val, step, after)) {
+				victim = i;
+				break;
+			}
+			if (is_dont_spill(val))
+				continue;
+			sched_timestep_t const end = get_interval(val)->end;
+			if (victim == ws->len || end > max_end) {
+				victim  = i;
+				max_end = end;
+			}
+		}
+		assert(victim < ws->len && "no value can be evicted");
+		ir_node *const val = ws->vals[victim];
+		if (!is_dead(val, step, after)) {
+			DB((dbg, LEVEL_3, "    spill %+F before %+F\n", val, instr));
+			be_add_spill(senv, val, sched_prev(instr));
+		}
+		ws->vals[victim] = ws->vals[--ws->len];
+	}
+}
+
+/** a candidate for the start workset of a block with multiple predecessors */
+typedef struct start_cand_t {
+	ir_node          *node;
+	unsigned          prio;
+	sched_timestep_t  first_use;
+} start_cand_t;
+
+static int cmp_start_cand(const void *d1, const void *d2)
+{
+	start_cand_t const *const c1 = (start_cand_t const*)d1;
+	start_cand_t const *const c2 = (start_cand_t const*)d2;
+	if (c1->prio != c2->prio)
+		return QSORT_CMP(c1->prio, c2->prio);
+	if (c1->first_use != c2->first_use)
+		return QSORT_CMP(c1->first_use, c2->first_use);
+	return QSORT_CMP(get_irn_idx(c1->node), get_irn_idx(c2->node));
+}
+
+static bool in_all_pred_worksets(ir_node *block, ir_node *value)
+{
+	bool const is_local_phi = is_Phi(value) && get_nodes_block(value) == block;
+	for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+		ir_node      *const pred      = get_Block_cfgpred_block(block, i);
+		block_info_t *const pred_info = get_block_info(pred);
+		if (pred_info == NULL)
+			return false;
+		ir_node *const val = is_local_phi ? get_irn_n(value, i) : value;
+		if (!workset_contains(pred_info->end_workset, val))
+			return false;
+	}
+	return true;
+}
+
+static void add_start_cand(start_cand_t **cands, ir_node *block, ir_node *node)
+{
+	interval_t const *const interval = get_interval(node);
+	start_cand_t cand;
+	cand.node      = node;
+	cand.first_use = interval->first_use;
+	if (is_dont_spill(node)) {
+		cand.prio = 0;
+	} else if (interval->block_nr != block_nr) {
+		/* dead Phi */
+		return;
+	} else if (interval->first_use != END_INFINITY) {
+		cand.prio = 1;
+	} else if (in_all_pred_worksets(block, node)) {
+		/* live-through value which is in a register on all incoming paths */
+		cand.prio = 2;
+	} else {
+		/* keep live-through values in memory, otherwise a value would be
+		 * reloaded on every loop iteration if it is evicted inside the loop */
+		return;
+	}
+	ARR_APP1(start_cand_t, *cands, cand);
+}
+
+/**
+ * Computes the start workset of a block with multiple predecessors: Values
+ * used in the block are taken in the order of their first use.
+ */
+static void decide_start_workset(ir_node *block)
+{
+	start_cand_t *cands = NEW_ARR_F(start_cand_t, 0);
+
+	sched_foreach_phi(block, phi) {
+		if (arch_irn_consider_in_reg_alloc(cls, phi))
+			add_start_cand(&cands, block, phi);
+	}
+	be_lv_foreach_cls(lv, block, be_lv_state_in, cls, node) {
+		add_start_cand(&cands, block, node);
+	}
+	QSORT_ARR(cands, cmp_start_cand);
+
+	ws->len = 0;
+	for (size_t i = 0, n = MIN(ARR_LEN(cands), n_regs); i < n; ++i)
+		ws->vals[ws->len++] = cands[i].node;
+	DEL_ARR_F(cands);
+
+	/* Phis which did not make it into a register live in memory */
+	sched_foreach_phi(block, phi) {
+		if (arch_irn_consider_in_reg_alloc(cls, phi)
+		    && !workset_contains(ws, phi)) {
+			DB((dbg, LEVEL_2, "  spilling %+F\n", phi));
+			be_spill_phi(senv, phi);
+		}
+	}
+}
+
+static void process_block(ir_node *block)
+{
+	DB((dbg, LEVEL_2, "Processing %+F\n", block));
+	compute_intervals(block);
+
+	int const arity = get_Block_n_cfgpreds(block);
+	if (arity == 0) {
+		ws->len = 0;
+	} else if (arity == 1 && !is_Phi(sched_first(block))) {
+		ir_node      *const pred      = get_Block_cfgpred_block(block, 0);
+		block_info_t *const pred_info = get_block_info(pred);
+		assert(pred_info != NULL);
+		workset_t const *const pred_ws = pred_info->end_workset;
+		ws->len = pred_ws->len;
+		MEMCPY(ws->vals, pred_ws->vals, pred_ws->len);
+	} else {
+		decide_start_workset(block);
+	}
+
+	block_info_t *const info = OALLOCZ(&obst, block_info_t);
+	info->start_workset = workset_clone(ws);
+	set_irn_link(block, info);
+
+	ir_node **const vals = ALLOCAN(ir_node*, n_regs);
+	sched_foreach_non_phi(block, irn) {
+		/* values used by the instruction must be in registers */
+		unsigned n_uses = 0;
+		be_foreach_use(irn, cls, in_req_, value, value_req_,
+			bool found = false;
+			for (unsigned i = 0; i < n_uses; ++i) {
+				if (vals[i] == value) {
+					found = true;
+					break;
+				}
+			}
+			if (found)
+				continue;
+			if (!workset_remove(ws, value)) {
+				DB((dbg, LEVEL_3, "    reload %+F before %+F\n", value, irn));
+				be_add_reload(senv, value, irn);
+			}
+			assert(n_uses < n_regs);
+			vals[n_uses++] = value;
+		);
+		make_room(irn, n_uses, false);
+		for (unsigned i = 0; i < n_uses; ++i)
+			workset_insert(ws, vals[i]);
+
+		/* values defined by the instruction need registers */
+		unsigned n_defs = 0;
+		be_foreach_definition(irn, cls, value, req,
+			assert(req->width == 1);
+			assert(n_defs < n_regs);
+			vals[n_defs++] = value;
+		);
+		make_room(irn, n_defs, true);
+		for (unsigned i = 0; i < n_defs; ++i)
+			workset_insert(ws, vals[i]);
+	}
+
+	info->end_workset = workset_clone(ws);
+}
+
+/**
+ * The blocks were processed independently: Spill values which are in a
+ * register at the end of a predecessor but not at the start of the block and
+ * reload values on the control flow edges where the start workset contains a
+ * value which is not in a register at the end of the predecessor.
+ */
+static void fix_block_borders(ir_node *block, void *data)
+{
+	(void)data;
+	workset_t const *const start_ws = get_block_info(block)->start_workset;
+	for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+		ir_node         *const pred   = get_Block_cfgpred_block(block, i);
+		workset_t const *const end_ws = get_block_info(pred)->end_workset;
+		for (unsigned v = 0; v < end_ws->len; ++v) {
+			ir_node *const node = end_ws->vals[v];
+			if (workset_contains(start_ws, node) || !be_is_live_in(lv, block, node))
+				continue;
+			ir_node *const insert_point = n > 1
+				? sched_prev(be_get_end_of_block_insertion_point(pred))
+				: block;
+			DB((dbg, LEVEL_3, "  spill %+F after %+F\n", node, insert_point));
+			be_add_spill(senv, node, insert_point);
+		}
+		for (unsigned v = 0; v < start_ws->len; ++v) {
+			ir_node *node = start_ws->vals[v];
+			if (is_Phi(node) && get_nodes_block(node) == block) {
+				node = get_irn_n(node, i);
+				if (!arch_irn_consider_in_reg_alloc(cls, node))
+					continue;
+			}
+			if (!workset_contains(end_ws, node)) {
+				DB((dbg, LEVEL_3, "  reload %+F on edge %+F,%d\n", node, block, i));
+				be_add_reload_on_edge(senv, node, block, i);
+			}
+		}
+	}
+}
+
+static void linscan_spill(ir_graph *irg, const regalloc_if_t *regif)
+{
+	be_assure_live_sets(irg);
+
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+	irg_block_walk_graph(irg, firm_clear_link, NULL, NULL);
+
+	lv        = be_get_irg_liveness(irg);
+	n_regs    = be_get_n_allocatable_regs(irg, cls);
+	senv      = be_new_spill_env(irg, regif);
+	intervals = XMALLOCNZ(interval_t, get_irg_last_idx(irg));
+	block_nr  = 0;
+	ws        = new_workset();
+
+	ir_node **const blocklist = be_get_cfgpostorder(irg);
+	for (size_t i = ARR_LEN(blocklist); i-- > 0; ) {
+		process_block(blocklist[i]);
+	}
+	DEL_ARR_F(blocklist);
+
+	irg_block_walk_graph(irg, fix_block_borders, NULL, NULL);
+
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+
+	be_insert_spills_reloads(senv);
+
+	be_delete_spill_env(senv);
+	free(intervals);
+}
+
+/**
+ * Returns the register of @p node if it is set and still available.
+ */
+static const arch_register_t *get_free_reg(const ir_node *node,
+                                           const bitset_t *available)
+{
+	if (!arch_irn_consider_in_reg_alloc(cls, node))
+		return NULL;
+	const arch_register_t *reg = arch_get_irn_register(node);
+	if (reg != NULL && bitset_is_set(available, reg->index))
+		return reg;
+	return NULL;
+}
+
+/**
+ * Chooses a register for @p irn: Prefer registers which avoid a copy.
+ */
+static const arch_register_t *choose_reg(const ir_node *irn,
+                                         const bitset_t *available)
+{
+	const arch_register_t *reg = NULL;
+	if (is_Phi(irn)) {
+		foreach_irn_in(irn, i, op) {
+			if ((reg = get_free_reg(op, available)) != NULL)
+				return reg;
+		}
+	} else if (be_is_Copy(irn)) {
+		if ((reg = get_free_reg(be_get_Copy_op(irn), available)) != NULL)
+			return reg;
+	} else {
+		const arch_register_req_t *req = arch_get_irn_register_req(irn);
+		if (req->should_be_same != 0) {
+			const ir_node *insn = skip_Proj_const(irn);
+			for (int i = 0, n = get_irn_arity(insn); i < n; ++i) {
+				if (!rbitset_is_set(&req->should_be_same, i))
+					continue;
+				if ((reg = get_free_reg(get_irn_n(insn, i), available)) != NULL)
+					return reg;
+			}
+		}
+	}
+
+	/* a Phi using the value may have been colored already (loops) */
+	foreach_out_edge(irn, edge) {
+		const ir_node *user = get_edge_src_irn(edge);
+		if (is_Phi(user) && (reg = get_free_reg(user, available)) != NULL)
+			return reg;
+	}
+
+	unsigned const col = bitset_next_set(available, 0);
+	return arch_register_for_index(cls, col);
+}
+
+/**
+ * Walks the interval borders of a block in order and assigns a free register
+ * at the start of each interval. Values live at the block start were defined
+ * in dominators and are already colored.
+ */
+static void assign(ir_node *const block, void *const env_ptr)
+{
+	be_chordal_env_t *const env       = (be_chordal_env_t*)env_ptr;
+	struct list_head *const head      = get_block_border_head(env, block);
+	bitset_t         *const available = bitset_alloca(env->allocatable_regs->size);
+	bitset_copy(available, env->allocatable_regs);
+
+	foreach_border_head(head, b) {
+		ir_node *const irn = b->irn;
+		const arch_register_t *reg = arch_get_irn_register(irn);
+		if (!b->is_def) {
+			assert(reg != NULL && "register must have been assigned");
+			bitset_set(available, reg->index);
+			continue;
+		}
+
+		assert(b->is_real || reg != NULL);
+		if (reg == NULL) {
+			assert(!arch_irn_is_ignore(irn));
+			reg = choose_reg(irn, available);
+			arch_set_irn_register(irn, reg);
+			DB((dbg, LEVEL_2, "  assigning %s to %+F\n", reg->name, irn));
+		}
+		assert(bitset_is_set(available, reg->index)
+		       && "pre-colored register must be free");
+		bitset_clear(available, reg->index);
+	}
+}
+
+static void linscan_color(be_chordal_env_t *env)
+{
+	ir_graph *const irg = env->irg;
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+	be_assure_live_sets(irg);
+
+	be_chordal_handle_constraints(env);
+
+	dom_tree_walk_irg(irg, create_borders, NULL, env);
+	dom_tree_walk_irg(irg, assign, NULL, env);
+}
+
+/**
+ * The linear scan register allocator for a whole procedure.
+ */
+static void be_linscan_alloc(ir_graph *irg, const regalloc_if_t *regif)
+{
+	be_timer_push(T_RA_OTHER);
+
+	be_spill_prepare_for_constraints(irg);
+
+	be_chordal_env_t env;
+	obstack_init(&env.obst);
+	env.opts             = NULL;
+	env.irg              = irg;
+	env.ifg              = NULL;
+
+	arch_register_class_t const *const reg_classes = isa_if->register_classes;
+	for (int c = 0, n_cls = isa_if->n_register_classes; c < n_cls; ++c) {
+		cls = &reg_classes[c];
+		if (cls->manual_ra)
+			continue;
+
+		stat_ev_ctx_push_str("linscan_cls", cls->name);
+		obstack_init(&obst);
+
+		be_timer_push(T_RA_SPILL);
+		linscan_spill(irg, regif);
+		be_timer_pop(T_RA_SPILL);
+
+		be_timer_push(T_RA_SPILL_APPLY);
+		check_for_memory_operands(irg, regif);
+		be_timer_pop(T_RA_SPILL_APPLY);
+
+		be_dump(DUMP_RA, irg, "spill");
+
+		if (be_options.do_verify) {
+			be_timer_push(T_VERIFY);
+			bool check_schedule = be_verify_schedule(irg);
+			be_check_verify_result(check_schedule, irg);
+			bool check_pressure = be_verify_register_pressure(irg, cls);
+			be_check_verify_result(check_pressure, irg);
+			be_timer_pop(T_VERIFY);
+		}
+
+		env.cls              = cls;
+		env.border_heads     = pmap_create();
+		env.allocatable_regs = bitset_malloc(cls->n_regs);
+		be_get_allocatable_regs(irg, cls, env.allocatable_regs->data);
+		be_assure_live_chk(irg);
+
+		be_timer_push(T_RA_COLOR);
+		linscan_color(&env);
+		be_timer_pop(T_RA_COLOR);
+
+		be_timer_push(T_RA_SSA);
+		be_ssa_destruction(irg, cls);
+		be_timer_pop(T_RA_SSA);
+
+		pmap_destroy(env.border_heads);
+		free(env.allocatable_regs);
+		obstack_free(&env.obst, NULL);
+		obstack_init(&env.obst);
+		obstack_free(&obst, NULL);
+
+		stat_ev_ctx_pop("linscan_cls");
+	}
+
+	be_timer_push(T_RA_EPILOG);
+	lower_nodes_after_ra(irg, false);
+	obstack_free(&env.obst, NULL);
+	be_invalidate_live_sets(irg);
+	be_timer_pop(T_RA_EPILOG);
+
+	be_timer_pop(T_RA_OTHER);
+}
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_linscan)
+void be_init_linscan(void)
+{
+	be_register_allocator("linscan", be_linscan_alloc);
+	FIRM_DBG_REGISTER(dbg, "firm.be.linscan");
+}
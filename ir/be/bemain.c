@@ -35,7 +35,9 @@
 
 #include "bearch.h"
 #include "be_t.h"
+#include "becodecache.h"
 #include "bediagnostic.h"
+#include "beelf.h"
 #include "begnuas.h"
 #include "bemodule.h"
 #include "beutil.h"
@@ -65,6 +67,7 @@ be_options_t be_options = {
 	.timing               = false,
 	.opt_profile_generate = false,
 	.opt_profile_use      = false,
+	.opt_profile_edges    = false,
 	.omit_fp              = false,
 	.pic                  = false,
 	.do_verify            = true,
@@ -100,6 +103,7 @@ static const lc_opt_table_entry_t be_main_options[] = {
 	LC_OPT_ENT_BOOL     ("time",       "get backend timing statistics",                       &be_options.timing),
 	LC_OPT_ENT_BOOL     ("profilegenerate", "instrument the code for execution count profiling", &be_options.opt_profile_generate),
 	LC_OPT_ENT_BOOL     ("profileuse",      "use existing profile data",                         &be_options.opt_profile_use),
+	LC_OPT_ENT_BOOL     ("profileedges",    "profile control flow edges instead of blocks",      &be_options.opt_profile_edges),
 	LC_OPT_ENT_BOOL     ("verboseasm", "enable verbose assembler output",                        &be_options.verbose_asm),
 
 	LC_OPT_ENT_STR("ilp.solver", "the ilp solver name", &be_options.ilp_solver),
@@ -313,21 +317,30 @@ static ir_graph *be_prepare_profile(const char *const cup_name)
 	obstack_1grow(&obst, '\0');
 	const char *prof_filename = obstack_finish(&obst);
 
+	ir_profile_mode_t const mode = be_options.opt_profile_edges
+		? ir_profile_edges : ir_profile_blocks;
+
 	bool have_profile = false;
 	if (be_options.opt_profile_use) {
-		bool res = ir_profile_read(prof_filename);
+		bool res = ir_profile_read(prof_filename, mode);
 		if (!res) {
 			be_warningf(NULL, "could not read profile data '%s'", prof_filename);
 		} else {
-			ir_create_execfreqs_from_profile();
-			ir_profile_free();
 			have_profile = true;
 		}
 	}
 
+	/* Instrument before the profiled frequencies are set: edge profiling
+	 * places its counters based on estimated frequencies, which have to be
+	 * the same as when reading the profile. */
 	ir_graph *prof_init_irg = NULL;
 	if (be_options.opt_profile_generate)
-		prof_init_irg = ir_profile_instrument(prof_filename);
+		prof_init_irg = ir_profile_instrument(prof_filename, mode);
+
+	if (have_profile) {
+		ir_create_execfreqs_from_profile();
+		ir_profile_free();
+	}
 
 	if (!have_profile) {
 		be_timer_push(T_EXECFREQ);
@@ -409,7 +422,12 @@ void be_begin(FILE *file_handle, const char *cup_name)
 	if (prof_init_irg != NULL)
 		initialize_birg(&birgs[num_birgs++], prof_init_irg, &env);
 
-	be_gas_begin_compilation_unit(&env);
+	if (be_elf_output_selected()) {
+		be_elf_begin_compilation_unit(file_handle, &env);
+	} else {
+		be_gas_begin_compilation_unit(&env);
+	}
+	be_codecache_begin(&env);
 }
 
 void firm_be_finish(void)
@@ -462,7 +480,7 @@ float_int_conversion_overflow_style_t be_get_float_int_overflow(void)
 
 int be_timing;
 
-static const char *get_timer_name(be_timer_id_t id)
+const char *be_get_timer_name(be_timer_id_t id)
 {
 	switch (id) {
 	case T_ABI:            return "abi";
@@ -519,7 +537,9 @@ void be_lower_for_target(void)
 {
 	initialize_isa();
 
+	ir_pass_timing_push("be_lower_for_target", NULL);
 	isa_if->lower_for_target();
+	ir_pass_timing_pop();
 	/* set the phase to low */
 	foreach_irp_irg_r(i, irg) {
 		assert(!irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_TARGET_LOWERED));
@@ -527,21 +547,24 @@ void be_lower_for_target(void)
 	}
 }
 
-static int cse_setting;
-
 bool be_step_first(ir_graph *irg)
 {
 	ir_entity *const entity = get_irg_entity(irg);
 	if (get_entity_linkage(entity) & IR_LINKAGE_NO_CODEGEN)
 		return false;
+	if (be_codecache_lookup(irg)) {
+		be_free_birg(irg);
+		return false;
+	}
 
-	be_timer_push(T_OTHER);
 	if (stat_ev_enabled) {
 		stat_ev_ctx_push_fmt("bemain_irg", "%+F", irg);
 		stat_ev_ull("bemain_insns_start", be_count_insns(irg));
 		stat_ev_ull("bemain_blocks_start", be_count_blocks(irg));
 	}
-	cse_setting = get_opt_cse();
+	ir_pass_timing_push("be_codegen", irg);
+	be_timer_push(T_OTHER);
+	be_birg_from_irg(irg)->cse_setting = get_opt_cse();
 	return true;
 }
 
@@ -592,13 +615,14 @@ void be_step_last(ir_graph *irg)
 	be_regalloc_verify(irg);
 
 	be_timer_pop(T_OTHER);
+	ir_pass_timing_pop();
 
 	if (be_timing) {
 		if (stat_ev_enabled) {
 			for (be_timer_id_t t = T_FIRST; t < T_LAST+1; ++t) {
 				char buf[128];
 				snprintf(buf, sizeof(buf), "bemain_time_%s",
-						 get_timer_name(t));
+						 be_get_timer_name(t));
 				stat_ev_dbl(buf, ir_timer_elapsed_usec(be_timers[t]));
 			}
 		} else {
@@ -606,7 +630,7 @@ void be_step_last(ir_graph *irg)
 				   get_entity_name(get_irg_entity(irg)));
 			for (be_timer_id_t t = T_FIRST; t < T_LAST+1; ++t) {
 				double val = ir_timer_elapsed_usec(be_timers[t]) / 1000.0;
-				printf("%-20s: %10.3f msec\n", get_timer_name(t), val);
+				printf("%-20s: %10.3f msec\n", be_get_timer_name(t), val);
 			}
 		}
 		for (be_timer_id_t t = T_FIRST; t < T_LAST+1; ++t) {
@@ -614,6 +638,9 @@ void be_step_last(ir_graph *irg)
 		}
 	}
 
+	be_codecache_store(irg);
+
+	int const cse_setting = be_birg_from_irg(irg)->cse_setting;
 	be_free_birg(irg);
 	stat_ev_ctx_pop("bemain_irg");
 
@@ -622,7 +649,12 @@ void be_step_last(ir_graph *irg)
 
 void be_finish(void)
 {
-	be_gas_end_compilation_unit(&env);
+	be_codecache_finish();
+	if (be_elf_output_selected()) {
+		be_elf_end_compilation_unit(&env);
+	} else {
+		be_gas_end_compilation_unit(&env);
+	}
 
 	if (be_options.timing) {
 		ir_timer_stop(bemain_timer);
@@ -651,6 +683,9 @@ void be_finish(void)
 
 void be_main(FILE *file_handle, const char *cup_name)
 {
+	/* the target reads its configuration before be_begin() lowers the
+	 * program */
+	initialize_isa();
 	/* Let the target control how the codegeneration works. */
 	isa_if->generate_code(file_handle, cup_name);
 }
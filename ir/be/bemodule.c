@@ -33,6 +33,7 @@ void be_init_blocksched(void);
 void be_init_chordal(void);
 void be_init_chordal_common(void);
 void be_init_chordal_main(void);
+void be_init_codecache(void);
 void be_init_copyheur4(void);
 void be_init_copyilp(void);
 void be_init_copyilp2(void);
@@ -43,6 +44,7 @@ void be_init_daemelspill(void);
 void be_init_dwarf(void);
 void be_init_gas(void);
 void be_init_listsched(void);
+void be_init_linscan(void);
 void be_init_live(void);
 void be_init_loopana(void);
 void be_init_pbqp(void);
@@ -51,6 +53,7 @@ void be_init_peephole(void);
 void be_init_pref_alloc(void);
 void be_init_ra(void);
 void be_init_sched(void);
+void be_init_sched_latency(void);
 void be_init_sched_normal(void);
 void be_init_sched_rand(void);
 void be_init_sched_trivial(void);
@@ -60,6 +63,7 @@ void be_init_spilloptions(void);
 void be_init_spillslots(void);
 void be_init_ssaconstr(void);
 void be_init_state(void);
+void be_init_x86_address_mode(void);
 
 void be_quit_copystat(void);
 void be_quit_pbqp(void);
@@ -77,6 +81,7 @@ void be_init_modules(void)
 
 	be_init_blocksched();
 	be_init_chordal_common();
+	be_init_codecache();
 	be_init_copyopt();
 	be_init_copystat();
 	be_init_dwarf();
@@ -91,6 +96,7 @@ void be_init_modules(void)
 	be_init_spillslots();
 	be_init_ssaconstr();
 	be_init_state();
+	be_init_x86_address_mode();
 
 	/* in the following groups the first one is the default */
 	be_init_arch_ia32();
@@ -101,11 +107,13 @@ void be_init_modules(void)
 
 	be_init_listsched();
 	be_init_sched_normal();
+	be_init_sched_latency();
 	be_init_sched_rand();
 	be_init_sched_trivial();
 
 	be_init_chordal_main();
 	be_init_pref_alloc();
+	be_init_linscan();
 
 	be_init_chordal();
 	be_init_pbqp_coloring();
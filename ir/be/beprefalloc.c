@@ -65,6 +65,7 @@
 #define AFF_PHI                        1.0f
 #define SPLIT_DELTA                    1.0f
 #define MAX_OPTIMISTIC_SPLIT_RECURSION 0
+#define MAX_WEIGHT                     1e30f
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
 
@@ -78,6 +79,17 @@ static int                         *congruence_classes;
 static ir_node                    **block_order;
 static size_t                       n_block_order;
 
+/**
+ * Returns the execution frequency of @p block as a weight for the
+ * preferences. Deep loop nests have frequencies beyond the range of float, so
+ * the weight is clamped.
+ */
+static float get_block_weight(const ir_node *block)
+{
+	double const freq = get_block_execfreq(block);
+	return freq < MAX_WEIGHT ? (float)freq : MAX_WEIGHT;
+}
+
 /** currently active assignments (while processing a basic block)
  * maps registers to values(their current copies) */
 static ir_node **assignments;
@@ -273,7 +285,7 @@ static void check_defs(ir_nodeset_t const *const live_nodes, float const weight,
  */
 static void analyze_block(ir_node *block, void *data)
 {
-	float        weight = (float)get_block_execfreq(block);
+	float        weight = get_block_weight(block);
 	ir_nodeset_t live_nodes;
 	(void) data;
 
@@ -549,7 +561,7 @@ static bool try_optimistic_split(ir_node *to_split, ir_node *before,
 	const arch_register_t *from_reg        = arch_get_irn_register(to_split);
 	unsigned               from_r          = from_reg->index;
 	ir_node               *block           = get_nodes_block(before);
-	float split_threshold = (float)get_block_execfreq(block) * SPLIT_DELTA;
+	float split_threshold = get_block_weight(block) * SPLIT_DELTA;
 
 	if (pref_delta < split_threshold*0.5)
 		return false;
@@ -647,7 +659,7 @@ static void assign_reg(ir_node const *const block, ir_node *const node, arch_reg
 	allocation_info_t *info    = get_allocation_info(node);
 	ir_node           *in_node = skip_Proj(node);
 	if (req->should_be_same != 0) {
-		float weight = (float)get_block_execfreq(block);
+		float weight = get_block_weight(block);
 
 		assert(get_irn_arity(in_node) <= (int)sizeof(req->should_be_same) * 8);
 		foreach_irn_in(in_node, i, in) {
@@ -1332,7 +1344,7 @@ static void adapt_phi_prefs(ir_node *phi)
 			continue;
 
 		/* give bonus for already assigned register */
-		float weight = (float)get_block_execfreq(pred_block);
+		float weight = get_block_weight(pred_block);
 		info->prefs[reg->index] += weight * AFF_PHI;
 	}
 }
@@ -1351,7 +1363,7 @@ static void propagate_phi_register(ir_node *phi, unsigned assigned_r)
 		allocation_info_t *info       = get_allocation_info(op);
 		ir_node           *pred_block = get_Block_cfgpred_block(block, i);
 		float              weight
-			= (float)get_block_execfreq(pred_block) * AFF_PHI;
+			= get_block_weight(pred_block) * AFF_PHI;
 
 		if (info->prefs[assigned_r] >= weight)
 			continue;
@@ -1660,7 +1672,7 @@ static void determine_block_order(void)
 		block_costs_t *cost_info;
 		ir_node *block = blocklist[--p];
 
-		float execfreq   = (float)get_block_execfreq(block);
+		float execfreq   = get_block_weight(block);
 		float costs      = execfreq;
 		int   n_cfgpreds = get_Block_n_cfgpreds(block);
 		for (int p2 = 0; p2 < n_cfgpreds; ++p2) {
@@ -1753,7 +1765,7 @@ static void be_pref_alloc_cls(void)
 
 	DB((dbg, LEVEL_2, "=== Allocating registers of %s ===\n", cls->name));
 
-	irg_walk_graph(irg, firm_clear_link, NULL, NULL);
+	irg_walk_graph_unordered(irg, firm_clear_link, NULL);
 
 	irg_block_walk_graph(irg, NULL, analyze_block, NULL);
 	combine_congruence_classes();
@@ -0,0 +1,396 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   List scheduler driven by a machine model.
+ *
+ * Nodes are selected critical path first: the candidate with the longest
+ * latency weighted path to the end of the block, which can be issued in the
+ * current cycle without exceeding the issue width or occupying a busy
+ * execution port, wins. Whenever scheduling a candidate would let the register
+ * pressure of a class exceed the number of allocatable registers, candidates
+ * reducing the pressure are preferred.
+ */
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "be_t.h"
+#include "bearch.h"
+#include "beirg.h"
+#include "belistsched.h"
+#include "belive.h"
+#include "bemodule.h"
+#include "benode.h"
+#include "besched.h"
+#include "debug.h"
+#include "iredges_t.h"
+#include "irgwalk.h"
+#include "irnode_t.h"
+#include "array.h"
+#include "util.h"
+#include "xmalloc.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg = NULL;)
+
+typedef struct node_info_t {
+	unsigned latency;  /**< cycles until the results are available */
+	unsigned ports;    /**< ports able to execute the node */
+	unsigned height;   /**< latency of the longest path to the block end */
+	unsigned earliest; /**< first cycle with all operands available */
+	unsigned n_uses;   /**< unscheduled uses in the current block */
+	bool     visited;  /**< height has been computed */
+} node_info_t;
+
+static const be_machine_t *machine;
+static node_info_t        *infos;
+static be_lv_t            *lv;
+static ir_node            *current_block;
+static unsigned            n_classes;
+static int                *pressure;  /**< current pressure per class */
+static int                *limit;     /**< allocatable registers per class */
+static int                *delta;     /**< pressure change of a candidate */
+
+static unsigned cycle;      /**< current cycle */
+static unsigned n_issued;   /**< instructions issued in the current cycle */
+static unsigned used_ports; /**< ports busy in the current cycle */
+
+static unsigned default_get_latency(const ir_node *node)
+{
+	if (be_is_Keep(node))
+		return 0;
+	return isa_if->get_op_estimated_cost != NULL
+	     ? isa_if->get_op_estimated_cost(node) : 1;
+}
+
+static unsigned default_get_ports(const ir_node *node)
+{
+	return be_is_Keep(node) ? 0 : 1;
+}
+
+/** Model of a scalar in-order machine for backends without a model. */
+static const be_machine_t default_machine = {
+	.issue_width = 1,
+	.n_ports     = 1,
+	.get_latency = default_get_latency,
+	.get_ports   = default_get_ports,
+};
+
+static node_info_t *get_info(const ir_node *node)
+{
+	return &infos[get_irn_idx(node)];
+}
+
+/**
+ * Returns true if @p user is scheduled in the current block after the
+ * operands it uses.
+ */
+static bool is_block_user(const ir_node *user)
+{
+	return !is_Block(user) && !is_Phi(user) && !is_Proj(user)
+	    && !arch_is_irn_not_scheduled(user)
+	    && get_nodes_block(user) == current_block;
+}
+
+#define foreach_block_user(node, user, code) \
+	foreach_out_edge(node, node##__edge) { \
+		ir_node *const node##__src = get_edge_src_irn(node##__edge); \
+		if (is_Proj(node##__src)) { \
+			foreach_out_edge(node##__src, node##__proj_edge) { \
+				ir_node *const user = get_edge_src_irn(node##__proj_edge); \
+				if (is_block_user(user)) { \
+					code \
+				} \
+			} \
+		} else { \
+			ir_node *const user = node##__src; \
+			if (is_block_user(user)) { \
+				code \
+			} \
+		} \
+	}
+
+static unsigned compute_height(ir_node *node)
+{
+	node_info_t *info = get_info(node);
+	if (info->visited)
+		return info->height;
+	info->visited = true;
+
+	unsigned height = 0;
+	foreach_block_user(node, user,
+		height = MAX(height, compute_height(user));
+	)
+	info->height = height + info->latency;
+	return info->height;
+}
+
+static bool consider_value(const ir_node *value)
+{
+	const arch_register_req_t *req = arch_get_irn_register_req(value);
+	return req->cls != NULL && !req->ignore
+	    && !req->cls->manual_ra;
+}
+
+static void count_uses(ir_node *node, int add)
+{
+	foreach_irn_in(node, i, op) {
+		if (!is_Block(op) && get_irn_mode(op) != mode_T && consider_value(op))
+			get_info(op)->n_uses += add;
+	}
+}
+
+/**
+ * Computes how scheduling @p node changes the register pressure.
+ */
+static void compute_delta(ir_node *node)
+{
+	memset(delta, 0, n_classes * sizeof(*delta));
+	be_foreach_value(node, value,
+		if (!consider_value(value))
+			continue;
+		/* a value without uses dies immediately, it does not add pressure
+		 * between the instructions */
+		if (get_info(value)->n_uses > 0
+		    || be_is_live_out(lv, current_block, value))
+			++delta[arch_get_irn_register_req(value)->cls->index];
+	);
+	if (is_Phi(node))
+		return;
+	foreach_irn_in(node, i, op) {
+		if (is_Block(op) || get_irn_mode(op) == mode_T || !consider_value(op))
+			continue;
+		/* count each operand once */
+		bool seen = false;
+		for (int j = 0; j < i; ++j) {
+			if (get_irn_n(node, j) == op) {
+				seen = true;
+				break;
+			}
+		}
+		if (seen)
+			continue;
+		unsigned n_uses = 0;
+		foreach_irn_in(node, j, other) {
+			if (other == op)
+				++n_uses;
+		}
+		if (get_info(op)->n_uses == n_uses
+		    && !be_is_live_out(lv, current_block, op))
+			--delta[arch_get_irn_register_req(op)->cls->index];
+	}
+}
+
+/**
+ * Returns by how many registers scheduling @p node would exceed the number of
+ * allocatable registers.
+ */
+static unsigned get_excess(ir_node *node)
+{
+	compute_delta(node);
+	unsigned excess = 0;
+	for (unsigned c = 0; c < n_classes; ++c) {
+		int over = pressure[c] + delta[c] - limit[c];
+		if (delta[c] > 0 && over > 0)
+			excess += over;
+	}
+	return excess;
+}
+
+static bool can_issue(const node_info_t *info)
+{
+	if (info->earliest > cycle)
+		return false;
+	if (info->ports == 0)
+		return true;
+	return n_issued < machine->issue_width && (info->ports & ~used_ports) != 0;
+}
+
+static void next_cycle(unsigned target)
+{
+	cycle      = MAX(cycle + 1, target);
+	n_issued   = 0;
+	used_ports = 0;
+}
+
+static ir_node *latency_select(ir_nodeset_t *ready_set)
+{
+	/* register pressure guard: only consider the candidates exceeding the
+	 * register limits least */
+	unsigned min_excess = UINT_MAX;
+	foreach_ir_nodeset(ready_set, node, iter) {
+		unsigned excess = get_excess(node);
+		set_irn_link(node, INT_TO_PTR(excess));
+		min_excess = MIN(min_excess, excess);
+	}
+
+	for (;;) {
+		ir_node     *best      = NULL;
+		node_info_t *best_info = NULL;
+		unsigned     target    = UINT_MAX;
+		foreach_ir_nodeset(ready_set, node, iter) {
+			if (PTR_TO_INT(get_irn_link(node)) != min_excess)
+				continue;
+			node_info_t *info = get_info(node);
+			if (!can_issue(info)) {
+				target = MIN(target, info->earliest);
+				continue;
+			}
+			if (best == NULL || info->height > best_info->height
+			    || (info->height == best_info->height
+			        && get_irn_idx(node) < get_irn_idx(best))) {
+				best      = node;
+				best_info = info;
+			}
+		}
+		if (best != NULL) {
+			DB((dbg, LEVEL_2, "\tcycle %u: %+F (height %u, excess %u)\n",
+			    cycle, best, best_info->height, min_excess));
+			return best;
+		}
+		next_cycle(target);
+	}
+}
+
+/**
+ * Accounts the issue slot, port, pressure and result latency of a scheduled
+ * node.
+ */
+static void account(ir_node *node)
+{
+	node_info_t *info = get_info(node);
+	/* nodes scheduled along with others may not be ready yet */
+	if (info->earliest > cycle)
+		next_cycle(info->earliest);
+	if (info->ports != 0) {
+		if (n_issued >= machine->issue_width
+		    || (info->ports & ~used_ports) == 0)
+			next_cycle(0);
+		unsigned free_ports = info->ports & ~used_ports;
+		used_ports |= free_ports & -free_ports;
+		++n_issued;
+	}
+
+	compute_delta(node);
+	for (unsigned c = 0; c < n_classes; ++c)
+		pressure[c] += delta[c];
+	if (!is_Phi(node))
+		count_uses(node, -1);
+
+	unsigned ready = cycle + info->latency;
+	foreach_block_user(node, user,
+		node_info_t *user_info = get_info(user);
+		user_info->earliest = MAX(user_info->earliest, ready);
+	)
+}
+
+static void collect_node(ir_node *node, void *data)
+{
+	ir_node ***block_nodes = (ir_node***)data;
+	if (is_Block(node) || is_Proj(node) || arch_is_irn_not_scheduled(node))
+		return;
+	ir_node ***nodes = &block_nodes[get_irn_idx(get_nodes_block(node))];
+	if (*nodes == NULL)
+		*nodes = NEW_ARR_F(ir_node*, 0);
+	ARR_APP1(ir_node*, *nodes, node);
+}
+
+static void sched_block(ir_node *block, void *data)
+{
+	ir_node ***block_nodes = (ir_node***)data;
+	ir_node  **nodes       = block_nodes[get_irn_idx(block)];
+	if (nodes == NULL)
+		nodes = NEW_ARR_F(ir_node*, 0);
+	current_block = block;
+
+	for (size_t i = 0, n = ARR_LEN(nodes); i < n; ++i) {
+		ir_node     *node = nodes[i];
+		node_info_t *info = get_info(node);
+		info->latency = machine->get_latency(node);
+		info->ports   = machine->get_ports(node);
+		if (!is_Phi(node))
+			count_uses(node, 1);
+	}
+	for (size_t i = 0, n = ARR_LEN(nodes); i < n; ++i)
+		compute_height(nodes[i]);
+
+	ir_graph *irg = get_irn_irg(block);
+	for (unsigned c = 0; c < n_classes; ++c) {
+		const arch_register_class_t *cls = &isa_if->register_classes[c];
+		pressure[c] = 0;
+		be_lv_foreach_cls(lv, block, be_lv_state_in, cls, node) {
+			++pressure[c];
+		}
+		limit[c] = be_get_n_allocatable_regs(irg, cls);
+	}
+	cycle      = 0;
+	n_issued   = 0;
+	used_ports = 0;
+
+	DB((dbg, LEVEL_1, "scheduling %+F\n", block));
+	ir_nodeset_t *cands = be_list_sched_begin_block(block);
+	/* nodes scheduled immediately when the block starts */
+	for (ir_node *node = sched_first(block); !sched_is_end(node);
+	     node = sched_next(node)) {
+		account(node);
+	}
+	while (ir_nodeset_size(cands) > 0) {
+		ir_node *node = latency_select(cands);
+		be_list_sched_schedule(node);
+		/* account the node and the nodes scheduled along with it */
+		for (; !sched_is_end(node); node = sched_next(node))
+			account(node);
+	}
+	be_list_sched_end_block();
+
+	/* values living into the block may still carry counts */
+	for (size_t i = 0, n = ARR_LEN(nodes); i < n; ++i) {
+		foreach_irn_in(nodes[i], j, op) {
+			get_info(op)->n_uses = 0;
+		}
+	}
+	DEL_ARR_F(nodes);
+}
+
+static void sched_latency(ir_graph *irg)
+{
+	machine = isa_if->get_machine != NULL ? isa_if->get_machine() : NULL;
+	if (machine == NULL)
+		machine = &default_machine;
+
+	be_assure_live_sets(irg);
+	lv        = be_get_irg_liveness(irg);
+	n_classes = isa_if->n_register_classes;
+	pressure  = XMALLOCN(int, n_classes);
+	limit     = XMALLOCN(int, n_classes);
+	delta     = XMALLOCN(int, n_classes);
+
+	be_list_sched_begin(irg);
+
+	unsigned   last_idx    = get_irg_last_idx(irg);
+	ir_node ***block_nodes = XMALLOCNZ(ir_node**, last_idx);
+	infos = XMALLOCNZ(node_info_t, last_idx);
+	irg_walk_graph(irg, collect_node, NULL, block_nodes);
+
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+	irg_block_walk_graph(irg, sched_block, NULL, block_nodes);
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+
+	be_list_sched_finish();
+
+	free(block_nodes);
+	free(infos);
+	free(delta);
+	free(limit);
+	free(pressure);
+}
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_sched_latency)
+void be_init_sched_latency(void)
+{
+	be_register_scheduler("latency", sched_latency);
+	FIRM_DBG_REGISTER(dbg, "firm.be.sched.latency");
+}
@@ -76,6 +76,7 @@ static workset_t                   *temp_workset;
 static bool                         move_spills      = true;
 static bool                         respectloopdepth = true;
 static bool                         improve_known_preds = true;
+static bool                         loop_placement   = true;
 /* factor to weight the different costs of reloading/rematerializing a node
    (see bespill.h be_get_reload_costs_no_weight) */
 static int                          remat_bonus      = 10;
@@ -84,6 +85,7 @@ static const lc_opt_table_entry_t options[] = {
 	LC_OPT_ENT_BOOL   ("movespills", "try to move spills out of loops", &move_spills),
 	LC_OPT_ENT_BOOL   ("respectloopdepth", "outermost loop cutting", &respectloopdepth),
 	LC_OPT_ENT_BOOL   ("improveknownpreds", "known preds cutting", &improve_known_preds),
+	LC_OPT_ENT_BOOL   ("loopplacement", "move spills to loop preheaders and reloads to loop exits", &loop_placement),
 	LC_OPT_ENT_INT    ("rematbonus", "give bonus to rematerialisable nodes", &remat_bonus),
 	LC_OPT_LAST
 };
@@ -828,6 +830,284 @@ static void fix_block_borders(ir_node *block, void *data)
 	}
 }
 
+/** A control flow edge, given by its target block and predecessor position. */
+typedef struct cf_edge_t {
+	ir_node *block;
+	int      pos;
+} cf_edge_t;
+
+/** The blocks of a loop and the control flow edges entering and leaving it. */
+typedef struct loop_info_t {
+	ir_node   **blocks;  /**< blocks of the loop and its inner loops */
+	cf_edge_t  *entries; /**< edges from outside into the loop */
+	cf_edge_t  *exits;   /**< edges from the loop to outside */
+} loop_info_t;
+
+static double loop_costs_before;
+static double loop_costs_after;
+
+static loop_info_t *get_loop_info(ir_loop *loop)
+{
+	loop_info_t *info = (loop_info_t*)get_loop_link(loop);
+	if (info == NULL) {
+		info          = OALLOCZ(&obst, loop_info_t);
+		info->blocks  = NEW_ARR_F(ir_node*, 0);
+		info->entries = NEW_ARR_F(cf_edge_t, 0);
+		info->exits   = NEW_ARR_F(cf_edge_t, 0);
+		set_loop_link(loop, info);
+	}
+	return info;
+}
+
+static void collect_loop_info(ir_node *block)
+{
+	for (ir_loop *loop = get_irn_loop(block); get_loop_depth(loop) > 0;
+	     loop = get_loop_outer_loop(loop)) {
+		ARR_APP1(ir_node*, get_loop_info(loop)->blocks, block);
+	}
+
+	for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+		ir_node         *pred = get_Block_cfgpred_block(block, i);
+		cf_edge_t const  edge = { block, i };
+		for (ir_loop *loop = get_irn_loop(block); get_loop_depth(loop) > 0
+		     && !be_is_block_in_loop(pred, loop);
+		     loop = get_loop_outer_loop(loop)) {
+			ARR_APP1(cf_edge_t, get_loop_info(loop)->entries, edge);
+		}
+		for (ir_loop *loop = get_irn_loop(pred); get_loop_depth(loop) > 0
+		     && !be_is_block_in_loop(block, loop);
+		     loop = get_loop_outer_loop(loop)) {
+			ARR_APP1(cf_edge_t, get_loop_info(loop)->exits, edge);
+		}
+	}
+}
+
+static void clear_loop_links(ir_loop *loop)
+{
+	set_loop_link(loop, NULL);
+	for (size_t i = 0, n = get_loop_n_elements(loop); i < n; ++i) {
+		loop_element elem = get_loop_element(loop, i);
+		if (*elem.kind == k_ir_loop)
+			clear_loop_links(elem.son);
+	}
+}
+
+static void free_loop_info(ir_loop *loop)
+{
+	loop_info_t *info = (loop_info_t*)get_loop_link(loop);
+	if (info != NULL) {
+		DEL_ARR_F(info->blocks);
+		DEL_ARR_F(info->entries);
+		DEL_ARR_F(info->exits);
+		set_loop_link(loop, NULL);
+	}
+	for (size_t i = 0, n = get_loop_n_elements(loop); i < n; ++i) {
+		loop_element elem = get_loop_element(loop, i);
+		if (*elem.kind == k_ir_loop)
+			free_loop_info(elem.son);
+	}
+}
+
+/**
+ * Returns true if @p value is held in a register at the end of @p block.
+ * If @p loop is not NULL, @p value is assumed to be evicted from it.
+ */
+static bool in_register_at_end(const ir_node *value, const ir_node *block,
+                               const ir_loop *loop)
+{
+	if (loop != NULL && be_is_block_in_loop(block, loop))
+		return false;
+	return workset_contains(get_block_info(block)->end_workset, value) != NULL;
+}
+
+/**
+ * Returns true if @p value must be in a register when @p block is entered
+ * from its predecessor @p pos, either itself or as argument of a Phi.
+ * If @p loop is not NULL, @p value is assumed to be evicted from it.
+ */
+static bool needed_at_start(const ir_node *value, ir_node *block, int pos,
+                            const ir_loop *loop)
+{
+	bool const evicted = loop != NULL && be_is_block_in_loop(block, loop);
+	ir_node   *node    = NULL;
+	workset_foreach(get_block_info(block)->start_workset, node, iter) {
+		if (is_Phi(node) && get_nodes_block(node) == block) {
+			if (get_irn_n(node, pos) == value)
+				return true;
+		} else if (node == value && !evicted) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Returns the costs of the reloads fix_block_borders() adds for @p value on
+ * the edges into the blocks of @p loop and on its exits. If @p evicted is
+ * set, the costs are computed as if @p value was evicted from the loop.
+ */
+static double get_loop_reload_costs(ir_node *value, ir_loop *loop,
+                                    const loop_info_t *info, bool evicted)
+{
+	const ir_loop *evicted_from = evicted ? loop : NULL;
+	double         costs        = 0;
+	for (size_t b = 0, n_blocks = ARR_LEN(info->blocks); b < n_blocks; ++b) {
+		ir_node *block = info->blocks[b];
+		for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+			ir_node *pred = get_Block_cfgpred_block(block, i);
+			if (needed_at_start(value, block, i, evicted_from)
+			    && !in_register_at_end(value, pred, evicted_from))
+				costs += be_get_reload_costs_on_edge(senv, value, block, i);
+		}
+	}
+	for (size_t e = 0, n_exits = ARR_LEN(info->exits); e < n_exits; ++e) {
+		cf_edge_t const *exit = &info->exits[e];
+		ir_node   const *pred = get_Block_cfgpred_block(exit->block, exit->pos);
+		if (needed_at_start(value, exit->block, exit->pos, evicted_from)
+		    && !in_register_at_end(value, pred, evicted_from))
+			costs += be_get_reload_costs_on_edge(senv, value, exit->block,
+			                                     exit->pos);
+	}
+	return costs;
+}
+
+/**
+ * Returns true if the user @p users[idx] comes first in its block.
+ */
+static bool is_first_use(ir_node *const *users, size_t idx)
+{
+	const ir_node *user  = users[idx];
+	const ir_node *block = get_nodes_block(user);
+	for (size_t i = 0, n = ARR_LEN(users); i < n; ++i) {
+		const ir_node *other = users[i];
+		if (other == user ? i < idx : get_nodes_block(other) == block
+		                              && sched_comes_before(other, user))
+			return false;
+	}
+	return true;
+}
+
+/**
+ * Decides whether @p value, which is in a register at the start of the loop
+ * header, is better kept in memory inside @p loop: Then it is spilled at the
+ * end of the preheader, and reloaded before its first use in each block of
+ * the loop and on the loop exits, instead of on the edges where belady lost
+ * it from the register, like the backedge of a loop where it is only used
+ * in a cold block. Reloads and remats are weighted by execution frequency
+ * with the cheaper of both.
+ */
+static void place_value_in_loop(ir_node *value, ir_loop *loop,
+                                const loop_info_t *info)
+{
+	/* collect the uses inside the loop, a reload must be possible before
+	 * them. Uses by Phis are covered by the reloads on edges. */
+	ir_node **users = NEW_ARR_F(ir_node*, 0);
+	foreach_out_edge(value, edge) {
+		ir_node *user = get_edge_src_irn(edge);
+		if (is_Phi(user) || !be_is_block_in_loop(get_nodes_block(user), loop))
+			continue;
+		int const pos = get_edge_src_pos(edge);
+		if (be_is_Keep(user) || !sched_is_scheduled(user)
+		    || arch_get_irn_register_req_in(user, pos)->cls != cls)
+			goto out;
+		ARR_APP1(ir_node*, users, user);
+	}
+
+	double costs_before = get_loop_reload_costs(value, loop, info, false);
+	double costs_after  = get_loop_reload_costs(value, loop, info, true);
+	for (size_t i = 0, n = ARR_LEN(users); i < n; ++i) {
+		ir_node *user = users[i];
+		/* without a reload, the value is in the workset at its first use */
+		if (is_first_use(users, i) && !be_has_reload(senv, value, user))
+			costs_after += be_get_reload_costs(senv, value, user);
+	}
+	for (size_t e = 0, n = ARR_LEN(info->entries); e < n; ++e) {
+		ir_node     *pred = get_Block_cfgpred_block(info->entries[e].block,
+		                                            info->entries[e].pos);
+		const loc_t *loc  = workset_contains(get_block_info(pred)->end_workset,
+		                                     value);
+		if (loc != NULL && !loc->spilled) {
+			ir_node *last = be_get_end_of_block_insertion_point(pred);
+			costs_after += be_get_spill_costs(senv, value, last);
+		}
+	}
+	if (costs_after >= costs_before)
+		goto out;
+
+	DB((dbg, DBG_SPILL, "Keep %+F in memory in loop %ld (costs %f -> %f)\n",
+	    value, get_loop_loop_nr(loop), costs_before, costs_after));
+	loop_costs_before += costs_before;
+	loop_costs_after  += costs_after;
+	for (size_t b = 0, n = ARR_LEN(info->blocks); b < n; ++b) {
+		block_info_t *block_info = get_block_info(info->blocks[b]);
+		workset_remove(block_info->start_workset, value);
+		workset_remove(block_info->end_workset, value);
+	}
+	for (size_t i = 0, n = ARR_LEN(users); i < n; ++i) {
+		ir_node *user = users[i];
+		if (is_first_use(users, i) && !be_has_reload(senv, value, user))
+			be_add_reload(senv, value, user);
+	}
+	/* the value is not in a register at these spills anymore, the spill at the
+	 * end of the preheader is added by fix_block_borders() */
+	be_remove_spills_in_loop(senv, value, loop);
+
+out:
+	DEL_ARR_F(users);
+}
+
+/**
+ * Walks the loop tree from the outside in and decides for the values in a
+ * register at the start of each loop whether they are better kept in memory
+ * inside the loop.
+ */
+static void place_values_in_loops(ir_loop *loop)
+{
+	loop_info_t *info = (loop_info_t*)get_loop_link(loop);
+	if (info != NULL && get_loop_depth(loop) > 0) {
+		/* only handle loops with a single header */
+		ir_node *header = NULL;
+		for (size_t e = 0, n = ARR_LEN(info->entries); e < n; ++e) {
+			ir_node *block = info->entries[e].block;
+			if (header != NULL && header != block) {
+				header = NULL;
+				break;
+			}
+			header = block;
+		}
+
+		if (header != NULL) {
+			/* copy the values, the start workset changes */
+			const workset_t *start  = get_block_info(header)->start_workset;
+			unsigned         len    = workset_get_length(start);
+			ir_node        **values = ALLOCAN(ir_node*, len);
+			for (unsigned i = 0; i < len; ++i)
+				values[i] = workset_get_val(start, i);
+
+			for (unsigned i = 0; i < len; ++i) {
+				ir_node *value = values[i];
+				if (get_nodes_block(value) == header
+				    || arch_irn_is(skip_Proj_const(value), dont_spill))
+					continue;
+				place_value_in_loop(value, loop, info);
+			}
+		}
+	}
+
+	for (size_t i = 0, n = get_loop_n_elements(loop); i < n; ++i) {
+		loop_element elem = get_loop_element(loop, i);
+		if (*elem.kind == k_ir_loop)
+			place_values_in_loops(elem.son);
+	}
+}
+
+static bool in_register_at_end_of_block(const ir_node *value,
+                                        const ir_node *block, void *data)
+{
+	(void)data;
+	return in_register_at_end(value, block, NULL);
+}
+
 static void be_spill_belady(ir_graph *irg, const arch_register_class_t *rcls,
 							const regalloc_if_t *regif)
 {
@@ -839,7 +1119,7 @@ static void be_spill_belady(ir_graph *irg, const arch_register_class_t *rcls,
 
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
 	stat_ev_tim_push();
-	irg_walk_graph(irg, firm_clear_link, NULL, NULL);
+	irg_walk_graph_unordered(irg, firm_clear_link, NULL);
 	stat_ev_tim_pop("belady_time_clear_links");
 
 	/* init belady env */
@@ -861,15 +1141,36 @@ static void be_spill_belady(ir_graph *irg, const arch_register_class_t *rcls,
 	for (size_t i = ARR_LEN(blocklist); i-- > 0; ) {
 		process_block(blocklist[i]);
 	}
-	DEL_ARR_F(blocklist);
 	stat_ev_tim_pop("belady_time_belady");
 
+	bool const place_loops = move_spills && loop_placement;
+	if (place_loops) {
+		stat_ev_tim_push();
+		loop_costs_before = 0;
+		loop_costs_after  = 0;
+		clear_loop_links(get_irg_loop(irg));
+		for (size_t i = ARR_LEN(blocklist); i-- > 0; ) {
+			collect_loop_info(blocklist[i]);
+		}
+		place_values_in_loops(get_irg_loop(irg));
+		free_loop_info(get_irg_loop(irg));
+		stat_ev_dbl("belady_loop_costs_before", loop_costs_before);
+		stat_ev_dbl("belady_loop_costs_after", loop_costs_after);
+		stat_ev_tim_pop("belady_time_loops");
+	}
+	DEL_ARR_F(blocklist);
+
 	stat_ev_tim_push();
 	/* belady was block-local, fix the global flow by adding reloads on the
 	 * edges */
 	irg_block_walk_graph(irg, fix_block_borders, NULL, NULL);
 	stat_ev_tim_pop("belady_time_fix_borders");
 
+	/* spills where values are displaced inside a loop can often be moved to
+	 * the loop preheader */
+	if (place_loops)
+		be_hoist_spills(senv, in_register_at_end_of_block, NULL);
+
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
 
 	/* Insert spill/reload nodes into the graph and fix usages */
@@ -31,9 +31,11 @@
 #include "ident_t.h"
 #include "irbackedge_t.h"
 #include "ircons_t.h"
+#include "irdom.h"
 #include "iredges_t.h"
 #include "irgmod.h"
 #include "irgwalk.h"
+#include "irloop.h"
 #include "irnodehashmap.h"
 #include "irnode_t.h"
 #include "statev_t.h"
@@ -86,6 +88,8 @@ struct spill_env_t {
 	unsigned          reload_count;
 	unsigned          remat_count;
 	unsigned          spilled_phi_count;
+	double            spill_costs;  /**< weighted costs of the spills */
+	double            reload_costs; /**< weighted costs of reloads and remats */
 };
 
 /**
@@ -125,16 +129,13 @@ void be_delete_spill_env(spill_env_t *env)
 	free(env);
 }
 
-void be_add_spill(spill_env_t *env, ir_node *to_spill, ir_node *after)
+static void add_spill_point(spill_env_t *env, spill_info_t *spill_info,
+                            ir_node *after)
 {
-	assert(!arch_irn_is(skip_Proj_const(to_spill), dont_spill));
-	DB((dbg, LEVEL_1, "Add spill of %+F after %+F\n", to_spill, after));
-
 	/* Just for safety make sure that we do not insert the spill in front of a phi */
 	assert(!is_Phi(sched_next(after)));
 
 	/* spills that are dominated by others are not needed */
-	spill_info_t *spill_info = get_spillinfo(env, to_spill);
 	for (spill_t **anchor = &spill_info->spills; *anchor;) {
 		spill_t *const s = *anchor;
 		/* no need to add this spill if it is dominated by another */
@@ -158,6 +159,155 @@ void be_add_spill(spill_env_t *env, ir_node *to_spill, ir_node *after)
 	spill_info->spills = spill;
 }
 
+void be_add_spill(spill_env_t *env, ir_node *to_spill, ir_node *after)
+{
+	assert(!arch_irn_is(skip_Proj_const(to_spill), dont_spill));
+	DB((dbg, LEVEL_1, "Add spill of %+F after %+F\n", to_spill, after));
+
+	spill_info_t *spill_info = get_spillinfo(env, to_spill);
+	add_spill_point(env, spill_info, after);
+}
+
+void be_remove_spills_in_loop(spill_env_t *env, ir_node *to_spill,
+                              const ir_loop *loop)
+{
+	spill_info_t *info = ir_nodehashmap_get(spill_info_t, &env->spillmap,
+	                                        to_spill);
+	if (info == NULL)
+		return;
+
+	for (spill_t **anchor = &info->spills; *anchor;) {
+		spill_t *const s = *anchor;
+		if (be_is_block_in_loop(get_block(s->after), loop)) {
+			DB((dbg, LEVEL_1, "Remove spill of %+F after %+F\n", to_spill,
+			    s->after));
+			*anchor = s->next;
+		} else {
+			anchor = &s->next;
+		}
+	}
+}
+
+/**
+ * Returns the costs of the cheaper choice of spilling after the definition and
+ * spilling at the current spill points of @p info (see determine_spill_costs).
+ */
+static double get_spill_placement_costs(const spill_env_t *env,
+                                        const spill_info_t *info)
+{
+	const ir_node *insn     = skip_Proj_const(info->to_spill);
+	double         def_freq = get_block_execfreq(get_nodes_block(insn));
+	double         freq     = 0;
+	for (const spill_t *s = info->spills; s != NULL; s = s->next)
+		freq += get_block_execfreq(get_block_const(s->after));
+	return MIN(freq, def_freq) * env->regif.spill_cost;
+}
+
+/**
+ * Returns the block from which @p loop is entered, if it is the only one and
+ * dominates @p block of the loop, NULL otherwise.
+ */
+static ir_node *get_loop_preheader(ir_node *block, const ir_loop *loop)
+{
+	/* the header of a reducible loop dominates all its blocks */
+	ir_node *header = block;
+	for (ir_node *dom = get_Block_idom(block);
+	     dom != NULL && be_is_block_in_loop(dom, loop);
+	     dom = get_Block_idom(dom)) {
+		header = dom;
+	}
+
+	ir_node *preheader = NULL;
+	for (int i = 0, n = get_Block_n_cfgpreds(header); i < n; ++i) {
+		ir_node *pred = get_Block_cfgpred_block(header, i);
+		if (be_is_block_in_loop(pred, loop))
+			continue;
+		if (preheader != NULL)
+			return NULL;
+		preheader = pred;
+	}
+	if (preheader == NULL || !block_dominates(preheader, block))
+		return NULL;
+	return preheader;
+}
+
+/**
+ * Returns the point in the preheader of a loop around @p after with the lowest
+ * execution frequency at which @p value can be spilled, or @p after.
+ */
+static ir_node *hoist_spill(ir_node *value, ir_node *after,
+                            be_in_register_at_end_func *in_register,
+                            void *data)
+{
+	ir_node *const def_block = get_nodes_block(skip_Proj(value));
+	ir_node *const block     = get_block(after);
+	ir_node       *best      = after;
+	double         best_freq = get_block_execfreq(block);
+	for (ir_loop *loop = get_irn_loop(block); get_loop_depth(loop) > 0;
+	     loop = get_loop_outer_loop(loop)) {
+		/* the outer loops contain the definition, too */
+		if (be_is_block_in_loop(def_block, loop))
+			break;
+
+		ir_node *const preheader = get_loop_preheader(block, loop);
+		if (preheader == NULL || !in_register(value, preheader, data))
+			continue;
+
+		double const freq = get_block_execfreq(preheader);
+		if (freq < best_freq) {
+			best      = sched_prev(be_get_end_of_block_insertion_point(preheader));
+			best_freq = freq;
+		}
+	}
+	return best;
+}
+
+void be_hoist_spills(spill_env_t *env, be_in_register_at_end_func *in_register,
+                     void *data)
+{
+	double costs_before = 0;
+	double costs_after  = 0;
+	for (spill_info_t *info = env->spills; info != NULL; info = info->next) {
+		if (info->spilled_phi || info->spills == NULL)
+			continue;
+
+		double const before = get_spill_placement_costs(env, info);
+		spill_t *const spills = info->spills;
+		info->spills = NULL;
+		for (spill_t *s = spills; s != NULL; s = s->next) {
+			ir_node *const after = hoist_spill(info->to_spill, s->after,
+			                                   in_register, data);
+			add_spill_point(env, info, after);
+		}
+
+		double const after = get_spill_placement_costs(env, info);
+		costs_before += before;
+		if (after < before) {
+			DB((dbg, LEVEL_1, "Hoist spills of %+F (costs %f -> %f)\n",
+			    info->to_spill, before, after));
+			costs_after += after;
+		} else {
+			info->spills = spills;
+			costs_after += before;
+		}
+	}
+	stat_ev_dbl("spill_hoist_costs_before", costs_before);
+	stat_ev_dbl("spill_hoist_costs_after", costs_after);
+}
+
+bool be_has_reload(spill_env_t *env, ir_node *to_spill, const ir_node *before)
+{
+	spill_info_t *info = ir_nodehashmap_get(spill_info_t, &env->spillmap,
+	                                        to_spill);
+	if (info == NULL)
+		return false;
+	for (const reloader_t *rld = info->reloaders; rld != NULL; rld = rld->next) {
+		if (rld->reloader == before)
+			return true;
+	}
+	return false;
+}
+
 void be_add_reload(spill_env_t *env, ir_node *to_spill, ir_node *before)
 {
 	assert(!arch_irn_is(skip_Proj_const(to_spill), dont_spill));
@@ -259,6 +409,8 @@ static void spill_irn(spill_env_t *env, spill_info_t *spillinfo)
 		spill->spill = env->regif.new_spill(to_spill, after);
 		DB((dbg, LEVEL_1, "\t%+F after %+F\n", spill->spill, after));
 		env->spill_count++;
+		env->spill_costs += env->regif.spill_cost
+		                  * get_block_execfreq(get_block(after));
 	}
 	DBG((dbg, LEVEL_1, "\n"));
 }
@@ -609,9 +761,12 @@ void be_insert_spills_reloads(spill_env_t *env)
 		/* go through all reloads for this spill */
 		for (reloader_t *rld = si->reloaders; rld != NULL; rld = rld->next) {
 			ir_node *copy; /* a reload is a "copy" of the original value */
+			double   freq = get_block_execfreq(get_block(rld->reloader));
 			if (be_do_remats && (force_remat || rld->remat_cost_delta < 0)) {
 				copy = do_remat(env, to_spill, rld->reloader);
 				++env->remat_count;
+				env->reload_costs += freq * (env->regif.reload_cost
+				                             + rld->remat_cost_delta);
 			} else {
 				/* make sure we have a spill */
 				spill_node(env, si);
@@ -622,6 +777,7 @@ void be_insert_spills_reloads(spill_env_t *env)
 				copy = env->regif.new_reload(si->to_spill, si->spills->spill,
 											 rld->reloader);
 				env->reload_count++;
+				env->reload_costs += freq * env->regif.reload_cost;
 			}
 
 			DBG((dbg, LEVEL_1, " %+F of %+F before %+F\n",
@@ -668,6 +824,8 @@ void be_insert_spills_reloads(spill_env_t *env)
 	stat_ev_dbl("spill_reloads", env->reload_count);
 	stat_ev_dbl("spill_remats", env->remat_count);
 	stat_ev_dbl("spill_spilled_phis", env->spilled_phi_count);
+	stat_ev_dbl("spill_costs", env->spill_costs);
+	stat_ev_dbl("spill_reload_costs", env->reload_costs);
 
 	/* Matze: In theory be_ssa_construction should take care of the liveness...
 	 * try to disable this again in the future */
@@ -42,6 +42,28 @@ ir_node *be_get_end_of_block_insertion_point(const ir_node *block);
  */
 void be_add_spill(spill_env_t *senv, ir_node *to_spill, ir_node *after);
 
+/**
+ * Removes the spills of @p to_spill added in the blocks of @p loop, for a
+ * value that is not kept in a register inside the loop anymore.
+ */
+void be_remove_spills_in_loop(spill_env_t *senv, ir_node *to_spill,
+                              const ir_loop *loop);
+
+/**
+ * Returns true if @p value is held in a register at the end of @p block.
+ */
+typedef bool be_in_register_at_end_func(const ir_node *value,
+                                        const ir_node *block, void *data);
+
+/**
+ * Moves the spills added with be_add_spill() inside loops to the preheaders
+ * of the loops, if the value is still in a register at their end and the
+ * spills of the value get cheaper by execution frequency. Must be called
+ * before be_insert_spills_reloads().
+ */
+void be_hoist_spills(spill_env_t *senv, be_in_register_at_end_func *in_register,
+                     void *data);
+
 /**
  * Inserts a new entry into the list of reloads to place (the real nodes will
  * be created when be_insert_spills_reloads is run). You don't have to
@@ -55,6 +77,11 @@ void be_add_spill(spill_env_t *senv, ir_node *to_spill, ir_node *after);
  */
 void be_add_reload(spill_env_t *senv, ir_node *to_spill, ir_node *before);
 
+/**
+ * Returns true if a reload of @p to_spill before @p before was added.
+ */
+bool be_has_reload(spill_env_t *senv, ir_node *to_spill, const ir_node *before);
+
 /**
  * Analog to be_add_reload, but places the reload "on an edge" between 2 blocks
  * @see be_add_reload
@@ -25,6 +25,7 @@
 #include "irgraph_t.h"
 #include "irgwalk.h"
 #include "irhooks.h"
+#include "irmemory_t.h"
 #include "irnodemap.h"
 #include "irnode_t.h"
 #include "irop_t.h"
@@ -293,6 +294,8 @@ void be_transform_graph(ir_graph *irg, arch_pretrans_nodes *func)
 	irg->last_node_idx = 0;
 
 	free_vrp_data(irg);
+	free_irg_points_to(irg);
+	free_irg_alias_cache(irg);
 
 	/* create new value table for CSE */
 	new_identities(irg);
@@ -23,6 +23,7 @@
 #include "irgmod.h"
 #include "irgopt.h"
 #include "irgwalk.h"
+#include "irloop.h"
 #include "irnodeset.h"
 #include "iropt.h"
 #include "irtools.h"
@@ -175,3 +176,12 @@ void be_keep_if_unused(ir_node *node)
 		sched_add_after(node, keep);
 	}
 }
+
+bool be_is_block_in_loop(const ir_node *block, const ir_loop *loop)
+{
+	ir_loop *l     = get_irn_loop(block);
+	unsigned depth = get_loop_depth(loop);
+	while (get_loop_depth(l) > depth)
+		l = get_loop_outer_loop(l);
+	return l == loop;
+}
@@ -52,4 +52,9 @@ void be_remove_dead_nodes_from_schedule(ir_graph *irg);
  */
 void be_keep_if_unused(ir_node *node);
 
+/**
+ * Returns true if @p block belongs to @p loop or one of its inner loops.
+ */
+bool be_is_block_in_loop(const ir_node *block, const ir_loop *loop);
+
 #endif
@@ -10,6 +10,8 @@
  */
 #include "be_t.h"
 #include "bearch_ia32_t.h"
+#include "bediagnostic.h"
+#include "beelf.h"
 #include "beflags.h"
 #include "begnuas.h"
 #include "bemodule.h"
@@ -281,6 +283,8 @@ static ir_mode *get_spill_mode(const ir_node *value)
 		return get_ia32_ls_mode(skipped);
 
 	ir_mode *mode = get_irn_mode(value);
+	if (mode_is_vector(mode))
+		return mode;
 	return mode_is_float(mode) ? ia32_mode_E : ia32_mode_gp;
 }
 
@@ -1370,6 +1374,7 @@ static backend_params ia32_backend_params = {
 	.type_long_double              = NULL,  /* will be set later */
 	.stack_param_align             = 4,
 	.float_int_overflow            = ir_overflow_indefinite,
+	.vector_size                   = 0,     /* will be set later */
 };
 
 /**
@@ -1416,6 +1421,7 @@ static void ia32_init(void)
 		ia32_backend_params.mode_float_arithmetic = ia32_mode_E;
 		ia32_backend_params.type_long_double      = ia32_type_E;
 	}
+	ia32_backend_params.vector_size = ia32_cg_config.use_sse2 ? 16 : 0;
 
 	ia32_register_init();
 	obstack_init(&opcodes_obst);
@@ -1448,10 +1454,40 @@ static const regalloc_if_t ia32_regalloc_if = {
 	.perform_memory_operand = ia32_perform_memory_operand,
 };
 
+static void report_asm(ir_node *node, void *env)
+{
+	if (is_ASM(node)) {
+		be_errorf(node, "inline assembler not supported in ELF object output");
+		*(bool*)env = true;
+	}
+}
+
+/**
+ * Rejects programs the binary emitter cannot encode before anything is
+ * written to the object file.
+ */
+static void check_elf_object_support(void)
+{
+	if (ia32_cg_config.use_sse2)
+		panic("SSE floating point not supported in ELF object output, use fpmath=387");
+
+	bool has_asm = false;
+	foreach_irp_irg(i, irg) {
+		if (!(get_entity_linkage(get_irg_entity(irg)) & IR_LINKAGE_NO_CODEGEN))
+			irg_walk_graph(irg, NULL, report_asm, &has_asm);
+	}
+	if (has_asm)
+		panic("inline assembler not supported in ELF object output");
+}
+
 static void ia32_generate_code(FILE *output, const char *cup_name)
 {
 	ia32_tv_ent = pmap_create();
 
+	if (ia32_cg_config.emit_elf_object) {
+		check_elf_object_support();
+		be_elf_select_output(BE_ELF_EM_386, BE_ELF_R_386_32);
+	}
 	be_begin(output, cup_name);
 	unsigned *const sp_is_non_ssa = rbitset_malloc(N_IA32_REGISTERS);
 	rbitset_set(sp_is_non_ssa, REG_ESP);
@@ -1590,6 +1626,7 @@ static arch_isa_if_t const ia32_isa_if = {
 	.lower_for_target      = ia32_lower_for_target,
 	.is_valid_clobber      = ia32_is_valid_clobber,
 	.get_op_estimated_cost = ia32_get_op_estimated_cost,
+	.get_machine           = ia32_get_machine,
 };
 
 BE_REGISTER_MODULE_CONSTRUCTOR(be_init_arch_ia32)
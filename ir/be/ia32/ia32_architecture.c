@@ -15,6 +15,10 @@
 #include "lc_opts_enum.h"
 #include "irtools.h"
 #include "ia32_architecture.h"
+#include "ia32_new_nodes.h"
+#include "gen_ia32_regalloc_if.h"
+#include "bearch.h"
+#include "benode.h"
 #include "tv.h"
 
 #undef NATIVE_X86
@@ -136,6 +140,7 @@ ENUM_BITSET(cpu_arch_features)
 
 static bool              opt_size             = false;
 static bool              emit_machcode        = false;
+static bool              emit_elf_object      = false;
 static bool              use_softfloat        = false;
 static bool              use_sse              = false;
 static bool              use_sse2             = false;
@@ -241,6 +246,7 @@ static const lc_opt_table_entry_t ia32_architecture_options[] = {
 	LC_OPT_ENT_BOOL    ("optcc",            "optimize calling convention",                        &opt_cc),
 	LC_OPT_ENT_BOOL    ("unsafe_floatconv", "do unsafe floating point controlword optimizations", &opt_unsafe_floatconv),
 	LC_OPT_ENT_BOOL    ("machcode",         "output machine code instead of assembler",           &emit_machcode),
+	LC_OPT_ENT_BOOL    ("elfobject",        "write an ELF object file instead of assembler",      &emit_elf_object),
 	LC_OPT_ENT_BOOL    ("soft-float",       "equivalent to fpmath=softfloat",                     &use_softfloat),
 	LC_OPT_ENT_BOOL    ("sse",              "gcc compatibility",                                  &use_sse),
 	LC_OPT_ENT_BOOL    ("sse2",             "gcc compatibility",                                  &use_sse2),
@@ -497,6 +503,182 @@ int ia32_evaluate_insn(insn_kind kind, const ir_mode *mode, ir_tarval *tv)
 	}
 }
 
+/** Functional units distinguished by the machine models. */
+typedef enum ia32_unit_t {
+	UNIT_ALU,
+	UNIT_MUL,
+	UNIT_DIV,
+	UNIT_LOAD,
+	UNIT_STORE,
+	UNIT_BRANCH,
+	UNIT_FP,
+	N_UNITS
+} ia32_unit_t;
+
+typedef struct machine_model {
+	unsigned issue_width;    /**< instructions issued per cycle */
+	unsigned n_ports;        /**< number of execution ports */
+	unsigned load_latency;   /**< latency of a load hitting the L1 cache */
+	unsigned ports[N_UNITS]; /**< ports able to execute each unit */
+} machine_model;
+
+#define P(x) (1U << (x))
+
+/* in-order cpus issuing one instruction per cycle */
+static const machine_model scalar_model = {
+	1, 1, 3,
+	{ P(0), P(0), P(0), P(0), P(0), P(0), P(0) },
+};
+
+/* Pentium: in-order U and V pipes */
+static const machine_model pentium_model = {
+	2, 2, 2,
+	{ P(0)|P(1), P(0), P(0), P(0)|P(1), P(0)|P(1), P(1), P(0) },
+};
+
+/* Pentium Pro up to Pentium M */
+static const machine_model ppro_model = {
+	3, 5, 3,
+	{ P(0)|P(1), P(0), P(0), P(2), P(3)|P(4), P(1), P(0) },
+};
+
+/* Pentium 4 and Nocona */
+static const machine_model netburst_model = {
+	3, 4, 4,
+	{ P(0)|P(1), P(1), P(1), P(2), P(3), P(0), P(1) },
+};
+
+/* Core2 and Penryn */
+static const machine_model core2_model = {
+	4, 6, 3,
+	{ P(0)|P(1)|P(5), P(1), P(0), P(2), P(3)|P(4), P(5), P(0)|P(1) },
+};
+
+/* Atom: in-order, two pipes */
+static const machine_model atom_model = {
+	2, 2, 3,
+	{ P(0)|P(1), P(0), P(0), P(0), P(0), P(1), P(0)|P(1) },
+};
+
+/* Athlon, K8 and K10: three ALUs, three AGUs and the fp unit */
+static const machine_model k8_model = {
+	3, 7, 3,
+	{ P(0)|P(1)|P(2), P(0), P(0), P(3)|P(4), P(3)|P(4)|P(5),
+	  P(0)|P(1)|P(2), P(6) },
+};
+
+/* a recent out-of-order cpu */
+static const machine_model generic32_model = {
+	4, 6, 4,
+	{ P(0)|P(1)|P(5), P(1), P(0), P(2)|P(3), P(4), P(5), P(0)|P(1) },
+};
+
+#undef P
+
+static const machine_model *arch_model = &generic32_model;
+
+static void set_machine_model(void)
+{
+	switch (opt_arch & arch_mask) {
+	case arch_i386:
+	case arch_i486:
+	case arch_k6:
+	case arch_geode:     arch_model = &scalar_model;    break;
+	case arch_pentium:   arch_model = &pentium_model;   break;
+	case arch_ppro:      arch_model = &ppro_model;      break;
+	case arch_netburst:
+	case arch_nocona:    arch_model = &netburst_model;  break;
+	case arch_core2:     arch_model = &core2_model;     break;
+	case arch_atom:      arch_model = &atom_model;      break;
+	case arch_athlon:
+	case arch_k8:
+	case arch_k10:       arch_model = &k8_model;        break;
+	default:
+	case arch_generic32: arch_model = &generic32_model; break;
+	}
+}
+
+static bool is_fp_node(const ir_node *node)
+{
+	if (arch_get_irn_n_outs(node) == 0)
+		return false;
+	const arch_register_req_t *req = arch_get_irn_register_req_out(node, 0);
+	return req->cls == &ia32_reg_classes[CLASS_ia32_xmm]
+	    || req->cls == &ia32_reg_classes[CLASS_ia32_fp];
+}
+
+static ia32_unit_t get_unit(const ir_node *node)
+{
+	switch (get_ia32_irn_opcode(node)) {
+	case iro_ia32_Mul:
+	case iro_ia32_IMul:
+	case iro_ia32_IMul1OP:
+	case iro_ia32_IMulImm:
+		return UNIT_MUL;
+	case iro_ia32_Div:
+	case iro_ia32_IDiv:
+	case iro_ia32_xDiv:
+	case iro_ia32_fdiv:
+		return UNIT_DIV;
+	case iro_ia32_Load:
+	case iro_ia32_xLoad:
+	case iro_ia32_xxLoad:
+	case iro_ia32_fld:
+	case iro_ia32_fild:
+	case iro_ia32_Pop:
+		return UNIT_LOAD;
+	case iro_ia32_Store:
+	case iro_ia32_xStore:
+	case iro_ia32_xxStore:
+	case iro_ia32_fst:
+	case iro_ia32_fist:
+	case iro_ia32_fisttp:
+	case iro_ia32_Push:
+		return UNIT_STORE;
+	default:
+		break;
+	}
+	if (is_cfop(node))
+		return UNIT_BRANCH;
+	if (get_ia32_op_type(node) == ia32_AddrModeD)
+		return UNIT_STORE;
+	return is_fp_node(node) ? UNIT_FP : UNIT_ALU;
+}
+
+static unsigned ia32_get_machine_latency(const ir_node *node)
+{
+	if (!is_ia32_irn(node))
+		return be_is_Keep(node) ? 0 : 1;
+
+	unsigned latency = get_ia32_latency(node);
+	/* the specification does not contain the cache latency */
+	if (get_unit(node) == UNIT_LOAD || get_ia32_op_type(node) != ia32_Normal)
+		latency += arch_model->load_latency;
+	return latency;
+}
+
+static unsigned ia32_get_machine_ports(const ir_node *node)
+{
+	if (!is_ia32_irn(node))
+		return be_is_Copy(node) ? arch_model->ports[UNIT_ALU] : 0;
+	if (is_ia32_NoReg_GP(node) || is_ia32_NoReg_FP(node)
+	    || is_ia32_NoReg_XMM(node) || is_ia32_Immediate(node))
+		return 0;
+	return arch_model->ports[get_unit(node)];
+}
+
+static be_machine_t ia32_machine = {
+	.get_latency = ia32_get_machine_latency,
+	.get_ports   = ia32_get_machine_ports,
+};
+
+const be_machine_t *ia32_get_machine(void)
+{
+	ia32_machine.issue_width = arch_model->issue_width;
+	ia32_machine.n_ports     = arch_model->n_ports;
+	return &ia32_machine;
+}
+
 /* auto detection code only works if we're on an x86 cpu obviously */
 #ifdef NATIVE_X86
 typedef struct x86_cpu_info_t {
@@ -875,6 +1057,7 @@ void ia32_setup_cg_config(void)
 		opt_arch = arch;
 
 	set_arch_costs();
+	set_machine_model();
 
 	ia32_code_gen_config_t *const c = &ia32_cg_config;
 	memset(c, 0, sizeof(*c));
@@ -910,7 +1093,8 @@ void ia32_setup_cg_config(void)
 	c->use_cmpxchg          = (arch & arch_mask) != arch_i386;
 	c->optimize_cc          = opt_cc;
 	c->use_unsafe_floatconv = opt_unsafe_floatconv;
-	c->emit_machcode        = emit_machcode;
+	c->emit_machcode        = emit_machcode || emit_elf_object;
+	c->emit_elf_object      = emit_elf_object;
 
 	c->function_alignment       = arch_costs->function_alignment;
 	c->label_alignment          = arch_costs->label_alignment;
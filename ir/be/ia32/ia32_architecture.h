@@ -12,6 +12,7 @@
 #define FIRM_BE_IA32_ARCHITECTURE_H
 
 #include "irarch_t.h"
+#include "be_types.h"
 
 typedef struct {
 	/** optimize for size */
@@ -79,6 +80,8 @@ typedef struct {
 	unsigned use_unsafe_floatconv:1;
 	/** emit machine code instead of assembler */
 	unsigned emit_machcode:1;
+	/** write the machine code into an ELF object file (implies emit_machcode) */
+	unsigned emit_elf_object:1;
 
 	/** function alignment (a power of two in bytes) */
 	unsigned function_alignment;
@@ -121,4 +124,9 @@ void ia32_setup_cg_config(void);
  */
 int ia32_evaluate_insn(insn_kind kind, const ir_mode *mode, ir_tarval *tv);
 
+/**
+ * Returns the machine model of the cpu selected with the tune option.
+ */
+const be_machine_t *ia32_get_machine(void);
+
 #endif
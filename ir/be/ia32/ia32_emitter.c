@@ -33,6 +33,7 @@
 #include "beasm.h"
 #include "beblocksched.h"
 #include "bediagnostic.h"
+#include "beelf.h"
 #include "begnuas.h"
 #include "besched.h"
 #include "bestack.h"
@@ -1048,7 +1049,12 @@ static void Copy_emitter(const ir_node *node, const ir_node *op)
 	if (in->cls == &ia32_reg_classes[CLASS_ia32_fp])
 		return;
 
-	ia32_emitf(node, "movl %R, %R", in, out);
+	if (in->cls == &ia32_reg_classes[CLASS_ia32_xmm]) {
+		/* copy the whole register, it might contain a vector */
+		ia32_emitf(node, "movaps %R, %R", in, out);
+	} else {
+		ia32_emitf(node, "movl %R, %R", in, out);
+	}
 }
 
 static void emit_be_Copy(const ir_node *node)
@@ -1273,7 +1279,7 @@ static void ia32_emit_node(ir_node *node)
 		/* emit the exception label of this instruction */
 		if (get_ia32_exc_label(node))
 			ia32_assign_exc_label(node);
-		if (mark_spill_reload) {
+		if (mark_spill_reload && !ia32_cg_config.emit_elf_object) {
 			if (is_ia32_is_spill(node))
 				ia32_emitf(NULL, "xchg %ebx, %ebx        /* spill mark */");
 			if (is_ia32_is_reload(node))
@@ -1300,7 +1306,11 @@ static void ia32_emit_node(ir_node *node)
  */
 static void ia32_emit_alignment(unsigned align, unsigned skip)
 {
-	ia32_emitf(NULL, ".p2align %u,,%u", align, skip);
+	if (ia32_cg_config.emit_elf_object) {
+		be_elf_align_code(align, skip, 0x90);
+	} else {
+		ia32_emitf(NULL, ".p2align %u,,%u", align, skip);
+	}
 }
 
 /**
@@ -1394,8 +1404,12 @@ static void ia32_emit_block_header(ir_node *block)
 		}
 	}
 
-	const bool need_label = block_needs_label(block);
-	be_gas_begin_block(block, need_label);
+	if (ia32_cg_config.emit_elf_object) {
+		be_elf_begin_block(block);
+	} else {
+		const bool need_label = block_needs_label(block);
+		be_gas_begin_block(block, need_label);
+	}
 }
 
 /**
@@ -1600,25 +1614,35 @@ enum Mod {
 
 /* Node: The following routines are supposed to append bytes, words, dwords
    to the output stream.
-   Currently the implementation is stupid in that it still creates output
-   for an "assembler" in the form of .byte, .long
-   We will change this when enough infrastructure is there to create complete
-   machine code in memory/object files */
+   When writing ELF object files the bytes go directly into the text section,
+   otherwise we create output for an "assembler" in the form of .byte, .long */
 
 static void bemit8(const uint8_t byte)
 {
+	if (ia32_cg_config.emit_elf_object) {
+		be_elf_emit8(byte);
+		return;
+	}
 	be_emit_irprintf("\t.byte 0x%x\n", byte);
 	be_emit_write_line();
 }
 
 static void bemit16(const uint16_t u16)
 {
+	if (ia32_cg_config.emit_elf_object) {
+		be_elf_emit16(u16);
+		return;
+	}
 	be_emit_irprintf("\t.word 0x%x\n", u16);
 	be_emit_write_line();
 }
 
 static void bemit32(const uint32_t u32)
 {
+	if (ia32_cg_config.emit_elf_object) {
+		be_elf_emit32(u32);
+		return;
+	}
 	be_emit_irprintf("\t.long 0x%x\n", u32);
 	be_emit_write_line();
 }
@@ -1634,8 +1658,20 @@ static void bemit_entity(ir_entity *entity, int32_t offset, bool is_relative)
 		return;
 	}
 
-	/* the final version should remember the position in the bytestream
-	   and patch it with the correct address at linktime... */
+	if (ia32_cg_config.emit_elf_object) {
+		uint32_t type = BE_ELF_R_386_32;
+		if (is_tls_entity(entity)) {
+			type = entity_has_definition(entity) ? BE_ELF_R_386_TLS_LE
+			                                     : BE_ELF_R_386_TLS_IE;
+		}
+		if (is_relative) {
+			type    = BE_ELF_R_386_PC32;
+			offset -= 4;
+		}
+		be_elf_emit_reloc32(entity, offset, type);
+		return;
+	}
+
 	be_emit_cstring("\t.long ");
 	be_gas_emit_entity(entity);
 
@@ -1661,6 +1697,10 @@ static void bemit_entity(ir_entity *entity, int32_t offset, bool is_relative)
 
 static void bemit_jmp_destination(const ir_node *dest_block)
 {
+	if (ia32_cg_config.emit_elf_object) {
+		be_elf_emit_block_ref32(dest_block);
+		return;
+	}
 	be_emit_cstring("\t.long ");
 	be_gas_emit_block_name(dest_block);
 	be_emit_cstring(" - . - 4\n");
@@ -2412,6 +2452,13 @@ EMIT_SINGLEOP(int3,  0xCC)
 EMIT_SINGLEOP(cmc,   0xF5)
 EMIT_SINGLEOP(stc,   0xF9)
 
+static void bemit_ud2(const ir_node *node)
+{
+	(void)node;
+	bemit8(0x0F);
+	bemit8(0x0B);
+}
+
 /**
  * Emits a MOV out, [MEM].
  */
@@ -2535,18 +2582,14 @@ static void bemit_popmem(const ir_node *node)
 
 static void bemit_call(const ir_node *node)
 {
-	(void)node;
-	panic("bemit_call NIY");
-#if 0
-	ir_node *proc = get_irn_n(node, n_ia32_Call_addr);
+	ir_node *proc = get_irn_n(node, n_ia32_Call_callee);
 
 	if (is_ia32_Immediate(proc)) {
 		bemit8(0xE8);
 		bemit_imm32(proc, true);
 	} else {
-		bemit_unop(node, 0xFF, 2, n_ia32_Call_addr);
+		bemit_unop(node, 0xFF, 2, n_ia32_Call_callee);
 	}
-#endif
 }
 
 static void bemit_jmp(const ir_node *dest_block)
@@ -2649,9 +2692,13 @@ static void bemit_switchjmp(const ir_node *node)
 	const ir_switch_table *table      = get_ia32_switch_table(node);
 
 	bemit8(0xFF); // jmp *tbl.label(,%in,4)
-	bemit_mod_am(0x05, node);
+	bemit_mod_am(0x04, node);
 
-	be_emit_jump_table(node, table, jump_table, get_cfop_target_block);
+	if (ia32_cg_config.emit_elf_object) {
+		be_elf_emit_jump_table(node, table, jump_table, get_cfop_target_block);
+	} else {
+		be_emit_jump_table(node, table, jump_table, get_cfop_target_block);
+	}
 }
 
 static void bemit_return(const ir_node *node)
@@ -2857,6 +2904,41 @@ static void bemit_fld1(const ir_node *node)
 	bemit8(0xE8); // fld1
 }
 
+static void bemit_fldl2e(const ir_node *node)
+{
+	(void)node;
+	bemit8(0xD9);
+	bemit8(0xEA); // fldl2e
+}
+
+static void bemit_fldl2t(const ir_node *node)
+{
+	(void)node;
+	bemit8(0xD9);
+	bemit8(0xE9); // fldl2t
+}
+
+static void bemit_fldlg2(const ir_node *node)
+{
+	(void)node;
+	bemit8(0xD9);
+	bemit8(0xEC); // fldlg2
+}
+
+static void bemit_fldln2(const ir_node *node)
+{
+	(void)node;
+	bemit8(0xD9);
+	bemit8(0xED); // fldln2
+}
+
+static void bemit_fldpi(const ir_node *node)
+{
+	(void)node;
+	bemit8(0xD9);
+	bemit8(0xEB); // fldpi
+}
+
 static void bemit_fldcw(const ir_node *node)
 {
 	bemit8(0xD9); // fldcw
@@ -2956,13 +3038,21 @@ static void bemit_fxch(const ir_node *node)
 	bemit_fop_reg(node, 0xD9, 0xC8);
 }
 
+static void bemit_asm(const ir_node *node)
+{
+	panic("inline assembler not supported in ELF object output (%+F)", node);
+}
+
 static void ia32_register_binary_emitters(void)
 {
-	/* first clear the generic function pointer for all ops */
-	ir_clear_opcodes_generic_func();
+	be_init_emitters();
 
 	/* benode emitter */
-	be_set_emitter(op_be_Asm,             emit_ia32_Asm); // TODO implement binary emitter
+	if (ia32_cg_config.emit_elf_object) {
+		be_set_emitter(op_be_Asm,         bemit_asm);
+	} else {
+		be_set_emitter(op_be_Asm,         emit_ia32_Asm); // TODO implement binary emitter
+	}
 	be_set_emitter(op_be_Copy,            bemit_copy);
 	be_set_emitter(op_be_CopyKeep,        bemit_copy);
 	be_set_emitter(op_be_IncSP,           bemit_incsp);
@@ -2984,6 +3074,7 @@ static void ia32_register_binary_emitters(void)
 	be_set_emitter(op_ia32_Cmc,           bemit_cmc);
 	be_set_emitter(op_ia32_Cmp,           bemit_cmp);
 	be_set_emitter(op_ia32_Const,         bemit_mov_const);
+	be_set_emitter(op_ia32_CopyEbpEsp,    bemit_copy);
 	be_set_emitter(op_ia32_Conv_I2I,      bemit_conv_i2i);
 	be_set_emitter(op_ia32_CopyB_i,       bemit_copybi);
 	be_set_emitter(op_ia32_Cwtl,          bemit_cwtl);
@@ -3044,6 +3135,7 @@ static void ia32_register_binary_emitters(void)
 	be_set_emitter(op_ia32_SubSP,         bemit_subsp);
 	be_set_emitter(op_ia32_SwitchJmp,     bemit_switchjmp);
 	be_set_emitter(op_ia32_Test,          bemit_test);
+	be_set_emitter(op_ia32_UD2,           bemit_ud2);
 	be_set_emitter(op_ia32_Xor,           bemit_xor);
 	be_set_emitter(op_ia32_Xor0,          bemit_xor0);
 	be_set_emitter(op_ia32_XorMem,        bemit_xormem);
@@ -3057,6 +3149,11 @@ static void ia32_register_binary_emitters(void)
 	be_set_emitter(op_ia32_fisttp,        bemit_fisttp);
 	be_set_emitter(op_ia32_fld,           bemit_fld);
 	be_set_emitter(op_ia32_fld1,          bemit_fld1);
+	be_set_emitter(op_ia32_fldl2e,        bemit_fldl2e);
+	be_set_emitter(op_ia32_fldl2t,        bemit_fldl2t);
+	be_set_emitter(op_ia32_fldlg2,        bemit_fldlg2);
+	be_set_emitter(op_ia32_fldln2,        bemit_fldln2);
+	be_set_emitter(op_ia32_fldpi,         bemit_fldpi);
 	be_set_emitter(op_ia32_fldz,          bemit_fldz);
 	be_set_emitter(op_ia32_fmul,          bemit_fmul);
 	be_set_emitter(op_ia32_fpop,          bemit_fpop);
@@ -3064,6 +3161,12 @@ static void ia32_register_binary_emitters(void)
 	be_set_emitter(op_ia32_fst,           bemit_fst);
 	be_set_emitter(op_ia32_fsub,          bemit_fsub);
 	be_set_emitter(op_ia32_fxch,          bemit_fxch);
+
+	/* ignore the following nodes */
+	be_set_emitter(op_ia32_FnstCWNOP,     be_emit_nothing);
+	be_set_emitter(op_ia32_Start,         be_emit_nothing);
+	be_set_emitter(op_ia32_Unknown,       be_emit_nothing);
+	be_set_emitter(op_ia32_xUnknown,      be_emit_nothing);
 }
 
 static void gen_binary_block(ir_node *block)
@@ -3082,10 +3185,14 @@ static void ia32_emit_function_binary(ir_graph *const irg, ir_node **const blk_s
 
 	ia32_register_binary_emitters();
 
-	parameter_dbg_info_t *infos = construct_parameter_infos(irg);
-	be_gas_emit_function_prolog(entity, ia32_cg_config.function_alignment,
-	                            NULL);
-	free(infos);
+	if (ia32_cg_config.emit_elf_object) {
+		be_elf_begin_function(entity, ia32_cg_config.function_alignment);
+	} else {
+		parameter_dbg_info_t *infos = construct_parameter_infos(irg);
+		be_gas_emit_function_prolog(entity, ia32_cg_config.function_alignment,
+		                            NULL);
+		free(infos);
+	}
 
 	/* we use links to point to target blocks */
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
@@ -3104,7 +3211,11 @@ static void ia32_emit_function_binary(ir_graph *const irg, ir_node **const blk_s
 		gen_binary_block(block);
 	}
 
-	be_gas_emit_function_epilog(entity);
+	if (ia32_cg_config.emit_elf_object) {
+		be_elf_end_function(entity);
+	} else {
+		be_gas_emit_function_epilog(entity);
+	}
 
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
 }
@@ -372,6 +372,14 @@ my $xvalueop = {
 	mode      => $mode_xmm,
 };
 
+my $xxbinop = {
+	irn_flags => [ "rematerializable" ],
+	in_reqs   => [ "xmm", "xmm" ],
+	out_reqs  => [ "in_r1 !in_r2" ],
+	ins       => [ "left", "right" ],
+	mode      => $mode_xmm,
+};
+
 my $carry_user_op = {
 	irn_flags => [ "modify_flags" ],
 	attr_type => "ia32_condcode_attr_t",
@@ -1888,10 +1896,10 @@ xxLoad => {
 	op_flags  => [ "uses_memory", "fragile" ],
 	state     => "exc_pinned",
 	in_reqs   => [ "gp", "gp", "none" ],
-	out_reqs  => [ "xmm", "none", "none", "none" ],
-	emit      => "movdqu %D0, %AM",
+	out_reqs  => [ "xmm", "none", "none", "none", "none" ],
+	emit      => "movdqu %AM, %D0",
 	ins       => [ "base", "index", "mem" ],
-	outs      => [ "res", "M", "X_regular", "X_except" ],
+	outs      => [ "res", "unused", "M", "X_regular", "X_except" ],
 	latency   => 1,
 },
 
@@ -1906,6 +1914,161 @@ xxStore => {
 	latency  => 1,
 },
 
+# Packed operations on vector modes, the node mode is set to the vector mode #
+
+xxBroadcast8 => {
+	irn_flags => [ "rematerializable" ],
+	in_reqs   => [ "gp" ],
+	out_reqs  => [ "xmm" ],
+	emit      => "movd %S0, %D0\n".
+	             "punpcklbw %D0, %D0\n".
+	             "punpcklwd %D0, %D0\n".
+	             "pshufd \$0, %D0, %D0",
+	latency   => 4,
+	mode      => $mode_xmm,
+},
+
+xxBroadcast16 => {
+	irn_flags => [ "rematerializable" ],
+	in_reqs   => [ "gp" ],
+	out_reqs  => [ "xmm" ],
+	emit      => "movd %S0, %D0\n".
+	             "punpcklwd %D0, %D0\n".
+	             "pshufd \$0, %D0, %D0",
+	latency   => 3,
+	mode      => $mode_xmm,
+},
+
+xxBroadcast32 => {
+	irn_flags => [ "rematerializable" ],
+	in_reqs   => [ "gp" ],
+	out_reqs  => [ "xmm" ],
+	emit      => "movd %S0, %D0\n".
+	             "pshufd \$0, %D0, %D0",
+	latency   => 2,
+	mode      => $mode_xmm,
+},
+
+xxBroadcastps => {
+	irn_flags => [ "rematerializable" ],
+	in_reqs   => [ "xmm" ],
+	out_reqs  => [ "in_r1" ],
+	emit      => "shufps \$0, %D0, %D0",
+	latency   => 1,
+	mode      => $mode_xmm,
+},
+
+xxBroadcastpd => {
+	irn_flags => [ "rematerializable" ],
+	in_reqs   => [ "xmm" ],
+	out_reqs  => [ "in_r1" ],
+	emit      => "unpcklpd %D0, %D0",
+	latency   => 1,
+	mode      => $mode_xmm,
+},
+
+xxPaddb => {
+	template => $xxbinop,
+	emit     => "paddb %S1, %D0",
+	latency  => 1,
+},
+
+xxPaddw => {
+	template => $xxbinop,
+	emit     => "paddw %S1, %D0",
+	latency  => 1,
+},
+
+xxPaddd => {
+	template => $xxbinop,
+	emit     => "paddd %S1, %D0",
+	latency  => 1,
+},
+
+xxPaddq => {
+	template => $xxbinop,
+	emit     => "paddq %S1, %D0",
+	latency  => 1,
+},
+
+xxPsubb => {
+	template => $xxbinop,
+	emit     => "psubb %S1, %D0",
+	latency  => 1,
+},
+
+xxPsubw => {
+	template => $xxbinop,
+	emit     => "psubw %S1, %D0",
+	latency  => 1,
+},
+
+xxPsubd => {
+	template => $xxbinop,
+	emit     => "psubd %S1, %D0",
+	latency  => 1,
+},
+
+xxPsubq => {
+	template => $xxbinop,
+	emit     => "psubq %S1, %D0",
+	latency  => 1,
+},
+
+xxPand => {
+	template => $xxbinop,
+	emit     => "pand %S1, %D0",
+	latency  => 1,
+},
+
+xxPor => {
+	template => $xxbinop,
+	emit     => "por %S1, %D0",
+	latency  => 1,
+},
+
+xxPxor => {
+	template => $xxbinop,
+	emit     => "pxor %S1, %D0",
+	latency  => 1,
+},
+
+xxAddps => {
+	template => $xxbinop,
+	emit     => "addps %S1, %D0",
+	latency  => 4,
+},
+
+xxAddpd => {
+	template => $xxbinop,
+	emit     => "addpd %S1, %D0",
+	latency  => 4,
+},
+
+xxSubps => {
+	template => $xxbinop,
+	emit     => "subps %S1, %D0",
+	latency  => 4,
+},
+
+xxSubpd => {
+	template => $xxbinop,
+	emit     => "subpd %S1, %D0",
+	latency  => 4,
+},
+
+xxMulps => {
+	template => $xxbinop,
+	emit     => "mulps %S1, %D0",
+	latency  => 4,
+},
+
+xxMulpd => {
+	template => $xxbinop,
+	emit     => "mulpd %S1, %D0",
+	latency  => 4,
+},
+
 ); # end of %nodes
 
 # Transform some attributes
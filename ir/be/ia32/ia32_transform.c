@@ -1478,6 +1478,99 @@ static ir_node *gen_Ror(ir_node *node, ir_node *op1, ir_node *op2)
 	return gen_shift_binop(node, op1, op2, new_bd_ia32_Ror, match_immediate);
 }
 
+typedef ir_node *construct_vector_binop_func(dbg_info *db, ir_node *block,
+                                             ir_node *left, ir_node *right);
+
+/**
+ * Creates a packed SSE2 operation for a binop of a vector mode. The operands
+ * are always in registers as packed memory operands must be aligned.
+ */
+static ir_node *gen_vector_binop(ir_node *node)
+{
+	ir_mode *mode    = get_irn_mode(node);
+	ir_mode *element = get_mode_vector_element(mode);
+	unsigned bits    = get_mode_size_bits(element);
+	bool     is_int  = mode_is_int(element);
+
+	construct_vector_binop_func *func;
+	switch (get_irn_opcode(node)) {
+	case iro_Add:
+		func = !is_int   ? (bits == 32 ? new_bd_ia32_xxAddps : new_bd_ia32_xxAddpd)
+		     : bits ==  8 ? new_bd_ia32_xxPaddb
+		     : bits == 16 ? new_bd_ia32_xxPaddw
+		     : bits == 32 ? new_bd_ia32_xxPaddd
+		     :              new_bd_ia32_xxPaddq;
+		break;
+	case iro_Sub:
+		func = !is_int   ? (bits == 32 ? new_bd_ia32_xxSubps : new_bd_ia32_xxSubpd)
+		     : bits ==  8 ? new_bd_ia32_xxPsubb
+		     : bits == 16 ? new_bd_ia32_xxPsubw
+		     : bits == 32 ? new_bd_ia32_xxPsubd
+		     :              new_bd_ia32_xxPsubq;
+		break;
+	case iro_Mul:
+		if (is_int)
+			panic("packed integer multiplication not supported");
+		func = bits == 32 ? new_bd_ia32_xxMulps : new_bd_ia32_xxMulpd;
+		break;
+	case iro_And: func = new_bd_ia32_xxPand; break;
+	case iro_Or:  func = new_bd_ia32_xxPor;  break;
+	case iro_Eor: func = new_bd_ia32_xxPxor; break;
+	default:
+		panic("unexpected vector operation %+F", node);
+	}
+
+	dbg_info *dbgi      = get_irn_dbg_info(node);
+	ir_node  *new_block = be_transform_nodes_block(node);
+	ir_node  *new_left  = be_transform_node(get_binop_left(node));
+	ir_node  *new_right = be_transform_node(get_binop_right(node));
+	ir_node  *new_node  = func(dbgi, new_block, new_left, new_right);
+	set_irn_mode(new_node, mode);
+	SET_IA32_ORIG_NODE(new_node, node);
+	return new_node;
+}
+
+/**
+ * Transforms a Broadcast into a packed SSE2 shuffle.
+ */
+static ir_node *gen_Broadcast(ir_node *node)
+{
+	ir_mode  *mode      = get_irn_mode(node);
+	ir_mode  *element   = get_mode_vector_element(mode);
+	unsigned  bits      = get_mode_size_bits(element);
+	dbg_info *dbgi      = get_irn_dbg_info(node);
+	ir_node  *new_block = be_transform_nodes_block(node);
+	ir_node  *op        = get_Broadcast_op(node);
+
+	ir_node *new_node;
+	if (mode_is_float(element)) {
+		ir_node *new_op = be_transform_node(op);
+		new_node = bits == 32
+			? new_bd_ia32_xxBroadcastps(dbgi, new_block, new_op)
+			: new_bd_ia32_xxBroadcastpd(dbgi, new_block, new_op);
+	} else {
+		/* the upper bits are shuffled away */
+		op = be_skip_downconv(op, false);
+		ir_node *new_op = be_transform_node(op);
+		switch (bits) {
+		case 8:
+			new_node = new_bd_ia32_xxBroadcast8(dbgi, new_block, new_op);
+			break;
+		case 16:
+			new_node = new_bd_ia32_xxBroadcast16(dbgi, new_block, new_op);
+			break;
+		case 32:
+			new_node = new_bd_ia32_xxBroadcast32(dbgi, new_block, new_op);
+			break;
+		default:
+			panic("unexpected vector element mode %+F", element);
+		}
+	}
+	set_irn_mode(new_node, mode);
+	SET_IA32_ORIG_NODE(new_node, node);
+	return new_node;
+}
+
 /**
  * Creates an ia32 Add.
  *
@@ -1501,6 +1594,8 @@ static ir_node *gen_Add(ir_node *node)
 	if (new_node != NULL)
 		return new_node;
 
+	if (mode_is_vector(mode))
+		return gen_vector_binop(node);
 	if (mode_is_float(mode)) {
 		if (ia32_cg_config.use_sse2)
 			return gen_binop(node, op1, op2, new_bd_ia32_xAdd,
@@ -1579,6 +1674,8 @@ static ir_node *gen_Mul(ir_node *node)
 	ir_node *op2  = get_Mul_right(node);
 	ir_mode *mode = get_irn_mode(node);
 
+	if (mode_is_vector(mode))
+		return gen_vector_binop(node);
 	if (mode_is_float(mode)) {
 		if (ia32_cg_config.use_sse2)
 			return gen_binop(node, op1, op2, new_bd_ia32_xMul,
@@ -1638,6 +1735,8 @@ static ir_node *gen_And(ir_node *node)
 	ir_node *op1 = get_And_left(node);
 	ir_node *op2 = get_And_right(node);
 	assert(!mode_is_float(get_irn_mode(node)));
+	if (mode_is_vector(get_irn_mode(node)))
+		return gen_vector_binop(node);
 
 	/* is it a zero extension? */
 	if (is_Const(op2)) {
@@ -1662,6 +1761,9 @@ static ir_node *gen_And(ir_node *node)
 
 static ir_node *gen_Or(ir_node *node)
 {
+	if (mode_is_vector(get_irn_mode(node)))
+		return gen_vector_binop(node);
+
 	ir_node *rot_left;
 	ir_node *rot_right;
 	if (be_pattern_is_rotl(node, &rot_left, &rot_right)) {
@@ -1690,6 +1792,8 @@ static ir_node *gen_Or(ir_node *node)
 static ir_node *gen_Eor(ir_node *node)
 {
 	assert(!mode_is_float(get_irn_mode(node)));
+	if (mode_is_vector(get_irn_mode(node)))
+		return gen_vector_binop(node);
 	ir_node *op1 = get_Eor_left(node);
 	ir_node *op2 = get_Eor_right(node);
 	return gen_binop(node, op1, op2, new_bd_ia32_Xor, match_commutative
@@ -1707,6 +1811,8 @@ static ir_node *gen_Sub(ir_node *node)
 	ir_node *op2  = get_Sub_right(node);
 	ir_mode *mode = get_irn_mode(node);
 
+	if (mode_is_vector(mode))
+		return gen_vector_binop(node);
 	if (mode_is_float(mode)) {
 		if (ia32_cg_config.use_sse2)
 			return gen_binop(node, op1, op2, new_bd_ia32_xSub, match_am);
@@ -2261,7 +2367,9 @@ static ir_node *gen_Load(ir_node *node)
 	ir_node *idx  = addr.index;
 
 	ir_node *new_node;
-	if (mode_is_float(mode)) {
+	if (mode_is_vector(mode)) {
+		new_node = new_bd_ia32_xxLoad(dbgi, block, base, idx, new_mem);
+	} else if (mode_is_float(mode)) {
 		if (ia32_cg_config.use_sse2) {
 			new_node = new_bd_ia32_xLoad(dbgi, block, base, idx, new_mem,
 			                             mode);
@@ -2768,7 +2876,11 @@ static ir_node *create_store(dbg_info *dbgi, ir_node *new_block,
 {
 	ir_node *store;
 	ir_mode *mode = get_irn_mode(value);
-	if (mode_is_float(mode)) {
+	if (mode_is_vector(mode)) {
+		ir_node *new_val = be_transform_node(value);
+		store = new_bd_ia32_xxStore(dbgi, new_block, addr->base, addr->index,
+		                            addr->mem, new_val);
+	} else if (mode_is_float(mode)) {
 		if (ia32_cg_config.use_sse2) {
 			ir_node *new_val = be_transform_node(value);
 			store = new_bd_ia32_xStore(dbgi, new_block, addr->base, addr->index,
@@ -4330,6 +4442,12 @@ static ir_node *gen_Phi(ir_node *node)
 		assert(get_mode_size_bits(mode) <= 32);
 		/* all integer operations are on 32bit registers now */
 		req  = ia32_reg_classes[CLASS_ia32_gp].class_req;
+	} else if (mode_is_vector(mode)) {
+		/* keep the vector mode, so spills use the whole register */
+		req = ia32_reg_classes[CLASS_ia32_xmm].class_req;
+		ir_node *phi = be_transform_phi(node, req);
+		set_irn_mode(phi, mode);
+		return phi;
 	} else if (mode_is_float(mode)) {
 		if (ia32_cg_config.use_sse2) {
 			req  = ia32_reg_classes[CLASS_ia32_xmm].class_req;
@@ -4660,6 +4778,20 @@ static ir_node *gen_Proj_Load(ir_node *node)
 		case pn_Load_X_regular:
 			return new_rd_Proj(dbgi, new_pred, mode_X, pn_ia32_xLoad_X_regular);
 		}
+	} else if (is_ia32_xxLoad(new_pred)) {
+		switch ((pn_Load)pn) {
+		case pn_Load_res:
+			return new_rd_Proj(dbgi, new_pred, get_Load_mode(pred),
+			                   pn_ia32_xxLoad_res);
+		case pn_Load_M:
+			return new_rd_Proj(dbgi, new_pred, mode_M, pn_ia32_xxLoad_M);
+		case pn_Load_X_except:
+			/* This Load might raise an exception. Mark it. */
+			set_ia32_exc_label(new_pred, 1);
+			return new_rd_Proj(dbgi, new_pred, mode_X, pn_ia32_xxLoad_X_except);
+		case pn_Load_X_regular:
+			return new_rd_Proj(dbgi, new_pred, mode_X, pn_ia32_xxLoad_X_regular);
+		}
 	} else if (is_ia32_fld(new_pred)) {
 		switch ((pn_Load)pn) {
 		case pn_Load_res:
@@ -4726,6 +4858,15 @@ static ir_node *create_proj_for_store(ir_node *store, pn_Store pn)
 		case pn_Store_X_regular:
 			return new_r_Proj(store, mode_X, pn_ia32_fst_X_regular);
 		}
+	} else if (is_ia32_xxStore(store)) {
+		switch ((pn_Store)pn) {
+		case pn_Store_M:
+			return new_r_Proj(store, mode_M, pn_ia32_xxStore_M);
+		case pn_Store_X_except:
+			return new_r_Proj(store, mode_X, pn_ia32_xxStore_X_except);
+		case pn_Store_X_regular:
+			return new_r_Proj(store, mode_X, pn_ia32_xxStore_X_regular);
+		}
 	} else if (is_ia32_xStore(store)) {
 		switch ((pn_Store)pn) {
 		case pn_Store_M:
@@ -5652,6 +5793,7 @@ static void register_transformers(void)
 	be_set_transform_function(op_And,              gen_And);
 	be_set_transform_function(op_ASM,              gen_ASM);
 	be_set_transform_function(op_Bitcast,          gen_Bitcast);
+	be_set_transform_function(op_Broadcast,        gen_Broadcast);
 	be_set_transform_function(op_Builtin,          gen_Builtin);
 	be_set_transform_function(op_Call,             gen_Call);
 	be_set_transform_function(op_Cmp,              gen_Cmp);
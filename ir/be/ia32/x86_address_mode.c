@@ -20,9 +20,23 @@
 #include "irprintf.h"
 #include "iredges_t.h"
 #include "irgwalk.h"
+#include "irtools.h"
 
 #include "benode.h"
 #include "belive.h"
+#include "bemodule.h"
+
+#include "array.h"
+#include "lc_opts.h"
+#include "lc_opts_enum.h"
+
+/** How shared address computations are distributed to the address modes. */
+typedef enum am_selection_t {
+	AM_SELECT_HEURISTIC, /**< decide by the liveness of the operands only */
+	AM_SELECT_TILE,      /**< also consider the register uses of the DAG */
+} am_selection_t;
+
+static int am_selection = AM_SELECT_TILE;
 
 static bitset_t *non_address_mode_nodes;
 
@@ -349,13 +363,18 @@ static bool value_last_used_here(be_lv_t *lv, ir_node *here, ir_node *value)
 	return true;
 }
 
+typedef struct mark_env_t {
+	be_lv_t  *lv;
+	ir_node **shared; /**< shared Adds left to select_shared_address_modes() */
+} mark_env_t;
+
 /**
  * Walker: mark those nodes that cannot be part of an address mode because
  * their value must be accessed through a register
  */
-static void mark_non_address_nodes(ir_node *node, void *env)
+static void mark_non_address_nodes(ir_node *node, void *data)
 {
-	be_lv_t *lv = (be_lv_t*)env;
+	mark_env_t *env = (mark_env_t*)data;
 
 	ir_mode *mode = get_irn_mode(node);
 	if (!mode_is_int(mode) && !mode_is_reference(mode) && mode != mode_b)
@@ -400,8 +419,10 @@ static void mark_non_address_nodes(ir_node *node, void *env)
 		 * an addition and has the same register pressure for the case that only
 		 * one operand dies, but is faster (on Pentium 4).
 		 * && instead of || only folds AM if both operands do not die here */
-		if (!value_last_used_here(lv, node, left)
-		 || !value_last_used_here(lv, node, right)) {
+		if (!value_last_used_here(env->lv, node, left)
+		 || !value_last_used_here(env->lv, node, right)) {
+			if (env->shared != NULL)
+				ARR_APP1(ir_node*, env->shared, node);
 			return;
 		}
 
@@ -420,17 +441,161 @@ static void mark_non_address_nodes(ir_node *node, void *env)
 	}
 }
 
+typedef struct tile_env_t {
+	bitset_t *in_reg;   /**< values the selected code computes in a register */
+	ir_node **worklist;
+} tile_env_t;
+
+static void need_register(tile_env_t *env, ir_node *node)
+{
+	if (node == NULL || bitset_is_set(env->in_reg, get_irn_idx(node)))
+		return;
+	bitset_set(env->in_reg, get_irn_idx(node));
+	ARR_APP1(ir_node*, env->worklist, node);
+}
+
+/**
+ * Match an address mode for @p node like the instruction selection does and
+ * note the registers it uses.
+ */
+static void need_address(tile_env_t *env, ir_node *node,
+                         x86_create_am_flags_t flags)
+{
+	x86_address_t addr;
+	memset(&addr, 0, sizeof(addr));
+	x86_create_address_mode(&addr, node, flags);
+	if ((flags & x86_create_am_force)
+	    && (addr.base == node || addr.index == node)) {
+		/* nothing folded, the node is computed by an instruction of its own */
+		foreach_irn_in(node, i, in) {
+			need_register(env, in);
+		}
+		return;
+	}
+	need_register(env, addr.base);
+	need_register(env, addr.index);
+}
+
+/**
+ * Walker: collect the values used in registers by the address modes of
+ * memory accesses and by all other users.
+ */
+static void collect_register_values(ir_node *node, void *data)
+{
+	tile_env_t *env = (tile_env_t*)data;
+	if (x86_is_non_address_mode_node(node))
+		need_register(env, node);
+
+	switch (get_irn_opcode(node)) {
+	case iro_Load:
+		need_address(env, get_Load_ptr(node), x86_create_am_normal);
+		break;
+
+	case iro_Store:
+		need_address(env, get_Store_ptr(node), x86_create_am_normal);
+		need_register(env, get_Store_value(node));
+		break;
+
+	case iro_Add:
+	case iro_Shl:
+		/* operands are only needed if the node itself is */
+		break;
+
+	default:
+		foreach_irn_in(node, i, in) {
+			need_register(env, in);
+		}
+		break;
+	}
+}
+
+/**
+ * Decide for Adds with several users, which the liveness heuristic would fold
+ * into all of them, whether they are computed once instead.
+ *
+ * The address DAGs are covered with the address mode patterns the way the
+ * instruction selection will cover them. An Add that is needed in a register
+ * by any of its users costs an instruction anyway. Folding it into the other
+ * users on top only duplicates the arithmetic and keeps its operands alive,
+ * so it is marked as non address mode node. Marking changes the cover of the
+ * operands, so this is repeated until no more Adds are marked.
+ */
+static void select_shared_address_modes(ir_graph *irg, ir_node **shared)
+{
+	tile_env_t env;
+	env.in_reg   = bitset_malloc(get_irg_last_idx(irg));
+	env.worklist = NEW_ARR_F(ir_node*, 0);
+
+	bool changed;
+	do {
+		bitset_clear_all(env.in_reg);
+		irg_walk_graph(irg, NULL, collect_register_values, &env);
+		while (ARR_LEN(env.worklist) > 0) {
+			size_t   const n    = ARR_LEN(env.worklist) - 1;
+			ir_node *const node = env.worklist[n];
+			ARR_SHRINKLEN(env.worklist, n);
+
+			/* computed by a Lea (or a shift) covering part of the DAG */
+			ir_mode *const mode = get_irn_mode(node);
+			if ((is_Add(node) || is_Shl(node))
+			    && (mode_is_int(mode) || mode_is_reference(mode)))
+				need_address(&env, node, x86_create_am_force);
+		}
+
+		changed = false;
+		for (size_t i = 0, n = ARR_LEN(shared); i < n; ++i) {
+			ir_node *const node = shared[i];
+			if (!x86_is_non_address_mode_node(node)
+			    && bitset_is_set(env.in_reg, get_irn_idx(node))) {
+				x86_mark_non_am(node);
+				changed = true;
+			}
+		}
+	} while (changed);
+
+	DEL_ARR_F(env.worklist);
+	free(env.in_reg);
+}
+
 void x86_calculate_non_address_mode_nodes(ir_graph *irg)
 {
 	be_assure_live_chk(irg);
-	be_lv_t *lv = be_get_irg_liveness(irg);
 
 	non_address_mode_nodes = bitset_malloc(get_irg_last_idx(irg));
 
-	irg_walk_graph(irg, NULL, mark_non_address_nodes, lv);
+	mark_env_t env;
+	env.lv     = be_get_irg_liveness(irg);
+	env.shared = am_selection == AM_SELECT_TILE ? NEW_ARR_F(ir_node*, 0)
+	                                            : NULL;
+	irg_walk_graph(irg, NULL, mark_non_address_nodes, &env);
+
+	if (env.shared != NULL) {
+		select_shared_address_modes(irg, env.shared);
+		DEL_ARR_F(env.shared);
+	}
 }
 
 void x86_free_non_address_mode_nodes(void)
 {
 	free(non_address_mode_nodes);
 }
+
+BE_REGISTER_MODULE_CONSTRUCTOR(be_init_x86_address_mode)
+void be_init_x86_address_mode(void)
+{
+	static const lc_opt_enum_int_items_t am_selection_items[] = {
+		{ "heuristic", AM_SELECT_HEURISTIC },
+		{ "tile",      AM_SELECT_TILE },
+		{ NULL,        0 }
+	};
+	static lc_opt_enum_int_var_t am_selection_var = {
+		&am_selection, am_selection_items
+	};
+	static const lc_opt_table_entry_t x86_options[] = {
+		LC_OPT_ENT_ENUM_INT("addrmode", "selection of shared address computations", &am_selection_var),
+		LC_OPT_LAST
+	};
+	lc_opt_entry_t *be_grp  = lc_opt_get_grp(firm_opt_get_root(), "be");
+	lc_opt_entry_t *x86_grp = lc_opt_get_grp(be_grp, "x86");
+	lc_opt_add_table(x86_grp, x86_options);
+}
@@ -73,6 +73,7 @@ void ir_init(void)
 	init_irprog_2();
 	firm_init_memory_disambiguator();
 	firm_init_loop_opt();
+	firm_init_vectorize();
 
 	arch_dep_set_opts(arch_dep_none);
 
@@ -91,6 +92,7 @@ void ir_finish(void)
 #endif
 	exit_execfreq();
 	firm_be_finish();
+	ir_pass_timing_reset();
 
 	free_ir_prog();
 	firm_finish_op();
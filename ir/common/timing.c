@@ -7,10 +7,17 @@
  * @file
  * @brief   platform neutral timing utilities
  */
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 
-#include "timing.h"
+#include "timing_t.h"
+#include "typerep.h"
+#include "ident.h"
+#include "irgraph.h"
+#include "obstack.h"
+#include "obstack_stat.h"
+#include "statev_t.h"
 #include "xmalloc.h"
 #include "panic.h"
 
@@ -415,3 +422,176 @@ double ir_timer_elapsed_sec(const ir_timer_t *timer)
 	}
 	return _time_to_sec(elapsed);
 }
+
+typedef struct pass_timing_t pass_timing_t;
+
+/**
+ * A pass in the pass profile. There is one per call path, all invocations of
+ * the pass on the same path are summed up.
+ */
+struct pass_timing_t {
+	const char         *name;        /**< name of the pass */
+	ident              *graph;       /**< ld name of the graph, NULL if none */
+	pass_timing_t      *parent;      /**< the invoking pass */
+	pass_timing_t      *first;       /**< first pass invoked by this pass */
+	pass_timing_t      *next;        /**< next pass invoked by the parent */
+	ir_timer_t          timer;       /**< time of all invocations */
+	unsigned long long  bytes;       /**< obstack bytes of all invocations */
+	unsigned long long  start_bytes; /**< obstack bytes at the current start */
+};
+
+bool                  pass_timing_enabled;
+static pass_timing_t  pass_timing_root;
+static pass_timing_t *pass_timing_current = &pass_timing_root;
+
+void ir_pass_timing_enable(int enable)
+{
+	pass_timing_enabled = enable;
+	pass_timing_current = &pass_timing_root;
+}
+
+static pass_timing_t *get_pass_timing(pass_timing_t *parent, const char *name,
+                                      ident *graph)
+{
+	pass_timing_t **anchor = &parent->first;
+	for (pass_timing_t *pass; (pass = *anchor) != NULL; anchor = &pass->next) {
+		if (pass->graph == graph && strcmp(pass->name, name) == 0)
+			return pass;
+	}
+
+	pass_timing_t *pass = XMALLOCZ(pass_timing_t);
+	pass->name   = name;
+	pass->graph  = graph;
+	pass->parent = parent;
+	*anchor      = pass;
+	return pass;
+}
+
+void ir_pass_timing_push(const char *name, ir_graph *irg)
+{
+	if (!pass_timing_enabled)
+		return;
+
+	pass_timing_t *parent = pass_timing_current;
+	ident         *graph  = irg != NULL
+		? get_entity_ld_ident(get_irg_entity(irg)) : parent->graph;
+	pass_timing_t *pass   = get_pass_timing(parent, name, graph);
+	pass_timing_current = pass;
+	if (stat_ev_enabled) {
+		if (graph != parent->graph)
+			stat_ev_ctx_push_str("pass_irg", get_id_str(graph));
+		stat_ev_ctx_push_str("pass", name);
+	}
+	pass->start_bytes = obstack_chunk_bytes;
+	_time_get(&pass->timer.start);
+}
+
+void ir_pass_timing_pop(void)
+{
+	if (!pass_timing_enabled)
+		return;
+
+	ir_timer_val_t now;
+	_time_get(&now);
+	pass_timing_t *pass = pass_timing_current;
+	if (pass == &pass_timing_root)
+		panic("pass timing push/pop mismatch");
+
+	ir_timer_val_t elapsed;
+	_time_sub(&elapsed, &now, &pass->timer.start);
+	_time_add(&pass->timer.elapsed, &pass->timer.elapsed, &elapsed);
+	unsigned long long const bytes = obstack_chunk_bytes - pass->start_bytes;
+	pass->bytes += bytes;
+	pass_timing_current = pass->parent;
+	if (stat_ev_enabled) {
+		stat_ev_ull("pass_time", _time_to_usec(&elapsed));
+		stat_ev_ull("pass_obstack_bytes", bytes);
+		stat_ev_ctx_pop("pass");
+		if (pass->graph != pass->parent->graph)
+			stat_ev_ctx_pop("pass_irg");
+	}
+}
+
+static void free_pass_timings(pass_timing_t *pass)
+{
+	for (pass_timing_t *child = pass->first, *next; child != NULL;
+	     child = next) {
+		next = child->next;
+		free_pass_timings(child);
+		free(child);
+	}
+	pass->first = NULL;
+}
+
+void ir_pass_timing_reset(void)
+{
+	free_pass_timings(&pass_timing_root);
+	pass_timing_current = &pass_timing_root;
+}
+
+static unsigned long long get_pass_value(pass_timing_t const *pass,
+                                         bool memory)
+{
+	return memory ? pass->bytes : _time_to_usec(&pass->timer.elapsed);
+}
+
+static void dump_pass_path(FILE *out, pass_timing_t const *pass)
+{
+	pass_timing_t const *parent = pass->parent;
+	if (parent != &pass_timing_root) {
+		dump_pass_path(out, parent);
+		fputc(';', out);
+	}
+	if (pass->graph != parent->graph)
+		fprintf(out, "%s;", get_id_str(pass->graph));
+	fputs(pass->name, out);
+}
+
+static void dump_pass_timings(FILE *out, pass_timing_t const *pass,
+                              bool memory)
+{
+	/* the value of a path is what the pass spent itself, its children have
+	 * their own paths */
+	unsigned long long self     = get_pass_value(pass, memory);
+	unsigned long long children = 0;
+	for (pass_timing_t const *child = pass->first; child != NULL;
+	     child = child->next) {
+		children += get_pass_value(child, memory);
+	}
+	if (self > children) {
+		dump_pass_path(out, pass);
+		fprintf(out, " %llu\n", self - children);
+	}
+	for (pass_timing_t const *child = pass->first; child != NULL;
+	     child = child->next) {
+		dump_pass_timings(out, child, memory);
+	}
+}
+
+void ir_pass_timing_dump(FILE *out, int memory)
+{
+	for (pass_timing_t const *pass = pass_timing_root.first; pass != NULL;
+	     pass = pass->next) {
+		dump_pass_timings(out, pass, memory);
+	}
+}
+
+unsigned long long ir_obstack_bytes_total(void)
+{
+	return obstack_chunk_bytes;
+}
+
+unsigned long long ir_obstack_bytes_live(void)
+{
+	return obstack_chunk_bytes_live;
+}
+
+unsigned long long ir_obstack_bytes_peak(void)
+{
+	return obstack_chunk_bytes_peak;
+}
+
+void ir_obstack_reset_peak(void)
+{
+	obstack_chunk_bytes_peak = obstack_chunk_bytes_live;
+}
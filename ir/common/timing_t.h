@@ -0,0 +1,46 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Internal interface of the pass profile.
+ */
+#ifndef FIRM_COMMON_TIMING_T_H
+#define FIRM_COMMON_TIMING_T_H
+
+#include <stdbool.h>
+
+#include "timing.h"
+
+/** Whether the pass profile is recorded, see ir_pass_timing_enable(). */
+extern bool pass_timing_enabled;
+
+static inline int ir_pass_timing_begin(const char *name, ir_graph *irg)
+{
+	ir_pass_timing_push(name, irg);
+	return 0;
+}
+
+static inline void ir_pass_timing_end(int *scope)
+{
+	(void)scope;
+	ir_pass_timing_pop();
+}
+
+#ifdef __GNUC__
+/**
+ * Records the enclosing function in the pass profile as the pass @p name on
+ * @p irg, or on the whole program if @p irg is NULL. Put it at the entry of
+ * a pass, the recording ends when the function returns.
+ */
+#define IR_PASS_TIMING(name, irg) \
+	int ir_pass_timing_scope_ __attribute__((cleanup(ir_pass_timing_end))) \
+		= ir_pass_timing_begin((name), (irg))
+#else
+/* the pass profile needs the cleanup attribute */
+#define IR_PASS_TIMING(name, irg) ((void)(name), (void)(irg))
+#endif
+
+#endif
@@ -14,25 +14,55 @@
 #include "hashptr.h"
 #include "ident_t.h"
 #include "obst.h"
-#include "set.h"
 
-static set *id_set;
+/** Key of the identifier table, the string is not zero terminated. */
+typedef struct ident_key_t {
+	const char *str;
+	size_t      len;
+} ident_key_t;
+
+/** The strings of all identifiers. */
+static struct obstack id_strings;
+
+static char *copy_ident_str(ident_key_t key)
+{
+	return (char*)obstack_copy0(&id_strings, key.str, key.len);
+}
+
+#define HashSet                   ident_set_t
+#define HashSetEntry              ident_set_entry_t
+#define ValueType                 ident_key_t
+#define KeyType                   ident_key_t
+#define ConstKeyType              const ident_key_t
+#define GetKey(value)             (value)
+#define InitData(self,value,key)  ((value).str = copy_ident_str(key), (value).len = (key).len)
+#define Hash(self,key)            hash_data((const unsigned char*)(key).str, (key).len)
+#define KeysEqual(self,key1,key2) ((key1).len == (key2).len && memcmp((key1).str, (key2).str, (key1).len) == 0)
+#define HashSetScope              static
+#define hashset_init_size         ident_set_init_size
+#define hashset_destroy           ident_set_destroy
+#define hashset_insert            ident_set_insert
+
+typedef struct ident_set_t ident_set_t;
+#include "swisstable.h"
+#include "swisstable.c.inl"
+
+static ident_set_t id_set;
 
 /** An obstack used for temporary space */
 static struct obstack id_obst;
 
 void init_ident(void)
 {
-	/* it's ok to use memcmp here, we check only strings */
-	id_set = new_set(memcmp, 128);
+	ident_set_init_size(&id_set, 128);
+	obstack_init(&id_strings);
 	obstack_init(&id_obst);
 }
 
 ident *new_id_from_chars(const char *str, size_t len)
 {
-	unsigned   hash   = hash_data((const unsigned char*)str, len);
-	set_entry *result = set_hinsert0(id_set, str, len, hash);
-	return (ident*)result->dptr;
+	ident_key_t key = { str, len };
+	return (ident*)ident_set_insert(&id_set, key)->str;
 }
 
 ident *new_id_from_str(const char *str)
@@ -66,8 +96,8 @@ const char *(get_id_str)(ident *id)
 void finish_ident(void)
 {
 	obstack_free(&id_obst, NULL);
-	del_set(id_set);
-	id_set = NULL;
+	ident_set_destroy(&id_set);
+	obstack_free(&id_strings, NULL);
 }
 
 ident *id_unique(const char *tag)
@@ -1380,6 +1380,8 @@ static void dump_graph_info(FILE *F, ir_graph *irg)
 		fprintf(F, " consistent_entity_usage");
 	if (irg_has_properties(irg, IR_GRAPH_PROPERTY_MANY_RETURNS))
 		fprintf(F, " many_returns");
+	if (irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_ALIAS_CACHE))
+		fprintf(F, " consistent_alias_cache");
 	fprintf(F, "\"\n");
 }
 
@@ -8,6 +8,7 @@
  * @brief    Support for ir graph modification.
  * @author   Martin Trapp, Christian Schaefer, Goetz Lindenmaier
  */
+#include "irdom_t.h"
 #include "irflag_t.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
@@ -271,6 +272,8 @@ void part_block(ir_node *node)
 	if (old_block == get_irg_start_block(irg))
 		update_startblock(old_block, new_block);
 
+	dom_split_block(new_block, old_block);
+
 	set_optimize(rem_opt);
 }
 
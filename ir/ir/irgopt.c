@@ -10,9 +10,11 @@
  *           Michael Beck
  */
 #include <assert.h>
+#include <string.h>
 
 #include "irnode_t.h"
 #include "irgraph_t.h"
+#include "timing_t.h"
 
 #include "constbits.h"
 #include "iroptimize.h"
@@ -22,11 +24,15 @@
 #include "irgwalk.h"
 #include "ircons.h"
 
-#include "adt/pdeq.h"
+#include "array.h"
+#include "raw_bitset.h"
+#include "statev_t.h"
 
+#include "irdom_t.h"
 #include "irflag_t.h"
 #include "iredges_t.h"
 #include "irtools.h"
+#include "irhooks.h"
 
 /**
  * A wrapper around optimize_inplace_2() to be called from a walker.
@@ -57,24 +63,118 @@ void local_optimize_node(ir_node *n)
 	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
 }
 
-static void enqueue_node(ir_node *node, pdeq *waitq)
+/**
+ * The nodes optimize_graph_df() still has to visit. The nodes are numbered
+ * in topological order (operands before users, as a post order walk visits
+ * them) and the worklist is swept in that order, nodes which appear earlier
+ * than the current position are picked up by the next sweep. Nodes created
+ * during the optimization are numbered behind all existing ones.
+ */
+typedef struct opt_worklist_t {
+	ir_node  **nodes;         /**< the nodes by their number */
+	unsigned  *numbers;       /**< 1 + number of each node by index, 0 if the
+	                               node has no number yet */
+	unsigned  *pending;       /**< raw bitset of the numbers to visit */
+	size_t     pending_size;  /**< number of bits in pending */
+	size_t     n_pending;
+	size_t     cursor;        /**< number where the sweep continues */
+	unsigned long long n_visited;
+	unsigned long long n_transformed;
+	ir_graph          *irg;
+} opt_worklist_t;
+
+static hook_entry_t worklist_hook;
+
+static unsigned get_worklist_number(opt_worklist_t *worklist, ir_node *node)
+{
+	unsigned idx   = get_irn_idx(node);
+	size_t   n_idx = ARR_LEN(worklist->numbers);
+	if (idx >= n_idx) {
+		ARR_RESIZE(unsigned, worklist->numbers, idx + 1 + idx / 4);
+		memset(&worklist->numbers[n_idx], 0,
+		       (ARR_LEN(worklist->numbers) - n_idx) * sizeof(unsigned));
+	}
+	if (worklist->numbers[idx] != 0)
+		return worklist->numbers[idx] - 1;
+
+	unsigned number = ARR_LEN(worklist->nodes);
+	ARR_APP1(ir_node*, worklist->nodes, node);
+	worklist->numbers[idx] = number + 1;
+	if (number >= worklist->pending_size) {
+		size_t    new_size = 2 * worklist->pending_size;
+		unsigned *pending  = rbitset_malloc(new_size);
+		rbitset_copy(pending, worklist->pending, worklist->pending_size);
+		free(worklist->pending);
+		worklist->pending      = pending;
+		worklist->pending_size = new_size;
+	}
+	return number;
+}
+
+static void enqueue_node(ir_node *node, opt_worklist_t *worklist)
 {
-	if (get_irn_link(node) == waitq)
+	unsigned number = get_worklist_number(worklist, node);
+	if (rbitset_is_set(worklist->pending, number))
 		return;
-	pdeq_putr(waitq, node);
-	set_irn_link(node, waitq);
+	rbitset_set(worklist->pending, number);
+	++worklist->n_pending;
+}
+
+/** Returns the next node to visit, the worklist must not be empty. */
+static ir_node *dequeue_node(opt_worklist_t *worklist)
+{
+	assert(worklist->n_pending > 0);
+	size_t number = rbitset_next_max(worklist->pending, worklist->cursor,
+	                                 ARR_LEN(worklist->nodes), true);
+	if (number == (size_t)-1) {
+		/* start the next sweep */
+		number = rbitset_next_max(worklist->pending, 0,
+		                          ARR_LEN(worklist->nodes), true);
+	}
+	rbitset_clear(worklist->pending, number);
+	--worklist->n_pending;
+	worklist->cursor = number + 1;
+	return worklist->nodes[number];
+}
+
+static void init_worklist_walker(ir_node *node, void *env)
+{
+	enqueue_node(node, (opt_worklist_t*)env);
+}
+
+static void init_worklist(opt_worklist_t *worklist, ir_graph *irg)
+{
+	size_t n_nodes = get_irg_last_idx(irg);
+	worklist->nodes         = NEW_ARR_F(ir_node*, 0);
+	worklist->numbers       = NEW_ARR_FZ(unsigned, n_nodes);
+	worklist->pending_size  = n_nodes > 64 ? n_nodes : 64;
+	worklist->pending       = rbitset_malloc(worklist->pending_size);
+	worklist->n_pending     = 0;
+	worklist->cursor        = 0;
+	worklist->n_visited     = 0;
+	worklist->n_transformed = 0;
+	worklist->irg           = irg;
+
+	irg_walk_graph(irg, NULL, init_worklist_walker, worklist);
+}
+
+static void free_worklist(opt_worklist_t *worklist)
+{
+	DEL_ARR_F(worklist->nodes);
+	DEL_ARR_F(worklist->numbers);
+	free(worklist->pending);
 }
 
 /**
  * Enqueue all users of a node to a wait queue.
  * Handles mode_T nodes.
  */
-static void enqueue_users(ir_node *n, pdeq *waitq)
+static void enqueue_users(ir_node *n, opt_worklist_t *worklist)
 {
 	foreach_out_edge(n, edge) {
 		ir_node *succ  = get_edge_src_irn(edge);
 
-		enqueue_node(succ, waitq);
+		enqueue_node(succ, worklist);
 
 		/* Also enqueue Phis to prevent inconsistencies. */
 		if (is_Block(succ)) {
@@ -82,55 +182,89 @@ static void enqueue_users(ir_node *n, pdeq *waitq)
 				ir_node *succ2 = get_edge_src_irn(edge2);
 
 				if (is_Phi(succ2)) {
-					enqueue_node(succ2, waitq);
+					enqueue_node(succ2, worklist);
 				}
 			}
 		} else if (get_irn_mode(succ) == mode_T) {
 		/* A mode_T node has Proj's. Because most optimizations
 			run on the Proj's we have to enqueue them also. */
-			enqueue_users(succ, waitq);
+			enqueue_users(succ, worklist);
 		}
 	}
 }
 
 /**
- * Block-Walker: uses dominance depth to mark dead blocks.
+ * Called for the blocks the dominance updates find unreachable: enqueues the
+ * nodes which have to remove their references to the block.
  */
-static void find_unreachable_blocks(ir_node *block, void *env)
+static void enqueue_unreachable_block_users(ir_node *block, void *env)
 {
-	pdeq *waitq = (pdeq*) env;
-
-	if (get_Block_dom_depth(block) < 0) {
-		ir_graph *irg = get_irn_irg(block);
-		ir_node  *end = get_irg_end(irg);
-
-		foreach_block_succ(block, edge) {
-			ir_node *succ_block = get_edge_src_irn(edge);
-			enqueue_node(succ_block, waitq);
-			foreach_out_edge(succ_block, edge2) {
-				ir_node *succ = get_edge_src_irn(edge2);
-				if (is_Phi(succ))
-					enqueue_node(succ, waitq);
-			}
+	opt_worklist_t *worklist = (opt_worklist_t*)env;
+	ir_graph       *irg      = get_irn_irg(block);
+	ir_node        *end      = get_irg_end(irg);
+
+	foreach_block_succ(block, edge) {
+		ir_node *succ_block = get_edge_src_irn(edge);
+		enqueue_node(succ_block, worklist);
+		foreach_out_edge(succ_block, edge2) {
+			ir_node *succ = get_edge_src_irn(edge2);
+			if (is_Phi(succ))
+				enqueue_node(succ, worklist);
 		}
-		enqueue_node(end, waitq);
+	}
+	enqueue_node(end, worklist);
+}
+
+/**
+ * Called for the blocks whose predecessors or dominators changed: their Phis
+ * may remove operands or select a single value now.
+ */
+static void enqueue_changed_block_phis(ir_node *block, void *env)
+{
+	opt_worklist_t *worklist = (opt_worklist_t*)env;
+	enqueue_node(block, worklist);
+	foreach_out_edge(block, edge) {
+		ir_node *succ = get_edge_src_irn(edge);
+		if (is_Phi(succ))
+			enqueue_node(succ, worklist);
 	}
 }
 
 void local_optimize_graph(ir_graph *irg)
 {
+	IR_PASS_TIMING("local_optimize_graph", irg);
 	local_optimize_node(get_irg_end(irg));
 }
 
 /**
- * Data flow optimization walker.
- * Optimizes all nodes and enqueue its users
- * if done.
+ * Hook: a node whose inputs are changed in place has to be visited again, as
+ * do its users, whose patterns may look through it.
  */
-static void opt_walker(ir_node *n, void *env)
+static void enqueue_changed_node(void *ctx, ir_node *src, int pos,
+                                 ir_node *tgt, ir_node *old_tgt)
 {
-	pdeq *waitq = (pdeq *)env;
-	set_irn_link(n, NULL);
+	(void)pos;
+	opt_worklist_t *worklist = (opt_worklist_t*)ctx;
+	if (tgt == old_tgt || get_irn_irg(src) != worklist->irg)
+		return;
+
+	enqueue_node(src, worklist);
+	if (!is_Block(src)) {
+		foreach_out_edge(src, edge) {
+			enqueue_node(get_edge_src_irn(edge), worklist);
+		}
+	}
+}
+
+/**
+ * Optimizes a node of the worklist and enqueues its users if it changed.
+ */
+static void optimize_worklist_node(ir_node *n, opt_worklist_t *worklist)
+{
+	/* the node has been replaced after it was enqueued */
+	if (is_Deleted(n))
+		return;
+	++worklist->n_visited;
 
 	/* If CSE occurs during the optimization,
 	 * our operands have fewer users than before.
@@ -144,15 +278,19 @@ static void opt_walker(ir_node *n, void *env)
 		optimized = optimize_in_place_2(last);
 
 		if (optimized != last) {
-			enqueue_users(last, waitq);
+			++worklist->n_transformed;
+			enqueue_users(last, worklist);
 			exchange(last, optimized);
 		}
 	} while (optimized != last);
+
+	/* keep the dominance information used by the optimizations up to date */
+	dom_apply_tracked_changes(false);
 }
 
 void optimize_graph_df(ir_graph *irg)
 {
-	pdeq *waitq = new_pdeq();
+	IR_PASS_TIMING("optimize_graph_df", irg);
 
 	if (get_opt_global_cse())
 		set_irg_pinned(irg, op_pin_state_floats);
@@ -170,28 +308,37 @@ void optimize_graph_df(ir_graph *irg)
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
 	                         | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 
-	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
-
 	constbits_analyze(irg);
 
-	irg_walk_graph(irg, NULL, opt_walker, waitq);
-
-	/* any optimized nodes are stored in the wait queue,
-	 * so if it's not empty, the graph has been changed */
-	while (!pdeq_empty(waitq)) {
-		/* finish the wait queue */
-		while (! pdeq_empty(waitq)) {
-			ir_node *n = (ir_node*)pdeq_getl(waitq);
-			opt_walker(n, waitq);
+	opt_worklist_t worklist;
+	init_worklist(&worklist, irg);
+	dom_begin_tracking(irg, enqueue_unreachable_block_users,
+	                   enqueue_changed_block_phis, &worklist);
+	worklist_hook.context = &worklist;
+	worklist_hook.hook._hook_set_irn_n = enqueue_changed_node;
+	register_hook(hook_set_irn_n, &worklist_hook);
+
+	for (;;) {
+		while (worklist.n_pending > 0) {
+			ir_node *n = dequeue_node(&worklist);
+			optimize_worklist_node(n, &worklist);
 		}
-		/* Calculate dominance so we can kill unreachable code
-		 * We want this intertwined with localopts for better optimization
-		 * (phase coupling) */
-		compute_doms(irg);
-		irg_block_walk_graph(irg, NULL, find_unreachable_blocks, waitq);
+		/* Bring the dominance information up to date so we can kill
+		 * unreachable code. Control flow changes are usually applied
+		 * incrementally, only the changes which could not be are recomputed
+		 * here. Blocks which became unreachable enqueue their users. We want
+		 * this intertwined with localopts for better optimization (phase
+		 * coupling) */
+		dom_apply_tracked_changes(true);
+		if (worklist.n_pending == 0)
+			break;
 	}
-	del_pdeq(waitq);
-	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+	dom_end_tracking();
+	unregister_hook(hook_set_irn_n, &worklist_hook);
+
+	stat_ev_ull("opt_df_nodes_visited", worklist.n_visited);
+	stat_ev_ull("opt_df_transformations", worklist.n_transformed);
+	free_worklist(&worklist);
 
 	constbits_clear(irg);
 
@@ -213,6 +360,8 @@ void optimize_graph_df(ir_graph *irg)
 
 void local_opts_const_code(void)
 {
+	IR_PASS_TIMING("local_opts_const_code", NULL);
+
 	ir_graph *irg = get_const_code_irg();
 	/* Clean the value_table in irg for the CSE. */
 	new_identities(irg);
@@ -27,6 +27,7 @@
 #include "iredges_t.h"
 #include "type_t.h"
 #include "irmemory.h"
+#include "irmemory_t.h"
 #include "iroptimize.h"
 #include "irgopt.h"
 
@@ -262,6 +263,8 @@ void free_ir_graph(ir_graph *irg)
 
 	hook_free_graph(irg);
 	free_irg_outs(irg);
+	free_irg_points_to(irg);
+	free_irg_alias_cache(irg);
 	del_identities(irg);
 	if (irg->ent) {
 		set_entity_irg(irg->ent, NULL);  /* not set in const code irg */
@@ -603,4 +606,6 @@ void confirm_irg_properties(ir_graph *irg, ir_graph_properties_t props)
 		set_irp_globals_entity_usage_state(ir_entity_usage_not_computed);
 	if (!(props & IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE_FRONTIERS))
 		ir_free_dominance_frontiers(irg);
+	if (!(props & IR_GRAPH_PROPERTY_CONSISTENT_ALIAS_CACHE))
+		free_irg_alias_cache(irg);
 }
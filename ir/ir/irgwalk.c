@@ -25,28 +25,95 @@
 #include "panic.h"
 #include "pset_new.h"
 #include "array.h"
+#include "xmalloc.h"
+
+/** Walker state of a node whose predecessors are being visited. */
+typedef struct walk_frame {
+	ir_node *node;
+	int      pos;  /**< next input to visit plus one, or one of walk_pos_t */
+} walk_frame;
+
+typedef enum walk_pos_t {
+	WALK_BLOCK = -2, /**< the block of the node is visited next */
+	WALK_INS   = -1, /**< the inputs of the node are visited next */
+} walk_pos_t;
+
+/** Explicit stack of the nodes being visited. */
+typedef struct walk_stack {
+	walk_frame *frames;
+	size_t      len;
+	size_t      max;
+} walk_stack;
+
+/** Marks @p node as visited, calls pre and pushes it onto @p stack. */
+static inline void walk_enter(walk_stack *stack, ir_node *node,
+                              ir_visited_t visited, irg_walk_func *pre,
+                              void *env)
+{
+	node->visited = visited;
+	if (pre != NULL)
+		pre(node, env);
+	if (stack->len == stack->max) {
+		stack->max   *= 2;
+		stack->frames = XREALLOC(stack->frames, walk_frame, stack->max);
+	}
+	walk_frame *const frame = &stack->frames[stack->len++];
+	frame->node = node;
+	frame->pos  = WALK_BLOCK;
+}
 
 /**
- * specialized version of irg_walk_2, called if only pre callback exists
+ * Walks the predecessors of @p node with an explicit stack, so deep graphs do
+ * not overflow the native stack.  The nodes are visited in the same order as
+ * by a recursion over the block and then the inputs from last to first.
  */
-static void irg_walk_2_pre(ir_node *node, irg_walk_func *pre, void *env)
+static inline void irg_walk_2_iter(ir_node *node, irg_walk_func *pre,
+                                   irg_walk_func *post, void *env)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	pre(node, env);
+	ir_graph    *const irg     = get_irn_irg(node);
+	ir_visited_t const visited = irg->visited;
+	walk_stack         stack   = { XMALLOCN(walk_frame, 64), 0, 64 };
+
+	walk_enter(&stack, node, visited, pre, env);
+	while (stack.len > 0) {
+		walk_frame *const frame = &stack.frames[stack.len - 1];
+		ir_node    *const cur   = frame->node;
+		if (frame->pos == WALK_BLOCK) {
+			frame->pos = WALK_INS;
+			if (!is_Block(cur)) {
+				ir_node *const block = get_nodes_block(cur);
+				if (block->visited < visited) {
+					walk_enter(&stack, block, visited, pre, env);
+					continue;
+				}
+			}
+		}
+		/* like foreach_irn_in_r() the arity is read once the inputs are
+		 * visited */
+		if (frame->pos == WALK_INS)
+			frame->pos = get_irn_arity(cur);
+		while (frame->pos > 0) {
+			ir_node *const pred = get_irn_n(cur, --frame->pos);
+			if (pred->visited < visited) {
+				walk_enter(&stack, pred, visited, pre, env);
+				goto next;
+			}
+		}
 
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_2_pre(pred, pre, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_2_pre(pred, pre, env);
+		--stack.len;
+		if (post != NULL)
+			post(cur, env);
+next:;
 	}
+	free(stack.frames);
+}
+
+/**
+ * specialized version of irg_walk_2, called if only pre callback exists
+ */
+static void irg_walk_2_pre(ir_node *node, irg_walk_func *pre, void *env)
+{
+	irg_walk_2_iter(node, pre, NULL, env);
 }
 
 /**
@@ -54,48 +121,16 @@ static void irg_walk_2_pre(ir_node *node, irg_walk_func *pre, void *env)
  */
 static void irg_walk_2_post(ir_node *node, irg_walk_func *post, void *env)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_2_post(pred, post, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_2_post(pred, post, env);
-	}
-
-	post(node, env);
+	irg_walk_2_iter(node, NULL, post, env);
 }
 
 /**
  * specialized version of irg_walk_2, called if pre and post callbacks exist
  */
 static void irg_walk_2_both(ir_node *node, irg_walk_func *pre,
-                                irg_walk_func *post, void *env)
+                            irg_walk_func *post, void *env)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	pre(node, env);
-
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_2_both(pred, pre, post, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_2_both(pred, pre, post, env);
-	}
-
-	post(node, env);
+	irg_walk_2_iter(node, pre, post, env);
 }
 
 void irg_walk_2(ir_node *node, irg_walk_func *pre, irg_walk_func *post,
@@ -133,85 +168,22 @@ void irg_walk_graph(ir_graph *irg, irg_walk_func *pre, irg_walk_func *post,
 	irg_walk(get_irg_end(irg), pre, post, env);
 }
 
-void all_irg_walk(irg_walk_func *pre, irg_walk_func *post, void *env)
+void irg_walk_graph_unordered(ir_graph *irg, irg_walk_func *func, void *env)
 {
-	foreach_irp_irg(i, irg) {
-		irg_walk_graph(irg, pre, post, env);
+	hook_irg_walk(irg, (generic_func*)func, NULL);
+	for (unsigned i = 0, n = get_irg_last_idx(irg); i < n; ++i) {
+		ir_node *const node = get_idx_irn(irg, i);
+		/* killed and exchanged nodes are no longer part of the graph */
+		if (node != NULL && get_irn_op(node) != op_Deleted)
+			func(node, env);
 	}
 }
 
-/**
- * specialized version of irg_walk_in_or_dep_2, called if only pre callback exists
- */
-static void irg_walk_in_or_dep_2_pre(ir_node *node, irg_walk_func *pre,
-                                     void *env)
-{
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	pre(node, env);
-
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_pre(pred, pre, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_pre(pred, pre, env);
-	}
-}
-
-/**
- * specialized version of irg_walk_in_or_dep_2, called if only post callback exists
- */
-static void irg_walk_in_or_dep_2_post(ir_node *node, irg_walk_func *post,
-                                      void *env)
-{
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_post(pred, post, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_post(pred, post, env);
-	}
-
-	post(node, env);
-}
-
-/**
- * specialized version of irg_walk_in_or_dep_2, called if pre and post callbacks exist
- */
-static void irg_walk_in_or_dep_2_both(ir_node *node, irg_walk_func *pre,
-                                      irg_walk_func *post, void *env)
+void all_irg_walk(irg_walk_func *pre, irg_walk_func *post, void *env)
 {
-	ir_graph    *irg     = get_irn_irg(node);
-	ir_visited_t visited = irg->visited;
-
-	set_irn_visited(node, visited);
-
-	pre(node, env);
-
-	if (!is_Block(node)) {
-		ir_node *pred = get_nodes_block(node);
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_both(pred, pre, post, env);
-	}
-	foreach_irn_in_r(node, i, pred) {
-		if (pred->visited < visited)
-			irg_walk_in_or_dep_2_both(pred, pre, post, env);
+	foreach_irp_irg(i, irg) {
+		irg_walk_graph(irg, pre, post, env);
 	}
-
-	post(node, env);
 }
 
 /**
@@ -220,12 +192,8 @@ static void irg_walk_in_or_dep_2_both(ir_node *node, irg_walk_func *pre,
 static void irg_walk_in_or_dep_2(ir_node *node, irg_walk_func *pre,
                                  irg_walk_func *post, void *env)
 {
-	if (irn_visited(node))
-		return;
-
-	if      (post == NULL) irg_walk_in_or_dep_2_pre (node, pre, env);
-	else if (pre == NULL)  irg_walk_in_or_dep_2_post(node, post, env);
-	else                   irg_walk_in_or_dep_2_both(node, pre, post, env);
+	/* the graphs have no extra dependency edges, so this is the normal walk */
+	irg_walk_2(node, pre, post, env);
 }
 
 void irg_walk_in_or_dep(ir_node *node, irg_walk_func *pre, irg_walk_func *post,
@@ -257,28 +225,65 @@ static ir_node *get_cf_op(ir_node *n)
 	return n;
 }
 
+/** Walker state of a block whose predecessors are being visited. */
+typedef struct block_walk_frame {
+	ir_node *block;
+	int      pos;   /**< next control flow predecessor to visit plus one */
+} block_walk_frame;
+
+/** Explicit stack of the blocks being visited. */
+typedef struct block_walk_stack {
+	block_walk_frame *frames;
+	size_t            len;
+	size_t            max;
+} block_walk_stack;
+
+/** Marks @p block as visited, calls pre and pushes it onto @p stack. */
+static void block_walk_enter(block_walk_stack *stack, ir_node *block,
+                             irg_walk_func *pre, void *env)
+{
+	mark_Block_block_visited(block);
+	if (pre != NULL)
+		pre(block, env);
+	if (stack->len == stack->max) {
+		stack->max   *= 2;
+		stack->frames = XREALLOC(stack->frames, block_walk_frame, stack->max);
+	}
+	block_walk_frame *const frame = &stack->frames[stack->len++];
+	frame->block = block;
+	frame->pos   = get_Block_n_cfgpreds(block);
+}
+
 static void irg_block_walk_2(ir_node *node, irg_walk_func *pre,
                              irg_walk_func *post, void *env)
 {
 	if (Block_block_visited(node))
 		return;
-	mark_Block_block_visited(node);
 
-	if (pre != NULL)
-		pre(node, env);
+	block_walk_stack stack = { XMALLOCN(block_walk_frame, 16), 0, 16 };
+	block_walk_enter(&stack, node, pre, env);
+	while (stack.len > 0) {
+		block_walk_frame *const frame = &stack.frames[stack.len - 1];
+		ir_node          *const block = frame->block;
+		while (frame->pos > 0) {
+			/* find the corresponding predecessor block. */
+			ir_node *const pred_cfop
+				= get_cf_op(get_Block_cfgpred(block, --frame->pos));
+			if (is_Bad(pred_cfop))
+				continue;
+			ir_node *const pred_block = get_nodes_block(pred_cfop);
+			if (!Block_block_visited(pred_block)) {
+				block_walk_enter(&stack, pred_block, pre, env);
+				goto next;
+			}
+		}
 
-	for (int i = get_Block_n_cfgpreds(node); i-- > 0; ) {
-		/* find the corresponding predecessor block. */
-		ir_node *pred_cfop  = get_cf_op(get_Block_cfgpred(node, i));
-		if (is_Bad(pred_cfop))
-			continue;
-		ir_node *pred_block = get_nodes_block(pred_cfop);
-		/* recursion */
-		irg_block_walk_2(pred_block, pre, post, env);
+		--stack.len;
+		if (post != NULL)
+			post(block, env);
+next:;
 	}
-
-	if (post != NULL)
-		post(node, env);
+	free(stack.frames);
 }
 
 void irg_block_walk(ir_node *node, irg_walk_func *pre, irg_walk_func *post,
@@ -73,6 +73,9 @@ struct hook_entry {
 		void (*_hook_set_irn_n)(void *context, ir_node *src,
 		                        int pos, ir_node *tgt, ir_node *old_tgt);
 
+		/** This hook is called, before all inputs of a node are replaced. */
+		void (*_hook_set_irn_in)(void *context, ir_node *node);
+
 		/** This hook is called, before a node is replaced (exchange()) by another. */
 		void (*_hook_replace)(void *context, ir_node *old_node, ir_node *new_node);
 
@@ -159,6 +162,7 @@ typedef enum {
 	hook_free_ir_op,           /**< type for hook_free_ir_op() hook */
 	hook_new_node,             /**< type for hook_new_node() hook */
 	hook_set_irn_n,            /**< type for hook_set_irn_n() hook */
+	hook_set_irn_in,           /**< type for hook_set_irn_in() hook */
 	hook_replace,              /**< type for hook_replace() hook */
 	hook_turn_into_id,         /**< type for hook_turn_into_id() hook */
 	hook_normalize,            /**< type for hook_normalize() hook */
@@ -226,6 +230,8 @@ extern hook_entry_t *hooks[hook_last];
 /** Called when a nodes input is changed */
 #define hook_set_irn_n(src, pos, tgt, old_tgt) \
   hook_exec(hook_set_irn_n, (hook_ctx_, src, pos, tgt, old_tgt))
+/** Called when all inputs of a node are replaced */
+#define hook_set_irn_in(node)             hook_exec(hook_set_irn_in, (hook_ctx_, node))
 /** Called when a node is replaced */
 #define hook_replace(old, nw)             hook_exec(hook_replace, (hook_ctx_, old, nw))
 /** Called when a node is turned into an Id node */
@@ -5,14 +5,22 @@
 
 /**
  * @file
- * @brief   Write textual representation of firm to file.
+ * @brief   Write textual or binary representation of firm to file.
  * @author  Moritz Kroll, Matthias Braun
  */
 #include <string.h>
 #include <ctype.h>
 #include <stdbool.h>
 #include <stdarg.h>
-
+#include <stdint.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "irio_t.h"
 #include "irio.h"
 
 #include "irnode_t.h"
@@ -23,6 +31,7 @@
 #include "irgmod.h"
 #include "irflag_t.h"
 #include "irgwalk.h"
+#include "execfreq.h"
 #include "tv_t.h"
 #include "array.h"
 #include "panic.h"
@@ -31,9 +40,32 @@
 #include "obst.h"
 #include "pmap.h"
 #include "pdeq.h"
+#include "util.h"
+#include "xmalloc.h"
 
 #define SYMERROR ((unsigned) ~0)
 
+/**
+ * The binary format uses the same sequence of items as the text format.
+ * Numbers are zigzag encoded: values up to BIN_NUMBER_MAX take a single byte,
+ * larger ones a BIN_NUMBER_LONG + n - 1 byte followed by n little endian
+ * bytes. Symbols, strings and tarvals are indices into pools which are stored
+ * at the end of the file together with an index of the graph sections.
+ * Node numbers are stored relative to the last node defined.
+ */
+static const char bin_magic[8] = { 'F', 'I', 'R', 'M', 'B', 'I', 'N', '1' };
+
+enum {
+	BIN_NUMBER_MAX  = 0xEF,
+	BIN_NUMBER_LONG = 0xF0,
+	BIN_STRING      = 0xF8,
+	BIN_TARVAL      = 0xF9,
+	BIN_LIST_BEGIN  = 0xFA,
+	BIN_LIST_END    = 0xFB,
+	BIN_SCOPE_BEGIN = 0xFC,
+	BIN_SCOPE_END   = 0xFD,
+};
+
 static void register_generated_node_readers(void);
 static void register_generated_node_writers(void);
 
@@ -48,12 +80,37 @@ typedef struct delayed_pred_t {
 	long     preds[];
 } delayed_pred_t;
 
+/** An entry of the per-function index of the binary format. */
+typedef struct irg_index_entry_t {
+	long   entity_nr; /**< number of the graph entity */
+	size_t begin;     /**< file offset of the graph section */
+	size_t end;       /**< file offset behind the graph section */
+} irg_index_entry_t;
+
 typedef struct read_env_t {
 	int            c;           /**< currently read char */
 	FILE          *file;
 	const char    *inputname;
 	unsigned       line;
 
+	bool                 binary;     /**< reading the binary format */
+	const unsigned char *data;       /**< binary: the mapped file */
+	size_t               pos;        /**< binary: offset of the next byte */
+	size_t               end;        /**< binary: end of the current section */
+	long                 node_base;  /**< binary: last node number read */
+	ident              **strings;    /**< binary: the string pool */
+	size_t               n_strings;
+	size_t              *tarval_strs; /**< binary: mode and value string of
+	                                       each tarval pool entry */
+	ir_tarval          **tarvals;    /**< binary: decoded tarval pool */
+	size_t               n_tarvals;
+	irg_index_entry_t   *index;      /**< binary: the per-function index */
+	size_t               n_index;
+	size_t               next_irg;   /**< binary: index entry of the next irg */
+	pmap                *lazy_irgs;  /**< binary: entity -> index entry of the
+	                                      graphs not read yet, NULL if all
+	                                      graphs are read immediately */
+
 	ir_graph      *irg;
 	set           *idset;       /**< id_entry set, which maps from file ids to
 	                                 new Firm elements */
@@ -66,9 +123,22 @@ typedef struct read_env_t {
 } read_env_t;
 
 typedef struct write_env_t {
-	FILE *file;
-	pdeq *write_queue;
-	pdeq *entity_queue;
+	FILE              *file;
+	pdeq              *write_queue;
+	pdeq              *entity_queue;
+	bool               binary;      /**< write the binary format */
+	struct obstack    *canonical;   /**< canonical description: the binary
+	                                     format without numbers and pools
+	                                     is written to this obstack */
+	pmap              *local_nrs;   /**< canonical: object -> local number */
+	bool               incomplete;  /**< canonical: found objects which
+	                                     cannot be described */
+	long               node_base;   /**< binary: last node number written */
+	pmap              *strings;     /**< binary: ident -> string pool index */
+	ident            **string_list; /**< binary: the string pool */
+	pmap              *tarvals;     /**< binary: tarval -> tarval pool index */
+	ir_tarval        **tarval_list; /**< binary: the tarval pool */
+	irg_index_entry_t *index;       /**< binary: the per-function index */
 } write_env_t;
 
 typedef enum typetag_t {
@@ -109,6 +179,7 @@ typedef enum keyword_t {
 	kw_type,
 	kw_typegraph,
 	kw_unknown,
+	kw_vector_mode,
 } keyword_t;
 
 typedef struct symbol_t {
@@ -157,7 +228,11 @@ parse_error(read_env_t *env, const char *fmt, ...)
 		line--;
 	}
 
-	fprintf(stderr, "%s:%u: error ", env->inputname, line);
+	if (env->binary) {
+		fprintf(stderr, "%s:@%zu: error ", env->inputname, env->pos);
+	} else {
+		fprintf(stderr, "%s:%u: error ", env->inputname, line);
+	}
 	env->read_errors = true;
 
 	va_list ap;
@@ -236,6 +311,7 @@ static void symtbl_init(void)
 	INSERTKEYWORD(type);
 	INSERTKEYWORD(typegraph);
 	INSERTKEYWORD(unknown);
+	INSERTKEYWORD(vector_mode);
 
 	INSERTENUM(tt_align, align_non_aligned);
 	INSERTENUM(tt_align, align_is_aligned);
@@ -331,39 +407,155 @@ static unsigned symbol(const char *str, typetag_t typetag)
 	return entry ? entry->code : SYMERROR;
 }
 
+static void put_byte(write_env_t *env, int c)
+{
+	if (env->canonical != NULL)
+		obstack_1grow(env->canonical, c);
+	else
+		fputc(c, env->file);
+}
+
+static void bin_write_number(write_env_t *env, long value)
+{
+	/* zigzag encoding keeps small negative numbers small */
+	uint64_t bits = ((uint64_t)value << 1) ^ (value < 0 ? UINT64_MAX : 0);
+	if (bits <= BIN_NUMBER_MAX) {
+		put_byte(env, (int)bits);
+		return;
+	}
+	unsigned n_bytes = 0;
+	for (uint64_t b = bits; b != 0; b >>= 8)
+		++n_bytes;
+	put_byte(env, BIN_NUMBER_LONG + n_bytes - 1);
+	for (unsigned i = 0; i < n_bytes; ++i)
+		put_byte(env, (int)(bits >> (8 * i)) & 0xFF);
+}
+
+/** Returns the string pool index of @p id, 0 is reserved for NULL. */
+static size_t get_string_index(write_env_t *env, ident *id)
+{
+	if (id == NULL)
+		return 0;
+	size_t index = PTR_TO_INT(pmap_get(void, env->strings, id));
+	if (index == 0) {
+		ARR_APP1(ident*, env->string_list, id);
+		index = ARR_LEN(env->string_list);
+		pmap_insert(env->strings, id, INT_TO_PTR(index));
+	}
+	return index;
+}
+
+static void bin_write_raw_string(write_env_t *env, ident *id)
+{
+	const char *str = get_id_str(id);
+	size_t      len = strlen(str);
+	bin_write_number(env, (long)len);
+	if (env->canonical != NULL)
+		obstack_grow(env->canonical, str, len);
+	else
+		fwrite(str, 1, len, env->file);
+}
+
+static void bin_write_string(write_env_t *env, ident *id)
+{
+	put_byte(env, BIN_STRING);
+	if (env->canonical != NULL) {
+		/* the pool order depends on the other graphs */
+		bin_write_number(env, id != NULL);
+		if (id != NULL)
+			bin_write_raw_string(env, id);
+		return;
+	}
+	bin_write_number(env, get_string_index(env, id));
+}
+
+/** Writes layout characters which only exist in the text format. */
+static void write_layout(write_env_t *env, char c)
+{
+	if (!env->binary)
+		fputc(c, env->file);
+}
+
 static void write_long(write_env_t *env, long value)
 {
+	if (env->binary) {
+		bin_write_number(env, value);
+		return;
+	}
 	fprintf(env->file, "%ld ", value);
 }
 
 static void write_int(write_env_t *env, int value)
 {
+	if (env->binary) {
+		bin_write_number(env, value);
+		return;
+	}
 	fprintf(env->file, "%d ", value);
 }
 
 static void write_unsigned(write_env_t *env, unsigned value)
 {
+	if (env->binary) {
+		bin_write_number(env, (long)value);
+		return;
+	}
 	fprintf(env->file, "%u ", value);
 }
 
 static void write_size_t(write_env_t *env, size_t value)
 {
+	if (env->binary) {
+		bin_write_number(env, (long)value);
+		return;
+	}
 	ir_fprintf(env->file, "%zu ", value);
 }
 
 static void write_symbol(write_env_t *env, const char *symbol)
 {
+	if (env->binary) {
+		bin_write_string(env, new_id_from_str(symbol));
+		return;
+	}
 	fputs(symbol, env->file);
 	fputc(' ', env->file);
 }
 
+/**
+ * Returns true if @p object was described before in the canonical description
+ * and writes its local number then. Otherwise assigns the next local number.
+ */
+static bool write_canonical_seen(write_env_t *env, const void *object)
+{
+	size_t nr = PTR_TO_INT(pmap_get(void, env->local_nrs, object));
+	if (nr != 0) {
+		bin_write_number(env, (long)nr);
+		return true;
+	}
+	pmap_insert(env->local_nrs, object,
+	            INT_TO_PTR(pmap_count(env->local_nrs) + 1));
+	return false;
+}
+
+static void write_canonical_type(write_env_t *env, ir_type *type);
+static void write_canonical_entity(write_env_t *env, ir_entity *entity);
+
 static void write_entity_ref(write_env_t *env, ir_entity *entity)
 {
+	if (env->canonical != NULL) {
+		write_canonical_entity(env, entity);
+		return;
+	}
 	write_long(env, get_entity_nr(entity));
 }
 
 static void write_type_ref(write_env_t *env, ir_type *type)
 {
+	if (env->canonical != NULL) {
+		write_canonical_type(env, type);
+		return;
+	}
 	switch (get_type_tpop_code(type)) {
 	case tpo_unknown:
 		write_symbol(env, "unknown");
@@ -379,6 +571,10 @@ static void write_type_ref(write_env_t *env, ir_type *type)
 
 static void write_string(write_env_t *env, const char *string)
 {
+	if (env->binary) {
+		bin_write_string(env, new_id_from_str(string));
+		return;
+	}
 	fputc('"', env->file);
 	for (const char *c = string; *c != '\0'; ++c) {
 		switch (*c) {
@@ -401,12 +597,18 @@ static void write_string(write_env_t *env, const char *string)
 
 static void write_ident(write_env_t *env, ident *id)
 {
+	if (env->binary) {
+		bin_write_string(env, id);
+		return;
+	}
 	write_string(env, get_id_str(id));
 }
 
 static void write_ident_null(write_env_t *env, ident *id)
 {
-	if (id == NULL) {
+	if (env->binary) {
+		bin_write_string(env, id);
+	} else if (id == NULL) {
 		fputs("NULL ", env->file);
 	} else {
 		write_ident(env, id);
@@ -420,30 +622,42 @@ static void write_mode_ref(write_env_t *env, ir_mode *mode)
 
 static void write_tarval_ref(write_env_t *env, ir_tarval *tv)
 {
+	if (env->binary && env->canonical == NULL) {
+		size_t index = PTR_TO_INT(pmap_get(void, env->tarvals, tv));
+		if (index == 0) {
+			ARR_APP1(ir_tarval*, env->tarval_list, tv);
+			index = ARR_LEN(env->tarval_list);
+			pmap_insert(env->tarvals, tv, INT_TO_PTR(index));
+		}
+		put_byte(env, BIN_TARVAL);
+		bin_write_number(env, index - 1);
+		return;
+	}
 	ir_mode *mode = get_tarval_mode(tv);
 	write_mode_ref(env, mode);
 	char buf[128];
 	const char *ascii = ir_tarval_to_ascii(buf, sizeof(buf), tv);
+	if (env->canonical != NULL) {
+		write_string(env, ascii);
+		return;
+	}
 	fputs(ascii, env->file);
 	fputc(' ', env->file);
 }
 
 static void write_align(write_env_t *env, ir_align align)
 {
-	fputs(get_align_name(align), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_align_name(align));
 }
 
 static void write_builtin_kind(write_env_t *env, ir_builtin_kind kind)
 {
-	fputs(get_builtin_kind_name(kind), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_builtin_kind_name(kind));
 }
 
 static void write_cond_jmp_predicate(write_env_t *env, cond_jmp_predicate pred)
 {
-	fputs(get_cond_jmp_predicate_name(pred), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_cond_jmp_predicate_name(pred));
 }
 
 static void write_relation(write_env_t *env, ir_relation relation)
@@ -463,36 +677,55 @@ static void write_loop(write_env_t *env, bool loop)
 
 static void write_list_begin(write_env_t *env)
 {
+	if (env->binary) {
+		put_byte(env, BIN_LIST_BEGIN);
+		return;
+	}
 	fputs("[", env->file);
 }
 
 static void write_list_end(write_env_t *env)
 {
+	if (env->binary) {
+		put_byte(env, BIN_LIST_END);
+		return;
+	}
 	fputs("] ", env->file);
 }
 
 static void write_scope_begin(write_env_t *env)
 {
+	if (env->binary) {
+		put_byte(env, BIN_SCOPE_BEGIN);
+		return;
+	}
 	fputs("{\n", env->file);
 }
 
 static void write_scope_end(write_env_t *env)
 {
+	if (env->binary) {
+		put_byte(env, BIN_SCOPE_END);
+		return;
+	}
 	fputs("}\n\n", env->file);
 }
 
 static void write_node_ref(write_env_t *env, const ir_node *node)
 {
-	write_long(env, get_irn_node_nr(node));
+	if (env->canonical != NULL) {
+		if (!write_canonical_seen(env, node))
+			bin_write_number(env, 0);
+		return;
+	}
+	long nr = get_irn_node_nr(node);
+	write_long(env, env->binary ? nr - env->node_base : nr);
 }
 
 static void write_initializer(write_env_t *const env, ir_initializer_t const *const ini)
 {
-	FILE *f = env->file;
 	ir_initializer_kind_t ini_kind = get_initializer_kind(ini);
-
-	fputs(get_initializer_kind_name(ini_kind), f);
-	fputc(' ', f);
+	write_symbol(env, get_initializer_kind_name(ini_kind));
 
 	switch (ini_kind) {
 	case IR_INITIALIZER_CONST:
@@ -519,37 +752,32 @@ static void write_initializer(write_env_t *const env, ir_initializer_t const *co
 
 static void write_pin_state(write_env_t *env, op_pin_state state)
 {
-	fputs(get_op_pin_state_name(state), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_op_pin_state_name(state));
 }
 
 static void write_volatility(write_env_t *env, ir_volatility vol)
 {
-	fputs(get_volatility_name(vol), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_volatility_name(vol));
 }
 
 static void write_type_state(write_env_t *env, ir_type_state state)
 {
-	fputs(get_type_state_name(state), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_type_state_name(state));
 }
 
 static void write_visibility(write_env_t *env, ir_visibility visibility)
 {
-	fputs(get_visibility_name(visibility), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_visibility_name(visibility));
 }
 
 static void write_mode_arithmetic(write_env_t *env, ir_mode_arithmetic arithmetic)
 {
-	fputs(get_mode_arithmetic_name(arithmetic), env->file);
-	fputc(' ', env->file);
+	write_symbol(env, get_mode_arithmetic_name(arithmetic));
 }
 
 static void write_type_common(write_env_t *env, ir_type *tp)
 {
-	fputc('\t', env->file);
+	write_layout(env, '\t');
 	write_symbol(env, "type");
 	write_long(env, get_type_nr(tp));
 	write_symbol(env, get_type_tpop_name(tp));
@@ -564,7 +792,7 @@ static void write_type(write_env_t *env, ir_type *tp);
 static bool is_internal_mode(ir_mode *mode)
 {
 	return !mode_is_int(mode) && !mode_is_reference(mode)
-	    && !mode_is_float(mode);
+	    && !mode_is_float(mode) && !mode_is_vector(mode);
 }
 
 static bool is_default_mode(ir_mode *mode)
@@ -583,7 +811,7 @@ static void write_type_primitive(write_env_t *env, ir_type *tp)
 
 	write_type_common(env, tp);
 	write_mode_ref(env, mode);
-	fputc('\n', env->file);
+	write_layout(env, '\n');
 }
 
 static void write_type_compound(write_env_t *env, ir_type *tp)
@@ -597,7 +825,7 @@ static void write_type_compound(write_env_t *env, ir_type *tp)
 	}
 	write_type_common(env, tp);
 	write_ident_null(env, get_compound_ident(tp));
-	fputc('\n', env->file);
+	write_layout(env, '\n');
 
 	for (size_t i = 0, n = get_compound_n_members(tp); i < n; ++i) {
 		ir_entity *member = get_compound_member(tp, i);
@@ -619,7 +847,7 @@ static void write_type_array(write_env_t *env, ir_type *tp)
 		write_symbol(env, "unknown");
 	else
 		panic("upper array bound is not constant");
-	fputc('\n', env->file);
+	write_layout(env, '\n');
 }
 
 static void write_type_method(write_env_t *env, ir_type *tp)
@@ -641,7 +869,7 @@ static void write_type_method(write_env_t *env, ir_type *tp)
 	for (size_t i = 0; i < nresults; i++)
 		write_type_ref(env, get_method_res_type(tp, i));
 	write_unsigned(env, get_method_variadicity(tp));
-	fputc('\n', env->file);
+	write_layout(env, '\n');
 }
 
 static void write_type_pointer(write_env_t *env, ir_type *tp)
@@ -653,7 +881,7 @@ static void write_type_pointer(write_env_t *env, ir_type *tp)
 	write_type_common(env, tp);
 	write_mode_ref(env, get_type_mode(tp));
 	write_type_ref(env, points_to);
-	fputc('\n', env->file);
+	write_layout(env, '\n');
 }
 
 static void write_type(write_env_t *env, ir_type *tp)
@@ -701,7 +929,7 @@ static void write_entity(write_env_t *env, ir_entity *ent)
 		write_entity(env, aliased);
 	}
 
-	fputc('\t', env->file);
+	write_layout(env, '\t');
 	switch ((ir_entity_kind)ent->entity_kind) {
 	case IR_ENTITY_ALIAS:           write_symbol(env, "alias");           break;
 	case IR_ENTITY_GOTENTRY:        write_symbol(env, "gotentry");        break;
@@ -791,7 +1019,146 @@ static void write_entity(write_env_t *env, ir_entity *ent)
 		break;
 	}
 
-	fputc('\n', env->file);
+	write_layout(env, '\n');
+}
+
+/**
+ * Writes everything the backend may use of @p entity instead of its number,
+ * so the description does not depend on the rest of the program.
+ */
+static void write_canonical_entity(write_env_t *env, ir_entity *entity)
+{
+	if (write_canonical_seen(env, entity))
+		return;
+	bin_write_number(env, 0);
+
+	ir_entity_kind kind = (ir_entity_kind)entity->entity_kind;
+	write_unsigned(env, kind);
+	switch (kind) {
+	case IR_ENTITY_UNKNOWN:
+		return;
+	case IR_ENTITY_LABEL:
+		/* label numbers are assigned program wide */
+		env->incomplete = true;
+		return;
+	case IR_ENTITY_PARAMETER:
+		break;
+	default:
+		write_ident_null(env, get_entity_ident(entity));
+		write_ident_null(env, entity_has_ld_ident(entity)
+		                      ? get_entity_ld_ident(entity) : NULL);
+		break;
+	}
+	write_visibility(env, get_entity_visibility(entity));
+	write_unsigned(env, get_entity_linkage(entity));
+	write_volatility(env, get_entity_volatility(entity));
+	write_unsigned(env, get_entity_alignment(entity));
+	write_long(env, is_entity_compiler_generated(entity));
+	write_type_ref(env, get_entity_type(entity));
+	write_type_ref(env, get_entity_owner(entity));
+
+	switch (kind) {
+	case IR_ENTITY_ALIAS:
+		write_entity_ref(env, get_entity_alias(entity));
+		return;
+	case IR_ENTITY_GOTENTRY:
+		write_entity_ref(env, entity->attr.got.referenced);
+		return;
+	case IR_ENTITY_PARAMETER:
+		write_size_t(env, get_entity_parameter_number(entity));
+		/* FALLTHROUGH */
+	case IR_ENTITY_COMPOUND_MEMBER:
+		write_long(env, get_entity_offset(entity));
+		write_unsigned(env, get_entity_bitfield_offset(entity));
+		write_unsigned(env, get_entity_bitfield_size(entity));
+		return;
+	case IR_ENTITY_METHOD:
+		write_unsigned(env, get_entity_additional_properties(entity));
+		return;
+	case IR_ENTITY_NORMAL:
+	case IR_ENTITY_UNKNOWN:
+	case IR_ENTITY_LABEL:
+		return;
+	}
+	panic("invalid entity kind");
+}
+
+/**
+ * Writes the structure of @p type instead of its number, so the description
+ * does not depend on the rest of the program.
+ */
+static void write_canonical_type(write_env_t *env, ir_type *type)
+{
+	if (write_canonical_seen(env, type))
+		return;
+	bin_write_number(env, 0);
+
+	if (is_segment_type(type)) {
+		/* the members of a segment are described where they are used */
+		write_symbol(env, "segment");
+		write_ident_null(env, get_compound_ident(type));
+		return;
+	}
+	write_symbol(env, get_type_tpop_name(type));
+	write_unsigned(env, get_type_size_bytes(type));
+	write_unsigned(env, get_type_alignment_bytes(type));
+	write_type_state(env, get_type_state(type));
+	write_unsigned(env, type->flags);
+
+	switch ((tp_opcode)get_type_tpop_code(type)) {
+	case tpo_unknown:
+	case tpo_code:
+	case tpo_uninitialized:
+		return;
+
+	case tpo_primitive:
+		write_mode_ref(env, get_type_mode(type));
+		return;
+
+	case tpo_pointer:
+		write_mode_ref(env, get_type_mode(type));
+		write_type_ref(env, get_pointer_points_to_type(type));
+		return;
+
+	case tpo_array: {
+		write_type_ref(env, get_array_element_type(type));
+		ir_node *size = get_array_size(type);
+		if (is_Const(size))
+			write_long(env, get_Const_long(size));
+		else if (is_Unknown(size))
+			write_symbol(env, "unknown");
+		else
+			env->incomplete = true;
+		return;
+	}
+
+	case tpo_method: {
+		size_t n_params  = get_method_n_params(type);
+		size_t n_results = get_method_n_ress(type);
+		write_unsigned(env, get_method_calling_convention(type));
+		write_unsigned(env, get_method_additional_properties(type));
+		write_size_t(env, n_params);
+		write_size_t(env, n_results);
+		for (size_t i = 0; i < n_params; ++i)
+			write_type_ref(env, get_method_param_type(type, i));
+		for (size_t i = 0; i < n_results; ++i)
+			write_type_ref(env, get_method_res_type(type, i));
+		write_unsigned(env, get_method_variadicity(type));
+		return;
+	}
+
+	case tpo_union:
+	case tpo_struct:
+	case tpo_class: {
+		size_t n_members = get_compound_n_members(type);
+		write_ident_null(env, get_compound_ident(type));
+		write_size_t(env, n_members);
+		for (size_t i = 0; i < n_members; ++i)
+			write_entity_ref(env, get_compound_member(type, i));
+		return;
+	}
+	}
+	panic("can't write invalid type %+F", type);
 }
 
 static void write_switch_table_ref(write_env_t *env,
@@ -821,17 +1188,19 @@ static void write_pred_refs(write_env_t *env, const ir_node *node, int from)
 	write_list_end(env);
 }
 
+/** Writes the number of the node defined next. */
 static void write_node_nr(write_env_t *env, const ir_node *node)
 {
-	write_long(env, get_irn_node_nr(node));
+	write_node_ref(env, node);
+	env->node_base = get_irn_node_nr(node);
 }
 
 static void write_ASM(write_env_t *env, const ir_node *node)
 {
 	write_symbol(env, "ASM");
 	write_node_nr(env, node);
-	write_node_nr(env, get_nodes_block(node));
-	write_node_nr(env, get_ASM_mem(node));
+	write_node_ref(env, get_nodes_block(node));
+	write_node_ref(env, get_ASM_mem(node));
 
 	write_ident(env, get_ASM_text(node));
 	write_list_begin(env);
@@ -891,6 +1260,12 @@ static void write_Block(write_env_t *env, const ir_node *node)
 		write_symbol(env, "Block");
 		write_node_nr(env, node);
 	}
+	if (env->canonical != NULL) {
+		/* the backend lays out and allocates along the frequencies */
+		char buf[64];
+		snprintf(buf, sizeof(buf), "%a", get_block_execfreq(node));
+		write_string(env, buf);
+	}
 	write_pred_refs(env, node, 0);
 }
 
@@ -923,11 +1298,16 @@ static void write_node(const ir_node *node, write_env_t *env)
 	ir_op           *const op   = get_irn_op(node);
 	write_node_func *const func = get_generic_function_ptr(write_node_func, op);
 
-	fputc('\t', env->file);
-	if (func == NULL)
+	write_layout(env, '\t');
+	if (func == NULL) {
+		if (env->canonical != NULL) {
+			env->incomplete = true;
+			return;
+		}
 		panic("no write_node_func for %+F", node);
+	}
 	func(env, node);
-	fputc('\n', env->file);
+	write_layout(env, '\n');
 }
 
 static void write_node_recursive(ir_node *node, write_env_t *env);
@@ -990,6 +1370,11 @@ static void write_mode(write_env_t *env, ir_mode *mode)
 		write_unsigned(env, get_mode_exponent_size(mode));
 		write_unsigned(env, get_mode_mantissa_size(mode));
 		write_unsigned(env, get_mode_float_int_overflow(mode));
+	} else if (mode_is_vector(mode)) {
+		write_symbol(env, "vector_mode");
+		write_string(env, get_mode_name(mode));
+		write_mode_ref(env, get_mode_vector_element(mode));
+		write_unsigned(env, get_mode_vector_n_elements(mode));
 	} else {
 		panic("cannot write internal modes");
 	}
@@ -998,18 +1383,18 @@ static void write_mode(write_env_t *env, ir_mode *mode)
 static void write_modes(write_env_t *env)
 {
 	write_symbol(env, "modes");
-	fputs("{\n", env->file);
+	write_scope_begin(env);
 
 	for (size_t i = 0, n_modes = ir_get_n_modes(); i < n_modes; i++) {
 		ir_mode *mode = ir_get_mode(i);
 		if (is_internal_mode(mode))
 			continue;
-		fputc('\t', env->file);
+		write_layout(env, '\t');
 		write_mode(env, mode);
-		fputc('\n', env->file);
+		write_layout(env, '\n');
 	}
 
-	fputs("}\n\n", env->file);
+	write_scope_end(env);
 }
 
 static void write_program(write_env_t *env)
@@ -1017,15 +1402,15 @@ static void write_program(write_env_t *env)
 	write_symbol(env, "program");
 	write_scope_begin(env);
 	if (irp_prog_name_is_set()) {
-		fputc('\t', env->file);
+		write_layout(env, '\t');
 		write_symbol(env, "name");
 		write_string(env, get_irp_name());
-		fputc('\n', env->file);
+		write_layout(env, '\n');
 	}
 
 	for (ir_segment_t s = IR_SEGMENT_FIRST; s <= IR_SEGMENT_LAST; ++s) {
 		ir_type *segment_type = get_segment_type(s);
-		fputc('\t', env->file);
+		write_layout(env, '\t');
 		write_symbol(env, "segment_type");
 		write_symbol(env, get_segment_name(s));
 		if (segment_type == NULL) {
@@ -1033,15 +1418,15 @@ static void write_program(write_env_t *env)
 		} else {
 			write_type_ref(env, segment_type);
 		}
-		fputc('\n', env->file);
+		write_layout(env, '\n');
 	}
 
 	for (size_t i = 0, n_asms = get_irp_n_asms(); i < n_asms; ++i) {
 		ident *asm_text = get_irp_asm(i);
-		fputc('\t', env->file);
+		write_layout(env, '\t');
 		write_symbol(env, "asm");
 		write_ident(env, asm_text);
-		fputc('\n', env->file);
+		write_layout(env, '\n');
 	}
 	write_scope_end(env);
 }
@@ -1071,6 +1456,7 @@ static void write_typegraph(write_env_t *env)
 {
 	write_symbol(env, "typegraph");
 	write_scope_begin(env);
+	env->node_base = 0;
 	irp_reserve_resources(irp, IRP_RESOURCE_TYPE_VISITED);
 	inc_master_type_visited();
 	for (size_t i = 0, n_types = get_irp_n_types(); i < n_types; ++i) {
@@ -1087,12 +1473,8 @@ static void write_typegraph(write_env_t *env)
 	write_scope_end(env);
 }
 
-static void write_irg(write_env_t *env, ir_graph *irg)
+static void write_irg_nodes(write_env_t *env, ir_graph *irg)
 {
-	write_symbol(env, "irg");
-	write_entity_ref(env, get_irg_entity(irg));
-	write_type_ref(env, get_irg_frame_type(irg));
-	write_scope_begin(env);
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_VISITED);
 	inc_irg_visited(irg);
 	assert(pdeq_empty(env->write_queue));
@@ -1102,17 +1484,30 @@ static void write_irg(write_env_t *env, ir_graph *irg)
 		write_node_recursive(node, env);
 	} while (!pdeq_empty(env->write_queue));
 	ir_free_resources(irg, IR_RESOURCE_IRN_VISITED);
-	write_scope_end(env);
 }
 
-/* Exports the whole irp to the given file in a textual form. */
-void ir_export_file(FILE *file)
+static void write_irg(write_env_t *env, ir_graph *irg)
 {
-	write_env_t my_env;
-	write_env_t *env = &my_env;
+	irg_index_entry_t entry;
+	entry.entity_nr = get_entity_nr(get_irg_entity(irg));
+	entry.begin     = ftell(env->file);
+	env->node_base  = 0;
 
-	memset(env, 0, sizeof(*env));
-	env->file         = file;
+	write_symbol(env, "irg");
+	write_entity_ref(env, get_irg_entity(irg));
+	write_type_ref(env, get_irg_frame_type(irg));
+	write_scope_begin(env);
+	write_irg_nodes(env, irg);
+	write_scope_end(env);
+
+	if (env->binary) {
+		entry.end = ftell(env->file);
+		ARR_APP1(irg_index_entry_t, env->index, entry);
+	}
+}
+
+static void write_sections(write_env_t *env)
+{
 	env->write_queue  = new_pdeq();
 	env->entity_queue = new_pdeq();
 
@@ -1126,6 +1521,7 @@ void ir_export_file(FILE *file)
 	}
 
 	write_symbol(env, "constirg");
+	env->node_base = 0;
 	write_node_ref(env, get_const_code_irg()->current_block);
 	write_scope_begin(env);
 	walk_const_code(NULL, write_node_cb, env);
@@ -1137,10 +1533,125 @@ void ir_export_file(FILE *file)
 	del_pdeq(env->write_queue);
 }
 
+/* Exports the whole irp to the given file in a textual form. */
+void ir_export_file(FILE *file)
+{
+	write_env_t my_env;
+	write_env_t *env = &my_env;
+
+	memset(env, 0, sizeof(*env));
+	env->file = file;
+	write_sections(env);
+}
+
+bool ir_write_canonical_irg(struct obstack *obst, ir_graph *irg)
+{
+	write_env_t env;
+	memset(&env, 0, sizeof(env));
+	env.binary      = true;
+	env.canonical   = obst;
+	env.local_nrs   = pmap_create();
+	env.write_queue = new_pdeq();
+
+	writers_init();
+	write_entity_ref(&env, get_irg_entity(irg));
+	write_type_ref(&env, get_irg_frame_type(irg));
+	write_irg_nodes(&env, irg);
+
+	del_pdeq(env.write_queue);
+	pmap_destroy(env.local_nrs);
+	return !env.incomplete;
+}
 
+/**
+ * Writes the pools and the index followed by the offset of the pools, which
+ * forms the last 8 bytes of the file.
+ */
+static void write_pools(write_env_t *env)
+{
+	uint64_t pool_offset = ftell(env->file);
+
+	/* register the strings of the tarvals before writing the string pool */
+	size_t  n_tarvals   = ARR_LEN(env->tarval_list);
+	size_t *tarval_strs = XMALLOCN(size_t, 2 * n_tarvals);
+	for (size_t i = 0; i < n_tarvals; ++i) {
+		ir_tarval  *tv    = env->tarval_list[i];
+		ir_mode    *mode  = get_tarval_mode(tv);
+		char        buf[128];
+		const char *ascii = ir_tarval_to_ascii(buf, sizeof(buf), tv);
+		tarval_strs[2 * i]     = get_string_index(env, new_id_from_str(get_mode_name(mode)));
+		tarval_strs[2 * i + 1] = get_string_index(env, new_id_from_str(ascii));
+	}
+
+	size_t n_strings = ARR_LEN(env->string_list);
+	bin_write_number(env, (long)n_strings);
+	for (size_t i = 0; i < n_strings; ++i)
+		bin_write_raw_string(env, env->string_list[i]);
+
+	bin_write_number(env, (long)n_tarvals);
+	for (size_t i = 0; i < 2 * n_tarvals; ++i)
+		bin_write_number(env, (long)tarval_strs[i]);
+	free(tarval_strs);
+
+	size_t n_index = ARR_LEN(env->index);
+	bin_write_number(env, (long)n_index);
+	for (size_t i = 0; i < n_index; ++i) {
+		const irg_index_entry_t *entry = &env->index[i];
+		bin_write_number(env, entry->entity_nr);
+		bin_write_number(env, (long)entry->begin);
+		bin_write_number(env, (long)entry->end);
+	}
+
+	for (unsigned i = 0; i < 8; ++i)
+		fputc((int)(pool_offset >> (8 * i)) & 0xFF, env->file);
+}
+
+int ir_export_binary(const char *filename)
+{
+	FILE *file = fopen(filename, "wb");
+	if (file == NULL) {
+		perror(filename);
+		return 1;
+	}
+
+	ir_export_binary_file(file);
+	int res = ferror(file);
+	fclose(file);
+	return res;
+}
+
+/* Exports the whole irp to the given file in the binary form. */
+void ir_export_binary_file(FILE *file)
+{
+	write_env_t my_env;
+	write_env_t *env = &my_env;
+
+	memset(env, 0, sizeof(*env));
+	env->file        = file;
+	env->binary      = true;
+	env->strings     = pmap_create();
+	env->string_list = NEW_ARR_F(ident*, 0);
+	env->tarvals     = pmap_create();
+	env->tarval_list = NEW_ARR_F(ir_tarval*, 0);
+	env->index       = NEW_ARR_F(irg_index_entry_t, 0);
+
+	fwrite(bin_magic, 1, sizeof(bin_magic), file);
+	write_sections(env);
+	write_pools(env);
+
+	DEL_ARR_F(env->index);
+	DEL_ARR_F(env->tarval_list);
+	pmap_destroy(env->tarvals);
+	DEL_ARR_F(env->string_list);
+	pmap_destroy(env->strings);
+}
 
 static void read_c(read_env_t *env)
 {
+	if (env->binary) {
+		env->c = env->pos < env->end ? env->data[env->pos++] : EOF;
+		return;
+	}
 	int c = fgetc(env->file);
 	env->c = c;
 	if (c == '\n')
@@ -1150,6 +1661,8 @@ static void read_c(read_env_t *env)
 /** Returns the first non-whitespace character or EOF. **/
 static void skip_ws(read_env_t *env)
 {
+	if (env->binary)
+		return;
 	while (true) {
 		switch (env->c) {
 		case ' ':
@@ -1167,14 +1680,85 @@ static void skip_ws(read_env_t *env)
 
 static void skip_to(read_env_t *env, char to_ch)
 {
+	/* there are no lines to resynchronize on in the binary format */
+	if (env->binary) {
+		env->pos = env->end;
+		env->c   = EOF;
+		return;
+	}
 	while (env->c != to_ch && env->c != EOF) {
 		read_c(env);
 	}
 }
 
+static long bin_read_number(read_env_t *env)
+{
+	uint64_t bits;
+	if (env->c == EOF || env->c > BIN_NUMBER_LONG + 7) {
+		parse_error(env, "Expected number, got token 0x%X\n", (unsigned)env->c);
+		exit(1);
+	} else if (env->c <= BIN_NUMBER_MAX) {
+		bits = env->c;
+	} else {
+		unsigned n_bytes = env->c - BIN_NUMBER_LONG + 1;
+		if (env->end - env->pos < n_bytes) {
+			parse_error(env, "Unexpected end of number\n");
+			exit(1);
+		}
+		bits = 0;
+		for (unsigned i = 0; i < n_bytes; ++i)
+			bits |= (uint64_t)env->data[env->pos++] << (8 * i);
+	}
+	read_c(env);
+	return (long)(bits >> 1) ^ -(long)(bits & 1);
+}
+
+/** Reads a string pool reference, returns NULL for the NULL string. */
+static ident *bin_read_string(read_env_t *env)
+{
+	if (env->c != BIN_STRING) {
+		parse_error(env, "Expected string, got token 0x%X\n", (unsigned)env->c);
+		exit(1);
+	}
+	read_c(env);
+	long index = bin_read_number(env);
+	if (index < 0 || (size_t)index > env->n_strings) {
+		parse_error(env, "Invalid string index %ld\n", index);
+		exit(1);
+	}
+	return index == 0 ? NULL : env->strings[index - 1];
+}
+
+static char *bin_copy_string(read_env_t *env, ident *id)
+{
+	const char *str = get_id_str(id);
+	return (char*)obstack_copy0(&env->obst, str, strlen(str));
+}
+
+/** Returns the binary token of the text format delimiter @p ch. */
+static int bin_token(char ch)
+{
+	switch (ch) {
+	case '[': return BIN_LIST_BEGIN;
+	case ']': return BIN_LIST_END;
+	case '{': return BIN_SCOPE_BEGIN;
+	case '}': return BIN_SCOPE_END;
+	}
+	panic("no binary token for '%c'", ch);
+}
+
 static bool expect_char(read_env_t *env, char ch)
 {
 	skip_ws(env);
+	if (env->binary) {
+		if (env->c != bin_token(ch)) {
+			parse_error(env, "Unexpected token 0x%X, expected '%c'\n",
+			            (unsigned)env->c, ch);
+			return false;
+		}
+		read_c(env);
+		return true;
+	}
 	if (env->c != ch) {
 		parse_error(env, "Unexpected char '%c', expected '%c'\n",
 		            env->c, ch);
@@ -1189,6 +1773,16 @@ static bool expect_char(read_env_t *env, char ch)
 static char *read_word(read_env_t *env)
 {
 	skip_ws(env);
+	if (env->binary) {
+		/* callers parse numbers out of words, so numbers become words */
+		if (env->c == BIN_STRING) {
+			ident *id = bin_read_string(env);
+			return bin_copy_string(env, id != NULL ? id : new_id_from_str("NULL"));
+		}
+		obstack_printf(&env->obst, "%ld", bin_read_number(env));
+		obstack_1grow(&env->obst, '\0');
+		return (char*)obstack_finish(&env->obst);
+	}
 
 	assert(obstack_object_size(&env->obst) == 0);
 	while (true) {
@@ -1216,6 +1810,14 @@ endofword:
 static char *read_string(read_env_t *env)
 {
 	skip_ws(env);
+	if (env->binary) {
+		ident *id = bin_read_string(env);
+		if (id == NULL) {
+			parse_error(env, "Unexpected NULL string\n");
+			exit(1);
+		}
+		return bin_copy_string(env, id);
+	}
 	if (env->c != '"') {
 		parse_error(env, "Expected string, got '%c'\n", env->c);
 		exit(1);
@@ -1276,6 +1878,10 @@ static ident *read_symbol(read_env_t *env)
 static char *read_string_null(read_env_t *env)
 {
 	skip_ws(env);
+	if (env->binary) {
+		ident *id = bin_read_string(env);
+		return id != NULL ? bin_copy_string(env, id) : NULL;
+	}
 	if (env->c == 'N') {
 		char *str = read_word(env);
 		if (strcmp(str, "NULL") == 0) {
@@ -1304,6 +1910,8 @@ static ident *read_ident_null(read_env_t *env)
 static long read_long(read_env_t *env)
 {
 	skip_ws(env);
+	if (env->binary)
+		return bin_read_number(env);
 	if (!isdigit(env->c) && env->c != '-') {
 		parse_error(env, "Expected number, got '%c'\n", env->c);
 		exit(1);
@@ -1342,7 +1950,7 @@ static size_t read_size_t(read_env_t *env)
 static void expect_list_begin(read_env_t *env)
 {
 	skip_ws(env);
-	if (env->c != '[') {
+	if (env->c != (env->binary ? BIN_LIST_BEGIN : '[')) {
 		parse_error(env, "Expected list, got '%c'\n", env->c);
 		exit(1);
 	}
@@ -1351,12 +1959,12 @@ static void expect_list_begin(read_env_t *env)
 
 static bool list_has_next(read_env_t *env)
 {
-	if (feof(env->file)) {
+	if (env->binary ? env->c == EOF : feof(env->file)) {
 		parse_error(env, "Unexpected EOF while reading list");
 		exit(1);
 	}
 	skip_ws(env);
-	if (env->c == ']') {
+	if (env->c == (env->binary ? BIN_LIST_END : ']')) {
 		read_c(env);
 		return false;
 	}
@@ -1364,6 +1972,24 @@ static bool list_has_next(read_env_t *env)
 	return true;
 }
 
+/** Skips the end of a scope, returns true if the scope ended. */
+static bool scope_has_ended(read_env_t *env)
+{
+	skip_ws(env);
+	if (env->c == (env->binary ? BIN_SCOPE_END : '}') || env->c == EOF) {
+		read_c(env);
+		return true;
+	}
+	return false;
+}
+
+/** Reads the number of a node defined or referenced in the file. */
+static long read_node_nr(read_env_t *env)
+{
+	long nr = read_long(env);
+	return env->binary ? env->node_base + nr : nr;
+}
+
 static void *get_id(read_env_t *env, long id)
 {
 	id_entry key;
@@ -1453,15 +2079,23 @@ static ir_entity *read_entity_ref(read_env_t *env)
 	return get_entity(env, nr);
 }
 
-static ir_mode *read_mode_ref(read_env_t *env)
+static ir_mode *find_mode(const char *name)
 {
-	char *str = read_string(env);
 	for (size_t i = 0, n = ir_get_n_modes(); i < n; i++) {
 		ir_mode *mode = ir_get_mode(i);
-		if (strcmp(str, get_mode_name(mode)) == 0) {
-			obstack_free(&env->obst, str);
+		if (strcmp(name, get_mode_name(mode)) == 0)
 			return mode;
-		}
+	}
+	return NULL;
+}
+
+static ir_mode *read_mode_ref(read_env_t *env)
+{
+	char    *str  = read_string(env);
+	ir_mode *mode = find_mode(str);
+	if (mode != NULL) {
+		obstack_free(&env->obst, str);
+		return mode;
 	}
 
 	parse_error(env, "unknown mode \"%s\"\n", str);
@@ -1577,8 +2211,38 @@ static ir_relation read_relation(read_env_t *env)
 	return (ir_relation)read_long(env);
 }
 
+static ir_tarval *bin_read_tarval_ref(read_env_t *env)
+{
+	if (env->c != BIN_TARVAL) {
+		parse_error(env, "Expected tarval, got token 0x%X\n", (unsigned)env->c);
+		exit(1);
+	}
+	read_c(env);
+	long index = bin_read_number(env);
+	if (index < 0 || (size_t)index >= env->n_tarvals) {
+		parse_error(env, "Invalid tarval index %ld\n", index);
+		exit(1);
+	}
+	/* modes are only known after the modes section, so decode lazily */
+	ir_tarval *tv = env->tarvals[index];
+	if (tv == NULL) {
+		ident   *mode_name = env->strings[env->tarval_strs[2 * index] - 1];
+		ident   *value     = env->strings[env->tarval_strs[2 * index + 1] - 1];
+		ir_mode *mode      = find_mode(get_id_str(mode_name));
+		if (mode == NULL) {
+			parse_error(env, "unknown mode \"%s\"\n", get_id_str(mode_name));
+			return get_tarval_bad();
+		}
+		tv = ir_tarval_from_ascii(get_id_str(value), mode);
+		env->tarvals[index] = tv;
+	}
+	return tv;
+}
+
 static ir_tarval *read_tarval_ref(read_env_t *env)
 {
+	if (env->binary)
+		return bin_read_tarval_ref(env);
 	ir_mode   *tvmode = read_mode_ref(env);
 	char      *str    = read_word(env);
 	ir_tarval *tv     = ir_tarval_from_ascii(str, tvmode);
@@ -1607,7 +2271,7 @@ static ir_initializer_t *read_initializer(read_env_t *env)
 
 	switch (ini_kind) {
 	case IR_INITIALIZER_CONST: {
-		long nr = read_long(env);
+		long nr = read_node_nr(env);
 		ir_node *node = get_node_or_null(env, nr);
 		ir_initializer_t *initializer = create_initializer_const(node);
 		if (node == NULL) {
@@ -1871,18 +2535,12 @@ static void read_typegraph(read_env_t *env)
 
 	EXPECT('{');
 
-	env->irg = get_const_code_irg();
+	env->irg       = get_const_code_irg();
+	env->node_base = 0;
 
 	/* parse all types first */
-	while (true) {
-		keyword_t kwkind;
-		skip_ws(env);
-		if (env->c == '}') {
-			read_c(env);
-			break;
-		}
-
-		kwkind = read_keyword(env);
+	while (!scope_has_ended(env)) {
+		keyword_t kwkind = read_keyword(env);
 		switch (kwkind) {
 		case kw_type:
 			read_type(env);
@@ -1930,7 +2588,7 @@ static void read_typegraph(read_env_t *env)
  */
 static ir_node *read_node_ref(read_env_t *env)
 {
-	long     nr   = read_long(env);
+	long     nr   = read_node_nr(env);
 	ir_node *node = get_node_or_null(env, nr);
 	if (node == NULL) {
 		parse_error(env, "node %ld not defined (yet?)\n", nr);
@@ -1957,7 +2615,7 @@ static void read_preds_delayed(read_env_t *env, ir_node *node)
 	obstack_blank(&env->preds_obst, sizeof(delayed_pred_t));
 	int n_preds = 0;
 	while (list_has_next(env)) {
-		long pred_nr = read_long(env);
+		long pred_nr = read_node_nr(env);
 		obstack_grow(&env->preds_obst, &pred_nr, sizeof(pred_nr));
 		++n_preds;
 	}
@@ -2070,8 +2728,9 @@ static ir_node *read_node(read_env_t *env)
 {
 	ident          *id   = read_symbol(env);
 	read_node_func *func = pmap_get(read_node_func, node_readers, id);
-	long            nr   = read_long(env);
+	long            nr   = read_node_nr(env);
 	ir_node        *res;
+	env->node_base = nr;
 	if (func == NULL) {
 		parse_error(env, "Unknown nodetype '%s'", get_id_str(id));
 		skip_to(env, '\n');
@@ -2101,13 +2760,7 @@ static void read_graph(read_env_t *env, ir_graph *irg)
 	env->delayed_preds = NEW_ARR_F(const delayed_pred_t*, 0);
 
 	EXPECT('{');
-	while (true) {
-		skip_ws(env);
-		if (env->c == '}' || env->c == EOF) {
-			read_c(env);
-			break;
-		}
-
+	while (!scope_has_ended(env)) {
 		read_node(env);
 	}
 
@@ -2139,6 +2792,7 @@ next_delayed_pred: ;
 
 static ir_graph *read_irg(read_env_t *env)
 {
+	env->node_base = 0;
 	ir_entity *irgent = get_entity(env, read_long(env));
 	ir_graph  *irg    = new_ir_graph(irgent, 0);
 	ir_type   *frame  = read_type_ref(env);
@@ -2152,16 +2806,8 @@ static void read_modes(read_env_t *env)
 {
 	EXPECT('{');
 
-	while (true) {
-		keyword_t kwkind;
-
-		skip_ws(env);
-		if (env->c == '}' || env->c == EOF) {
-			read_c(env);
-			break;
-		}
-
-		kwkind = read_keyword(env);
+	while (!scope_has_ended(env)) {
+		keyword_t kwkind = read_keyword(env);
 		switch (kwkind) {
 		case kw_int_mode: {
 			const char *name = read_string(env);
@@ -2195,6 +2841,13 @@ static void read_modes(read_env_t *env)
 			               overflow);
 			break;
 		}
+		case kw_vector_mode: {
+			const char *name       = read_string(env);
+			ir_mode    *element    = read_mode_ref(env);
+			unsigned    n_elements = read_long(env);
+			new_vector_mode(name, element, n_elements);
+			break;
+		}
 
 		default:
 			skip_to(env, '\n');
@@ -2207,13 +2860,7 @@ static void read_program(read_env_t *env)
 {
 	EXPECT('{');
 
-	while (true) {
-		skip_ws(env);
-		if (env->c == '}') {
-			read_c(env);
-			break;
-		}
-
+	while (!scope_has_ended(env)) {
 		keyword_t kwkind = read_keyword(env);
 		switch (kwkind) {
 		case kw_segment_type: {
@@ -2247,12 +2894,8 @@ int ir_import(const char *filename)
 	return res;
 }
 
-int ir_import_file(FILE *input, const char *inputname)
+static void init_read_env(read_env_t *env, const char *inputname)
 {
-	read_env_t          myenv;
-	int                 oldoptimize = get_optimize();
-	read_env_t         *env         = &myenv;
-
 	readers_init();
 	symtbl_init();
 
@@ -2262,19 +2905,26 @@ int ir_import_file(FILE *input, const char *inputname)
 	env->idset      = new_set(id_cmp, 128);
 	env->fixedtypes = NEW_ARR_F(ir_type *, 0);
 	env->inputname  = inputname;
-	env->file       = input;
 	env->line       = 1;
 	env->delayed_initializers = NEW_ARR_F(delayed_initializer_t, 0);
+}
 
-	/* read first character */
+/** Skips a graph section, which is read later on demand. */
+static void skip_irg(read_env_t *env)
+{
+	if (env->next_irg >= env->n_index) {
+		parse_error(env, "graph section missing in index\n");
+		exit(1);
+	}
+	irg_index_entry_t *entry  = &env->index[env->next_irg++];
+	ir_entity         *entity = get_entity(env, entry->entity_nr);
+	pmap_insert(env->lazy_irgs, entity, entry);
+	env->pos = entry->end;
 	read_c(env);
+}
 
-	/* if the first line starts with '#', it contains a comment. */
-	if (env->c == '#')
-		skip_to(env, '\n');
-
-	set_optimize(0);
-
+static void read_sections(read_env_t *env)
+{
 	while (true) {
 		keyword_t kw;
 
@@ -2293,12 +2943,16 @@ int ir_import_file(FILE *input, const char *inputname)
 			break;
 
 		case kw_irg:
-			read_irg(env);
+			if (env->lazy_irgs != NULL)
+				skip_irg(env);
+			else
+				read_irg(env);
 			break;
 
 		case kw_constirg: {
 			ir_graph *constirg = get_const_code_irg();
-			long bodyblockid = read_long(env);
+			env->node_base = 0;
+			long bodyblockid = read_node_nr(env);
 			set_id(env, bodyblockid, constirg->current_block);
 			read_graph(env, constirg);
 			break;
@@ -2319,6 +2973,7 @@ int ir_import_file(FILE *input, const char *inputname)
 		set_type_state(env->fixedtypes[i], layout_fixed);
 
 	DEL_ARR_F(env->fixedtypes);
+	env->fixedtypes = NULL;
 
 	/* resolve delayed initializers */
 	for (size_t i = 0, n = ARR_LEN(env->delayed_initializers); i < n; ++i) {
@@ -2335,17 +2990,261 @@ int ir_import_file(FILE *input, const char *inputname)
 	DEL_ARR_F(env->delayed_initializers);
 	env->delayed_initializers = NULL;
 
+	pmap_destroy(node_readers);
+	node_readers = NULL;
+}
+
+static void free_read_env(read_env_t *env)
+{
+	if (env->fixedtypes != NULL)
+		DEL_ARR_F(env->fixedtypes);
+	if (env->delayed_initializers != NULL)
+		DEL_ARR_F(env->delayed_initializers);
 	del_set(env->idset);
+	obstack_free(&env->preds_obst, NULL);
+	obstack_free(&env->obst, NULL);
+}
+
+int ir_import_file(FILE *input, const char *inputname)
+{
+	read_env_t          myenv;
+	int                 oldoptimize = get_optimize();
+	read_env_t         *env         = &myenv;
+
+	init_read_env(env, inputname);
+	env->file = input;
 
+	/* read first character */
+	read_c(env);
+
+	/* if the first line starts with '#', it contains a comment. */
+	if (env->c == '#')
+		skip_to(env, '\n');
+
+	set_optimize(0);
+	read_sections(env);
 	set_optimize(oldoptimize);
 
-	obstack_free(&env->preds_obst, NULL);
-	obstack_free(&env->obst, NULL);
+	free_read_env(env);
+	return env->read_errors;
+}
+
+struct ir_binary_import_t {
+	read_env_t env;
+	size_t     size; /**< size of the mapped file */
+};
+
+#ifdef _WIN32
+static const unsigned char *map_file(const char *filename, size_t *size)
+{
+	FILE *file = fopen(filename, "rb");
+	if (file == NULL) {
+		perror(filename);
+		return NULL;
+	}
+	unsigned char *data = NULL;
+	if (fseek(file, 0, SEEK_END) == 0) {
+		long length = ftell(file);
+		if (length > 0 && fseek(file, 0, SEEK_SET) == 0) {
+			data = XMALLOCN(unsigned char, length);
+			if (fread(data, 1, length, file) != (size_t)length) {
+				free(data);
+				data = NULL;
+			}
+			*size = length;
+		}
+	}
+	if (data == NULL)
+		perror(filename);
+	fclose(file);
+	return data;
+}
+
+static void unmap_file(const unsigned char *data, size_t size)
+{
+	(void)size;
+	free((void*)data);
+}
+#else
+static const unsigned char *map_file(const char *filename, size_t *size)
+{
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		perror(filename);
+		return NULL;
+	}
+	struct stat st;
+	void       *data = MAP_FAILED;
+	if (fstat(fd, &st) == 0 && st.st_size > 0) {
+		*size = st.st_size;
+		data  = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	if (data == MAP_FAILED)
+		perror(filename);
+	close(fd);
+	return data != MAP_FAILED ? (const unsigned char*)data : NULL;
+}
+
+static void unmap_file(const unsigned char *data, size_t size)
+{
+	munmap((void*)data, size);
+}
+#endif
+
+/** Reads the pools and the index at the end of a binary file. */
+static bool read_pools(read_env_t *env, size_t size)
+{
+	if (size < 2 * sizeof(bin_magic)
+	    || memcmp(env->data, bin_magic, sizeof(bin_magic)) != 0) {
+		parse_error(env, "not a binary firm file\n");
+		return false;
+	}
+	uint64_t pool_offset = 0;
+	for (unsigned i = 0; i < 8; ++i)
+		pool_offset |= (uint64_t)env->data[size - 8 + i] << (8 * i);
+	if (pool_offset < sizeof(bin_magic) || pool_offset > size - 8) {
+		parse_error(env, "invalid pool offset\n");
+		return false;
+	}
+
+	env->pos = pool_offset;
+	env->end = size - 8;
+	read_c(env);
+
+	env->n_strings = bin_read_number(env);
+	env->strings   = XMALLOCN(ident*, env->n_strings);
+	for (size_t i = 0; i < env->n_strings; ++i) {
+		size_t      len = bin_read_number(env);
+		const char *str = (const char*)env->data + env->pos - 1;
+		if (len > env->end - (env->pos - 1)) {
+			parse_error(env, "string exceeds the file\n");
+			return false;
+		}
+		env->strings[i] = new_id_from_chars(str, len);
+		env->pos = env->pos - 1 + len;
+		read_c(env);
+	}
+
+	env->n_tarvals   = bin_read_number(env);
+	env->tarval_strs = XMALLOCN(size_t, 2 * env->n_tarvals);
+	env->tarvals     = XMALLOCNZ(ir_tarval*, env->n_tarvals);
+	for (size_t i = 0; i < 2 * env->n_tarvals; ++i) {
+		size_t index = bin_read_number(env);
+		if (index == 0 || index > env->n_strings) {
+			parse_error(env, "invalid tarval string\n");
+			return false;
+		}
+		env->tarval_strs[i] = index;
+	}
+
+	env->n_index = bin_read_number(env);
+	env->index   = XMALLOCN(irg_index_entry_t, env->n_index);
+	for (size_t i = 0; i < env->n_index; ++i) {
+		irg_index_entry_t *entry = &env->index[i];
+		entry->entity_nr = bin_read_number(env);
+		entry->begin     = bin_read_number(env);
+		entry->end       = bin_read_number(env);
+		if (entry->begin > entry->end || entry->end > pool_offset) {
+			parse_error(env, "invalid index entry\n");
+			return false;
+		}
+	}
 
+	/* continue with the sections */
+	env->pos = sizeof(bin_magic);
+	env->end = pool_offset;
+	read_c(env);
+	return !env->read_errors;
+}
+
+static ir_binary_import_t *open_binary(const char *filename, bool lazy)
+{
+	size_t               size;
+	const unsigned char *data = map_file(filename, &size);
+	if (data == NULL)
+		return NULL;
+
+	ir_binary_import_t *import = XMALLOCZ(ir_binary_import_t);
+	read_env_t         *env    = &import->env;
+	init_read_env(env, filename);
+	env->binary    = true;
+	env->data      = data;
+	import->size   = size;
+	if (lazy)
+		env->lazy_irgs = pmap_create();
+
+	if (read_pools(env, size)) {
+		int oldoptimize = get_optimize();
+		set_optimize(0);
+		read_sections(env);
+		set_optimize(oldoptimize);
+	} else {
+		pmap_destroy(node_readers);
+		node_readers = NULL;
+	}
+	return import;
+}
+
+int ir_import_binary(const char *filename)
+{
+	ir_binary_import_t *import = open_binary(filename, false);
+	if (import == NULL)
+		return 1;
+	int res = import->env.read_errors;
+	ir_binary_import_free(import);
+	return res;
+}
+
+ir_binary_import_t *ir_import_binary_lazy(const char *filename)
+{
+	ir_binary_import_t *import = open_binary(filename, true);
+	if (import != NULL && import->env.read_errors) {
+		ir_binary_import_free(import);
+		return NULL;
+	}
+	return import;
+}
+
+ir_graph *ir_binary_import_get_irg(ir_binary_import_t *import,
+                                   ir_entity *entity)
+{
+	read_env_t        *env   = &import->env;
+	irg_index_entry_t *entry = pmap_get(irg_index_entry_t, env->lazy_irgs,
+	                                    entity);
+	if (entry == NULL)
+		return get_entity_irg(entity);
+
+	pmap_insert(env->lazy_irgs, entity, NULL);
+	env->pos = entry->begin;
+	env->end = entry->end;
+	read_c(env);
+
+	int oldoptimize = get_optimize();
+	set_optimize(0);
+	readers_init();
+	ir_graph *irg = NULL;
+	if (read_keyword(env) == kw_irg)
+		irg = read_irg(env);
+	else
+		parse_error(env, "index does not point to a graph\n");
 	pmap_destroy(node_readers);
 	node_readers = NULL;
+	set_optimize(oldoptimize);
+	return irg;
+}
 
-	return env->read_errors;
+void ir_binary_import_free(ir_binary_import_t *import)
+{
+	read_env_t *env = &import->env;
+	if (env->lazy_irgs != NULL)
+		pmap_destroy(env->lazy_irgs);
+	free(env->index);
+	free(env->tarvals);
+	free(env->tarval_strs);
+	free(env->strings);
+	free_read_env(env);
+	unmap_file(env->data, import->size);
+	free(import);
 }
 
 #include "gen_irio.c.inl"
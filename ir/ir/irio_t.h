@@ -0,0 +1,29 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   irio private declarations
+ */
+#ifndef FIRM_IR_IRIO_T_H
+#define FIRM_IR_IRIO_T_H
+
+#include <stdbool.h>
+
+#include "firm_types.h"
+#include "obst.h"
+
+/**
+ * Appends a canonical description of @p irg to @p obst: Graphs with the same
+ * structure, attributes, execution frequencies and referenced entities and
+ * types get the same description, independent of node, entity and type
+ * numbers and of the rest of the program.
+ *
+ * @return false if the graph references objects which cannot be described,
+ *         the description is not usable then.
+ */
+bool ir_write_canonical_irg(struct obstack *obst, ir_graph *irg);
+
+#endif
@@ -34,6 +34,9 @@ static bool modes_are_equal(const ir_mode *m, const ir_mode *n)
 		return false;
 	if (m->sort == irms_auxiliary || m->sort == irms_data)
 		return strcmp(m->name, n->name) == 0;
+	if (m->sort == irms_vector)
+		return m->vector_element    == n->vector_element
+		    && m->vector_n_elements == n->vector_n_elements;
 	return m->arithmetic        == n->arithmetic
 	    && m->size              == n->size
 	    && m->sign              == n->sign
@@ -206,6 +209,22 @@ ir_mode *new_non_arithmetic_mode(const char *name, unsigned bit_size)
 	return register_mode(result);
 }
 
+ir_mode *new_vector_mode(const char *name, ir_mode *element_mode,
+                         unsigned n_elements)
+{
+	if (!mode_is_int(element_mode) && !mode_is_float(element_mode))
+		panic("vector elements must be int or float numbers");
+	if (n_elements < 2)
+		panic("vector modes need at least 2 elements");
+
+	unsigned const bit_size = get_mode_size_bits(element_mode) * n_elements;
+	ir_mode *const result   = alloc_mode(name, irms_vector, irma_none, bit_size,
+	                                     mode_is_signed(element_mode), 0);
+	result->vector_element    = element_mode;
+	result->vector_n_elements = n_elements;
+	return register_mode(result);
+}
+
 static ir_mode *new_non_data_mode(const char *name)
 {
 	ir_mode *result = alloc_mode(name, irms_auxiliary, irma_none, 0, 0, 0);
@@ -310,6 +329,23 @@ int (mode_is_data)(const ir_mode *mode)
 	return mode_is_data_(mode);
 }
 
+int (mode_is_vector)(const ir_mode *mode)
+{
+	return mode_is_vector_(mode);
+}
+
+ir_mode *get_mode_vector_element(const ir_mode *mode)
+{
+	assert(mode_is_vector(mode));
+	return mode->vector_element;
+}
+
+unsigned get_mode_vector_n_elements(const ir_mode *mode)
+{
+	assert(mode_is_vector(mode));
+	return mode->vector_n_elements;
+}
+
 unsigned (get_mode_mantissa_size)(const ir_mode *mode)
 {
 	return get_mode_mantissa_size_(mode);
@@ -358,6 +394,7 @@ int smaller_mode(const ir_mode *sm, const ir_mode *lm)
 
 		case irms_auxiliary:
 		case irms_data:
+		case irms_vector:
 		case irms_internal_boolean:
 		case irms_reference:
 		case irms_float_number:
@@ -373,6 +410,7 @@ int smaller_mode(const ir_mode *sm, const ir_mode *lm)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 	case irms_reference:
 		/* do exist machines out there with different pointer lengths ?*/
@@ -27,6 +27,7 @@
 #define mode_is_reference(mode)        mode_is_reference_(mode)
 #define mode_is_num(mode)              mode_is_num_(mode)
 #define mode_is_data(mode)             mode_is_data_(mode)
+#define mode_is_vector(mode)           mode_is_vector_(mode)
 #define get_type_for_mode(mode)        get_type_for_mode_(mode)
 #define get_mode_mantissa_size(mode)   get_mode_mantissa_size_(mode)
 #define get_mode_exponent_size(mode)   get_mode_exponent_size_(mode)
@@ -93,6 +94,11 @@ static inline int mode_is_data_(const ir_mode *mode)
 	return (get_mode_sort(mode) & irmsh_is_data) != 0;
 }
 
+static inline int mode_is_vector_(const ir_mode *mode)
+{
+	return get_mode_sort(mode) == irms_vector;
+}
+
 static inline ir_type *get_type_for_mode_(const ir_mode *mode)
 {
 	return mode->type;
@@ -27,6 +27,7 @@
 #include "irverify.h"
 
 #include "irhooks.h"
+#include "bitfiddle.h"
 #include "util.h"
 
 #include "beinfo.h"
@@ -80,8 +81,14 @@ ir_node *new_ir_node(dbg_info *db, ir_graph *irg, ir_node *block, ir_op *op,
 {
 	assert(mode != NULL);
 
-	size_t   const node_size = offsetof(ir_node, attr) + op->attr_size;
-	ir_node *const res       = (ir_node*)OALLOCNZ(get_irg_obstack(irg), char, node_size);
+	size_t const node_size = offsetof(ir_node, attr) + op->attr_size;
+	/* the inputs of nodes with fixed arity directly follow the attributes, so
+	 * walking them touches the same cache lines as the node itself */
+	bool   const inline_in = arity >= 0 && op->opar != oparity_dynamic;
+	size_t const in_offset = round_up2(node_size, sizeof(aligned_type));
+	size_t const alloc_size
+		= inline_in ? in_offset + ARR_D_SIZE(ir_node*, arity + 1) : node_size;
+	ir_node *const res = (ir_node*)OALLOCNZ(get_irg_obstack(irg), char, alloc_size);
 
 	res->kind     = k_ir_node;
 	res->op       = op;
@@ -95,10 +102,10 @@ ir_node *new_ir_node(dbg_info *db, ir_graph *irg, ir_node *block, ir_op *op,
 		res->in = NEW_ARR_F(ir_node *, 1);  /* 1: space for block */
 	} else {
 		/* Nodes with dynamic arity must always have a flexible array. */
-		if (op->opar == oparity_dynamic)
-			res->in = NEW_ARR_F(ir_node *, (arity+1));
+		if (inline_in)
+			res->in = INIT_ARR_D(ir_node*, (char*)res + in_offset, arity + 1);
 		else
-			res->in = NEW_ARR_D(ir_node*, get_irg_obstack(irg), arity + 1);
+			res->in = NEW_ARR_F(ir_node *, (arity+1));
 		MEMCPY(&res->in[1], in, arity);
 	}
 
@@ -153,6 +160,9 @@ void set_irn_in(ir_node *const node, int const arity, ir_node *const *const in)
 	}
 #endif
 
+	/* Call the hook */
+	hook_set_irn_in(node);
+
 	ir_graph  *irg     = get_irn_irg(node);
 	ir_node ***pOld_in = &node->in;
 	int        i;
@@ -949,6 +949,10 @@ static ir_tarval *computed_value_Proj(const ir_node *proj)
  */
 ir_tarval *computed_value(const ir_node *n)
 {
+	/* there are no constants of vector modes */
+	if (mode_is_vector(get_irn_mode(n)))
+		return tarval_unknown;
+
 	const vrp_attr *vrp = vrp_get_info(n);
 	if (vrp != NULL && vrp->bits_set == vrp->bits_not_set)
 		return vrp->bits_set;
@@ -1346,6 +1350,23 @@ static ir_node *equivalent_node_Bitcast(ir_node *n)
 	return n;
 }
 
+/**
+ * Checks whether @p value is defined in a reachable block which strictly
+ * dominates the block of @p phi, so folding the Phi cannot create a cycle.
+ */
+static bool value_dominates_phi(ir_node const *value, ir_node const *phi)
+{
+	ir_graph *const irg = get_irn_irg(phi);
+	if (!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE))
+		return false;
+	ir_node *const phi_block   = get_nodes_block(phi);
+	ir_node *const value_block = get_nodes_block(value);
+	return value_block != phi_block
+	    && get_Block_dom_depth(phi_block) > 0
+	    && get_Block_dom_depth(value_block) >= 0
+	    && block_dominates(value_block, phi_block);
+}
+
 /**
  * - fold Phi-nodes, iff they have only one predecessor except
  *   themselves.
@@ -1362,12 +1383,19 @@ static ir_node *equivalent_node_Phi(ir_node *n)
 		return n;
 
 	/* Determine whether the Phi is trivial, i.e. it only references itself and
-	 * one other value. */
+	 * one other value. While unreachable code is optimized, Bad operands
+	 * belong to removed control flow and are ignored as well. */
+	ir_graph *const irg = get_irn_irg(n);
+	bool const skip_bad
+		= irg_is_constrained(irg, IR_GRAPH_CONSTRAINT_OPTIMIZE_UNREACHABLE_CODE);
 	bool     had_self_loop = false;
 	ir_node *first_val     = NULL;
+	ir_node *bad           = NULL;
 	foreach_irn_in(n, i, pred) {
 		if (pred == n) {
 			had_self_loop = true;
+		} else if (skip_bad && is_Bad(pred)) {
+			bad = pred;
 		} else if (pred != first_val) {
 			/* more than 1 unique value found? abort */
 			if (first_val)
@@ -1376,6 +1404,12 @@ static ir_node *equivalent_node_Phi(ir_node *n)
 			first_val = pred;
 		}
 	}
+	if (first_val == NULL) {
+		first_val = bad;
+	} else if (bad != NULL && !value_dominates_phi(first_val, n)) {
+		/* In dead loops the remaining operand may depend on the Phi. */
+		return n;
+	}
 
 	/* if we are here then all inputs are either self-loops or first_val */
 	if (is_Dummy(first_val))
@@ -1679,6 +1713,10 @@ static ir_node *equivalent_node_Confirm(ir_node *n)
  */
 ir_node *equivalent_node(ir_node *n)
 {
+	/* the local optimizations do not know about vector modes */
+	if (mode_is_vector(get_irn_mode(n)) && !is_Phi(n))
+		return n;
+
 	if (n->op->ops.equivalent_node)
 		return n->op->ops.equivalent_node(n);
 	return n;
@@ -7550,6 +7588,10 @@ static ir_node *transform_node_Store(ir_node *n)
  */
 static ir_node *transform_node(ir_node *n)
 {
+	/* the local optimizations do not know about vector modes */
+	if (mode_is_vector(get_irn_mode(n)))
+		return n;
+
 restart:;
 	ir_node  *old_n = n;
 	unsigned  iro   = get_irn_opcode_(n);
@@ -7766,17 +7808,31 @@ unsigned ir_node_hash(const ir_node *node)
 	return node->op->ops.hash(node);
 }
 
+static unsigned identities_hash(const void *node)
+{
+	return ir_node_hash((const ir_node*)node);
+}
+
+static int identities_equal(const void *elt, const void *key)
+{
+	return !identities_cmp(elt, key);
+}
+
 void new_identities(ir_graph *irg)
 {
-	if (irg->value_table != NULL)
-		del_pset(irg->value_table);
-	irg->value_table = new_pset(identities_cmp, N_IR_NODES);
+	del_identities(irg);
+	irg->value_table = XMALLOC(cpset_t);
+	cpset_init_size(irg->value_table, identities_hash, identities_equal,
+	                N_IR_NODES);
 }
 
 void del_identities(ir_graph *irg)
 {
-	if (irg->value_table != NULL)
-		del_pset(irg->value_table);
+	if (irg->value_table != NULL) {
+		cpset_destroy(irg->value_table);
+		free(irg->value_table);
+		irg->value_table = NULL;
+	}
 }
 
 static int cmp_node_nr(const void *a, const void *b)
@@ -7832,14 +7888,14 @@ void ir_normalize_node(ir_node *n)
 ir_node *identify_remember(ir_node *n)
 {
 	ir_graph *irg         = get_irn_irg(n);
-	pset     *value_table = irg->value_table;
+	cpset_t  *value_table = irg->value_table;
 
 	if (value_table == NULL)
 		return n;
 
 	ir_normalize_node(n);
 	/* lookup or insert in hash table with given hash key. */
-	ir_node *nn = (ir_node *)pset_insert(value_table, n, ir_node_hash(n));
+	ir_node *nn = (ir_node *)cpset_insert(value_table, n);
 
 	if (nn != n) {
 		/* n is reachable again */
@@ -7880,7 +7936,9 @@ void add_identities(ir_node *node)
 
 void visit_all_identities(ir_graph *irg, irg_walk_func visit, void *env)
 {
-	foreach_pset(irg->value_table, ir_node, node) {
+	cpset_iterator_t iter;
+	ir_node         *node;
+	foreach_cpset(irg->value_table, ir_node*, node, iter) {
 		visit(node, env);
 	}
 }
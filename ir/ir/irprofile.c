@@ -8,9 +8,23 @@
  * @brief       Code instrumentation and execution count profiling.
  * @author      Adam M. Szalkowski, Steven Schaefer
  * @date        06.04.2006, 11.11.2010
+ *
+ * In block mode every block gets its own counter. In edge mode only the
+ * control flow edges which are not part of a maximum spanning tree of the
+ * (estimated) control flow graph get a counter, the counts of the tree edges
+ * and of all blocks are reconstructed from flow conservation when the
+ * profile is read (see Ball, Larus: "Optimally Profiling and Tracing
+ * Programs").
+ *
+ * Counters are 64 bits wide and stored as pairs of 32 bit words (low word
+ * first), so instrumented code does not depend on 64 bit arithmetic support
+ * in the backend.
  */
+#include <inttypes.h>
+#include <math.h>
 
 #include "util.h"
+#include "array.h"
 #include "debug.h"
 #include "execfreq_t.h"
 #include "hashptr.h"
@@ -21,21 +35,57 @@
 #include "irnode_t.h"
 #include "irprofile.h"
 #include "irprog_t.h"
+#include "irtools.h"
 #include "obst.h"
+#include "pmap.h"
 #include "set.h"
 #include "typerep.h"
+#include "unionfind.h"
 #include "xmalloc.h"
 
-/* Instrument blocks walker. */
-typedef struct block_id_walker_data_t {
-	unsigned int  id;       /**< current block id number */
-	ir_node      *counters; /**< the node representing the counter array */
-} block_id_walker_data_t;
+/** Marks edges without a counter. */
+#define NO_COUNTER ((unsigned)-1)
+
+/** A control flow edge of the graph used for edge profiling. */
+typedef struct profile_edge_t {
+	unsigned src;     /**< vertex number of the source block */
+	unsigned dst;     /**< vertex number of the destination block */
+	int      pos;     /**< predecessor position in dst, -1 for virtual edges */
+	double   weight;  /**< estimated execution frequency */
+	unsigned counter; /**< counter number or NO_COUNTER */
+	bool     in_tree; /**< edge is part of the spanning tree */
+	bool     known;   /**< count is known (used while reading) */
+	int64_t  count;   /**< execution count (used while reading) */
+} profile_edge_t;
+
+/**
+ * The control flow graph of an ir_graph used for edge profiling. Besides the
+ * real edges it contains a virtual edge from the end block to the start
+ * block and virtual edges from blocks without successors to the end block,
+ * so flow is conserved in every vertex.
+ */
+typedef struct profile_cfg_t {
+	ir_graph       *irg;
+	ir_node       **blocks;     /**< blocks indexed by vertex number */
+	unsigned       *vertex;     /**< vertex numbers indexed by node index */
+	unsigned       *n_preds;    /**< number of real in edges per vertex */
+	unsigned       *n_succs;    /**< number of real out edges per vertex */
+	profile_edge_t *edges;      /**< all edges */
+	unsigned        n_counters; /**< number of counters of this graph */
+	unsigned        base;       /**< number of the first counter */
+} profile_cfg_t;
+
+/** Environment for connecting the memory of the instrumentation code. */
+typedef struct mem_env_t {
+	ir_graph  *irg;
+	pmap      *phis;     /**< memory Phis of join blocks */
+	ir_node  **new_phis; /**< memory Phis whose operands are not set yet */
+} mem_env_t;
 
 /* Associate counters with blocks. */
 typedef struct block_assoc_t {
-	unsigned int i;          /**< current block id number */
-	unsigned int *counters;  /**< block execution counts */
+	unsigned int    i;        /**< current block id number */
+	const uint64_t *counters; /**< block execution counts */
 } block_assoc_t;
 
 /* minimal execution frequency (an execfreq of 0 confuses algos) */
@@ -53,11 +103,13 @@ DEBUG_ONLY(static firm_dbg_module_t *dbg;)
 /**
  * Since the backend creates a new firm graph we cannot associate counts with
  * blocks directly. Instead we associate them with the block ids, which are
- * maintained.
+ * maintained. Edges are identified by the id of their destination block and
+ * the predecessor position.
  */
 typedef struct execcount_t {
 	unsigned long block; /**< block id */
-	uint32_t      count; /**< execution count */
+	int           pos;   /**< predecessor position, -1 for the block itself */
+	uint64_t      count; /**< execution count */
 } execcount_t;
 
 /**
@@ -68,14 +120,40 @@ static int cmp_execcount(const void *a, const void *b, size_t size)
 	const execcount_t *ea = (const execcount_t*)a;
 	const execcount_t *eb = (const execcount_t*)b;
 	(void)size;
-	return ea->block != eb->block;
+	return ea->block != eb->block || ea->pos != eb->pos;
+}
+
+static unsigned hash_execcount(const execcount_t *ec)
+{
+	return hash_combine(ec->block, ec->pos);
+}
+
+static void insert_execcount(const ir_node *block, int pos, uint64_t count)
+{
+	execcount_t const query = {
+		.block = get_irn_node_nr(block),
+		.pos   = pos,
+		.count = count,
+	};
+	(void)set_insert(execcount_t, profile, &query, sizeof(query), hash_execcount(&query));
+}
+
+static execcount_t *find_execcount(const ir_node *block, int pos)
+{
+	if (profile == NULL)
+		return NULL;
+	execcount_t const query = { .block = get_irn_node_nr(block), .pos = pos };
+	return set_find(execcount_t, profile, &query, sizeof(query), hash_execcount(&query));
 }
 
-uint32_t ir_profile_get_block_execcount(const ir_node *block)
+bool ir_profile_has_data(void)
 {
-	execcount_t  const query = { .block = get_irn_node_nr(block), .count = 0 };
-	execcount_t *const ec    = set_find(execcount_t, profile, &query, sizeof(query), query.block);
+	return profile != NULL;
+}
 
+uint64_t ir_profile_get_block_execcount(const ir_node *block)
+{
+	execcount_t *const ec = find_execcount(block, -1);
 	if (ec != NULL) {
 		return ec->count;
 	} else {
@@ -84,6 +162,15 @@ uint32_t ir_profile_get_block_execcount(const ir_node *block)
 	}
 }
 
+bool ir_profile_get_edge_execcount(const ir_node *block, int pos, uint64_t *count)
+{
+	execcount_t *const ec = find_execcount(block, pos);
+	if (ec == NULL)
+		return false;
+	*count = ec->count;
+	return true;
+}
+
 /**
  * Block walker, count number of blocks.
  */
@@ -121,9 +208,166 @@ static void dump_profile_node_info(void *ctx, FILE *f, const ir_node *irn)
 {
 	(void)ctx;
 	if (is_Block(irn)) {
-		unsigned int execcount = ir_profile_get_block_execcount(irn);
-		fprintf(f, "profiled execution count: %u\n", execcount);
+		uint64_t const execcount = ir_profile_get_block_execcount(irn);
+		fprintf(f, "profiled execution count: %" PRIu64 "\n", execcount);
+	}
+}
+
+static void collect_block(ir_node *block, void *data)
+{
+	profile_cfg_t *const cfg = (profile_cfg_t*)data;
+	cfg->vertex[get_irn_idx(block)] = ARR_LEN(cfg->blocks);
+	ARR_APP1(ir_node*, cfg->blocks, block);
+}
+
+static void add_edge(profile_cfg_t *cfg, unsigned src, unsigned dst, int pos)
+{
+	profile_edge_t const edge = {
+		.src     = src,
+		.dst     = dst,
+		.pos     = pos,
+		.weight  = HUGE_VAL,
+		.counter = NO_COUNTER,
+	};
+	ARR_APP1(profile_edge_t, cfg->edges, edge);
+}
+
+/**
+ * Returns true if a counter for the given edge can be placed somewhere.
+ * There is no room for code on edges into the end block whose source block
+ * has several successors.
+ */
+static bool is_instrumentable(const profile_cfg_t *cfg, const profile_edge_t *edge)
+{
+	if (edge->pos < 0)
+		return false;
+	ir_node *const dst = cfg->blocks[edge->dst];
+	return dst != get_irg_end_block(cfg->irg) || cfg->n_succs[edge->src] == 1;
+}
+
+typedef struct edge_order_t {
+	double   weight;
+	unsigned idx;
+} edge_order_t;
+
+/**
+ * Orders edges by descending weight, ties are broken by the edge number so
+ * the result is the same in every compiler run.
+ */
+static int cmp_edge_order(const void *a, const void *b)
+{
+	const edge_order_t *ea = (const edge_order_t*)a;
+	const edge_order_t *eb = (const edge_order_t*)b;
+	if (ea->weight != eb->weight)
+		return ea->weight < eb->weight ? 1 : -1;
+	return (ea->idx > eb->idx) - (ea->idx < eb->idx);
+}
+
+/**
+ * Computes a maximum spanning tree of the control flow graph (Kruskal) and
+ * assigns counters to the instrumentable edges not in the tree. Edges which
+ * must not get a counter have infinite weight, so they are preferred for
+ * the tree.
+ */
+static void compute_spanning_tree(profile_cfg_t *cfg)
+{
+	size_t const n_blocks = ARR_LEN(cfg->blocks);
+	size_t const n_edges  = ARR_LEN(cfg->edges);
+
+	edge_order_t *const order = XMALLOCN(edge_order_t, n_edges);
+	for (size_t i = 0; i < n_edges; ++i) {
+		order[i].weight = cfg->edges[i].weight;
+		order[i].idx    = i;
+	}
+	QSORT(order, n_edges, cmp_edge_order);
+
+	int *const uf = XMALLOCN(int, n_blocks);
+	uf_init(uf, n_blocks);
+	for (size_t i = 0; i < n_edges; ++i) {
+		profile_edge_t *const edge = &cfg->edges[order[i].idx];
+		int const src = uf_find(uf, edge->src);
+		int const dst = uf_find(uf, edge->dst);
+		if (src != dst) {
+			uf_union(uf, src, dst);
+			edge->in_tree = true;
+		}
+	}
+	free(uf);
+	free(order);
+
+	/* The edges without room for a counter always fit into the tree: They
+	 * are the virtual edges, which form a star around the end block, and
+	 * real edges into the end block. The verifier only allows Return and
+	 * Raise there, which end a block with a single successor. */
+	cfg->n_counters = 0;
+	for (size_t i = 0; i < n_edges; ++i) {
+		profile_edge_t *const edge = &cfg->edges[i];
+		if (!edge->in_tree) {
+			assert(is_instrumentable(cfg, edge));
+			edge->counter = cfg->n_counters++;
+		}
+	}
+}
+
+/**
+ * Builds the control flow graph for edge profiling. This has to produce the
+ * same graph when instrumenting and when reading the profile, so it only
+ * depends on the graph and the (deterministic) frequency estimation.
+ */
+static void build_cfg(profile_cfg_t *cfg, ir_graph *irg)
+{
+	/* also removes Bads and unreachable code */
+	ir_estimate_execfreq(irg);
+
+	cfg->irg    = irg;
+	cfg->blocks = NEW_ARR_F(ir_node*, 0);
+	cfg->edges  = NEW_ARR_F(profile_edge_t, 0);
+	cfg->vertex = XMALLOCN(unsigned, get_irg_last_idx(irg));
+	irg_block_walk_graph(irg, collect_block, NULL, cfg);
+
+	size_t const n_blocks = ARR_LEN(cfg->blocks);
+	cfg->n_preds = XMALLOCNZ(unsigned, n_blocks);
+	cfg->n_succs = XMALLOCNZ(unsigned, n_blocks);
+	for (size_t v = 0; v < n_blocks; ++v) {
+		ir_node *const block = cfg->blocks[v];
+		for (int pos = 0, arity = get_Block_n_cfgpreds(block); pos < arity; ++pos) {
+			ir_node *const pred = get_Block_cfgpred_block(block, pos);
+			if (pred == NULL)
+				continue;
+			unsigned const src = cfg->vertex[get_irn_idx(pred)];
+			add_edge(cfg, src, v, pos);
+			++cfg->n_succs[src];
+			++cfg->n_preds[v];
+		}
+	}
+
+	unsigned const start = cfg->vertex[get_irn_idx(get_irg_start_block(irg))];
+	unsigned const end   = cfg->vertex[get_irn_idx(get_irg_end_block(irg))];
+	add_edge(cfg, end, start, -1);
+	for (size_t v = 0; v < n_blocks; ++v) {
+		if (v != end && cfg->n_succs[v] == 0)
+			add_edge(cfg, v, end, -1);
+	}
+
+	for (size_t i = 0, n = ARR_LEN(cfg->edges); i < n; ++i) {
+		profile_edge_t *const edge = &cfg->edges[i];
+		if (!is_instrumentable(cfg, edge))
+			continue;
+		double const src_freq = get_block_execfreq(cfg->blocks[edge->src]);
+		double const dst_freq = get_block_execfreq(cfg->blocks[edge->dst]);
+		edge->weight = MIN(src_freq, dst_freq);
 	}
+
+	compute_spanning_tree(cfg);
+}
+
+static void free_cfg(profile_cfg_t *cfg)
+{
+	DEL_ARR_F(cfg->edges);
+	DEL_ARR_F(cfg->blocks);
+	free(cfg->n_succs);
+	free(cfg->n_preds);
+	free(cfg->vertex);
 }
 
 /**
@@ -175,10 +419,10 @@ static ir_entity *get_init_firmprof_ref(void)
  * Pseudocode:
  *    static void __firmprof_initializer(void) __attribute__ ((constructor))
  *    {
- *        __init_firmprof(ent_filename, bblock_counts, n_blocks);
+ *        __init_firmprof(ent_filename, counters, n_counters);
  *    }
  */
-static ir_graph *gen_initializer_irg(ir_entity *ent_filename, ir_entity *bblock_counts, int n_blocks)
+static ir_graph *gen_initializer_irg(ir_entity *ent_filename, ir_entity *counter_array, unsigned n_counters)
 {
 	ident     *const name = new_id_from_str("__firmprof_initializer");
 	ir_entity *const ent  = new_entity(get_glob_type(), name, new_type_method(0, 0));
@@ -195,8 +439,8 @@ static ir_graph *gen_initializer_irg(ir_entity *ent_filename, ir_entity *bblock_
 	ir_entity *const init_ent  = get_init_firmprof_ref();
 	ir_node   *const callee    = new_r_Address(irg, init_ent);
 	ir_node   *const filename  = new_r_Address(irg, ent_filename);
-	ir_node   *const counters  = new_r_Address(irg, bblock_counts);
-	ir_node   *const size      = new_r_Const_long(irg, mode_Iu, n_blocks);
+	ir_node   *const counters  = new_r_Address(irg, counter_array);
+	ir_node   *const size      = new_r_Const_long(irg, mode_Iu, n_counters);
 	ir_node   *const ins[]     = { filename, counters, size };
 	ir_type   *const call_type = get_entity_type(init_ent);
 	ir_node   *const call      = new_r_Call(bb, init_mem, callee, ARRAY_SIZE(ins), ins, call_type);
@@ -211,107 +455,138 @@ static ir_graph *gen_initializer_irg(ir_entity *ent_filename, ir_entity *bblock_
 }
 
 /**
- * Instrument a block with code needed for profiling.
- * This just inserts the instruction nodes, it doesn't connect the memory
- * nodes in a meaningful way.
+ * Inserts code incrementing counter @p id into block @p bb.
+ * This just inserts the instruction nodes, the memory input of the first
+ * Load of the block is connected by connect_memory(). The block link points
+ * to the memory Proj of the last Store in the block, whose link in turn
+ * points to the first Load.
  */
-static void instrument_block(ir_node *const bb, ir_node *const address, unsigned int const id)
+static void instrument_counter(ir_node *const bb, ir_node *const address, unsigned const id)
 {
-	ir_graph *const irg = get_irn_irg(bb);
-
-	/* We can't instrument the end block */
-	if (bb == get_irg_end_block(irg))
-		return;
-
-	ir_type *const type_Iu = get_entity_type(get_irn_entity_attr(address));
-	ir_node *const unknown = new_r_Unknown(irg, mode_M);
-	ir_node *const cnst    = new_r_Const_long(irg, mode_Iu, get_mode_size_bytes(mode_Iu) * id);
-	ir_node *const offset  = new_r_Add(bb, address, cnst, mode_P);
-	ir_node *const load    = new_r_Load(bb, unknown, offset, mode_Iu, type_Iu, cons_none);
-	ir_node *const lmem    = new_r_Proj(load, mode_M, pn_Load_M);
-	ir_node *const proji   = new_r_Proj(load, mode_Iu, pn_Load_res);
-	ir_node *const one     = new_r_Const_one(irg, mode_Iu);
-	ir_node *const add     = new_r_Add(bb, proji, one, mode_Iu);
-	ir_node *const store   = new_r_Store(bb, lmem, offset, add, type_Iu, cons_none);
-	ir_node *const smem    = new_r_Proj(store, mode_M, pn_Store_M);
+	ir_graph *const irg     = get_irn_irg(bb);
+	ir_type  *const arr     = get_entity_type(get_Address_entity(address));
+	ir_type  *const type_Iu = get_array_element_type(arr);
+	unsigned  const size    = get_mode_size_bytes(mode_Iu);
+	ir_node  *const prev    = (ir_node*)get_irn_link(bb);
+	ir_node  *const mem     = prev != NULL ? prev : new_r_Unknown(irg, mode_M);
+
+	ir_node *const lo_cnst  = new_r_Const_long(irg, mode_Iu, 2 * size * id);
+	ir_node *const hi_cnst  = new_r_Const_long(irg, mode_Iu, 2 * size * id + size);
+	ir_node *const lo_addr  = new_r_Add(bb, address, lo_cnst, mode_P);
+	ir_node *const hi_addr  = new_r_Add(bb, address, hi_cnst, mode_P);
+	ir_node *const lo_load  = new_r_Load(bb, mem, lo_addr, mode_Iu, type_Iu, cons_none);
+	ir_node *const lo_lmem  = new_r_Proj(lo_load, mode_M, pn_Load_M);
+	ir_node *const lo       = new_r_Proj(lo_load, mode_Iu, pn_Load_res);
+	ir_node *const hi_load  = new_r_Load(bb, lo_lmem, hi_addr, mode_Iu, type_Iu, cons_none);
+	ir_node *const hi_lmem  = new_r_Proj(hi_load, mode_M, pn_Load_M);
+	ir_node *const hi       = new_r_Proj(hi_load, mode_Iu, pn_Load_res);
+
+	/* carry = (lo + 1 == 0), computed without Cmp/Mux as
+	 * ((x | -x) >> 31) ^ 1 */
+	ir_node *const one      = new_r_Const_one(irg, mode_Iu);
+	ir_node *const lo_inc   = new_r_Add(bb, lo, one, mode_Iu);
+	ir_node *const neg      = new_r_Minus(bb, lo_inc, mode_Iu);
+	ir_node *const either   = new_r_Or(bb, lo_inc, neg, mode_Iu);
+	ir_node *const shift    = new_r_Const_long(irg, mode_Iu, get_mode_size_bits(mode_Iu) - 1);
+	ir_node *const nonzero  = new_r_Shr(bb, either, shift, mode_Iu);
+	ir_node *const carry    = new_r_Eor(bb, nonzero, one, mode_Iu);
+	ir_node *const hi_inc   = new_r_Add(bb, hi, carry, mode_Iu);
+
+	ir_node *const lo_store = new_r_Store(bb, hi_lmem, lo_addr, lo_inc, type_Iu, cons_none);
+	ir_node *const lo_smem  = new_r_Proj(lo_store, mode_M, pn_Store_M);
+	ir_node *const hi_store = new_r_Store(bb, lo_smem, hi_addr, hi_inc, type_Iu, cons_none);
+	ir_node *const smem     = new_r_Proj(hi_store, mode_M, pn_Store_M);
 
 	set_irn_link(bb, smem);
-	set_irn_link(smem, load);
+	set_irn_link(smem, prev != NULL ? get_irn_link(prev) : lo_load);
 }
 
+static ir_node *get_in_mem(mem_env_t *env, ir_node *bb);
+
 /**
- * SSA Construction for instrumentation code memory.
- *
- * This introduces a new memory node and connects it to the instrumentation
- * codes, inserting phiM nodes as necessary. Note that afterwards, the new
- * memory is not connected to any return nodes and thus still dead.
+ * Returns the instrumentation memory at the end of block @p bb.
  */
-static void fix_ssa(ir_node *const bb, void *const data)
+static ir_node *get_out_mem(mem_env_t *env, ir_node *bb)
 {
-	(void)data;
-
-	ir_graph *const irg = get_irn_irg(bb);
-
-	/* end blocks are not instrumented, skip! */
-	if (bb == get_irg_end_block(irg))
-		return;
-
-	ir_node  *mem;
-	int const arity = get_Block_n_cfgpreds(bb);
-	if (bb == get_irg_start_block(irg)) {
-		mem = get_irg_initial_mem(irg);
-	} else if (arity == 1) {
-		ir_node *const pred = get_Block_cfgpred_block(bb, 0);
-		mem = pred ? (ir_node*)get_irn_link(pred) : new_r_NoMem(irg);
-	} else {
-		ir_node **ins = ALLOCAN(ir_node*, arity);
-		for (int n = arity; n-- != 0;) {
-			ir_node *const pred = get_Block_cfgpred_block(bb, n);
-			ins[n] = pred ? (ir_node*)get_irn_link(pred) : new_r_NoMem(irg);
-		}
-		mem = new_r_Phi(bb, arity, ins, mode_M);
-	}
-
-	/* The block link fields point to the projm from the instrumentation code,
-	 * the projm in turn links to the initial load which lacks a memory
-	 * argument at this point. */
-	ir_node *const proj = (ir_node*)get_irn_link(bb);
-	ir_node *const load = (ir_node*)get_irn_link(proj);
-	set_Load_mem(load, mem);
+	ir_node *const mem = (ir_node*)get_irn_link(bb);
+	return mem != NULL ? mem : get_in_mem(env, bb);
 }
 
 /**
- * Instrument a single block.
+ * Returns the instrumentation memory at the beginning of block @p bb,
+ * creating memory Phis in join blocks as necessary.
  */
-static void block_instrument_walker(ir_node *bb, void *data)
+static ir_node *get_in_mem(mem_env_t *env, ir_node *bb)
 {
-	block_id_walker_data_t *wd = (block_id_walker_data_t*)data;
-	instrument_block(bb, wd->counters, wd->id);
-	++wd->id;
+	ir_graph *const irg = env->irg;
+	for (;;) {
+		if (bb == get_irg_start_block(irg))
+			return get_irg_initial_mem(irg);
+
+		int const arity = get_Block_n_cfgpreds(bb);
+		if (arity == 1) {
+			ir_node *const pred = get_Block_cfgpred_block(bb, 0);
+			if (pred == NULL)
+				return new_r_NoMem(irg);
+			ir_node *const mem = (ir_node*)get_irn_link(pred);
+			if (mem != NULL)
+				return mem;
+			/* uninstrumented single predecessor, look further up */
+			bb = pred;
+			continue;
+		} else if (arity == 0) {
+			return new_r_NoMem(irg);
+		}
+
+		ir_node *phi = pmap_get(ir_node, env->phis, bb);
+		if (phi == NULL) {
+			/* operands are set later, Dummies keep the Phi from being
+			 * optimized away */
+			ir_node **const ins = ALLOCAN(ir_node*, arity);
+			for (int i = 0; i < arity; ++i)
+				ins[i] = new_r_Dummy(irg, mode_M);
+			phi = new_r_Phi(bb, arity, ins, mode_M);
+			pmap_insert(env->phis, bb, phi);
+			ARR_APP1(ir_node*, env->new_phis, phi);
+		}
+		return phi;
+	}
 }
 
 /**
  * Synchronize the original memory input of node with the additional operand
  * from the profiling code.
  */
-static ir_node *sync_mem(ir_node *bb, ir_node *mem)
+static ir_node *sync_mem(mem_env_t *env, ir_node *bb, ir_node *mem)
 {
-	ir_node *const ins[] = { (ir_node*)get_irn_link(bb), mem };
+	ir_node *const prof_mem = get_out_mem(env, bb);
+	if (prof_mem == get_irg_initial_mem(env->irg))
+		return mem;
+	ir_node *const ins[] = { prof_mem, mem };
 	return new_r_Sync(bb, ARRAY_SIZE(ins), ins);
 }
 
 /**
- * Instrument a single ir_graph, counters should point to the bblock
- * counters array.
+ * SSA Construction for instrumentation code memory.
+ *
+ * This connects the instrumentation code of the given blocks with a new
+ * memory chain, inserting phiM nodes as necessary, and synchronizes it with
+ * the memory of all nodes leaving the function.
  */
-static void instrument_irg(ir_graph *irg, ir_entity *counters, block_id_walker_data_t *wd)
+static void connect_memory(ir_graph *irg, ir_node *const *instrumented)
 {
-	/* generate a node pointing to the count array */
-	wd->counters = new_r_Address(irg, counters);
+	mem_env_t env = {
+		.irg      = irg,
+		.phis     = pmap_create(),
+		.new_phis = NEW_ARR_F(ir_node*, 0),
+	};
 
-	/* instrument each block in the current irg */
-	irg_block_walk_graph(irg, block_instrument_walker, NULL, wd);
-	irg_block_walk_graph(irg, fix_ssa, NULL, NULL);
+	for (size_t i = 0, n = ARR_LEN(instrumented); i < n; ++i) {
+		ir_node *const bb   = instrumented[i];
+		ir_node *const proj = (ir_node*)get_irn_link(bb);
+		ir_node *const load = (ir_node*)get_irn_link(proj);
+		set_Load_mem(load, get_in_mem(&env, bb));
+	}
 
 	/* connect the new memory nodes to the return nodes */
 	ir_node *const endbb = get_irg_end_block(irg);
@@ -325,11 +600,11 @@ static void instrument_irg(ir_graph *irg, ir_entity *counters, block_id_walker_d
 		switch (get_irn_opcode(node)) {
 		case iro_Return:
 			mem = get_Return_mem(node);
-			set_Return_mem(node, sync_mem(bb, mem));
+			set_Return_mem(node, sync_mem(&env, bb, mem));
 			break;
 		case iro_Raise:
 			mem = get_Raise_mem(node);
-			set_Raise_mem(node, sync_mem(bb, mem));
+			set_Raise_mem(node, sync_mem(&env, bb, mem));
 			break;
 		case iro_Bad:
 			break;
@@ -347,9 +622,131 @@ static void instrument_irg(ir_graph *irg, ir_entity *counters, block_id_walker_d
 		if (is_Call(node)) {
 			ir_node *const bb  = get_nodes_block(node);
 			ir_node *const mem = get_Call_mem(node);
-			set_Call_mem(node, sync_mem(bb, mem));
+			set_Call_mem(node, sync_mem(&env, bb, mem));
+		}
+	}
+
+	/* connect the memory Phis, this may create further Phis */
+	while (ARR_LEN(env.new_phis) > 0) {
+		size_t   const last = ARR_LEN(env.new_phis) - 1;
+		ir_node *const phi  = env.new_phis[last];
+		ARR_SHRINKLEN(env.new_phis, last);
+		ir_node *const bb   = get_nodes_block(phi);
+		for (int i = 0, n = get_Phi_n_preds(phi); i < n; ++i) {
+			ir_node *const pred = get_Block_cfgpred_block(bb, i);
+			ir_node *const mem  = pred != NULL ? get_out_mem(&env, pred) : new_r_NoMem(irg);
+			set_Phi_pred(phi, i, mem);
+		}
+		/* counters in endless loops never reach a Return */
+		keep_alive(phi);
+	}
+
+	DEL_ARR_F(env.new_phis);
+	pmap_destroy(env.phis);
+}
+
+/* Instrument blocks walker. */
+typedef struct block_id_walker_data_t {
+	unsigned int   id;           /**< current block id number */
+	ir_node       *counters;     /**< the node representing the counter array */
+	ir_node      **instrumented; /**< the instrumented blocks */
+} block_id_walker_data_t;
+
+/**
+ * Instrument a single block.
+ */
+static void block_instrument_walker(ir_node *bb, void *data)
+{
+	block_id_walker_data_t *wd = (block_id_walker_data_t*)data;
+	/* We can't instrument the end block */
+	if (bb != get_irg_end_block(get_irn_irg(bb))) {
+		instrument_counter(bb, wd->counters, wd->id);
+		ARR_APP1(ir_node*, wd->instrumented, bb);
+	}
+	++wd->id;
+}
+
+/**
+ * Instrument every block of a single ir_graph, counters should point to the
+ * counters array.
+ */
+static void instrument_irg_blocks(ir_graph *irg, ir_entity *counters, unsigned *id)
+{
+	block_id_walker_data_t wd = {
+		.id           = *id,
+		.counters     = new_r_Address(irg, counters),
+		.instrumented = NEW_ARR_F(ir_node*, 0),
+	};
+
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+	irg_block_walk_graph(irg, firm_clear_link, NULL, NULL);
+	irg_block_walk_graph(irg, block_instrument_walker, NULL, &wd);
+	connect_memory(irg, wd.instrumented);
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+
+	DEL_ARR_F(wd.instrumented);
+	*id = wd.id;
+}
+
+/**
+ * Splits the control flow edge to predecessor @p pos of @p block and returns
+ * the new block.
+ */
+static ir_node *split_edge(ir_node *block, int pos)
+{
+	ir_graph *const irg   = get_irn_irg(block);
+	ir_node  *const pred  = get_Block_cfgpred(block, pos);
+	ir_node  *const split = new_r_Block(irg, 1, &pred);
+	ir_node  *const jmp   = new_r_Jmp(split);
+	set_Block_cfgpred(block, pos, jmp);
+	return split;
+}
+
+/**
+ * Instrument the non-tree edges of a single ir_graph, counters should point
+ * to the counters array.
+ */
+static void instrument_irg_edges(profile_cfg_t *cfg, ir_entity *counters)
+{
+	ir_graph *const irg     = cfg->irg;
+	ir_node  *const address = new_r_Address(irg, counters);
+	ir_node  *const end     = get_irg_end_block(irg);
+
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+	irg_block_walk_graph(irg, firm_clear_link, NULL, NULL);
+
+	ir_node **instrumented = NEW_ARR_F(ir_node*, 0);
+	for (size_t i = 0, n = ARR_LEN(cfg->edges); i < n; ++i) {
+		profile_edge_t const *const edge = &cfg->edges[i];
+		if (edge->counter == NO_COUNTER)
+			continue;
+
+		/* Place the counter in a block executed exactly when the edge is
+		 * taken. Splitting an edge does not change these decisions for the
+		 * other edges, as both of its ends have several edges. */
+		ir_node *const dst = cfg->blocks[edge->dst];
+		ir_node       *bb;
+		if (dst != end && cfg->n_preds[edge->dst] == 1) {
+			bb = dst;
+		} else if (cfg->n_succs[edge->src] == 1) {
+			bb = cfg->blocks[edge->src];
+		} else {
+			bb = split_edge(dst, edge->pos);
 		}
+
+		if (get_irn_link(bb) == NULL)
+			ARR_APP1(ir_node*, instrumented, bb);
+		instrument_counter(bb, address, cfg->base + edge->counter);
 	}
+
+	connect_memory(irg, instrumented);
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+	DEL_ARR_F(instrumented);
+
+	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
+	                        | IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
+	                        | IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+	                        | IR_GRAPH_PROPERTY_CONSISTENT_OUTS);
 }
 
 /**
@@ -408,37 +805,69 @@ static ir_entity *new_static_string_entity(ident *name, const char *string)
 	return result;
 }
 
-ir_graph *ir_profile_instrument(const char *filename)
+/**
+ * Builds the edge profiling graphs of all irgs, in the order used for
+ * numbering the counters. Returns the total number of counters.
+ */
+static unsigned build_irp_cfgs(profile_cfg_t *cfgs)
+{
+	unsigned n_counters = 0;
+	size_t   n          = 0;
+	foreach_irp_irg_r(i, irg) {
+		profile_cfg_t *const cfg = &cfgs[n++];
+		build_cfg(cfg, irg);
+		cfg->base   = n_counters;
+		n_counters += cfg->n_counters;
+	}
+	return n_counters;
+}
+
+ir_graph *ir_profile_instrument(const char *filename, ir_profile_mode_t mode)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.ir.profile");
 
 	/* Don't do anything for modules without code. Else the linker will
 	 * complain. */
-	if (get_irp_n_irgs() == 0)
+	size_t const n_irgs = get_irp_n_irgs();
+	if (n_irgs == 0)
 		return NULL;
 
-	/* count the number of block first */
-	unsigned const n_blocks = get_irp_n_blocks();
+	profile_cfg_t *cfgs = NULL;
+	unsigned       n_counters;
+	if (mode == ir_profile_edges) {
+		cfgs       = XMALLOCNZ(profile_cfg_t, n_irgs);
+		n_counters = build_irp_cfgs(cfgs);
+	} else {
+		n_counters = get_irp_n_blocks();
+	}
+	DB((dbg, LEVEL_1, "instrumenting with %u counters\n", n_counters));
 
 	/* create all the necessary types and entities. Note that the
 	 * types must have a fixed layout, because we are already running in the
 	 * backend */
-	ident     *const counter_id    = new_id_from_str("__FIRMPROF__BLOCK_COUNTS");
-	ir_entity *const bblock_counts = new_array_entity(counter_id, n_blocks);
+	ident     *const counter_id = new_id_from_str("__FIRMPROF__BLOCK_COUNTS");
+	ir_entity *const counters   = new_array_entity(counter_id, 2 * n_counters);
 
 	ident     *const filename_id  = new_id_from_str("__FIRMPROF__FILE_NAME");
 	ir_entity *const ent_filename = new_static_string_entity(filename_id, filename);
 
-	/* initialize block id array and instrument blocks */
-	block_id_walker_data_t wd = { .id = 0 };
-	foreach_irp_irg_r(i, irg) {
-		instrument_irg(irg, bblock_counts, &wd);
+	if (mode == ir_profile_edges) {
+		for (size_t i = 0; i < n_irgs; ++i) {
+			instrument_irg_edges(&cfgs[i], counters);
+			free_cfg(&cfgs[i]);
+		}
+		free(cfgs);
+	} else {
+		unsigned id = 0;
+		foreach_irp_irg_r(i, irg) {
+			instrument_irg_blocks(irg, counters, &id);
+		}
 	}
 
-	return gen_initializer_irg(ent_filename, bblock_counts, n_blocks);
+	return gen_initializer_irg(ent_filename, counters, n_counters);
 }
 
-static unsigned int *parse_profile(const char *filename, unsigned int num_blocks)
+static uint64_t *parse_profile(const char *filename, unsigned n_counters)
 {
 	FILE *const f = fopen(filename, "rb");
 	if (!f) {
@@ -447,7 +876,7 @@ static unsigned int *parse_profile(const char *filename, unsigned int num_blocks
 	}
 
 	/* check header */
-	uint32_t *result = NULL;
+	uint64_t *result = NULL;
 	char      buf[8];
 	size_t    ret = fread(buf, 8, 1, f);
 	if (ret == 0 || strncmp(buf, "firmprof", 8) != 0) {
@@ -455,22 +884,28 @@ static unsigned int *parse_profile(const char *filename, unsigned int num_blocks
 		goto end;
 	}
 
-	result = XMALLOCN(unsigned int, num_blocks);
+	result = XMALLOCN(uint64_t, n_counters);
 
-	/* The profiling output format is defined to be a sequence of integer
-	 * values stored little endian format. */
-	for (unsigned i = 0; i < num_blocks; ++i) {
-		unsigned char bytes[4];
-		if ((ret = fread(bytes, 1, 4, f)) < 1)
+	/* The profiling output format is defined to be a sequence of 64 bit
+	 * integer values stored in little endian format. */
+	bool ok = true;
+	for (unsigned i = 0; i < n_counters; ++i) {
+		unsigned char bytes[8];
+		if (fread(bytes, 1, 8, f) != 8) {
+			ok = false;
 			break;
+		}
 
-		result[i] = (bytes[0] <<  0) | (bytes[1] <<  8)
-		          | (bytes[2] << 16) | (bytes[3] << 24);
+		uint64_t value = 0;
+		for (unsigned b = 8; b-- > 0;)
+			value = value << 8 | bytes[b];
+		result[i] = value;
 	}
 
-	if (ret < 1) {
-		DBG((dbg, LEVEL_4, "Failed to read counters... (size: %u)\n",
-			sizeof(unsigned int) * num_blocks));
+	/* a different number of counters means the program changed */
+	if (!ok || fgetc(f) != EOF) {
+		DBG((dbg, LEVEL_2, "Profile does not match the program (%u counters)\n",
+		     n_counters));
 		free(result);
 		result = NULL;
 	}
@@ -486,12 +921,9 @@ end:
 static void block_associate_walker(ir_node *bb, void *env)
 {
 	block_assoc_t *b = (block_assoc_t*)env;
-	execcount_t query;
-
-	query.block = get_irn_node_nr(bb);
-	query.count = b->counters[b->i++];
-	DBG((dbg, LEVEL_4, "execcount(%+F, %u): %u\n", bb, query.block, query.count));
-	(void)set_insert(execcount_t, profile, &query, sizeof(query), query.block);
+	uint64_t const count = b->counters[b->i++];
+	DBG((dbg, LEVEL_4, "execcount(%+F): %" PRIu64 "\n", bb, count));
+	insert_execcount(bb, -1, count);
 }
 
 static void irp_associate_blocks(block_assoc_t *env)
@@ -501,6 +933,107 @@ static void irp_associate_blocks(block_assoc_t *env)
 	}
 }
 
+/**
+ * Reconstructs the counts of all edges and blocks of a graph from the
+ * counters of the non-tree edges and stores them in the profile. Every
+ * vertex of the spanning tree with a single unknown edge determines the
+ * count of that edge by flow conservation.
+ */
+static void associate_edges(profile_cfg_t *cfg, const uint64_t *counters)
+{
+	size_t const n_blocks = ARR_LEN(cfg->blocks);
+	size_t const n_edges  = ARR_LEN(cfg->edges);
+
+	/* known incoming minus known outgoing flow */
+	int64_t  *const flow      = XMALLOCNZ(int64_t, n_blocks);
+	unsigned *const n_unknown = XMALLOCNZ(unsigned, n_blocks);
+	/* tree edges incident to each vertex */
+	unsigned *const adj_begin = XMALLOCNZ(unsigned, n_blocks + 1);
+	for (size_t i = 0; i < n_edges; ++i) {
+		profile_edge_t *const edge = &cfg->edges[i];
+		if (edge->in_tree) {
+			++n_unknown[edge->src];
+			++n_unknown[edge->dst];
+		} else {
+			assert(edge->counter != NO_COUNTER);
+			edge->known = true;
+			edge->count = counters[cfg->base + edge->counter];
+			flow[edge->src] -= edge->count;
+			flow[edge->dst] += edge->count;
+		}
+	}
+	for (size_t v = 0; v < n_blocks; ++v)
+		adj_begin[v + 1] = adj_begin[v] + n_unknown[v];
+	unsigned *const adj  = XMALLOCN(unsigned, adj_begin[n_blocks]);
+	unsigned *const fill = XMALLOCN(unsigned, n_blocks);
+	memcpy(fill, adj_begin, n_blocks * sizeof(*fill));
+	for (size_t i = 0; i < n_edges; ++i) {
+		profile_edge_t const *const edge = &cfg->edges[i];
+		if (edge->in_tree) {
+			adj[fill[edge->src]++] = i;
+			adj[fill[edge->dst]++] = i;
+		}
+	}
+	free(fill);
+
+	unsigned *worklist = NEW_ARR_F(unsigned, 0);
+	for (size_t v = 0; v < n_blocks; ++v) {
+		if (n_unknown[v] == 1)
+			ARR_APP1(unsigned, worklist, v);
+	}
+	while (ARR_LEN(worklist) > 0) {
+		size_t   const last = ARR_LEN(worklist) - 1;
+		unsigned const v    = worklist[last];
+		ARR_SHRINKLEN(worklist, last);
+		if (n_unknown[v] != 1)
+			continue;
+
+		profile_edge_t *edge = NULL;
+		for (unsigned a = adj_begin[v]; a < adj_begin[v + 1]; ++a) {
+			edge = &cfg->edges[adj[a]];
+			if (!edge->known)
+				break;
+		}
+		assert(edge != NULL && !edge->known);
+
+		edge->known = true;
+		edge->count = edge->dst == v ? -flow[v] : flow[v];
+		flow[edge->src] -= edge->count;
+		flow[edge->dst] += edge->count;
+		unsigned const other = edge->dst == v ? edge->src : edge->dst;
+		--n_unknown[v];
+		if (--n_unknown[other] == 1)
+			ARR_APP1(unsigned, worklist, other);
+	}
+	DEL_ARR_F(worklist);
+	free(adj);
+	free(adj_begin);
+	free(n_unknown);
+	free(flow);
+
+	/* a block is executed as often as its incoming edges are taken (the
+	 * start block has the virtual edge from the end block) */
+	int64_t *const block_counts = XMALLOCNZ(int64_t, n_blocks);
+	for (size_t i = 0; i < n_edges; ++i) {
+		profile_edge_t const *const edge = &cfg->edges[i];
+		assert(edge->known);
+		block_counts[edge->dst] += edge->count;
+		if (edge->pos >= 0) {
+			ir_node *const dst   = cfg->blocks[edge->dst];
+			uint64_t const count = edge->count > 0 ? (uint64_t)edge->count : 0;
+			DBG((dbg, LEVEL_4, "execcount(%+F, %d): %" PRIu64 "\n", dst, edge->pos, count));
+			insert_execcount(dst, edge->pos, count);
+		}
+	}
+	for (size_t v = 0; v < n_blocks; ++v) {
+		ir_node *const block = cfg->blocks[v];
+		uint64_t const count = block_counts[v] > 0 ? (uint64_t)block_counts[v] : 0;
+		DBG((dbg, LEVEL_4, "execcount(%+F): %" PRIu64 "\n", block, count));
+		insert_execcount(block, -1, count);
+	}
+	free(block_counts);
+}
+
 void ir_profile_free(void)
 {
 	if (profile) {
@@ -514,23 +1047,41 @@ void ir_profile_free(void)
 	}
 }
 
-bool ir_profile_read(const char *filename)
+bool ir_profile_read(const char *filename, ir_profile_mode_t mode)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.ir.profile");
 
-	unsigned n_blocks = get_irp_n_blocks();
-	block_assoc_t env = {
-		.i        = 0,
-		.counters = parse_profile(filename, n_blocks)
-	};
-	if (!env.counters)
-		return false;
+	size_t const   n_irgs = get_irp_n_irgs();
+	profile_cfg_t *cfgs   = NULL;
+	unsigned       n_counters;
+	if (mode == ir_profile_edges) {
+		cfgs       = XMALLOCNZ(profile_cfg_t, n_irgs);
+		n_counters = build_irp_cfgs(cfgs);
+	} else {
+		n_counters = get_irp_n_blocks();
+	}
+
+	uint64_t *const counters = parse_profile(filename, n_counters);
+	if (counters != NULL) {
+		ir_profile_free();
+		profile = new_set(cmp_execcount, 16);
+	}
 
-	ir_profile_free();
-	profile = new_set(cmp_execcount, 16);
+	if (mode == ir_profile_edges) {
+		for (size_t i = 0; i < n_irgs; ++i) {
+			if (counters != NULL)
+				associate_edges(&cfgs[i], counters);
+			free_cfg(&cfgs[i]);
+		}
+		free(cfgs);
+	} else if (counters != NULL) {
+		block_assoc_t env = { .i = 0, .counters = counters };
+		irp_associate_blocks(&env);
+	}
 
-	irp_associate_blocks(&env);
-	free(env.counters);
+	if (counters == NULL)
+		return false;
+	free(counters);
 
 	/* register the vcg hook */
 	hook = dump_add_node_info_callback(dump_profile_node_info, NULL);
@@ -557,13 +1108,25 @@ static void initialize_execfreq(ir_node *block, void *data)
 	}
 
 	set_block_execfreq(block, freq);
+
+	/* Remember the profiled branch probabilities, so later re-estimations of
+	 * the frequencies do not fall back to heuristics. */
+	for (int pos = 0, arity = get_Block_n_cfgpreds(block); pos < arity; ++pos) {
+		ir_node *const pred = get_Block_cfgpred_block(block, pos);
+		uint64_t       count;
+		if (pred == NULL || !ir_profile_get_edge_execcount(block, pos, &count))
+			continue;
+		uint64_t const pred_count = ir_profile_get_block_execcount(pred);
+		if (pred_count > 0)
+			set_block_cf_probability(block, pos, (double)count / pred_count);
+	}
 }
 
 static void ir_set_execfreqs_from_profile(ir_graph *irg)
 {
 	/* Find the first block containing instructions */
 	ir_node *const start_block = get_irg_start_block(irg);
-	unsigned const count       = ir_profile_get_block_execcount(start_block);
+	uint64_t const count       = ir_profile_get_block_execcount(start_block);
 	if (count == 0) {
 		/* the function was never executed, so fallback to estimated freqs */
 		ir_estimate_execfreq(irg);
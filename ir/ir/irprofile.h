@@ -18,30 +18,52 @@
 #include "firm_types.h"
 #include "irnode.h"
 
+/**
+ * Kinds of profiling instrumentation.
+ */
+typedef enum ir_profile_mode_t {
+	ir_profile_blocks, /**< one counter per basic block */
+	ir_profile_edges,  /**< counters on the control flow edges outside of a
+	                        spanning tree, counts of all blocks and edges are
+	                        reconstructed when reading the profile */
+} ir_profile_mode_t;
+
 /**
  * Instruments all irgs in the program with profile code.
- * The final code will have a counter for each basic block which is
- * incremented in that block. After the program has run the info is written
- * to @p filename.
+ * Depending on @p mode the final code will have a counter for each basic
+ * block or for a minimal set of control flow edges. After the program has
+ * run the info is written to @p filename.
  */
-ir_graph *ir_profile_instrument(const char *filename);
+ir_graph *ir_profile_instrument(const char *filename, ir_profile_mode_t mode);
 
 /**
  * Reads the corresponding profile info file if it exists and returns a
  * profile info struct
  * @param filename The name of the file containing profile information
+ * @param mode     The mode the program was instrumented with
  */
-bool ir_profile_read(const char *filename);
+bool ir_profile_read(const char *filename, ir_profile_mode_t mode);
 
 /**
  * Frees the profile info
  */
 void ir_profile_free(void);
 
+/**
+ * Returns true if profile data has been read.
+ */
+bool ir_profile_has_data(void);
+
 /**
  * Get block execution count as determined be profiling
  */
-uint32_t ir_profile_get_block_execcount(const ir_node *block);
+uint64_t ir_profile_get_block_execcount(const ir_node *block);
+
+/**
+ * Get the execution count of the control flow edge to predecessor @p pos of
+ * @p block as determined by edge profiling. Returns false if unknown.
+ */
+bool ir_profile_get_edge_execcount(const ir_node *block, int pos, uint64_t *count);
 
 /**
  * Initializes exec_freq structure for an irg based on profile data
@@ -25,6 +25,7 @@
 #include "bitset.h"
 
 #include "pset.h"
+#include "cpset.h"
 #include "pmap.h"
 #include "list.h"
 #include "obst.h"
@@ -104,6 +105,9 @@ typedef enum ir_mode_sort {
 	/** A mode to represent float numbers.
 	    Floating point computations can be performed. */
 	irms_float_number     = 5 | irmsh_is_data | irmsh_is_num,
+	/** A mode to represent a vector of int or float numbers.
+	    Computations are performed element-wise. */
+	irms_vector           = 6 | irmsh_is_data,
 } ir_mode_sort;
 
 /**
@@ -161,6 +165,8 @@ struct ir_mode {
 	ir_tarval         *all_one;     /**< the value ~0 */
 	ir_tarval         *infinity;    /**< the infinity value */
 	ir_mode           *eq_unsigned; /**< For pointer modes, the equivalent unsigned integer one. */
+	ir_mode           *vector_element;    /**< For vector modes, the mode of the elements. */
+	unsigned           vector_n_elements; /**< For vector modes, the number of elements. */
 };
 
 /* note: we use "long" here because that is the type used for Proj-Numbers */
@@ -191,8 +197,12 @@ typedef struct block_attr {
 	ir_dom_info pdom;           /**< Datastructure that holds information about post-dominators. */
 	bitset_t *backedge;         /**< Bitfield n set to true if pred n is backedge.*/
 	ir_entity *entity;          /**< entity representing this block */
+	ir_loop  *loop;             /**< the loop the block is in */
 	ir_node  *phis;             /**< The list of Phi nodes in this block. */
 	double    execfreq;         /**< block execution frequency */
+	double   *cf_probabilities; /**< profiled probabilities of the incoming
+	                                 control flow edges, NULL if unknown */
+	int       n_cf_probabilities; /**< number of entries in cf_probabilities */
 } block_attr;
 
 /** Attributes for Cond nodes. */
@@ -388,6 +398,9 @@ typedef struct ir_def_use_edges {
 /**
  * The common structure of an irnode.
  * If the node has some attributes, they are stored in the attr field.
+ * The inputs of nodes with fixed arity are allocated behind the attributes.
+ * Analysis information only needed by few passes, like the out edges, is
+ * kept in tables of the graph indexed by the node index.
  */
 struct ir_node {
 	/* ------- Basics of the representation  ------- */
@@ -402,15 +415,8 @@ struct ir_node {
 	                              used during optimization to link to nodes that
 	                              shall replace a node. */
 	long node_nr;            /**< A globally unique node number for each node. */
-	/* ------- Fields for optimizations / analysis information ------- */
-	union {
-		ir_def_use_edges *out;    /**< array of def-use edges. */
-		unsigned          n_outs; /**< number of def-use edges (temporarily used
-		                               during construction of datastructure ) */
-	} o;
 	dbg_info *dbi;           /**< A pointer to information for debug support. */
 	/* ------- For analyses -------- */
-	ir_loop *loop;           /**< the loop the node is in. Access routines in irloop.h */
 	void            *backend_info;
 	irn_edges_info_t edge_info;  /**< Everlasting out edges. */
 
@@ -495,19 +501,25 @@ struct ir_graph {
 
 	/* -- Fields for optimizations / analysis information -- */
 	/** Hash table for global value numbering (cse) */
-	pset               *value_table;
+	cpset_t            *value_table;
 	struct obstack      out_obst;    /**< Space for the Def-Use arrays. */
 	bool                out_obst_allocated;
+	ir_def_use_edges  **outs;        /**< Def-Use arrays per node index. */
 	ir_bitinfo          bitinfo;     /**< bit info */
 	ir_vrp_info         vrp;         /**< vrp info */
 	ir_loop            *loop;        /**< The outermost loop for this graph. */
 	ir_dom_front_info_t domfront;    /**< dominance frontier analysis data */
+	bool                dom_tree_nums_outdated; /**< dominator tree pre orders
+	                                                 need to be renumbered */
 	irg_edges_info_t    edge_info;   /**< edge info for automatic outs */
 	ir_graph          **callers;     /**< Callgraph: list of callers. */
 	unsigned           *caller_isbe; /**< Callgraph: bitset if backedge info calculated. */
 	cg_callee_entry   **callees;     /**< Callgraph: list of callee calls */
 	unsigned           *callee_isbe; /**< Callgraph: bitset if backedge info calculated. */
 	ir_loop            *l;           /**< For callgraph analysis. */
+	unsigned           *points_to;   /**< points-to variable per node index */
+	unsigned            n_points_to; /**< length of points_to */
+	struct ir_alias_cache *alias_cache; /**< cached alias queries */
 
 #ifdef DEBUG_libfirm
 	/** Unique graph number for each graph to make output readable. */
@@ -646,11 +646,21 @@ static int verify_node_Call(const ir_node *n)
 	return fine;
 }
 
+static int mode_is_num_or_vector(const ir_mode *mode)
+{
+	return mode_is_num(mode) || mode_is_vector(mode);
+}
+
+static int mode_is_int_vector(const ir_mode *mode)
+{
+	return mode_is_vector(mode) && mode_is_int(get_mode_vector_element(mode));
+}
+
 static int verify_node_Add(const ir_node *n)
 {
 	bool     fine = true;
 	ir_mode *mode = get_irn_mode(n);
-	if (mode_is_num(mode)) {
+	if (mode_is_num_or_vector(mode)) {
 		fine &= check_mode_same_input(n, n_Add_left, "left");
 		fine &= check_mode_same_input(n, n_Add_right, "right");
 	} else if (mode_is_reference(mode)) {
@@ -675,7 +685,10 @@ static int verify_node_Sub(const ir_node *n)
 {
 	bool     fine = true;
 	ir_mode *mode = get_irn_mode(n);
-	if (mode_is_num(mode)) {
+	if (mode_is_vector(mode)) {
+		fine &= check_mode_same_input(n, n_Sub_left, "left");
+		fine &= check_mode_same_input(n, n_Sub_right, "right");
+	} else if (mode_is_num(mode)) {
 		ir_mode *mode_left = get_irn_mode(get_Sub_left(n));
 		if (mode_is_reference(mode_left)) {
 			fine &= check_input_func(n, n_Sub_left, "left", mode_is_reference, "reference");
@@ -702,7 +715,7 @@ static int verify_node_Minus(const ir_node *n)
 
 static int verify_node_Mul(const ir_node *n)
 {
-	bool fine = check_mode_func(n, mode_is_num, "numeric");
+	bool fine = check_mode_func(n, mode_is_num_or_vector, "numeric or vector");
 	fine &= check_mode_same_input(n, n_Mul_left, "left");
 	fine &= check_mode_same_input(n, n_Mul_right, "right");
 	return fine;
@@ -749,9 +762,15 @@ static int mode_is_intb(const ir_mode *mode)
 	return mode_is_int(mode) || mode == mode_b;
 }
 
+static int mode_is_intb_or_int_vector(const ir_mode *mode)
+{
+	return mode_is_intb(mode) || mode_is_int_vector(mode);
+}
+
 static int verify_node_And(const ir_node *n)
 {
-	bool fine = check_mode_func(n, mode_is_intb, "int or mode_b");
+	bool fine = check_mode_func(n, mode_is_intb_or_int_vector,
+	                            "int, mode_b or int vector");
 	fine &= check_mode_same_input(n, n_And_left, "left");
 	fine &= check_mode_same_input(n, n_And_right, "right");
 	return fine;
@@ -759,7 +778,8 @@ static int verify_node_And(const ir_node *n)
 
 static int verify_node_Or(const ir_node *n)
 {
-	bool fine = check_mode_func(n, mode_is_intb, "int or mode_b");
+	bool fine = check_mode_func(n, mode_is_intb_or_int_vector,
+	                            "int, mode_b or int vector");
 	fine &= check_mode_same_input(n, n_Or_left, "left");
 	fine &= check_mode_same_input(n, n_Or_right, "right");
 	return fine;
@@ -767,7 +787,8 @@ static int verify_node_Or(const ir_node *n)
 
 static int verify_node_Eor(const ir_node *n)
 {
-	bool fine = check_mode_func(n, mode_is_intb, "int or mode_b");
+	bool fine = check_mode_func(n, mode_is_intb_or_int_vector,
+	                            "int, mode_b or int vector");
 	fine &= check_mode_same_input(n, n_Eor_left, "left");
 	fine &= check_mode_same_input(n, n_Eor_right, "right");
 	return fine;
@@ -853,6 +874,17 @@ static int verify_node_Bitcast(const ir_node *n)
 	return fine;
 }
 
+static int verify_node_Broadcast(const ir_node *n)
+{
+	bool fine = check_mode_func(n, mode_is_vector, "vector");
+	ir_mode *mode = get_irn_mode(n);
+	if (fine) {
+		fine &= check_input_mode(n, n_Broadcast_op, "op",
+		                         get_mode_vector_element(mode));
+	}
+	return fine;
+}
+
 static int mode_is_dataMb(const ir_mode *mode)
 {
 	return mode_is_data(mode) || mode == mode_M;
@@ -1333,6 +1365,7 @@ void ir_register_verify_node_ops(void)
 	set_op_verify(op_And,      verify_node_And);
 	set_op_verify(op_Bitcast,  verify_node_Bitcast);
 	set_op_verify(op_Block,    verify_node_Block);
+	set_op_verify(op_Broadcast, verify_node_Broadcast);
 	set_op_verify(op_Call,     verify_node_Call);
 	set_op_verify(op_Cmp,      verify_node_Cmp);
 	set_op_verify(op_Cond,     verify_node_Cond);
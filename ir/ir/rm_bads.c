@@ -13,6 +13,7 @@
 #include <assert.h>
 
 #include "irnode_t.h"
+#include "timing_t.h"
 
 #include "irgopt.h"
 #include "irgmod.h"
@@ -105,6 +106,8 @@ static void collect(ir_node *node, void *env)
 
 void remove_bads(ir_graph *irg)
 {
+	IR_PASS_TIMING("remove_bads", irg);
+
 	/* A block with only Bad predecessors would violate
 	 * the invariant that each block has at least one predecessor. */
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE);
@@ -12,6 +12,7 @@
 #include "irgmod.h"
 #include "irgwalk.h"
 #include "irgopt.h"
+#include "timing_t.h"
 
 /** Transforms:
  *    a
@@ -41,6 +42,8 @@ static void exchange_tuple_projs(ir_node *node, void *env)
 
 void remove_tuples(ir_graph *irg)
 {
+	IR_PASS_TIMING("remove_tuples", irg);
+
 	bool changed = false;
 	irg_walk_graph(irg, exchange_tuple_projs, NULL, &changed);
 
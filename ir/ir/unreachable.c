@@ -11,6 +11,7 @@
  * after that the unreachable code should be dead.
  */
 #include "irgopt.h"
+#include "timing_t.h"
 
 #include <stdbool.h>
 
@@ -96,6 +97,8 @@ static bool remove_unreachable_keeps(ir_graph *irg)
 
 void remove_unreachable_code(ir_graph *irg)
 {
+	IR_PASS_TIMING("remove_unreachable_code", irg);
+
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
 	                         | IR_GRAPH_PROPERTY_NO_TUPLES);
 
@@ -423,6 +423,31 @@ char *lc_opt_value_to_string(char *buf, size_t len, const lc_opt_entry_t *ent)
 	return buf;
 }
 
+static void lc_opt_visit_values_rec(const lc_opt_entry_t *grp,
+                                    const char *prefix,
+                                    lc_opt_value_visitor_t *visit, void *env)
+{
+	const lc_grp_special_t *s = lc_get_grp_special(grp);
+	char name[256];
+	char value[256];
+	list_for_each_entry(lc_opt_entry_t, e, &s->opts, list) {
+		snprintf(name, sizeof(name), "%s%s", prefix, e->name);
+		value[0] = '\0';
+		lc_opt_value_to_string(value, sizeof(value), e);
+		visit(name, value, env);
+	}
+	list_for_each_entry(lc_opt_entry_t, e, &s->grps, list) {
+		snprintf(name, sizeof(name), "%s%s.", prefix, e->name);
+		lc_opt_visit_values_rec(e, name, visit, env);
+	}
+}
+
+void lc_opt_visit_values(const lc_opt_entry_t *grp,
+                         lc_opt_value_visitor_t *visit, void *env)
+{
+	lc_opt_visit_values_rec(grp, "", visit, env);
+}
+
 static char *lc_opt_values_to_string(char *buf, size_t len,
                                      const lc_opt_entry_t *ent)
 {
@@ -201,6 +201,16 @@ bool lc_opt_occurs(lc_opt_entry_t *opt, const char *value);
  */
 char *lc_opt_value_to_string(char *buf, size_t len, const lc_opt_entry_t *ent);
 
+typedef void (lc_opt_value_visitor_t)(const char *name, const char *value,
+                                      void *env);
+
+/**
+ * Call @p visit with the name (relative to @p grp) and the string
+ * representation of the value of every option in @p grp and its subgroups.
+ */
+void lc_opt_visit_values(const lc_opt_entry_t *grp,
+                         lc_opt_value_visitor_t *visit, void *env);
+
 /**
  * Get the name of the type of an option.
  * @param ent The option.
@@ -262,6 +262,12 @@ static int std_emit(lc_appendable_t *app, const lc_arg_occ_t *occ, const lc_arg_
 			int len = MAX(128, occ->width + 1);
 			char *buf = XMALLOCN(char, len);
 			res = dispatch_snprintf(buf, len, fmt, occ->lc_arg_type, val);
+			if (res >= len) {
+				/* %f of a large double has hundreds of digits */
+				len = res + 1;
+				buf = XREALLOC(buf, char, len);
+				res = dispatch_snprintf(buf, len, fmt, occ->lc_arg_type, val);
+			}
 			assert(res < len);
 			lc_appendable_snadd(app, buf, res);
 			free(buf);
@@ -14,6 +14,7 @@
 #include "ircons.h"
 #include "irgmod.h"
 #include "irnodeset.h"
+#include "timing_t.h"
 
 static unsigned po2_stack_alignment;
 
@@ -69,6 +70,8 @@ void lower_alloc(ir_graph *irg, unsigned new_po2_stack_alignment)
 	if (new_po2_stack_alignment == 0)
 		return;
 
+	IR_PASS_TIMING("lower_alloc", irg);
+
 	po2_stack_alignment = new_po2_stack_alignment;
 	bool changed = false;
 	irg_walk_graph(irg, NULL, lower_node, &changed);
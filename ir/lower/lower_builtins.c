@@ -9,6 +9,7 @@
  * @author  Matthias Braun
  */
 #include "lower_builtins.h"
+#include "timing_t.h"
 #include <stdbool.h>
 #include <stdlib.h>
 #include "adt/pmap.h"
@@ -161,6 +162,8 @@ changed:
 
 void lower_builtins(size_t n_exceptions, ir_builtin_kind *exceptions)
 {
+	IR_PASS_TIMING("lower_builtins", NULL);
+
 	memset(dont_lower, 0, sizeof(dont_lower));
 	for (size_t i = 0; i < n_exceptions; ++i) {
 		dont_lower[exceptions[i]] = true;
@@ -28,6 +28,7 @@
 #include "lower_calls.h"
 #include "lowering.h"
 #include "pmap.h"
+#include "timing_t.h"
 #include "type_t.h"
 #include "util.h"
 
@@ -972,6 +973,8 @@ static void lower_method_types(ir_type *const type, ir_entity *const entity,
 
 void lower_calls_with_compounds(compound_call_lowering_flags flags)
 {
+	IR_PASS_TIMING("lower_calls_with_compounds", NULL);
+
 	pointer_types = pmap_create();
 	lowered_mtps = pmap_create();
 
@@ -14,6 +14,7 @@
 #include "irprog_t.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "timing_t.h"
 #include "type_t.h"
 #include "irgmod.h"
 #include "panic.h"
@@ -177,6 +178,8 @@ static void find_copyb_nodes(ir_node *irn, void *ctx)
 void lower_CopyB(ir_graph *irg, unsigned max_small_sz, unsigned min_large_sz,
                  int allow_misaligns)
 {
+	IR_PASS_TIMING("lower_CopyB", irg);
+
 	const backend_params *bparams = be_get_backend_param();
 
 	assert(max_small_sz < min_large_sz && "CopyB size ranges must not overlap");
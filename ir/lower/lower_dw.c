@@ -40,6 +40,7 @@
 #include "pdeq.h"
 #include "pmap.h"
 #include "set.h"
+#include "timing_t.h"
 #include "tv_t.h"
 #include "type_t.h"
 
@@ -2691,6 +2692,8 @@ static int lower_mux_cb(ir_node *mux)
  */
 void ir_lower_dw_ops(void)
 {
+	IR_PASS_TIMING("ir_lower_dw_ops", NULL);
+
 	/* create the necessary maps */
 	if (!intrinsic_fkt) {
 		intrinsic_fkt = new_set(cmp_op_mode, iro_last + 1);
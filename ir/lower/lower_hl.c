@@ -12,6 +12,7 @@
 #include "irmode_t.h"
 #include "irnode_t.h"
 #include "entity_t.h"
+#include "timing_t.h"
 #include "typerep.h"
 #include "irprog_t.h"
 #include "ircons.h"
@@ -150,6 +151,8 @@ static void lower_irnode(ir_node *irn, void *env)
 
 void lower_highlevel_graph(ir_graph *irg)
 {
+	IR_PASS_TIMING("lower_highlevel_graph", irg);
+
 	/* Finally: lower Offset/TypeConst-size and Sel nodes, unaligned Load/Stores. */
 	irg_walk_graph(irg, NULL, lower_irnode, NULL);
 
@@ -161,11 +164,14 @@ void lower_highlevel_graph(ir_graph *irg)
  */
 void lower_const_code(void)
 {
+	IR_PASS_TIMING("lower_const_code", NULL);
 	walk_const_code(NULL, lower_irnode, NULL);
 }
 
 void lower_highlevel()
 {
+	IR_PASS_TIMING("lower_highlevel", NULL);
+
 	foreach_irp_irg(i, irg) {
 		lower_highlevel_graph(irg);
 	}
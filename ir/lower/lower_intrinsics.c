@@ -25,6 +25,7 @@
 #include "iropt_dbg.h"
 #include "panic.h"
 #include "be.h"
+#include "timing_t.h"
 #include "util.h"
 #include "firmstat_t.h"
 #include "tv_t.h"
@@ -102,6 +103,8 @@ static void call_mapper(ir_node *node, void *data)
 
 void ir_lower_intrinsics(ir_graph *irg, ir_intrinsics_map *map)
 {
+	IR_PASS_TIMING("ir_lower_intrinsics", irg);
+
 	if (map->part_block_used) {
 		ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_PHI_LIST);
 		collect_phiprojs_and_start_block_nodes(irg);
@@ -9,6 +9,7 @@
  * @author      Matthias Braun, Christoph Mallon
  */
 #include "lower_mode_b.h"
+#include "timing_t.h"
 
 #include <stdlib.h>
 #include <stdbool.h>
@@ -240,6 +241,8 @@ static void collect_needs_lowering(ir_node *node, void *env)
 
 void ir_lower_mode_b(ir_graph *const irg, ir_mode *const nlowered_mode)
 {
+	IR_PASS_TIMING("ir_lower_mode_b", irg);
+
 	lowered_mode = nlowered_mode;
 
 	/* edges are used by part_block_edges in the ir_create_cond_set variant. */
@@ -17,6 +17,7 @@
 #include "irgwalk.h"
 #include "irgmod.h"
 #include "ircons.h"
+#include "timing_t.h"
 #include "util.h"
 
 typedef struct walk_env {
@@ -83,6 +84,8 @@ static void lower_mux_node(ir_node* mux)
 
 void lower_mux(ir_graph *irg, lower_mux_callback *cb_func)
 {
+	IR_PASS_TIMING("lower_mux", irg);
+
 	/* Scan the graph for mux nodes to lower. */
 	walk_env_t env;
 	env.cb_func = cb_func;
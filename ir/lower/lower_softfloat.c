@@ -26,6 +26,7 @@
 #include "lower_softfloat.h"
 #include "lowering.h"
 #include "pmap.h"
+#include "timing_t.h"
 #include "type_t.h"
 #include "tv_t.h"
 
@@ -811,6 +812,8 @@ static int lower_mux_cb(ir_node *mux)
 
 void lower_floating_point(void)
 {
+	IR_PASS_TIMING("lower_floating_point", NULL);
+
 	ir_prepare_softfloat_lowering();
 
 	ir_clear_opcodes_generic_func();
@@ -8,9 +8,12 @@
  * @brief   Lowering of Switches if necessary or advantageous.
  * @author  Moritz Kroll
  */
+#include <math.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "array.h"
+#include "execfreq.h"
 #include "ircons.h"
 #include "irgopt.h"
 #include "irgwalk.h"
@@ -19,8 +22,16 @@
 #include "irouts_t.h"
 #include "lowering.h"
 #include "panic.h"
+#include "timing_t.h"
 #include "util.h"
 
+/** Maximal number of targets tested by a single bit test. */
+#define MAX_BIT_TEST_TARGETS 3
+/** Minimal percentage of values with a case in a jump table. */
+#define MIN_TABLE_DENSITY    40
+/** Distances between cases are saturated at this value. */
+#define MAX_DISTANCE         ((uint64_t)1 << 31)
+
 typedef struct walk_env_t {
 	ir_nodeset_t  processed;
 	ir_mode      *selector_mode;
@@ -31,18 +42,38 @@ typedef struct walk_env_t {
 
 typedef struct target_t {
 	ir_node *block;     /**< block that is targetted */
-	uint16_t n_entries; /**< number of table entries targetting this block */
-	uint16_t i;
+	unsigned n_entries; /**< number of table entries targetting this block,
+	                         later the number of edges into it */
+	unsigned i;
 } target_t;
 
+typedef enum cluster_kind_t {
+	CLUSTER_CASE,     /**< a single case compared directly */
+	CLUSTER_TABLE,    /**< a jump table */
+	CLUSTER_BIT_TEST, /**< a bit test with few targets */
+} cluster_kind_t;
+
+/** A group of consecutive cases lowered together. */
+typedef struct case_cluster_t {
+	cluster_kind_t kind;
+	size_t         first;     /**< index of the first table entry */
+	size_t         n_entries; /**< number of table entries */
+	double         weight;    /**< execution frequency of the cases */
+} case_cluster_t;
+
 typedef struct switch_info_t {
-	ir_node     *switchn;
-	ir_tarval   *switch_min;
-	ir_tarval   *switch_max;
-	ir_node     *default_block;
-	unsigned     num_cases;
-	target_t    *targets;
-	ir_node    **defusers;    /**< the Projs pointing to the default case */
+	ir_node               *switchn;
+	ir_tarval             *switch_min;
+	ir_tarval             *switch_max;
+	ir_node               *default_block;
+	unsigned               num_cases;
+	unsigned               n_targets;
+	target_t              *targets;
+	ir_switch_table_entry *entries;   /**< sorted cases without default */
+	size_t                 n_entries;
+	case_cluster_t        *clusters;
+	ir_nodeset_t          *processed; /**< receives the created Switches */
+	ir_node              **defusers;  /**< the Projs pointing to the default case */
 } switch_info_t;
 
 /**
@@ -107,6 +138,7 @@ static void analyse_switch1(switch_info_t *info)
 	}
 
 	info->default_block = targets[pn_Switch_default].block;
+	info->n_targets     = n_outs;
 	info->targets       = targets;
 }
 
@@ -278,17 +310,22 @@ static ir_node *create_case_cond(const ir_switch_table_entry *entry,
                                  dbg_info *dbgi, ir_node *block,
                                  ir_node *selector)
 {
-	ir_graph *irg      = get_irn_irg(block);
-	ir_node  *minconst = new_r_Const(irg, entry->min);
-
+	ir_graph *irg = get_irn_irg(block);
 	ir_node  *cmp;
 	if (entry->min == entry->max) {
+		ir_node *minconst = new_r_Const(irg, entry->min);
 		cmp = new_rd_Cmp(dbgi, block, selector, minconst, ir_relation_equal);
 	} else {
-		ir_tarval *adjusted_max = tarval_sub(entry->max, entry->min, NULL);
-		ir_node   *sub          = new_rd_Sub(dbgi, block, selector, minconst,
-		                                     get_tarval_mode(adjusted_max));
-		ir_node   *maxconst     = new_r_Const(irg, adjusted_max);
+		/* compare unsigned, so values below min wrap around */
+		ir_mode   *mode = find_unsigned_mode(get_irn_mode(selector));
+		ir_tarval *min  = tarval_convert_to(entry->min, mode);
+		ir_tarval *adjusted_max
+			= tarval_sub(tarval_convert_to(entry->max, mode), min, NULL);
+		if (get_irn_mode(selector) != mode)
+			selector = new_rd_Conv(dbgi, block, selector, mode);
+		ir_node *sub      = new_rd_Sub(dbgi, block, selector,
+		                               new_r_Const(irg, min), mode);
+		ir_node *maxconst = new_r_Const(irg, adjusted_max);
 		cmp = new_rd_Cmp(dbgi, block, sub, maxconst, ir_relation_less_equal);
 	}
 	return new_rd_Cond(dbgi, block, cmp);
@@ -313,64 +350,468 @@ static void connect_to_target(target_t *target, ir_node *cf)
 }
 
 /**
- * Creates an if cascade realizing binary search.
+ * Returns the distance from @p from to @p to, which must not be smaller,
+ * saturated at MAX_DISTANCE.
  */
-static void create_if_cascade(switch_info_t *info, ir_node *block,
-                              ir_switch_table_entry *curcases,
-                              unsigned numcases)
+static uint64_t get_distance(ir_tarval *from, ir_tarval *to)
 {
-	ir_graph      *irg      = get_irn_irg(block);
-	const ir_node *switchn  = info->switchn;
-	dbg_info      *dbgi     = get_irn_dbg_info(switchn);
-	ir_node       *selector = get_Switch_selector(switchn);
+	ir_mode   *mode     = find_unsigned_mode(get_tarval_mode(from));
+	ir_tarval *distance = tarval_sub(tarval_convert_to(to, mode),
+	                                 tarval_convert_to(from, mode), NULL);
+	if (!tarval_is_long(distance))
+		return MAX_DISTANCE;
+	long value = get_tarval_long(distance);
+	return (uint64_t)value < MAX_DISTANCE ? (uint64_t)value : MAX_DISTANCE;
+}
 
-	if (numcases == 0) {
-		/* zero cases: "goto default;" */
-		ARR_APP1(ir_node*, info->defusers, new_r_Jmp(block));
-	} else if (numcases == 1) {
-		/*only one case: "if (sel == val) goto target else goto default;"*/
-		const ir_switch_table_entry *entry = &curcases[0];
-		ir_node *cond      = create_case_cond(entry, dbgi, block, selector);
-		ir_node *trueproj  = new_r_Proj(cond, mode_X, pn_Cond_true);
-		ir_node *falseproj = new_r_Proj(cond, mode_X, pn_Cond_false);
-
-		connect_to_target(&info->targets[entry->pn], trueproj);
-		ARR_APP1(ir_node*, info->defusers, falseproj);
-	} else if (numcases == 2) {
-		/* only two cases: "if (sel == val[0]) goto target[0];" */
-		const ir_switch_table_entry *entry0 = &curcases[0];
-		const ir_switch_table_entry *entry1 = &curcases[1];
-		ir_node *cond      = create_case_cond(entry0, dbgi, block, selector);
-		ir_node *trueproj  = new_r_Proj(cond, mode_X, pn_Cond_true);
-		ir_node *falseproj = new_r_Proj(cond, mode_X, pn_Cond_false);
-		connect_to_target(&info->targets[entry0->pn], trueproj);
-
-		ir_node *in[]    = { falseproj };
-		ir_node *neblock = new_r_Block(irg, ARRAY_SIZE(in), in);
-
-		/* second part: "else if (sel == val[1]) goto target[1] else goto default;" */
-		ir_node *cond1      = create_case_cond(entry1, dbgi, neblock, selector);
-		ir_node *trueproj1  = new_r_Proj(cond1, mode_X, pn_Cond_true);
-		ir_node *falseproj1 = new_r_Proj(cond1, mode_X, pn_Cond_false);
-		connect_to_target(&info->targets[entry1->pn], trueproj1);
-		ARR_APP1(ir_node*, info->defusers, falseproj1);
-	} else {
-		/* recursive case: split cases in the middle */
-		unsigned midcase = numcases / 2;
-		const ir_switch_table_entry *entry = &curcases[midcase];
-		ir_node *val = new_r_Const(irg, entry->min);
-		ir_node *cmp = new_rd_Cmp(dbgi, block, selector, val, ir_relation_less);
+/**
+ * Partitions the sorted cases into jump table, bit test and single case
+ * clusters. Minimizes the number of clusters by dynamic programming over
+ * the start of the remaining cases.
+ */
+static void find_clusters(switch_info_t *info, const walk_env_t *env)
+{
+	const ir_switch_table_entry *entries   = info->entries;
+	size_t                       n_entries = info->n_entries;
+	unsigned                     word_bits
+		= get_mode_size_bits(env->selector_mode);
+
+	/* start/end of each case relative to the first case and the number of
+	 * covered values in front of each case */
+	uint64_t *start   = XMALLOCN(uint64_t, n_entries);
+	uint64_t *end     = XMALLOCN(uint64_t, n_entries);
+	uint64_t *covered = XMALLOCN(uint64_t, n_entries + 1);
+	uint64_t  pos     = 0;
+	covered[0] = 0;
+	for (size_t e = 0; e < n_entries; ++e) {
+		const ir_switch_table_entry *entry = &entries[e];
+		if (e > 0)
+			pos += get_distance(entries[e - 1].max, entry->min);
+		uint64_t size = get_distance(entry->min, entry->max) + 1;
+		start[e]       = pos;
+		pos           += size - 1;
+		end[e]         = pos + 1;
+		covered[e + 1] = covered[e] + size;
+	}
+
+	unsigned       *cost = XMALLOCN(unsigned, n_entries + 1);
+	size_t         *len  = XMALLOCN(size_t, n_entries);
+	cluster_kind_t *kind = XMALLOCN(cluster_kind_t, n_entries);
+	cost[n_entries] = 0;
+	for (size_t i = n_entries; i-- > 0; ) {
+		cost[i] = cost[i + 1] + 1;
+		len[i]  = 1;
+		kind[i] = CLUSTER_CASE;
+
+		unsigned pns[MAX_BIT_TEST_TARGETS + 1];
+		unsigned n_pns = 0;
+		for (size_t j = i + 1; j <= n_entries; ++j) {
+			unsigned pn = entries[j - 1].pn;
+			bool     found = false;
+			for (unsigned p = 0; p < n_pns; ++p)
+				found |= pns[p] == pn;
+			if (!found && n_pns <= MAX_BIT_TEST_TARGETS)
+				pns[n_pns++] = pn;
+
+			uint64_t span  = end[j - 1] - start[i];
+			uint64_t cover = covered[j] - covered[i];
+			uint64_t spare = span - cover;
+			size_t   n     = j - i;
+			bool     table_possible = spare < env->spare_size;
+			bool     bits_possible  = span <= word_bits
+			                       && n_pns <= MAX_BIT_TEST_TARGETS;
+			if (!table_possible && !bits_possible)
+				break;
+
+			/* a bit test needs more cases the more targets it tests */
+			bool bits = bits_possible && n >= 2 * n_pns + 1;
+			bool table = table_possible && n > env->small_switch
+			          && cover * 100 >= span * MIN_TABLE_DENSITY;
+			if ((bits || table) && cost[j] + 1 <= cost[i]) {
+				cost[i] = cost[j] + 1;
+				len[i]  = n;
+				/* prefer bit tests, they need no memory access */
+				kind[i] = bits ? CLUSTER_BIT_TEST : CLUSTER_TABLE;
+			}
+		}
+	}
+
+	info->clusters = NEW_ARR_F(case_cluster_t, 0);
+	for (size_t i = 0; i < n_entries; i += len[i]) {
+		case_cluster_t cluster = {
+			.kind      = kind[i],
+			.first     = i,
+			.n_entries = len[i],
+		};
+		ARR_APP1(case_cluster_t, info->clusters, cluster);
+	}
+
+	free(kind);
+	free(len);
+	free(cost);
+	free(covered);
+	free(end);
+	free(start);
+}
+
+/**
+ * Computes the cluster weights from the execution frequencies of the case
+ * targets and the number of control flow edges each target gets.
+ */
+static void weight_clusters(switch_info_t *info)
+{
+	const ir_switch_table_entry *entries = info->entries;
+	target_t                    *targets = info->targets;
+
+	/* the frequency of a target is shared by all of its cases, without any
+	 * frequencies all cases are considered equally likely */
+	double total = 0.0;
+	for (size_t e = 0; e < info->n_entries; ++e)
+		total += get_block_execfreq(targets[entries[e].pn].block);
+
+	for (size_t c = 0, n = ARR_LEN(info->clusters); c < n; ++c) {
+		case_cluster_t *cluster = &info->clusters[c];
+		cluster->weight = 0.0;
+		for (size_t e = cluster->first, end = e + cluster->n_entries; e < end;
+		     ++e) {
+			const target_t *target = &targets[entries[e].pn];
+			cluster->weight += total > 0.0
+				? get_block_execfreq(target->block) / target->n_entries
+				: 1.0;
+		}
+	}
+
+	size_t *last_cluster = XMALLOCNZ(size_t, info->n_targets);
+	for (unsigned pn = 0; pn < info->n_targets; ++pn)
+		targets[pn].n_entries = 0;
+	for (size_t c = 0, n = ARR_LEN(info->clusters); c < n; ++c) {
+		const case_cluster_t *cluster = &info->clusters[c];
+		for (size_t e = cluster->first, end = e + cluster->n_entries; e < end;
+		     ++e) {
+			unsigned pn = entries[e].pn;
+			/* tables and bit tests have a single edge per target */
+			if (cluster->kind != CLUSTER_CASE && last_cluster[pn] == c + 1)
+				continue;
+			last_cluster[pn] = c + 1;
+			++targets[pn].n_entries;
+		}
+	}
+	free(last_cluster);
+}
+
+/**
+ * Returns the selector minus the first case of @p cluster in the unsigned
+ * selector mode.
+ */
+static ir_node *create_cluster_offset(switch_info_t *info, ir_node *block,
+                                      const case_cluster_t *cluster)
+{
+	ir_graph  *irg      = get_irn_irg(block);
+	dbg_info  *dbgi     = get_irn_dbg_info(info->switchn);
+	ir_node   *selector = get_Switch_selector(info->switchn);
+	ir_mode   *mode     = find_unsigned_mode(get_irn_mode(selector));
+	ir_tarval *base
+		= tarval_convert_to(info->entries[cluster->first].min, mode);
+	if (get_irn_mode(selector) != mode)
+		selector = new_rd_Conv(dbgi, block, selector, mode);
+	if (!tarval_is_null(base))
+		selector = new_rd_Sub(dbgi, block, selector, new_r_Const(irg, base),
+		                      mode);
+	return selector;
+}
+
+/**
+ * Returns the last case value of @p cluster minus its first one.
+ */
+static ir_tarval *get_cluster_span(const switch_info_t *info,
+                                   const case_cluster_t *cluster)
+{
+	ir_mode   *mode = find_unsigned_mode(get_tarval_mode(info->entries[0].min));
+	ir_tarval *min  = info->entries[cluster->first].min;
+	ir_tarval *max  = info->entries[cluster->first + cluster->n_entries - 1].max;
+	return tarval_sub(tarval_convert_to(max, mode),
+	                  tarval_convert_to(min, mode), NULL);
+}
+
+/**
+ * Creates a Cond checking that @p offset lies within the span of @p cluster.
+ * Returns the block reached if it does, the other edge is returned in
+ * @p outside.
+ */
+static ir_node *create_range_check(switch_info_t *info, ir_node *block,
+                                   const case_cluster_t *cluster,
+                                   ir_node *offset, ir_node **outside)
+{
+	ir_graph *irg  = get_irn_irg(block);
+	dbg_info *dbgi = get_irn_dbg_info(info->switchn);
+	ir_node  *span = new_r_Const(irg, get_cluster_span(info, cluster));
+	ir_node  *cmp  = new_rd_Cmp(dbgi, block, offset, span,
+	                            ir_relation_less_equal);
+	ir_node  *cond = new_rd_Cond(dbgi, block, cmp);
+	*outside = new_r_Proj(cond, mode_X, pn_Cond_false);
+
+	ir_node *in[] = { new_r_Proj(cond, mode_X, pn_Cond_true) };
+	return new_r_Block(irg, ARRAY_SIZE(in), in);
+}
+
+/**
+ * Returns a Jmp in a new block behind @p cf, so Switch edges do not become
+ * critical.
+ */
+static ir_node *split_edge(ir_node *cf)
+{
+	ir_node *in[] = { cf };
+	ir_node *block = new_r_Block(get_irn_irg(cf), ARRAY_SIZE(in), in);
+	return new_r_Jmp(block);
+}
+
+/**
+ * Creates a Switch on the offset of the selector for a dense cluster.
+ */
+static ir_node *create_table(switch_info_t *info, ir_node *block,
+                             const case_cluster_t *cluster,
+                             ir_mode *selector_mode)
+{
+	ir_graph *irg    = get_irn_irg(block);
+	dbg_info *dbgi   = get_irn_dbg_info(info->switchn);
+	ir_node  *offset = create_cluster_offset(info, block, cluster);
+	ir_node  *outside;
+	ir_node  *inside = create_range_check(info, block, cluster, offset,
+	                                      &outside);
+	ir_mode  *mode   = get_irn_mode(offset);
+	ir_node  *selector = new_rd_Conv(dbgi, inside, offset, selector_mode);
+
+	/* number the targets of the cluster */
+	unsigned *pns    = XMALLOCNZ(unsigned, info->n_targets);
+	unsigned  n_outs = pn_Switch_max + 1;
+	ir_switch_table *table = ir_new_switch_table(irg, cluster->n_entries);
+	ir_tarval *base = tarval_convert_to(info->entries[cluster->first].min,
+	                                    mode);
+	for (size_t i = 0; i < cluster->n_entries; ++i) {
+		const ir_switch_table_entry *entry
+			= &info->entries[cluster->first + i];
+		if (pns[entry->pn] == 0)
+			pns[entry->pn] = n_outs++;
+		ir_tarval *min = tarval_sub(tarval_convert_to(entry->min, mode),
+		                            base, NULL);
+		ir_tarval *max = tarval_sub(tarval_convert_to(entry->max, mode),
+		                            base, NULL);
+		ir_switch_table_set(table, i,
+		                    tarval_convert_to(min, selector_mode),
+		                    tarval_convert_to(max, selector_mode),
+		                    pns[entry->pn]);
+	}
+
+	ir_node *switchn = new_rd_Switch(dbgi, inside, selector, n_outs, table);
+	ir_nodeset_insert(info->processed, switchn);
+	ir_node *proj_default = new_r_Proj(switchn, mode_X, pn_Switch_default);
+	ARR_APP1(ir_node*, info->defusers, split_edge(proj_default));
+	for (unsigned pn = 0; pn < info->n_targets; ++pn) {
+		if (pns[pn] == 0)
+			continue;
+		ir_node *proj = new_r_Proj(switchn, mode_X, pns[pn]);
+		connect_to_target(&info->targets[pn], split_edge(proj));
+	}
+	free(pns);
+	return outside;
+}
+
+/**
+ * Creates a bit test for a cluster with few targets whose cases fit into a
+ * machine word: if ((1 << offset) & mask) goto target;
+ */
+static ir_node *create_bit_test(switch_info_t *info, ir_node *block,
+                                const case_cluster_t *cluster,
+                                ir_mode *word_mode)
+{
+	ir_graph *irg    = get_irn_irg(block);
+	dbg_info *dbgi   = get_irn_dbg_info(info->switchn);
+	ir_node  *offset = create_cluster_offset(info, block, cluster);
+	ir_node  *outside;
+	block = create_range_check(info, block, cluster, offset, &outside);
+
+	ir_node *one   = new_r_Const(irg, get_mode_one(word_mode));
+	ir_node *shift = new_rd_Conv(dbgi, block, offset, word_mode);
+	ir_node *bit   = new_rd_Shl(dbgi, block, one, shift, word_mode);
+	ir_node *zero  = new_r_Const(irg, get_mode_null(word_mode));
+
+	/* collect the mask and weight of each target */
+	unsigned   pns[MAX_BIT_TEST_TARGETS];
+	ir_tarval *masks[MAX_BIT_TEST_TARGETS];
+	double     weights[MAX_BIT_TEST_TARGETS];
+	unsigned   n_pns = 0;
+	ir_tarval *base  = info->entries[cluster->first].min;
+	ir_mode   *mode  = get_tarval_mode(base);
+	for (size_t i = 0; i < cluster->n_entries; ++i) {
+		const ir_switch_table_entry *entry
+			= &info->entries[cluster->first + i];
+		unsigned p = 0;
+		while (p < n_pns && pns[p] != entry->pn)
+			++p;
+		if (p == n_pns) {
+			assert(n_pns < MAX_BIT_TEST_TARGETS);
+			pns[p]     = entry->pn;
+			masks[p]   = get_mode_null(word_mode);
+			weights[p] = 0.0;
+			++n_pns;
+		}
+		const target_t *target = &info->targets[entry->pn];
+		weights[p] += get_block_execfreq(target->block);
+
+		for (ir_tarval *value = entry->min;;
+		     value = tarval_add(value, get_mode_one(mode))) {
+			unsigned   pos = get_distance(base, value);
+			ir_tarval *bit_pos
+				= tarval_shl_unsigned(get_mode_one(word_mode), pos);
+			masks[p] = tarval_or(masks[p], bit_pos);
+			if (value == entry->max)
+				break;
+		}
+	}
+
+	/* test the hottest targets first */
+	for (unsigned p = 0; p < n_pns; ++p) {
+		unsigned best = p;
+		for (unsigned q = p + 1; q < n_pns; ++q) {
+			if (weights[q] > weights[best])
+				best = q;
+		}
+		unsigned   pn     = pns[best];
+		ir_tarval *mask   = masks[best];
+		pns[best]     = pns[p];
+		masks[best]   = masks[p];
+		weights[best] = weights[p];
+
+		ir_node *mask_const = new_r_Const(irg, mask);
+		ir_node *and  = new_rd_And(dbgi, block, bit, mask_const, word_mode);
+		ir_node *cmp  = new_rd_Cmp(dbgi, block, and, zero,
+		                           ir_relation_less_greater);
 		ir_node *cond = new_rd_Cond(dbgi, block, cmp);
+		ir_node *proj_true  = new_r_Proj(cond, mode_X, pn_Cond_true);
+		ir_node *proj_false = new_r_Proj(cond, mode_X, pn_Cond_false);
+		connect_to_target(&info->targets[pn], proj_true);
+		if (p + 1 == n_pns) {
+			ARR_APP1(ir_node*, info->defusers, proj_false);
+		} else {
+			ir_node *in[] = { proj_false };
+			block = new_r_Block(irg, ARRAY_SIZE(in), in);
+		}
+	}
+	return outside;
+}
+
+/**
+ * Creates the code for a single cluster. Returns the control flow edge taken
+ * if the selector does not match the cluster.
+ */
+static ir_node *create_cluster(switch_info_t *info, ir_node *block,
+                               const case_cluster_t *cluster,
+                               ir_mode *selector_mode)
+{
+	switch (cluster->kind) {
+	case CLUSTER_CASE: {
+		const ir_switch_table_entry *entry = &info->entries[cluster->first];
+		dbg_info *dbgi     = get_irn_dbg_info(info->switchn);
+		ir_node  *selector = get_Switch_selector(info->switchn);
+		ir_node  *cond     = create_case_cond(entry, dbgi, block, selector);
+		ir_node  *proj_true = new_r_Proj(cond, mode_X, pn_Cond_true);
+		connect_to_target(&info->targets[entry->pn], proj_true);
+		return new_r_Proj(cond, mode_X, pn_Cond_false);
+	}
+	case CLUSTER_TABLE:
+		return create_table(info, block, cluster, selector_mode);
+	case CLUSTER_BIT_TEST:
+		return create_bit_test(info, block, cluster, selector_mode);
+	}
+	panic("invalid cluster kind");
+}
+
+static ir_node *create_pivot_cond(switch_info_t *info, ir_node *block,
+                                  const case_cluster_t *cluster,
+                                  ir_node **ge)
+{
+	ir_graph *irg      = get_irn_irg(block);
+	dbg_info *dbgi     = get_irn_dbg_info(info->switchn);
+	ir_node  *selector = get_Switch_selector(info->switchn);
+	ir_node  *val  = new_r_Const(irg, info->entries[cluster->first].min);
+	ir_node  *cmp  = new_rd_Cmp(dbgi, block, selector, val, ir_relation_less);
+	ir_node  *cond = new_rd_Cond(dbgi, block, cmp);
+
+	ir_node *ltin[]  = { new_r_Proj(cond, mode_X, pn_Cond_true) };
+	ir_node *gein[]  = { new_r_Proj(cond, mode_X, pn_Cond_false) };
+	*ge = new_r_Block(irg, ARRAY_SIZE(gein), gein);
+	return new_r_Block(irg, ARRAY_SIZE(ltin), ltin);
+}
+
+/**
+ * Creates a compare tree over the clusters. A cluster at least as likely as
+ * all others together is tested first, otherwise the clusters are split
+ * into two halves of about the same weight.
+ */
+static void create_cluster_tree(switch_info_t *info, ir_node *block,
+                                case_cluster_t *clusters, size_t n_clusters,
+                                ir_mode *selector_mode)
+{
+	if (n_clusters == 0) {
+		ARR_APP1(ir_node*, info->defusers, new_r_Jmp(block));
+		return;
+	}
 
-		ir_node *ltin[]  = { new_r_Proj(cond, mode_X, pn_Cond_true) };
-		ir_node *ltblock = new_r_Block(irg, ARRAY_SIZE(ltin), ltin);
+	double total   = 0.0;
+	size_t hottest = 0;
+	for (size_t c = 0; c < n_clusters; ++c) {
+		total += clusters[c].weight;
+		if (clusters[c].weight > clusters[hottest].weight)
+			hottest = c;
+	}
 
-		ir_node *gein[]  = { new_r_Proj(cond, mode_X, pn_Cond_false) };
-		ir_node *geblock = new_r_Block(irg, ARRAY_SIZE(gein), gein);
+	if (clusters[hottest].weight >= total - clusters[hottest].weight) {
+		ir_node *miss = create_cluster(info, block, &clusters[hottest],
+		                               selector_mode);
+		if (n_clusters == 1) {
+			ARR_APP1(ir_node*, info->defusers, miss);
+			return;
+		}
+		ir_graph *irg  = get_irn_irg(block);
+		ir_node  *in[] = { miss };
+		ir_node  *rest = new_r_Block(irg, ARRAY_SIZE(in), in);
+		if (hottest == 0) {
+			create_cluster_tree(info, rest, clusters + 1, n_clusters - 1,
+			                    selector_mode);
+		} else if (hottest == n_clusters - 1) {
+			create_cluster_tree(info, rest, clusters, n_clusters - 1,
+			                    selector_mode);
+		} else {
+			ir_node *geblock;
+			ir_node *ltblock = create_pivot_cond(info, rest,
+			                                     &clusters[hottest + 1],
+			                                     &geblock);
+			create_cluster_tree(info, ltblock, clusters, hottest,
+			                    selector_mode);
+			create_cluster_tree(info, geblock, clusters + hottest + 1,
+			                    n_clusters - hottest - 1, selector_mode);
+		}
+		return;
+	}
 
-		create_if_cascade(info, ltblock, curcases, midcase);
-		create_if_cascade(info, geblock, curcases + midcase, numcases - midcase);
+	/* split at the weighted median */
+	size_t pivot     = 1;
+	double best_diff = total;
+	double left      = 0.0;
+	for (size_t c = 1; c < n_clusters; ++c) {
+		left += clusters[c - 1].weight;
+		double diff = fabs(2 * left - total);
+		if (diff < best_diff) {
+			best_diff = diff;
+			pivot     = c;
+		}
 	}
+	ir_node *geblock;
+	ir_node *ltblock = create_pivot_cond(info, block, &clusters[pivot],
+	                                     &geblock);
+	create_cluster_tree(info, ltblock, clusters, pivot, selector_mode);
+	create_cluster_tree(info, geblock, clusters + pivot, n_clusters - pivot,
+	                    selector_mode);
 }
 
 /**
@@ -399,48 +840,45 @@ static void find_switch_nodes(ir_node *block, void *ctx)
 	switch_info_t info;
 	analyse_switch0(&info, switchn);
 
-	/*
-	 * Here we have: num_cases and [switch_min, switch_max] interval.
-	 * We do an if-cascade if there are too many spare numbers.
-	 */
-	ir_mode   *selector_mode = get_irn_mode(get_Switch_selector(switchn));
-	ir_tarval *spare = tarval_sub(info.switch_max, info.switch_min, selector_mode);
-	ir_mode   *mode  = find_unsigned_mode(selector_mode);
-	spare = tarval_convert_to(spare, mode);
-	ir_tarval *num_cases_minus_one
-		= new_tarval_from_long(info.num_cases-1, mode);
-	spare = tarval_sub(spare, num_cases_minus_one, mode);
-	ir_tarval *spare_size = new_tarval_from_long(env->spare_size, mode);
-	bool lower_switch = info.num_cases <= env->small_switch
-		|| (tarval_cmp(spare, spare_size) & ir_relation_greater_equal);
-
-	if (!lower_switch) {
+	ir_mode *selector_mode = get_irn_mode(get_Switch_selector(switchn));
+	normalize_table(switchn, selector_mode, NULL);
+	ir_switch_table *table = get_Switch_table(switchn);
+	info.entries   = table->entries;
+	info.n_entries = table->n_entries;
+	info.processed = &env->processed;
+	find_clusters(&info, env);
+
+	if (ARR_LEN(info.clusters) == 1 && info.clusters[0].kind == CLUSTER_TABLE) {
 		/* we won't decompose the switch. But we must add an out-of-bounds
 		 * check */
+		DEL_ARR_F(info.clusters);
 		env->changed |= normalize_switch(&info, env->selector_mode);
 		return;
 	}
 
-	normalize_table(switchn, selector_mode, NULL);
 	analyse_switch1(&info);
+	weight_clusters(&info);
 
-	/* Now create the if cascade */
+	/* Now create the cluster tree */
 	env->changed  = true;
 	info.defusers = NEW_ARR_F(ir_node*, 0);
 	block         = get_nodes_block(switchn);
-	ir_switch_table *table = get_Switch_table(switchn);
-	create_if_cascade(&info, block, table->entries, table->n_entries);
+	create_cluster_tree(&info, block, info.clusters, ARR_LEN(info.clusters),
+	                    env->selector_mode);
 
 	/* Connect new default case users */
 	set_irn_in(info.default_block, ARR_LEN(info.defusers), info.defusers);
 
 	DEL_ARR_F(info.defusers);
+	DEL_ARR_F(info.clusters);
 	free(info.targets);
 }
 
 void lower_switch(ir_graph *irg, unsigned small_switch, unsigned spare_size,
                   ir_mode *selector_mode)
 {
+	IR_PASS_TIMING("lower_switch", irg);
+
 	if (mode_is_signed(selector_mode))
 		panic("expected unsigned mode for switch selector");
 
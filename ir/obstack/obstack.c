@@ -18,6 +18,7 @@
    Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
    Boston, MA 02110-1301, USA.  */
 #include "obstack.h"
+#include "obstack_stat.h"
 
 /* NOTE BEFORE MODIFYING THIS FILE: This version number must be
    incremented whenever callers compiled using an old obstack.h can no
@@ -71,6 +72,21 @@ FIRM_NORETURN (*obstack_alloc_failed_handler) (void) = print_and_abort;
 # include <stdlib.h>
 int obstack_exit_failure = EXIT_FAILURE;
 
+/* Total size of all chunks allocated by obstacks so far.  */
+unsigned long long obstack_chunk_bytes = 0;
+
+/* Size of all chunks currently held by obstacks and its maximum.  */
+unsigned long long obstack_chunk_bytes_live = 0;
+unsigned long long obstack_chunk_bytes_peak = 0;
+
+static void count_chunk_alloc(PTR_INT_TYPE size)
+{
+  obstack_chunk_bytes += size;
+  obstack_chunk_bytes_live += size;
+  if (obstack_chunk_bytes_live > obstack_chunk_bytes_peak)
+    obstack_chunk_bytes_peak = obstack_chunk_bytes_live;
+}
+
 /* Define a macro that either calls functions with the traditional malloc/free
    calling interface, or calls functions with the mmalloc/mfree interface
    (that adds an extra first argument), based on the state of use_extra_arg.
@@ -84,6 +100,7 @@ int obstack_exit_failure = EXIT_FAILURE;
 
 # define CALL_FREEFUN(h, old_chunk) \
   do { \
+    obstack_chunk_bytes_live -= (old_chunk)->limit - (char *) (old_chunk); \
     if ((h) -> use_extra_arg) \
       (*(h)->freefun) ((h)->extra_arg, (old_chunk)); \
     else \
@@ -132,6 +149,7 @@ int _obstack_begin(struct obstack *h, int size, int alignment,
   chunk = h->chunk = CALL_CHUNKFUN (h, h -> chunk_size);
   if (!chunk)
     (*obstack_alloc_failed_handler) ();
+  count_chunk_alloc (h->chunk_size);
   h->next_free = h->object_base = __PTR_ALIGN ((char *) chunk, chunk->contents,
 					       alignment - 1);
   h->chunk_limit = chunk->limit
@@ -178,6 +196,7 @@ int _obstack_begin_1(struct obstack *h, int size, int alignment,
   chunk = h->chunk = CALL_CHUNKFUN (h, h -> chunk_size);
   if (!chunk)
     (*obstack_alloc_failed_handler) ();
+  count_chunk_alloc (h->chunk_size);
   h->next_free = h->object_base = __PTR_ALIGN ((char *) chunk, chunk->contents,
 					       alignment - 1);
   h->chunk_limit = chunk->limit
@@ -214,6 +233,7 @@ void _obstack_newchunk(struct obstack *h, PTR_INT_TYPE length)
   new_chunk = CALL_CHUNKFUN (h, new_size);
   if (!new_chunk)
     (*obstack_alloc_failed_handler) ();
+  count_chunk_alloc (new_size);
   h->chunk = new_chunk;
   new_chunk->prev = old_chunk;
   new_chunk->limit = h->chunk_limit = (char *) new_chunk + new_size;
@@ -0,0 +1,25 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Counters of the chunk memory requested by obstacks.
+ *
+ * Read them through ir_obstack_bytes_total(), ir_obstack_bytes_live() and
+ * ir_obstack_bytes_peak().
+ */
+#ifndef FIRM_OBSTACK_OBSTACK_STAT_H
+#define FIRM_OBSTACK_OBSTACK_STAT_H
+
+/** Total size of all chunks allocated by obstacks so far. */
+extern unsigned long long obstack_chunk_bytes;
+
+/** Size of all chunks currently held by obstacks. */
+extern unsigned long long obstack_chunk_bytes_live;
+
+/** Maximum of obstack_chunk_bytes_live since it was last reset. */
+extern unsigned long long obstack_chunk_bytes_peak;
+
+#endif
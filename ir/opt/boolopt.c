@@ -17,6 +17,7 @@
 #include "irgmod.h"
 #include "irgwalk.h"
 #include "irnode_t.h"
+#include "timing_t.h"
 #include "tv.h"
 #include "debug.h"
 
@@ -694,6 +695,8 @@ restart:
 
 void opt_bool(ir_graph *const irg)
 {
+	IR_PASS_TIMING("opt_bool", irg);
+
 	bool_opt_env_t env;
 
 	/* register a debug mask */
@@ -12,6 +12,7 @@
  * transforms pointless conditional jumps into undonciditonal ones.
  */
 #include "iroptimize.h"
+#include "timing_t.h"
 
 #include <assert.h>
 #include <stdbool.h>
@@ -542,6 +543,8 @@ again:;
 
 void optimize_cf(ir_graph *irg)
 {
+	IR_PASS_TIMING("optimize_cf", irg);
+
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE
 	                         | IR_GRAPH_PROPERTY_ONE_RETURN);
 	/* we have some hacky is_Id() checks here so exchange must not use Deleted
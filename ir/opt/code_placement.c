@@ -21,6 +21,7 @@
 #include "irnode_t.h"
 #include "iredges_t.h"
 #include "irgopt.h"
+#include "timing_t.h"
 
 #ifndef NDEBUG
 static bool is_block_reachable(ir_node *block)
@@ -330,6 +331,8 @@ static void place_late(ir_graph *irg, waitq *worklist)
 /* Code Placement. */
 void place_code(ir_graph *irg)
 {
+	IR_PASS_TIMING("place_code", irg);
+
 	/* Handle graph state */
 	assure_irg_properties(irg,
 		IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES |
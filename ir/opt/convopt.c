@@ -23,6 +23,7 @@
  */
 #include <stdbool.h>
 
+#include "timing_t.h"
 #include "util.h"
 #include "iroptimize.h"
 
@@ -277,6 +278,8 @@ static void conv_opt_walker(ir_node *node, void *data)
 
 void conv_opt(ir_graph *irg)
 {
+	IR_PASS_TIMING("conv_opt", irg);
+
 	FIRM_DBG_REGISTER(dbg, "firm.opt.conv");
 
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES);
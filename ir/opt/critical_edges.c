@@ -16,6 +16,7 @@
 #include "irgwalk.h"
 #include "irnode_t.h"
 #include "irop_t.h"
+#include "timing_t.h"
 
 typedef struct cf_env {
 	bool ignore_exc_edges; /**< set if exception edges should be ignored. */
@@ -78,6 +79,8 @@ insert:;
 
 void remove_critical_cf_edges_ex(ir_graph *irg, int ignore_exception_edges)
 {
+	IR_PASS_TIMING("remove_critical_cf_edges", irg);
+
 	cf_env env;
 	env.ignore_exc_edges = ignore_exception_edges;
 	env.changed          = false;
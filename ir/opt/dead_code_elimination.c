@@ -24,7 +24,10 @@
 #include "cgana.h"
 #include "irouts.h"
 #include "iropt_t.h"
+#include "irmemory_t.h"
 #include "pmap.h"
+#include "timing_t.h"
+#include "xmalloc.h"
 
 /**
  * Reroute the inputs of a node from nodes in the old graph to copied nodes in
@@ -38,11 +41,19 @@ static void rewire_inputs(ir_node *node, void *env)
 
 static void copy_node_dce(ir_node *node, void *env)
 {
-	(void)env;
+	unsigned const *const old_points_to = (unsigned const*)env;
 	ir_node *new_node = exact_copy(node);
 	/* preserve the node numbers for easier debugging */
 	new_node->node_nr = node->node_nr;
 	set_irn_link(node, new_node);
+
+	/* keep the points-to variables, the copy gets a new index */
+	ir_graph *const irg = get_irn_irg(new_node);
+	if (old_points_to != NULL) {
+		unsigned const idx = get_irn_idx(node);
+		if (idx < irg->n_points_to)
+			irg->points_to[get_irn_idx(new_node)] = old_points_to[idx];
+	}
 }
 
 /**
@@ -54,8 +65,14 @@ static void copy_node_dce(ir_node *node, void *env)
 static void copy_graph_env(ir_graph *irg)
 {
 	/* copy nodes */
-	ir_node *anchor = irg->anchor;
-	irg_walk_in_or_dep(anchor, copy_node_dce, rewire_inputs, NULL);
+	ir_node  *anchor        = irg->anchor;
+	unsigned *old_points_to = irg->points_to;
+	if (old_points_to != NULL) {
+		/* there are at most as many reachable nodes as old indices */
+		irg->points_to = XMALLOCNZ(unsigned, irg->n_points_to);
+	}
+	irg_walk_in_or_dep(anchor, copy_node_dce, rewire_inputs, old_points_to);
+	free(old_points_to);
 
 	/* fix the anchor */
 	ir_node *new_anchor = (ir_node*)get_irn_link(anchor);
@@ -73,6 +90,8 @@ static void copy_graph_env(ir_graph *irg)
  */
 void dead_node_elimination(ir_graph *irg)
 {
+	IR_PASS_TIMING("dead_node_elimination", irg);
+
 	edges_deactivate(irg);
 
 	/* inform statistics that we started a dead-node elimination run */
@@ -83,6 +102,7 @@ void dead_node_elimination(ir_graph *irg)
 	free_irg_outs(irg);
 	free_loop_information(irg);
 	free_vrp_data(irg);
+	free_irg_alias_cache(irg);
 	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 
 	/* A quiet place, where the old obstack can rest in peace,
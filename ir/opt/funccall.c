@@ -10,6 +10,7 @@
  */
 #include <stdbool.h>
 
+#include "timing_t.h"
 #include "util.h"
 #include "opt_init.h"
 
@@ -859,6 +860,8 @@ static mtp_additional_properties check_nothrow_or_malloc(ir_graph *irg, bool top
 
 void optimize_funccalls(void)
 {
+	IR_PASS_TIMING("optimize_funccalls", NULL);
+
 	/* prepare: mark all graphs as not analyzed */
 	size_t last_idx = get_irp_last_idx();
 	ready_set = rbitset_malloc(last_idx);
@@ -9,6 +9,7 @@
  * @author   Matthias Braun
  */
 #include "iroptimize.h"
+#include "timing_t.h"
 #include "typerep.h"
 #include "type_t.h"
 #include "entity_t.h"
@@ -120,6 +121,8 @@ static void garbage_collect_in_segment(ir_type *segment)
 
 void garbage_collect_entities(void)
 {
+	IR_PASS_TIMING("garbage_collect_entities", NULL);
+
 	FIRM_DBG_REGISTER(dbg, "firm.opt.garbagecollect");
 
 	/* start a type walk for all externally visible entities */
@@ -23,6 +23,7 @@
 #include "iropt_dbg.h"
 #include "iroptimize.h"
 #include "irouts.h"
+#include "timing_t.h"
 #include "tv_t.h"
 #include "valueset.h"
 #include "irloop.h"
@@ -103,8 +104,8 @@ typedef struct pre_env {
 	char            first_iter;   /* non-zero for first fixed point iteration */
 	int             iteration;    /* iteration counter */
 #if OPTIMIZE_NODES
-	pset           *value_table;   /* standard value table*/
-	pset           *gvnpre_values; /* GVN-PRE value table */
+	cpset_t        *value_table;   /* standard value table*/
+	cpset_t        *gvnpre_values; /* GVN-PRE value table */
 #endif
 } pre_env;
 
@@ -282,6 +283,16 @@ static int compare_gvn_identities(const void *elt, const void *key)
 	return !a->op->ops.attrs_equal(a, b);
 }
 
+static int gvn_identities_equal(const void *elt, const void *key)
+{
+	return !compare_gvn_identities(elt, key);
+}
+
+static unsigned hash_gvn_identity(const void *node)
+{
+	return ir_node_hash((const ir_node*)node);
+}
+
 /**
  * Identify does a lookup in the GVN value table.
  * To be used when no new GVN values are to be created.
@@ -1858,6 +1869,8 @@ static void gvn_pre(ir_graph *irg, pre_env *env)
  */
 void do_gvn_pre(ir_graph *irg)
 {
+	IR_PASS_TIMING("do_gvn_pre", irg);
+
 	pre_env               env;
 	ir_nodeset_t          keeps;
 	optimization_state_t  state;
@@ -1911,10 +1924,11 @@ void do_gvn_pre(ir_graph *irg)
 	   its block. */
 	set_opt_global_cse(1);
 	/* new_identities() */
-	if (irg->value_table != NULL)
-		del_pset(irg->value_table);
-	/* initially assumed nodes in pset are 512 */
-	irg->value_table = new_pset(compare_gvn_identities, 512);
+	del_identities(irg);
+	/* initially assumed nodes in the set are 512 */
+	irg->value_table = XMALLOC(cpset_t);
+	cpset_init_size(irg->value_table, hash_gvn_identity, gvn_identities_equal,
+	                512);
 #if OPTIMIZE_NODES
 	env.gvnpre_values = irg->value_table;
 #endif
@@ -1941,7 +1955,7 @@ void do_gvn_pre(ir_graph *irg)
 
 #if OPTIMIZE_NODES
 	irg->value_table = env.value_table;
-	del_pset(irg->value_table);
+	del_identities(irg);
 	irg->value_table = env.gvnpre_values;
 #endif
 
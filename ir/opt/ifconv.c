@@ -22,6 +22,7 @@
 #include "irnode_t.h"
 #include "iroptimize.h"
 #include "irtools.h"
+#include "timing_t.h"
 
 /**
  * Environment for if-conversion.
@@ -433,6 +434,8 @@ static void fill_waitq(ir_node *node, void *env) {
 
 void opt_if_conv_cb(ir_graph *irg, arch_allow_ifconv_func callback)
 {
+	IR_PASS_TIMING("opt_if_conv", irg);
+
 	walker_env  env   = { .allow_ifconv = callback, .changed = false };
 	pdeq       *waitq = new_pdeq();
 
@@ -10,6 +10,7 @@
  * @author  Christoph Mallon, Matthias Braun
  */
 #include "iroptimize.h"
+#include "timing_t.h"
 
 #include <assert.h>
 #include <stdbool.h>
@@ -637,6 +638,8 @@ static void thread_jumps(ir_node* block, void* data)
 
 void opt_jumpthreading(ir_graph* irg)
 {
+	IR_PASS_TIMING("opt_jumpthreading", irg);
+
 	assure_irg_properties(irg,
 		IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE
 		| IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
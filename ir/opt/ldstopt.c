@@ -33,6 +33,7 @@
 #include "iroptimize.h"
 #include "irtools.h"
 #include "set.h"
+#include "timing_t.h"
 #include "tv_t.h"
 #include "type_t.h"
 #include "util.h"
@@ -382,6 +383,9 @@ static bool is_contained_in(
 	/* simple case: previous value has the same mode */
 	if (load_mode == prev_mode)
 		return true;
+	/* parts of vectors cannot be extracted */
+	if (mode_is_vector(load_mode) || mode_is_vector(prev_mode))
+		return false;
 
 	ir_mode_arithmetic prev_arithmetic = get_mode_arithmetic(prev_mode);
 	ir_mode_arithmetic load_arithmetic = get_mode_arithmetic(load_mode);
@@ -2252,11 +2256,14 @@ void combine_memops(ir_graph *irg)
 	if (!be_get_backend_param()->unaligned_memaccess_supported)
 		return;
 
+	IR_PASS_TIMING("combine_memops", irg);
 	irg_walk_graph(irg, combine_memop, NULL, NULL);
 }
 
 void optimize_load_store(ir_graph *irg)
 {
+	IR_PASS_TIMING("optimize_load_store", irg);
+
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE
 	                         | IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
 	                         | IR_GRAPH_PROPERTY_NO_CRITICAL_EDGES
@@ -13,6 +13,7 @@
 #include <math.h>
 #include <stdbool.h>
 
+#include "timing_t.h"
 #include "util.h"
 #include "array.h"
 #include "debug.h"
@@ -2331,7 +2332,7 @@ static void loop_optimization(ir_graph *const irg, loop_op_t const loop_op)
 	}
 
 	/* Set all links to NULL */
-	irg_walk_graph(irg, firm_clear_link, NULL, NULL);
+	irg_walk_graph_unordered(irg, firm_clear_link, NULL);
 
 	for (size_t i = 0; i < ARR_LEN(loops); ++i) {
 		ir_loop *const loop = loops[i];
@@ -2346,7 +2347,7 @@ static void loop_optimization(ir_graph *const irg, loop_op_t const loop_op)
 
 		/* Set links to NULL
 		 * TODO Still necessary? */
-		irg_walk_graph(irg, firm_clear_link, NULL, NULL);
+		irg_walk_graph_unordered(irg, firm_clear_link, NULL);
 	}
 
 	print_stats();
@@ -2359,16 +2360,19 @@ static void loop_optimization(ir_graph *const irg, loop_op_t const loop_op)
 
 void do_loop_unrolling(ir_graph *const irg)
 {
+	IR_PASS_TIMING("do_loop_unrolling", irg);
 	loop_optimization(irg, loop_op_unrolling);
 }
 
 void do_loop_inversion(ir_graph *const irg)
 {
+	IR_PASS_TIMING("do_loop_inversion", irg);
 	loop_optimization(irg, loop_op_inversion);
 }
 
 void do_loop_peeling(ir_graph *const irg)
 {
+	IR_PASS_TIMING("do_loop_peeling", irg);
 	loop_optimization(irg, loop_op_peeling);
 }
 
@@ -11,6 +11,7 @@
 // TODO might make sense to merge this optimization with fp-vrp
 
 #include "iroptimize.h"
+#include "timing_t.h"
 
 #include <stdbool.h>
 #include "debug.h"
@@ -76,6 +77,8 @@ static void fill_nodemap(ir_node *node, void *data) {
 
 void occult_consts(ir_graph *irg)
 {
+	IR_PASS_TIMING("occult_consts", irg);
+
 	FIRM_DBG_REGISTER(dbg, "firm.opt.occults");
 
 	constbits_analyze(irg);
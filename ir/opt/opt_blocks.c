@@ -21,6 +21,7 @@
 #include "irgwalk.h"
 #include "set.h"
 #include "debug.h"
+#include "timing_t.h"
 #include "util.h"
 
 /* define this for general block shaping: congruent blocks
@@ -1163,6 +1164,8 @@ static void add_roots(ir_graph *irg, environment_t *env)
 /* Combines congruent end blocks into one. */
 void shape_blocks(ir_graph *irg)
 {
+	IR_PASS_TIMING("shape_blocks", irg);
+
 	environment_t env;
 	block_t       *bl;
 	int           res, n;
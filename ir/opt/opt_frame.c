@@ -13,6 +13,7 @@
  */
 #include "iroptimize.h"
 #include "irgraph_t.h"
+#include "timing_t.h"
 #include "type_t.h"
 #include "irouts_t.h"
 #include "iredges.h"
@@ -28,6 +29,8 @@ void opt_frame_irg(ir_graph *irg)
 	if (n <= 0)
 		return;
 
+	IR_PASS_TIMING("opt_frame_irg", irg);
+
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS);
 	irp_reserve_resources(irp, IRP_RESOURCE_ENTITY_LINK);
 
@@ -21,4 +21,6 @@ void firm_init_scalar_replace(void);
 
 void firm_init_loop_opt(void);
 
+void firm_init_vectorize(void);
+
 #endif
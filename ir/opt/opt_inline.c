@@ -9,6 +9,7 @@
  * @author   Michael Beck, Goetz Lindenmaier
  */
 #include <limits.h>
+#include <math.h>
 #include <stdbool.h>
 #include <assert.h>
 
@@ -16,6 +17,7 @@
 #include "irgraph_t.h"
 #include "irprog_t.h"
 #include "entity_t.h"
+#include "timing_t.h"
 
 #include "iroptimize.h"
 #include "ircons_t.h"
@@ -44,6 +46,9 @@
 #include "irtools.h"
 #include "iropt_dbg.h"
 #include "irnodemap.h"
+#include "execfreq.h"
+#include "irprofile.h"
+#include "statev_t.h"
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
 
@@ -646,6 +651,7 @@ typedef struct call_entry {
 	list_head  list;        /**< List head for linking the next one. */
 	int        loop_depth;  /**< The loop depth of this call. */
 	int        benefice;    /**< The calculated benefice of this call. */
+	double     freq;        /**< Executions of this call (profiled inliner). */
 	bool       all_const:1; /**< Set if this call has only constant parameters. */
 } call_entry;
 
@@ -662,6 +668,7 @@ typedef struct {
 	unsigned  n_call_nodes_orig; /**< for statistics */
 	unsigned  n_callers;         /**< Number of known graphs that call this graphs. */
 	unsigned  n_callers_orig;    /**< for statistics */
+	double    entry_freq;        /**< Executions of this graph (profiled inliner). */
 	unsigned  got_inline:1;      /**< Set, if at least one call inside this graph was inlined. */
 	unsigned  recursive:1;       /**< Set, if this function is self recursive. */
 } inline_irg_env;
@@ -681,6 +688,7 @@ static inline_irg_env *alloc_inline_irg_env(void)
 	env->n_call_nodes_orig = 0;
 	env->n_callers         = 0;
 	env->n_callers_orig    = 0;
+	env->entry_freq        = 0.0;
 	env->got_inline        = 0;
 	env->recursive         = 0;
 	return env;
@@ -763,6 +771,7 @@ static void collect_calls2(ir_node *node, void *ctx)
 		entry->callee     = callee;
 		entry->loop_depth = get_irn_loop(get_nodes_block(node))->depth;
 		entry->benefice   = 0;
+		entry->freq       = 0.0;
 		entry->all_const  = false;
 
 		list_add_tail(&entry->list, &x->calls);
@@ -784,6 +793,7 @@ static call_entry *duplicate_call_entry(const call_entry *entry,
 	nentry->call       = new_call;
 	nentry->callee     = entry->callee;
 	nentry->benefice   = entry->benefice;
+	nentry->freq       = entry->freq;
 	nentry->loop_depth = entry->loop_depth + loop_depth_delta;
 	nentry->all_const  = entry->all_const;
 
@@ -1248,27 +1258,15 @@ static void inline_into(ir_graph *irg, unsigned maxsize,
 	del_pqueue(pqueue);
 }
 
-/*
- * Heuristic inliner. Calculates a benefice value for every call and inlines
- * those calls with a value higher than the threshold.
+/**
+ * Extends all graphs by a temporary data structure for inlining and
+ * precomputes the information in it.
  */
-void inline_functions(unsigned maxsize, int inline_threshold,
-                      opt_ptr after_inline_opt)
+static void collect_inline_envs(ir_graph **irgs, size_t n_irgs)
 {
-	ir_graph *rem = current_ir_graph;
-	obstack_init(&temp_obst);
-
-	ir_graph **irgs = create_irg_list();
-
-	/* a map for the copied graphs, used to inline recursive calls */
-	pmap *copied_graphs = pmap_create();
-
-	/* extend all irgs by a temporary data structure for inlining. */
-	size_t n_irgs = get_irp_n_irgs();
 	for (size_t i = 0; i < n_irgs; ++i)
 		set_irg_link(irgs[i], alloc_inline_irg_env());
 
-	/* Precompute information in temporary data structure. */
 	wenv_t wenv;
 	wenv.ignore_callers = false;
 	for (size_t i = 0; i < n_irgs; ++i) {
@@ -1280,6 +1278,27 @@ void inline_functions(unsigned maxsize, int inline_threshold,
 		assure_loopinfo(irg);
 		irg_walk_graph(irg, NULL, collect_calls2, &wenv);
 	}
+}
+
+/*
+ * Heuristic inliner. Calculates a benefice value for every call and inlines
+ * those calls with a value higher than the threshold.
+ */
+void inline_functions(unsigned maxsize, int inline_threshold,
+                      opt_ptr after_inline_opt)
+{
+	IR_PASS_TIMING("inline_functions", NULL);
+
+	ir_graph *rem = current_ir_graph;
+	obstack_init(&temp_obst);
+
+	ir_graph **irgs = create_irg_list();
+
+	/* a map for the copied graphs, used to inline recursive calls */
+	pmap *copied_graphs = pmap_create();
+
+	size_t n_irgs = get_irp_n_irgs();
+	collect_inline_envs(irgs, n_irgs);
 
 	/* -- and now inline. -- */
 	for (size_t i = 0; i < n_irgs; ++i) {
@@ -1319,6 +1338,263 @@ void inline_functions(unsigned maxsize, int inline_threshold,
 	current_ir_graph = rem;
 }
 
+/**
+ * Reports an inlining decision of the profile guided inliner.
+ */
+static void report_decision(ir_graph *caller, const call_entry *entry,
+                            const char *reason)
+{
+	DB((dbg, LEVEL_2, "%+F call to %+F (freq %.1f): %s\n", caller,
+	    entry->callee, entry->freq, reason));
+	if (!stat_ev_enabled)
+		return;
+
+	const inline_irg_env *callee_env
+		= (const inline_irg_env*)get_irg_link(entry->callee);
+	stat_ev_ctx_push_str("inline_caller", get_entity_ld_name(get_irg_entity(caller)));
+	stat_ev_ctx_push_str("inline_callee",
+	                     get_entity_ld_name(get_irg_entity(entry->callee)));
+	stat_ev_dbl("inline_call_freq", entry->freq);
+	stat_ev_int("inline_callee_size", callee_env->n_nodes);
+	stat_ev(reason);
+	stat_ev_ctx_pop("inline_callee");
+	stat_ev_ctx_pop("inline_caller");
+}
+
+/**
+ * Computes how often each graph and each call is executed. The counts are
+ * measured if profile data is loaded, otherwise estimated: every graph which
+ * may be called from outside is assumed to be executed once.
+ *
+ * @param irgs  the graphs, callees before callers
+ */
+static double compute_call_freqs(ir_graph **irgs, size_t n_irgs)
+{
+	if (ir_profile_has_data()) {
+		ir_create_execfreqs_from_profile();
+		for (size_t i = 0; i < n_irgs; ++i) {
+			ir_graph       *irg   = irgs[i];
+			inline_irg_env *env   = (inline_irg_env*)get_irg_link(irg);
+			ir_node        *start = get_irg_start_block(irg);
+			env->entry_freq = ir_profile_get_block_execcount(start);
+		}
+	} else {
+		for (size_t i = 0; i < n_irgs; ++i) {
+			ir_graph       *irg = irgs[i];
+			inline_irg_env *env = (inline_irg_env*)get_irg_link(irg);
+			ir_estimate_execfreq(irg);
+			if (env->n_callers == 0
+			    || entity_is_externally_visible(get_irg_entity(irg)))
+				env->entry_freq = 1.0;
+		}
+		/* propagate from the callers to the callees, calls closing a cycle
+		 * are not propagated any further */
+		for (size_t i = n_irgs; i-- > 0; ) {
+			inline_irg_env *env = (inline_irg_env*)get_irg_link(irgs[i]);
+			list_for_each_entry(call_entry, entry, &env->calls, list) {
+				inline_irg_env *callee_env
+					= (inline_irg_env*)get_irg_link(entry->callee);
+				ir_node *block = get_nodes_block(entry->call);
+				callee_env->entry_freq
+					+= env->entry_freq * get_block_execfreq(block);
+			}
+		}
+	}
+
+	double max_freq = 0.0;
+	for (size_t i = 0; i < n_irgs; ++i) {
+		inline_irg_env *env = (inline_irg_env*)get_irg_link(irgs[i]);
+		list_for_each_entry(call_entry, entry, &env->calls, list) {
+			ir_node *block = get_nodes_block(entry->call);
+			entry->freq = env->entry_freq * get_block_execfreq(block);
+			if (entry->freq > max_freq)
+				max_freq = entry->freq;
+		}
+	}
+	return max_freq;
+}
+
+/**
+ * Returns the priority of a call for the profile guided inliner: calls saving
+ * many executed calls per inlined node come first.
+ */
+static int get_call_priority(const call_entry *entry)
+{
+	const inline_irg_env *callee_env
+		= (const inline_irg_env*)get_irg_link(entry->callee);
+	double score = entry->freq / (callee_env->n_nodes + 1);
+	/* the pqueue needs integers, a logarithmic scale keeps the order */
+	double priority = log2(score) * 1024.0;
+	if (priority > INT_MAX)
+		return INT_MAX;
+	if (priority < INT_MIN + 1)
+		return INT_MIN + 1;
+	return (int)priority;
+}
+
+typedef struct profiled_env_t {
+	pqueue_t *pqueue;     /**< calls ordered by priority */
+	double    cold_freq;  /**< calls executed less often are not inlined */
+	unsigned  maxsize;    /**< maximal size of a graph */
+	size_t    budget;     /**< remaining number of nodes to add */
+} profiled_env_t;
+
+/**
+ * Puts a call into the queue unless it cannot or should not be inlined.
+ */
+static void push_hot_call(profiled_env_t *penv, call_entry *entry)
+{
+	ir_graph                  *caller       = get_irn_irg(entry->call);
+	ir_entity                 *caller_ent   = get_irg_entity(caller);
+	mtp_additional_properties  caller_props
+		= get_entity_additional_properties(caller_ent);
+	ir_entity                 *callee_ent   = get_irg_entity(entry->callee);
+	mtp_additional_properties  callee_props
+		= get_entity_additional_properties(callee_ent);
+
+	if (callee_props & (mtp_property_noinline | mtp_property_noreturn)) {
+		report_decision(caller, entry, "inline_forbidden");
+	} else if (entry->callee == caller) {
+		report_decision(caller, entry, "inline_recursive");
+	} else if (!(callee_props & mtp_property_always_inline)
+	           && caller_props & mtp_property_always_inline) {
+		/* see maybe_push_call() */
+		report_decision(caller, entry, "inline_into_always_inline");
+	} else if (callee_props & mtp_property_always_inline) {
+		pqueue_put(penv->pqueue, entry, INT_MAX);
+	} else if (entry->freq <= 0.0 || entry->freq < penv->cold_freq) {
+		report_decision(caller, entry, "inline_cold");
+	} else {
+		pqueue_put(penv->pqueue, entry, get_call_priority(entry));
+	}
+}
+
+/**
+ * Inlines a call chosen by the profile guided inliner and queues the calls
+ * copied from the callee.
+ */
+static void inline_hot_call(profiled_env_t *penv, call_entry *entry)
+{
+	ir_graph       *caller     = get_irn_irg(entry->call);
+	inline_irg_env *env        = (inline_irg_env*)get_irg_link(caller);
+	ir_graph       *callee     = entry->callee;
+	inline_irg_env *callee_env = (inline_irg_env*)get_irg_link(callee);
+	ir_entity      *callee_ent = get_irg_entity(callee);
+	bool            always
+		= get_entity_additional_properties(callee_ent)
+		& mtp_property_always_inline;
+	if (!always) {
+		if (env->n_nodes + callee_env->n_nodes > penv->maxsize) {
+			report_decision(caller, entry, "inline_too_big");
+			return;
+		}
+		if (callee_env->n_nodes > penv->budget) {
+			report_decision(caller, entry, "inline_budget");
+			return;
+		}
+	}
+
+	current_ir_graph = caller;
+	ir_reserve_resources(caller, IR_RESOURCE_IRN_LINK|IR_RESOURCE_PHI_LIST);
+	collect_phiprojs_and_start_block_nodes(caller);
+	ir_reserve_resources(callee, IR_RESOURCE_IRN_LINK);
+	if (!inline_method(entry->call, callee)) {
+		ir_free_resources(callee, IR_RESOURCE_IRN_LINK);
+		ir_free_resources(caller, IR_RESOURCE_IRN_LINK|IR_RESOURCE_PHI_LIST);
+		report_decision(caller, entry, "inline_impossible");
+		return;
+	}
+	report_decision(caller, entry, "inline_hot");
+
+	list_del(&entry->list);
+	env->got_inline = 1;
+	--env->n_call_nodes;
+
+	/* the calls of the callee are executed as often as before relative to
+	 * the callee's entry */
+	double scale = callee_env->entry_freq > 0.0
+	             ? entry->freq / callee_env->entry_freq : 0.0;
+	list_for_each_entry(call_entry, centry, &callee_env->calls, list) {
+		ir_node *new_call = (ir_node*)get_irn_link(centry->call);
+		if (get_irn_irg(new_call) != caller)
+			continue;
+		assert(is_Call(new_call));
+
+		inline_irg_env *target_env
+			= (inline_irg_env*)get_irg_link(centry->callee);
+		++target_env->n_callers;
+
+		call_entry *new_entry
+			= duplicate_call_entry(centry, new_call, entry->loop_depth);
+		new_entry->freq = centry->freq * scale;
+		list_add_tail(&new_entry->list, &env->calls);
+		push_hot_call(penv, new_entry);
+	}
+	ir_free_resources(callee, IR_RESOURCE_IRN_LINK);
+	ir_free_resources(caller, IR_RESOURCE_IRN_LINK|IR_RESOURCE_PHI_LIST);
+
+	env->n_call_nodes += callee_env->n_call_nodes;
+	env->n_nodes      += callee_env->n_nodes;
+	--callee_env->n_callers;
+	penv->budget -= MIN(penv->budget, callee_env->n_nodes);
+}
+
+/*
+ * Profile guided inliner. Inlines the most frequently executed calls relative
+ * to the callee size first until the code growth budget is used up.
+ */
+void inline_functions_profiled(unsigned maxsize, unsigned growth_percent,
+                               double cold_fraction, opt_ptr after_inline_opt)
+{
+	IR_PASS_TIMING("inline_functions_profiled", NULL);
+
+	ir_graph *rem = current_ir_graph;
+	obstack_init(&temp_obst);
+
+	ir_graph **irgs   = create_irg_list();
+	size_t     n_irgs = get_irp_n_irgs();
+	collect_inline_envs(irgs, n_irgs);
+
+	double max_freq    = compute_call_freqs(irgs, n_irgs);
+	size_t total_nodes = 0;
+	for (size_t i = 0; i < n_irgs; ++i) {
+		inline_irg_env *env = (inline_irg_env*)get_irg_link(irgs[i]);
+		total_nodes += env->n_nodes;
+	}
+
+	profiled_env_t penv = {
+		.pqueue    = new_pqueue(),
+		.cold_freq = max_freq * cold_fraction,
+		.maxsize   = maxsize,
+		.budget    = total_nodes * growth_percent / 100,
+	};
+	stat_ev_ull("inline_budget", penv.budget);
+
+	for (size_t i = 0; i < n_irgs; ++i) {
+		inline_irg_env *env = (inline_irg_env*)get_irg_link(irgs[i]);
+		list_for_each_entry(call_entry, entry, &env->calls, list) {
+			push_hot_call(&penv, entry);
+		}
+	}
+	while (!pqueue_empty(penv.pqueue)) {
+		call_entry *entry = (call_entry*)pqueue_pop_front(penv.pqueue);
+		inline_hot_call(&penv, entry);
+	}
+	del_pqueue(penv.pqueue);
+	stat_ev_ull("inline_budget_left", penv.budget);
+
+	for (size_t i = 0; i < n_irgs; ++i) {
+		ir_graph       *irg = irgs[i];
+		inline_irg_env *env = (inline_irg_env*)get_irg_link(irg);
+		if (env->got_inline && after_inline_opt != NULL)
+			after_inline_opt(irg);
+	}
+
+	free(irgs);
+	obstack_free(&temp_obst, NULL);
+	current_ir_graph = rem;
+}
+
 void firm_init_inline(void)
 {
 	FIRM_DBG_REGISTER(dbg, "firm.opt.inline");
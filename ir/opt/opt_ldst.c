@@ -10,6 +10,7 @@
  * @author  Michael Beck
  */
 
+#include "timing_t.h"
 #include "util.h"
 #include "irnode_t.h"
 #include "irflag_t.h"
@@ -1258,7 +1259,7 @@ static int backward_antic(block_t *bl)
 static void replace_load(memop_t *op)
 {
 	ir_node *load = op->node;
-	ir_node *def  = skip_Id(op->replace);
+	ir_node *def  = op->replace != NULL ? skip_Id(op->replace) : NULL;
 	ir_node *proj;
 	ir_mode *mode;
 
@@ -1432,7 +1433,7 @@ static void reroute_all_mem_users(ir_node *omem, ir_node *nmem)
 	}
 
 	/* all edges previously point to omem now point to nmem */
-	nmem->o.out = omem->o.out;
+	set_irn_out_edges(nmem, get_irn_out_edges(omem));
 }
 
 /**
@@ -1473,7 +1474,7 @@ static void reroute_mem_through(ir_node *omem, ir_node *nmem, ir_node *pass_bl)
 	   temporary obstack here. This should be no problem, as we invalidate the
 	   edges at the end either. */
 	/* first entry is used for the length */
-	nmem->o.out = new_out;
+	set_irn_out_edges(nmem, new_out);
 }
 
 /**
@@ -1753,6 +1754,8 @@ static void insert_Loads_upwards(void)
 
 void opt_ldst(ir_graph *irg)
 {
+	IR_PASS_TIMING("opt_ldst", irg);
+
 	block_t *bl;
 
 	FIRM_DBG_REGISTER(dbg, "firm.opt.ldst");
@@ -1786,7 +1789,8 @@ void opt_ldst(ir_graph *irg)
 	env.id_2_address  = NEW_ARR_F(ir_node *, 0);
 #endif
 
-	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_BLOCK_MARK);
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_BLOCK_MARK
+	                          | IR_RESOURCE_PHI_LIST);
 
 	/* first step: allocate block entries. Note that some blocks might be
 	   unreachable here. Using the normal walk ensures that ALL blocks are initialized. */
@@ -1878,7 +1882,8 @@ no_changes:
 		confirm_irg_properties(irg, IR_GRAPH_PROPERTIES_ALL);
 	}
 
-	ir_free_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_BLOCK_MARK);
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_BLOCK_MARK
+	                       | IR_RESOURCE_PHI_LIST);
 	ir_nodehashmap_destroy(&env.adr_map);
 	obstack_free(&env.obst, NULL);
 
@@ -34,6 +34,7 @@
 #include "irtools.h"
 #include "obst.h"
 #include "set.h"
+#include "timing_t.h"
 #include "tv.h"
 #include "util.h"
 
@@ -1187,6 +1188,8 @@ static void lftr(ir_graph *irg, iv_env *env)
 /* Remove any Phi cycles with only one real input. */
 void remove_phi_cycles(ir_graph *irg)
 {
+	IR_PASS_TIMING("remove_phi_cycles", irg);
+
 	assure_irg_properties(irg,
 		IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE
 		| IR_GRAPH_PROPERTY_CONSISTENT_OUTS
@@ -1215,7 +1218,7 @@ void remove_phi_cycles(ir_graph *irg)
 	 * This can improve the placement of new nodes.
 	 */
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
-	irg_walk_graph(irg, NULL, firm_clear_link, NULL);
+	irg_walk_graph_unordered(irg, firm_clear_link, NULL);
 
 	/* calculate the post order number for blocks. */
 	irg_out_block_walk(get_irg_start_block(irg), NULL, assign_po, &env);
@@ -1304,6 +1307,8 @@ static void fix_adds_and_subs(ir_node *irn, void *ctx)
 /* Performs Operator Strength Reduction for the passed graph. */
 void opt_osr(ir_graph *irg, unsigned flags)
 {
+	IR_PASS_TIMING("opt_osr", irg);
+
 	FIRM_DBG_REGISTER(dbg, "firm.opt.osr");
 
 	assure_irg_properties(irg,
@@ -1332,7 +1337,7 @@ void opt_osr(ir_graph *irg, unsigned flags)
 	 * This can improve the placement of new nodes.
 	 */
 	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
-	irg_walk_graph(irg, NULL, firm_clear_link, NULL);
+	irg_walk_graph_unordered(irg, firm_clear_link, NULL);
 
 	irg_block_edges_walk(get_irg_start_block(irg), NULL, assign_po, &env);
 
@@ -9,6 +9,7 @@
  * @author  Christoph Mallon
  */
 #include "iroptimize.h"
+#include "timing_t.h"
 
 #include "array.h"
 #include "debug.h"
@@ -496,6 +497,8 @@ static void eliminate_sync_edges(ir_graph *irg)
 
 void opt_parallelize_mem(ir_graph *irg)
 {
+	IR_PASS_TIMING("opt_parallelize_mem", irg);
+
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
 	                           | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
 	irg_walk_blkwise_dom_top_down(irg, NULL, walker, NULL);
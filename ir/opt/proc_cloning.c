@@ -17,6 +17,7 @@
  * in the function graph. They aren't be passed as parameters.
  */
 #include "iroptimize.h"
+#include "timing_t.h"
 #include "tv.h"
 #include "set.h"
 #include "irprog_t.h"
@@ -572,6 +573,8 @@ restart:
 
 void proc_cloning(float threshold)
 {
+	IR_PASS_TIMING("proc_cloning", NULL);
+
 	DEBUG_ONLY(firm_dbg_module_t *dbg;)
 
 	/* register a debug mask */
@@ -27,6 +27,7 @@
 #include "pdeq.h"
 #include "debug.h"
 #include "panic.h"
+#include "timing_t.h"
 
 #include "unionfind.h"
 #include "plist.h"
@@ -2080,6 +2081,8 @@ static void do_chaining(ir_graph *irg)
  */
 void optimize_reassociation(ir_graph *irg)
 {
+	IR_PASS_TIMING("optimize_reassociation", irg);
+
 	assert(get_irg_pinned(irg) != op_pin_state_floats &&
 	       "Reassociation needs pinned graph to work properly");
 
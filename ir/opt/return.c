@@ -15,6 +15,7 @@
 #include "ircons_t.h"
 #include "irnode_t.h"
 #include "irgmod.h"
+#include "timing_t.h"
 #include "util.h"
 #include "raw_bitset.h"
 
@@ -40,6 +41,8 @@
  */
 void normalize_one_return(ir_graph *irg)
 {
+	IR_PASS_TIMING("normalize_one_return", irg);
+
 	/* look, if we have more than one return */
 	ir_node *endbl = get_irg_end_block(irg);
 	int      n     = get_Block_n_cfgpreds(endbl);
@@ -202,6 +205,8 @@ static bool can_move_ret(ir_node *ret)
  */
 void normalize_n_returns(ir_graph *irg)
 {
+	IR_PASS_TIMING("normalize_n_returns", irg);
+
 	/* First, link all returns:
 	 * These must be predecessors of the endblock.
 	 * Place Returns that can be moved on list, all others
@@ -27,6 +27,7 @@
 #include "pset.h"
 #include "scalar_replace.h"
 #include "set.h"
+#include "timing_t.h"
 #include "tv.h"
 #include "util.h"
 #include "xmalloc.h"
@@ -562,6 +563,8 @@ static void do_scalar_replacements(ir_graph *irg, pset *members, unsigned nvals,
  */
 void scalar_replacement_opt(ir_graph *irg)
 {
+	IR_PASS_TIMING("scalar_replacement_opt", irg);
+
 	assure_irg_properties(irg, IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE
 	                         | IR_GRAPH_PROPERTY_CONSISTENT_OUTS
 	                         | IR_GRAPH_PROPERTY_NO_TUPLES);
@@ -27,6 +27,7 @@
 #include "irouts_t.h"
 #include "irhooks.h"
 #include "ircons_t.h"
+#include "timing_t.h"
 #include "util.h"
 
 DEBUG_ONLY(static firm_dbg_module_t *dbg;)
@@ -585,6 +586,8 @@ static unsigned find_tail_rec_possibilities(tr_env *env, ir_graph *irg)
 
 void opt_tail_rec_irg(ir_graph *irg)
 {
+	IR_PASS_TIMING("opt_tail_rec_irg", irg);
+
 	FIRM_DBG_REGISTER(dbg, "firm.opt.tailrec");
 	assure_irg_properties(irg,
 		IR_GRAPH_PROPERTY_MANY_RETURNS
@@ -0,0 +1,983 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Vectorization of innermost counting loops.
+ *
+ * A loop like
+ *
+ *     for (i = i0; i < n; ++i) a[i] = b[i] + c[i];
+ *
+ * gets preceded by a loop which handles vector_size/sizeof(a[0]) iterations
+ * at once with Loads, Stores and arithmetic of a vector mode. The vector loop
+ * runs as long as enough iterations remain, the original loop then handles
+ * the rest.
+ *
+ * Only loops consisting of a header and a single body block (or a single
+ * block for do-while loops) are handled. Their only loop carried values must
+ * be memory and an induction variable incremented by 1. All memory accesses
+ * must have the same size and addresses of the form
+ * base + i * size + offset. If the bases of a Store and another access may
+ * alias, their distance is checked before entering the vector loop.
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "array.h"
+#include "be.h"
+#include "debug.h"
+#include "ircons_t.h"
+#include "irflag_t.h"
+#include "irgmod.h"
+#include "irgraph_t.h"
+#include "irgwalk.h"
+#include "irloop_t.h"
+#include "irmemory.h"
+#include "irmode_t.h"
+#include "irnode_t.h"
+#include "irnodemap.h"
+#include "irnodeset.h"
+#include "iroptimize.h"
+#include "irtools.h"
+#include "opt_init.h"
+#include "pmap.h"
+#include "timing_t.h"
+#include "tv_t.h"
+#include "typerep.h"
+#include "util.h"
+#include "xmalloc.h"
+
+DEBUG_ONLY(static firm_dbg_module_t *dbg;)
+
+/** An address of the form base + coef * i + offset. */
+typedef struct vec_address_t {
+	ir_node *base;     /**< loop invariant base pointer */
+	long     coef;     /**< factor of the induction variable in bytes */
+	long     offset;   /**< constant offset in bytes */
+	bool     variable; /**< the address contains further invariant terms */
+} vec_address_t;
+
+/** A Load or Store in the loop. */
+typedef struct vec_access_t {
+	ir_node      *node;
+	vec_address_t addr;
+} vec_access_t;
+
+/**
+ * A pair of accesses to possibly overlapping objects. Their distance
+ * base1 - base2 + offset must not be smaller than a vector.
+ */
+typedef struct vec_check_t {
+	ir_node *base1;
+	ir_node *base2;
+	long     offset;
+} vec_check_t;
+
+/** A linear function coef * i + offset of the induction variable. */
+typedef struct vec_linear_t {
+	long coef;
+	long offset;
+	bool variable; /**< further invariant terms are added */
+} vec_linear_t;
+
+typedef struct vec_loop_t {
+	ir_node      *header;     /**< block with the Phis */
+	ir_node      *body;       /**< the other block of the loop or the header */
+	int           entry_pos;  /**< predecessor of the header entering the loop */
+	int           back_pos;   /**< predecessor of the header from the body */
+	ir_node      *cond;       /**< the Cond leaving the loop */
+	ir_node      *iv;         /**< the induction variable */
+	ir_node      *iv_next;    /**< the induction variable plus one */
+	ir_node      *mem_phi;    /**< the memory Phi */
+	ir_node      *bound;      /**< the loop invariant end of the iteration */
+	ir_relation   relation;   /**< relation of iv and bound to stay in loop */
+	bool          check_next; /**< the condition tests iv_next instead of iv */
+	unsigned      n_memops;   /**< number of Loads and Stores in the loop */
+	unsigned      elem_size;  /**< size of the accessed elements in bytes */
+	unsigned      n_lanes;    /**< number of elements in a vector */
+	vec_access_t *accesses;   /**< analyzed Loads and Stores */
+	vec_check_t  *checks;     /**< distances to check before the vector loop */
+	ir_nodeset_t  visited;    /**< analyzed nodes */
+	bool          failed;     /**< the loop contains unsupported nodes */
+	ir_nodemap    map;        /**< vector counterparts of the loop nodes */
+	pmap         *types;      /**< array types for the vector accesses */
+	ir_node      *pre_block;  /**< block in front of the vector loop */
+	ir_node      *vec_block;  /**< body of the vector loop */
+	ir_node      *vec_iv;     /**< induction variable of the vector loop */
+	ir_node      *vec_mem;    /**< memory Phi of the vector loop */
+} vec_loop_t;
+
+static bool is_in_loop(const vec_loop_t *vl, const ir_node *node)
+{
+	const ir_node *block = is_Block(node) ? node : get_nodes_block(node);
+	return block == vl->header || block == vl->body;
+}
+
+static bool is_supported_mode(const ir_mode *mode)
+{
+	if (mode_is_int(mode))
+		return get_mode_size_bits(mode) <= be_get_machine_size();
+	if (mode_is_float(mode))
+		return get_mode_size_bits(mode) == 32
+		    || get_mode_size_bits(mode) == 64;
+	return false;
+}
+
+static bool is_supported_op(const ir_node *node)
+{
+	ir_mode *mode = get_irn_mode(node);
+	switch (get_irn_opcode(node)) {
+	case iro_Add:
+	case iro_Sub:
+		return true;
+	case iro_And:
+	case iro_Eor:
+	case iro_Or:
+		return mode_is_int(mode);
+	case iro_Mul:
+		return mode_is_float(mode);
+	default:
+		return false;
+	}
+}
+
+static bool get_const_long(const ir_node *node, long *value)
+{
+	if (!is_Const(node))
+		return false;
+	ir_tarval *tv = get_Const_tarval(node);
+	if (!tarval_is_long(tv))
+		return false;
+	*value = get_tarval_long(tv);
+	return true;
+}
+
+/**
+ * Decomposes the integer value @p node into a linear function of the
+ * induction variable.
+ */
+static bool analyze_index(const vec_loop_t *vl, ir_node *node,
+                          vec_linear_t *lin)
+{
+	lin->coef     = 0;
+	lin->offset   = 0;
+	lin->variable = false;
+	if (node == vl->iv) {
+		lin->coef = 1;
+		return true;
+	}
+	if (!is_in_loop(vl, node)) {
+		if (!get_const_long(node, &lin->offset))
+			lin->variable = true;
+		return true;
+	}
+
+	vec_linear_t l;
+	vec_linear_t r;
+	long         factor;
+	switch (get_irn_opcode(node)) {
+	case iro_Add:
+		if (!analyze_index(vl, get_Add_left(node), &l)
+		    || !analyze_index(vl, get_Add_right(node), &r))
+			return false;
+		lin->coef     = l.coef + r.coef;
+		lin->offset   = l.offset + r.offset;
+		lin->variable = l.variable || r.variable;
+		return true;
+
+	case iro_Sub:
+		if (!analyze_index(vl, get_Sub_left(node), &l)
+		    || !analyze_index(vl, get_Sub_right(node), &r))
+			return false;
+		lin->coef     = l.coef - r.coef;
+		lin->offset   = l.offset - r.offset;
+		lin->variable = l.variable || r.variable;
+		return true;
+
+	case iro_Mul: {
+		ir_node *left  = get_Mul_left(node);
+		ir_node *right = get_Mul_right(node);
+		if (get_const_long(left, &factor))
+			left = right;
+		else if (!get_const_long(right, &factor))
+			return false;
+		if (!analyze_index(vl, left, &l))
+			return false;
+		goto scale;
+	}
+
+	case iro_Shl: {
+		long shift;
+		if (!get_const_long(get_Shl_right(node), &shift)
+		    || shift < 0 || shift >= 16)
+			return false;
+		if (!analyze_index(vl, get_Shl_left(node), &l))
+			return false;
+		factor = 1L << shift;
+		goto scale;
+	}
+
+	case iro_Conv: {
+		/* only conversions keeping the value are allowed */
+		ir_node *op      = get_Conv_op(node);
+		ir_mode *op_mode = get_irn_mode(op);
+		if (!mode_is_int(op_mode)
+		    || get_mode_size_bits(op_mode) > get_mode_size_bits(get_irn_mode(node)))
+			return false;
+		if (get_mode_size_bits(op_mode) == get_mode_size_bits(get_irn_mode(node))
+		    && mode_is_signed(op_mode) != mode_is_signed(get_irn_mode(node)))
+			return false;
+		return analyze_index(vl, op, lin);
+	}
+
+	default:
+		return false;
+	}
+
+scale:
+	lin->coef     = l.coef * factor;
+	lin->offset   = l.offset * factor;
+	lin->variable = l.variable;
+	return true;
+}
+
+/**
+ * Decomposes the address @p node into a loop invariant base and a linear
+ * function of the induction variable.
+ */
+static bool analyze_address(const vec_loop_t *vl, ir_node *node,
+                            vec_address_t *addr)
+{
+	if (!is_in_loop(vl, node)) {
+		addr->base     = node;
+		addr->coef     = 0;
+		addr->offset   = 0;
+		addr->variable = false;
+		return true;
+	}
+
+	vec_linear_t lin;
+	switch (get_irn_opcode(node)) {
+	case iro_Add: {
+		ir_node *ptr   = get_Add_left(node);
+		ir_node *index = get_Add_right(node);
+		if (!mode_is_reference(get_irn_mode(ptr))) {
+			ir_node *tmp = ptr;
+			ptr   = index;
+			index = tmp;
+		}
+		if (!analyze_address(vl, ptr, addr) || !analyze_index(vl, index, &lin))
+			return false;
+		break;
+	}
+
+	case iro_Sub:
+		if (!mode_is_int(get_irn_mode(get_Sub_right(node))))
+			return false;
+		if (!analyze_address(vl, get_Sub_left(node), addr)
+		    || !analyze_index(vl, get_Sub_right(node), &lin))
+			return false;
+		lin.coef   = -lin.coef;
+		lin.offset = -lin.offset;
+		break;
+
+	case iro_Member: {
+		ir_entity *entity = get_Member_entity(node);
+		if (get_entity_bitfield_size(entity) != 0)
+			return false;
+		if (!analyze_address(vl, get_Member_ptr(node), addr))
+			return false;
+		addr->offset += get_entity_offset(entity);
+		return true;
+	}
+
+	case iro_Sel: {
+		ir_type *type = get_array_element_type(get_Sel_type(node));
+		long     size = get_type_size_bytes(type);
+		if (!analyze_address(vl, get_Sel_ptr(node), addr)
+		    || !analyze_index(vl, get_Sel_index(node), &lin))
+			return false;
+		lin.coef   *= size;
+		lin.offset *= size;
+		break;
+	}
+
+	default:
+		return false;
+	}
+
+	addr->coef     += lin.coef;
+	addr->offset   += lin.offset;
+	addr->variable |= lin.variable;
+	return true;
+}
+
+static bool analyze_value(vec_loop_t *vl, ir_node *node);
+static bool analyze_mem(vec_loop_t *vl, ir_node *node);
+
+static bool analyze_access(vec_loop_t *vl, ir_node *node)
+{
+	if (!ir_nodeset_insert(&vl->visited, node))
+		return true;
+	if (ir_throws_exception(node))
+		return false;
+
+	ir_node *ptr;
+	ir_node *mem;
+	ir_mode *mode;
+	if (is_Load(node)) {
+		if (get_Load_volatility(node) == volatility_is_volatile)
+			return false;
+		ptr  = get_Load_ptr(node);
+		mem  = get_Load_mem(node);
+		mode = get_Load_mode(node);
+	} else {
+		if (get_Store_volatility(node) == volatility_is_volatile)
+			return false;
+		ptr  = get_Store_ptr(node);
+		mem  = get_Store_mem(node);
+		mode = get_irn_mode(get_Store_value(node));
+	}
+
+	if (!is_supported_mode(mode))
+		return false;
+	unsigned size = get_mode_size_bytes(mode);
+	if (vl->elem_size == 0) {
+		unsigned vector_size = be_get_backend_param()->vector_size;
+		vl->elem_size = size;
+		vl->n_lanes   = vector_size / size;
+		if (vl->n_lanes < 2)
+			return false;
+	} else if (vl->elem_size != size) {
+		return false;
+	}
+
+	vec_access_t access = { .node = node };
+	if (!analyze_address(vl, ptr, &access.addr)
+	    || access.addr.coef != (long)size)
+		return false;
+	ARR_APP1(vec_access_t, vl->accesses, access);
+
+	if (!analyze_mem(vl, mem))
+		return false;
+	return is_Load(node) || analyze_value(vl, get_Store_value(node));
+}
+
+static bool analyze_mem(vec_loop_t *vl, ir_node *node)
+{
+	if (node == vl->mem_phi)
+		return true;
+	if (!is_in_loop(vl, node))
+		return is_NoMem(node);
+
+	if (is_Proj(node)) {
+		ir_node *pred = get_Proj_pred(node);
+		if (is_Load(pred) && get_Proj_num(node) == pn_Load_M)
+			return analyze_access(vl, pred);
+		if (is_Store(pred) && get_Proj_num(node) == pn_Store_M)
+			return analyze_access(vl, pred);
+		return false;
+	}
+	if (is_Sync(node)) {
+		foreach_irn_in(node, i, pred) {
+			if (!analyze_mem(vl, pred))
+				return false;
+		}
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Checks whether @p node can be computed element-wise on vectors. Loop
+ * invariant values are broadcast.
+ */
+static bool analyze_value(vec_loop_t *vl, ir_node *node)
+{
+	ir_mode *mode = get_irn_mode(node);
+	if (!is_supported_mode(mode) || get_mode_size_bytes(mode) != vl->elem_size)
+		return false;
+	if (!is_in_loop(vl, node))
+		return true;
+	if (!ir_nodeset_insert(&vl->visited, node))
+		return true;
+
+	if (is_Proj(node)) {
+		ir_node *pred = get_Proj_pred(node);
+		return is_Load(pred) && get_Proj_num(node) == pn_Load_res
+		    && analyze_access(vl, pred);
+	}
+	if (!is_supported_op(node))
+		return false;
+	return analyze_value(vl, get_binop_left(node))
+	    && analyze_value(vl, get_binop_right(node));
+}
+
+/**
+ * Checks that executing n_lanes iterations of each access at once does not
+ * change the result: Every pair of a Store and another access must either
+ * use the same address, be far enough apart or access disjoint objects.
+ * The distance of accesses to possibly aliasing objects is checked at
+ * runtime.
+ */
+static bool check_dependencies(vec_loop_t *vl)
+{
+	long const vector_size = vl->elem_size * vl->n_lanes;
+	for (size_t s = 0, n = ARR_LEN(vl->accesses); s < n; ++s) {
+		const vec_access_t *store = &vl->accesses[s];
+		if (!is_Store(store->node))
+			continue;
+		ir_node *store_ptr  = get_Store_ptr(store->node);
+		ir_type *store_type = get_Store_type(store->node);
+
+		for (size_t a = 0; a < n; ++a) {
+			const vec_access_t *access = &vl->accesses[a];
+			/* pairs of Stores are checked once */
+			if (a == s || (is_Store(access->node) && a < s))
+				continue;
+			ir_node *ptr;
+			ir_type *type;
+			if (is_Load(access->node)) {
+				ptr  = get_Load_ptr(access->node);
+				type = get_Load_type(access->node);
+			} else {
+				ptr  = get_Store_ptr(access->node);
+				type = get_Store_type(access->node);
+			}
+			if (ptr == store_ptr)
+				continue;
+
+			if (access->addr.base == store->addr.base) {
+				if (access->addr.variable || store->addr.variable)
+					return false;
+				long distance = labs(access->addr.offset - store->addr.offset);
+				if (distance != 0 && distance < vector_size)
+					return false;
+				continue;
+			}
+
+			/* the accesses cover an unknown range of their objects */
+			unsigned const size = 1U << 30;
+			if (get_alias_relation(store->addr.base, store_type, size,
+			                       access->addr.base, type, size)
+			    == ir_no_alias)
+				continue;
+
+			/* both addresses advance by the same amount, so their distance
+			 * is loop invariant */
+			if (access->addr.variable || store->addr.variable
+			    || !mode_is_reference(get_irn_mode(store->addr.base))
+			    || get_irn_mode(store->addr.base)
+			       != get_irn_mode(access->addr.base))
+				return false;
+			vec_check_t check = {
+				.base1  = store->addr.base,
+				.base2  = access->addr.base,
+				.offset = store->addr.offset - access->addr.offset,
+			};
+			ARR_APP1(vec_check_t, vl->checks, check);
+		}
+	}
+	return true;
+}
+
+static void collect_loop_nodes(ir_node *node, void *env)
+{
+	vec_loop_t *vl = (vec_loop_t*)env;
+	if (is_Block(node) || !is_in_loop(vl, node))
+		return;
+
+	switch (get_irn_opcode(node)) {
+	case iro_Load:
+	case iro_Store:
+		++vl->n_memops;
+		return;
+	case iro_Phi:
+		if (get_nodes_block(node) != vl->header) {
+			vl->failed = true;
+		} else if (get_irn_mode(node) == mode_M) {
+			if (vl->mem_phi != NULL)
+				vl->failed = true;
+			vl->mem_phi = node;
+		} else {
+			if (vl->iv != NULL)
+				vl->failed = true;
+			vl->iv = node;
+		}
+		return;
+	case iro_Cond:
+		if (node != vl->cond)
+			vl->failed = true;
+		return;
+	case iro_Proj:
+	case iro_Sync:
+	case iro_Jmp:
+		return;
+	default:
+		/* everything else must be free of side effects */
+		if (get_op_pinned(get_irn_op(node)) != op_pin_state_floats
+		    || get_irn_mode(node) == mode_T)
+			vl->failed = true;
+		return;
+	}
+}
+
+/**
+ * Matches the control flow of @p loop against a loop of one or two blocks
+ * with a single exit condition, which may sit in either block.
+ */
+static bool find_loop_shape(vec_loop_t *vl, ir_loop *loop)
+{
+	size_t const n_elements = get_loop_n_elements(loop);
+	if (n_elements < 1 || n_elements > 2)
+		return false;
+	ir_node *blocks[2];
+	for (size_t i = 0; i < n_elements; ++i) {
+		loop_element element = get_loop_element(loop, i);
+		if (*element.kind != k_ir_node || !is_Block(element.node))
+			return false;
+		blocks[i] = element.node;
+	}
+
+	ir_node *header = blocks[0];
+	ir_node *body   = blocks[0];
+	if (n_elements == 2) {
+		body = blocks[1];
+		if (get_Block_n_cfgpreds(body) != 1
+		    || get_nodes_block(get_Block_cfgpred(body, 0)) != header) {
+			header = blocks[1];
+			body   = blocks[0];
+		}
+		if (get_Block_n_cfgpreds(body) != 1
+		    || get_nodes_block(get_Block_cfgpred(body, 0)) != header)
+			return false;
+	}
+	vl->header = header;
+	vl->body   = body;
+
+	if (get_Block_n_cfgpreds(header) != 2)
+		return false;
+	vl->entry_pos = -1;
+	vl->back_pos  = -1;
+	for (int i = 0; i < 2; ++i) {
+		ir_node *pred = get_Block_cfgpred(header, i);
+		if (is_Bad(pred))
+			return false;
+		if (is_in_loop(vl, pred))
+			vl->back_pos = i;
+		else
+			vl->entry_pos = i;
+	}
+	if (vl->entry_pos < 0 || vl->back_pos < 0)
+		return false;
+
+	/* exactly one of the loop edges is controlled by the exit condition,
+	 * the other one (if any) must be unconditional */
+	ir_node *stay = get_Block_cfgpred(header, vl->back_pos);
+	if (header != body) {
+		ir_node *enter = get_Block_cfgpred(body, 0);
+		if (is_Jmp(stay)) {
+			stay = enter;
+		} else if (!is_Jmp(enter)) {
+			return false;
+		}
+	}
+	if (!is_Proj(stay))
+		return false;
+	ir_node *cond = get_Proj_pred(stay);
+	if (!is_Cond(cond))
+		return false;
+	vl->cond = cond;
+
+	ir_node *cmp = get_Cond_selector(cond);
+	if (!is_Cmp(cmp))
+		return false;
+	ir_relation relation = get_Cmp_relation(cmp);
+	if (get_Proj_num(stay) == pn_Cond_false)
+		relation = get_negated_relation(relation);
+	ir_node *counter = get_Cmp_left(cmp);
+	ir_node *bound   = get_Cmp_right(cmp);
+	if (is_in_loop(vl, bound)) {
+		counter  = bound;
+		bound    = get_Cmp_left(cmp);
+		relation = get_inversed_relation(relation);
+	}
+	if (is_in_loop(vl, bound)
+	    || (relation != ir_relation_less
+	        && relation != ir_relation_less_greater))
+		return false;
+	vl->bound    = bound;
+	vl->relation = relation;
+
+	irg_walk_graph(get_irn_irg(header), collect_loop_nodes, NULL, vl);
+	if (vl->failed || vl->iv == NULL || vl->mem_phi == NULL
+	    || !mode_is_int(get_irn_mode(vl->iv)))
+		return false;
+
+	ir_node *iv      = vl->iv;
+	ir_node *iv_next = get_irn_n(iv, vl->back_pos);
+	long     step;
+	if (!is_Add(iv_next))
+		return false;
+	if (get_Add_left(iv_next) == iv) {
+		if (!get_const_long(get_Add_right(iv_next), &step))
+			return false;
+	} else if (get_Add_right(iv_next) == iv) {
+		if (!get_const_long(get_Add_left(iv_next), &step))
+			return false;
+	} else {
+		return false;
+	}
+	if (step != 1)
+		return false;
+	vl->iv_next = iv_next;
+	if (counter == iv_next) {
+		vl->check_next = true;
+		return true;
+	}
+	return counter == iv;
+}
+
+static ir_mode *get_vector_mode(const vec_loop_t *vl, ir_mode *mode)
+{
+	char name[64];
+	snprintf(name, sizeof(name), "V%u%s", vl->n_lanes, get_mode_name(mode));
+	return new_vector_mode(name, mode, vl->n_lanes);
+}
+
+/** Returns an array type covering the elements accessed by a vector. */
+static ir_type *get_vector_type(vec_loop_t *vl, ir_type *type)
+{
+	ir_type *res = pmap_get(ir_type, vl->types, type);
+	if (res != NULL)
+		return res;
+
+	res = new_type_array(type);
+	set_array_size_int(res, vl->n_lanes);
+	set_type_size_bytes(res, vl->n_lanes * get_type_size_bytes(type));
+	set_type_alignment_bytes(res, get_type_alignment_bytes(type));
+	set_type_state(res, layout_fixed);
+	pmap_insert(vl->types, type, res);
+	return res;
+}
+
+static ir_node *build_index(vec_loop_t *vl, ir_node *node)
+{
+	if (node == vl->iv)
+		return vl->vec_iv;
+	if (!is_in_loop(vl, node))
+		return node;
+	ir_node *res = ir_nodemap_get(ir_node, &vl->map, node);
+	if (res != NULL)
+		return res;
+
+	res = exact_copy(node);
+	set_nodes_block(res, vl->vec_block);
+	ir_nodemap_insert(&vl->map, node, res);
+	foreach_irn_in(node, i, pred) {
+		set_irn_n(res, i, build_index(vl, pred));
+	}
+	return res;
+}
+
+static ir_node *build_mem(vec_loop_t *vl, ir_node *node);
+static ir_node *build_value(vec_loop_t *vl, ir_node *node);
+
+static ir_node *build_access(vec_loop_t *vl, ir_node *node)
+{
+	ir_node *res = ir_nodemap_get(ir_node, &vl->map, node);
+	if (res != NULL)
+		return res;
+
+	ir_node *const block = vl->vec_block;
+	if (is_Load(node)) {
+		ir_node *mem   = build_mem(vl, get_Load_mem(node));
+		ir_node *ptr   = build_index(vl, get_Load_ptr(node));
+		ir_mode *mode  = get_vector_mode(vl, get_Load_mode(node));
+		ir_type *type  = get_vector_type(vl, get_Load_type(node));
+		res = new_rd_Load(get_irn_dbg_info(node), block, mem, ptr, mode,
+		                  type, cons_unaligned);
+	} else {
+		ir_node *mem   = build_mem(vl, get_Store_mem(node));
+		ir_node *ptr   = build_index(vl, get_Store_ptr(node));
+		ir_node *value = build_value(vl, get_Store_value(node));
+		ir_type *type  = get_vector_type(vl, get_Store_type(node));
+		res = new_rd_Store(get_irn_dbg_info(node), block, mem, ptr, value,
+		                   type, cons_unaligned);
+	}
+	ir_nodemap_insert(&vl->map, node, res);
+	return res;
+}
+
+static ir_node *build_mem(vec_loop_t *vl, ir_node *node)
+{
+	if (node == vl->mem_phi)
+		return vl->vec_mem;
+	if (!is_in_loop(vl, node))
+		return node;
+
+	if (is_Sync(node)) {
+		ir_node *res = ir_nodemap_get(ir_node, &vl->map, node);
+		if (res == NULL) {
+			int       arity = get_Sync_n_preds(node);
+			ir_node **in    = ALLOCAN(ir_node*, arity);
+			foreach_irn_in(node, i, pred) {
+				in[i] = build_mem(vl, pred);
+			}
+			res = new_r_Sync(vl->vec_block, arity, in);
+			ir_nodemap_insert(&vl->map, node, res);
+		}
+		return res;
+	}
+
+	ir_node *access = build_access(vl, get_Proj_pred(node));
+	return new_r_Proj(access, mode_M, get_Proj_num(node));
+}
+
+static ir_node *build_value(vec_loop_t *vl, ir_node *node)
+{
+	ir_node *res = ir_nodemap_get(ir_node, &vl->map, node);
+	if (res != NULL)
+		return res;
+
+	ir_mode *mode = get_vector_mode(vl, get_irn_mode(node));
+	if (!is_in_loop(vl, node)) {
+		res = new_r_Broadcast(vl->pre_block, node, mode);
+	} else if (is_Proj(node)) {
+		ir_node *load = build_access(vl, get_Proj_pred(node));
+		res = new_r_Proj(load, mode, pn_Load_res);
+	} else {
+		ir_node *left  = build_value(vl, get_binop_left(node));
+		ir_node *right = build_value(vl, get_binop_right(node));
+		res = exact_copy(node);
+		set_nodes_block(res, vl->vec_block);
+		set_irn_mode(res, mode);
+		set_binop_left(res, left);
+		set_binop_right(res, right);
+	}
+	ir_nodemap_insert(&vl->map, node, res);
+	return res;
+}
+
+/**
+ * Checks the distances of all pairs of accesses to possibly aliasing objects
+ * starting at *block. Returns the control flow leaving *block if all
+ * distances are at least a vector, the other exits are appended to
+ * @p failed.
+ */
+static ir_node *build_checks(const vec_loop_t *vl, ir_node *block,
+                             ir_node ***failed)
+{
+	ir_graph *const irg         = get_irn_irg(block);
+	long      const vector_size = vl->elem_size * vl->n_lanes;
+	for (size_t i = 0, n = ARR_LEN(vl->checks); i < n; ++i) {
+		const vec_check_t *check = &vl->checks[i];
+		/* distance + vector_size - 1 is unsigned greater than
+		 * 2 * vector_size - 2 if the distance is outside of
+		 * [-vector_size + 1, vector_size - 1] */
+		ir_mode *mode     = get_irn_mode(check->base1);
+		ir_mode *umode    = get_reference_mode_unsigned_eq(mode);
+		ir_node *distance = new_r_Sub(block, check->base1, check->base2, umode);
+		ir_node *offset   = new_r_Const_long(irg, umode,
+		                                     check->offset + vector_size - 1);
+		ir_node *biased   = new_r_Add(block, distance, offset, umode);
+		ir_node *limit    = new_r_Const_long(irg, umode, 2 * vector_size - 2);
+		ir_node *cmp      = new_r_Cmp(block, biased, limit, ir_relation_greater);
+		ir_node *cond     = new_r_Cond(block, cmp);
+		ir_node *ok       = new_r_Proj(cond, mode_X, pn_Cond_true);
+		ARR_APP1(ir_node*, *failed, new_r_Proj(cond, mode_X, pn_Cond_false));
+		block = new_r_Block(irg, 1, &ok);
+	}
+	return new_r_Jmp(block);
+}
+
+/**
+ * Builds the vector loop in front of the scalar loop:
+ *
+ *   pre:    broadcasts of invariant values
+ *   checks: if (distance too small) goto epilog (for each pair)
+ *   head:   i' = Phi(i0, i' + n_lanes), M' = Phi(M0, M'')
+ *           if (i' rel bound) goto check else goto epilog
+ *   check:  if ((unsigned)(bound - i') > min_remaining) goto body
+ *           else goto epilog
+ *   body:   vector version of the loop body; goto head
+ *   epilog: goto scalar loop with i = i', M = M'
+ *
+ * The scalar do-while loop executes at least one iteration, so the vector
+ * loop must leave one iteration to it.
+ */
+static void vectorize_loop(vec_loop_t *vl)
+{
+	ir_node  *const header  = vl->header;
+	ir_graph *const irg     = get_irn_irg(header);
+	ir_node  *const iv      = vl->iv;
+	ir_mode  *const iv_mode = get_irn_mode(iv);
+	ir_node  *const mem_phi = vl->mem_phi;
+	ir_node  *const bound   = vl->bound;
+	ir_node  *const iv0     = get_irn_n(iv, vl->entry_pos);
+	ir_node  *const mem0    = get_irn_n(mem_phi, vl->entry_pos);
+
+	ir_node *entry = get_Block_cfgpred(header, vl->entry_pos);
+	ir_node *pre   = new_r_Block(irg, 1, &entry);
+	vl->pre_block  = pre;
+
+	ir_node **epilog_in = NEW_ARR_F(ir_node*, 2);
+	ir_node  *pre_ok    = build_checks(vl, pre, &epilog_in);
+
+	ir_node *head_in[] = { pre_ok, new_r_Dummy(irg, mode_X) };
+	ir_node *head      = new_r_Block(irg, ARRAY_SIZE(head_in), head_in);
+	ir_node *iv_in[]   = { iv0, new_r_Dummy(irg, iv_mode) };
+	ir_node *vec_iv    = new_r_Phi(head, ARRAY_SIZE(iv_in), iv_in, iv_mode);
+	ir_node *mem_in[]  = { mem0, new_r_Dummy(irg, mode_M) };
+	ir_node *vec_mem   = get_Phi_loop(mem_phi)
+		? new_r_Phi_loop(head, ARRAY_SIZE(mem_in), mem_in)
+		: new_r_Phi(head, ARRAY_SIZE(mem_in), mem_in, mode_M);
+	vl->vec_iv  = vec_iv;
+	vl->vec_mem = vec_mem;
+
+	ir_node *cmp  = new_r_Cmp(head, vec_iv, bound, vl->relation);
+	ir_node *cond = new_r_Cond(head, cmp);
+	ir_node *head_true = new_r_Proj(cond, mode_X, pn_Cond_true);
+	epilog_in[0] = new_r_Proj(cond, mode_X, pn_Cond_false);
+
+	ir_node *check     = new_r_Block(irg, 1, &head_true);
+	ir_mode *umode     = find_unsigned_mode(iv_mode);
+	ir_node *remaining = new_r_Sub(check, bound, vec_iv, iv_mode);
+	if (umode != iv_mode)
+		remaining = new_r_Conv(check, remaining, umode);
+	unsigned min_remaining = vl->check_next ? vl->n_lanes : vl->n_lanes - 1;
+	ir_node *limit      = new_r_Const_long(irg, umode, min_remaining);
+	ir_node *check_cmp  = new_r_Cmp(check, remaining, limit, ir_relation_greater);
+	ir_node *check_cond = new_r_Cond(check, check_cmp);
+	ir_node *check_true = new_r_Proj(check_cond, mode_X, pn_Cond_true);
+	epilog_in[1] = new_r_Proj(check_cond, mode_X, pn_Cond_false);
+
+	ir_node *body = new_r_Block(irg, 1, &check_true);
+	vl->vec_block = body;
+	ir_node *mem     = build_mem(vl, get_irn_n(mem_phi, vl->back_pos));
+	ir_node *n_lanes = new_r_Const_long(irg, iv_mode, vl->n_lanes);
+	ir_node *iv_next = new_r_Add(body, vec_iv, n_lanes, iv_mode);
+	set_irn_n(head, 1, new_r_Jmp(body));
+	set_irn_n(vec_iv, 1, iv_next);
+	set_irn_n(vec_mem, 1, mem);
+
+	/* the failed checks skip the vector loop */
+	int       n_epilog   = ARR_LEN(epilog_in);
+	ir_node  *epilog     = new_r_Block(irg, n_epilog, epilog_in);
+	ir_node  *epilog_iv  = vec_iv;
+	ir_node  *epilog_mem = vec_mem;
+	if (n_epilog > 2) {
+		ir_node **iv_ins  = ALLOCAN(ir_node*, n_epilog);
+		ir_node **mem_ins = ALLOCAN(ir_node*, n_epilog);
+		for (int i = 0; i < n_epilog; ++i) {
+			iv_ins[i]  = i < 2 ? vec_iv  : iv0;
+			mem_ins[i] = i < 2 ? vec_mem : mem0;
+		}
+		epilog_iv  = new_r_Phi(epilog, n_epilog, iv_ins, iv_mode);
+		epilog_mem = new_r_Phi(epilog, n_epilog, mem_ins, mode_M);
+	}
+	DEL_ARR_F(epilog_in);
+	set_irn_n(header, vl->entry_pos, new_r_Jmp(epilog));
+	set_irn_n(iv, vl->entry_pos, epilog_iv);
+	set_irn_n(mem_phi, vl->entry_pos, epilog_mem);
+}
+
+static bool analyze_loop(vec_loop_t *vl, ir_loop *loop)
+{
+	if (!find_loop_shape(vl, loop))
+		return false;
+	DB((dbg, LEVEL_2, "candidate loop with header %+F\n", vl->header));
+
+	if (!analyze_mem(vl, get_irn_n(vl->mem_phi, vl->back_pos))) {
+		DB((dbg, LEVEL_2, "  unsupported memory operations\n"));
+		return false;
+	}
+	/* loads whose results are not stored are not worth it, other accesses
+	 * are hidden from the analysis. */
+	if (ARR_LEN(vl->accesses) != vl->n_memops) {
+		DB((dbg, LEVEL_2, "  not all memory operations analyzed\n"));
+		return false;
+	}
+	if (!check_dependencies(vl)) {
+		DB((dbg, LEVEL_2, "  memory dependencies\n"));
+		return false;
+	}
+	return true;
+}
+
+static void find_innermost_loops(ir_loop *loop, ir_loop ***loops)
+{
+	bool had_sons = false;
+	for (size_t i = 0, n = get_loop_n_elements(loop); i < n; ++i) {
+		loop_element element = get_loop_element(loop, i);
+		if (*element.kind == k_ir_loop) {
+			find_innermost_loops(element.son, loops);
+			had_sons = true;
+		}
+	}
+	if (!had_sons)
+		ARR_APP1(ir_loop*, *loops, loop);
+}
+
+void vectorize_loops(ir_graph *irg)
+{
+	if (be_get_backend_param()->vector_size == 0)
+		return;
+
+	IR_PASS_TIMING("vectorize_loops", irg);
+
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_LOOPINFO
+		| IR_GRAPH_PROPERTY_NO_BADS
+		| IR_GRAPH_PROPERTY_NO_UNREACHABLE_CODE);
+
+	ir_loop **loops = NEW_ARR_F(ir_loop*, 0);
+	ir_loop  *root  = get_irg_loop(irg);
+	for (size_t i = 0, n = get_loop_n_elements(root); i < n; ++i) {
+		loop_element element = get_loop_element(root, i);
+		if (*element.kind == k_ir_loop)
+			find_innermost_loops(element.son, &loops);
+	}
+
+	/* optimizations could fold the placeholders while building */
+	int const rem_opt  = get_optimize();
+	pmap     *types    = pmap_create();
+	unsigned  n_vector = 0;
+	set_optimize(0);
+	for (size_t i = 0, n = ARR_LEN(loops); i < n; ++i) {
+		vec_loop_t vl;
+		memset(&vl, 0, sizeof(vl));
+		vl.accesses = NEW_ARR_F(vec_access_t, 0);
+		vl.checks   = NEW_ARR_F(vec_check_t, 0);
+		vl.types    = types;
+		ir_nodeset_init(&vl.visited);
+
+		if (analyze_loop(&vl, loops[i])) {
+			DB((dbg, LEVEL_1, "vectorize loop %+F with %u lanes\n",
+			    vl.header, vl.n_lanes));
+			ir_nodemap_init(&vl.map, irg);
+			vectorize_loop(&vl);
+			ir_nodemap_destroy(&vl.map);
+			++n_vector;
+		}
+
+		ir_nodeset_destroy(&vl.visited);
+		DEL_ARR_F(vl.checks);
+		DEL_ARR_F(vl.accesses);
+	}
+	set_optimize(rem_opt);
+	pmap_destroy(types);
+	DEL_ARR_F(loops);
+
+	confirm_irg_properties(irg, n_vector > 0 ? IR_GRAPH_PROPERTIES_NONE
+	                                         : IR_GRAPH_PROPERTIES_ALL);
+}
+
+void firm_init_vectorize(void)
+{
+	FIRM_DBG_REGISTER(dbg, "firm.opt.vectorize");
+}
@@ -20,6 +20,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <stddef.h>
 #include <assert.h>
 #include <stdbool.h>
 
@@ -132,7 +133,7 @@ static bool normalize(fp_value *val, bool sticky)
 
 	/* check for exponent underflow */
 	if (sc_is_negative(_exp(val))
-	 || sc_is_zero(_exp(val), value_size)) {
+	 || sc_is_zero(_exp(val), value_size*SC_BITS)) {
 		/* exponent underflow */
 		/* shift the mantissa right to have a zero exponent */
 		sc_val_from_ulong(1, temp);
@@ -191,7 +192,7 @@ static bool normalize(fp_value *val, bool sticky)
 	}
 
 	/* could have rounded down to zero */
-	if (sc_is_zero(_mant(val), value_size)
+	if (sc_is_zero(_mant(val), value_size*SC_BITS)
 	    && (val->clss == FC_SUBNORMAL))
 		val->clss = FC_ZERO;
 
@@ -385,7 +386,7 @@ static void _fadd(const fp_value *a, const fp_value *b, fp_value *result)
 	}
 
 	/* resulting exponent is the bigger one */
-	memmove(_exp(result), _exp(a), value_size);
+	memmove(_exp(result), _exp(a), value_size * sizeof(sc_word));
 
 	fc_exact &= normalize(result, sticky);
 }
@@ -594,7 +595,7 @@ void fc_int(const fp_value *a, fp_value *result)
 	sc_and(_mant(a), temp, _mant(result));
 
 	if (a != result) {
-		memcpy(_exp(result), _exp(a), value_size);
+		memcpy(_exp(result), _exp(a), value_size * sizeof(sc_word));
 		result->sign = a->sign;
 	}
 }
@@ -604,6 +605,12 @@ unsigned fc_get_value_size(void)
 	return fp_value_size;
 }
 
+void fc_clear_padding(fp_value *value)
+{
+	size_t const used = offsetof(fp_value, sign) + sizeof(value->sign);
+	memset((char*)value + used, 0, offsetof(fp_value, value) - used);
+}
+
 void fc_val_from_str(const char *str, size_t len, fp_value *result)
 {
 	char *buffer = alloca(len + 1);
@@ -632,8 +639,8 @@ void fc_val_from_bytes(fp_value *result, const unsigned char *buffer,
 	sc_shlI(_mant(result), ROUNDING_BITS, _mant(result));
 
 	/* check for special values */
-	if (sc_is_zero(_exp(result), value_size)) {
-		if (sc_is_zero(_mant(result), value_size)) {
+	if (sc_is_zero(_exp(result), value_size*SC_BITS)) {
+		if (sc_is_zero(_mant(result), value_size*SC_BITS)) {
 			result->clss = FC_ZERO;
 		} else {
 			result->clss = FC_SUBNORMAL;
@@ -770,7 +777,7 @@ void fc_cast(const fp_value *value, const float_descriptor_t *dest,
 		if (value->clss == FC_SUBNORMAL) {
 			sc_shlI(_mant(value), 1, _mant(result));
 		} else if (value != result) {
-			memcpy(_mant(result), _mant(value), value_size);
+			memcpy(_mant(result), _mant(value), value_size * sizeof(sc_word));
 		}
 
 		/* set the descriptor of the new value */
@@ -842,7 +849,7 @@ void fc_get_nan(const float_descriptor_t *desc, fp_value *result,
 	bool     explicit_one  = desc->explicit_one;
 	if (payload != NULL) {
 		if (payload != _mant(result))
-			memcpy(_mant(result), payload, value_size);
+			memcpy(_mant(result), payload, value_size * sizeof(sc_word));
 		/* Limit payload to mantissa size. The "explicit_one" on 80bit x86 must
 		 * be 0 for NaNs. */
 		sc_zero_extend(_mant(result), mantissa_size - explicit_one);
@@ -1067,7 +1074,7 @@ void init_fltcalc(unsigned precision)
 
 	rounding_mode = FC_TONEAREST;
 	value_size    = sc_get_value_length();
-	fp_value_size = sizeof(fp_value) + 2*value_size;
+	fp_value_size = sizeof(fp_value) + 2*value_size*sizeof(sc_word);
 
 #if LDBL_MANT_DIG == 64
 	assert(sizeof(long double) == 12 || sizeof(long double) == 16);
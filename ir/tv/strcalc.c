@@ -21,9 +21,13 @@
 #include "tv_t.h"
 #include "util.h"
 
-#define SC_MASK      ((sc_word)0xFF)
-#define SC_RESULT(x) ((x) & SC_MASK)
-#define SC_CARRY(x)  ((unsigned)(x) >> SC_BITS)
+/** Type able to hold the product of two digits. */
+typedef uint64_t sc_dword;
+
+#define SC_MASK      ((sc_word)0xFFFFFFFFu)
+#define SC_RESULT(x) ((sc_word)((x) & SC_MASK))
+#define SC_CARRY(x)  ((sc_word)((sc_dword)(x) >> SC_BITS))
+#define SC_BYTES     (SC_BITS / CHAR_BIT)
 
 static char *output_buffer = NULL;  /**< buffer for output */
 static unsigned bit_pattern_size;   /**< maximum number of bits */
@@ -37,12 +41,12 @@ void sc_zero(sc_word *buffer)
 
 static sc_word sex_digit(unsigned x)
 {
-	return (SC_MASK << (x+1)) & SC_MASK;
+	return x + 1 < SC_BITS ? SC_RESULT(SC_MASK << (x+1)) : 0;
 }
 
 static sc_word max_digit(unsigned x)
 {
-	return (1u << x) - 1;
+	return ((sc_word)1 << x) - 1;
 }
 
 static sc_word min_digit(unsigned x)
@@ -104,11 +108,22 @@ void sc_neg(const sc_word *val, sc_word *buffer)
 	sc_inc(buffer);
 }
 
+/**
+ * Returns the number of digits up to the most significant non-zero one,
+ * looking at the first @p len digits only.
+ */
+static unsigned sc_used_digits(const sc_word *val, unsigned len)
+{
+	while (len > 0 && val[len-1] == 0)
+		--len;
+	return len;
+}
+
 void sc_add(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 {
 	sc_word carry = 0;
 	for (unsigned counter = 0; counter < calc_buffer_size; ++counter) {
-		unsigned const sum = val1[counter] + val2[counter] + carry;
+		sc_dword const sum = (sc_dword)val1[counter] + val2[counter] + carry;
 		buffer[counter] = SC_RESULT(sum);
 		carry           = SC_CARRY(sum);
 	}
@@ -143,12 +158,16 @@ void sc_mul(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 		sign = !sign;
 	}
 
-	for (unsigned c_outer = 0; c_outer < max_value_size; c_outer++) {
+	/* digits above the most significant one do not contribute, this makes
+	 * small values as cheap as a single machine multiplication */
+	unsigned const len1 = sc_used_digits(val1, max_value_size);
+	unsigned const len2 = sc_used_digits(val2, max_value_size);
+	for (unsigned c_outer = 0; c_outer < len2; c_outer++) {
 		sc_word outer = val2[c_outer];
 		if (outer == 0)
 			continue;
-		unsigned carry = 0; /* container for carries */
-		for (unsigned c_inner = 0; c_inner < max_value_size; c_inner++) {
+		sc_word carry = 0; /* container for carries */
+		for (unsigned c_inner = 0; c_inner < len1; c_inner++) {
 			sc_word inner = val1[c_inner];
 			/* do the following calculation:
 			 * Add the current carry, the value at position c_outer+c_inner
@@ -157,9 +176,9 @@ void sc_mul(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 			 */
 
 			/* multiplicate the two digits */
-			unsigned const mul = inner*outer;
+			sc_dword const mul = (sc_dword)inner*outer;
 			/* add old value to result of multiplication and the carry */
-			unsigned const sum = temp_buffer[c_inner+c_outer] + mul + carry;
+			sc_dword const sum = temp_buffer[c_inner+c_outer] + mul + carry;
 
 			/* all carries together result in new carry. This is always
 			 * smaller than the base b:
@@ -178,24 +197,31 @@ void sc_mul(const sc_word *val1, const sc_word *val2, sc_word *buffer)
 
 		/* A carry may hang over */
 		/* c_outer is always smaller than max_value_size! */
-		temp_buffer[max_value_size + c_outer] = carry;
+		temp_buffer[len1 + c_outer] = carry;
 	}
 
 	if (sign)
 		sc_neg(temp_buffer, buffer);
 	else
-		memcpy(buffer, temp_buffer, calc_buffer_size);
+		memcpy(buffer, temp_buffer, calc_buffer_size * sizeof(sc_word));
 }
 
 /**
- * Shift the buffer to left and add an sc digit
+ * Divides the unsigned value made of the first @p len digits of @p dividend
+ * by a single digit. Digits of @p quot above @p len are not touched.
+ *
+ * @return the remainder
  */
-static void sc_push(sc_word digit, sc_word *buffer)
+static sc_word sc_divmod_digit(const sc_word *dividend, unsigned len,
+                               sc_word divisor, sc_word *quot)
 {
-	for (unsigned counter = calc_buffer_size - 1; counter-- > 0; ) {
-		buffer[counter+1] = buffer[counter];
+	sc_dword rem = 0;
+	for (unsigned counter = len; counter-- > 0; ) {
+		sc_dword const cur = (rem << SC_BITS) | dividend[counter];
+		quot[counter] = SC_RESULT(cur / divisor);
+		rem           = cur % divisor;
 	}
-	buffer[0] = digit;
+	return SC_RESULT(rem);
 }
 
 bool sc_divmod(const sc_word *dividend, const sc_word *divisor,
@@ -243,31 +269,28 @@ bool sc_divmod(const sc_word *dividend, const sc_word *divisor,
 		goto end;
 
 	case ir_relation_less: /* dividend < divisor */
-		memcpy(rem, dividend, calc_buffer_size);
+		memcpy(rem, dividend, calc_buffer_size * sizeof(sc_word));
 		goto end;
 
 	default: /* unluckily division is necessary :( */
 		break;
 	}
 
-	for (unsigned c_dividend = calc_buffer_size; c_dividend-- > 0; ) {
-		sc_push(dividend[c_dividend], rem);
-		sc_push(0, quot);
-
-		if (sc_comp(rem, divisor) != ir_relation_less) {
-			/* remainder >= divisor */
-			/* subtract until the remainder becomes negative, this should
-			 * be faster than comparing remainder with divisor  */
-			sc_add(rem, minus_divisor, rem);
+	if (sc_used_digits(divisor, calc_buffer_size) == 1) {
+		/* the machine can divide by a single digit directly */
+		unsigned const len = sc_used_digits(dividend, calc_buffer_size);
+		rem[0] = sc_divmod_digit(dividend, len, divisor[0], quot);
+	} else {
+		/* binary long division, starting at the highest set bit */
+		for (int bit = sc_get_highest_set_bit(dividend); bit >= 0; --bit) {
+			sc_shlI(rem, 1, rem);
+			rem[0] |= sc_get_bit_at(dividend, bit);
 
-			while (!sc_is_negative(rem)) {
-				/* TODO can this generate carry or is masking redundant? */
-				quot[0] = SC_RESULT(quot[0] + 1);
+			if (sc_comp(rem, divisor) != ir_relation_less) {
+				/* remainder >= divisor */
 				sc_add(rem, minus_divisor, rem);
+				sc_set_bit_at(quot, bit);
 			}
-
-			/* subtracted one too much */
-			sc_add(rem, divisor, rem);
 		}
 	}
 end:
@@ -292,10 +315,11 @@ void sc_zero_extend(sc_word *buffer, unsigned from_bits)
 	unsigned bit  = from_bits % SC_BITS;
 	unsigned word = from_bits / SC_BITS;
 	if (bit > 0) {
-		memset(&buffer[word+1], 0, calc_buffer_size-(word+1));
+		memset(&buffer[word+1], 0,
+		       (calc_buffer_size-(word+1)) * sizeof(sc_word));
 		buffer[word] &= max_digit(bit);
 	} else {
-		memset(&buffer[word], 0, calc_buffer_size-word);
+		memset(&buffer[word], 0, (calc_buffer_size-word) * sizeof(sc_word));
 	}
 }
 
@@ -376,59 +400,34 @@ bool sc_val_from_str(bool negative, unsigned base, const char *str, size_t len,
 
 void sc_val_from_long(long value, sc_word *buffer)
 {
-	bool sign       = value < 0;
-	bool is_minlong = value == LONG_MIN;
-
-	/* use absolute value, special treatment of MIN_LONG to avoid overflow */
-	if (sign) {
-		if (is_minlong)
-			value = -(value+1);
-		else
-			value = -value;
-	}
+	/* the two's complement bit pattern of value, sign extended */
+	sc_val_from_ulong((unsigned long)value, buffer);
 
-	sc_zero(buffer);
-
-	sc_word *pos = buffer;
-	while ((value != 0) && (pos < buffer + calc_buffer_size)) {
-		*pos++ = value & SC_MASK;
-		value >>= SC_BITS;
-	}
-
-	if (sign) {
-		if (is_minlong)
-			sc_inc(buffer);
-
-		sc_neg(buffer, buffer);
-	}
+	unsigned const long_bits = sizeof(long) * CHAR_BIT;
+	if (value < 0 && long_bits < calc_buffer_size * SC_BITS)
+		sc_sign_extend(buffer, long_bits);
 }
 
 void sc_val_from_ulong(unsigned long value, sc_word *buffer)
 {
-	sc_word *pos = buffer;
-
-	while (pos < buffer + calc_buffer_size) {
-		*pos++ = value & SC_MASK;
-		value >>= SC_BITS;
+	/* a shift by SC_BITS might be as wide as unsigned long */
+	uint64_t val = value;
+	for (unsigned i = 0; i < calc_buffer_size; ++i) {
+		buffer[i] = SC_RESULT(val);
+		val >>= SC_BITS;
 	}
 }
 
 long sc_val_to_long(const sc_word *val)
 {
-	unsigned long l = 0;
-	unsigned max_buffer_index = (sizeof(long)*8)/SC_BITS;
-	for (unsigned i = max_buffer_index; i-- > 0; ) {
-		assert(l <= (ULONG_MAX>>SC_BITS) && "signed shift overflow");
-		l = (l << SC_BITS) + val[i];
-	}
-	return l;
+	return (long)sc_val_to_uint64(val);
 }
 
 uint64_t sc_val_to_uint64(const sc_word *val)
 {
 	uint64_t res = 0;
-	for (unsigned i = calc_buffer_size; i-- > 0; ) {
-		res = (res << SC_BITS) + val[i];
+	for (unsigned i = MIN(calc_buffer_size, 64/SC_BITS); i-- > 0; ) {
+		res = (res << SC_BITS) | val[i];
 	}
 	return res;
 }
@@ -527,13 +526,13 @@ int sc_get_lowest_set_bit(const sc_word *value)
 void sc_set_bit_at(sc_word *value, unsigned pos)
 {
 	unsigned nibble = pos / SC_BITS;
-	value[nibble] |= 1 << (pos % SC_BITS);
+	value[nibble] |= (sc_word)1 << (pos % SC_BITS);
 }
 
 void sc_clear_bit_at(sc_word *value, unsigned pos)
 {
 	unsigned nibble = pos / SC_BITS;
-	value[nibble] &= ~(1 << (pos % SC_BITS));
+	value[nibble] &= ~((sc_word)1 << (pos % SC_BITS));
 }
 
 bool sc_is_zero(const sc_word *value, unsigned bits)
@@ -565,18 +564,16 @@ bool sc_is_negative(const sc_word *value)
 
 unsigned char sc_sub_bits(const sc_word *value, unsigned len, unsigned byte_ofs)
 {
-	if (byte_ofs*SC_BITS >= len)
+	unsigned const bit_ofs = byte_ofs*CHAR_BIT;
+	if (bit_ofs >= len)
 		return 0;
 
-	assert(SC_BITS == CHAR_BIT);
-	sc_word val = value[byte_ofs];
+	sc_word val = value[bit_ofs / SC_BITS] >> (bit_ofs % SC_BITS);
 	// Mask out if we are at the end
-	if (byte_ofs == (len/SC_BITS)-1) {
-		unsigned bit = len % SC_BITS;
-		if (bit != 0)
-			val &= max_digit(bit);
-	}
-	return val;
+	unsigned const remaining_bits = len - bit_ofs;
+	if (remaining_bits < CHAR_BIT)
+		val &= max_digit(remaining_bits);
+	return val & UCHAR_MAX;
 }
 
 unsigned sc_popcount(const sc_word *value, unsigned bits)
@@ -600,10 +597,9 @@ void sc_val_from_bytes(unsigned char const *const bytes, size_t n_bytes,
 {
 	assert(n_bytes*CHAR_BIT <= (size_t)calc_buffer_size*SC_BITS);
 
-	sc_word *p = buffer;
-	assert(SC_BITS == CHAR_BIT);
-	memcpy(p, bytes, n_bytes);
-	memset(p+n_bytes, 0, buffer+calc_buffer_size-p);
+	sc_zero(buffer);
+	for (size_t i = 0; i < n_bytes; ++i)
+		buffer[i / SC_BYTES] |= (sc_word)bytes[i] << (i % SC_BYTES * CHAR_BIT);
 }
 
 void sc_val_to_bytes(const sc_word *buffer, unsigned char *const dest,
@@ -611,55 +607,34 @@ void sc_val_to_bytes(const sc_word *buffer, unsigned char *const dest,
 {
 	assert(dest_len*CHAR_BIT <= (size_t)calc_buffer_size*SC_BITS);
 
-	assert(SC_BITS == CHAR_BIT);
-	memcpy(dest, buffer, dest_len);
+	for (size_t i = 0; i < dest_len; ++i)
+		dest[i] = (buffer[i / SC_BYTES] >> (i % SC_BYTES * CHAR_BIT)) & UCHAR_MAX;
 }
 
 void sc_val_from_bits(unsigned char const *const bytes, unsigned from,
                       unsigned to, sc_word *buffer)
 {
 	assert(from < to);
-	assert((to - from) / CHAR_BIT <= calc_buffer_size);
-	assert(CHAR_BIT == 8);
-	assert(SC_BITS == CHAR_BIT);
-
-	sc_word *p = buffer;
-
-	/* see which is the lowest and highest byte, special case if they are
-	 * the same. */
-	const unsigned char *const low      = &bytes[from/CHAR_BIT];
-	const unsigned char *const high     = &bytes[(to-1)/CHAR_BIT];
-	const unsigned             low_bit  = from%CHAR_BIT;
-	const unsigned             high_bit = (to-1)%CHAR_BIT + 1;
-	if (low == high) {
-		uint32_t val
-			= ((uint32_t)*low << (32-high_bit)) >> (32-high_bit+low_bit);
-		*p++ = val & SC_MASK;
-		goto clear_rest;
-	}
-
-	/* lowest byte gets applied partially */
-	uint32_t val = ((uint32_t)*low) >> low_bit;
-	*p     = val & SC_MASK;
-	*(p+1) = 0;
-	unsigned bit = (CHAR_BIT-low_bit)%SC_BITS;
-	p += (CHAR_BIT-low_bit)/SC_BITS;
-	/* fully apply bytes in the middle (but note that they may affect up to 2
-	 * units of the destination number) */
-	for (const unsigned char *mid = low+1; mid < high; ++mid) {
-		uint32_t mval = ((uint32_t)*mid) << bit;
-		*p++   |= (mval >> 0)       & SC_MASK;
-		*p      = (mval >> SC_BITS) & SC_MASK;
-	}
-	/* partially apply the highest byte */
-	uint32_t hval = ((uint32_t)(*high) << (32-high_bit)) >> (32-high_bit-bit);
-	*p++ |= (hval >> 0)       & SC_MASK;
-	if ((hval >> SC_BITS) != 0)
-		*p++ = (hval >> SC_BITS) & SC_MASK;
-
-clear_rest:
-	assert(p <= buffer + calc_buffer_size);
-	memset(p, 0, buffer+calc_buffer_size - p);
+	assert(to - from <= calc_buffer_size * SC_BITS);
+
+	sc_zero(buffer);
+
+	/* gather CHAR_BIT bits at a time, a bit range starting in the middle of
+	 * a byte spans two source bytes */
+	unsigned const n_bits    = to - from;
+	unsigned const last_byte = (to-1) / CHAR_BIT;
+	for (unsigned bit = 0; bit < n_bits; bit += CHAR_BIT) {
+		unsigned const src      = from + bit;
+		unsigned const src_byte = src / CHAR_BIT;
+		unsigned const src_bit  = src % CHAR_BIT;
+		unsigned       val      = bytes[src_byte] >> src_bit;
+		if (src_bit != 0 && src_byte < last_byte)
+			val |= (unsigned)bytes[src_byte+1] << (CHAR_BIT - src_bit);
+		val &= UCHAR_MAX;
+		if (n_bits - bit < CHAR_BIT)
+			val &= max_digit(n_bits - bit);
+		buffer[bit / SC_BITS] |= (sc_word)val << (bit % SC_BITS);
+	}
 }
 
 const char *sc_print(const sc_word *value, unsigned bits, enum base_t base,
@@ -669,6 +644,10 @@ const char *sc_print(const sc_word *value, unsigned bits, enum base_t base,
 	                    base, is_signed);
 }
 
+/** largest power of ten fitting into a digit and its number of zeros */
+#define DEC_CHUNK        1000000000u
+#define DEC_CHUNK_DIGITS 9
+
 char *sc_print_buf(char *buf, size_t buf_len, const sc_word *value,
                    unsigned bits, enum base_t base, bool is_signed)
 {
@@ -683,21 +662,12 @@ char *sc_print_buf(char *buf, size_t buf_len, const sc_word *value,
 	unsigned remaining_bits = bits % SC_BITS;
 	switch (base) {
 	case SC_HEX: {
-		assert(SC_BITS == 8);
-		unsigned counter = 0;
-		for ( ; counter < n_full_words; ++counter) {
-			sc_word x = value[counter];
-			*(--pos) = digits[(x >> 0) & 0xf];
-			*(--pos) = digits[(x >> 4) & 0xf];
-		}
-
-		/* last nibble must be masked */
-		if (remaining_bits != 0) {
-			sc_word mask = max_digit(remaining_bits);
-			sc_word x    = value[counter++] & mask;
-			*(--pos) = digits[(x >> 0) & 0xf];
-			*(--pos) = digits[(x >> 4) & 0xf];
-			assert(pos >= buf);
+		for (unsigned bit = 0; bit < bits; bit += 4) {
+			sc_word x = value[bit / SC_BITS] >> (bit % SC_BITS);
+			/* last nibble must be masked */
+			if (bits - bit < 4)
+				x &= max_digit(bits - bit);
+			*(--pos) = digits[x & 0xf];
 		}
 
 		/* now kill zeros */
@@ -709,9 +679,6 @@ char *sc_print_buf(char *buf, size_t buf_len, const sc_word *value,
 		return pos;
 	}
 	case SC_DEC: {
-		sc_word *base_val = ALLOCANZ(sc_word, calc_buffer_size);
-		base_val[0] = 10;
-
 		const sc_word *p        = value;
 		bool           sign     = false;
 		sc_word       *div2_res = ALLOCAN(sc_word, calc_buffer_size);
@@ -731,28 +698,35 @@ char *sc_print_buf(char *buf, size_t buf_len, const sc_word *value,
 			div1_res[counter] = p[counter];
 
 		/* last nibble must be masked */
-		if (bits % SC_BITS) {
-			sc_word mask = max_digit(bits % SC_BITS);
+		if (remaining_bits != 0) {
+			sc_word mask = max_digit(remaining_bits);
 			div1_res[counter] = p[counter] & mask;
 			++counter;
 		}
 
-		sc_word *m       = div1_res;
-		sc_word *n       = div2_res;
-		sc_word *rem_res = ALLOCAN(sc_word, calc_buffer_size);
+		/* divide by the largest power of ten fitting into a digit to get
+		 * several decimal digits per division */
+		sc_word *m   = div1_res;
+		sc_word *n   = div2_res;
+		unsigned len = sc_used_digits(m, counter);
 		for (;;) {
-			sc_divmod(m, base_val, n, rem_res);
+			sc_word rem = sc_divmod_digit(m, len, DEC_CHUNK, n);
 			sc_word *t = m;
 			m = n;
 			n = t;
-			*(--pos) = digits[rem_res[0]];
-
-			sc_word x = 0;
-			for (unsigned i = 0; i < calc_buffer_size; ++i)
-				x |= m[i];
+			len = sc_used_digits(m, len);
 
-			if (x == 0)
+			if (len == 0) {
+				do {
+					*(--pos) = digits[rem % 10];
+					rem /= 10;
+				} while (rem != 0);
 				break;
+			}
+			for (unsigned i = 0; i < DEC_CHUNK_DIGITS; ++i) {
+				*(--pos) = digits[rem % 10];
+				rem /= 10;
+			}
 		}
 		assert(pos >= buf);
 		if (sign) {
@@ -829,7 +803,7 @@ void sc_shlI(const sc_word *value, unsigned shift_count, sc_word *buffer)
 	}
 
 	/* fill up with zeros */
-	memset(buffer, 0, shift_words);
+	memset(buffer, 0, shift_words * sizeof(sc_word));
 }
 
 void sc_shl(const sc_word *val1, const sc_word *val2, sc_word *buffer)
@@ -878,7 +852,8 @@ bool sc_shrI(const sc_word *value, unsigned shift_count, sc_word *buffer)
 	}
 
 	/* fill upper words with zero */
-	memset(&buffer[calc_buffer_size-shift_words], 0, shift_words);
+	memset(&buffer[calc_buffer_size-shift_words], 0,
+	       shift_words * sizeof(sc_word));
 	return carry_flag;
 }
 
@@ -897,8 +872,8 @@ bool sc_shrsI(const sc_word *value, unsigned shift_count, unsigned bitsize,
 	/* if shifting far enough the result is either 0 or -1 */
 	if (shift_count >= bitsize) {
 		bool carry_flag = !sc_is_zero(value, calc_buffer_size*SC_BITS);
-		assert(SC_BITS <= CHAR_BIT);
-		memset(buffer, sign, calc_buffer_size);
+		for (unsigned i = 0; i < calc_buffer_size; ++i)
+			buffer[i] = sign;
 		return carry_flag;
 	}
 
@@ -914,22 +889,24 @@ bool sc_shrsI(const sc_word *value, unsigned shift_count, unsigned bitsize,
 		}
 	}
 
-	/* TODO: bitsize % SC_BITS != 0 not implemented yet */
-	assert(bitsize % SC_BITS == 0);
-	unsigned limit = bitsize / SC_BITS;
+	/* the words above bitsize are filled with the sign, this also handles
+	 * a bitsize which is not a multiple of SC_BITS */
+	sc_word *temp = ALLOCAN(sc_word, calc_buffer_size);
+	memcpy(temp, value, calc_buffer_size * sizeof(sc_word));
+	sc_sign_extend(temp, bitsize);
 
 	/* shift to the right */
 	if (shift_bits == 0) {
 		/* fast path */
-		for (unsigned i = 0; i < limit-shift_words; ++i) {
-			buffer[i] = value[i+shift_words];
+		for (unsigned i = 0; i < calc_buffer_size-shift_words; ++i) {
+			buffer[i] = temp[i+shift_words];
 		}
 	} else {
-		sc_word val = value[shift_words];
+		sc_word val = temp[shift_words];
 		carry_flag |= val & max_digit(shift_bits);
-		for (unsigned i = 0; i < limit-shift_words; ++i) {
+		for (unsigned i = 0; i < calc_buffer_size-shift_words; ++i) {
 			unsigned next_pos = i+shift_words+1;
-			sc_word next = next_pos<limit ? value[next_pos] : sign;
+			sc_word next = next_pos<calc_buffer_size ? temp[next_pos] : sign;
 			buffer[i] = SC_RESULT(val >> shift_bits)
 			          | SC_RESULT(next << (SC_BITS - shift_bits));
 			val = next;
@@ -937,9 +914,8 @@ bool sc_shrsI(const sc_word *value, unsigned shift_count, unsigned bitsize,
 	}
 
 	/* fill upper words with extended sign */
-	assert(SC_BITS <= CHAR_BIT);
-	memset(&buffer[limit-shift_words], sign,
-	       calc_buffer_size-(limit-shift_words));
+	for (unsigned i = calc_buffer_size-shift_words; i < calc_buffer_size; ++i)
+		buffer[i] = sign;
 	return carry_flag;
 }
 
@@ -16,9 +16,13 @@
 #include <stdlib.h>
 #include "firm_types.h"
 
-#define SC_BITS 8
+/**
+ * Values are stored as arrays of machine words (least significant word
+ * first), arithmetic is done a word at a time with 64bit intermediates.
+ */
+#define SC_BITS 32
 
-typedef uint8_t sc_word;
+typedef uint32_t sc_word;
 
 /**
  * The output mode for integer values.
@@ -25,7 +25,7 @@
 
 #include "bitfiddle.h"
 #include "tv_t.h"
-#include "set.h"
+#include "obst.h"
 #include "entity_t.h"
 #include "irmode_t.h"
 #include "irprintf.h"
@@ -41,8 +41,8 @@
  * constant target values */
 #define N_CONSTANTS 2048
 
-/** A set containing all existing tarvals. */
-static struct set *tarvals = NULL;
+/** Memory of all existing tarvals. */
+static struct obstack tarval_obst;
 
 static unsigned sc_value_length;
 static unsigned fp_value_size;
@@ -53,41 +53,66 @@ static bool wrap_on_overflow = true;
 /** Hash a tarval. */
 static unsigned hash_tv(const ir_tarval *tv)
 {
-	return hash_combine(hash_ptr(tv->mode), hash_data(tv->value, tv->length));
+	return hash_combine(hash_ptr(tv->mode), hash_data((const unsigned char*)tv->value, tv->length));
 }
 
-static int cmp_tv(const void *p1, const void *p2, size_t n)
+static bool tv_equal(const ir_tarval *tv1, const ir_tarval *tv2)
 {
-	(void)n;
-	const ir_tarval *tv1 = (const ir_tarval*)p1;
-	const ir_tarval *tv2 = (const ir_tarval*)p2;
 	if (tv1->mode != tv2->mode)
-		return 1;
+		return false;
 	assert(tv1->length == tv2->length);
-	return memcmp(tv1->value, tv2->value, tv1->length);
+	return memcmp(tv1->value, tv2->value, tv1->length) == 0;
+}
+
+static ir_tarval *copy_tv(const ir_tarval *tv)
+{
+	return (ir_tarval*)obstack_copy(&tarval_obst, tv,
+	                                sizeof(ir_tarval) + tv->length);
 }
 
+#define HashSet                   tarval_set_t
+#define HashSetEntry              tarval_set_entry_t
+#define ValueType                 ir_tarval*
+#define KeyType                   const ir_tarval*
+#define ConstKeyType              KeyType
+#define GetKey(value)             (value)
+#define InitData(self,value,key)  (value) = copy_tv(key)
+#define Hash(self,key)            hash_tv(key)
+#define KeysEqual(self,key1,key2) tv_equal(key1, key2)
+#define SCALAR_RETURN
+#define HashSetScope              static
+#define hashset_init_size         tarval_set_init_size
+#define hashset_destroy           tarval_set_destroy
+#define hashset_insert            tarval_set_insert
+
+typedef struct tarval_set_t tarval_set_t;
+#include "swisstable.h"
+#include "swisstable.c.inl"
+
+/** A set containing all existing tarvals. */
+static tarval_set_t tarvals;
+
 static ir_tarval *identify_tarval(const ir_tarval *tv)
 {
-	unsigned hash = hash_tv(tv);
-	return set_insert(ir_tarval, tarvals, tv, sizeof(ir_tarval) + tv->length,
-	                  hash);
+	return tarval_set_insert(&tarvals, tv);
 }
 
 static ir_tarval *get_fp_tarval(const fp_value *value, ir_mode *mode)
 {
-	ir_tarval *const tv = ALLOCAF(ir_tarval, value, fp_value_size);
+	ir_tarval *const tv = ALLOCAF(ir_tarval, value,
+	                              fp_value_size / sizeof(sc_word));
 	tv->kind   = k_tarval;
 	tv->mode   = mode;
 	tv->length = fp_value_size;
 	memcpy(tv->value, value, fp_value_size);
+	fc_clear_padding((fp_value*)tv->value);
 	return identify_tarval(tv);
 }
 
 static ir_tarval *get_int_tarval(const sc_word *value, ir_mode *mode)
 {
 	unsigned size = sc_value_length * sizeof(sc_word);
-	ir_tarval *const tv = ALLOCAF(ir_tarval, value, size);
+	ir_tarval *const tv = ALLOCAF(ir_tarval, value, sc_value_length);
 	tv->kind   = k_tarval;
 	tv->mode   = mode;
 	tv->length = size;
@@ -216,6 +241,7 @@ ir_tarval *new_tarval_from_str(const char *str, size_t len, ir_mode *mode)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		break;
 	}
@@ -473,6 +499,7 @@ void init_mode_values(ir_mode* mode)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 		mode->all_one   = tarval_bad;
 		mode->min       = tarval_bad;
 		mode->max       = tarval_bad;
@@ -500,6 +527,7 @@ int tarval_is_negative(const ir_tarval *a)
 	case irms_auxiliary:
 	case irms_internal_boolean:
 	case irms_data:
+	case irms_vector:
 		break;
 	}
 	panic("invalid mode sort");
@@ -557,6 +585,7 @@ ir_relation tarval_cmp(const ir_tarval *a, const ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 		break;
 	}
 	panic("invalid mode sort");
@@ -607,6 +636,7 @@ ir_tarval *tarval_convert_to(ir_tarval *src, ir_mode *dst_mode)
 		case irms_internal_boolean:
 		case irms_auxiliary:
 		case irms_data:
+		case irms_vector:
 			break;
 		}
 		/* the rest can't be converted */
@@ -619,7 +649,7 @@ ir_tarval *tarval_convert_to(ir_tarval *src, ir_mode *dst_mode)
 		case irms_reference:
 		case irms_int_number: {
 			sc_word *buffer = ALLOCAN(sc_word, sc_value_length);
-			memcpy(buffer, src->value, sc_value_length);
+			memcpy(buffer, src->value, sc_value_length * sizeof(sc_word));
 			return get_int_tarval_overflow(buffer, dst_mode);
 		}
 
@@ -640,6 +670,7 @@ ir_tarval *tarval_convert_to(ir_tarval *src, ir_mode *dst_mode)
 		}
 		case irms_auxiliary:
 		case irms_data:
+		case irms_vector:
 		case irms_internal_boolean:
 			break;
 		}
@@ -648,7 +679,7 @@ ir_tarval *tarval_convert_to(ir_tarval *src, ir_mode *dst_mode)
 	case irms_reference:
 		if (mode_is_int(dst_mode)) {
 			sc_word *buffer = ALLOCAN(sc_word, sc_value_length);
-			memcpy(buffer, src->value, sc_value_length);
+			memcpy(buffer, src->value, sc_value_length * sizeof(sc_word));
 			unsigned bits = get_mode_size_bits(src->mode);
 			if (mode_is_signed(src->mode)) {
 				sc_sign_extend(buffer, bits);
@@ -661,6 +692,7 @@ ir_tarval *tarval_convert_to(ir_tarval *src, ir_mode *dst_mode)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		return tarval_bad;
 	}
@@ -701,6 +733,7 @@ ir_tarval *tarval_not(ir_tarval *a)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_float_number:
 		break;
 	}
@@ -727,6 +760,7 @@ ir_tarval *tarval_neg(ir_tarval *a)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		break;
 	}
@@ -761,6 +795,7 @@ ir_tarval *tarval_add(ir_tarval *a, ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		return tarval_bad;
 	}
@@ -795,6 +830,7 @@ ir_tarval *tarval_sub(ir_tarval *a, ir_tarval *b, ir_mode *dst_mode)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		return tarval_bad;
 	}
@@ -822,6 +858,7 @@ ir_tarval *tarval_mul(ir_tarval *a, ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		return tarval_bad;
 	}
@@ -853,6 +890,7 @@ ir_tarval *tarval_div(ir_tarval *a, ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 		panic("operation not defined on mode");
 	}
@@ -877,6 +915,7 @@ ir_tarval *tarval_mod(ir_tarval *a, ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 	case irms_float_number:
 		break;
@@ -905,6 +944,7 @@ ir_tarval *tarval_divmod(ir_tarval *a, ir_tarval *b, ir_tarval **mod)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_internal_boolean:
 	case irms_float_number:
 		break;
@@ -936,6 +976,7 @@ ir_tarval *tarval_and(ir_tarval *a, ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_float_number:
 		break;
 	}
@@ -959,6 +1000,7 @@ ir_tarval *tarval_andnot(ir_tarval *a, ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_float_number:
 		break;
 	}
@@ -982,6 +1024,7 @@ ir_tarval *tarval_or(ir_tarval *a, ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_float_number:
 		break;
 	}
@@ -1005,6 +1048,7 @@ ir_tarval *tarval_ornot(ir_tarval *a, ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_float_number:
 		break;
 	}
@@ -1028,6 +1072,7 @@ ir_tarval *tarval_eor(ir_tarval *a, ir_tarval *b)
 
 	case irms_auxiliary:
 	case irms_data:
+	case irms_vector:
 	case irms_float_number:
 		break;
 	}
@@ -1085,7 +1130,7 @@ ir_tarval *tarval_shr(ir_tarval *a, ir_tarval *b)
 
 	sc_word *temp = ALLOCAN(sc_word, sc_value_length);
 	/* workaround for unnecessary internal higher precision */
-	memcpy(temp, a->value, sc_value_length);
+	memcpy(temp, a->value, sc_value_length * sizeof(sc_word));
 	sc_zero_extend(temp, get_mode_size_bits(a_mode));
 	sc_shr(temp, temp_val, temp);
 	return get_int_tarval(temp, a_mode);
@@ -1102,7 +1147,7 @@ ir_tarval *tarval_shr_unsigned(ir_tarval *a, unsigned b)
 
 	sc_word *temp = ALLOCAN(sc_word, sc_value_length);
 	/* workaround for unnecessary internal higher precision */
-	memcpy(temp, a->value, sc_value_length);
+	memcpy(temp, a->value, sc_value_length * sizeof(sc_word));
 	sc_zero_extend(temp, get_mode_size_bits(a->mode));
 	sc_shrI(temp, (long)b, temp);
 	return get_int_tarval(temp, mode);
@@ -1208,6 +1253,7 @@ const char *ir_tarval_to_ascii(char *buf, size_t len, ir_tarval *tv)
 		return buf;
 	}
 	case irms_data:
+	case irms_vector:
 	case irms_auxiliary:
 		if (tv == tarval_bad)
 			return "bad";
@@ -1238,6 +1284,7 @@ ir_tarval *ir_tarval_from_ascii(const char *buf, ir_mode *mode)
 		return get_fp_tarval(buffer, mode);
 	}
 	case irms_data:
+	case irms_vector:
 	case irms_auxiliary:
 		if (strcmp(buf, "bad") == 0)
 			return tarval_bad;
@@ -1366,7 +1413,7 @@ static ir_tarval *make_b_tarval(unsigned char const val)
 {
 	ir_tarval *const tv = XMALLOCFZ(ir_tarval, value, sc_value_length);
 	tv->kind     = k_tarval;
-	tv->length   = sc_value_length;
+	tv->length   = sc_value_length * sizeof(sc_word);
 	tv->value[0] = val;
 	/* mode will be set later */
 	return tv;
@@ -1376,7 +1423,8 @@ void init_tarval_1(void)
 {
 	/* initialize the sets holding the tarvals with a comparison function and
 	 * an initial size, which is the expected number of constants */
-	tarvals = new_set(cmp_tv, N_CONSTANTS);
+	tarval_set_init_size(&tarvals, N_CONSTANTS);
+	obstack_init(&tarval_obst);
 	/* calls init_strcalc() with needed size */
 	init_fltcalc(128);
 
@@ -1404,7 +1452,8 @@ void init_tarval_2(void)
 void finish_tarval(void)
 {
 	finish_strcalc();
-	del_set(tarvals); tarvals = NULL;
+	tarval_set_destroy(&tarvals);
+	obstack_free(&tarval_obst, NULL);
 }
 
 bool tarval_in_range(ir_tarval const *const min, ir_tarval const *const val, ir_tarval const *const max)
@@ -60,7 +60,7 @@ struct ir_tarval {
 	firm_kind     kind;    /**< must be k_tarval */
 	uint16_t      length;  /**< the length of the stored value */
 	ir_mode      *mode;    /**< the mode of the stored value */
-	unsigned char value[]; /**< the value stored in an internal way */
+	sc_word       value[]; /**< the value stored in an internal way */
 };
 
 /* inline functions */
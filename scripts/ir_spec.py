@@ -388,6 +388,15 @@ class Bitcast(Node):
 		("op", "operand")
 	]
 
+@op
+class Broadcast(Node):
+	"""Returns a vector with all elements set to its operand. The node mode
+	must be a vector mode whose element mode is the mode of the operand."""
+	flags = []
+	ins = [
+		("op", "operand")
+	]
+
 @op
 class CopyB(Node):
 	"""Copies a block of memory with statically known size/type."""
@@ -0,0 +1,459 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Code size and dynamic instruction counts of the x86 address mode
+ *          selections.
+ *
+ * Builds random loop kernels int f(int *p, int *q, int n), whose loop body
+ * computes addresses p + (i + c1 << c2) and q + (i + c1 << c2), derives
+ * further addresses from them by adding constants, loads from the ones into
+ * p, stores to the ones into q, and stores some of the addresses themselves,
+ * so they are needed in registers. The loaded values are combined into the
+ * result. Each kernel is compiled for ia32 and amd64, once with the backend
+ * option x86-addrmode=heuristic and once with x86-addrmode=tile. The
+ * assembler code is assembled and linked against a small start routine,
+ * which calls the kernel with n = 200 and exits with the result. The program
+ * is then single stepped with ptrace, so this only works on x86 Linux with
+ * the GNU binutils.
+ *
+ * For every configuration the sum of the .text sizes of the kernels and the
+ * sum of the executed instructions are reported. The exit codes of both
+ * selections must match.
+ *
+ * Usage: bench [-k kernels] [-s seed] [-i isa]
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ptrace.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "firm.h"
+
+#define KERNELS_DEFAULT 300
+#define MAX_VALUES      64
+
+static const char *const isas[]       = { "ia32", "amd64" };
+static const char *const selections[] = { "heuristic", "tile" };
+
+static const char stub_ia32[] =
+	"\t.globl _start\n"
+	"\t.text\n"
+	"_start:\n"
+	"\tpushl $200\n"
+	"\tpushl $bufq\n"
+	"\tpushl $bufp\n"
+	"\tcall f\n"
+	"\tmovl %eax, %ebx\n"
+	"\tandl $255, %ebx\n"
+	"\tmovl $1, %eax\n"
+	"\tint $0x80\n";
+
+static const char stub_amd64[] =
+	"\t.globl _start\n"
+	"\t.text\n"
+	"_start:\n"
+	"\tleaq bufp(%rip), %rdi\n"
+	"\tleaq bufq(%rip), %rsi\n"
+	"\tmovl $200, %edx\n"
+	"\tcall f\n"
+	"\tmovl %eax, %edi\n"
+	"\tandl $255, %edi\n"
+	"\tmovl $60, %eax\n"
+	"\tsyscall\n";
+
+/** The arrays p points to, with some contents, and q points to. */
+static const char stub_data[] =
+	"\t.data\n"
+	"\t.p2align 6\n"
+	"bufp:\n"
+	"\t.rept 4096\n"
+	"\t.long 0x12345, 0x777, 0xabcde1, 0x5\n"
+	"\t.endr\n"
+	"\t.bss\n"
+	"\t.p2align 6\n"
+	"bufq:\n"
+	"\t.zero 65536\n";
+
+static ir_mode *offset_mode;
+static ir_type *int_type;
+static ir_type *ptr_type;
+
+/** An address computed in the kernel. */
+typedef struct address_t {
+	ir_node *node;
+	bool     in_q; /**< points into q, which is only stored to */
+} address_t;
+
+static ir_node *new_int(long value)
+{
+	return new_Const_long(mode_Is, value);
+}
+
+/** Returns the offset (@p index + @p add) << @p shift. */
+static ir_node *new_offset(ir_node *index, int add, int shift)
+{
+	if (add != 0)
+		index = new_Add(index, new_int(add), mode_Is);
+	ir_node *offset = new_Conv(index, offset_mode);
+	if (shift != 0)
+		offset = new_Shl(offset, new_Const_long(mode_Iu, shift), offset_mode);
+	return offset;
+}
+
+static ir_node *pick(ir_node *const *values, int n)
+{
+	return values[rand() % (n < MAX_VALUES ? n : MAX_VALUES)];
+}
+
+static address_t pick_address(address_t const *addresses, int n)
+{
+	return addresses[rand() % (n < MAX_VALUES ? n : MAX_VALUES)];
+}
+
+/** Builds the loop body, a random mix of address computations and uses. */
+static void build_body(ir_node *p, ir_node *q)
+{
+	address_t addresses[MAX_VALUES];
+	ir_node  *values[MAX_VALUES];
+	int       n_addresses = 0;
+	int       n_values    = 0;
+	ir_node  *i           = get_value(0, mode_Is);
+	values[n_values++] = i;
+
+	for (int s = 0, n_steps = 4 + rand() % 12; s < n_steps; ++s) {
+		int const r = rand() % 10;
+		if (r <= 1 || n_addresses == 0) {
+			/* a new address p + offset or q + offset */
+			bool const in_q   = rand() % 2 == 0;
+			int  const add    = rand() % 4;
+			ir_node   *offset = new_offset(i, add, rand() % 4);
+			if (rand() % 4 == 0)
+				values[n_values++ % MAX_VALUES] = new_Conv(offset, mode_Is);
+			address_t const address = {
+				new_Add(in_q ? q : p, offset, mode_P), in_q
+			};
+			addresses[n_addresses++ % MAX_VALUES] = address;
+		} else if (r == 2) {
+			/* an address derived from another one */
+			address_t address = pick_address(addresses, n_addresses);
+			address.node = new_Add(address.node,
+			                       new_Const_long(offset_mode, 4 * (rand() % 8)),
+			                       mode_P);
+			addresses[n_addresses++ % MAX_VALUES] = address;
+		} else if (r <= 5) {
+			address_t const address = pick_address(addresses, n_addresses);
+			if (address.in_q)
+				continue;
+			ir_node *load = new_Load(get_store(), address.node, mode_Is,
+			                         int_type, cons_none);
+			set_store(new_Proj(load, mode_M, pn_Load_M));
+			values[n_values++ % MAX_VALUES]
+				= new_Proj(load, mode_Is, pn_Load_res);
+		} else if (r <= 7) {
+			address_t const address = pick_address(addresses, n_addresses);
+			if (!address.in_q)
+				continue;
+			ir_node *store = new_Store(get_store(), address.node,
+			                           pick(values, n_values), int_type,
+			                           cons_none);
+			set_store(new_Proj(store, mode_M, pn_Store_M));
+		} else if (r == 8) {
+			/* store an address, which needs it in a register */
+			address_t const address = pick_address(addresses, n_addresses);
+			ir_node *dest = new_Add(q, new_offset(i, 0, 3), mode_P);
+			dest = new_Add(dest, new_Const_long(offset_mode, 4096), mode_P);
+			ir_node *store = new_Store(get_store(), dest, address.node,
+			                           ptr_type, cons_none);
+			set_store(new_Proj(store, mode_M, pn_Store_M));
+		} else {
+			ir_node *sum = new_Add(pick(values, n_values),
+			                       pick(values, n_values), mode_Is);
+			values[n_values++ % MAX_VALUES] = sum;
+		}
+	}
+
+	ir_node *acc = get_value(1, mode_Is);
+	for (int v = 1, n = n_values < MAX_VALUES ? n_values : MAX_VALUES; v < n;
+	     ++v)
+		acc = new_Eor(acc, values[v], mode_Is);
+	set_value(1, acc);
+	set_value(0, new_Add(i, new_int(1), mode_Is));
+}
+
+/** Builds the kernel f. */
+static void build_kernel(void)
+{
+	int_type = get_type_for_mode(mode_Is);
+	ptr_type = new_type_pointer(int_type);
+	ir_type *mtp = new_type_method(3, 1);
+	set_method_param_type(mtp, 0, ptr_type);
+	set_method_param_type(mtp, 1, ptr_type);
+	set_method_param_type(mtp, 2, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str("f"), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 2);
+	set_current_ir_graph(irg);
+
+	ir_node *args = get_irg_args(irg);
+	ir_node *p    = new_Proj(args, mode_P, 0);
+	ir_node *q    = new_Proj(args, mode_P, 1);
+	ir_node *n    = new_Proj(args, mode_Is, 2);
+	set_value(0, new_int(0));
+	set_value(1, new_int(0));
+
+	ir_node *header = new_immBlock();
+	add_immBlock_pred(header, new_Jmp());
+	set_cur_block(header);
+	ir_node *cmp  = new_Cmp(get_value(0, mode_Is), n, ir_relation_less);
+	ir_node *cond = new_Cond(cmp);
+	ir_node *body = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+	ir_node *exit = new_immBlock();
+	add_immBlock_pred(exit, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(body);
+
+	set_cur_block(body);
+	build_body(p, q);
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(header);
+	mature_immBlock(exit);
+
+	set_cur_block(exit);
+	ir_node *res = get_value(1, mode_Is);
+	ir_node *ret = new_Return(get_store(), 1, &res);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+
+	be_lower_for_target();
+	optimize_graph_df(irg);
+	optimize_cf(irg);
+}
+
+/**
+ * Compiles kernel @p seed into @p asm_name in a new process, as libFirm can
+ * only be initialized once.
+ */
+static bool compile(const char *isa, const char *selection, unsigned seed,
+                    const char *asm_name)
+{
+	fflush(NULL);
+	pid_t const pid = fork();
+	if (pid < 0) {
+		perror("fork");
+		exit(1);
+	}
+	if (pid == 0) {
+		char isa_option[32];
+		char selection_option[32];
+		snprintf(isa_option, sizeof(isa_option), "isa=%s", isa);
+		snprintf(selection_option, sizeof(selection_option),
+		         "x86-addrmode=%s", selection);
+		ir_init();
+		if (!be_parse_arg(isa_option) || !be_parse_arg(selection_option)) {
+			fprintf(stderr, "invalid backend option\n");
+			_exit(1);
+		}
+		be_get_backend_param();
+		offset_mode = get_reference_mode_unsigned_eq(mode_P);
+
+		srand(seed);
+		build_kernel();
+		FILE *out = fopen(asm_name, "w");
+		if (out == NULL) {
+			perror(asm_name);
+			_exit(1);
+		}
+		be_main(out, "ambench");
+		fclose(out);
+		ir_finish();
+		_exit(0);
+	}
+	int status;
+	waitpid(pid, &status, 0);
+	return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/** Returns the size of the .text section of the object @p name. */
+static unsigned long get_text_size(const char *name)
+{
+	char command[300];
+	snprintf(command, sizeof(command), "size -A %s", name);
+	FILE *pipe = popen(command, "r");
+	if (pipe == NULL) {
+		perror("size");
+		exit(1);
+	}
+	unsigned long size = 0;
+	char          line[256];
+	while (fgets(line, sizeof(line), pipe) != NULL) {
+		char          section[64];
+		unsigned long section_size;
+		if (sscanf(line, "%63s %lu", section, &section_size) == 2
+		    && strcmp(section, ".text") == 0)
+			size = section_size;
+	}
+	pclose(pipe);
+	return size;
+}
+
+/**
+ * Runs @p program and counts its instructions by single stepping it.
+ * Returns the exit code, or -1 if the program did not exit normally.
+ */
+static int run_traced(const char *program, unsigned long long *steps)
+{
+	fflush(NULL);
+	pid_t const pid = fork();
+	if (pid < 0) {
+		perror("fork");
+		exit(1);
+	}
+	if (pid == 0) {
+		ptrace(PTRACE_TRACEME, 0, NULL, NULL);
+		execl(program, program, (char*)NULL);
+		_exit(127);
+	}
+	int status;
+	*steps = 0;
+	waitpid(pid, &status, 0);
+	while (WIFSTOPPED(status)) {
+		if (ptrace(PTRACE_SINGLESTEP, pid, NULL, NULL) < 0) {
+			perror("ptrace");
+			exit(1);
+		}
+		waitpid(pid, &status, 0);
+		++*steps;
+	}
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static void run_command(const char *command)
+{
+	if (system(command) != 0) {
+		fprintf(stderr, "'%s' failed\n", command);
+		exit(1);
+	}
+}
+
+/** Writes and assembles the start routine for @p isa into @p dir. */
+static void write_stub(const char *dir, const char *isa)
+{
+	char name[256];
+	snprintf(name, sizeof(name), "%s/stub_%s.s", dir, isa);
+	FILE *out = fopen(name, "w");
+	if (out == NULL) {
+		perror(name);
+		exit(1);
+	}
+	fputs(strcmp(isa, "ia32") == 0 ? stub_ia32 : stub_amd64, out);
+	fputs(stub_data, out);
+	fclose(out);
+
+	char command[600];
+	snprintf(command, sizeof(command), "as %s %s -o %s/stub_%s.o",
+	         strcmp(isa, "ia32") == 0 ? "--32" : "", name, dir, isa);
+	run_command(command);
+}
+
+typedef struct result_t {
+	unsigned long      text_size;
+	unsigned long long steps;
+	int                exit_code;
+} result_t;
+
+/** Compiles, links and runs kernel @p seed. */
+static result_t measure(const char *dir, const char *isa,
+                        const char *selection, unsigned seed)
+{
+	char asm_name[256];
+	snprintf(asm_name, sizeof(asm_name), "%s/f.s", dir);
+	if (!compile(isa, selection, seed, asm_name)) {
+		fprintf(stderr, "compiling kernel %u for %s failed\n", seed, isa);
+		exit(1);
+	}
+
+	bool const ia32 = strcmp(isa, "ia32") == 0;
+	char       command[1024];
+	snprintf(command, sizeof(command),
+	         "as %s %s/f.s -o %s/f.o && ld %s %s/stub_%s.o %s/f.o -o %s/f",
+	         ia32 ? "--32" : "", dir, dir, ia32 ? "-m elf_i386" : "", dir, isa,
+	         dir, dir);
+	run_command(command);
+
+	char object_name[256];
+	char program_name[256];
+	snprintf(object_name, sizeof(object_name), "%s/f.o", dir);
+	snprintf(program_name, sizeof(program_name), "%s/f", dir);
+	result_t result;
+	result.text_size = get_text_size(object_name);
+	result.exit_code = run_traced(program_name, &result.steps);
+	return result;
+}
+
+int main(int argc, char **argv)
+{
+	int         n_kernels = KERNELS_DEFAULT;
+	unsigned    seed      = 1;
+	const char *only_isa  = NULL;
+	int         opt;
+	while ((opt = getopt(argc, argv, "k:s:i:")) != -1) {
+		switch (opt) {
+		case 'k': n_kernels = atoi(optarg);           break;
+		case 's': seed      = (unsigned)atoi(optarg); break;
+		case 'i': only_isa  = optarg;                 break;
+		default:
+			fprintf(stderr, "usage: %s [-k kernels] [-s seed] [-i isa]\n",
+			        argv[0]);
+			return 1;
+		}
+	}
+
+	char dir[] = "/tmp/ambench.XXXXXX";
+	if (mkdtemp(dir) == NULL) {
+		perror("mkdtemp");
+		return 1;
+	}
+
+	int failed = 0;
+	printf("%-6s %-10s %12s %16s\n", "isa", "selection", "text bytes",
+	       "instructions");
+	for (size_t i = 0; i < sizeof(isas) / sizeof(isas[0]); ++i) {
+		const char *isa = isas[i];
+		if (only_isa != NULL && strcmp(only_isa, isa) != 0)
+			continue;
+		write_stub(dir, isa);
+
+		unsigned long      text_size[2] = { 0, 0 };
+		unsigned long long steps[2]     = { 0, 0 };
+		for (int k = 0; k < n_kernels; ++k) {
+			result_t results[2];
+			for (int s = 0; s < 2; ++s) {
+				results[s] = measure(dir, isa, selections[s], seed + k);
+				text_size[s] += results[s].text_size;
+				steps[s]     += results[s].steps;
+			}
+			if (results[0].exit_code < 0
+			    || results[0].exit_code != results[1].exit_code) {
+				fprintf(stderr, "%s kernel %u: exit codes %d and %d\n", isa,
+				        seed + k, results[0].exit_code, results[1].exit_code);
+				++failed;
+			}
+		}
+		for (int s = 0; s < 2; ++s) {
+			printf("%-6s %-10s %12lu %16llu\n", isa, selections[s],
+			       text_size[s], steps[s]);
+		}
+	}
+
+	char command[64];
+	snprintf(command, sizeof(command), "rm -rf %s", dir);
+	run_command(command);
+	return failed != 0;
+}
@@ -0,0 +1,703 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Compile time benchmark of the optimization passes and the backend.
+ *
+ * Builds synthetic graphs of scalable size, or loads the graphs of the files
+ * given on the command line with ir_import(), and runs each pass in isolation
+ * on a fresh copy of them. For every source and pass one JSON object per line
+ * is written to stdout:
+ *
+ *   {"source":"dag","scale":1,"pass":"combo","time_us":1234,
+ *    "obstack_peak":65536,"obstack_bytes":131072,
+ *    "nodes_before":4160,"nodes_after":4032}
+ *
+ * time_us is the minimum over all repetitions, obstack_peak the maximum of
+ * the obstack memory held at once on top of what was held before the pass,
+ * obstack_bytes all obstack memory requested by the pass. The backend runs
+ * be_main() once per register allocator. Its phases are additionally
+ * reported with a "phase" taken from the pass profile (see
+ * ir_pass_timing_enable()); their obstack_peak is -1. compare.py compares
+ * two result files.
+ *
+ * Usage: bench [-s scale] [-r repetitions] [-g source] [-p pass]
+ *              [-b backend option] [-e file] [file.ir...]
+ *
+ * -g and -p only run sources and passes whose name contains the argument.
+ * -b is passed to be_parse_arg(), for example -b isa=amd64.
+ * -e exports the synthetic graphs to a file instead of running the
+ * benchmark, so they can be loaded again with other versions of libFirm.
+ *
+ * The default run takes about half a minute with the optimize variant.
+ * Larger scales show the passes whose cost grows superlinearly, but take
+ * much longer: with -s 10, local alone spends more than a minute on cfg.
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "firm.h"
+#include "util.h"
+#include "xmalloc.h"
+
+#define SCALE_DEFAULT 1
+#define REPS_DEFAULT  3
+
+static ir_type *int_type;
+static ir_type *ptr_type;
+static unsigned graph_nr;
+
+/** Creates a graph for a new function taking and returning ints. */
+static ir_graph *new_function(const char *kind, size_t n_params,
+                              int n_values)
+{
+	char name[32];
+	snprintf(name, sizeof(name), "%s_%u", kind, graph_nr++);
+
+	ir_type *mtp = new_type_method(n_params + 1, 1);
+	set_method_param_type(mtp, 0, ptr_type);
+	for (size_t i = 1; i <= n_params; ++i)
+		set_method_param_type(mtp, i, int_type);
+	set_method_res_type(mtp, 0, int_type);
+
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, n_values);
+	set_current_ir_graph(irg);
+	return irg;
+}
+
+static ir_node *get_param(unsigned n)
+{
+	ir_mode *mode = n == 0 ? mode_P : mode_Is;
+	return new_Proj(get_irg_args(current_ir_graph), mode, n);
+}
+
+static ir_node *new_int(long value)
+{
+	return new_Const_long(mode_Is, value);
+}
+
+static void finish_function(ir_node *result)
+{
+	ir_node *ret = new_Return(get_store(), 1, &result);
+	add_immBlock_pred(get_irg_end_block(current_ir_graph), ret);
+	irg_finalize_cons(current_ir_graph);
+}
+
+/** Accesses the int at index @p index of the array passed as first param. */
+static ir_node *new_element_ptr(long index)
+{
+	ir_mode *offset_mode = get_reference_mode_unsigned_eq(mode_P);
+	ir_node *offset      = new_Const_long(offset_mode, index * 4);
+	return new_Add(get_param(0), offset, mode_P);
+}
+
+static ir_node *new_load(ir_node *ptr)
+{
+	ir_node *load = new_Load(get_store(), ptr, mode_Is, int_type, cons_none);
+	set_store(new_Proj(load, mode_M, pn_Load_M));
+	return new_Proj(load, mode_Is, pn_Load_res);
+}
+
+static void new_store(ir_node *ptr, ir_node *value)
+{
+	ir_node *store = new_Store(get_store(), ptr, value, int_type, cons_none);
+	set_store(new_Proj(store, mode_M, pn_Store_M));
+}
+
+static ir_node *new_random_op(ir_node *left, ir_node *right)
+{
+	switch (rand() % 8) {
+	case 0:  return new_Add(left, right, mode_Is);
+	case 1:  return new_Sub(left, right, mode_Is);
+	case 2:  return new_Mul(left, right, mode_Is);
+	case 3:  return new_And(left, right, mode_Is);
+	case 4:  return new_Or(left, right, mode_Is);
+	case 5:  return new_Eor(left, right, mode_Is);
+	case 6:  return new_Shl(left, new_Const_long(mode_Iu, rand() % 31), mode_Is);
+	default: return new_Add(left, new_int(rand() % 100), mode_Is);
+	}
+}
+
+/**
+ * A single block with a deep expression DAG. Most operands are recent values,
+ * some are shared with far away parts of the DAG, and some values go through
+ * memory.
+ */
+static void build_dag(unsigned scale)
+{
+	size_t const n = 5000 * scale;
+	new_function("dag", 2, 0);
+	ir_node **values = XMALLOCN(ir_node*, n);
+	values[0] = get_param(1);
+	values[1] = get_param(2);
+	for (size_t i = 2; i < n; ++i) {
+		size_t   const window = i < 8 ? i : 8;
+		ir_node *const left   = values[i - 1 - rand() % window];
+		ir_node *const right  = values[rand() % i];
+		switch (rand() % 16) {
+		case 0:
+			values[i] = new_load(new_element_ptr(rand() % 64));
+			break;
+		case 1:
+			new_store(new_element_ptr(rand() % 64), left);
+			values[i] = right;
+			break;
+		default:
+			values[i] = new_random_op(left, right);
+			break;
+		}
+	}
+	ir_node *result = values[n - 1];
+	for (size_t i = n - 16; i < n - 1; ++i)
+		result = new_Eor(result, values[i], mode_Is);
+	free(values);
+	finish_function(result);
+}
+
+/**
+ * A huge control flow graph. Each block updates a few variables and branches
+ * to the next block and to a random other block, which forms many loops.
+ */
+static void build_cfg(unsigned scale)
+{
+	enum { N_VARS = 4 };
+	size_t const n_blocks = 200 * scale;
+	new_function("cfg", 1, N_VARS);
+	for (int v = 0; v < N_VARS; ++v)
+		set_value(v, v == 0 ? get_param(1) : new_int(v));
+
+	ir_node **blocks = XMALLOCN(ir_node*, n_blocks);
+	for (size_t i = 0; i < n_blocks; ++i)
+		blocks[i] = new_immBlock();
+	add_immBlock_pred(blocks[0], new_Jmp());
+
+	for (size_t i = 0; i < n_blocks; ++i) {
+		set_cur_block(blocks[i]);
+		int const v = rand() % N_VARS;
+		set_value(v, new_random_op(get_value(v, mode_Is),
+		                           get_value(rand() % N_VARS, mode_Is)));
+		if (i == n_blocks - 1)
+			break;
+
+		ir_node *const cmp  = new_Cmp(get_value(v, mode_Is),
+		                              new_int(rand() % 1000), ir_relation_less);
+		ir_node *const cond = new_Cond(cmp);
+		add_immBlock_pred(blocks[i + 1], new_Proj(cond, mode_X, pn_Cond_true));
+		add_immBlock_pred(blocks[rand() % n_blocks],
+		                  new_Proj(cond, mode_X, pn_Cond_false));
+	}
+	for (size_t i = 0; i < n_blocks; ++i)
+		mature_immBlock(blocks[i]);
+	ir_node *result = get_value(0, mode_Is);
+	for (int v = 1; v < N_VARS; ++v)
+		result = new_Add(result, get_value(v, mode_Is), mode_Is);
+	free(blocks);
+	finish_function(result);
+}
+
+/**
+ * A loop carrying many variables through a sequence of diamonds, each of
+ * which updates half of the variables on one side. Every diamond and the
+ * loop header merge the variables with Phis.
+ */
+static void build_phis(unsigned scale)
+{
+	enum { N_DIAMONDS = 10 };
+	int const n_vars = 100 * scale;
+	new_function("phis", 1, n_vars + 1);
+	ir_node *const n = get_param(1);
+	for (int v = 0; v < n_vars; ++v)
+		set_value(v, new_int(v));
+	set_value(n_vars, new_int(0));
+
+	ir_node *const header = new_immBlock();
+	add_immBlock_pred(header, new_Jmp());
+	set_cur_block(header);
+	ir_node *const counter = get_value(n_vars, mode_Is);
+	ir_node *const cmp     = new_Cmp(counter, n, ir_relation_less);
+	ir_node *const cond    = new_Cond(cmp);
+	ir_node *const exit    = new_immBlock();
+	add_immBlock_pred(exit, new_Proj(cond, mode_X, pn_Cond_false));
+	ir_node *block = new_immBlock();
+	add_immBlock_pred(block, new_Proj(cond, mode_X, pn_Cond_true));
+	mature_immBlock(block);
+
+	for (int d = 0; d < N_DIAMONDS; ++d) {
+		set_cur_block(block);
+		ir_node *const dcmp  = new_Cmp(get_value(rand() % n_vars, mode_Is),
+		                               counter, ir_relation_greater);
+		ir_node *const dcond = new_Cond(dcmp);
+		ir_node *const join  = new_immBlock();
+		ir_node *const side  = new_immBlock();
+		add_immBlock_pred(side, new_Proj(dcond, mode_X, pn_Cond_true));
+		add_immBlock_pred(join, new_Proj(dcond, mode_X, pn_Cond_false));
+		mature_immBlock(side);
+		set_cur_block(side);
+		for (int v = rand() % 2; v < n_vars; v += 2) {
+			ir_node *const other = get_value(rand() % n_vars, mode_Is);
+			set_value(v, new_random_op(get_value(v, mode_Is), other));
+		}
+		add_immBlock_pred(join, new_Jmp());
+		mature_immBlock(join);
+		block = join;
+	}
+	set_cur_block(block);
+	set_value(n_vars, new_Add(counter, new_int(1), mode_Is));
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(header);
+	mature_immBlock(exit);
+
+	set_cur_block(exit);
+	ir_node *result = get_value(0, mode_Is);
+	for (int v = 1; v < n_vars; ++v)
+		result = new_Eor(result, get_value(v, mode_Is), mode_Is);
+	finish_function(result);
+}
+
+/**
+ * A switch with a large table. Each case computes its own value and stores
+ * it, all cases join in a single block.
+ */
+static void build_switch(unsigned scale)
+{
+	size_t const n_cases = 300 * scale;
+	new_function("switch", 1, 1);
+	ir_node *const selector = get_param(1);
+
+	ir_switch_table *table = ir_new_switch_table(current_ir_graph, n_cases);
+	for (size_t i = 0; i < n_cases; ++i) {
+		/* leave holes, some cases cover ranges */
+		long       const min = 3 * i;
+		long       const max = min + rand() % 2;
+		ir_tarval *const tv_min = new_tarval_from_long(min, mode_Is);
+		ir_tarval *const tv_max = new_tarval_from_long(max, mode_Is);
+		ir_switch_table_set(table, i, tv_min, tv_max, i + 1);
+	}
+	ir_node *const sw   = new_Switch(selector, n_cases + 1, table);
+	ir_node *const join = new_immBlock();
+	ir_node *const mem  = get_store();
+
+	for (size_t i = 0; i <= n_cases; ++i) {
+		ir_node *const block = new_immBlock();
+		add_immBlock_pred(block, new_Proj(sw, mode_X, i));
+		mature_immBlock(block);
+		set_cur_block(block);
+		set_store(mem);
+		ir_node *const value = new_random_op(selector, new_int(i));
+		if (rand() % 4 == 0)
+			new_store(new_element_ptr(i % 64), value);
+		set_value(0, value);
+		add_immBlock_pred(join, new_Jmp());
+	}
+	mature_immBlock(join);
+	set_cur_block(join);
+	finish_function(get_value(0, mode_Is));
+}
+
+typedef struct source_t {
+	const char *name;
+	void      (*build)(unsigned scale); /**< NULL for files */
+} source_t;
+
+static const source_t synthetic_sources[] = {
+	{ "dag",    build_dag    },
+	{ "cfg",    build_cfg    },
+	{ "phis",   build_phis   },
+	{ "switch", build_switch },
+};
+
+static void assure_dominance(ir_graph *irg)
+{
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+}
+
+typedef struct pass_t {
+	const char *name;
+	void      (*run)(ir_graph *irg);
+} pass_t;
+
+static const pass_t passes[] = {
+	{ "local",         optimize_graph_df      },
+	{ "control-flow",  optimize_cf            },
+	{ "combo",         combo                  },
+	{ "gvn-pre",       do_gvn_pre             },
+	{ "ldst",          optimize_load_store    },
+	{ "opt-ldst",      opt_ldst               },
+	{ "jumpthreading", opt_jumpthreading      },
+	{ "reassociation", optimize_reassociation },
+	{ "gcm",           place_code             },
+	{ "dominance",     assure_dominance       },
+	{ "loop-tree",     assure_loopinfo        },
+};
+
+/** The register allocators the backend runs with. */
+static const char *const allocators[] = { "pref", "chordal" };
+
+static unsigned    scale = SCALE_DEFAULT;
+static unsigned    reps  = REPS_DEFAULT;
+static const char *source_filter;
+static const char *pass_filter;
+
+static void load_source(const source_t *source)
+{
+	if (source->build != NULL) {
+		/* the same graph for every repetition */
+		srand(1);
+		source->build(scale);
+	} else if (ir_import(source->name) != 0) {
+		fprintf(stderr, "bench: could not import %s\n", source->name);
+		exit(1);
+	}
+}
+
+static void free_graphs(void)
+{
+	for (size_t n = get_irp_n_irgs(); n-- > 0;)
+		free_ir_graph(get_irp_irg(n));
+}
+
+static void count_node(ir_node *node, void *env)
+{
+	(void)node;
+	++*(unsigned long*)env;
+}
+
+static unsigned long count_nodes(void)
+{
+	unsigned long n = 0;
+	for (size_t i = 0, n_irgs = get_irp_n_irgs(); i < n_irgs; ++i)
+		irg_walk_graph(get_irp_irg(i), count_node, NULL, &n);
+	return n;
+}
+
+typedef struct measurement_t {
+	unsigned long      time_us;
+	long long          obstack_peak;
+	unsigned long long obstack_bytes;
+	unsigned long      nodes_before;
+	unsigned long      nodes_after;
+} measurement_t;
+
+static void print_json_string(const char *str)
+{
+	putchar('"');
+	for (const char *c = str; *c != '\0'; ++c) {
+		if (*c == '"' || *c == '\\')
+			putchar('\\');
+		putchar(*c);
+	}
+	putchar('"');
+}
+
+static void print_record(const source_t *source, const char *pass,
+                         const char *phase, const measurement_t *m)
+{
+	printf("{\"source\":");
+	print_json_string(source->name);
+	printf(",\"scale\":%u,\"pass\":", source->build != NULL ? scale : 1);
+	print_json_string(pass);
+	if (phase != NULL) {
+		printf(",\"phase\":");
+		print_json_string(phase);
+	}
+	printf(",\"time_us\":%lu,\"obstack_peak\":%lld,\"obstack_bytes\":%llu,"
+	       "\"nodes_before\":%lu,\"nodes_after\":%lu}\n",
+	       m->time_us, m->obstack_peak, m->obstack_bytes, m->nodes_before,
+	       m->nodes_after);
+	fflush(stdout);
+}
+
+/** Starts measuring the time and obstack memory of a pass. */
+static void measure_begin(measurement_t *m, ir_timer_t *timer)
+{
+	m->nodes_before  = count_nodes();
+	m->obstack_peak  = ir_obstack_bytes_live();
+	m->obstack_bytes = ir_obstack_bytes_total();
+	ir_obstack_reset_peak();
+	ir_timer_reset_and_start(timer);
+}
+
+static void measure_end(measurement_t *m, ir_timer_t *timer)
+{
+	ir_timer_stop(timer);
+	m->time_us       = ir_timer_elapsed_usec(timer);
+	m->obstack_peak  = ir_obstack_bytes_peak() - m->obstack_peak;
+	m->obstack_bytes = ir_obstack_bytes_total() - m->obstack_bytes;
+	m->nodes_after   = count_nodes();
+}
+
+/** Keeps the fastest run, but the largest memory. */
+static void merge_measurement(measurement_t *best, const measurement_t *m,
+                              unsigned rep)
+{
+	if (rep == 0 || m->time_us < best->time_us)
+		best->time_us = m->time_us;
+	if (rep == 0 || m->obstack_peak > best->obstack_peak)
+		best->obstack_peak = m->obstack_peak;
+	if (rep == 0 || m->obstack_bytes > best->obstack_bytes)
+		best->obstack_bytes = m->obstack_bytes;
+	best->nodes_before = m->nodes_before;
+	best->nodes_after  = m->nodes_after;
+}
+
+static void run_pass(const source_t *source, const pass_t *pass)
+{
+	ir_timer_t   *timer = ir_timer_new();
+	measurement_t best;
+	for (unsigned rep = 0; rep < reps; ++rep) {
+		load_source(source);
+		measurement_t m;
+		measure_begin(&m, timer);
+		for (size_t i = 0, n_irgs = get_irp_n_irgs(); i < n_irgs; ++i)
+			pass->run(get_irp_irg(i));
+		measure_end(&m, timer);
+		merge_measurement(&best, &m, rep);
+		free_graphs();
+	}
+	ir_timer_free(timer);
+	print_record(source, pass->name, NULL, &best);
+}
+
+/** Time and memory of a backend phase, summed over all graphs. */
+typedef struct phase_t {
+	char              *name;
+	unsigned long      time_us;
+	unsigned long long obstack_bytes;
+} phase_t;
+
+static phase_t *phases;
+static size_t   n_phases;
+
+static phase_t *get_phase(const char *name)
+{
+	for (size_t i = 0; i < n_phases; ++i) {
+		if (strcmp(phases[i].name, name) == 0)
+			return &phases[i];
+	}
+	phases = XREALLOC(phases, phase_t, n_phases + 1);
+	phase_t *phase = &phases[n_phases++];
+	phase->name          = xstrdup(name);
+	phase->time_us       = 0;
+	phase->obstack_bytes = 0;
+	return phase;
+}
+
+static bool is_graph_name(const char *name, size_t len)
+{
+	for (size_t i = 0, n_irgs = get_irp_n_irgs(); i < n_irgs; ++i) {
+		ir_entity  *entity = get_irg_entity(get_irp_irg(i));
+		const char *ld     = get_id_str(get_entity_ld_ident(entity));
+		if (strlen(ld) == len && strncmp(ld, name, len) == 0)
+			return true;
+	}
+	return false;
+}
+
+/**
+ * Removes the graph names and the be_codegen pass around each graph from a
+ * call path, so the same phase of different graphs has the same name.
+ */
+static void strip_path(char *path)
+{
+	char *out = path;
+	for (const char *c = path; *c != '\0';) {
+		const char *end = strchr(c, ';');
+		size_t      len = end != NULL ? (size_t)(end - c) : strlen(c);
+		if (!is_graph_name(c, len)
+		    && (len != strlen("be_codegen") || strncmp(c, "be_codegen", len) != 0)) {
+			if (out != path)
+				*out++ = ';';
+			memmove(out, c, len);
+			out += len;
+		}
+		c += len;
+		if (*c == ';')
+			++c;
+	}
+	*out = '\0';
+}
+
+/** Reads the pass profile and sums up the values of the backend phases. */
+static void collect_phases(int memory)
+{
+	FILE *out = tmpfile();
+	if (out == NULL) {
+		perror("bench: tmpfile");
+		exit(1);
+	}
+	ir_pass_timing_dump(out, memory);
+	rewind(out);
+
+	char line[1024];
+	while (fgets(line, sizeof(line), out) != NULL) {
+		char *const space = strrchr(line, ' ');
+		if (space == NULL)
+			continue;
+		*space = '\0';
+		unsigned long long const value = strtoull(space + 1, NULL, 10);
+		strip_path(line);
+		phase_t *const phase = get_phase(line[0] != '\0' ? line : "be_codegen");
+		if (memory)
+			phase->obstack_bytes += value;
+		else
+			phase->time_us += value;
+	}
+	fclose(out);
+}
+
+static void free_phases(void)
+{
+	for (size_t i = 0; i < n_phases; ++i)
+		free(phases[i].name);
+	free(phases);
+	phases   = NULL;
+	n_phases = 0;
+}
+
+static void run_backend(const source_t *source, const char *allocator)
+{
+	char arg[64];
+	snprintf(arg, sizeof(arg), "regalloc=%s", allocator);
+	if (!be_parse_arg(arg)) {
+		fprintf(stderr, "bench: unknown register allocator %s\n", allocator);
+		exit(1);
+	}
+	char pass[64];
+	snprintf(pass, sizeof(pass), "backend-%s", allocator);
+
+	FILE *const null = fopen("/dev/null", "w");
+	if (null == NULL) {
+		perror("bench: /dev/null");
+		exit(1);
+	}
+	ir_timer_t   *timer = ir_timer_new();
+	measurement_t best;
+	for (unsigned rep = 0; rep < reps; ++rep) {
+		load_source(source);
+		be_lower_for_target();
+
+		ir_pass_timing_reset();
+		ir_pass_timing_enable(1);
+		measurement_t m;
+		measure_begin(&m, timer);
+		be_main(null, source->name);
+		measure_end(&m, timer);
+		ir_pass_timing_enable(0);
+
+		/* report the phases of the fastest run */
+		if (rep == 0 || m.time_us < best.time_us) {
+			free_phases();
+			collect_phases(0);
+			collect_phases(1);
+		}
+		merge_measurement(&best, &m, rep);
+		free_graphs();
+	}
+	ir_timer_free(timer);
+	fclose(null);
+	ir_pass_timing_reset();
+
+	print_record(source, pass, NULL, &best);
+	for (size_t i = 0; i < n_phases; ++i) {
+		measurement_t m = best;
+		m.time_us       = phases[i].time_us;
+		m.obstack_peak  = -1;
+		m.obstack_bytes = phases[i].obstack_bytes;
+		print_record(source, pass, phases[i].name, &m);
+	}
+	free_phases();
+}
+
+static bool matches(const char *filter, const char *name)
+{
+	return filter == NULL || strstr(name, filter) != NULL;
+}
+
+static void run_source(const source_t *source)
+{
+	if (!matches(source_filter, source->name))
+		return;
+	for (size_t i = 0; i < ARRAY_SIZE(passes); ++i) {
+		if (matches(pass_filter, passes[i].name))
+			run_pass(source, &passes[i]);
+	}
+	for (size_t i = 0; i < ARRAY_SIZE(allocators); ++i) {
+		char pass[64];
+		snprintf(pass, sizeof(pass), "backend-%s", allocators[i]);
+		if (matches(pass_filter, pass))
+			run_backend(source, allocators[i]);
+	}
+}
+
+static void usage(void)
+{
+	fprintf(stderr, "usage: bench [-s scale] [-r repetitions] [-g source] "
+	        "[-p pass] [-b backend option] [-e file] [file.ir...]\n");
+	exit(1);
+}
+
+int main(int argc, char **argv)
+{
+	ir_init();
+
+	const char *export_file = NULL;
+	int         opt;
+	while ((opt = getopt(argc, argv, "s:r:g:p:b:e:")) != -1) {
+		switch (opt) {
+		case 's': scale         = (unsigned)atoi(optarg); break;
+		case 'r': reps          = (unsigned)atoi(optarg); break;
+		case 'g': source_filter = optarg;                 break;
+		case 'p': pass_filter   = optarg;                 break;
+		case 'e': export_file   = optarg;                 break;
+		case 'b':
+			if (!be_parse_arg(optarg)) {
+				fprintf(stderr, "bench: unknown backend option %s\n", optarg);
+				return 1;
+			}
+			break;
+		default:
+			usage();
+		}
+	}
+	if (scale == 0 || reps == 0)
+		usage();
+
+	/* initializes the backend and thereby mode_P */
+	be_get_backend_param();
+	int_type = get_type_for_mode(mode_Is);
+	ptr_type = new_type_pointer(int_type);
+
+	if (export_file != NULL) {
+		for (size_t i = 0; i < ARRAY_SIZE(synthetic_sources); ++i) {
+			if (matches(source_filter, synthetic_sources[i].name)) {
+				srand(1);
+				synthetic_sources[i].build(scale);
+			}
+		}
+		if (ir_export(export_file) != 0) {
+			fprintf(stderr, "bench: could not export to %s\n", export_file);
+			return 1;
+		}
+		ir_finish();
+		return 0;
+	}
+
+	if (optind == argc) {
+		for (size_t i = 0; i < ARRAY_SIZE(synthetic_sources); ++i)
+			run_source(&synthetic_sources[i]);
+	}
+	for (int i = optind; i < argc; ++i) {
+		source_t const source = { argv[i], NULL };
+		run_source(&source);
+	}
+
+	ir_finish();
+	return 0;
+}
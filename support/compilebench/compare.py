@@ -0,0 +1,77 @@
+#! /usr/bin/env python
+#
+# This file is part of libFirm.
+# Copyright (C) 2012 University of Karlsruhe.
+#
+# Compares two result files of the compile time benchmark and reports the
+# passes and phases which got slower or need more memory. Exits with status 1
+# if there is a regression.
+import sys
+import json
+import optparse
+
+def read_results(filename):
+	results = dict()
+	with open(filename) as f:
+		for line in f:
+			line = line.strip()
+			if not line:
+				continue
+			record = json.loads(line)
+			key = (record["source"], record["scale"], record["pass"],
+			       record.get("phase", ""))
+			results[key] = record
+	return results
+
+def format_key(key):
+	name = "%s/%s %s" % (key[0], key[1], key[2])
+	if key[3]:
+		name += " " + key[3]
+	return name
+
+def compare(old, new, field, threshold, minimum):
+	regressions = []
+	for key in sorted(new.keys()):
+		if key not in old:
+			continue
+		before = old[key][field]
+		after  = new[key][field]
+		if before < 0 or after < 0 or max(before, after) < minimum:
+			continue
+		change = (after - before) * 100.0 / max(before, 1)
+		if change > threshold:
+			regressions.append((key, before, after, change))
+	return regressions
+
+def main(argv):
+	parser = optparse.OptionParser('usage: %prog [options] <old results> <new results>')
+	parser.add_option("-t", "--threshold",  dest="threshold",  help="allowed slowdown in percent", type="float", default=10.0, metavar="PERCENT")
+	parser.add_option("-m", "--min-time",   dest="min_time",   help="ignore times below this", type="int", default=1000, metavar="USEC")
+	parser.add_option("-b", "--min-bytes",  dest="min_bytes",  help="ignore obstack memory below this", type="int", default=65536, metavar="BYTES")
+	parser.add_option("-p", "--phases",     dest="phases",     help="also compare the backend phases", action="store_true", default=False)
+	(options, args) = parser.parse_args(argv[1:])
+	if len(args) != 2:
+		parser.print_help()
+		return 2
+
+	old = read_results(args[0])
+	new = read_results(args[1])
+	if not options.phases:
+		old = dict((k, v) for (k, v) in old.items() if not k[3])
+		new = dict((k, v) for (k, v) in new.items() if not k[3])
+
+	failed = False
+	for (field, minimum, unit) in [("time_us", options.min_time, "us"),
+	                               ("obstack_peak", options.min_bytes, "bytes")]:
+		for (key, before, after, change) in compare(old, new, field, options.threshold, minimum):
+			print("%-50s %-12s %10d -> %10d %s (%+.1f%%)" % (format_key(key), field, before, after, unit, change))
+			failed = True
+
+	for key in sorted(new.keys()):
+		if key in old and old[key]["nodes_after"] != new[key]["nodes_after"]:
+			print("%-50s %-12s %10d -> %10d" % (format_key(key), "nodes_after", old[key]["nodes_after"], new[key]["nodes_after"]))
+
+	return 1 if failed else 0
+
+if __name__ == "__main__":
+	sys.exit(main(sys.argv))
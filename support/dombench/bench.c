@@ -0,0 +1,242 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Incremental dominance updates on graphs with thousands of blocks.
+ *
+ * Two measurements for each block count:
+ *
+ * - update: A CFG shaped like structured code, a chain of blocks with local
+ *   forward and backward edges. Each step inserts a random local edge and
+ *   deletes it again. The time of dom_insert_edge() and dom_delete_edge(),
+ *   including the renumbering for the next block_dominates() query, is
+ *   compared with the time of compute_doms() after the same edit.
+ * - optimize_graph_df: A chain of if-diamonds, a quarter of whose conditions
+ *   compare constants, so the local optimizations remove control flow
+ *   edges while the dominance information is kept up to date.
+ *
+ * All times are averages over the repetitions.
+ *
+ * Usage: bench [-u updates] [-r repetitions] [blocks...]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "firm.h"
+
+#define UPDATES_DEFAULT 200
+#define REPS_DEFAULT    5
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static ir_graph *new_function(void)
+{
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), id_unique("f%u"), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 1);
+	set_current_ir_graph(irg);
+	return irg;
+}
+
+static void add_pred(ir_node *block, ir_node *pred)
+{
+	int const arity = get_Block_n_cfgpreds(block);
+	ir_node **in    = (ir_node**)malloc((arity + 1) * sizeof(*in));
+	for (int i = 0; i < arity; ++i)
+		in[i] = get_Block_cfgpred(block, i);
+	in[arity] = pred;
+	set_irn_in(block, arity + 1, in);
+	free(in);
+}
+
+/**
+ * Builds a chain of @p n_blocks blocks. Half of them get an additional edge
+ * from one of the 8 blocks before them, and every 8th block on average an
+ * edge from one of the 16 blocks after it.
+ */
+static ir_graph *build_chain(int n_blocks, ir_node **blocks, ir_node **jumps)
+{
+	ir_graph *irg   = new_function();
+	ir_node  *start = get_irg_start_block(irg);
+	blocks[0] = start;
+	jumps[0]  = new_r_Jmp(start);
+	for (int i = 1; i < n_blocks; ++i) {
+		ir_node *block = new_r_Block(irg, 0, NULL);
+		blocks[i] = block;
+		jumps[i]  = new_r_Jmp(block);
+		add_End_keepalive(get_irg_end(irg), block);
+		add_pred(block, jumps[i - 1]);
+		if (i > 8 && rand() % 2 == 0)
+			add_pred(block, jumps[i - 1 - rand() % 8]);
+	}
+	for (int i = 1; i < n_blocks; i += 1 + rand() % 16) {
+		int const from = i + rand() % 16;
+		add_pred(blocks[i], jumps[from < n_blocks ? from : n_blocks - 1]);
+	}
+	ir_node *mem = get_irg_initial_mem(irg);
+	ir_node *res = new_r_Const_long(irg, mode_Is, 0);
+	ir_node *ret = new_r_Return(blocks[n_blocks - 1], mem, 1, &res);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static void bench_updates(int n_blocks, int n_updates)
+{
+	ir_node **blocks = (ir_node**)malloc(n_blocks * sizeof(*blocks));
+	ir_node **jumps  = (ir_node**)malloc(n_blocks * sizeof(*jumps));
+	/* keep the edits as they are */
+	set_optimize(0);
+	ir_graph *irg = build_chain(n_blocks, blocks, jumps);
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+	                         | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+
+	double incremental = 0;
+	double full        = 0;
+	for (int u = 0; u < n_updates; ++u) {
+		int from = 1 + rand() % (n_blocks - 20);
+		int to   = from + 1 + rand() % 16;
+		if (rand() % 4 == 0) {
+			int const t = from;
+			from = to;
+			to   = t;
+		}
+
+		add_pred(blocks[to], jumps[from]);
+		double start = now();
+		dom_insert_edge(blocks[from], blocks[to]);
+		(void)block_dominates(blocks[from], blocks[to]);
+		incremental += now() - start;
+
+		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+		start = now();
+		compute_doms(irg);
+		full += now() - start;
+
+		int const pos = get_Block_n_cfgpreds(blocks[to]) - 1;
+		set_Block_cfgpred(blocks[to], pos, new_r_Bad(irg, mode_X));
+		start = now();
+		dom_delete_edge(blocks[from], blocks[to]);
+		(void)block_dominates(blocks[from], blocks[to]);
+		incremental += now() - start;
+
+		clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+		start = now();
+		compute_doms(irg);
+		full += now() - start;
+	}
+	printf("%6d blocks  update             %8.1f us  compute_doms %8.1f us\n",
+	       n_blocks, incremental * 1e6 / (2 * n_updates),
+	       full * 1e6 / (2 * n_updates));
+
+	set_optimize(1);
+	free_ir_graph(irg);
+	free(jumps);
+	free(blocks);
+}
+
+/** Builds a chain of if-diamonds with about @p n_blocks blocks. */
+static ir_graph *build_diamonds(int n_blocks)
+{
+	ir_graph *irg   = new_function();
+	ir_node  *param = new_Proj(get_irg_args(irg), mode_Is, 0);
+	set_value(0, param);
+	for (int i = 0; i < n_blocks / 3; ++i) {
+		ir_node *sel = rand() % 4 == 0 ? new_Const_long(mode_Is, rand() % 4)
+		                               : get_value(0, mode_Is);
+		ir_node *cmp  = new_Cmp(sel, new_Const_long(mode_Is, 2),
+		                        ir_relation_less);
+		ir_node *cond = new_Cond(cmp);
+
+		ir_node *then_block = new_immBlock();
+		add_immBlock_pred(then_block, new_Proj(cond, mode_X, pn_Cond_true));
+		mature_immBlock(then_block);
+		set_cur_block(then_block);
+		set_value(0, new_Sub(param, get_value(0, mode_Is), mode_Is));
+		ir_node *then_jmp = new_Jmp();
+
+		ir_node *else_block = new_immBlock();
+		add_immBlock_pred(else_block, new_Proj(cond, mode_X, pn_Cond_false));
+		mature_immBlock(else_block);
+		set_cur_block(else_block);
+		ir_node *else_jmp = new_Jmp();
+
+		ir_node *join = new_immBlock();
+		add_immBlock_pred(join, then_jmp);
+		add_immBlock_pred(join, else_jmp);
+		mature_immBlock(join);
+		set_cur_block(join);
+	}
+	ir_node *res = get_value(0, mode_Is);
+	ir_node *ret = new_Return(get_store(), 1, &res);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static void bench_optimize(int n_blocks, int reps)
+{
+	double total = 0;
+	for (int r = 0; r < reps; ++r) {
+		/* keep the conditions until the optimization runs */
+		set_optimize(0);
+		ir_graph *irg = build_diamonds(n_blocks);
+		set_optimize(1);
+
+		double const start = now();
+		optimize_graph_df(irg);
+		total += now() - start;
+		free_ir_graph(irg);
+	}
+	printf("%6d blocks  optimize_graph_df  %8.1f us\n", n_blocks,
+	       total * 1e6 / reps);
+}
+
+int main(int argc, char **argv)
+{
+	int n_updates = UPDATES_DEFAULT;
+	int reps      = REPS_DEFAULT;
+	int opt;
+	while ((opt = getopt(argc, argv, "u:r:")) != -1) {
+		switch (opt) {
+		case 'u': n_updates = atoi(optarg); break;
+		case 'r': reps      = atoi(optarg); break;
+		default:
+			fprintf(stderr, "usage: %s [-u updates] [-r repetitions] "
+			        "[blocks...]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	static const int default_sizes[] = { 1000, 4000, 16000 };
+	ir_init();
+	srand(1);
+	int const n_sizes = optind < argc ? argc - optind
+	                                  : (int)(sizeof(default_sizes)
+	                                          / sizeof(default_sizes[0]));
+	for (int s = 0; s < n_sizes; ++s) {
+		int const n_blocks = optind < argc ? atoi(argv[optind + s])
+		                                   : default_sizes[s];
+		if (n_blocks < 40) {
+			fprintf(stderr, "at least 40 blocks are needed\n");
+			return 1;
+		}
+		bench_updates(n_blocks, n_updates);
+		bench_optimize(n_blocks, reps);
+	}
+	ir_finish();
+	return 0;
+}
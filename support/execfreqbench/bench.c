@@ -0,0 +1,164 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Scaling of the execution frequency solvers.
+ *
+ * Builds structured CFGs of growing size: sequences of blocks, if-then-else
+ * diamonds and loops nested at most MAX_DEPTH deep. For each size it times
+ * ir_estimate_execfreq() with the dense QR solver and with the sparse solver.
+ * The dense solver needs cubic time, so it only runs up to a maximum size.
+ *
+ * Usage: bench [max blocks] [max dense blocks] [repetitions]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "firm.h"
+#include "execfreq_t.h"
+
+#define MAX_BLOCKS_DEFAULT 16000
+#define MAX_DENSE_DEFAULT  4000
+#define REPS_DEFAULT       3
+#define MIN_BLOCKS         250
+#define MAX_DEPTH          4
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static ir_node *arg;
+static long     n_conds;
+
+/** Ends the current block with a Cond and returns its Projs. */
+static void new_branch(ir_node **true_proj, ir_node **false_proj)
+{
+	ir_node *cmp  = new_Cmp(arg, new_Const_long(mode_Is, n_conds++),
+	                        ir_relation_less);
+	ir_node *cond = new_Cond(cmp);
+	*true_proj  = new_Proj(cond, mode_X, pn_Cond_true);
+	*false_proj = new_Proj(cond, mode_X, pn_Cond_false);
+}
+
+/** Starts a new matured block with the single predecessor @p pred. */
+static void new_block(ir_node *pred)
+{
+	ir_node *block = new_immBlock();
+	add_immBlock_pred(block, pred);
+	mature_immBlock(block);
+	set_cur_block(block);
+}
+
+static ir_graph *build_graph(unsigned n_blocks)
+{
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	char name[32];
+	snprintf(name, sizeof(name), "f%u", n_blocks);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+	arg = new_Proj(get_irg_args(irg), mode_Is, 0);
+	new_block(new_Jmp());
+
+	ir_node *headers[MAX_DEPTH];
+	unsigned depth = 0;
+	unsigned n     = 1;
+	while (n < n_blocks || depth > 0) {
+		ir_node *t;
+		ir_node *f;
+		int const action = n < n_blocks ? rand() % 4 : 3;
+		if (action == 0) {
+			/* straight line */
+			new_block(new_Jmp());
+			n += 1;
+		} else if (action == 1) {
+			/* if-then-else diamond */
+			new_branch(&t, &f);
+			new_block(t);
+			ir_node *then_jmp = new_Jmp();
+			new_block(f);
+			ir_node *else_jmp = new_Jmp();
+			ir_node *join     = new_immBlock();
+			add_immBlock_pred(join, then_jmp);
+			add_immBlock_pred(join, else_jmp);
+			mature_immBlock(join);
+			set_cur_block(join);
+			n += 3;
+		} else if (action == 2 && depth < MAX_DEPTH) {
+			/* open a loop */
+			ir_node *header = new_immBlock();
+			add_immBlock_pred(header, new_Jmp());
+			set_cur_block(header);
+			headers[depth++] = header;
+			n += 1;
+		} else if (depth > 0) {
+			/* close the innermost loop */
+			ir_node *header = headers[--depth];
+			new_branch(&t, &f);
+			add_immBlock_pred(header, t);
+			mature_immBlock(header);
+			new_block(f);
+			n += 1;
+		}
+	}
+
+	ir_node *ret = new_Return(get_store(), 1, &arg);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static double time_solver(ir_graph *irg, execfreq_solver_t solver,
+                          unsigned reps)
+{
+	ir_set_execfreq_solver(solver);
+	double best = 0;
+	for (unsigned r = 0; r < reps; ++r) {
+		double start = now();
+		ir_estimate_execfreq(irg);
+		double t = now() - start;
+		if (r == 0 || t < best)
+			best = t;
+	}
+	return best;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned max_blocks = argc > 1 ? (unsigned)atoi(argv[1]) : MAX_BLOCKS_DEFAULT;
+	unsigned max_dense  = argc > 2 ? (unsigned)atoi(argv[2]) : MAX_DENSE_DEFAULT;
+	unsigned reps       = argc > 3 ? (unsigned)atoi(argv[3]) : REPS_DEFAULT;
+
+	ir_init();
+	srand(1);
+	printf("%8s %12s %12s\n", "blocks", "dense [ms]", "sparse [ms]");
+	for (unsigned n_blocks = MIN_BLOCKS; n_blocks <= max_blocks;
+	     n_blocks *= 2) {
+		ir_graph *irg = build_graph(n_blocks);
+		/* compute the analyses ir_estimate_execfreq() needs up front */
+		ir_set_execfreq_solver(EXECFREQ_SOLVER_SPARSE);
+		ir_estimate_execfreq(irg);
+
+		double const sparse = time_solver(irg, EXECFREQ_SOLVER_SPARSE, reps);
+		if (n_blocks <= max_dense) {
+			double const dense = time_solver(irg, EXECFREQ_SOLVER_DENSE, reps);
+			printf("%8u %12.1f %12.1f\n", n_blocks, dense * 1e3, sparse * 1e3);
+		} else {
+			printf("%8u %12s %12.1f\n", n_blocks, "-", sparse * 1e3);
+		}
+		free_ir_graph(irg);
+	}
+	ir_set_execfreq_solver(EXECFREQ_SOLVER_AUTO);
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,263 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Insert/lookup throughput of the libFirm hash tables.
+ *
+ * Compares the chained set/pset, the quadratic probing hashset.c.inl and the
+ * control byte table swisstable.c.inl (cpset) on the access patterns of the
+ * value table (custom hash/compare of small records, many duplicates) and the
+ * identifier table (string keys).
+ *
+ * Usage: bench [n] [repetitions]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cpset.h"
+#include "hashptr.h"
+#include "obst.h"
+#include "pset.h"
+#include "set.h"
+#include "qpset.h"
+
+#define N_DEFAULT    100000
+#define REPS_DEFAULT 10
+
+/* the identifier table of ident.c */
+typedef struct str_key_t {
+	const char *str;
+	size_t      len;
+} str_key_t;
+
+static struct obstack strset_obst;
+
+static const char *copy_str(str_key_t key)
+{
+	return (const char*)obstack_copy0(&strset_obst, key.str, key.len);
+}
+
+typedef struct strset_t strset_t;
+#define HashSet                   strset_t
+#define HashSetEntry              strset_entry_t
+#define ValueType                 str_key_t
+#define KeyType                   str_key_t
+#define ConstKeyType              const str_key_t
+#define GetKey(value)             (value)
+#define InitData(self,value,key)  ((value).str = copy_str(key), (value).len = (key).len)
+#define Hash(self,key)            hash_data((const unsigned char*)(key).str, (key).len)
+#define KeysEqual(self,key1,key2) ((key1).len == (key2).len && memcmp((key1).str, (key2).str, (key1).len) == 0)
+#define HashSetScope              static
+#define hashset_init_size         strset_init_size
+#define hashset_destroy           strset_destroy
+#define hashset_insert            strset_insert
+#include "swisstable.h"
+#include "swisstable.c.inl"
+
+/** A record like an ir_node: identified by an opcode and two operands. */
+typedef struct record_t {
+	unsigned op;
+	unsigned left;
+	unsigned right;
+} record_t;
+
+static unsigned hash_record(const void *p)
+{
+	const record_t *r = (const record_t*)p;
+	return hash_combine(hash_combine(r->op, r->left), r->right);
+}
+
+static int record_cmp(const void *p1, const void *p2)
+{
+	const record_t *r1 = (const record_t*)p1;
+	const record_t *r2 = (const record_t*)p2;
+	return r1->op != r2->op || r1->left != r2->left || r1->right != r2->right;
+}
+
+static int record_equal(const void *p1, const void *p2)
+{
+	return !record_cmp(p1, p2);
+}
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static size_t     n;
+static unsigned   reps;
+static record_t  *records; /**< n distinct records followed by n duplicates */
+static record_t  *misses;  /**< n records not in the table */
+static str_key_t *strings; /**< n distinct strings followed by n duplicates */
+static str_key_t *missing_strings;
+static size_t     found;
+
+static void init_data(void)
+{
+	records = (record_t*)malloc(3 * n * sizeof(*records));
+	misses  = records + 2 * n;
+	srand(1);
+	for (size_t i = 0; i < n; ++i) {
+		record_t r = { rand() % 64, i, rand() % 1024 };
+		records[i] = r;
+		records[n + (i * 7919) % n] = r;
+		r.left += n;
+		misses[i] = r;
+	}
+
+	strings         = (str_key_t*)malloc(3 * n * sizeof(*strings));
+	missing_strings = strings + 2 * n;
+	for (size_t i = 0; i < n; ++i) {
+		char buf[32];
+		int  len = snprintf(buf, sizeof(buf), "ident_%zu_%d", i, rand() % 100);
+		char *s  = (char*)malloc(len + 1);
+		memcpy(s, buf, len + 1);
+		strings[i].str = s;
+		strings[i].len = len;
+		strings[n + (i * 7919) % n] = strings[i];
+
+		len = snprintf(buf, sizeof(buf), "missing_%zu", i);
+		s   = (char*)malloc(len + 1);
+		memcpy(s, buf, len + 1);
+		missing_strings[i].str = s;
+		missing_strings[i].len = len;
+	}
+}
+
+static void bench_pset(double *t)
+{
+	double start = now();
+	pset  *set   = new_pset(record_cmp, 512);
+	for (size_t i = 0; i < 2 * n; ++i)
+		pset_insert(set, &records[i], hash_record(&records[i]));
+	t[0] += now() - start;
+
+	start = now();
+	for (size_t i = 0; i < n; ++i) {
+		found += pset_find(set, &records[i], hash_record(&records[i])) != NULL;
+		found += pset_find(set, &misses[i], hash_record(&misses[i])) != NULL;
+	}
+	t[1] += now() - start;
+	del_pset(set);
+}
+
+static void bench_qpset(double *t)
+{
+	double  start = now();
+	qpset_t set;
+	set.hash_function = hash_record;
+	set.cmp_function  = record_equal;
+	qpset_init_size(&set, 512);
+	for (size_t i = 0; i < 2 * n; ++i)
+		qpset_insert(&set, &records[i]);
+	t[0] += now() - start;
+
+	start = now();
+	for (size_t i = 0; i < n; ++i) {
+		found += qpset_find(&set, &records[i]) != NULL;
+		found += qpset_find(&set, &misses[i]) != NULL;
+	}
+	t[1] += now() - start;
+	qpset_destroy(&set);
+}
+
+static void bench_cpset(double *t)
+{
+	double  start = now();
+	cpset_t set;
+	cpset_init_size(&set, hash_record, record_equal, 512);
+	for (size_t i = 0; i < 2 * n; ++i)
+		cpset_insert(&set, &records[i]);
+	t[0] += now() - start;
+
+	start = now();
+	for (size_t i = 0; i < n; ++i) {
+		found += cpset_find(&set, &records[i]) != NULL;
+		found += cpset_find(&set, &misses[i]) != NULL;
+	}
+	t[1] += now() - start;
+	cpset_destroy(&set);
+}
+
+static void bench_set(double *t)
+{
+	double start = now();
+	set   *set   = new_set(memcmp, 128);
+	for (size_t i = 0; i < 2 * n; ++i) {
+		str_key_t *s = &strings[i];
+		set_hinsert0(set, s->str, s->len,
+		             hash_data((const unsigned char*)s->str, s->len));
+	}
+	t[0] += now() - start;
+
+	start = now();
+	for (size_t i = 0; i < n; ++i) {
+		str_key_t *s = &strings[i];
+		found += set_find(char, set, s->str, s->len,
+		                  hash_data((const unsigned char*)s->str, s->len)) != NULL;
+		s = &missing_strings[i];
+		found += set_find(char, set, s->str, s->len,
+		                  hash_data((const unsigned char*)s->str, s->len)) != NULL;
+	}
+	t[1] += now() - start;
+	del_set(set);
+}
+
+static void bench_strset(double *t)
+{
+	double   start = now();
+	strset_t set;
+	strset_init_size(&set, 128);
+	obstack_init(&strset_obst);
+	for (size_t i = 0; i < 2 * n; ++i)
+		strset_insert(&set, strings[i]);
+	t[0] += now() - start;
+
+	/* the identifier table has no lookup without insertion */
+	start = now();
+	for (size_t i = 0; i < n; ++i) {
+		str_key_t key = strings[i];
+		found += find_pos(&set, key, Hash(&set, key)) != (size_t)-1;
+		key = missing_strings[i];
+		found += find_pos(&set, key, Hash(&set, key)) != (size_t)-1;
+	}
+	t[1] += now() - start;
+	strset_destroy(&set);
+	obstack_free(&strset_obst, NULL);
+}
+
+static void run(const char *name, void (*bench)(double *t))
+{
+	double t[2] = { 0, 0 };
+	for (unsigned r = 0; r < reps; ++r)
+		bench(t);
+	printf("%-30s insert %7.1f ns/op  lookup %7.1f ns/op\n", name,
+	       t[0] * 1e9 / (reps * 2 * n), t[1] * 1e9 / (reps * 2 * n));
+}
+
+int main(int argc, char **argv)
+{
+	n    = argc > 1 ? (size_t)atol(argv[1]) : N_DEFAULT;
+	reps = argc > 2 ? (unsigned)atoi(argv[2]) : REPS_DEFAULT;
+	init_data();
+
+	run("records: pset (chained)",     bench_pset);
+	run("records: hashset.c.inl",      bench_qpset);
+	run("records: cpset (swisstable)", bench_cpset);
+	run("strings: set (chained)",      bench_set);
+	run("strings: swisstable",         bench_strset);
+
+	/* every run finds each record and string exactly once */
+	if (found != 5 * reps * n) {
+		fprintf(stderr, "wrong number of elements found\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,29 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   cpset on top of the quadratic probing hashset.c.inl, as a baseline.
+ */
+#include <string.h>
+
+#include "qpset.h"
+
+#define HashSet                   qpset_t
+#define HashSetEntry              qpset_entry_t
+#define ValueType                 void*
+#define NullValue                 NULL
+#define DeletedValue              ((void*)-1)
+#define Hash(this,key)            this->hash_function(key)
+#define KeysEqual(this,key1,key2) this->cmp_function(key1, key2)
+#define SCALAR_RETURN
+#define SetRangeEmpty(ptr,size)   memset(ptr, 0, (size) * sizeof(qpset_entry_t))
+
+#define hashset_init_size         qpset_init_size
+#define hashset_destroy           qpset_destroy
+#define hashset_insert            qpset_insert
+#define hashset_find              qpset_find
+
+#include "hashset.c.inl"
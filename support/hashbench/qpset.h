@@ -0,0 +1,32 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   cpset on top of the quadratic probing hashset.c.inl, as a baseline.
+ */
+#ifndef QPSET_H
+#define QPSET_H
+
+#include "cpset.h"
+
+typedef struct qpset_t qpset_t;
+
+#define HashSet          qpset_t
+#define HashSetEntry     qpset_entry_t
+#define ValueType        void*
+#define ADDITIONAL_DATA  cpset_cmp_function cmp_function; cpset_hash_function hash_function;
+#include "hashset.h"
+#undef ADDITIONAL_DATA
+#undef ValueType
+#undef HashSetEntry
+#undef HashSet
+
+void qpset_init_size(qpset_t *self, size_t expected_elems);
+void qpset_destroy(qpset_t *self);
+void *qpset_insert(qpset_t *self, void *obj);
+void *qpset_find(const qpset_t *self, const void *obj);
+
+#endif
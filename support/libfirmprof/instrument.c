@@ -12,8 +12,8 @@ void __init_firmprof(const char*, unsigned int*, size_t)
 
 typedef struct _profile_counter_t {
 	const char *filename;
-	unsigned   *counters;
-	unsigned    len;
+	unsigned   *counters; /**< pairs of 32-bit words (low, high) */
+	unsigned    len;      /**< number of 64-bit counters */
 	struct _profile_counter_t *next;
 } profile_counter_t;
 
@@ -21,23 +21,26 @@ static profile_counter_t *counters = NULL;
 
 /**
  * Write counter values to profiling output file.
- * We define our output format to be a sequence of 32-bit unsigned integer
- * values stored in little endian format.
+ * The instrumented code keeps each 64-bit counter as a pair of 32-bit words,
+ * low word first. We define our output format to be a sequence of 64-bit
+ * unsigned integer values stored in little endian format.
  */
 void write_little_endian(unsigned *counter, unsigned len, FILE *f)
 {
 	unsigned i;
 
 	for (i = 0; i < len; ++i) {
-		unsigned      v = counter[i];
-		unsigned char bytes[4];
+		unsigned      lo = counter[2 * i];
+		unsigned      hi = counter[2 * i + 1];
+		unsigned char bytes[8];
+		unsigned      b;
 
-		bytes[0] = ((v >>  0) & 0xff);
-		bytes[1] = ((v >>  8) & 0xff);
-		bytes[2] = ((v >> 16) & 0xff);
-		bytes[3] = ((v >> 24) & 0xff);
+		for (b = 0; b < 4; ++b) {
+			bytes[b]     = (lo >> (8 * b)) & 0xff;
+			bytes[b + 4] = (hi >> (8 * b)) & 0xff;
+		}
 
-		fwrite(bytes, 1, 4, f);
+		fwrite(bytes, 1, 8, f);
 	}
 }
 
@@ -0,0 +1,126 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Throughput of node creation and graph walks.
+ *
+ * Builds a balanced tree of Add and Mul nodes over distinct constants with
+ * the local optimizations switched off, so every node is really created.
+ * Reports the graph obstack memory per node and the throughput of creating
+ * the nodes, of irg_walk_graph() visiting every node and its inputs, and of
+ * computing the out edges. Each time is the best of all repetitions.
+ *
+ * Usage: bench [nodes] [repetitions]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "firm.h"
+#include "irgraph_t.h"
+
+#define NODES_DEFAULT 3000000
+#define REPS_DEFAULT  5
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/** Builds a graph returning a tree of about @p n_nodes operations. */
+static ir_graph *build_graph(unsigned n_nodes)
+{
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(0, 1);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), id_unique("f%u"), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	unsigned  n_values = n_nodes / 2 + 1;
+	ir_node **values   = (ir_node**)malloc(n_values * sizeof(*values));
+	for (unsigned i = 0; i < n_values; ++i)
+		values[i] = new_Const_long(mode_Is, i);
+	for (unsigned level = 0; n_values > 1; ++level) {
+		unsigned n = 0;
+		for (unsigned i = 0; i + 1 < n_values; i += 2) {
+			ir_node *l = values[i];
+			ir_node *r = values[i + 1];
+			values[n++] = level % 2 == 0 ? new_Add(l, r, mode_Is)
+			                             : new_Mul(l, r, mode_Is);
+		}
+		if (n_values % 2 != 0)
+			values[n++] = values[n_values - 1];
+		n_values = n;
+	}
+
+	ir_node *ret = new_Return(get_store(), 1, values);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+	free(values);
+	return irg;
+}
+
+static unsigned long n_inputs;
+
+static void count_inputs(ir_node *node, void *env)
+{
+	(void)env;
+	for (int i = 0, n = get_irn_arity(node); i < n; ++i)
+		n_inputs += get_irn_n(node, i) != NULL;
+}
+
+int main(int argc, char **argv)
+{
+	unsigned n_nodes = argc > 1 ? (unsigned)atoi(argv[1]) : NODES_DEFAULT;
+	unsigned reps    = argc > 2 ? (unsigned)atoi(argv[2]) : REPS_DEFAULT;
+
+	ir_init();
+	/* keep the local optimizations from folding the tree */
+	set_optimize(0);
+
+	double    best_create = 0;
+	double    best_walk   = 0;
+	double    best_outs   = 0;
+	unsigned  n_created   = 0;
+	size_t    memory      = 0;
+	for (unsigned r = 0; r < reps; ++r) {
+		double    start = now();
+		ir_graph *irg   = build_graph(n_nodes);
+		double    t     = now() - start;
+		if (r == 0 || t < best_create)
+			best_create = t;
+		n_created = get_irg_last_idx(irg);
+		memory    = obstack_memory_used(get_irg_obstack(irg));
+
+		start    = now();
+		n_inputs = 0;
+		irg_walk_graph(irg, count_inputs, NULL, NULL);
+		t = now() - start;
+		if (r == 0 || t < best_walk)
+			best_walk = t;
+
+		start = now();
+		assure_irg_outs(irg);
+		t = now() - start;
+		if (r == 0 || t < best_outs)
+			best_outs = t;
+
+		free_ir_graph(irg);
+	}
+
+	printf("nodes           %u\n", n_created);
+	printf("graph obstack   %.0f bytes/node\n", (double)memory / n_created);
+	printf("node creation   %.1f Mnodes/s\n", n_created / best_create * 1e-6);
+	printf("irg_walk        %.1f Mnodes/s\n", n_created / best_walk * 1e-6);
+	printf("compute outs    %.1f Mnodes/s\n", n_created / best_outs * 1e-6);
+
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,346 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Spill costs of belady with and without the loop placement.
+ *
+ * Builds random functions of the form
+ *
+ *   int f(int n, int *p) {
+ *       int v0 = p[0] + 0, v1 = p[1] + 1, ..., acc = 0;
+ *       for (int i = 0; i < n; ++i) {
+ *           for (int j = 0; j < n; ++j) {
+ *               acc = (acc ^ (v3 + j)) + v7 * j;  // hot uses
+ *               if ((j & 15) == 0)
+ *                   acc += v2 + v9;              // cold uses
+ *           }
+ *           acc += v5 * i;                       // outer loop uses
+ *       }
+ *       return acc + v1 + v4;                    // uses after the loops
+ *   }
+ *
+ * with more values live through the loops than there are registers, and
+ * compiles them once with the backend option belady-loopplacement disabled
+ * and once enabled.
+ * For both it reports the sums of the execution frequency weighted costs of
+ * the spills and of the reloads and remats, from the statev events
+ * spill_costs and spill_reload_costs. With -S the assembler code of both
+ * runs is written to prefix.off.s and prefix.on.s, each function f<k> is
+ * deterministic, so both can be linked against the same test driver.
+ *
+ * Usage: bench [-f functions] [-s seed] [-b backend option] [-S prefix]
+ */
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "firm.h"
+#include "statev.h"
+#include "xmalloc.h"
+
+#define FUNCTIONS_DEFAULT 40
+#define MAX_BE_OPTIONS    8
+
+enum { V_MIN = 16, V_MAX = 28 };
+
+static ir_mode *offset_mode;
+
+static ir_node *new_int(long value)
+{
+	return new_Const_long(mode_Is, value);
+}
+
+/** Adds the uses of the values in @p set to the accumulator @p acc. */
+static void use_values(const unsigned char *set, int n_values, int acc,
+                       ir_node *index)
+{
+	for (int v = 0; v < n_values; ++v) {
+		if (!set[v])
+			continue;
+		ir_node *sum = get_value(acc, mode_Is);
+		ir_node *val = get_value(v, mode_Is);
+		if (index != NULL && v % 2 == 0)
+			val = new_Mul(val, index, mode_Is);
+		else if (index != NULL)
+			sum = new_Eor(sum, new_Add(val, index, mode_Is), mode_Is);
+		set_value(acc, new_Add(sum, val, mode_Is));
+	}
+}
+
+/** Chooses each of @p n_values values with probability 1/@p one_in. */
+static void choose(unsigned char *set, int n_values, int one_in)
+{
+	for (int v = 0; v < n_values; ++v)
+		set[v] = rand() % one_in == 0;
+}
+
+/** Builds the blocks of the loop for (var = 0; var < n; ++var). */
+static ir_node *begin_loop(int var, ir_node *n, ir_node **exit)
+{
+	set_value(var, new_int(0));
+	ir_node *entry = new_Jmp();
+	ir_node *header = new_immBlock();
+	add_immBlock_pred(header, entry);
+	set_cur_block(header);
+	ir_node *cmp  = new_Cmp(get_value(var, mode_Is), n, ir_relation_less);
+	ir_node *cond = new_Cond(cmp);
+
+	ir_node *body = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+	mature_immBlock(body);
+	*exit = new_Proj(cond, mode_X, pn_Cond_false);
+	set_cur_block(body);
+	return header;
+}
+
+static void end_loop(int var, ir_node *header, ir_node *exit)
+{
+	ir_node *next = new_Add(get_value(var, mode_Is), new_int(1), mode_Is);
+	set_value(var, next);
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(header);
+
+	ir_node *after = new_immBlock();
+	add_immBlock_pred(after, exit);
+	mature_immBlock(after);
+	set_cur_block(after);
+}
+
+static void build_function(int nr)
+{
+	char name[16];
+	snprintf(name, sizeof(name), "f%d", nr);
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(2, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_param_type(mtp, 1, new_type_pointer(int_type));
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	int const  n_values = V_MIN + rand() % (V_MAX - V_MIN + 1);
+	int const  acc = n_values, i = n_values + 1, j = n_values + 2;
+	ir_graph  *irg = new_ir_graph(entity, n_values + 3);
+	set_current_ir_graph(irg);
+
+	ir_node *args = get_irg_args(irg);
+	ir_node *n    = new_Proj(args, mode_Is, 0);
+	ir_node *p    = new_Proj(args, mode_P, 1);
+	for (int v = 0; v < n_values; ++v) {
+		ir_node *ptr  = new_Add(p, new_Const_long(offset_mode, 4 * v), mode_P);
+		ir_node *load = new_Load(get_store(), ptr, mode_Is, int_type,
+		                         cons_none);
+		set_store(new_Proj(load, mode_M, pn_Load_M));
+		ir_node *res = new_Proj(load, mode_Is, pn_Load_res);
+		set_value(v, new_Add(res, new_int(v), mode_Is));
+	}
+	set_value(acc, new_int(0));
+
+	unsigned char hot[V_MAX], cold[V_MAX], outer[V_MAX], after[V_MAX];
+	choose(hot, n_values, 4);
+	choose(cold, n_values, 3);
+	choose(outer, n_values, 4);
+	choose(after, n_values, 2);
+
+	ir_node *outer_exit;
+	ir_node *outer_header = begin_loop(i, n, &outer_exit);
+	for (int l = 0, n_inner = 1 + rand() % 2; l < n_inner; ++l) {
+		ir_node *inner_exit;
+		ir_node *inner_header = begin_loop(j, n, &inner_exit);
+		use_values(hot, n_values, acc, get_value(j, mode_Is));
+
+		ir_node *masked = new_And(get_value(j, mode_Is), new_int(15), mode_Is);
+		ir_node *cmp    = new_Cmp(masked, new_int(0), ir_relation_equal);
+		ir_node *cond   = new_Cond(cmp);
+		ir_node *merge  = new_immBlock();
+		ir_node *rare   = new_immBlock();
+		add_immBlock_pred(rare, new_Proj(cond, mode_X, pn_Cond_true));
+		add_immBlock_pred(merge, new_Proj(cond, mode_X, pn_Cond_false));
+		mature_immBlock(rare);
+		set_cur_block(rare);
+		use_values(cold, n_values, acc, NULL);
+		add_immBlock_pred(merge, new_Jmp());
+		mature_immBlock(merge);
+		set_cur_block(merge);
+
+		end_loop(j, inner_header, inner_exit);
+		choose(cold, n_values, 3);
+	}
+	use_values(outer, n_values, acc, get_value(i, mode_Is));
+	end_loop(i, outer_header, outer_exit);
+
+	use_values(after, n_values, acc, NULL);
+	ir_node *result = get_value(acc, mode_Is);
+	ir_node *ret    = new_Return(get_store(), 1, &result);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+}
+
+typedef struct costs_t {
+	double spills;
+	double reloads;
+	double loop_before;
+	double loop_after;
+	double hoist_before;
+	double hoist_after;
+} costs_t;
+
+static char *read_file(const char *name)
+{
+	FILE *file = fopen(name, "rb");
+	if (file == NULL) {
+		perror(name);
+		exit(1);
+	}
+	fseek(file, 0, SEEK_END);
+	long const size = ftell(file);
+	rewind(file);
+	char        *text   = XMALLOCN(char, size + 1);
+	size_t const n_read = fread(text, 1, size, file);
+	text[n_read] = '\0';
+	fclose(file);
+	return text;
+}
+
+/** Returns the sum of all values of the event @p name in @p events. */
+static double sum_events(const char *events, const char *name)
+{
+	char key[64];
+	snprintf(key, sizeof(key), "E;%s;", name);
+	double sum = 0;
+	for (const char *pos = events; (pos = strstr(pos, key)) != NULL;) {
+		pos += strlen(key);
+		sum += strtod(pos, NULL);
+	}
+	return sum;
+}
+
+/**
+ * Compiles the functions in a new process, as libFirm can only be initialized
+ * once, and returns the costs it reported.
+ */
+static costs_t run(unsigned seed, int n_functions, char **be_options,
+                   int n_be_options, bool placement, const char *asm_prefix)
+{
+	char ev_prefix[64];
+	char ev_name[80];
+	snprintf(ev_prefix, sizeof(ev_prefix), "spillbench.%d", (int)getpid());
+	snprintf(ev_name, sizeof(ev_name), "%s.ev", ev_prefix);
+
+	fflush(NULL);
+	pid_t const pid = fork();
+	if (pid < 0) {
+		perror("fork");
+		exit(1);
+	}
+	if (pid == 0) {
+		ir_init();
+		for (int o = 0; o < n_be_options; ++o) {
+			if (!be_parse_arg(be_options[o])) {
+				fprintf(stderr, "invalid backend option '%s'\n", be_options[o]);
+				_exit(1);
+			}
+		}
+		int const res = be_parse_arg(placement ? "belady-loopplacement=1"
+		                                       : "belady-loopplacement=0");
+		if (!res) {
+			fprintf(stderr, "belady-loopplacement not available\n");
+			_exit(1);
+		}
+		offset_mode = get_reference_mode_unsigned_eq(mode_P);
+
+		srand(seed);
+		for (int f = 0; f < n_functions; ++f)
+			build_function(f);
+
+		FILE *out = NULL;
+		if (asm_prefix != NULL) {
+			char asm_name[256];
+			snprintf(asm_name, sizeof(asm_name), "%s.%s.s", asm_prefix,
+			         placement ? "on" : "off");
+			out = fopen(asm_name, "w");
+		} else {
+			out = fopen("/dev/null", "w");
+		}
+		if (out == NULL) {
+			perror("output");
+			_exit(1);
+		}
+		stat_ev_begin(ev_prefix, "^(spill_|belady_loop_)");
+		be_lower_for_target();
+		be_main(out, "spillbench");
+		stat_ev_end();
+		fclose(out);
+		ir_finish();
+		_exit(0);
+	}
+	int status;
+	waitpid(pid, &status, 0);
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		fprintf(stderr, "compilation failed\n");
+		exit(1);
+	}
+
+	char *events = read_file(ev_name);
+	costs_t const costs = {
+		sum_events(events, "spill_costs"),
+		sum_events(events, "spill_reload_costs"),
+		sum_events(events, "belady_loop_costs_before"),
+		sum_events(events, "belady_loop_costs_after"),
+		sum_events(events, "spill_hoist_costs_before"),
+		sum_events(events, "spill_hoist_costs_after"),
+	};
+	free(events);
+	remove(ev_name);
+	return costs;
+}
+
+int main(int argc, char **argv)
+{
+	int         n_functions = FUNCTIONS_DEFAULT;
+	unsigned    seed        = 1;
+	const char *asm_prefix  = NULL;
+	char       *be_options[MAX_BE_OPTIONS];
+	int         n_be_options = 0;
+	int         opt;
+	while ((opt = getopt(argc, argv, "f:s:b:S:")) != -1) {
+		switch (opt) {
+		case 'f': n_functions = atoi(optarg);        break;
+		case 's': seed        = (unsigned)atoi(optarg); break;
+		case 'S': asm_prefix  = optarg;              break;
+		case 'b':
+			if (n_be_options == MAX_BE_OPTIONS) {
+				fprintf(stderr, "too many backend options\n");
+				return 1;
+			}
+			be_options[n_be_options++] = optarg;
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-f functions] [-s seed] "
+			        "[-b backend option] [-S prefix]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	costs_t const off = run(seed, n_functions, be_options, n_be_options,
+	                        false, asm_prefix);
+	costs_t const on  = run(seed, n_functions, be_options, n_be_options,
+	                        true, asm_prefix);
+
+	printf("%-26s %14s %14s\n", "", "placement off", "placement on");
+	printf("%-26s %14.0f %14.0f\n", "spill costs", off.spills, on.spills);
+	printf("%-26s %14.0f %14.0f\n", "reload and remat costs", off.reloads,
+	       on.reloads);
+	printf("%-26s %14.0f %14.0f\n", "total", off.spills + off.reloads,
+	       on.spills + on.reloads);
+	printf("\nestimates of the placement phases:\n");
+	printf("%-26s %14.0f %14.0f\n", "values kept in memory", on.loop_before,
+	       on.loop_after);
+	printf("%-26s %14.0f %14.0f\n", "spills hoisted", on.hoist_before,
+	       on.hoist_after);
+	return 0;
+}
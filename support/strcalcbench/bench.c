@@ -0,0 +1,194 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2016 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Throughput of the strcalc operations.
+ *
+ * Runs the strcalc operations which constant folding uses most on random
+ * operands of 32 and 64 bits, and the same operations as tarval arithmetic
+ * on mode_Ls, which adds the mode handling and the tarval table.
+ *
+ * Usage: bench [n] [repetitions]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "firm.h"
+#include "strcalc.h"
+
+#define N_DEFAULT    10000
+#define REPS_DEFAULT 20
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static size_t     n;
+static unsigned   reps;
+static unsigned   value_len; /**< number of words of a strcalc value */
+static sc_word   *values;    /**< 2 * n random values, the divisors are odd */
+static sc_word   *result;
+static sc_word   *result2;
+static char     **strings;   /**< the decimal representations of the values */
+static ir_tarval **tarvals;
+static unsigned long checksum;
+
+static sc_word *get_operand(size_t i)
+{
+	return &values[i * value_len];
+}
+
+static long random_long(unsigned bits)
+{
+	unsigned long v = 0;
+	for (unsigned i = 0; i < 4; ++i)
+		v = v << 16 | (rand() & 0xFFFF);
+	if (bits < 64)
+		v &= (1UL << bits) - 1;
+	return (long)v;
+}
+
+static void init_data(unsigned bits)
+{
+	srand(1);
+	for (size_t i = 0; i < 2 * n; ++i) {
+		long v = random_long(bits);
+		/* odd divisors, which are not zero */
+		if (i >= n)
+			v |= 1;
+		sc_val_from_long(v, get_operand(i));
+
+		char buf[32];
+		snprintf(buf, sizeof(buf), "%ld", v < 0 ? -v : v);
+		free(strings[i]);
+		strings[i] = strdup(buf);
+		tarvals[i] = new_tarval_from_long(v, mode_Ls);
+	}
+}
+
+/** Folds the result into the checksum, so the work cannot be dropped. */
+static void consume(sc_word const *value)
+{
+	checksum += value[0];
+}
+
+static void bench_add(void)
+{
+	for (size_t i = 0; i < n; ++i) {
+		sc_add(get_operand(i), get_operand(n + i), result);
+		consume(result);
+	}
+}
+
+static void bench_mul(void)
+{
+	for (size_t i = 0; i < n; ++i) {
+		sc_mul(get_operand(i), get_operand(n + i), result);
+		consume(result);
+	}
+}
+
+static void bench_divmod(void)
+{
+	for (size_t i = 0; i < n; ++i) {
+		sc_divmod(get_operand(i), get_operand(n + i), result, result2);
+		consume(result);
+		consume(result2);
+	}
+}
+
+static void bench_shift(void)
+{
+	for (size_t i = 0; i < n; ++i) {
+		sc_shlI(get_operand(i), i % 64, result);
+		sc_shrsI(result, i % 64, 64, result2);
+		consume(result2);
+	}
+}
+
+static void bench_print(void)
+{
+	char buf[64];
+	for (size_t i = 0; i < n; ++i) {
+		char const *str = sc_print_buf(buf, sizeof(buf), get_operand(i), 64,
+		                               SC_DEC, true);
+		checksum += str[0];
+	}
+}
+
+static void bench_parse(void)
+{
+	for (size_t i = 0; i < n; ++i) {
+		char const *str = strings[i];
+		sc_val_from_str(false, 10, str, strlen(str), result);
+		consume(result);
+	}
+}
+
+static void bench_tarval(void)
+{
+	for (size_t i = 0; i < n; ++i) {
+		ir_tarval *a = tarvals[i];
+		ir_tarval *b = tarvals[n + i];
+		ir_tarval *t = tarval_add(tarval_mul(a, b), tarval_div(a, b));
+		t = tarval_shl_unsigned(tarval_add(t, tarval_mod(a, b)), i % 64);
+		checksum += get_tarval_long(t);
+	}
+}
+
+static void run(const char *name, void (*bench)(void))
+{
+	double start = now();
+	for (unsigned r = 0; r < reps; ++r)
+		bench();
+	double t = now() - start;
+	printf("%-24s %7.1f ns/op\n", name, t * 1e9 / (reps * n));
+}
+
+int main(int argc, char **argv)
+{
+	n    = argc > 1 ? (size_t)atol(argv[1]) : N_DEFAULT;
+	reps = argc > 2 ? (unsigned)atoi(argv[2]) : REPS_DEFAULT;
+
+	ir_init();
+	value_len = sc_get_value_length();
+	values    = (sc_word*)malloc(2 * n * value_len * sizeof(*values));
+	result    = (sc_word*)malloc(value_len * sizeof(*result));
+	result2   = (sc_word*)malloc(value_len * sizeof(*result2));
+	strings   = (char**)calloc(2 * n, sizeof(*strings));
+	tarvals   = (ir_tarval**)malloc(2 * n * sizeof(*tarvals));
+
+	static unsigned const sizes[] = { 32, 64 };
+	for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+		unsigned const bits = sizes[s];
+		init_data(bits);
+		printf("%u bit operands:\n", bits);
+		run("  sc_add",            bench_add);
+		run("  sc_mul",            bench_mul);
+		run("  sc_divmod",         bench_divmod);
+		run("  sc_shlI + sc_shrsI", bench_shift);
+		run("  sc_print_buf",      bench_print);
+		run("  sc_val_from_str",   bench_parse);
+		run("  tarval arithmetic", bench_tarval);
+	}
+	/* keep the results alive */
+	printf("checksum %lx\n", checksum);
+
+	for (size_t i = 0; i < 2 * n; ++i)
+		free(strings[i]);
+	free(strings);
+	free(tarvals);
+	free(result2);
+	free(result);
+	free(values);
+	ir_finish();
+	return 0;
+}
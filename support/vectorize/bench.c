@@ -0,0 +1,128 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Timing and verification driver for the vectorizer kernels.
+ *
+ * Usage: bench [n] [repetitions]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "kernels.h"
+
+#define N_DEFAULT    4099
+#define REPS_DEFAULT 20000
+
+static unsigned char      b0[N_DEFAULT * 64], b1[N_DEFAULT * 64];
+static unsigned           u0[N_DEFAULT * 16], u1[N_DEFAULT * 16];
+static unsigned long long q0[N_DEFAULT * 8],  q1[N_DEFAULT * 8];
+static float              f0[N_DEFAULT * 16], f1[N_DEFAULT * 16];
+static double             d0[N_DEFAULT * 8],  d1[N_DEFAULT * 8];
+
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static unsigned failures;
+
+static void check(char const *name, int ok)
+{
+	if (!ok) {
+		fprintf(stderr, "%s: wrong result\n", name);
+		++failures;
+	}
+}
+
+/** Verifies the kernels against the obvious results for all small sizes,
+ * including overlapping arguments. */
+static void verify(void)
+{
+	for (size_t n = 0; n < 70; ++n) {
+		memset(b0, 1, sizeof(b0));
+		fill8(b0 + 1, 7, n);
+		for (size_t i = 0; i < n + 2; ++i)
+			check("fill8", b0[i] == (i >= 1 && i <= n ? 7 : 1));
+
+		for (size_t i = 0; i < n + 8; ++i)
+			u0[i] = i;
+		copy32(u0 + 3, u0, n);
+		for (size_t i = 0; i < n; ++i)
+			check("copy32", u0[i + 3] == i % 3);
+
+		for (size_t i = 0; i < n + 1; ++i) {
+			b0[i] = i;
+			b1[i] = 3 * i;
+		}
+		add8(b0, b0, b1, n);
+		for (size_t i = 0; i < n; ++i)
+			check("add8", b0[i] == (unsigned char)(4 * i));
+
+		for (size_t i = 0; i < n + 4; ++i)
+			f0[i] = i;
+		saxpy(f0 + 1, f0, 2.0f, n);
+		float expect = 0;
+		for (size_t i = 0; i < n; ++i) {
+			expect = 2.0f * expect + (i + 1);
+			check("saxpy", f0[i + 1] == expect);
+		}
+	}
+}
+
+typedef void (*run_func)(size_t n);
+
+static void run_fill8(size_t n)  { fill8(b0, 42, n * 4); }
+static void run_fill32(size_t n) { fill32(u0, 42, n); }
+static void run_filld(size_t n)  { filld(d0, 4.2, n / 2); }
+static void run_copy32(size_t n) { copy32(u1, u0, n); }
+static void run_add8(size_t n)   { add8(b0, b0, b1, n * 4); }
+static void run_xor64(size_t n)  { xor64(q0, q1, n / 2); }
+static void run_saxpy(size_t n)  { saxpy(f0, f1, 0.5f, n); }
+static void run_daxpy(size_t n)  { daxpy(d0, d1, 0.5, n / 2); }
+
+static size_t scan_result;
+static void run_scan8(size_t n)  { scan_result += scan8(b1, 0xff, n * 4); }
+
+static const struct {
+	char const *name;
+	run_func    func;
+} kernels[] = {
+	{ "fill8",  run_fill8  },
+	{ "fill32", run_fill32 },
+	{ "filld",  run_filld  },
+	{ "copy32", run_copy32 },
+	{ "add8",   run_add8   },
+	{ "xor64",  run_xor64  },
+	{ "saxpy",  run_saxpy  },
+	{ "daxpy",  run_daxpy  },
+	{ "scan8",  run_scan8  },
+};
+
+int main(int argc, char **argv)
+{
+	size_t   n    = argc > 1 ? strtoul(argv[1], NULL, 0) : N_DEFAULT;
+	unsigned reps = argc > 2 ? strtoul(argv[2], NULL, 0) : REPS_DEFAULT;
+	if (n > N_DEFAULT) {
+		fprintf(stderr, "n must not exceed %d\n", N_DEFAULT);
+		return 1;
+	}
+
+	verify();
+	memset(b1, 0, sizeof(b1));
+	for (size_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); ++i) {
+		double start = now();
+		for (unsigned r = 0; r < reps; ++r)
+			kernels[i].func(n);
+		double time = now() - start;
+		printf("%-8s %10.3f ms\n", kernels[i].name, time * 1e3);
+	}
+	return failures != 0;
+}
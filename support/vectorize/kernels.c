@@ -0,0 +1,72 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Array kernels for the loop vectorizer.
+ *
+ * Compile this file with the compiler under test; bench.c only calls it.
+ * The kernels take may-alias pointers on purpose, so the vectorized loops
+ * include the runtime distance checks.
+ */
+#include "kernels.h"
+
+void fill8(unsigned char *dst, unsigned char value, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		dst[i] = value;
+}
+
+void fill32(unsigned *dst, unsigned value, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		dst[i] = value;
+}
+
+void filld(double *dst, double value, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		dst[i] = value;
+}
+
+void copy32(unsigned *dst, unsigned const *src, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		dst[i] = src[i];
+}
+
+void add8(unsigned char *dst, unsigned char const *a, unsigned char const *b,
+          size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		dst[i] = a[i] + b[i];
+}
+
+void xor64(unsigned long long *dst, unsigned long long const *src, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		dst[i] ^= src[i];
+}
+
+void saxpy(float *y, float const *x, float a, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		y[i] = a * x[i] + y[i];
+}
+
+void daxpy(double *y, double const *x, double a, size_t n)
+{
+	for (size_t i = 0; i < n; ++i)
+		y[i] = a * x[i] + y[i];
+}
+
+/* Early exit loop: stays scalar, serves as the baseline. */
+size_t scan8(unsigned char const *src, unsigned char value, size_t n)
+{
+	size_t i = 0;
+	while (i < n && src[i] != value)
+		++i;
+	return i;
+}
@@ -0,0 +1,26 @@
+/*
+ * This file is part of libFirm.
+ * Copyright (C) 2012 University of Karlsruhe.
+ */
+
+/**
+ * @file
+ * @brief   Array kernels for the loop vectorizer.
+ */
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <stddef.h>
+
+void fill8(unsigned char *dst, unsigned char value, size_t n);
+void fill32(unsigned *dst, unsigned value, size_t n);
+void filld(double *dst, double value, size_t n);
+void copy32(unsigned *dst, unsigned const *src, size_t n);
+void add8(unsigned char *dst, unsigned char const *a, unsigned char const *b,
+          size_t n);
+void xor64(unsigned long long *dst, unsigned long long const *src, size_t n);
+void saxpy(float *y, float const *x, float a, size_t n);
+void daxpy(double *y, double const *x, double a, size_t n);
+size_t scan8(unsigned char const *src, unsigned char value, size_t n);
+
+#endif
@@ -0,0 +1,140 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "firm.h"
+#include "statev.h"
+
+static ir_type *int_type;
+static ir_node *p;
+static ir_node *addr_g;
+
+/**
+ * Builds
+ *   static int g;
+ *   void f(int *p) { *p = 0; g = 1; }
+ * The address of g is not taken, so p cannot point to it.
+ */
+static ir_graph *build_graph(void)
+{
+	int_type = get_type_for_mode(mode_Is);
+	ir_entity *g = new_entity(get_glob_type(), new_id_from_str("g"), int_type);
+	set_entity_visibility(g, ir_visibility_local);
+
+	ir_type *mtp = new_type_method(1, 0);
+	set_method_param_type(mtp, 0, new_type_pointer(int_type));
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str("f"), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	p      = new_Proj(get_irg_args(irg), mode_P, 0);
+	addr_g = new_Address(g);
+	ir_node *ptrs[]   = { p, addr_g };
+	ir_node *values[] = { new_Const_long(mode_Is, 0), new_Const_long(mode_Is, 1) };
+	for (int i = 0; i < 2; ++i) {
+		ir_node *store = new_Store(get_store(), ptrs[i], values[i], int_type,
+		                           cons_none);
+		set_store(new_Proj(store, mode_M, pn_Store_M));
+	}
+	ir_node *ret = new_Return(get_store(), 0, NULL);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+/** Takes the address of g by adding *p = &g. */
+static void take_address(ir_graph *irg)
+{
+	ir_node *block = get_nodes_block(p);
+	ir_node *store = new_r_Store(block, get_irg_no_mem(irg), p, addr_g,
+	                             get_type_for_mode(mode_P), cons_none);
+	keep_alive(new_r_Proj(store, mode_M, pn_Store_M));
+}
+
+static ir_alias_relation query(void)
+{
+	return get_alias_relation(p, int_type, 4, addr_g, int_type, 4);
+}
+
+/**
+ * Returns the values of the event @p name written into @p events, in
+ * order.
+ */
+static unsigned get_events(const char *events, const char *name,
+                           unsigned *values, unsigned max)
+{
+	char key[64];
+	snprintf(key, sizeof(key), "E;%s;", name);
+	unsigned n = 0;
+	for (const char *pos = events; (pos = strstr(pos, key)) != NULL;) {
+		pos += strlen(key);
+		assert(n < max);
+		values[n++] = (unsigned)strtoul(pos, NULL, 10);
+	}
+	return n;
+}
+
+static char *read_file(const char *name)
+{
+	FILE *file = fopen(name, "rb");
+	assert(file != NULL);
+	fseek(file, 0, SEEK_END);
+	long const size = ftell(file);
+	rewind(file);
+	char        *text   = malloc(size + 1);
+	size_t const n_read = fread(text, 1, size, file);
+	assert(n_read == (size_t)size);
+	(void)n_read;
+	text[size] = '\0';
+	fclose(file);
+	return text;
+}
+
+/**
+ * Repeats alias queries and checks the hits and misses of the alias cache,
+ * which reports its statistics when it is dropped. Changes of the entity
+ * usage of the globals must drop the caches of all graphs, otherwise a
+ * cached relation ignores the taken address.
+ */
+int main(void)
+{
+	ir_init();
+	ir_graph *irg = build_graph();
+	stat_ev_begin("alias_cache", "alias_cache");
+
+	/* a miss and a hit */
+	assure_irp_globals_entity_usage_computed();
+	assert(query() == ir_no_alias);
+	assert(query() == ir_no_alias);
+
+	/* invalidating the usage state drops the cache */
+	take_address(irg);
+	set_irp_globals_entity_usage_state(ir_entity_usage_not_computed);
+	/* the usage flags are not recomputed yet, the result does not matter */
+	(void)query();
+
+	/* recomputing the usage drops the cache, too */
+	assure_irp_globals_entity_usage_computed();
+	assert(query() == ir_may_alias);
+	set_irp_memory_disambiguator_options(aa_opt_none);
+	stat_ev_end();
+
+	char *events = read_file("alias_cache.ev");
+	remove("alias_cache.ev");
+	unsigned queries[4];
+	unsigned hits[4];
+	unsigned const n_queries = get_events(events, "alias_cache_queries", queries, 4);
+	unsigned const n_hits    = get_events(events, "alias_cache_hits", hits, 4);
+	free(events);
+	assert(n_queries == 3 && n_hits == 3);
+	(void)n_queries;
+	(void)n_hits;
+	assert(queries[0] == 2 && hits[0] == 1);
+	assert(queries[1] == 1 && hits[1] == 0);
+	assert(queries[2] == 1 && hits[2] == 0);
+
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,235 @@
+#ifndef _WIN32
+/* for mkdtemp */
+#define _XOPEN_SOURCE 700
+#endif
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "firm.h"
+#include "statev.h"
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+enum { N_FUNCS = 2 };
+
+static char cache_dir[] = "/tmp/firm_codecache_XXXXXX";
+
+/**
+ * Builds
+ *   int f<nr>(int n) { int s = 0; for (int i = 0; i < n; ++i) s += i * nr; return s; }
+ */
+static void build_graph(int nr)
+{
+	char name[16];
+	snprintf(name, sizeof(name), "f%d", nr);
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 2);
+	set_current_ir_graph(irg);
+
+	ir_node *n = new_Proj(get_irg_args(irg), mode_Is, 0);
+	set_value(0, new_Const_long(mode_Is, 0));
+	set_value(1, new_Const_long(mode_Is, 0));
+	ir_node *entry = new_Jmp();
+	mature_immBlock(get_cur_block());
+
+	ir_node *header = new_immBlock();
+	add_immBlock_pred(header, entry);
+	set_cur_block(header);
+	ir_node *cmp  = new_Cmp(get_value(1, mode_Is), n, ir_relation_less);
+	ir_node *cond = new_Cond(cmp);
+
+	ir_node *body = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+	mature_immBlock(body);
+	set_cur_block(body);
+	ir_node *i   = get_value(1, mode_Is);
+	ir_node *mul = new_Mul(i, new_Const_long(mode_Is, nr + 3), mode_Is);
+	set_value(0, new_Add(get_value(0, mode_Is), mul, mode_Is));
+	set_value(1, new_Add(i, new_Const_long(mode_Is, 1), mode_Is));
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(header);
+
+	ir_node *exit = new_immBlock();
+	add_immBlock_pred(exit, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(exit);
+	set_cur_block(exit);
+	ir_node *result = get_value(0, mode_Is);
+	ir_node *ret    = new_Return(get_store(), 1, &result);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+}
+
+typedef struct run_result_t {
+	unsigned hits;
+	unsigned misses;
+	unsigned stores;
+	char    *text;
+} run_result_t;
+
+static char *read_file(const char *name)
+{
+	FILE *file = fopen(name, "rb");
+	assert(file != NULL);
+	fseek(file, 0, SEEK_END);
+	long const size = ftell(file);
+	rewind(file);
+	char        *text   = malloc(size + 1);
+	size_t const n_read = fread(text, 1, size, file);
+	assert(n_read == (size_t)size);
+	(void)n_read;
+	text[size] = '\0';
+	fclose(file);
+	return text;
+}
+
+static unsigned get_event(const char *events, const char *name)
+{
+	char key[64];
+	snprintf(key, sizeof(key), "E;%s;", name);
+	const char *pos = strstr(events, key);
+	assert(pos != NULL);
+	return (unsigned)strtoul(pos + strlen(key), NULL, 10);
+}
+
+/**
+ * Compiles the functions in a new process, as libFirm can only be initialized
+ * once, and returns the cache statistics and the assembler text.
+ */
+static run_result_t run(const char *option)
+{
+	char asm_name[sizeof(cache_dir) + 8];
+	char ev_prefix[sizeof(cache_dir) + 8];
+	char ev_name[sizeof(ev_prefix) + 8];
+	snprintf(asm_name, sizeof(asm_name), "%s.s", cache_dir);
+	snprintf(ev_prefix, sizeof(ev_prefix), "%s.stat", cache_dir);
+	snprintf(ev_name, sizeof(ev_name), "%s.ev", ev_prefix);
+
+	fflush(NULL);
+	pid_t const pid = fork();
+	assert(pid >= 0);
+	if (pid == 0) {
+		ir_init();
+		char arg[sizeof(cache_dir) + 16];
+		snprintf(arg, sizeof(arg), "codecache=%s", cache_dir);
+		int res = be_parse_arg(arg);
+		if (option != NULL)
+			res &= be_parse_arg(option);
+		assert(res);
+		(void)res;
+		for (int i = 0; i < N_FUNCS; ++i)
+			build_graph(i);
+
+		FILE *out = fopen(asm_name, "w");
+		assert(out != NULL);
+		stat_ev_begin(ev_prefix, "codecache");
+		be_lower_for_target();
+		be_main(out, "codecache");
+		stat_ev_end();
+		fclose(out);
+		ir_finish();
+		_exit(0);
+	}
+	int status;
+	waitpid(pid, &status, 0);
+	assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+	char *events = read_file(ev_name);
+	run_result_t result = {
+		get_event(events, "bemain_codecache_hits"),
+		get_event(events, "bemain_codecache_misses"),
+		get_event(events, "bemain_codecache_stores"),
+		read_file(asm_name),
+	};
+	free(events);
+	remove(ev_name);
+	remove(asm_name);
+	return result;
+}
+
+static unsigned count_entries(void)
+{
+	DIR *dir = opendir(cache_dir);
+	assert(dir != NULL);
+	unsigned n = 0;
+	for (struct dirent *entry; (entry = readdir(dir)) != NULL;) {
+		if (entry->d_name[0] != '.')
+			++n;
+	}
+	closedir(dir);
+	return n;
+}
+
+static void remove_cache(void)
+{
+	DIR *dir = opendir(cache_dir);
+	assert(dir != NULL);
+	for (struct dirent *entry; (entry = readdir(dir)) != NULL;) {
+		if (entry->d_name[0] == '.')
+			continue;
+		char name[sizeof(cache_dir) + 256];
+		snprintf(name, sizeof(name), "%s/%s", cache_dir, entry->d_name);
+		remove(name);
+	}
+	closedir(dir);
+	rmdir(cache_dir);
+}
+
+/**
+ * Compiles the same functions repeatedly with a fresh cache directory: The
+ * first compilation stores every function, the second reuses the entries and
+ * emits the same text, and a changed backend option changes the keys.
+ */
+int main(void)
+{
+	char *const dir = mkdtemp(cache_dir);
+	assert(dir != NULL);
+	(void)dir;
+
+	run_result_t const first = run(NULL);
+	assert(first.hits == 0);
+	assert(first.misses == N_FUNCS);
+	assert(first.stores == N_FUNCS);
+	assert(count_entries() == N_FUNCS);
+
+	run_result_t const second = run(NULL);
+	assert(second.hits == N_FUNCS);
+	assert(second.misses == 0);
+	assert(second.stores == 0);
+	if (strcmp(first.text, second.text) != 0) {
+		fprintf(stderr, "cached code differs:\n%s\n----\n%s", first.text,
+		        second.text);
+		return 1;
+	}
+
+	run_result_t const changed = run("ia32-arch=core2");
+	assert(changed.hits == 0);
+	assert(changed.misses == N_FUNCS);
+	assert(changed.stores == N_FUNCS);
+	assert(count_entries() == 2 * N_FUNCS);
+
+	free(first.text);
+	free(second.text);
+	free(changed.text);
+	remove_cache();
+	return 0;
+}
+
+#else
+
+int main(void)
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include "cpset.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define N 5000
+
+static int  values[N];
+static bool present[N];
+
+/* few distinct hash values, so lots of buckets share a probe sequence */
+static unsigned hash_value(const void *p)
+{
+	return *(const int*)p % 97;
+}
+
+static int value_equal(const void *p1, const void *p2)
+{
+	return *(const int*)p1 == *(const int*)p2;
+}
+
+static void check(const cpset_t *set)
+{
+	size_t count = 0;
+	for (int i = 0; i < N; ++i) {
+		int *found = (int*)cpset_find(set, &values[i]);
+		assert(present[i] ? found == &values[i] : found == NULL);
+		count += present[i];
+	}
+	assert(cpset_size(set) == count);
+
+	cpset_iterator_t iter;
+	int             *p;
+	size_t           iterated = 0;
+	foreach_cpset(set, int*, p, iter) {
+		assert(present[*p]);
+		++iterated;
+	}
+	assert(iterated == count);
+}
+
+int main(void)
+{
+	cpset_t set;
+	cpset_init(&set, hash_value, value_equal);
+	for (int i = 0; i < N; ++i)
+		values[i] = i;
+	srand(42);
+
+	for (int round = 0; round < 40; ++round) {
+		for (int k = 0; k < 2000; ++k) {
+			int i = rand() % N;
+			if (rand() % 3 != 0) {
+				int *res = (int*)cpset_insert(&set, &values[i]);
+				assert(res == &values[i]);
+				present[i] = true;
+			} else {
+				cpset_remove(&set, &values[i]);
+				present[i] = false;
+			}
+		}
+		check(&set);
+
+		/* remove every other element while iterating */
+		cpset_iterator_t iter;
+		int             *p;
+		bool             drop = false;
+		foreach_cpset(&set, int*, p, iter) {
+			if (drop) {
+				cpset_remove_iterator(&set, &iter);
+				present[*p] = false;
+			}
+			drop = !drop;
+		}
+		check(&set);
+	}
+
+	/* shrink back and regrow */
+	for (int i = 0; i < N; ++i) {
+		cpset_remove(&set, &values[i]);
+		present[i] = false;
+	}
+	check(&set);
+	for (int i = 0; i < N; i += 2) {
+		cpset_insert(&set, &values[i]);
+		present[i] = true;
+	}
+	check(&set);
+
+	cpset_destroy(&set);
+	return 0;
+}
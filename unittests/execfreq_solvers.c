@@ -0,0 +1,164 @@
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "firm.h"
+#include "execfreq_t.h"
+
+enum { N_GRAPHS = 100, MAX_BLOCKS = 120 };
+
+/**
+ * Builds a CFG in which each block branches to the next block and to a
+ * random block at most @p window blocks before or after it. Small windows
+ * give deep nests of overlapping loops, large ones jump into the middle of
+ * loops and make them irreducible.
+ */
+static ir_graph *build_graph(int nr, int n_blocks, int window)
+{
+	char name[16];
+	snprintf(name, sizeof(name), "f%d", nr);
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	ir_node *arg = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node *blocks[MAX_BLOCKS];
+	for (int i = 0; i < n_blocks; ++i)
+		blocks[i] = new_immBlock();
+	add_immBlock_pred(blocks[0], new_Jmp());
+
+	for (int i = 0; i < n_blocks - 1; ++i) {
+		set_cur_block(blocks[i]);
+		ir_node *cmp  = new_Cmp(arg, new_Const_long(mode_Is, i),
+		                        ir_relation_less);
+		ir_node *cond = new_Cond(cmp);
+		int target = i + rand() % (2 * window + 1) - window;
+		if (target < 0)
+			target = 0;
+		else if (target >= n_blocks)
+			target = n_blocks - 1;
+		add_immBlock_pred(blocks[i + 1], new_Proj(cond, mode_X, pn_Cond_true));
+		add_immBlock_pred(blocks[target], new_Proj(cond, mode_X, pn_Cond_false));
+	}
+	for (int i = 0; i < n_blocks; ++i)
+		mature_immBlock(blocks[i]);
+
+	set_cur_block(blocks[n_blocks - 1]);
+	ir_node *ret = new_Return(get_store(), 1, &arg);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+/** Returns the probability of control flow predecessor @p pos of @p block. */
+static double get_probability(ir_node const *block, int pos)
+{
+	ir_node *pred = get_Block_cfgpred(block, pos);
+	if (!is_Proj(pred) || !is_Cond(get_Proj_pred(pred)))
+		return 1.0;
+	/* a fixed pseudo-random probability between 0.1 and 0.9 for each Cond */
+	long   const nr    = get_irn_node_nr(get_Proj_pred(pred));
+	double const taken = 0.1 + 0.8 * ((nr * 7919) % 101) / 100.0;
+	return get_Proj_num(pred) == pn_Cond_true ? taken : 1.0 - taken;
+}
+
+static void set_probabilities(ir_node *block, void *env)
+{
+	(void)env;
+	for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i)
+		set_block_cf_probability(block, i, get_probability(block, i));
+}
+
+static double *dense_freqs;
+static int     n_freqs;
+static double  max_error;
+
+/** Records how far the frequency of @p block violates its equation. */
+static void check_block(ir_node *block, void *env)
+{
+	(void)env;
+	ir_graph *irg = get_irn_irg(block);
+	if (block == get_irg_start_block(irg) || block == get_irg_end_block(irg))
+		return;
+	double sum = 0.0;
+	for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+		ir_node *pred = get_Block_cfgpred_block(block, i);
+		sum += get_block_execfreq(pred) * get_probability(block, i);
+	}
+	double const freq  = get_block_execfreq(block);
+	double const error = fabs(sum - freq) / fmax(freq, 1.0);
+	if (error > max_error)
+		max_error = error;
+}
+
+static void collect_freq(ir_node *block, void *env)
+{
+	(void)env;
+	dense_freqs[n_freqs++] = get_block_execfreq(block);
+}
+
+static void compare_freq(ir_node *block, void *env)
+{
+	(void)env;
+	double const dense  = dense_freqs[n_freqs++];
+	double const sparse = get_block_execfreq(block);
+	if (fabs(dense - sparse) > 1e-9 * fmax(dense, 1.0)) {
+		ir_fprintf(stderr, "%s: %+F has frequency %g instead of %g\n",
+		           get_entity_name(get_irg_entity(get_irn_irg(block))),
+		           block, sparse, dense);
+		abort();
+	}
+}
+
+static double get_max_error(ir_graph *irg)
+{
+	max_error = 0.0;
+	irg_block_walk_graph(irg, check_block, NULL, NULL);
+	return max_error;
+}
+
+/**
+ * Compares the sparse solver with the dense QR solver. The QR decomposition
+ * does not always find the solution, so the sparse solution is checked against
+ * the equations and compared wherever the dense one satisfies them as well.
+ */
+int main(void)
+{
+	ir_init();
+	srand(1);
+	dense_freqs = malloc((MAX_BLOCKS + 2) * sizeof(*dense_freqs));
+	int n_compared = 0;
+	for (int i = 0; i < N_GRAPHS; ++i) {
+		int const n_blocks = 6 + i % 10 * 12;
+		int const window   = i / 10 % 2 == 0 ? 4 : n_blocks;
+		ir_graph *irg      = build_graph(i, n_blocks, window);
+		irg_block_walk_graph(irg, set_probabilities, NULL, NULL);
+
+		ir_set_execfreq_solver(EXECFREQ_SOLVER_DENSE);
+		ir_estimate_execfreq(irg);
+		bool const dense_exact = get_max_error(irg) < 1e-9;
+		n_freqs = 0;
+		irg_block_walk_graph(irg, collect_freq, NULL, NULL);
+
+		ir_set_execfreq_solver(EXECFREQ_SOLVER_SPARSE);
+		ir_estimate_execfreq(irg);
+		assert(get_max_error(irg) < 1e-9);
+		if (dense_exact) {
+			++n_compared;
+			n_freqs = 0;
+			irg_block_walk_graph(irg, compare_freq, NULL, NULL);
+		}
+	}
+	assert(n_compared > 0);
+	(void)n_compared;
+	ir_set_execfreq_solver(EXECFREQ_SOLVER_AUTO);
+	free(dense_freqs);
+	ir_finish();
+	return 0;
+}
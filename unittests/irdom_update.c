@@ -0,0 +1,189 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "firm.h"
+#include "array.h"
+#include "irdom_t.h"
+#include "irgmod.h"
+#include "util.h"
+
+enum { N_BLOCKS = 200, N_STEPS = 4000 };
+
+static ir_graph *irg;
+static ir_node **blocks;   /**< all blocks besides the End block */
+static ir_node **jumps;    /**< the jump leaving each block */
+
+static ir_node *get_jump(ir_node *block)
+{
+	for (size_t i = 0, n = ARR_LEN(blocks); i < n; ++i) {
+		if (blocks[i] == block)
+			return jumps[i];
+	}
+	return NULL;
+}
+
+static void add_pred(ir_node *block, ir_node *pred)
+{
+	int const arity = get_Block_n_cfgpreds(block);
+	ir_node **in    = ALLOCAN(ir_node*, arity + 1);
+	MEMCPY(in, get_Block_cfgpred_arr(block), arity);
+	in[arity] = pred;
+	set_irn_in(block, arity + 1, in);
+}
+
+static void add_block(ir_node *block)
+{
+	ARR_APP1(ir_node*, blocks, block);
+	ARR_APP1(ir_node*, jumps, new_r_Jmp(block));
+	/* keep all blocks alive, so they are known to compute_doms() */
+	add_End_keepalive(get_irg_end(irg), block);
+}
+
+/** Builds a graph of blocks each ending with a Jmp used by random edges. */
+static void build_graph(void)
+{
+	ir_type *mtp = new_type_method(0, 0);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str("f"), mtp);
+	irg = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+	blocks = NEW_ARR_F(ir_node*, 0);
+	jumps  = NEW_ARR_F(ir_node*, 0);
+
+	ARR_APP1(ir_node*, blocks, get_irg_start_block(irg));
+	ARR_APP1(ir_node*, jumps, new_r_Jmp(get_irg_start_block(irg)));
+	for (int i = 1; i < N_BLOCKS; ++i) {
+		ir_node *block = new_r_Block(irg, 0, NULL);
+		add_block(block);
+		/* a random spanning tree makes most blocks reachable at first */
+		add_pred(block, jumps[rand() % i]);
+	}
+	ir_node *ret = new_r_Return(blocks[N_BLOCKS - 1], get_irg_initial_mem(irg),
+	                            0, NULL);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+	set_optimize(0);
+}
+
+static bool reference_dominates(ir_node *a, ir_node *b)
+{
+	for (; b != NULL; b = get_Block_idom(b)) {
+		if (a == b)
+			return true;
+		if (get_Block_dom_depth(b) == 1)
+			return false;
+	}
+	return false;
+}
+
+/** Compares the incrementally updated information with a recomputation. */
+static void check_doms(void)
+{
+	ir_node *end_block = get_irg_end_block(irg);
+	size_t const n = ARR_LEN(blocks) + 1;
+	ir_node **all   = XMALLOCN(ir_node*, n);
+	ir_node **idoms = XMALLOCN(ir_node*, n);
+	int      *depth = XMALLOCN(int, n);
+	MEMCPY(all, blocks, n - 1);
+	all[n - 1] = end_block;
+	for (size_t i = 0; i < n; ++i) {
+		depth[i] = get_Block_dom_depth(all[i]);
+		idoms[i] = depth[i] > 0 ? get_Block_idom(all[i]) : NULL;
+	}
+	/* exercise the lazy renumbering of the tree pre orders */
+	for (int i = 0; i < 20; ++i) {
+		ir_node *a = all[rand() % n];
+		ir_node *b = all[rand() % n];
+		if (get_Block_dom_depth(a) > 0 && get_Block_dom_depth(b) > 0)
+			assert(block_dominates(a, b) == reference_dominates(a, b));
+	}
+
+	/* the graph was changed behind the back of the out data structure */
+	clear_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUTS);
+	compute_doms(irg);
+	for (size_t i = 0; i < n; ++i) {
+		int const ref_depth = get_Block_dom_depth(all[i]);
+		assert(depth[i] == ref_depth || (depth[i] < 0 && ref_depth < 0));
+		if (ref_depth > 0)
+			assert(idoms[i] == get_Block_idom(all[i]));
+	}
+	free(depth);
+	free(idoms);
+	free(all);
+}
+
+static void insert_edge(void)
+{
+	size_t const n_blocks = ARR_LEN(blocks);
+	size_t const from     = rand() % n_blocks;
+	ir_node     *to       = rand() % 50 == 0 ? get_irg_end_block(irg)
+	                                         : blocks[1 + rand() % (n_blocks - 1)];
+	add_pred(to, jumps[from]);
+	dom_insert_edge(blocks[from], to);
+}
+
+static void delete_edge(void)
+{
+	ir_node *to    = blocks[1 + rand() % (ARR_LEN(blocks) - 1)];
+	int      arity = get_Block_n_cfgpreds(to);
+	if (arity == 0)
+		return;
+	int      pos  = rand() % arity;
+	ir_node *pred = get_Block_cfgpred(to, pos);
+	if (is_Bad(pred))
+		return;
+	set_Block_cfgpred(to, pos, new_r_Bad(irg, mode_X));
+	dom_delete_edge(get_nodes_block(pred), to);
+}
+
+static void split_block(void)
+{
+	ir_node *lower = blocks[rand() % ARR_LEN(blocks)];
+	ir_node *jump  = get_jump(lower);
+	ir_node *node  = new_r_Dummy(irg, mode_Is);
+	set_nodes_block(node, lower);
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_PHI_LIST);
+	collect_phiprojs_and_start_block_nodes(irg);
+	part_block(node);
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK | IR_RESOURCE_PHI_LIST);
+	ir_node *upper = get_nodes_block(node);
+	assert(get_nodes_block(jump) == lower && upper != lower);
+	ARR_APP1(ir_node*, blocks, upper);
+	ARR_APP1(ir_node*, jumps, get_Block_cfgpred(lower, 0));
+	add_End_keepalive(get_irg_end(irg), upper);
+}
+
+int main(void)
+{
+	ir_init();
+	srand(42);
+	build_graph();
+	assure_irg_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_OUT_EDGES
+	                         | IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE);
+
+	for (int step = 0; step < N_STEPS; ++step) {
+		int const action = rand() % 100;
+		if (action < 45)
+			insert_edge();
+		else if (action < 98)
+			delete_edge();
+		else
+			split_block();
+		assert(irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE));
+		if (step % 10 == 0)
+			check_doms();
+	}
+	check_doms();
+
+	/* blocks created behind the back of the update invalidate the
+	 * information */
+	ir_node *block = new_r_Block(irg, 0, NULL);
+	add_pred(block, jumps[0]);
+	dom_insert_edge(blocks[0], block);
+	assert(!irg_has_properties(irg, IR_GRAPH_PROPERTY_CONSISTENT_DOMINANCE));
+
+	DEL_ARR_F(jumps);
+	DEL_ARR_F(blocks);
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,231 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "firm.h"
+#include "array.h"
+
+/** The nodes visited by a walker in the order of the callbacks. */
+typedef struct trace_t {
+	ir_node **nodes;
+} trace_t;
+
+static void record_pre(ir_node *node, void *env)
+{
+	trace_t *trace = (trace_t*)env;
+	ARR_APP1(ir_node*, trace->nodes, node);
+}
+
+static void record_post(ir_node *node, void *env)
+{
+	trace_t *trace = (trace_t*)env;
+	/* distinguish post from pre callbacks of the same node */
+	ARR_APP1(ir_node*, trace->nodes, NULL);
+	ARR_APP1(ir_node*, trace->nodes, node);
+}
+
+/** The recursive walk the walkers must be equivalent to. */
+static void reference_walk(ir_node *node, irg_walk_func *pre,
+                           irg_walk_func *post, void *env)
+{
+	mark_irn_visited(node);
+	if (pre != NULL)
+		pre(node, env);
+	if (!is_Block(node)) {
+		ir_node *block = get_nodes_block(node);
+		if (!irn_visited(block))
+			reference_walk(block, pre, post, env);
+	}
+	for (int i = get_irn_arity(node); i-- > 0; ) {
+		ir_node *pred = get_irn_n(node, i);
+		if (!irn_visited(pred))
+			reference_walk(pred, pre, post, env);
+	}
+	if (post != NULL)
+		post(node, env);
+}
+
+static ir_node *get_cf_op(ir_node *n)
+{
+	while (!is_cfop(n) && !is_fragile_op(n) && !is_Bad(n))
+		n = skip_Proj(skip_Tuple(n));
+	return n;
+}
+
+static void reference_block_walk(ir_node *block, irg_walk_func *pre,
+                                 irg_walk_func *post, void *env)
+{
+	if (Block_block_visited(block))
+		return;
+	mark_Block_block_visited(block);
+	if (pre != NULL)
+		pre(block, env);
+	for (int i = get_Block_n_cfgpreds(block); i-- > 0; ) {
+		ir_node *cfop = get_cf_op(get_Block_cfgpred(block, i));
+		if (!is_Bad(cfop))
+			reference_block_walk(get_nodes_block(cfop), pre, post, env);
+	}
+	if (post != NULL)
+		post(block, env);
+}
+
+static void check_same(trace_t *a, trace_t *b)
+{
+	assert(ARR_LEN(a->nodes) == ARR_LEN(b->nodes));
+	for (size_t i = 0, n = ARR_LEN(a->nodes); i < n; ++i)
+		assert(a->nodes[i] == b->nodes[i]);
+	DEL_ARR_F(a->nodes);
+	DEL_ARR_F(b->nodes);
+}
+
+static void check_walks(ir_graph *irg)
+{
+	static irg_walk_func *const pres[]  = { record_pre, NULL, record_pre };
+	static irg_walk_func *const posts[] = { NULL, record_post, record_post };
+	for (size_t i = 0; i < 3; ++i) {
+		trace_t walked    = { NEW_ARR_F(ir_node*, 0) };
+		trace_t reference = { NEW_ARR_F(ir_node*, 0) };
+		irg_walk_graph(irg, pres[i], posts[i], &walked);
+		ir_reserve_resources(irg, IR_RESOURCE_IRN_VISITED);
+		inc_irg_visited(irg);
+		reference_walk(get_irg_end(irg), pres[i], posts[i], &reference);
+		ir_free_resources(irg, IR_RESOURCE_IRN_VISITED);
+		check_same(&walked, &reference);
+
+		walked.nodes    = NEW_ARR_F(ir_node*, 0);
+		reference.nodes = NEW_ARR_F(ir_node*, 0);
+		irg_block_walk_graph(irg, pres[i], posts[i], &walked);
+		ir_reserve_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+		inc_irg_block_visited(irg);
+		reference_block_walk(get_irg_end_block(irg), pres[i], posts[i],
+		                     &reference);
+		ir_node *end = get_irg_end(irg);
+		for (int k = 0, n = get_irn_arity(end); k < n; ++k) {
+			ir_node *kept = get_irn_n(end, k);
+			if (is_Block(kept))
+				reference_block_walk(kept, pres[i], posts[i], &reference);
+		}
+		ir_free_resources(irg, IR_RESOURCE_BLOCK_VISITED);
+		check_same(&walked, &reference);
+	}
+}
+
+static ir_graph *new_graph(const char *name)
+{
+	ir_type *type_int = new_type_primitive(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, type_int);
+	set_method_res_type(mtp, 0, type_int);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 2);
+	set_current_ir_graph(irg);
+	return irg;
+}
+
+static void finish_graph(ir_graph *irg, ir_node *res)
+{
+	ir_node *ret = new_Return(get_store(), 1, &res);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+}
+
+/** Builds nested loops with a diamond in the inner loop body. */
+static ir_graph *build_loops(void)
+{
+	ir_graph *irg = new_graph("loops");
+	ir_node  *n   = new_Proj(get_irg_args(irg), mode_Is, 0);
+	set_value(0, new_Const_long(mode_Is, 0));
+	set_value(1, new_Const_long(mode_Is, 0));
+	ir_node *outer = new_immBlock();
+	add_immBlock_pred(outer, new_Jmp());
+	set_cur_block(outer);
+	ir_node *outer_cond = new_Cond(new_Cmp(get_value(1, mode_Is), n,
+	                                       ir_relation_less));
+	ir_node *inner = new_immBlock();
+	add_immBlock_pred(inner, new_Proj(outer_cond, mode_X, pn_Cond_true));
+	set_cur_block(inner);
+	ir_node *inner_cond = new_Cond(new_Cmp(get_value(0, mode_Is), n,
+	                                       ir_relation_greater));
+	ir_node *then_block = new_immBlock();
+	add_immBlock_pred(then_block, new_Proj(inner_cond, mode_X, pn_Cond_true));
+	mature_immBlock(then_block);
+	set_cur_block(then_block);
+	set_value(0, new_Sub(get_value(0, mode_Is), n, mode_Is));
+	ir_node *then_jmp = new_Jmp();
+	ir_node *else_block = new_immBlock();
+	add_immBlock_pred(else_block, new_Proj(inner_cond, mode_X, pn_Cond_false));
+	mature_immBlock(else_block);
+	set_cur_block(else_block);
+	set_value(0, new_Add(get_value(0, mode_Is), get_value(1, mode_Is),
+	                     mode_Is));
+	ir_node *else_jmp = new_Jmp();
+	ir_node *join = new_immBlock();
+	add_immBlock_pred(join, then_jmp);
+	add_immBlock_pred(join, else_jmp);
+	mature_immBlock(join);
+	set_cur_block(join);
+	ir_node *join_cond = new_Cond(new_Cmp(get_value(0, mode_Is),
+	                                      new_Const_long(mode_Is, 100),
+	                                      ir_relation_less));
+	add_immBlock_pred(inner, new_Proj(join_cond, mode_X, pn_Cond_true));
+	mature_immBlock(inner);
+	ir_node *latch = new_immBlock();
+	add_immBlock_pred(latch, new_Proj(join_cond, mode_X, pn_Cond_false));
+	mature_immBlock(latch);
+	set_cur_block(latch);
+	set_value(1, new_Add(get_value(1, mode_Is), new_Const_long(mode_Is, 1),
+	                     mode_Is));
+	add_immBlock_pred(outer, new_Jmp());
+	mature_immBlock(outer);
+	ir_node *exit_block = new_immBlock();
+	add_immBlock_pred(exit_block, new_Proj(outer_cond, mode_X, pn_Cond_false));
+	mature_immBlock(exit_block);
+	set_cur_block(exit_block);
+	finish_graph(irg, get_value(0, mode_Is));
+	return irg;
+}
+
+/** Builds a chain of @p length dependent additions. */
+static ir_graph *build_chain(const char *name, size_t length)
+{
+	ir_graph *irg = new_graph(name);
+	ir_node  *arg = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node  *res = arg;
+	for (size_t i = 0; i < length; ++i)
+		res = new_Add(res, i % 2 ? arg : new_Const_long(mode_Is, i), mode_Is);
+	finish_graph(irg, res);
+	return irg;
+}
+
+static void count_node(ir_node *node, void *env)
+{
+	(void)node;
+	++*(size_t*)env;
+}
+
+int main(void)
+{
+	ir_init();
+	set_optimize(0);
+
+	check_walks(build_loops());
+	check_walks(build_chain("chain", 100));
+
+	/* walking a chain much deeper than the native stack allows for a
+	 * recursion must not overflow */
+	size_t const length = 2000000;
+	ir_graph *deep = build_chain("deep", length);
+	size_t n_pre  = 0;
+	size_t n_post = 0;
+	irg_walk_graph(deep, count_node, count_node, &n_pre);
+	irg_walk_graph(deep, NULL, count_node, &n_post);
+	assert(n_pre == 2 * n_post && n_post > length);
+
+	/* a freshly built graph has no unreachable nodes besides anchors */
+	size_t n_unordered = 0;
+	irg_walk_graph_unordered(deep, count_node, &n_unordered);
+	assert(n_unordered >= n_post && n_unordered <= get_irg_last_idx(deep));
+
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,251 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "firm.h"
+#include "util.h"
+#include "xmalloc.h"
+
+static const char *bin_name = "irio_test.bin";
+static const char *txt_name = "irio_test.txt";
+
+static ir_type *new_int_type(void)
+{
+	return new_type_primitive(mode_Is);
+}
+
+/** Builds int loop(int n) { int s = 0; for (i = 0; i < n; ++i) s += i;
+ * switch (s) { case 1: return 10; case 3 ... 5: return -7; } return s; } */
+static ir_entity *build_loop(void)
+{
+	ir_type *type_int = new_int_type();
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, type_int);
+	set_method_res_type(mtp, 0, type_int);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str("loop"), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 2);
+	set_current_ir_graph(irg);
+
+	ir_node *n = new_Proj(get_irg_args(irg), mode_Is, 0);
+	set_value(0, new_Const_long(mode_Is, 0));
+	set_value(1, new_Const_long(mode_Is, 0));
+	ir_node *head = new_immBlock();
+	add_immBlock_pred(head, new_Jmp());
+	set_cur_block(head);
+	ir_node *cmp  = new_Cmp(get_value(1, mode_Is), n, ir_relation_less);
+	ir_node *cond = new_Cond(cmp);
+	ir_node *body = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+	mature_immBlock(body);
+	ir_node *exit_block = new_immBlock();
+	add_immBlock_pred(exit_block, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(exit_block);
+	set_cur_block(body);
+	set_value(0, new_Add(get_value(0, mode_Is), get_value(1, mode_Is), mode_Is));
+	set_value(1, new_Add(get_value(1, mode_Is), new_Const_long(mode_Is, 1),
+	                     mode_Is));
+	add_immBlock_pred(head, new_Jmp());
+	mature_immBlock(head);
+
+	set_cur_block(exit_block);
+	ir_node         *sum   = get_value(0, mode_Is);
+	ir_switch_table *table = ir_new_switch_table(irg, 2);
+	ir_switch_table_set(table, 0, new_tarval_from_long(1, mode_Is),
+	                    new_tarval_from_long(1, mode_Is), 1);
+	ir_switch_table_set(table, 1, new_tarval_from_long(3, mode_Is),
+	                    new_tarval_from_long(5, mode_Is), 2);
+	ir_node *switchn = new_Switch(sum, 3, table);
+	long     results[] = { 0, 10, -7 };
+	for (unsigned pn = 0; pn < ARRAY_SIZE(results); ++pn) {
+		ir_node *block = new_immBlock();
+		add_immBlock_pred(block, new_Proj(switchn, mode_X, pn));
+		mature_immBlock(block);
+		set_cur_block(block);
+		ir_node *res = pn == 0 ? sum : new_Const_long(mode_Is, results[pn]);
+		ir_node *ret = new_Return(get_store(), 1, &res);
+		add_immBlock_pred(get_irg_end_block(irg), ret);
+	}
+	irg_finalize_cons(irg);
+	return entity;
+}
+
+/** Builds int caller(void) { return loop(table[0]); } */
+static void build_caller(ir_entity *callee, ir_entity *global)
+{
+	ir_type *type_int = get_method_res_type(get_entity_type(callee), 0);
+	ir_type *mtp      = new_type_method(0, 1);
+	set_method_res_type(mtp, 0, type_int);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str("caller"),
+	                               mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	ir_node *ptr    = new_Address(global);
+	ir_node *load   = new_Load(get_store(), ptr, mode_Is, type_int, cons_none);
+	set_store(new_Proj(load, mode_M, pn_Load_M));
+	ir_node *arg    = new_Proj(load, mode_Is, pn_Load_res);
+	ir_node *call   = new_Call(get_store(), new_Address(callee), 1, &arg,
+	                           get_entity_type(callee));
+	set_store(new_Proj(call, mode_M, pn_Call_M));
+	ir_node *results = new_Proj(call, mode_T, pn_Call_T_result);
+	ir_node *res     = new_Proj(results, mode_Is, 0);
+	ir_node *ret     = new_Return(get_store(), 1, &res);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+}
+
+static void build_program(void)
+{
+	ir_type *type_int = new_int_type();
+	ir_type *array    = new_type_array(type_int);
+	set_array_size_int(array, 3);
+	set_type_size_bytes(array, 12);
+	set_type_state(array, layout_fixed);
+	ir_entity *global = new_entity(get_glob_type(), new_id_from_str("table"),
+	                               array);
+	ir_initializer_t *init = create_initializer_compound(3);
+	ir_graph *const_irg = get_const_code_irg();
+	set_initializer_compound_value(init, 0, create_initializer_const(
+		new_r_Const_long(const_irg, mode_Is, -123456789)));
+	set_initializer_compound_value(init, 1, create_initializer_tarval(
+		new_tarval_from_long(6, mode_Is)));
+	set_initializer_compound_value(init, 2, get_initializer_null());
+	set_entity_initializer(global, init);
+
+	ir_entity *loop = build_loop();
+	build_caller(loop, global);
+}
+
+static void append_signature(ir_node *node, void *env)
+{
+	char  *signature = (char*)env;
+	size_t len       = strlen(signature);
+	int    n         = snprintf(signature + len, 4096 - len, "%s %s %d",
+	                            get_irn_opname(node),
+	                            get_mode_name(get_irn_mode(node)),
+	                            get_irn_arity(node));
+	assert(n > 0 && (size_t)n < 4096 - len);
+	len += n;
+	if (is_Const(node)) {
+		n = snprintf(signature + len, 4096 - len, " %ld",
+		             get_tarval_long(get_Const_tarval(node)));
+		assert(n > 0 && (size_t)n < 4096 - len);
+		len += n;
+	}
+	signature[len++] = ';';
+	signature[len]   = '\0';
+}
+
+/** Returns a string describing the nodes of @p irg in walk order. */
+static char *get_signature(ir_graph *irg)
+{
+	char *signature = XMALLOCNZ(char, 4096);
+	irg_walk_graph(irg, NULL, append_signature, signature);
+	return signature;
+}
+
+/** Returns the last entity named @p name, i.e. the one imported last. */
+static ir_entity *find_entity(const char *name)
+{
+	ir_type   *glob = get_glob_type();
+	ir_entity *res  = NULL;
+	for (size_t i = 0, n = get_compound_n_members(glob); i < n; ++i) {
+		ir_entity *member = get_compound_member(glob, i);
+		if (strcmp(get_entity_name(member), name) == 0)
+			res = member;
+	}
+	return res;
+}
+
+static void check_graphs(size_t first, char **signatures)
+{
+	assert(get_irp_n_irgs() == first + 2);
+	for (size_t i = 0; i < 2; ++i) {
+		ir_graph *irg = get_irp_irg(first + i);
+		assert(irg_verify(irg));
+		char *signature = get_signature(irg);
+		assert(strcmp(signature, signatures[i]) == 0);
+		free(signature);
+	}
+}
+
+static void check_table(void)
+{
+	ir_entity        *table = find_entity("table");
+	ir_initializer_t *init  = get_entity_initializer(table);
+	assert(get_initializer_kind(init) == IR_INITIALIZER_COMPOUND);
+	assert(get_initializer_compound_n_entries(init) == 3);
+	ir_initializer_t *value0 = get_initializer_compound_value(init, 0);
+	ir_initializer_t *value1 = get_initializer_compound_value(init, 1);
+	ir_initializer_t *value2 = get_initializer_compound_value(init, 2);
+	assert(get_initializer_kind(value0) == IR_INITIALIZER_CONST);
+	assert(get_tarval_long(get_Const_tarval(get_initializer_const_value(value0))) == -123456789);
+	assert(get_initializer_kind(value1) == IR_INITIALIZER_TARVAL);
+	assert(get_tarval_long(get_initializer_tarval_value(value1)) == 6);
+	assert(get_initializer_kind(value2) == IR_INITIALIZER_NULL);
+}
+
+static long get_file_size(const char *name)
+{
+	FILE *file = fopen(name, "rb");
+	assert(file != NULL);
+	fseek(file, 0, SEEK_END);
+	long size = ftell(file);
+	fclose(file);
+	return size;
+}
+
+int main(void)
+{
+	ir_init();
+	build_program();
+	char *signatures[2];
+	for (size_t i = 0; i < 2; ++i)
+		signatures[i] = get_signature(get_irp_irg(i));
+
+	int res = ir_export(txt_name);
+	assert(res == 0);
+	res = ir_export_binary(bin_name);
+	assert(res == 0);
+	assert(3 * get_file_size(bin_name) < 2 * get_file_size(txt_name));
+
+	/* both formats reproduce the graphs */
+	res = ir_import(txt_name);
+	assert(res == 0);
+	check_graphs(2, signatures);
+	res = ir_import_binary(bin_name);
+	assert(res == 0);
+	check_graphs(4, signatures);
+	check_table();
+
+	/* lazy import reads only the requested graphs */
+	ir_binary_import_t *import = ir_import_binary_lazy(bin_name);
+	assert(import != NULL);
+	assert(get_irp_n_irgs() == 6);
+	check_table();
+	ir_entity *loop   = find_entity("loop");
+	ir_entity *caller = find_entity("caller");
+	assert(get_entity_irg(loop) == NULL && get_entity_irg(caller) == NULL);
+	ir_graph *caller_irg = ir_binary_import_get_irg(import, caller);
+	assert(caller_irg != NULL && get_entity_irg(caller) == caller_irg);
+	assert(get_irp_n_irgs() == 7 && get_entity_irg(loop) == NULL);
+	assert(ir_binary_import_get_irg(import, caller) == caller_irg);
+	ir_graph *loop_irg = ir_binary_import_get_irg(import, loop);
+	assert(loop_irg != NULL && get_entity_irg(loop) == loop_irg);
+	char *loop_signature   = get_signature(loop_irg);
+	char *caller_signature = get_signature(caller_irg);
+	assert(strcmp(loop_signature, signatures[0]) == 0);
+	assert(strcmp(caller_signature, signatures[1]) == 0);
+	assert(irg_verify(loop_irg) && irg_verify(caller_irg));
+	free(caller_signature);
+	free(loop_signature);
+	ir_binary_import_free(import);
+
+	remove(bin_name);
+	remove(txt_name);
+	for (size_t i = 0; i < 2; ++i)
+		free(signatures[i]);
+	ir_finish();
+	return 0;
+}
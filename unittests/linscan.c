@@ -0,0 +1,157 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "firm.h"
+
+enum { N_GRAPHS = 6, N_BLOCKS = 50, N_VARS = 14 };
+
+static ir_entity *callee;
+
+static ir_node *new_int(long value)
+{
+	return new_Const_long(mode_Is, value);
+}
+
+/** Sets @p var to @p value and the store to memory Proj @p pn of @p mem_op. */
+static void set_result(int var, ir_node *mem_op, unsigned pn, ir_node *value)
+{
+	set_store(new_Proj(mem_op, mode_M, pn));
+	set_value(var, value);
+}
+
+/**
+ * Adds a random statement. Divisions and variable shifts have register
+ * constraints, calls clobber the caller saved registers.
+ */
+static void new_random_statement(void)
+{
+	int const v     = rand() % N_VARS;
+	ir_node  *left  = get_value(v, mode_Is);
+	ir_node  *right = get_value(rand() % N_VARS, mode_Is);
+	switch (rand() % 8) {
+	case 0:
+		set_value(v, new_Add(left, right, mode_Is));
+		break;
+	case 1:
+		set_value(v, new_Sub(left, right, mode_Is));
+		break;
+	case 2:
+		set_value(v, new_Mul(left, right, mode_Is));
+		break;
+	case 3: {
+		ir_node *count = new_Conv(right, mode_Iu);
+		set_value(v, new_Shl(left, count, mode_Is));
+		break;
+	}
+	case 4: {
+		ir_node *divisor = new_Or(right, new_int(1), mode_Is);
+		ir_node *div     = new_Div(get_store(), left, divisor, mode_Is,
+		                           op_pin_state_pinned);
+		set_result(v, div, pn_Div_M, new_Proj(div, mode_Is, pn_Div_res));
+		break;
+	}
+	case 5: {
+		ir_node *in[]  = { left, right };
+		ir_node *addr  = new_Address(callee);
+		ir_node *call  = new_Call(get_store(), addr, 2, in,
+		                          get_entity_type(callee));
+		ir_node *res   = new_Proj(call, mode_T, pn_Call_T_result);
+		set_result(v, call, pn_Call_M, new_Proj(res, mode_Is, 0));
+		break;
+	}
+	default:
+		set_value(v, new_Eor(left, new_int(rand() % 100), mode_Is));
+		break;
+	}
+}
+
+/**
+ * Builds a CFG in which each block branches to the next block and to a
+ * random other block. More variables live across the loops than there are
+ * registers, so the allocator has to spill and reload.
+ */
+static void build_graph(int nr)
+{
+	char name[16];
+	snprintf(name, sizeof(name), "f%d", nr);
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(2, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_param_type(mtp, 1, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, N_VARS);
+	set_current_ir_graph(irg);
+
+	ir_node *args = get_irg_args(irg);
+	for (int v = 0; v < N_VARS; ++v) {
+		ir_node *arg = new_Proj(args, mode_Is, v % 2);
+		set_value(v, new_Add(arg, new_int(v), mode_Is));
+	}
+
+	ir_node *blocks[N_BLOCKS];
+	for (int i = 0; i < N_BLOCKS; ++i)
+		blocks[i] = new_immBlock();
+	add_immBlock_pred(blocks[0], new_Jmp());
+
+	for (int i = 0; i < N_BLOCKS; ++i) {
+		set_cur_block(blocks[i]);
+		for (int s = rand() % 5; s-- > 0;)
+			new_random_statement();
+		if (i == N_BLOCKS - 1)
+			break;
+
+		ir_node *cmp  = new_Cmp(get_value(rand() % N_VARS, mode_Is),
+		                        new_int(rand() % 1000), ir_relation_less);
+		ir_node *cond = new_Cond(cmp);
+		add_immBlock_pred(blocks[i + 1], new_Proj(cond, mode_X, pn_Cond_true));
+		add_immBlock_pred(blocks[rand() % N_BLOCKS],
+		                  new_Proj(cond, mode_X, pn_Cond_false));
+	}
+	for (int i = 0; i < N_BLOCKS; ++i)
+		mature_immBlock(blocks[i]);
+
+	ir_node *result = get_value(0, mode_Is);
+	for (int v = 1; v < N_VARS; ++v)
+		result = new_Add(result, get_value(v, mode_Is), mode_Is);
+	ir_node *ret = new_Return(get_store(), 1, &result);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+}
+
+/**
+ * Compiles graphs with high register pressure, register constraints and
+ * calls with the linear scan allocator. The backend verifier checks the
+ * schedule, the register pressure after spilling and the final register
+ * assignment, and aborts if one of them is wrong.
+ */
+int main(void)
+{
+	ir_init();
+	int res = be_parse_arg("regalloc=linscan");
+	assert(res);
+	res = be_parse_arg("verify=1");
+	assert(res);
+	(void)res;
+
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(2, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_param_type(mtp, 1, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	callee = new_entity(get_glob_type(), new_id_from_str("g"), mtp);
+
+	srand(1);
+	for (int i = 0; i < N_GRAPHS; ++i)
+		build_graph(i);
+
+	FILE *null = fopen("/dev/null", "w");
+	assert(null != NULL);
+	be_lower_for_target();
+	be_main(null, "linscan");
+	fclose(null);
+
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,281 @@
+#include <assert.h>
+#include <stdbool.h>
+
+#include "firm.h"
+#include "execfreq_t.h"
+#include "irouts_t.h"
+#include "panic.h"
+#include "util.h"
+
+typedef struct test_case_t {
+	long     min;
+	long     max;
+	unsigned pn;
+} test_case_t;
+
+static ir_tarval *argument;
+static unsigned   n_branches;
+static unsigned   hot_branches;
+
+static ir_tarval *evaluate(ir_node *node)
+{
+	switch (get_irn_opcode(node)) {
+	case iro_Const:
+		return get_Const_tarval(node);
+	case iro_Proj:
+		/* the only data Proj is the argument */
+		return tarval_convert_to(argument, get_irn_mode(node));
+	case iro_Conv:
+		return tarval_convert_to(evaluate(get_Conv_op(node)),
+		                         get_irn_mode(node));
+	case iro_Add:
+		return tarval_add(evaluate(get_Add_left(node)),
+		                  evaluate(get_Add_right(node)));
+	case iro_Sub:
+		return tarval_sub(evaluate(get_Sub_left(node)),
+		                  evaluate(get_Sub_right(node)), get_irn_mode(node));
+	case iro_And:
+		return tarval_and(evaluate(get_And_left(node)),
+		                  evaluate(get_And_right(node)));
+	case iro_Shl:
+		return tarval_shl(evaluate(get_Shl_left(node)),
+		                  evaluate(get_Shl_right(node)));
+	case iro_Cmp: {
+		ir_relation relation = tarval_cmp(evaluate(get_Cmp_left(node)),
+		                                  evaluate(get_Cmp_right(node)));
+		return relation & get_Cmp_relation(node) ? get_tarval_b_true()
+		                                         : get_tarval_b_false();
+	}
+	default:
+		panic("unexpected node %+F", node);
+	}
+}
+
+static void link_control_flow(ir_node *node, void *env)
+{
+	(void)env;
+	if (is_Jmp(node) || is_Cond(node) || is_Switch(node) || is_Return(node))
+		set_irn_link(get_nodes_block(node), node);
+}
+
+static ir_node *follow(ir_node *node, unsigned pn)
+{
+	foreach_irn_out_r(node, i, proj) {
+		if (get_Proj_num(proj) != pn)
+			continue;
+		assert(get_irn_n_outs(proj) == 1);
+		return get_irn_out(proj, 0);
+	}
+	panic("no Proj %u of %+F", pn, node);
+}
+
+/** Executes the lowered graph for @p value, returns the reached case. */
+static long execute(ir_graph *irg, ir_tarval *value)
+{
+	argument   = value;
+	n_branches = 0;
+	ir_node *block = get_irg_start_block(irg);
+	for (;;) {
+		ir_node *cf = (ir_node*)get_irn_link(block);
+		switch (get_irn_opcode(cf)) {
+		case iro_Jmp:
+			assert(get_irn_n_outs(cf) == 1);
+			block = get_irn_out(cf, 0);
+			break;
+		case iro_Cond: {
+			++n_branches;
+			bool taken = evaluate(get_Cond_selector(cf)) == get_tarval_b_true();
+			block = follow(cf, taken ? pn_Cond_true : pn_Cond_false);
+			break;
+		}
+		case iro_Switch: {
+			++n_branches;
+			ir_tarval             *selector = evaluate(get_Switch_selector(cf));
+			const ir_switch_table *table    = get_Switch_table(cf);
+			unsigned               pn       = pn_Switch_default;
+			for (size_t e = 0, n = ir_switch_table_get_n_entries(table);
+			     e < n; ++e) {
+				ir_tarval *min = ir_switch_table_get_min(table, e);
+				ir_tarval *max = ir_switch_table_get_max(table, e);
+				if (!(tarval_cmp(selector, min) & ir_relation_greater_equal)
+				    || !(tarval_cmp(selector, max) & ir_relation_less_equal))
+					continue;
+				pn = ir_switch_table_get_pn(table, e);
+			}
+			block = follow(cf, pn);
+			break;
+		}
+		case iro_Return:
+			return get_tarval_long(evaluate(get_Return_res(cf, 0)));
+		default:
+			panic("unexpected control flow %+F", cf);
+		}
+	}
+}
+
+static long expected(ir_tarval *value, const test_case_t *cases,
+                     size_t n_cases)
+{
+	ir_mode *mode = get_tarval_mode(value);
+	for (size_t c = 0; c < n_cases; ++c) {
+		ir_tarval *min = new_tarval_from_long(cases[c].min, mode);
+		ir_tarval *max = new_tarval_from_long(cases[c].max, mode);
+		if ((tarval_cmp(value, min) & ir_relation_greater_equal)
+		    && (tarval_cmp(value, max) & ir_relation_less_equal))
+			return cases[c].pn;
+	}
+	return pn_Switch_default;
+}
+
+static void count_switches(ir_node *node, void *env)
+{
+	if (is_Switch(node))
+		++*(unsigned*)env;
+}
+
+/**
+ * Builds return switch (x) { case min...max: return pn; ... default: 0 },
+ * lowers it and compares the result of the lowered graph with the cases.
+ */
+static unsigned test_switch(ir_mode *mode, const test_case_t *cases,
+                            size_t n_cases, unsigned hot_pn)
+{
+	static unsigned n_graphs;
+	ir_type *type = new_type_primitive(mode);
+	ir_type *mtp  = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, type);
+	set_method_res_type(mtp, 0, new_type_primitive(mode_Is));
+	char name[32];
+	snprintf(name, sizeof(name), "switch%u", n_graphs++);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	unsigned n_outs = 0;
+	for (size_t c = 0; c < n_cases; ++c)
+		n_outs = MAX(n_outs, cases[c].pn + 1);
+	ir_switch_table *table = ir_new_switch_table(irg, n_cases);
+	for (size_t c = 0; c < n_cases; ++c) {
+		ir_switch_table_set(table, c, new_tarval_from_long(cases[c].min, mode),
+		                    new_tarval_from_long(cases[c].max, mode),
+		                    cases[c].pn);
+	}
+	ir_node *selector = new_Proj(get_irg_args(irg), mode, 0);
+	ir_node *switchn  = new_Switch(selector, n_outs, table);
+	for (unsigned pn = 0; pn < n_outs; ++pn) {
+		ir_node *block = new_immBlock();
+		add_immBlock_pred(block, new_Proj(switchn, mode_X, pn));
+		mature_immBlock(block);
+		set_cur_block(block);
+		ir_node *res[] = { new_Const_long(mode_Is, pn) };
+		ir_node *ret   = new_Return(get_store(), ARRAY_SIZE(res), res);
+		add_immBlock_pred(get_irg_end_block(irg), ret);
+		if (pn == hot_pn)
+			set_block_execfreq(block, 100.0);
+	}
+	irg_finalize_cons(irg);
+
+	lower_switch(irg, 4, 256, mode_Iu);
+	assert(irg_verify(irg));
+
+	unsigned n_switches = 0;
+	irg_walk_graph(irg, count_switches, NULL, &n_switches);
+
+	assure_irg_outs(irg);
+	ir_reserve_resources(irg, IR_RESOURCE_IRN_LINK);
+	irg_walk_graph(irg, link_control_flow, NULL, NULL);
+
+	/* test the case bounds, their neighbours and the mode limits */
+	ir_tarval *one = get_mode_one(mode);
+	for (size_t c = 0; c < n_cases; ++c) {
+		ir_tarval *min    = new_tarval_from_long(cases[c].min, mode);
+		ir_tarval *max    = new_tarval_from_long(cases[c].max, mode);
+		ir_tarval *values[] = {
+			min, max, tarval_sub(min, one, NULL), tarval_add(max, one),
+		};
+		for (size_t v = 0; v < ARRAY_SIZE(values); ++v) {
+			ir_tarval *value = values[v];
+			assert(execute(irg, value) == expected(value, cases, n_cases));
+		}
+	}
+	ir_tarval *limits[] = {
+		get_mode_min(mode), get_mode_max(mode), get_mode_null(mode),
+		get_mode_all_one(mode),
+	};
+	for (size_t v = 0; v < ARRAY_SIZE(limits); ++v)
+		assert(execute(irg, limits[v]) == expected(limits[v], cases, n_cases));
+	if (get_mode_size_bits(mode) == 8) {
+		for (long v = 0; v < 256; ++v) {
+			ir_tarval *value = new_tarval_from_long(v, mode);
+			assert(execute(irg, value) == expected(value, cases, n_cases));
+		}
+	}
+
+	/* count the branches needed to reach the hot case */
+	for (size_t c = 0; c < n_cases; ++c) {
+		if (cases[c].pn != hot_pn)
+			continue;
+		execute(irg, new_tarval_from_long(cases[c].min, mode));
+		hot_branches = n_branches;
+		break;
+	}
+
+	ir_free_resources(irg, IR_RESOURCE_IRN_LINK);
+	return n_switches;
+}
+
+int main(void)
+{
+	ir_init();
+
+	/* few cases: compares only */
+	static const test_case_t small[] = {
+		{ 3, 3, 1 }, { -7, -7, 2 }, { 100, 120, 3 },
+	};
+	/* a single dense table */
+	static const test_case_t dense[] = {
+		{ 10, 10, 1 }, { 11, 11, 2 }, { 12, 13, 3 }, { 15, 15, 4 },
+		{ 16, 16, 5 }, { 17, 17, 1 }, { 18, 18, 2 },
+	};
+	/* two dense clusters, a bit test cluster and sparse cases */
+	static const test_case_t clustered[] = {
+		{ -120, -120, 10 },
+		{ -100, -100, 1 }, { -99, -99, 2 }, { -98, -97, 3 }, { -96, -96, 4 },
+		{ -95, -95, 5 }, { -94, -94, 1 },
+		{ -40, -40, 7 }, { -38, -38, 7 }, { -35, -33, 8 }, { -30, -30, 7 },
+		{ -26, -26, 8 }, { -20, -20, 7 },
+		{ 2, 2, 9 },
+		{ 50, 50, 1 }, { 51, 51, 2 }, { 52, 52, 3 }, { 53, 53, 4 },
+		{ 54, 55, 5 }, { 56, 56, 6 }, { 58, 58, 7 },
+		{ 120, 127, 9 },
+	};
+	/* values far apart and near the mode limits */
+	static const test_case_t wide[] = {
+		{ -2147483647L - 1, -2147483647L - 1, 1 },
+		{ -1000000, -1000000, 2 },
+		{ 0, 0, 3 }, { 1, 1, 4 }, { 2, 2, 5 }, { 3, 3, 6 }, { 4, 4, 3 },
+		{ 5, 5, 4 },
+		{ 1000000, 1000010, 2 },
+		{ 2147483646, 2147483647, 7 },
+	};
+	ir_mode *modes[] = {
+		mode_Bs, mode_Bu, mode_Hs, mode_Hu, mode_Is, mode_Iu, mode_Ls, mode_Lu,
+	};
+	for (size_t m = 0; m < ARRAY_SIZE(modes); ++m) {
+		ir_mode *mode = modes[m];
+		assert(test_switch(mode, small, ARRAY_SIZE(small), 0) == 0);
+		assert(test_switch(mode, dense, ARRAY_SIZE(dense), 0) == 1);
+		unsigned n = test_switch(mode, clustered, ARRAY_SIZE(clustered), 0);
+		assert(n == 2);
+		for (unsigned hot = 1; hot <= 10; ++hot)
+			test_switch(mode, clustered, ARRAY_SIZE(clustered), hot);
+		/* a hot single case is tested first */
+		test_switch(mode, clustered, ARRAY_SIZE(clustered), 10);
+		assert(hot_branches == 1);
+		if (get_mode_size_bits(mode) >= 32)
+			test_switch(mode, wide, ARRAY_SIZE(wide), 0);
+	}
+
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,116 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "firm.h"
+
+enum { N_GRAPHS = 200, N_BLOCKS = 40, N_VARS = 3 };
+
+static ir_node *new_int(long value)
+{
+	return new_Const_long(mode_Is, value);
+}
+
+/** Returns a value which is constant in some of the blocks. */
+static ir_node *new_value(int v)
+{
+	return rand() % 4 == 0 ? new_int(rand() % 4) : get_value(v, mode_Is);
+}
+
+/**
+ * Builds a random CFG in which each block branches to the next block and to
+ * a random other block. Many of the conditions become constant, so the local
+ * optimizations remove control flow edges and make blocks unreachable.
+ */
+static ir_graph *build_graph(int nr)
+{
+	char name[16];
+	snprintf(name, sizeof(name), "f%d", nr);
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, N_VARS);
+	set_current_ir_graph(irg);
+	/* keep the conditions until the optimization runs */
+	set_optimize(0);
+
+	ir_node *arg = new_Proj(get_irg_args(irg), mode_Is, 0);
+	for (int v = 0; v < N_VARS; ++v)
+		set_value(v, v == 0 ? arg : new_int(v));
+
+	ir_node *blocks[N_BLOCKS];
+	for (int i = 0; i < N_BLOCKS; ++i)
+		blocks[i] = new_immBlock();
+	add_immBlock_pred(blocks[0], new_Jmp());
+
+	for (int i = 0; i < N_BLOCKS; ++i) {
+		set_cur_block(blocks[i]);
+		int const v = rand() % N_VARS;
+		set_value(v, new_Add(new_value(v), new_value(rand() % N_VARS),
+		                     mode_Is));
+		if (i == N_BLOCKS - 1)
+			break;
+
+		ir_node *cmp  = new_Cmp(new_value(v), new_int(rand() % 4),
+		                        ir_relation_less);
+		ir_node *cond = new_Cond(cmp);
+		add_immBlock_pred(blocks[i + 1], new_Proj(cond, mode_X, pn_Cond_true));
+		add_immBlock_pred(blocks[rand() % N_BLOCKS],
+		                  new_Proj(cond, mode_X, pn_Cond_false));
+	}
+	/* keep endless loops */
+	for (int i = 0; i < N_BLOCKS; ++i) {
+		mature_immBlock(blocks[i]);
+		add_End_keepalive(get_irg_end(irg), blocks[i]);
+	}
+
+	ir_node *result = get_value(0, mode_Is);
+	for (int v = 1; v < N_VARS; ++v)
+		result = new_Add(result, get_value(v, mode_Is), mode_Is);
+	ir_node *ret = new_Return(get_store(), 1, &result);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+	set_optimize(1);
+	return irg;
+}
+
+/**
+ * Checks that a Phi does not select a single value, ignoring the operands
+ * from removed control flow and the Phi itself.
+ */
+static void check_phi(ir_node *node, void *env)
+{
+	(void)env;
+	if (!is_Phi(node) || get_irn_mode(node) == mode_M)
+		return;
+
+	ir_node *value = NULL;
+	for (int i = 0, n = get_Phi_n_preds(node); i < n; ++i) {
+		ir_node *pred = get_Phi_pred(node, i);
+		if (is_Bad(pred) || pred == node || pred == value)
+			continue;
+		if (value != NULL)
+			return;
+		value = pred;
+	}
+	ir_fprintf(stderr, "%s: %+F was not folded\n",
+	           get_entity_name(get_irg_entity(get_irn_irg(node))), node);
+	abort();
+}
+
+int main(void)
+{
+	ir_init();
+	srand(1);
+	for (int i = 0; i < N_GRAPHS; ++i) {
+		ir_graph *irg = build_graph(i);
+		optimize_graph_df(irg);
+		assert(irg_verify(irg));
+		irg_walk_graph(irg, check_phi, NULL, NULL);
+	}
+	ir_finish();
+	return 0;
+}
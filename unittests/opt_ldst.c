@@ -0,0 +1,92 @@
+#include <assert.h>
+#include <stdbool.h>
+
+#include "firm.h"
+
+static ir_node *unused_load;
+
+/**
+ * Builds
+ *   int f(int *p, int n) { for (i = 0; i < n; ++i) {} x = *p; (void)*p; return x; }
+ * The loop gives the graph Phis, the second Load has no result user.
+ */
+static ir_graph *build_graph(void)
+{
+	ir_type *int_type = new_type_primitive(mode_Is);
+	ir_type *ptr_type = new_type_pointer(int_type);
+	ir_type *mtp      = new_type_method(2, 1);
+	set_method_param_type(mtp, 0, ptr_type);
+	set_method_param_type(mtp, 1, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str("f"), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 1);
+	set_current_ir_graph(irg);
+	/* keep the local optimizations from removing the unused Load */
+	set_optimize(0);
+
+	ir_node *args = get_irg_args(irg);
+	ir_node *p    = new_Proj(args, mode_P, 0);
+	ir_node *n    = new_Proj(args, mode_Is, 1);
+	set_value(0, new_Const_long(mode_Is, 0));
+	ir_node *entry = new_Jmp();
+	mature_immBlock(get_cur_block());
+
+	ir_node *header = new_immBlock();
+	add_immBlock_pred(header, entry);
+	set_cur_block(header);
+	ir_node *cmp  = new_Cmp(get_value(0, mode_Is), n, ir_relation_less);
+	ir_node *cond = new_Cond(cmp);
+
+	ir_node *body = new_immBlock();
+	add_immBlock_pred(body, new_Proj(cond, mode_X, pn_Cond_true));
+	mature_immBlock(body);
+	set_cur_block(body);
+	set_value(0, new_Add(get_value(0, mode_Is), new_Const_long(mode_Is, 1),
+	                     mode_Is));
+	add_immBlock_pred(header, new_Jmp());
+	mature_immBlock(header);
+
+	ir_node *exit = new_immBlock();
+	add_immBlock_pred(exit, new_Proj(cond, mode_X, pn_Cond_false));
+	mature_immBlock(exit);
+	set_cur_block(exit);
+	ir_node *load = new_Load(get_store(), p, mode_Is, int_type, cons_none);
+	set_store(new_Proj(load, mode_M, pn_Load_M));
+	ir_node *res = new_Proj(load, mode_Is, pn_Load_res);
+	unused_load = new_Load(get_store(), p, mode_Is, int_type, cons_none);
+	set_store(new_Proj(unused_load, mode_M, pn_Load_M));
+	ir_node *ret = new_Return(get_store(), 1, &res);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+
+	irg_finalize_cons(irg);
+	set_optimize(1);
+	return irg;
+}
+
+/** Checks whether @p node is on the memory chain of the Return. */
+static bool on_memory_chain(ir_graph *irg, ir_node *node)
+{
+	ir_node *ret = get_Block_cfgpred(get_irg_end_block(irg), 0);
+	for (ir_node *mem = get_Return_mem(ret);
+	     is_Proj(mem) && is_Load(get_Proj_pred(mem));
+	     mem = get_Load_mem(get_Proj_pred(mem))) {
+		if (get_Proj_pred(mem) == node)
+			return true;
+	}
+	return false;
+}
+
+int main(void)
+{
+	ir_init();
+	ir_graph *irg = build_graph();
+	assert(on_memory_chain(irg, unused_load));
+
+	/* the unused Load is killed while the Phi lists are in use */
+	opt_ldst(irg);
+	assert(irg_verify(irg));
+	assert(!on_memory_chain(irg, unused_load));
+
+	ir_finish();
+	return 0;
+}
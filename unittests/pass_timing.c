@@ -0,0 +1,133 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "firm.h"
+#include "obst.h"
+
+static ir_graph *build_graph(const char *name)
+{
+	ir_type *type_int = new_type_primitive(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, type_int);
+	set_method_res_type(mtp, 0, type_int);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	ir_node *arg = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node *res = arg;
+	for (long i = 0; i < 1000; ++i)
+		res = new_Add(res, new_Const_long(mode_Is, i), mode_Is);
+	ir_node *ret = new_Return(get_store(), 1, &res);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+/** Returns the collapsed stack dump of the pass profile. */
+static char *dump(int memory)
+{
+	FILE *out = tmpfile();
+	assert(out != NULL);
+	ir_pass_timing_dump(out, memory);
+	long const len = ftell(out);
+	char *text = (char*)malloc(len + 1);
+	rewind(out);
+	size_t const n_read = fread(text, 1, len, out);
+	assert(n_read == (size_t)len);
+	text[len] = '\0';
+	fclose(out);
+	return text;
+}
+
+/** Checks that every line is a path followed by a positive value. */
+static void check_lines(const char *text)
+{
+	for (const char *line = text; *line != '\0';) {
+		const char *end   = strchr(line, '\n');
+		assert(end != NULL);
+		const char *space = end;
+		while (space > line && *space != ' ')
+			--space;
+		assert(space > line);
+		char *value_end;
+		unsigned long long value = strtoull(space + 1, &value_end, 10);
+		assert(value > 0 && value_end == end);
+		line = end + 1;
+	}
+}
+
+/** Returns true if a line of @p text starts with @p path. */
+static int has_path(const char *text, const char *path)
+{
+	size_t const len = strlen(path);
+	for (const char *line = text; *line != '\0';) {
+		if (strncmp(line, path, len) == 0 && line[len] == ' ')
+			return 1;
+		line = strchr(line, '\n') + 1;
+	}
+	return 0;
+}
+
+int main(void)
+{
+	ir_init();
+	ir_graph *f = build_graph("f");
+	ir_graph *g = build_graph("g");
+
+	/* nothing is recorded while disabled */
+	optimize_graph_df(f);
+	char *text = dump(0);
+	assert(text[0] == '\0');
+	free(text);
+
+	ir_pass_timing_enable(1);
+	ir_pass_timing_push("driver", NULL);
+	for (int i = 0; i < 200; ++i) {
+		optimize_graph_df(f);
+		optimize_graph_df(g);
+		/* f has a single return, the pass leaves early */
+		normalize_one_return(f);
+		optimize_cf(f);
+	}
+	ir_pass_timing_push("nested", f);
+	ir_pass_timing_push("inner", NULL);
+	/* spend some time and memory in the inner pass */
+	unsigned long long const live = ir_obstack_bytes_live();
+	ir_obstack_reset_peak();
+	struct obstack obst;
+	obstack_init(&obst);
+	for (int i = 0; i < 1000; ++i)
+		obstack_alloc(&obst, 1024);
+	obstack_free(&obst, NULL);
+	assert(ir_obstack_bytes_live() == live);
+	assert(ir_obstack_bytes_peak() >= live + 1000 * 1024);
+	ir_pass_timing_pop();
+	ir_pass_timing_pop();
+	ir_pass_timing_pop();
+
+	text = dump(0);
+	check_lines(text);
+	assert(has_path(text, "driver;f;optimize_graph_df"));
+	assert(has_path(text, "driver;g;optimize_graph_df"));
+	assert(has_path(text, "driver;f;optimize_cf"));
+	assert(!has_path(text, "driver;f;normalize_one_return;optimize_cf"));
+	free(text);
+
+	text = dump(1);
+	check_lines(text);
+	assert(has_path(text, "driver;f;nested;inner"));
+	assert(!has_path(text, "driver;f;nested"));
+	free(text);
+
+	ir_pass_timing_reset();
+	text = dump(0);
+	assert(text[0] == '\0');
+	free(text);
+
+	ir_pass_timing_enable(0);
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,165 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "firm.h"
+#include "irmemory_t.h"
+
+enum { N_KINDS = 2 };
+
+/** The interesting nodes of a function f<nr>. */
+typedef struct function_t {
+	ir_graph *irg;
+	ir_node  *p;   /**< first parameter, points to a */
+	ir_node  *q;   /**< second parameter, points to b */
+	ir_node  *x;   /**< q + n */
+	ir_node  *y;   /**< q - n */
+	ir_node  *off; /**< n */
+} function_t;
+
+static function_t functions[N_KINDS];
+static ir_type   *int_type;
+
+/**
+ * Builds
+ *   static int f<nr>(int *p, int *q, int n) { *p = 0; *q = 0; return *(q + n) + *(q - n); }
+ */
+static ir_entity *build_function(int nr)
+{
+	char name[16];
+	snprintf(name, sizeof(name), "f%d", nr);
+	ir_type *ptr_type = new_type_pointer(int_type);
+	ir_type *mtp      = new_type_method(3, 1);
+	set_method_param_type(mtp, 0, ptr_type);
+	set_method_param_type(mtp, 1, ptr_type);
+	set_method_param_type(mtp, 2, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	set_entity_visibility(entity, ir_visibility_local);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	function_t *fun  = &functions[nr];
+	ir_node    *args = get_irg_args(irg);
+	fun->irg = irg;
+	fun->p   = new_Proj(args, mode_P, 0);
+	fun->q   = new_Proj(args, mode_P, 1);
+	fun->off = new_Proj(args, mode_Is, 2);
+	fun->x   = new_Add(fun->q, fun->off, mode_P);
+	fun->y   = new_Sub(fun->q, fun->off, mode_P);
+
+	ir_node *const zero = new_Const_long(mode_Is, 0);
+	for (int i = 0; i < 2; ++i) {
+		ir_node *ptr   = i == 0 ? fun->p : fun->q;
+		ir_node *store = new_Store(get_store(), ptr, zero, int_type, cons_none);
+		set_store(new_Proj(store, mode_M, pn_Store_M));
+	}
+	ir_node *load_x = new_Load(get_store(), fun->x, mode_Is, int_type, cons_none);
+	set_store(new_Proj(load_x, mode_M, pn_Load_M));
+	ir_node *load_y = new_Load(get_store(), fun->y, mode_Is, int_type, cons_none);
+	set_store(new_Proj(load_y, mode_M, pn_Load_M));
+	ir_node *sum = new_Add(new_Proj(load_x, mode_Is, pn_Load_res),
+	                       new_Proj(load_y, mode_Is, pn_Load_res), mode_Is);
+	ir_node *ret = new_Return(get_store(), 1, &sum);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+	return entity;
+}
+
+/**
+ * Builds
+ *   static int a, b;
+ *   int g(int n) { return f0(&a, &b, n) + f1(&a, &b, n); }
+ */
+static void build_program(void)
+{
+	int_type = get_type_for_mode(mode_Is);
+	ir_entity *a = new_entity(get_glob_type(), new_id_from_str("a"), int_type);
+	ir_entity *b = new_entity(get_glob_type(), new_id_from_str("b"), int_type);
+	set_entity_visibility(a, ir_visibility_local);
+	set_entity_visibility(b, ir_visibility_local);
+	ir_entity *callees[N_KINDS];
+	for (int i = 0; i < N_KINDS; ++i)
+		callees[i] = build_function(i);
+
+	ir_type *mtp = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str("g"), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	ir_node *n   = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node *sum = new_Const_long(mode_Is, 0);
+	for (int i = 0; i < N_KINDS; ++i) {
+		ir_node *in[] = { new_Address(a), new_Address(b), n };
+		ir_node *call = new_Call(get_store(), new_Address(callees[i]), 3, in,
+		                         get_entity_type(callees[i]));
+		set_store(new_Proj(call, mode_M, pn_Call_M));
+		ir_node *res = new_Proj(call, mode_T, pn_Call_T_result);
+		sum = new_Add(sum, new_Proj(res, mode_Is, 0), mode_Is);
+	}
+	ir_node *ret = new_Return(get_store(), 1, &sum);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+}
+
+static ir_alias_relation get_relation(ir_node *addr1, ir_node *addr2)
+{
+	return get_alias_relation(addr1, int_type, 4, addr2, int_type, 4);
+}
+
+static void find_param(ir_node *node, void *env)
+{
+	ir_node **params = (ir_node**)env;
+	if (is_Proj(node) && get_Proj_pred(node) == get_irg_args(get_irn_irg(node))
+	    && get_irn_mode(node) == mode_P)
+		params[get_Proj_num(node)] = node;
+}
+
+/**
+ * Checks that the points-to analysis separates the parameters, and forgets
+ * the results of nodes whose inputs change.
+ */
+static void check_solver(ir_points_to_kind kind, function_t *fun)
+{
+	compute_irp_points_to(kind);
+	assert(get_relation(fun->p, fun->q) == ir_no_alias);
+	assert(get_relation(fun->x, fun->p) == ir_no_alias);
+	assert(get_relation(fun->y, fun->p) == ir_no_alias);
+	assert(get_relation(fun->x, fun->y) == ir_may_alias);
+
+	/* x = p + n: the cached relation must not be used anymore */
+	set_irn_n(fun->x, 0, fun->p);
+	assert(get_points_to_relation(fun->x, fun->p) == ir_may_alias);
+	assert(get_relation(fun->x, fun->p) == ir_may_alias);
+
+	/* y = p - n */
+	ir_node *const in[] = { fun->p, fun->off };
+	set_irn_in(fun->y, 2, in);
+	assert(get_points_to_relation(fun->y, fun->p) == ir_may_alias);
+	assert(get_relation(fun->y, fun->p) == ir_may_alias);
+
+	/* unchanged nodes keep their results, also in copies */
+	assert(get_relation(fun->p, fun->q) == ir_no_alias);
+	dead_node_elimination(fun->irg);
+	ir_node *params[2] = { NULL, NULL };
+	irg_walk_graph(fun->irg, find_param, NULL, params);
+	assert(params[0] != NULL && params[1] != NULL);
+	assert(get_relation(params[0], params[1]) == ir_no_alias);
+
+	free_irp_points_to();
+	assert(get_relation(params[0], params[1]) == ir_may_alias);
+}
+
+int main(void)
+{
+	ir_init();
+	build_program();
+	check_solver(ir_points_to_unification, &functions[0]);
+	check_solver(ir_points_to_inclusion, &functions[1]);
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,95 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "firm.h"
+
+enum { N_BLOCKS = 100, N_VARS = 4 };
+
+static ir_node *new_int(long value)
+{
+	return new_Const_long(mode_Is, value);
+}
+
+static ir_node *new_random_op(ir_node *left, ir_node *right)
+{
+	switch (rand() % 8) {
+	case 0:  return new_Add(left, right, mode_Is);
+	case 1:  return new_Sub(left, right, mode_Is);
+	case 2:  return new_Mul(left, right, mode_Is);
+	case 3:  return new_And(left, right, mode_Is);
+	case 4:  return new_Or(left, right, mode_Is);
+	case 5:  return new_Eor(left, right, mode_Is);
+	case 6:  return new_Shl(left, new_Const_long(mode_Iu, rand() % 31), mode_Is);
+	default: return new_Add(left, new_int(rand() % 100), mode_Is);
+	}
+}
+
+/**
+ * Builds a large CFG in which each block branches to the next block and to a
+ * random other block. The resulting loop nests are so deep that the
+ * execution frequencies of the inner blocks exceed the range of float.
+ */
+static void build_graph(void)
+{
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str("f"), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, N_VARS);
+	set_current_ir_graph(irg);
+
+	ir_node *arg = new_Proj(get_irg_args(irg), mode_Is, 0);
+	for (int v = 0; v < N_VARS; ++v)
+		set_value(v, v == 0 ? arg : new_int(v));
+
+	ir_node *blocks[N_BLOCKS];
+	for (int i = 0; i < N_BLOCKS; ++i)
+		blocks[i] = new_immBlock();
+	add_immBlock_pred(blocks[0], new_Jmp());
+
+	for (int i = 0; i < N_BLOCKS; ++i) {
+		set_cur_block(blocks[i]);
+		int const v = rand() % N_VARS;
+		set_value(v, new_random_op(get_value(v, mode_Is),
+		                           get_value(rand() % N_VARS, mode_Is)));
+		if (i == N_BLOCKS - 1)
+			break;
+
+		ir_node *cmp  = new_Cmp(get_value(v, mode_Is), new_int(rand() % 1000),
+		                        ir_relation_less);
+		ir_node *cond = new_Cond(cmp);
+		add_immBlock_pred(blocks[i + 1], new_Proj(cond, mode_X, pn_Cond_true));
+		add_immBlock_pred(blocks[rand() % N_BLOCKS],
+		                  new_Proj(cond, mode_X, pn_Cond_false));
+	}
+	for (int i = 0; i < N_BLOCKS; ++i)
+		mature_immBlock(blocks[i]);
+
+	ir_node *result = get_value(0, mode_Is);
+	for (int v = 1; v < N_VARS; ++v)
+		result = new_Add(result, get_value(v, mode_Is), mode_Is);
+	ir_node *ret = new_Return(get_store(), 1, &result);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	irg_finalize_cons(irg);
+}
+
+int main(void)
+{
+	ir_init();
+	int res = be_parse_arg("regalloc=pref");
+	assert(res);
+	(void)res;
+	srand(1);
+	build_graph();
+
+	FILE *null = fopen("/dev/null", "w");
+	assert(null != NULL);
+	be_lower_for_target();
+	be_main(null, "prefalloc_weights");
+	fclose(null);
+
+	ir_finish();
+	return 0;
+}
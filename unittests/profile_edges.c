@@ -0,0 +1,332 @@
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "firm.h"
+#include "array.h"
+#include "irprofile.h"
+#include "irprog_t.h"
+#include "xmalloc.h"
+
+enum { N_GRAPHS = 8, MAX_BLOCKS = 40, N_RUNS = 200 };
+
+static ir_entity *callee;
+
+/**
+ * Builds a CFG in which each block branches to the next block and to a
+ * random block at most 4 blocks before or after it. Some blocks contain a
+ * call whose exception edge leads to a handler block returning early.
+ */
+static ir_graph *build_graph(char const *prefix, int nr)
+{
+	char name[16];
+	snprintf(name, sizeof(name), "%s%d", prefix, nr);
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str(name), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	int const n_blocks = 4 + nr * 4;
+	assert(n_blocks <= MAX_BLOCKS);
+	ir_node *arg = new_Proj(get_irg_args(irg), mode_Is, 0);
+	ir_node *end = get_irg_end_block(irg);
+	ir_node *blocks[MAX_BLOCKS];
+	for (int i = 0; i < n_blocks; ++i)
+		blocks[i] = new_immBlock();
+	add_immBlock_pred(blocks[0], new_Jmp());
+	mature_immBlock(get_cur_block());
+
+	for (int i = 0; i < n_blocks - 1; ++i) {
+		set_cur_block(blocks[i]);
+		if (rand() % 3 == 0) {
+			ir_node *addr = new_Address(callee);
+			ir_node *call = new_Call(get_store(), addr, 1, &arg, mtp);
+			ir_set_throws_exception(call, 1);
+			set_store(new_Proj(call, mode_M, pn_Call_M));
+			ir_node *regular = new_Proj(call, mode_X, pn_Call_X_regular);
+			ir_node *except  = new_Proj(call, mode_X, pn_Call_X_except);
+
+			ir_node *handler = new_immBlock();
+			add_immBlock_pred(handler, except);
+			mature_immBlock(handler);
+			set_cur_block(handler);
+			add_immBlock_pred(end, new_Return(get_store(), 1, &arg));
+
+			ir_node *next = new_immBlock();
+			add_immBlock_pred(next, regular);
+			mature_immBlock(next);
+			set_cur_block(next);
+		}
+		ir_node *cmp  = new_Cmp(arg, new_Const_long(mode_Is, i),
+		                        ir_relation_less);
+		ir_node *cond = new_Cond(cmp);
+		int target = i + rand() % 9 - 4;
+		if (target < 0)
+			target = 0;
+		else if (target >= n_blocks)
+			target = n_blocks - 1;
+		add_immBlock_pred(blocks[i + 1], new_Proj(cond, mode_X, pn_Cond_true));
+		add_immBlock_pred(blocks[target], new_Proj(cond, mode_X, pn_Cond_false));
+	}
+	for (int i = 0; i < n_blocks; ++i)
+		mature_immBlock(blocks[i]);
+
+	set_cur_block(blocks[n_blocks - 1]);
+	add_immBlock_pred(end, new_Return(get_store(), 1, &arg));
+	irg_finalize_cons(irg);
+	return irg;
+}
+
+static void build_program(char const *prefix)
+{
+	srand(1);
+	for (int i = 0; i < N_GRAPHS; ++i) {
+		ir_graph *irg = build_graph(prefix, i);
+		/* the profiling code does the same, do it here already so the
+		 * recorded blocks are the ones it sees */
+		ir_estimate_execfreq(irg);
+	}
+}
+
+/** A control flow edge of the simulated program. */
+typedef struct succ_t {
+	ir_node *block;
+	int      pos;
+} succ_t;
+
+/** Execution counts of a block of the program before instrumentation. */
+typedef struct original_t {
+	ir_node  *block;
+	uint64_t  count;
+	uint64_t *edge_counts; /**< by predecessor position */
+} original_t;
+
+/** Simulation state of a block of the instrumented graph. */
+typedef struct block_info_t {
+	succ_t     *succs;
+	unsigned   *counters; /**< counters incremented in the block */
+	original_t *original; /**< NULL for blocks added by the instrumentation */
+} block_info_t;
+
+static original_t   *originals;
+static block_info_t *infos;
+static ir_entity    *counters;
+static uint64_t     *counter_values;
+
+static void collect_block(ir_node *block, void *env)
+{
+	(void)env;
+	original_t const original = {
+		block, 0, XMALLOCNZ(uint64_t, get_Block_n_cfgpreds(block))
+	};
+	ARR_APP1(original_t, originals, original);
+}
+
+static void add_succs(ir_node *block, void *env)
+{
+	(void)env;
+	for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+		ir_node *pred = get_Block_cfgpred_block(block, i);
+		if (pred == NULL)
+			continue;
+		block_info_t *info = &infos[get_irn_idx(pred)];
+		succ_t const  succ = { block, i };
+		if (info->succs == NULL)
+			info->succs = NEW_ARR_F(succ_t, 0);
+		ARR_APP1(succ_t, info->succs, succ);
+	}
+}
+
+/**
+ * Records the counter increments: the Store of the low word of counter i
+ * goes to counters + 8 * i.
+ */
+static void find_counters(ir_node *node, void *env)
+{
+	(void)env;
+	if (!is_Store(node))
+		return;
+	ir_node *ptr    = get_Store_ptr(node);
+	long     offset = 0;
+	if (is_Add(ptr)) {
+		offset = get_tarval_long(get_Const_tarval(get_Add_right(ptr)));
+		ptr    = get_Add_left(ptr);
+	}
+	if (!is_Address(ptr) || get_Address_entity(ptr) != counters
+	    || offset % 8 != 0)
+		return;
+	block_info_t *info = &infos[get_irn_idx(get_nodes_block(node))];
+	if (info->counters == NULL)
+		info->counters = NEW_ARR_F(unsigned, 0);
+	ARR_APP1(unsigned, info->counters, (unsigned)(offset / 8));
+}
+
+static void enter(ir_node *block, int pos)
+{
+	block_info_t *info     = &infos[get_irn_idx(block)];
+	original_t   *original = info->original;
+	if (original != NULL) {
+		++original->count;
+		if (pos >= 0)
+			++original->edge_counts[pos];
+	}
+	if (info->counters != NULL) {
+		for (size_t i = 0, n = ARR_LEN(info->counters); i < n; ++i)
+			++counter_values[info->counters[i]];
+	}
+}
+
+/**
+ * Runs the instrumented graph along random paths and counts the executions
+ * of the original blocks and edges and the counter increments. Blocks added
+ * by the instrumentation keep the predecessor position of the edge they
+ * split, so entering the original block afterwards counts the right edge.
+ */
+static void simulate(ir_graph *irg, original_t *first)
+{
+	unsigned const last_idx = get_irg_last_idx(irg);
+	infos = XMALLOCNZ(block_info_t, last_idx);
+	for (original_t *o = first; o != originals + ARR_LEN(originals)
+	     && get_irn_irg(o->block) == irg; ++o) {
+		infos[get_irn_idx(o->block)].original = o;
+	}
+	irg_block_walk_graph(irg, add_succs, NULL, NULL);
+	irg_walk_graph(irg, find_counters, NULL, NULL);
+
+	ir_node *const end = get_irg_end_block(irg);
+	for (int r = 0; r < N_RUNS; ++r) {
+		ir_node *block = get_irg_start_block(irg);
+		enter(block, -1);
+		while (block != end) {
+			succ_t const *succs = infos[get_irn_idx(block)].succs;
+			succ_t const *succ  = &succs[rand() % ARR_LEN(succs)];
+			block = succ->block;
+			enter(block, succ->pos);
+		}
+	}
+
+	for (unsigned i = 0; i < last_idx; ++i) {
+		if (infos[i].succs != NULL)
+			DEL_ARR_F(infos[i].succs);
+		if (infos[i].counters != NULL)
+			DEL_ARR_F(infos[i].counters);
+	}
+	free(infos);
+}
+
+static void write_profile(char const *name, unsigned n_counters)
+{
+	FILE *f = fopen(name, "wb");
+	assert(f != NULL);
+	fwrite("firmprof", 1, 8, f);
+	for (unsigned i = 0; i < n_counters; ++i) {
+		unsigned char bytes[8];
+		for (unsigned b = 0; b < 8; ++b)
+			bytes[b] = (unsigned char)(counter_values[i] >> (8 * b));
+		fwrite(bytes, 1, 8, f);
+	}
+	fclose(f);
+}
+
+static size_t n_checked;
+
+static void check_block(ir_node *block, void *env)
+{
+	(void)env;
+	original_t const *original = &originals[n_checked++];
+	uint64_t   const  count    = ir_profile_get_block_execcount(block);
+	if (count != original->count) {
+		ir_fprintf(stderr, "%+F executed %" PRIu64 " times instead of %" PRIu64 "\n",
+		           block, count, original->count);
+		abort();
+	}
+	for (int i = 0, n = get_Block_n_cfgpreds(block); i < n; ++i) {
+		uint64_t   edge_count;
+		bool const found = ir_profile_get_edge_execcount(block, i, &edge_count);
+		assert(found);
+		(void)found;
+		if (edge_count != original->edge_counts[i]) {
+			ir_fprintf(stderr, "edge %d of %+F taken %" PRIu64 " times instead of %" PRIu64 "\n",
+			           i, block, edge_count, original->edge_counts[i]);
+			abort();
+		}
+	}
+}
+
+static ir_entity *find_global(char const *name)
+{
+	ident   *id   = new_id_from_str(name);
+	ir_type *glob = get_glob_type();
+	for (size_t i = 0, n = get_compound_n_members(glob); i < n; ++i) {
+		ir_entity *member = get_compound_member(glob, i);
+		if (get_entity_ident(member) == id)
+			return member;
+	}
+	return NULL;
+}
+
+/**
+ * Instruments a program with edge counters and runs it along random paths.
+ * Then reads the resulting profile for an identical program and checks that
+ * the counts of all blocks and edges reconstructed from the counters match
+ * the simulated ones.
+ */
+int main(void)
+{
+	ir_init();
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(1, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	callee = new_entity(get_glob_type(), new_id_from_str("callee"), mtp);
+
+	char const *const filename = "profile_edges.prof";
+	build_program("f");
+	ir_graph **irgs  = NEW_ARR_F(ir_graph*, 0);
+	size_t    *first = NEW_ARR_F(size_t, 0);
+	originals = NEW_ARR_F(original_t, 0);
+	foreach_irp_irg(i, irg) {
+		ARR_APP1(ir_graph*, irgs, irg);
+		ARR_APP1(size_t, first, ARR_LEN(originals));
+		irg_block_walk_graph(irg, collect_block, NULL, NULL);
+	}
+
+	ir_graph *init = ir_profile_instrument(filename, ir_profile_edges);
+	assert(init != NULL);
+	counters = find_global("__FIRMPROF__BLOCK_COUNTS");
+	assert(counters != NULL);
+	unsigned const n_counters = get_array_size_int(get_entity_type(counters)) / 2;
+	counter_values = XMALLOCNZ(uint64_t, n_counters);
+	for (size_t i = 0; i < ARR_LEN(irgs); ++i)
+		simulate(irgs[i], &originals[first[i]]);
+	write_profile(filename, n_counters);
+
+	/* build the program again and read the profile for it */
+	for (size_t i = 0; i < ARR_LEN(irgs); ++i)
+		free_ir_graph(irgs[i]);
+	free_ir_graph(init);
+	build_program("g");
+	bool const read = ir_profile_read(filename, ir_profile_edges);
+	assert(read);
+	(void)read;
+	remove(filename);
+	foreach_irp_irg(i, irg) {
+		irg_block_walk_graph(irg, check_block, NULL, NULL);
+	}
+	assert(n_checked == ARR_LEN(originals));
+
+	for (size_t i = 0; i < ARR_LEN(originals); ++i)
+		free(originals[i].edge_counts);
+	DEL_ARR_F(originals);
+	DEL_ARR_F(first);
+	DEL_ARR_F(irgs);
+	free(counter_values);
+
+	ir_profile_free();
+	ir_finish();
+	return 0;
+}
@@ -0,0 +1,113 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "firm.h"
+
+enum { N_MULS = 4, N_ALU_OPS = 4 };
+
+/**
+ * Builds
+ *   int f(int a, int b) {
+ *     int x = a; for (N_MULS) x = x * b;
+ *     int y = a; for (N_ALU_OPS) y = (y ^ c_i) + c_i;
+ *     return x + y;
+ *   }
+ * in a single block. The multiplications form the critical path, the
+ * cheaper ALU operations do not depend on them. Few values are live at the
+ * same time, so the register pressure guard does not interfere.
+ */
+static void build_graph(void)
+{
+	ir_type *int_type = get_type_for_mode(mode_Is);
+	ir_type *mtp      = new_type_method(2, 1);
+	set_method_param_type(mtp, 0, int_type);
+	set_method_param_type(mtp, 1, int_type);
+	set_method_res_type(mtp, 0, int_type);
+	ir_entity *entity = new_entity(get_glob_type(), new_id_from_str("f"), mtp);
+	ir_graph  *irg    = new_ir_graph(entity, 0);
+	set_current_ir_graph(irg);
+
+	ir_node *args = get_irg_args(irg);
+	ir_node *a    = new_Proj(args, mode_Is, 0);
+	ir_node *b    = new_Proj(args, mode_Is, 1);
+	ir_node *x    = a;
+	for (int i = 0; i < N_MULS; ++i)
+		x = new_Mul(x, b, mode_Is);
+	ir_node *y = a;
+	for (int i = 0; i < N_ALU_OPS; ++i) {
+		ir_node *c = new_Const_long(mode_Is, 3 + i * 16);
+		y = new_Add(new_Eor(y, c, mode_Is), c, mode_Is);
+	}
+	ir_node *result = new_Add(x, y, mode_Is);
+	ir_node *ret    = new_Return(get_store(), 1, &result);
+	add_immBlock_pred(get_irg_end_block(irg), ret);
+	mature_immBlock(get_cur_block());
+	irg_finalize_cons(irg);
+}
+
+/**
+ * Returns the first line starting at @p text with the instruction
+ * @p mnemonic, or NULL.
+ */
+static const char *find_insn(const char *text, const char *mnemonic)
+{
+	size_t const len = strlen(mnemonic);
+	for (const char *line = text; line != NULL;) {
+		const char *p = line;
+		while (*p == ' ' || *p == '\t')
+			++p;
+		if (strncmp(p, mnemonic, len) == 0)
+			return line;
+		line = strchr(line, '\n');
+		if (line != NULL)
+			++line;
+	}
+	return NULL;
+}
+
+/**
+ * Compiles the graph with the latency scheduler and the ia32 machine model.
+ * Scheduling the critical path first starts the first multiplication before
+ * any of the independent ALU operations, and the ALU operations fill the
+ * cycles until its result is available.
+ */
+int main(void)
+{
+	ir_init();
+	int res = be_parse_arg("scheduler=latency");
+	assert(res);
+	res = be_parse_arg("ia32-arch=core2");
+	assert(res);
+	(void)res;
+	build_graph();
+
+	FILE *out = tmpfile();
+	assert(out != NULL);
+	be_lower_for_target();
+	be_main(out, "sched_latency");
+
+	long const size = ftell(out);
+	char      *text = malloc(size + 1);
+	rewind(out);
+	size_t const n_read = fread(text, 1, size, out);
+	assert(n_read == (size_t)size);
+	(void)n_read;
+	text[size] = '\0';
+	fclose(out);
+
+	const char *first_mul  = find_insn(text, "imul");
+	const char *first_xor  = find_insn(text, "xor");
+	assert(first_mul != NULL && first_xor != NULL);
+	const char *second_mul = find_insn(strchr(first_mul, '\n') + 1, "imul");
+	assert(second_mul != NULL);
+	if (first_xor < first_mul || first_xor > second_mul) {
+		fprintf(stderr, "multiplications are not interleaved:\n%s", text);
+		return 1;
+	}
+	free(text);
+
+	ir_finish();
+	return 0;
+}
@@ -42,5 +42,12 @@ int main(void)
 	assert(streq(buf, "Hello W"));
 	assert(r == 11);
 
+	/* %f of a large double does not fit into the default conversion buffer */
+	char big[512];
+	r = ir_snprintf(big, sizeof(big), "%.3f", 1e300);
+	assert(r == 305);
+	assert(strncmp(big, "1000000000", 10) == 0);
+	assert(streq(big + 301, ".000"));
+
 	return 0;
 }
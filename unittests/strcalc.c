@@ -12,16 +12,19 @@
 #include "xmalloc.h"
 #include "util.h"
 
-static const unsigned precision = 72; /* some random non-po2 number (but a multiple of SC_BITS),
-                                         as strcalc rounds up to multiple of SC_BITS anyway */
+static const unsigned precision = 72; /* some random non-po2 number, strcalc
+                                         rounds up to a multiple of SC_BITS */
 static unsigned buflen;
 
 static bool equal(const sc_word *v0, const sc_word *v1)
 {
-	/* use precision/SC_BITS instead of buflen for now until we don't have these
-	 * strange extra precision words anymore. */
-	size_t len = precision/SC_BITS;
-	return memcmp(v0, v1, len) == 0;
+	/* compare precision bits instead of buflen for now until we don't have
+	 * these strange extra precision words anymore. */
+	for (unsigned i = 0; i < precision; ++i) {
+		if (sc_get_bit_at(v0, i) != sc_get_bit_at(v1, i))
+			return false;
+	}
+	return true;
 }
 
 static bool streq(const char *str0, const char *str1)
@@ -261,7 +264,7 @@ int main(void)
 
 		/* workaround until we don't have this stupid
 		 * calc_buffer_size*4 > precision anymore */
-		memcpy(temp, val, buflen);
+		memcpy(temp, val, buflen * sizeof(sc_word));
 		sc_zero_extend(temp, precision);
 
 		sc_shrI(temp, precision, temp);
@@ -286,7 +289,7 @@ int main(void)
 			sc_shlI(val, b, temp);
 			sc_zero_extend(temp, precision); /* higher precision workaround */
 			sc_shrI(temp, b, temp);
-			memcpy(temp1, val, buflen);
+			memcpy(temp1, val, buflen * sizeof(sc_word));
 			sc_zero_extend(temp1, precision-b);
 			assert(equal(temp, temp1));
 
@@ -294,7 +297,7 @@ int main(void)
 				sc_shlI(val, precision-b, temp);
 				sc_zero_extend(temp, precision); /* higher precision workaround */
 				sc_shrsI(temp, precision-b, precision, temp);
-				memcpy(temp1, val, buflen);
+				memcpy(temp1, val, buflen * sizeof(sc_word));
 				sc_sign_extend(temp1, b);
 				assert(equal(temp, temp1));
 			}